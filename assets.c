@@ -0,0 +1,74 @@
+/* Generated by tools/mkasset from assets/assets.txt. Don't edit it, edit that. */
+#include "assets.h"
+
+/* dialtone tone 350+440 -10.5: 800 samples at 8000 Hz, one period. */
+static const uint8_t dialtoneData[800] __attribute__((aligned(4096))) = {
+    0x80, 0x97, 0xAC, 0xBD, 0xC8, 0xCB, 0xC8, 0xBD, 0xAD, 0x99, 0x83, 0x6D,
+    0x5A, 0x4B, 0x41, 0x3E, 0x42, 0x4B, 0x58, 0x69, 0x7B, 0x8D, 0x9C, 0xA8,
+    0xAE, 0xB0, 0xAD, 0xA6, 0x9C, 0x90, 0x84, 0x79, 0x70, 0x6A, 0x67, 0x67,
+    0x6A, 0x6E, 0x74, 0x79, 0x7E, 0x81, 0x83, 0x83, 0x81, 0x7F, 0x7C, 0x7A,
+    0x79, 0x7A, 0x7D, 0x82, 0x88, 0x8F, 0x96, 0x9B, 0x9E, 0x9E, 0x9B, 0x94,
+    0x89, 0x7D, 0x6F, 0x62, 0x57, 0x4F, 0x4B, 0x4D, 0x54, 0x60, 0x70, 0x82,
+    0x95, 0xA7, 0xB6, 0xC0, 0xC5, 0xC2, 0xB9, 0xAA, 0x96, 0x80, 0x6A, 0x55,
+    0x44, 0x38, 0x34, 0x37, 0x41, 0x51, 0x66, 0x7D, 0x94, 0xA9, 0xBA, 0xC6,
+    0xCA, 0xC7, 0xBE, 0xAE, 0x9B, 0x86, 0x71, 0x5E, 0x4F, 0x45, 0x41, 0x44,
+    0x4C, 0x59, 0x69, 0x79, 0x8A, 0x98, 0xA3, 0xAA, 0xAC, 0xA9, 0xA3, 0x9A,
+    0x90, 0x85, 0x7C, 0x74, 0x6F, 0x6C, 0x6D, 0x6F, 0x73, 0x77, 0x7C, 0x7F,
+    0x80, 0x80, 0x7F, 0x7C, 0x79, 0x76, 0x74, 0x74, 0x77, 0x7B, 0x82, 0x8A,
+    0x92, 0x9A, 0xA0, 0xA3, 0xA3, 0x9F, 0x98, 0x8C, 0x7F, 0x70, 0x61, 0x55,
+    0x4C, 0x47, 0x49, 0x4F, 0x5C, 0x6C, 0x7F, 0x94, 0xA7, 0xB7, 0xC2, 0xC7,
+    0xC5, 0xBC, 0xAE, 0x9A, 0x84, 0x6C, 0x57, 0x45, 0x39, 0x34, 0x36, 0x3F,
+    0x4F, 0x63, 0x79, 0x91, 0xA6, 0xB7, 0xC3, 0xC8, 0xC6, 0xBD, 0xAF, 0x9D,
+    0x88, 0x74, 0x62, 0x53, 0x49, 0x45, 0x47, 0x4E, 0x5A, 0x68, 0x78, 0x87,
+    0x94, 0x9E, 0xA4, 0xA6, 0xA5, 0x9F, 0x97, 0x8F, 0x85, 0x7D, 0x77, 0x73,
+    0x72, 0x72, 0x75, 0x78, 0x7B, 0x7E, 0x80, 0x80, 0x7E, 0x7B, 0x77, 0x74,
+    0x71, 0x6F, 0x70, 0x73, 0x79, 0x81, 0x8A, 0x94, 0x9D, 0xA4, 0xA8, 0xA9,
+    0xA4, 0x9C, 0x90, 0x81, 0x70, 0x61, 0x53, 0x49, 0x44, 0x44, 0x4B, 0x58,
+    0x69, 0x7D, 0x92, 0xA6, 0xB7, 0xC3, 0xC9, 0xC8, 0xBF, 0xB1, 0x9D, 0x87,
+    0x6F, 0x59, 0x47, 0x3A, 0x34, 0x35, 0x3E, 0x4D, 0x60, 0x76, 0x8D, 0xA2,
+    0xB4, 0xC0, 0xC6, 0xC4, 0xBD, 0xAF, 0x9E, 0x8B, 0x77, 0x65, 0x57, 0x4D,
+    0x49, 0x4B, 0x51, 0x5B, 0x68, 0x77, 0x84, 0x91, 0x9A, 0x9F, 0xA1, 0xA0,
+    0x9B, 0x94, 0x8D, 0x85, 0x7F, 0x7A, 0x77, 0x77, 0x78, 0x7A, 0x7D, 0x80,
+    0x81, 0x81, 0x80, 0x7D, 0x78, 0x73, 0x6E, 0x6B, 0x6A, 0x6B, 0x6F, 0x76,
+    0x7F, 0x8A, 0x96, 0xA0, 0xA8, 0xAD, 0xAE, 0xA9, 0xA0, 0x93, 0x83, 0x72,
+    0x60, 0x51, 0x46, 0x40, 0x41, 0x47, 0x54, 0x65, 0x79, 0x8F, 0xA4, 0xB6,
+    0xC3, 0xCA, 0xCA, 0xC2, 0xB4, 0xA1, 0x8A, 0x73, 0x5C, 0x49, 0x3C, 0x35,
+    0x35, 0x3D, 0x4B, 0x5E, 0x73, 0x8A, 0x9F, 0xB0, 0xBD, 0xC3, 0xC2, 0xBB,
+    0xAF, 0x9F, 0x8D, 0x7A, 0x69, 0x5B, 0x52, 0x4E, 0x4F, 0x54, 0x5D, 0x69,
+    0x76, 0x82, 0x8D, 0x95, 0x9A, 0x9C, 0x9A, 0x96, 0x91, 0x8B, 0x85, 0x80,
+    0x7D, 0x7B, 0x7C, 0x7D, 0x80, 0x83, 0x84, 0x85, 0x83, 0x80, 0x7B, 0x75,
+    0x6F, 0x6A, 0x66, 0x64, 0x66, 0x6B, 0x73, 0x7E, 0x8A, 0x97, 0xA3, 0xAC,
+    0xB1, 0xB2, 0xAE, 0xA5, 0x97, 0x86, 0x73, 0x61, 0x51, 0x45, 0x3E, 0x3D,
+    0x43, 0x50, 0x61, 0x76, 0x8D, 0xA2, 0xB5, 0xC3, 0xCB, 0xCB, 0xC4, 0xB7,
+    0xA4, 0x8D, 0x76, 0x5F, 0x4C, 0x3E, 0x36, 0x36, 0x3D, 0x4A, 0x5C, 0x71,
+    0x87, 0x9B, 0xAC, 0xB9, 0xBF, 0xC0, 0xBA, 0xAF, 0xA0, 0x8E, 0x7D, 0x6D,
+    0x60, 0x57, 0x52, 0x53, 0x58, 0x60, 0x6A, 0x76, 0x81, 0x8A, 0x91, 0x95,
+    0x96, 0x95, 0x92, 0x8D, 0x88, 0x83, 0x80, 0x7F, 0x7F, 0x80, 0x83, 0x86,
+    0x88, 0x89, 0x89, 0x86, 0x81, 0x7B, 0x73, 0x6C, 0x65, 0x60, 0x5F, 0x61,
+    0x66, 0x6F, 0x7C, 0x89, 0x98, 0xA5, 0xAF, 0xB5, 0xB7, 0xB3, 0xA9, 0x9B,
+    0x89, 0x75, 0x62, 0x51, 0x43, 0x3C, 0x3A, 0x40, 0x4C, 0x5E, 0x73, 0x8A,
+    0xA0, 0xB3, 0xC2, 0xCB, 0xCC, 0xC6, 0xB9, 0xA7, 0x91, 0x79, 0x63, 0x4F,
+    0x41, 0x38, 0x37, 0x3D, 0x49, 0x5A, 0x6E, 0x83, 0x97, 0xA8, 0xB5, 0xBC,
+    0xBC, 0xB7, 0xAD, 0xA0, 0x90, 0x7F, 0x70, 0x64, 0x5C, 0x57, 0x58, 0x5C,
+    0x63, 0x6C, 0x76, 0x7F, 0x87, 0x8D, 0x90, 0x91, 0x8F, 0x8C, 0x89, 0x85,
+    0x82, 0x80, 0x80, 0x82, 0x85, 0x88, 0x8B, 0x8E, 0x8E, 0x8D, 0x89, 0x83,
+    0x7B, 0x71, 0x69, 0x61, 0x5B, 0x5A, 0x5C, 0x62, 0x6C, 0x79, 0x88, 0x98,
+    0xA6, 0xB2, 0xB9, 0xBB, 0xB7, 0xAD, 0x9E, 0x8C, 0x78, 0x63, 0x51, 0x43,
+    0x3A, 0x38, 0x3D, 0x49, 0x5A, 0x6F, 0x87, 0x9D, 0xB1, 0xC1, 0xCA, 0xCC,
+    0xC7, 0xBB, 0xA9, 0x94, 0x7C, 0x66, 0x52, 0x44, 0x3B, 0x39, 0x3E, 0x49,
+    0x59, 0x6C, 0x81, 0x94, 0xA4, 0xB1, 0xB7, 0xB9, 0xB4, 0xAB, 0x9F, 0x90,
+    0x81, 0x74, 0x68, 0x61, 0x5D, 0x5D, 0x60, 0x66, 0x6E, 0x76, 0x7E, 0x85,
+    0x89, 0x8C, 0x8C, 0x8A, 0x87, 0x84, 0x81, 0x80, 0x80, 0x81, 0x84, 0x89,
+    0x8D, 0x91, 0x93, 0x94, 0x91, 0x8C, 0x84, 0x7B, 0x70, 0x66, 0x5D, 0x57,
+    0x54, 0x57, 0x5D, 0x68, 0x76, 0x87, 0x97, 0xA7, 0xB4, 0xBC, 0xBF, 0xBB,
+    0xB1, 0xA2, 0x8F, 0x7A, 0x65, 0x52, 0x42, 0x39, 0x36, 0x3A, 0x46, 0x57,
+    0x6C, 0x83, 0x9A, 0xAF, 0xBF, 0xC9, 0xCC, 0xC8, 0xBC, 0xAB, 0x96, 0x80,
+    0x6A, 0x56, 0x47, 0x3E, 0x3B, 0x40, 0x4A, 0x59, 0x6B, 0x7E, 0x90, 0xA0,
+    0xAC, 0xB3, 0xB5, 0xB1, 0xA9, 0x9E, 0x91, 0x83, 0x77, 0x6C, 0x65, 0x62,
+    0x62, 0x65, 0x6A, 0x71, 0x78, 0x7E, 0x83, 0x86, 0x87, 0x86, 0x84, 0x81,
+    0x7F, 0x7D, 0x7D, 0x7F, 0x82, 0x87, 0x8C, 0x92, 0x96, 0x99, 0x99, 0x96,
+    0x90, 0x87, 0x7C, 0x70, 0x64, 0x5A, 0x53, 0x50, 0x52, 0x58, 0x64, 0x73,
+    0x85, 0x97, 0xA8, 0xB5, 0xBF, 0xC2, 0xBF, 0xB5, 0xA6, 0x93, 0x7D, 0x67,
+    0x53, 0x43, 0x38, 0x35, 0x38, 0x43, 0x54, 0x69
+};
+const packed_audio_t assetDialtone = {dialtoneData, 800, 800, 8000, PACKED_U8, true};
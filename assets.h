@@ -0,0 +1,9 @@
+/* Generated by tools/mkasset from assets/assets.txt. Don't edit it, edit that. */
+#ifndef ASSETS_H
+#define ASSETS_H
+#include "audio.h"
+
+/* dialtone tone 350+440 -10.5 */
+extern const packed_audio_t assetDialtone;
+
+#endif
@@ -0,0 +1,115 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include "at.h"
+
+/* Lines modems send ahead of a result when they're reporting how a call connected. */
+static const char *reports[] = {"+MCR:", "+MRR:", "+ER:", "+DR:", "CARRIER", "PROTOCOL:", "COMPRESSION:"};
+
+size_t at_skip_reports(const char *buf, size_t len) {
+    size_t i = 0;
+    bool skipped;
+    do {
+        skipped = false;
+        while (i < len && isspace((unsigned char)buf[i])) {
+            i++;
+        }
+        for (int r = 0; r < sizeof(reports)/sizeof(reports[0]); r++) {
+            size_t reportLen = strlen(reports[r]);
+            if (len - i >= reportLen && strncmp(buf + i, reports[r], reportLen) == 0) {
+                while (i < len && buf[i] != '\r' && buf[i] != '\n') {
+                    i++;
+                }
+                skipped = true;
+                break;
+            }
+        }
+    } while (skipped);
+    return i;
+}
+
+int at_parse_result(const char *buf, size_t len) {
+    size_t i = at_skip_reports(buf, len);
+    int res = 0;
+    if (i == len || !isdigit((unsigned char)buf[i])) {
+        return -1;
+    }
+    /* Result codes are never more than 3 digits. Anything bigger is garbage. */
+    for (int digits = 0; i < len && isdigit((unsigned char)buf[i]); i++, digits++) {
+        if (digits == 3) {
+            return -1;
+        }
+        res = res*10 + (buf[i] - '0');
+    }
+    return res;
+}
+
+unsigned int at_connect_rate(int code) {
+    switch (code) {
+        case 1: return 300;
+        case 5: return 1200;
+        case 9: return 600;
+        case 10: return 2400;
+        case 11: return 4800;
+        case 12: return 9600;
+        case 13: return 7200;
+        case 14: return 12000;
+        case 15: return 14400;
+        case 16: return 19200;
+        case 17: return 38400;
+        case 18: return 57600;
+        case 19: return 115200;
+        case 59: return 16800;
+        case 61: return 21600;
+        case 62: return 24000;
+        case 63: return 26400;
+        case 64: return 28800;
+        case 84: return 33600;
+        case 91: return 31200;
+        default: return 0;
+    }
+}
+
+/* Slowest first, the way AT+MS wants them. */
+static const struct {
+    const char *name;
+    unsigned int maxRate;
+} carriers[] = {
+    {"V21", 300},
+    {"V22", 1200},
+    {"V22B", 2400},
+    {"V32", 9600},
+    {"V32B", 14400},
+    {"V34", 33600},
+    {"V90", 56000}
+};
+
+const char *at_modulation(const char *response, unsigned int *carrierRate) {
+    const char *str;
+    unsigned int rate = 0;
+    if ((str = strstr(response, "+MRR: ")) != NULL) {
+        sscanf(str + 6, "%u", &rate);
+    } else if ((str = strstr(response, "CARRIER ")) != NULL) {
+        sscanf(str + 8, "%u", &rate);
+    }
+    *carrierRate = rate;
+    if ((str = strstr(response, "+MCR: ")) != NULL) {
+        for (int i = 0; i < sizeof(carriers)/sizeof(carriers[0]); i++) {
+            size_t len = strlen(carriers[i].name);
+            if (strncmp(str + 6, carriers[i].name, len) == 0 && !isalnum((unsigned char)str[6 + len])) {
+                return carriers[i].name;
+            }
+        }
+    }
+    if (rate == 0) {
+        return NULL;
+    }
+    /* A reported carrier rate (not the DTE rate) only fits one carrier. */
+    for (int i = 0; i < sizeof(carriers)/sizeof(carriers[0]); i++) {
+        if (rate <= carriers[i].maxRate) {
+            return carriers[i].name;
+        }
+    }
+    return carriers[sizeof(carriers)/sizeof(carriers[0]) - 1].name;
+}
@@ -0,0 +1,22 @@
+#ifndef AT_H
+#define AT_H
+#include <stddef.h>
+
+/* Where the response starts after any carrier/protocol report lines (+MCR:, CARRIER...) in front of it. */
+size_t at_skip_reports(const char *buf, size_t len);
+
+/* Numeric result code at the start of a response (after any whitespace and reports). -1 if there isn't one. */
+int at_parse_result(const char *buf, size_t len);
+
+/* DTE rate for the numeric CONNECT codes most modems agree on. 0 if we don't know it. */
+unsigned int at_connect_rate(int code);
+
+/*
+ * The carrier (in AT+MS terms: V34, V90...) and its rate from the reports
+ * the modem sent with its CONNECT (+MCR/+MRR with AT+MR=2, or CARRIER).
+ * Returns NULL without them: the rate in a CONNECT code is usually the DTE
+ * rate, which says nothing about the carrier.
+ */
+const char *at_modulation(const char *response, unsigned int *carrierRate);
+
+#endif
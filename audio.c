@@ -0,0 +1,536 @@
+#include <math.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "voice.h"
+#include "audio.h"
+
+/* The rates we'll resample to, best first. 8000 Hz needs no resampling at all. */
+static const int vsmRates[] = {8000, 11025, 9600, 7200};
+/* And the encodings, least work first. */
+static const audio_encoding_t vsmEncodings[] = {AUDIO_U8, AUDIO_ULAW, AUDIO_ALAW, AUDIO_S16LE, AUDIO_S8};
+
+static const char *encodingNames[] = {"8-bit unsigned", "8-bit signed", "16-bit little endian", "16-bit big endian", "u-law", "A-law"};
+
+static int16_t ulawDecode[256];
+static int16_t alawDecode[256];
+/* Indexed by the top 14 (u-law) or 13 (A-law) bits of the sample, which is all G.711 looks at. */
+static uint8_t ulawEncode[1 << 14];
+static uint8_t alawEncode[1 << 13];
+static pthread_once_t tablesOnce = PTHREAD_ONCE_INIT;
+
+int audio_sample_size(audio_encoding_t encoding) {
+    return encoding == AUDIO_S16LE || encoding == AUDIO_S16BE ? 2 : 1;
+}
+
+const char *audio_encoding_name(audio_encoding_t encoding) {
+    return encoding < sizeof(encodingNames)/sizeof(encodingNames[0]) ? encodingNames[encoding] : "?";
+}
+
+bool audio_format_equal(audio_format_t a, audio_format_t b) {
+    return a.encoding == b.encoding && a.rate == b.rate;
+}
+
+/* G.711 the long way, for filling in the tables. */
+static int16_t ulaw_decode(uint8_t u) {
+    int t;
+    u = ~u;
+    t = ((u & 0x0F) << 3) + 0x84;
+    t <<= (u & 0x70) >> 4;
+    return (u & 0x80) ? 0x84 - t : t - 0x84;
+}
+
+static int16_t alaw_decode(uint8_t a) {
+    int t, seg;
+    a ^= 0x55;
+    t = (a & 0x0F) << 4;
+    seg = (a & 0x70) >> 4;
+    if (seg == 0) {
+        t += 8;
+    } else {
+        t = (t + 0x108) << (seg - 1);
+    }
+    return (a & 0x80) ? t : -t;
+}
+
+/* Takes the top 14 bits of a sample. */
+static uint8_t ulaw_encode(int pcm) {
+    int mask = 0xFF;
+    int seg = 0;
+    if (pcm < 0) {
+        pcm = -pcm;
+        mask = 0x7F;
+    }
+    if (pcm > 8159) {
+        pcm = 8159;
+    }
+    pcm += 0x21;
+    while (seg < 8 && pcm > (0x40 << seg) - 1) {
+        seg++;
+    }
+    if (seg >= 8) {
+        return 0x7F ^ mask;
+    }
+    return ((seg << 4) | ((pcm >> (seg + 1)) & 0x0F)) ^ mask;
+}
+
+/* Takes the top 13 bits of a sample. */
+static uint8_t alaw_encode(int pcm) {
+    int mask = 0xD5;
+    int seg = 0;
+    if (pcm < 0) {
+        mask = 0x55;
+        pcm = -pcm - 1;
+    }
+    while (seg < 8 && pcm > (0x20 << seg) - 1) {
+        seg++;
+    }
+    if (seg >= 8) {
+        return 0x7F ^ mask;
+    }
+    return ((seg << 4) | ((pcm >> (seg < 2 ? 1 : seg)) & 0x0F)) ^ mask;
+}
+
+static void build_tables(void) {
+    for (int i = 0; i < 256; i++) {
+        ulawDecode[i] = ulaw_decode(i);
+        alawDecode[i] = alaw_decode(i);
+    }
+    for (int i = 0; i < (1 << 14); i++) {
+        ulawEncode[i] = ulaw_encode(i - (1 << 13));
+    }
+    for (int i = 0; i < (1 << 13); i++) {
+        alawEncode[i] = alaw_encode(i - (1 << 12));
+    }
+}
+
+int16_t audio_ulaw_to_s16(uint8_t sample) {
+    pthread_once(&tablesOnce, build_tables);
+    return ulawDecode[sample];
+}
+
+int16_t audio_alaw_to_s16(uint8_t sample) {
+    pthread_once(&tablesOnce, build_tables);
+    return alawDecode[sample];
+}
+
+uint8_t audio_s16_to_ulaw(int16_t sample) {
+    pthread_once(&tablesOnce, build_tables);
+    return ulawEncode[(sample >> 2) + (1 << 13)];
+}
+
+uint8_t audio_s16_to_alaw(int16_t sample) {
+    pthread_once(&tablesOnce, build_tables);
+    return alawEncode[(sample >> 3) + (1 << 12)];
+}
+
+void audio_decode(const uint8_t *in, audio_encoding_t encoding, int16_t *out, int count) {
+    pthread_once(&tablesOnce, build_tables);
+    switch (encoding) {
+        case AUDIO_U8:
+            pcm_u8_to_s16(in, out, count);
+            break;
+        case AUDIO_S8:
+            for (int i = 0; i < count; i++) {
+                out[i] = (int16_t)((int8_t)in[i] * 256);
+            }
+            break;
+        case AUDIO_S16LE:
+            for (int i = 0; i < count; i++) {
+                out[i] = (int16_t)(in[2*i] | in[2*i + 1] << 8);
+            }
+            break;
+        case AUDIO_S16BE:
+            for (int i = 0; i < count; i++) {
+                out[i] = (int16_t)(in[2*i] << 8 | in[2*i + 1]);
+            }
+            break;
+        case AUDIO_ULAW:
+            for (int i = 0; i < count; i++) {
+                out[i] = ulawDecode[in[i]];
+            }
+            break;
+        case AUDIO_ALAW:
+            for (int i = 0; i < count; i++) {
+                out[i] = alawDecode[in[i]];
+            }
+            break;
+    }
+}
+
+void audio_encode(const int16_t *in, audio_encoding_t encoding, uint8_t *out, int count) {
+    pthread_once(&tablesOnce, build_tables);
+    switch (encoding) {
+        case AUDIO_U8:
+            pcm_s16_to_u8(in, out, count);
+            break;
+        case AUDIO_S8:
+            for (int i = 0; i < count; i++) {
+                out[i] = (uint8_t)(in[i] >> 8);
+            }
+            break;
+        case AUDIO_S16LE:
+            for (int i = 0; i < count; i++) {
+                out[2*i] = in[i] & 0xFF;
+                out[2*i + 1] = (in[i] >> 8) & 0xFF;
+            }
+            break;
+        case AUDIO_S16BE:
+            for (int i = 0; i < count; i++) {
+                out[2*i] = (in[i] >> 8) & 0xFF;
+                out[2*i + 1] = in[i] & 0xFF;
+            }
+            break;
+        case AUDIO_ULAW:
+            for (int i = 0; i < count; i++) {
+                out[i] = ulawEncode[(in[i] >> 2) + (1 << 13)];
+            }
+            break;
+        case AUDIO_ALAW:
+            for (int i = 0; i < count; i++) {
+                out[i] = alawEncode[(in[i] >> 3) + (1 << 12)];
+            }
+            break;
+    }
+}
+
+static int gcd(int a, int b) {
+    while (b != 0) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+static float dot(const float *taps, const float *x) {
+    audio_vec_t sum = {0};
+    for (int i = 0; i < AUDIO_RESAMPLE_TAPS; i += 8) {
+        audio_vec_t a, b;
+        memcpy(&a, taps + i, sizeof(a));
+        memcpy(&b, x + i, sizeof(b));
+        sum += a*b;
+    }
+    return sum[0] + sum[1] + sum[2] + sum[3] + sum[4] + sum[5] + sum[6] + sum[7];
+}
+
+/*
+ * A windowed sinc low pass, up by up and down by down, split into up phases
+ * of AUDIO_RESAMPLE_TAPS taps each. Every phase is stored backwards so it
+ * lines up with the samples it multiplies.
+ */
+static float *make_filter(int up, int down) {
+    int len = up*AUDIO_RESAMPLE_TAPS;
+    /* A little under the lower of the two Nyquist rates, in cycles per upsampled sample. */
+    double cutoff = 0.45/(up > down ? up : down);
+    double center = (len - 1)/2.0;
+    float *taps = malloc(len*sizeof(float));
+    if (taps == NULL) {
+        return NULL;
+    }
+    for (int j = 0; j < len; j++) {
+        double x = j - center;
+        double sinc = x == 0 ? 1 : sin(2*M_PI*cutoff*x)/(2*M_PI*cutoff*x);
+        double window = 0.42 - 0.5*cos(2*M_PI*(j + 0.5)/len) + 0.08*cos(4*M_PI*(j + 0.5)/len);
+        int phase = j % up;
+        int tap = j / up;
+        /* Times up, for the gain the zeros stuffed in between take away. */
+        taps[phase*AUDIO_RESAMPLE_TAPS + AUDIO_RESAMPLE_TAPS - 1 - tap] = 2*cutoff*up*sinc*window;
+    }
+    return taps;
+}
+
+int audio_resample(const int16_t *in, int count, int fromRate, int toRate, int16_t **out) {
+    int g = gcd(fromRate, toRate);
+    int up = toRate/g;
+    int down = fromRate/g;
+    int outCount = (int)((int64_t)count*up/down);
+    float *taps;
+    float *x;
+    if ((*out = malloc((outCount > 0 ? outCount : 1)*sizeof(int16_t))) == NULL) {
+        return -1;
+    }
+    if (up == down) {
+        memcpy(*out, in, count*sizeof(int16_t));
+        return count;
+    }
+    taps = make_filter(up, down);
+    /* Room for the filter to run off either end. */
+    x = calloc(count + 2*AUDIO_RESAMPLE_TAPS, sizeof(float));
+    if (taps == NULL || x == NULL) {
+        free(taps);
+        free(x);
+        free(*out);
+        *out = NULL;
+        return -1;
+    }
+    for (int i = 0; i < count; i++) {
+        x[AUDIO_RESAMPLE_TAPS + i] = in[i];
+    }
+    for (int n = 0; n < outCount; n++) {
+        int64_t t = (int64_t)n*down;
+        int idx = t/up;
+        int phase = t % up;
+        /* Half the filter late, which is how far behind its middle is. */
+        float y = dot(taps + phase*AUDIO_RESAMPLE_TAPS, x + idx + AUDIO_RESAMPLE_TAPS/2 + 1);
+        y = y < 0 ? y - 0.5f : y + 0.5f;
+        (*out)[n] = y > 32767 ? 32767 : y < -32768 ? -32768 : (int16_t)y;
+    }
+    free(taps);
+    free(x);
+    return outCount;
+}
+
+uint8_t *audio_convert(const uint8_t *in, int count, audio_format_t from, audio_format_t to, int *bytes) {
+    int16_t *pcm = malloc((count > 0 ? count : 1)*sizeof(int16_t));
+    int16_t *resampled = NULL;
+    uint8_t *out = NULL;
+    int outCount;
+    if (pcm == NULL) {
+        return NULL;
+    }
+    audio_decode(in, from.encoding, pcm, count);
+    if (from.rate != to.rate) {
+        outCount = audio_resample(pcm, count, from.rate, to.rate, &resampled);
+    } else {
+        resampled = pcm;
+        pcm = NULL;
+        outCount = count;
+    }
+    if (outCount >= 0 && (out = malloc((outCount > 0 ? outCount : 1)*audio_sample_size(to.encoding))) != NULL) {
+        audio_encode(resampled, to.encoding, out, outCount);
+        *bytes = outCount*audio_sample_size(to.encoding);
+    }
+    free(pcm);
+    free(resampled);
+    return out;
+}
+
+void audio_asset_init(audio_asset_t *asset, const uint8_t *data, int count, audio_format_t format) {
+    memset(asset, 0, sizeof(*asset));
+    asset->data = data;
+    asset->count = count;
+    asset->format = format;
+    pthread_mutex_init(&asset->lock, NULL);
+}
+
+const uint8_t *audio_asset_get(audio_asset_t *asset, audio_format_t format, int *bytes) {
+    const uint8_t *data = NULL;
+    if (audio_format_equal(asset->format, format)) {
+        *bytes = asset->count*audio_sample_size(format.encoding);
+        return asset->data;
+    }
+    pthread_mutex_lock(&asset->lock);
+    for (int i = 0; i < asset->numConversions; i++) {
+        if (audio_format_equal(asset->conversions[i].format, format)) {
+            *bytes = asset->conversions[i].bytes;
+            data = asset->conversions[i].data;
+            break;
+        }
+    }
+    if (data == NULL && asset->numConversions < AUDIO_MAX_CONVERSIONS) {
+        audio_conversion_t *conversion = &asset->conversions[asset->numConversions];
+        if ((conversion->data = audio_convert(asset->data, asset->count, asset->format, format, &conversion->bytes)) != NULL &&
+            conversion->bytes > 0) {
+            conversion->format = format;
+            asset->numConversions++;
+            *bytes = conversion->bytes;
+            data = conversion->data;
+        } else {
+            free(conversion->data);
+        }
+    }
+    pthread_mutex_unlock(&asset->lock);
+    return data;
+}
+
+void audio_asset_free(audio_asset_t *asset) {
+    for (int i = 0; i < asset->numConversions; i++) {
+        free(asset->conversions[i].data);
+    }
+    asset->numConversions = 0;
+    pthread_mutex_destroy(&asset->lock);
+}
+
+static const int imaIndex[16] = {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+static const int16_t imaStep[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+void audio_ima_decode(const uint8_t *in, int16_t *out, int count) {
+    int predicted = 0;
+    int index = 0;
+    for (int i = 0; i < count; i++) {
+        int code = i & 1 ? in[i/2] >> 4 : in[i/2] & 0x0F;
+        int step = imaStep[index];
+        int diff = step >> 3;
+        if (code & 4) {
+            diff += step;
+        }
+        if (code & 2) {
+            diff += step >> 1;
+        }
+        if (code & 1) {
+            diff += step >> 2;
+        }
+        predicted += code & 8 ? -diff : diff;
+        predicted = predicted > 32767 ? 32767 : predicted < -32768 ? -32768 : predicted;
+        index += imaIndex[code];
+        index = index < 0 ? 0 : index > 88 ? 88 : index;
+        out[i] = predicted;
+    }
+}
+
+int audio_unpack(const packed_audio_t *packed, uint8_t **out, audio_format_t *format) {
+    int size = packed->encoding == PACKED_U8 ? 1 : 2;
+    int count = packed->count;
+    uint8_t *buf;
+    if (packed->loop) {
+        /* Whole loops only, or there'd be a click where it goes round. */
+        count = ((packed->rate + packed->count - 1)/packed->count)*packed->count;
+    }
+    if ((buf = malloc((size_t)count*size)) == NULL) {
+        return -1;
+    }
+    if (packed->encoding == PACKED_U8) {
+        memcpy(buf, packed->data, packed->count);
+        format->encoding = AUDIO_U8;
+    } else {
+        int16_t *pcm = malloc(packed->count*sizeof(int16_t));
+        if (pcm == NULL) {
+            free(buf);
+            return -1;
+        }
+        audio_ima_decode(packed->data, pcm, packed->count);
+        audio_encode(pcm, AUDIO_S16LE, buf, packed->count);
+        free(pcm);
+        format->encoding = AUDIO_S16LE;
+    }
+    format->rate = packed->rate;
+    for (int i = packed->count; i < count; i += packed->count) {
+        memcpy(buf + (size_t)i*size, buf, (size_t)packed->count*size);
+    }
+    *out = buf;
+    return count;
+}
+
+/* What a compression method's name (and sample size, if the modem gave one) comes to. False for ones we can't do, like ADPCM. */
+static bool vsm_encoding(const char *name, int bits, audio_encoding_t *encoding) {
+    char upper[64];
+    int i;
+    for (i = 0; name[i] && i < sizeof(upper) - 1; i++) {
+        upper[i] = toupper((unsigned char)name[i]);
+    }
+    upper[i] = 0;
+    if (strstr(upper, "ADPCM") != NULL || strstr(upper, "GSM") != NULL || strstr(upper, "CELP") != NULL) {
+        return false;
+    }
+    if (strstr(upper, "ULAW") != NULL || strstr(upper, "U-LAW") != NULL || strstr(upper, "MU-LAW") != NULL) {
+        *encoding = AUDIO_ULAW;
+    } else if (strstr(upper, "ALAW") != NULL || strstr(upper, "A-LAW") != NULL) {
+        *encoding = AUDIO_ALAW;
+    } else if (bits == 16 || strstr(upper, "16") != NULL) {
+        /* 16-bit linear is always signed, and little endian. */
+        *encoding = AUDIO_S16LE;
+    } else if (strstr(upper, "UNSIGNED") != NULL) {
+        *encoding = AUDIO_U8;
+    } else if (strstr(upper, "SIGNED") != NULL) {
+        *encoding = AUDIO_S8;
+    } else if (strstr(upper, "LINEAR") != NULL || strstr(upper, "PCM") != NULL) {
+        /* Plain 8-bit linear is unsigned on every voice modem we've seen. */
+        *encoding = AUDIO_U8;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/* Does "(7200,8000,11025)" or "(7200-11025)" at p take rate? */
+static bool vsm_has_rate(const char *p, int rate) {
+    while (*p && *p != ')') {
+        char *end;
+        long low = strtol(p, &end, 10);
+        long high = low;
+        if (end == p) {
+            p++;
+            continue;
+        }
+        p = end;
+        if (*p == '-') {
+            high = strtol(p + 1, &end, 10);
+            p = end;
+        }
+        if (rate >= low && rate <= high) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool audio_pick_vsm(const char *list, audio_format_t *format, int *cml) {
+    int best = -1;
+    while (*list) {
+        const char *line = list;
+        const char *eol = strpbrk(line, "\r\n");
+        size_t len = eol != NULL ? (size_t)(eol - line) : strlen(line);
+        char buf[256];
+        char name[64] = {0};
+        char *p = buf;
+        char *rates;
+        int method, bits = 0;
+        audio_encoding_t encoding;
+        list = eol != NULL ? eol + 1 : line + len;
+        len = len < sizeof(buf) - 1 ? len : sizeof(buf) - 1;
+        memcpy(buf, line, len);
+        buf[len] = 0;
+        while (*p == ' ') {
+            p++;
+        }
+        if (!isdigit((unsigned char)*p)) {
+            continue;
+        }
+        method = strtol(p, &p, 10);
+        if (*p++ != ',') {
+            continue;
+        }
+        /* The name's usually quoted. */
+        if (*p == '"') {
+            char *close = strchr(++p, '"');
+            if (close == NULL) {
+                continue;
+            }
+            snprintf(name, sizeof(name), "%.*s", (int)(close - p), p);
+            p = close + 1;
+        } else {
+            size_t n = strcspn(p, ",");
+            snprintf(name, sizeof(name), "%.*s", (int)n, p);
+            p += n;
+        }
+        /* V.253 puts the bits per sample next. */
+        if (*p == ',' && isdigit((unsigned char)p[1])) {
+            bits = strtol(p + 1, NULL, 10);
+        }
+        if ((rates = strchr(p, '(')) == NULL || !vsm_encoding(name, bits, &encoding)) {
+            continue;
+        }
+        for (int r = 0; r < sizeof(vsmRates)/sizeof(vsmRates[0]); r++) {
+            for (int e = 0; e < sizeof(vsmEncodings)/sizeof(vsmEncodings[0]); e++) {
+                int rank = r*16 + e;
+                if (vsmEncodings[e] == encoding && (best < 0 || rank < best) && vsm_has_rate(rates + 1, vsmRates[r])) {
+                    best = rank;
+                    format->encoding = encoding;
+                    format->rate = vsmRates[r];
+                    *cml = method;
+                }
+            }
+        }
+    }
+    return best >= 0;
+}
@@ -0,0 +1,117 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+/*
+ * Sample format and rate conversion, so one library of audio (the dialtone
+ * and the prompts) plays on every modem whatever voice format it's using.
+ * Assets are kept in whatever format they came in. The first line that
+ * needs one in its modem's format gets it converted, and every line after
+ * that with the same format plays from that copy. Where the format's the
+ * same, there's no copy at all.
+ */
+
+typedef enum {
+    AUDIO_U8 = 0,
+    AUDIO_S8,
+    AUDIO_S16LE,
+    AUDIO_S16BE,
+    AUDIO_ULAW,
+    AUDIO_ALAW
+} audio_encoding_t;
+
+typedef struct {
+    audio_encoding_t encoding;
+    int rate;
+} audio_format_t;
+
+/* What everything used to be, and what modems that won't list their formats get. */
+#define AUDIO_DEFAULT_FORMAT ((audio_format_t){AUDIO_U8, 8000})
+/* Every encoding at every rate audio_pick_vsm() picks, so an asset never runs out of room. */
+#define AUDIO_MAX_CONVERSIONS 24
+/* Taps per phase in the resampler. */
+#define AUDIO_RESAMPLE_TAPS 32
+
+/* A polyphase filter for each lane of 8, like the line test's Goertzel bank. */
+typedef float audio_vec_t __attribute__((vector_size(8*sizeof(float))));
+
+typedef struct {
+    audio_format_t format;
+    uint8_t *data;
+    int bytes;
+} audio_conversion_t;
+
+typedef struct {
+    const uint8_t *data;
+    /* In samples. */
+    int count;
+    audio_format_t format;
+    pthread_mutex_t lock;
+    audio_conversion_t conversions[AUDIO_MAX_CONVERSIONS];
+    int numConversions;
+} audio_asset_t;
+
+#define AUDIO_ASSET(data, count, encoding, rate) {(data), (count), {(encoding), (rate)}, PTHREAD_MUTEX_INITIALIZER, {{{0}}}, 0}
+
+int audio_sample_size(audio_encoding_t encoding);
+const char *audio_encoding_name(audio_encoding_t encoding);
+bool audio_format_equal(audio_format_t a, audio_format_t b);
+
+/* G.711, through lookup tables. */
+int16_t audio_ulaw_to_s16(uint8_t sample);
+int16_t audio_alaw_to_s16(uint8_t sample);
+uint8_t audio_s16_to_ulaw(int16_t sample);
+uint8_t audio_s16_to_alaw(int16_t sample);
+
+void audio_decode(const uint8_t *in, audio_encoding_t encoding, int16_t *out, int count);
+void audio_encode(const int16_t *in, audio_encoding_t encoding, uint8_t *out, int count);
+/*
+ * Resample count samples from one rate to another with a polyphase filter.
+ * Returns how many samples went into *out (malloced), or -1.
+ */
+int audio_resample(const int16_t *in, int count, int fromRate, int toRate, int16_t **out);
+/* count samples of in, in the to format. *bytes is how long the result (malloced) is. NULL if it couldn't. */
+uint8_t *audio_convert(const uint8_t *in, int count, audio_format_t from, audio_format_t to, int *bytes);
+
+void audio_asset_init(audio_asset_t *asset, const uint8_t *data, int count, audio_format_t format);
+/* The asset in format, converted the first time it's asked for. NULL if it couldn't be. */
+const uint8_t *audio_asset_get(audio_asset_t *asset, audio_format_t format, int *bytes);
+void audio_asset_free(audio_asset_t *asset);
+
+/* Audio built into the binary by tools/mkasset (see assets.h). */
+typedef enum {
+    PACKED_U8 = 0,
+    PACKED_IMA_ADPCM
+} packed_encoding_t;
+
+typedef struct {
+    const uint8_t *data;
+    uint32_t size;
+    /* Samples once it's unpacked. */
+    uint32_t count;
+    uint32_t rate;
+    packed_encoding_t encoding;
+    /* It loops without a click, so it can be played round and round. */
+    bool loop;
+} packed_audio_t;
+
+/*
+ * Unpack built in audio into a buffer of its own (malloced), in *format.
+ * Loops get repeated out to at least a second, so they still go to the modem
+ * in big writes. Returns how many samples, or -1.
+ */
+int audio_unpack(const packed_audio_t *packed, uint8_t **out, audio_format_t *format);
+/* IMA ADPCM, two samples to a byte, low nibble first. */
+void audio_ima_decode(const uint8_t *in, int16_t *out, int count);
+
+/*
+ * Pick the voice format to use from the modem's AT+VSM=? list: one line per
+ * compression method, like 128,"8-BIT LINEAR",(7200,8000,11025). What needs
+ * the least work wins: 8-bit linear at 8000 Hz is what everything's in.
+ * False if there's nothing in it we can do.
+ */
+bool audio_pick_vsm(const char *list, audio_format_t *format, int *cml);
+
+#endif
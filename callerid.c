@@ -0,0 +1,209 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "log.h"
+#include "callerid.h"
+
+static const char *actionNames[] = {"allow", "deny", "route"};
+
+const char *callerid_action_name(caller_action_t action) {
+    return action < sizeof(actionNames)/sizeof(actionNames[0]) ? actionNames[action] : "?";
+}
+
+/* Copy value into field, minus the whitespace around it. */
+static void set_field(char *field, size_t size, const char *value) {
+    size_t len;
+    while (isspace((unsigned char)*value)) {
+        value++;
+    }
+    len = strlen(value);
+    while (len > 0 && isspace((unsigned char)value[len - 1])) {
+        len--;
+    }
+    if (len >= size) {
+        len = size - 1;
+    }
+    memcpy(field, value, len);
+    field[len] = 0;
+}
+
+bool callerid_parse(callerid_t *id, const char *line) {
+    char key[16];
+    size_t len = 0;
+    while (isspace((unsigned char)*line)) {
+        line++;
+    }
+    while ((isalpha((unsigned char)*line) || *line == '_') && len < sizeof(key) - 1) {
+        key[len++] = toupper((unsigned char)*line++);
+    }
+    key[len] = 0;
+    while (*line == ' ') {
+        line++;
+    }
+    /* Most modems say NMBR = ..., some NMBR: or NMBR=. */
+    if (*line != '=' && *line != ':') {
+        return false;
+    }
+    line++;
+    if (strcmp(key, "NMBR") == 0 || strcmp(key, "DDN_NMBR") == 0) {
+        set_field(id->number, sizeof(id->number), line);
+        id->haveNumber = true;
+    } else if (strcmp(key, "NAME") == 0) {
+        set_field(id->name, sizeof(id->name), line);
+    } else if (strcmp(key, "DATE") == 0) {
+        set_field(id->date, sizeof(id->date), line);
+    } else if (strcmp(key, "TIME") == 0) {
+        set_field(id->time, sizeof(id->time), line);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/* FNV-1a */
+static uint32_t hash_number(const char *number) {
+    uint32_t hash = 2166136261u;
+    for (; *number; number++) {
+        hash = (hash ^ (uint8_t)*number)*16777619u;
+    }
+    return hash;
+}
+
+static const caller_entry_t *find(const caller_table_t *table, const char *number) {
+    if (table->slots == NULL) {
+        return NULL;
+    }
+    for (uint32_t i = hash_number(number) & table->mask; table->slots[i] != 0; i = (i + 1) & table->mask) {
+        const caller_entry_t *entry = &table->entries[table->slots[i] - 1];
+        if (strcmp(entry->number, number) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/* Build the hash table once everything's loaded, so entries doesn't move under it. At most half full. */
+static bool build_slots(caller_table_t *table) {
+    uint32_t size = 16;
+    while (size < (uint32_t)table->numEntries*2) {
+        size *= 2;
+    }
+    if ((table->slots = calloc(size, sizeof(uint32_t))) == NULL) {
+        return false;
+    }
+    table->mask = size - 1;
+    for (int i = 0; i < table->numEntries; i++) {
+        caller_entry_t *entry = &table->entries[i];
+        uint32_t slot;
+        if (strcmp(entry->number, "default") == 0) {
+            table->fallback = table->fallback != NULL ? table->fallback : entry;
+            continue;
+        } else if (strcmp(entry->number, "private") == 0) {
+            table->withheld = table->withheld != NULL ? table->withheld : entry;
+            continue;
+        } else if (strcmp(entry->number, "unknown") == 0) {
+            table->unknown = table->unknown != NULL ? table->unknown : entry;
+            continue;
+        }
+        /* Same as the dial plan: the first line for a number wins. */
+        if (find(table, entry->number) != NULL) {
+            continue;
+        }
+        for (slot = hash_number(entry->number) & table->mask; table->slots[slot] != 0; slot = (slot + 1) & table->mask);
+        table->slots[slot] = i + 1;
+    }
+    return true;
+}
+
+static bool valid_number(const char *number) {
+    if (strcmp(number, "default") == 0 || strcmp(number, "private") == 0 || strcmp(number, "unknown") == 0) {
+        return true;
+    }
+    for (; *number; number++) {
+        if (!isdigit((unsigned char)*number)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int callerid_load(const char *path, caller_table_t *table) {
+    FILE *file;
+    char line[256];
+    int lineNum = 0;
+    memset(table, 0, sizeof(*table));
+    if ((file = fopen(path, "r")) == NULL) {
+        return -1;
+    }
+    while (fgets(line, sizeof(line), file) != NULL) {
+        caller_entry_t entry = {0};
+        caller_entry_t *entries;
+        char number[32], action[16];
+        int n;
+        bool ok;
+        lineNum++;
+        if ((n = sscanf(line, "%31s %15s", number, action)) <= 0 || number[0] == '#') {
+            continue;
+        }
+        ok = n == 2 && valid_number(number);
+        strcpy(entry.number, number);
+        if (ok && strcmp(action, "allow") == 0) {
+            entry.action = CALLER_ALLOW;
+        } else if (ok && strcmp(action, "deny") == 0) {
+            entry.action = CALLER_DENY;
+        } else if (ok) {
+            /* Anything else is where to send them, same as in a dial plan. */
+            entry.action = CALLER_ROUTE;
+            ok = dialplan_parse(line, &entry.route) == 0;
+        }
+        if (!ok) {
+            log_error(NULL, "%s line %d doesn't make sense: %s", path, lineNum, line);
+            fclose(file);
+            callerid_free(table);
+            return -2;
+        }
+        if ((entries = realloc(table->entries, (table->numEntries + 1)*sizeof(caller_entry_t))) == NULL) {
+            fclose(file);
+            callerid_free(table);
+            return -2;
+        }
+        table->entries = entries;
+        table->entries[table->numEntries++] = entry;
+    }
+    fclose(file);
+    if (!build_slots(table)) {
+        callerid_free(table);
+        return -2;
+    }
+    return 0;
+}
+
+void callerid_free(caller_table_t *table) {
+    free(table->entries);
+    free(table->slots);
+    memset(table, 0, sizeof(*table));
+}
+
+const caller_entry_t *callerid_lookup(const caller_table_t *table, const callerid_t *id, bool *known) {
+    const caller_entry_t *entry = NULL;
+    *known = false;
+    if (id == NULL || !id->haveNumber || id->number[0] == 0 || strcmp(id->number, "O") == 0) {
+        entry = table->unknown;
+    } else if (strcmp(id->number, "P") == 0) {
+        entry = table->withheld;
+    } else {
+        entry = find(table, id->number);
+        *known = entry != NULL;
+    }
+    return entry != NULL ? entry : table->fallback;
+}
+
+bool callerid_uses(const caller_table_t *table, backend_t backend) {
+    for (int i = 0; i < table->numEntries; i++) {
+        if (table->entries[i].action == CALLER_ROUTE && table->entries[i].route.backend == backend) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,78 @@
+#ifndef CALLERID_H
+#define CALLERID_H
+#include <stdint.h>
+#include <stdbool.h>
+#include "dialplan.h"
+
+/*
+ * Caller ID, for lines on a real phone line that answer on ring (-r). With
+ * AT+VCID=1 the modem passes on what the exchange sends between the first
+ * and second ring as a line per field:
+ *   DATE = 0321
+ *   TIME = 1405
+ *   NMBR = 5551234      (P if they withheld it, O if it's not available)
+ *   NAME = JOHN DOE
+ *
+ * What to do with each caller comes from a file with one "number action" per
+ * line:
+ *   5551234  allow
+ *   5550000  deny
+ *   5557000  slip                     (or anything a dial plan line takes)
+ *   5558888  tcp 127.0.0.1:2323 telnet
+ *   private  deny                     (they withheld their number)
+ *   unknown  allow                    (no caller ID, or the exchange didn't have it)
+ *   default  allow
+ * Numbers are looked up exactly, in a hash table. Callers that aren't in it
+ * get the default line, or allow if there isn't one. allow goes through the
+ * dial plan's default like any other call. Callers that are allowed by their
+ * number get answered as soon as it comes in instead of after all the rings.
+ */
+
+typedef struct {
+    char number[32];
+    char name[32];
+    /* MMDD and HHMM, as the exchange sent them. */
+    char date[8];
+    char time[8];
+    /* NMBR came in, even if it was P or O. */
+    bool haveNumber;
+} callerid_t;
+
+typedef enum {
+    CALLER_ALLOW = 0,
+    CALLER_DENY,
+    /* Straight to route, skipping the dial plan. */
+    CALLER_ROUTE
+} caller_action_t;
+
+typedef struct {
+    char number[32];
+    caller_action_t action;
+    dialplan_entry_t route;
+} caller_entry_t;
+
+typedef struct {
+    caller_entry_t *entries;
+    int numEntries;
+    /* Open addressing. Each slot is an index into entries plus one, or 0 if it's empty. */
+    uint32_t *slots;
+    uint32_t mask;
+    const caller_entry_t *withheld;
+    const caller_entry_t *unknown;
+    const caller_entry_t *fallback;
+} caller_table_t;
+
+/* Take in one line from the modem. True if it was a caller ID field. */
+bool callerid_parse(callerid_t *id, const char *line);
+/* 0 if it loaded, -1 if the file couldn't be opened, -2 if a line didn't make sense. */
+int callerid_load(const char *path, caller_table_t *table);
+void callerid_free(caller_table_t *table);
+/*
+ * The entry for this caller, or NULL to just answer. id can be NULL if there
+ * was no caller ID. known says whether it was their own number that matched.
+ */
+const caller_entry_t *callerid_lookup(const caller_table_t *table, const callerid_t *id, bool *known);
+bool callerid_uses(const caller_table_t *table, backend_t backend);
+const char *callerid_action_name(caller_action_t action);
+
+#endif
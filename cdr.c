@@ -0,0 +1,263 @@
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include "ring.h"
+#include "log.h"
+#include "cdr.h"
+
+#define CDR_SLOTS 256
+/* How often the writer wakes up to flush queued records. */
+#define CDR_FLUSH_NSEC 250000000
+
+static ring_t cdrRing;
+static pthread_t cdrThread;
+static int cdrFd = -1;
+static atomic_bool cdrRunning = false;
+static pthread_mutex_t cdrWriteLock = PTHREAD_MUTEX_INITIALIZER;
+
+static uint8_t *put_u16(uint8_t *p, uint16_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    return p + 2;
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t v) {
+    for (int i = 0; i < 4; i++) {
+        p[i] = v >> (i*8);
+    }
+    return p + 4;
+}
+
+static uint8_t *put_u64(uint8_t *p, uint64_t v) {
+    for (int i = 0; i < 8; i++) {
+        p[i] = v >> (i*8);
+    }
+    return p + 8;
+}
+
+static uint8_t *put_str(uint8_t *p, const char *str, size_t max) {
+    size_t len = strnlen(str, max);
+    *p++ = len;
+    memcpy(p, str, len);
+    return p + len;
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t get_u64(const uint8_t *p) {
+    return get_u32(p) | ((uint64_t)get_u32(p + 4) << 32);
+}
+
+static const uint8_t *get_str(const uint8_t *p, const uint8_t *end, char *str, size_t size) {
+    size_t len;
+    if (p >= end) {
+        return NULL;
+    }
+    len = *p++;
+    if (len > (size_t)(end - p) || len >= size) {
+        return NULL;
+    }
+    memcpy(str, p, len);
+    str[len] = 0;
+    return p + len;
+}
+
+size_t cdr_encode(const cdr_t *cdr, uint8_t *buf) {
+    uint8_t *p = buf + 2;
+    p = put_u64(p, cdr->startUsec);
+    p = put_u64(p, cdr->endUsec);
+    p = put_u32(p, cdr->exitStatus);
+    p = put_u32(p, cdr->connectCode);
+    p = put_u32(p, cdr->connectRate);
+    p = put_u64(p, cdr->rxBytes);
+    p = put_u64(p, cdr->txBytes);
+    p = put_u32(p, cdr->dialtoneMs);
+    p = put_u32(p, cdr->dialingMs);
+    p = put_u32(p, cdr->answerMs);
+    p = put_u32(p, cdr->setupMs);
+    p = put_u32(p, cdr->sessionMs);
+    p = put_str(p, cdr->modem, sizeof(cdr->modem) - 1);
+    p = put_str(p, cdr->digits, sizeof(cdr->digits) - 1);
+    p = put_str(p, cdr->protocol, sizeof(cdr->protocol) - 1);
+    p = put_str(p, cdr->backend, sizeof(cdr->backend) - 1);
+    p = put_u64(p, cdr->ifRxBytes);
+    p = put_u64(p, cdr->ifTxBytes);
+    p = put_u32(p, cdr->peakRxRate);
+    p = put_u32(p, cdr->peakTxRate);
+    p = put_u32(p, cdr->idleMs);
+    p = put_u32(p, cdr->compressionPct);
+    p = put_str(p, cdr->callerNumber, sizeof(cdr->callerNumber) - 1);
+    p = put_str(p, cdr->callerName, sizeof(cdr->callerName) - 1);
+    p = put_u32(p, cdr->rings);
+    put_u16(buf, p - buf - 2);
+    return p - buf;
+}
+
+int cdr_decode(cdr_t *cdr, const uint8_t *buf, size_t len) {
+    const uint8_t *p = buf + 2;
+    const uint8_t *end;
+    size_t recLen;
+    if (len < 2) {
+        return 0;
+    }
+    recLen = buf[0] | (buf[1] << 8);
+    if (len < recLen + 2) {
+        return 0;
+    }
+    end = p + recLen;
+    /* The fixed size part. */
+    if (recLen < 64) {
+        return -1;
+    }
+    memset(cdr, 0, sizeof(*cdr));
+    cdr->startUsec = get_u64(p);
+    cdr->endUsec = get_u64(p + 8);
+    cdr->exitStatus = get_u32(p + 16);
+    cdr->connectCode = get_u32(p + 20);
+    cdr->connectRate = get_u32(p + 24);
+    cdr->rxBytes = get_u64(p + 28);
+    cdr->txBytes = get_u64(p + 36);
+    cdr->dialtoneMs = get_u32(p + 44);
+    cdr->dialingMs = get_u32(p + 48);
+    cdr->answerMs = get_u32(p + 52);
+    cdr->setupMs = get_u32(p + 56);
+    cdr->sessionMs = get_u32(p + 60);
+    p += 64;
+    if ((p = get_str(p, end, cdr->modem, sizeof(cdr->modem))) == NULL ||
+        (p = get_str(p, end, cdr->digits, sizeof(cdr->digits))) == NULL ||
+        (p = get_str(p, end, cdr->protocol, sizeof(cdr->protocol))) == NULL ||
+        (p = get_str(p, end, cdr->backend, sizeof(cdr->backend))) == NULL) {
+        return -1;
+    }
+    /* Interface stats. Older records stop before them. */
+    if (end - p >= 32) {
+        cdr->ifRxBytes = get_u64(p);
+        cdr->ifTxBytes = get_u64(p + 8);
+        cdr->peakRxRate = get_u32(p + 16);
+        cdr->peakTxRate = get_u32(p + 20);
+        cdr->idleMs = get_u32(p + 24);
+        cdr->compressionPct = get_u32(p + 28);
+        p += 32;
+    }
+    /* Caller ID. Older records stop before it. */
+    if (p < end) {
+        if ((p = get_str(p, end, cdr->callerNumber, sizeof(cdr->callerNumber))) == NULL ||
+            (p = get_str(p, end, cdr->callerName, sizeof(cdr->callerName))) == NULL || end - p < 4) {
+            return -1;
+        }
+        cdr->rings = get_u32(p);
+    }
+    return recLen + 2;
+}
+
+/* Append to the file. The writer and lines the queue overflowed on take turns. */
+static bool cdr_write(const uint8_t *p, size_t used) {
+    bool ok = true;
+    pthread_mutex_lock(&cdrWriteLock);
+    while (used > 0) {
+        ssize_t res = write(cdrFd, p, used);
+        if (res < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            log_error("cdr", "Writing call records failed: %s", strerror(errno));
+            ok = false;
+            break;
+        }
+        p += res;
+        used -= res;
+    }
+    pthread_mutex_unlock(&cdrWriteLock);
+    return ok;
+}
+
+/* Encode everything queued up and append it with a single write. */
+static void cdr_flush(void) {
+    static uint8_t out[CDR_SLOTS*CDR_MAX_RECORD];
+    size_t used = 0;
+    cdr_t *cdr;
+    while ((cdr = ring_peek(&cdrRing)) != NULL) {
+        used += cdr_encode(cdr, out + used);
+        ring_release(&cdrRing);
+        if (sizeof(out) - used < CDR_MAX_RECORD) {
+            break;
+        }
+    }
+    if (used > 0) {
+        cdr_write(out, used);
+    }
+}
+
+static void *cdr_thread(void *arg) {
+    struct timespec wait = {0, CDR_FLUSH_NSEC};
+    (void)arg;
+    while (atomic_load(&cdrRunning)) {
+        nanosleep(&wait, NULL);
+        cdr_flush();
+    }
+    /* Get out whatever is left. */
+    while (ring_peek(&cdrRing) != NULL) {
+        cdr_flush();
+    }
+    return NULL;
+}
+
+int cdr_init(const char *path) {
+    if (atomic_load(&cdrRunning)) {
+        return -1;
+    }
+    cdrFd = open(path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (cdrFd < 0) {
+        return -2;
+    }
+    /* New file, write the header. */
+    if (lseek(cdrFd, 0, SEEK_END) == 0 && write(cdrFd, CDR_MAGIC, CDR_MAGIC_LEN) != CDR_MAGIC_LEN) {
+        close(cdrFd);
+        return -2;
+    }
+    if (ring_init(&cdrRing, CDR_SLOTS, sizeof(cdr_t)) != 0) {
+        close(cdrFd);
+        return -3;
+    }
+    atomic_store(&cdrRunning, true);
+    if (pthread_create(&cdrThread, NULL, cdr_thread, NULL) != 0) {
+        atomic_store(&cdrRunning, false);
+        ring_free(&cdrRing);
+        close(cdrFd);
+        return -4;
+    }
+    return 0;
+}
+
+void cdr_shutdown(void) {
+    if (atomic_exchange(&cdrRunning, false)) {
+        pthread_join(cdrThread, NULL);
+        ring_free(&cdrRing);
+        close(cdrFd);
+    }
+}
+
+bool cdr_submit(const cdr_t *cdr) {
+    cdr_t *slot;
+    if (!atomic_load_explicit(&cdrRunning, memory_order_relaxed)) {
+        return false;
+    }
+    if ((slot = ring_claim(&cdrRing)) == NULL) {
+        /* It only happens once a call, so it can wait for the disk. Billing can't lose calls. */
+        uint8_t buf[CDR_MAX_RECORD];
+        return cdr_write(buf, cdr_encode(cdr, buf));
+    }
+    memcpy(slot, cdr, sizeof(*cdr));
+    ring_publish(&cdrRing, slot);
+    return true;
+}
+
+uint64_t cdr_overflowed(void) {
+    return ring_dropped(&cdrRing);
+}
@@ -0,0 +1,64 @@
+#ifndef CDR_H
+#define CDR_H
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* One call detail record. Times are wall clock microseconds, phases are in ms. */
+typedef struct {
+    char modem[16];
+    char digits[32];
+    char protocol[16];
+    char backend[16];
+    int64_t startUsec;
+    int64_t endUsec;
+    int32_t exitStatus;
+    int32_t connectCode;
+    uint32_t connectRate;
+    uint64_t rxBytes;
+    uint64_t txBytes;
+    /* Dialtone until the first digit, dialing, ATA until CONNECT, CONNECT until the backend runs, the session itself. */
+    uint32_t dialtoneMs;
+    uint32_t dialingMs;
+    uint32_t answerMs;
+    uint32_t setupMs;
+    uint32_t sessionMs;
+    /* Through the call's network interface, for backends that make one. Rates are bytes/s. */
+    uint64_t ifRxBytes;
+    uint64_t ifTxBytes;
+    uint32_t peakRxRate;
+    uint32_t peakTxRate;
+    uint32_t idleMs;
+    /* Bytes before compression per 100 after. 0 if it didn't compress. */
+    uint32_t compressionPct;
+    /* Lines that answer on ring: who called, from caller ID, and how many times it rang. Dialing is how long it rang. */
+    char callerNumber[32];
+    char callerName[32];
+    uint32_t rings;
+} cdr_t;
+
+/*
+ * CDR files start with CDR_MAGIC, followed by records. Each record is a little
+ * endian uint16 length, then that many bytes of fields. Readers skip anything
+ * past the fields they know about, so fields can be added at the end later.
+ */
+#define CDR_MAGIC "DICDR\x01\r\n"
+#define CDR_MAGIC_LEN 8
+#define CDR_MAX_RECORD 512
+
+/* Records are queued and written in batches by a background thread. */
+int cdr_init(const char *path);
+void cdr_shutdown(void);
+/*
+ * Queues the record without waiting. If the queue's full it's written
+ * straight out instead. Returns false if it couldn't be written.
+ */
+bool cdr_submit(const cdr_t *cdr);
+/* Records the queue was too full for. */
+uint64_t cdr_overflowed(void);
+
+size_t cdr_encode(const cdr_t *cdr, uint8_t *buf);
+/* Decode the record at buf. Returns the bytes consumed, 0 if it needs more data or -1 if the record is bad. */
+int cdr_decode(cdr_t *cdr, const uint8_t *buf, size_t len);
+
+#endif
@@ -0,0 +1,106 @@
+#include <poll.h>
+#include <time.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <sys/time.h>
+#include "clock.h"
+
+static uint64_t real_now(void *ctx) {
+    struct timespec ts;
+    (void)ctx;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000 + ts.tv_nsec/1000;
+}
+
+static int64_t real_wall(void *ctx) {
+    struct timeval tv;
+    (void)ctx;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec*1000000 + tv.tv_usec;
+}
+
+static void real_sleep(void *ctx, uint64_t usec) {
+    struct timespec ts = {usec/1000000, (usec%1000000)*1000};
+    (void)ctx;
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {};
+}
+
+static int real_poll(void *ctx, struct pollfd *fds, int numFds, uint64_t usec) {
+    uint64_t end = real_now(ctx) + usec;
+    int res;
+    (void)ctx;
+    while (true) {
+        uint64_t now = real_now(ctx);
+        int timeout = now < end ? (int)((end - now + 999)/1000) : 0;
+        res = poll(fds, numFds, timeout);
+        if (res >= 0 || errno != EINTR) {
+            break;
+        }
+    }
+    return res;
+}
+
+static const clock_impl_t realClock = {real_now, real_wall, real_sleep, real_poll, NULL};
+static const clock_impl_t *clockImpl = &realClock;
+
+void clock_set(const clock_impl_t *impl) {
+    clockImpl = impl != NULL ? impl : &realClock;
+}
+
+uint64_t clock_usec(void) {
+    return clockImpl->now(clockImpl->ctx);
+}
+
+int64_t clock_wall_usec(void) {
+    return clockImpl->wall(clockImpl->ctx);
+}
+
+void clock_sleep(uint64_t usec) {
+    clockImpl->sleep(clockImpl->ctx, usec);
+}
+
+int clock_poll(struct pollfd *fds, int numFds, uint64_t usec) {
+    return clockImpl->poll(clockImpl->ctx, fds, numFds, usec);
+}
+
+int clock_wait_readable(int fd, uint64_t usec) {
+    struct pollfd pfd = {fd, POLLIN, 0};
+    int res = clock_poll(&pfd, 1, usec);
+    return res < 0 ? -1 : res > 0;
+}
+
+static uint64_t virtual_now(void *ctx) {
+    return ((vclock_t*)ctx)->now;
+}
+
+static int64_t virtual_wall(void *ctx) {
+    vclock_t *vclock = ctx;
+    return vclock->wallOffset + (int64_t)vclock->now;
+}
+
+static void virtual_sleep(void *ctx, uint64_t usec) {
+    ((vclock_t*)ctx)->now += usec;
+}
+
+static int virtual_poll(void *ctx, struct pollfd *fds, int numFds, uint64_t usec) {
+    int res = real_poll(NULL, fds, numFds, 0);
+    if (res == 0) {
+        ((vclock_t*)ctx)->now += usec;
+    }
+    return res;
+}
+
+void vclock_init(vclock_t *vclock, uint64_t start) {
+    vclock->now = start;
+    vclock->wallOffset = real_wall(NULL) - (int64_t)start;
+    vclock->impl.now = virtual_now;
+    vclock->impl.wall = virtual_wall;
+    vclock->impl.sleep = virtual_sleep;
+    vclock->impl.poll = virtual_poll;
+    vclock->impl.ctx = vclock;
+}
+
+void vclock_advance(vclock_t *vclock, uint64_t usec) {
+    vclock->now += usec;
+}
@@ -0,0 +1,45 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+#include <stdint.h>
+#include <poll.h>
+
+/*
+ * Everything that waits or looks at the time goes through here, so tests can
+ * swap in virtual time and run an hour of dialtone in a few milliseconds.
+ */
+typedef struct {
+    /* Monotonic time in us. */
+    uint64_t (*now)(void *ctx);
+    /* Wall clock time in us since the epoch. */
+    int64_t (*wall)(void *ctx);
+    void (*sleep)(void *ctx, uint64_t usec);
+    /* poll() with a timeout in us. Number of ready fds, 0 on timeout, -1 on error. */
+    int (*poll)(void *ctx, struct pollfd *fds, int numFds, uint64_t usec);
+    void *ctx;
+} clock_impl_t;
+
+/* NULL goes back to the real clock. */
+void clock_set(const clock_impl_t *impl);
+
+uint64_t clock_usec(void);
+int64_t clock_wall_usec(void);
+void clock_sleep(uint64_t usec);
+int clock_poll(struct pollfd *fds, int numFds, uint64_t usec);
+/* Wait up to usec for fd to have something to read. 1 if it does, 0 on timeout, -1 on error. */
+int clock_wait_readable(int fd, uint64_t usec);
+
+/*
+ * Virtual time. Sleeping just moves time forward, and waiting on an fd returns
+ * right away if it has data or moves time forward by the whole timeout if it
+ * doesn't. Polling works the same way. Only meant for single threaded tests.
+ */
+typedef struct {
+    uint64_t now;
+    int64_t wallOffset;
+    clock_impl_t impl;
+} vclock_t;
+
+void vclock_init(vclock_t *vclock, uint64_t start);
+void vclock_advance(vclock_t *vclock, uint64_t usec);
+
+#endif
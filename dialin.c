@@ -1,4 +1,6 @@
-#include <time.h>
+/* DialIn: Answer calls from a line simulator and hand them off to pppd (or do PPP ourselves).
+ * Build: cc -O2 -pthread -o dialin *.c -lm */
+
 #include <ctype.h>
 #include <stdio.h>
 #include <errno.h>
@@ -6,364 +8,130 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
-#include <assert.h>
 #include <signal.h>
+#include <pthread.h>
 #include <stdbool.h>
-#include <termios.h>
-#include <sys/time.h>
+#include <stdint.h>
 #include <sys/wait.h>
-#include <inttypes.h>
-#include <sys/select.h>
-#include "dialtone.h"
-
-typedef enum {
-    IDLE = 0,
-    SENDING_DIALTONE,
-    CLIENT_DIALING,
-    CONNECTING,
-    CONNECTED
-} modem_state_t;
-
-typedef struct {
-    int fd;
-    struct timeval lastDialtoneSend;
-    int dialTonePos;
-    modem_state_t state;
-    pid_t pppd;
-    int rate;
-    char path[512];
-} modem_t;
-
-#define MAX_MODEMS 1
-static char pppdPath[256] = "/usr/sbin/pppd";
-static modem_t *modems[MAX_MODEMS];
-static int numModems = 0;
-
-bool send_string(int fd, char* str) {
-    return write(fd, str, strlen(str)) == strlen(str);
-}
-
-void reset_modem(modem_t *modem) {
-    send_string(modem->fd, "ATZ0\r\n");
-    usleep(1000000);
-	send_string(modem->fd, "ATE\r\n");
-	send_string(modem->fd, "ATV\r\n");
-    tcflush(modem->fd, TCIFLUSH);
-    modem->state = IDLE;
-}
-
-int init_modem(modem_t *modem, char *path, unsigned int rate) {
-    struct termios tty;
-    speed_t speed;
-
-    if (numModems < MAX_MODEMS) {
-        switch (rate) {
-            case 50:
-                speed = B50;
-                break;
-            case 75:
-                speed = B75;
-                break;
-            case 110:
-                speed = B110;
-                break;
-            case 134:
-                speed = B134;
-                break;
-            case 150:
-                speed = B150;
-                break;
-            case 200:
-                speed = B200;
-                break;
-            case 300:
-                speed = B300;
-                break;
-            case 600:
-                speed = B600;
-                break;
-            case 1200:
-                speed = B1200;
-                break;
-            case 1800:
-                speed = B1800;
-                break;
-            case 2400:
-                speed = B2400;
-                break;
-            case 4800:
-                speed = B4800;
-                break;
-            case 9600:
-                speed = B9600;
-                break;
-            case 19200:
-                speed = B19200;
-                break;
-            case 38400:
-                speed = B38400;
-                break;
-            case 57600:
-                speed = B57600;
-                break;
-            case 115200:
-                speed = B115200;
-                break;
-            case 230400:
-                speed = B230400;
-                break;
-            default:
-                return -1;
-        }
-
-        /* Open the TTY device */
-        if (modem == NULL) {
-            return -2;
-        }
-        modem->fd = open(path, O_RDWR | O_NOCTTY);
-        if (modem->fd < 0) {
-            return -3;
-        }
-
-        /* Get the TTY device's attributes. */
-        if (tcgetattr(modem->fd, &tty) != 0) {
-            return -4;
-        }
-
-        /* Assuming defaults for reasonably modern modems. */
-        cfsetispeed(&tty, speed);
-        cfsetospeed(&tty, speed);
-        tty.c_cflag &= ~(PARENB | CSTOPB | CSIZE);
-        tty.c_cflag |= CS8 | CREAD | CLOCAL;
-        tty.c_lflag = 0;
-        tty.c_oflag = 0;
-        tty.c_cc[VMIN] = 0;
-        tty.c_cc[VTIME] = 10;
-
-        /* Apply configuration. */
-        if (tcsetattr(modem->fd, TCSANOW, &tty) != 0) {
-            return -4;
-        }
-        reset_modem(modem);
-        strncpy(modem->path, path, sizeof(modem->path));
-        modem->path[sizeof(modem->path) - 1] = 0;
-        modem->rate = rate;
-        modems[numModems] = modem;
-        numModems++;
-        return 0;
-    }
-    return -5;
-}
-
-/* Get a response code from the modem. */
-int get_response(modem_t *modem, unsigned int attempts) {
-    char buf[1024] = {0};
-    int res;
-    int bytes;
-    /* 0 attempts to read doesn't make sense. */
-    if (attempts == 0) {
-        attempts = 1;
-    }
-
-    for (int i = 0; (i < attempts) && ((bytes = read(modem->fd, buf, 1024)) <= 0); i++) {};
-
-    if (bytes <= 0) {
-        return -1;
-    }
-
-    if (bytes < 1024) {
-        buf[bytes] = 0;
-    } else {
-        buf[1023] = 0;
-    }
-
-    if (sscanf(buf, "%u", &res) != 1) {
-        return -1;
-    }
-    return res;
-}
+#include "log.h"
+#include "clock.h"
+#include "cdr.h"
+#include "modem.h"
+#include "metrics.h"
+#include "linkstats.h"
+#include "watchdog.h"
+#include "linewatch.h"
+#include "callerid.h"
+#include "training.h"
+#include "prompt.h"
+#include "record.h"
 
-void send_escape(modem_t *modem) {
-    send_string(modem->fd, "+++");
-    usleep(1100000);
-    assert(get_response(modem, 1) == 0);
-}
+static bool nodial = false;
+static sigset_t stopSignals;
 
-void send_dialtone(modem_t *modem) {
-    /* Probably an unnecessary check. */
-    if (modem->state = SENDING_DIALTONE) {
-        struct timeval now;
-        gettimeofday(&now, NULL);
-        int64_t usecSinceLastSend = (now.tv_sec - modem->lastDialtoneSend.tv_sec)*1000000 + (now.tv_usec - modem->lastDialtoneSend.tv_usec);
-        int bytesToSend = (usecSinceLastSend*8001)/1000000;
-        while (bytesToSend > 0) {
-            int size = bytesToSend;
-            unsigned char* buf = dialtone + modem->dialTonePos;
-            assert(modem->dialTonePos < sizeof(dialtone));
-            if (modem->dialTonePos + bytesToSend >= sizeof(dialtone)) {
-                size = sizeof(dialtone) - modem->dialTonePos;
-                modem->dialTonePos = 0;
-            } else {
-                modem->dialTonePos += size;
-            }
-            assert(write(modem->fd, buf, size) == size);
-            bytesToSend -= size;
-        }
-        modem->lastDialtoneSend = now;
+/* A dial plan or caller list entry that plays a prompt that isn't there. */
+static bool missing_prompt(const dialplan_entry_t *entry) {
+    prompt_audio_t *audio;
+    if (entry->backend != BACKEND_PROMPT) {
+        return false;
     }
-}
-
-bool start_dialtone(modem_t *modem) {
-    if (modem->state == IDLE) {
-        int res;
-        send_string(modem->fd, "ATH\r\n");
-        if ((res = get_response(modem, 5)) != 0) {
-            printf("%d\n", res);
-            return false;
-        }
-        send_string(modem->fd, "AT+FCLASS=8\r\n");
-        if ((res = get_response(modem, 1)) != 0) {
-            printf("%d\n", res);
-            return false;
-        }
-        send_string(modem->fd, "AT+VLS=1\r\n");
-        if ((res = get_response(modem, 1)) != 0) {
-            printf("%d\n", res);
-            return false;
-        }
-        send_string(modem->fd, "AT+VSM=1,8000\r\n");
-        if ((res = get_response(modem, 1)) != 0) {
-            printf("%d\n", res);
-            return false;
-        }
-        send_string(modem->fd, "AT+VTX\r\n");
-        if (get_response(modem, 1) != 1) {
-            return false;
-        }
-        modem->state = SENDING_DIALTONE;
-        modem->dialTonePos = 0;
-        gettimeofday(&modem->lastDialtoneSend, NULL);
-        modem->lastDialtoneSend.tv_sec -= 1;
-        send_dialtone(modem);
+    if ((audio = prompt_get(entry->target)) == NULL) {
+        log_error(NULL, "There's no %s prompt (%s.wav or %s.au) for %s.", entry->target, entry->target, entry->target, entry->number);
         return true;
     }
+    prompt_put(audio);
     return false;
 }
 
-void stop_dialtone(modem_t *modem) {
-    if (modem->state == SENDING_DIALTONE) {
-        char buf[] = {0x10, 0x03};
-        modem->state = IDLE;
-        write(modem->fd, buf, sizeof(buf));
-        send_escape(modem);
-        send_string(modem->fd, "AT+FCLASS=0\r\n");
-        assert(get_response(modem, 1) == 0);
-    }
-}
+/* Lines whose threads haven't ended yet. */
+static int linesRunning = 0;
 
-bool answer_call(modem_t *modem) {
-    if (modem->state == IDLE) {
-        struct timeval timeout = {60, 0};
-        int res;
-        /* Don't know if this is needed and takes forever to execute on my G4 modem. */
-        send_string(modem->fd, "ATH1\r\n");
-        assert(get_response(modem, 10) == 0);
-        tcflush(modem->fd, TCIFLUSH);
-        send_string(modem->fd, "ATM1\r\n");
-        assert(get_response(modem, 1) == 0);
-        send_string(modem->fd, "ATA\r\n");
-        res = get_response(modem, 1);
-        /* If we get some kind of error answering the call, return. */
-        if (res != 0 && res != -1) {
-            return false;
-        }
-        /* Handle modems with respond with OK after ATA */
-        /* Wait 60s for the modem to respond. */
-        res = get_response(modem, 60);
-        /* Don't know rn what reponse codes modems will return. */
-        if (res == 3 || res == 4 || res == -1) {
-            puts("Modem failed to connect!");
-            modem->state = IDLE;
-            return false;
+/* Hang up every call in progress. On the main thread, never in a signal handler. */
+static void end_calls(void) {
+    int lines = __atomic_load_n(&numModems, __ATOMIC_ACQUIRE);
+    for (int i = 0; i < lines; i++) {
+        pid_t pppd = __atomic_load_n(&modems[i]->pppd, __ATOMIC_ACQUIRE);
+        if (modems[i]->state != CONNECTED) {
+            continue;
         }
-        printf("Modem returned code %d.\n", res);
-        /* Start PPPD. */
-        usleep(100000);
-        pid_t id = fork();
-        if (id == 0) {
-            char buf[16];
-            sprintf(buf, "%d", modem->rate);
-            assert(execl(pppdPath, modem->path, buf, "nodetach", "file", "options.modem", NULL) != -1);
-        } else {
-            modem->pppd = id;
-            modem->state = CONNECTED;
+        if (modems[i]->backend == BACKEND_PPP) {
+            ppp_close(&modems[i]->ppp, PPP_EXIT_USER_REQUEST);
+        } else if (modems[i]->backend == BACKEND_TCP) {
+            relay_close(&modems[i]->relay);
+        } else if (modems[i]->backend == BACKEND_L2TP) {
+            l2tp_close(&modems[i]->l2tp);
+        } else if (modems[i]->backend == BACKEND_SLIP || modems[i]->backend == BACKEND_CSLIP) {
+            slip_close(&modems[i]->slip);
+        } else if (pppd > 0) {
+            /* pppd, or the fax receiver. */
+            kill(pppd, SIGINT);
         }
-        return true;
     }
-    return false;
 }
 
-void modem_loop(modem_t *modem) {
-	while (true) {
-		if (!start_dialtone(modem)) {
-			break;
-		}
-		puts("Listening for dial...");
-		while (true) {
-            fd_set modemSet;
-            struct timeval timeout = {0, 50000};
-            send_dialtone(modem);
-            FD_ZERO(&modemSet);
-            FD_SET(modem->fd, &modemSet);
-            /* Wait 50ms to see if the modem has any data for us. */
-            if (select(modem->fd + 1, &modemSet, NULL, NULL, &timeout) == 1 && FD_ISSET(modem->fd, &modemSet)) {
-                /* See if we recieved a DTMF num. */
-                char buf[2];
-                int bytes = read(modem->fd, buf, 2);
-                /* The client is dialing a number. */
-                if (bytes > 1 && buf[0] == 0x10 && isdigit(buf[1])) {
-                    break;
-                }
-            }
-        }
-        stop_dialtone(modem);
-        puts("Client dialed! Picking up...");
-        /* Wait 5 secs for the client to finish dialing. */
-        usleep(5000000);
-        if (answer_call(modem)) {
-            int res;
-			puts("Client connected!");
-			waitpid(modem->pppd, &res, 0);
-            printf("PPPd exited. Code: %d\n", res);
-            reset_modem(modem);
-		} else {
-			puts("Client failed to connect. :(");
-		}
-	}
-}
+/* Every modem gets its own thread. */
+void *modem_thread(void *arg) {
+    modem_t *modem = arg;
+    int res;
+    if ((res = init_modem(modem, modem->path, modem->rate)) != 0) {
+        log_error(NULL, "Initializing modem %s failed! Return val: %i; Error: %s", modem->path, res, strerror(errno));
+        modem->fd = -1;
+        __atomic_sub_fetch(&linesRunning, 1, __ATOMIC_RELEASE);
+        return (void*)(intptr_t)res;
+    }
 
-void sig_handler(int sig) {
-    /* Stop PPPd */
-    for (int i = 0; i < numModems; i++) {
-        if (modems[i]->state == CONNECTED) {
-            kill(modems[i]->pppd, SIGINT);
+    /* Start the modem loop */
+    if (nodial) {
+        begin_call(modem);
+        /* Nothing was dialed, so only a default entry in the dial plan can take it. */
+        if (!route_call(modem)) {
+            log_error(modem->tag, "No dial, but the dial plan has no default.");
+        } else if (modem->backend == BACKEND_LINETEST) {
+            /* A one-off test of the line. The score only goes to the log. Lines answering on ring get theirs from test calls the caller list routes to linetest. */
+            test_line(modem);
+        } else if (modem->backend == BACKEND_PROMPT) {
+            answer_prompt(modem, modem->route->target);
+        } else if (answer_call(modem)) {
+            log_info(modem->tag, "Client connected! :D");
+            wait_session(modem);
+        } else {
+            log_warn(modem->tag, "Client failed to connect. :(");
         }
+        end_call(modem);
+    } else if (answerRings > 0) {
+        ring_loop(modem);
+    } else {
+        modem_loop(modem);
     }
-    waitpid(-1, NULL, 0);
-    if (sig == SIGINT) {
-        for (int i = 0; i < numModems; i++) {
-            close(modems[i]->fd);
-        }
-        exit(0);
+    if (!nodial && !__atomic_load_n(&stopping, __ATOMIC_ACQUIRE)) {
+        log_error(modem->tag, "Something went wrong. The modem loop ended.");
     }
+    __atomic_sub_fetch(&linesRunning, 1, __ATOMIC_RELEASE);
+    return NULL;
 }
 
 int main(int argc, char **argv) {
-    char* tty = NULL;
+    char *ttys[MAX_MODEMS];
+    int numTtys = 0;
     int rate = 115200;
-    bool nodial = false;
+    char *logPath = NULL;
+    log_level_t logLevel = LOG_LEVEL_INFO;
+    int logFd = STDOUT_FILENO;
     int opt;
-    while ((opt = getopt(argc, argv, "b:p:m:nh")) != -1) {
+    int res = 0;
+    char *cdrPath = NULL;
+    char *metricsPath = NULL;
+    char *trainingFile = NULL;
+    char *promptDir = NULL;
+    char *recordDir = NULL;
+    /* Lines to record, or all of them if there's no -L. */
+    bool recordLines[MAX_MODEMS] = {false};
+    bool recordAll = true;
+    unsigned int idleSec = 0;
+    unsigned int stallSec = WATCHDOG_DEFAULT_STALL_SEC;
+    bool pppLoaded = false;
+    bool callersLoaded = false;
+    while ((opt = getopt(argc, argv, "b:p:m:l:c:i:d:M:I:S:r:C:T:P:R:L:nvh")) != -1) {
         switch (opt) {
             case 'b':
                 if (sscanf(optarg, "%u", &rate) != 1) {
@@ -378,17 +146,113 @@ int main(int argc, char **argv) {
                 nodial = true;
                 break;
             case 'm':
-                tty = optarg;
+                if (numTtys >= MAX_MODEMS) {
+                    fprintf(stderr, "Too many modems. The most I can do is %d.\n", MAX_MODEMS);
+                    return 1;
+                }
+                ttys[numTtys++] = optarg;
+                break;
+            case 'l':
+                logPath = optarg;
+                break;
+            case 'v':
+                logLevel = LOG_LEVEL_DEBUG;
+                break;
+            case 'c':
+                cdrPath = optarg;
+                break;
+            case 'i':
+                if ((res = ppp_load_config(optarg, &pppConfig)) != 0) {
+                    if (res == -1) {
+                        fprintf(stderr, "Couldn't open PPP config %s: %s\n", optarg, strerror(errno));
+                    }
+                    return 1;
+                }
+                defaultBackend = BACKEND_PPP;
+                pppLoaded = true;
+                break;
+            case 'M':
+                metricsPath = optarg;
+                break;
+            case 'I':
+                if (sscanf(optarg, "%u", &idleSec) != 1) {
+                    fputs("Invalid idle timeout specified.\n", stderr);
+                }
+                break;
+            case 'S':
+                if (sscanf(optarg, "%u", &stallSec) != 1) {
+                    fputs("Invalid stall timeout specified.\n", stderr);
+                }
+                break;
+            case 'r':
+                if (sscanf(optarg, "%u", &answerRings) != 1 || answerRings == 0) {
+                    fputs("Invalid ring count specified.\n", stderr);
+                    return 1;
+                }
+                break;
+            case 'C':
+                callerid_free(&callerTable);
+                if ((res = callerid_load(optarg, &callerTable)) != 0) {
+                    if (res == -1) {
+                        fprintf(stderr, "Couldn't open caller list %s: %s\n", optarg, strerror(errno));
+                    }
+                    return 1;
+                }
+                callersLoaded = true;
+                break;
+            case 'T':
+                trainingFile = optarg;
+                break;
+            case 'P':
+                promptDir = optarg;
+                break;
+            case 'R':
+                recordDir = optarg;
+                break;
+            case 'L':
+                recordAll = false;
+                for (char *tok = strtok(optarg, ","); tok != NULL; tok = strtok(NULL, ",")) {
+                    unsigned int line;
+                    if (sscanf(tok, "%u", &line) != 1 || line >= MAX_MODEMS) {
+                        fprintf(stderr, "Invalid line number %s specified.\n", tok);
+                        return 1;
+                    }
+                    recordLines[line] = true;
+                }
+                break;
+            case 'd':
+                dialplan_free(&dialPlan);
+                if ((res = dialplan_load(optarg, &dialPlan)) != 0) {
+                    if (res == -1) {
+                        fprintf(stderr, "Couldn't open dial plan %s: %s\n", optarg, strerror(errno));
+                    }
+                    return 1;
+                }
                 break;
             case 'h':
                 printf(
                     "DialIn v0.1a\n\n"
                     "Usage:\n"
-                    "%s -m <modem TTY> [optional args...]\n\n"
+                    "%s -m <modem TTY> [-m <modem TTY>...] [optional args...]\n\n"
+                    "A modem on a terminal server can be given as rfc2217://<host>:<port> instead of a TTY.\n\n"
                     "Optional args:\n"
                     "-b <baud rate> : The TTY speed to use (in bits/s). [Default: 115200 bits/s]\n"
                     "-p <path to pppd> : The path to the pppd executable to use. [Default: \"/usr/sbin/pppd\"]\n"
                     "-n : No dial. Don't wait for the client to dial: immediately tell the modem to answer.\n"
+                    "-l <log file> : Append log messages to this file instead of stdout.\n"
+                    "-v : Verbose. Log debug messages too.\n"
+                    "-c <CDR file> : Append a call detail record for every call to this file.\n"
+                    "-i <PPP config> : Do PPP in-process with the settings in this file instead of starting pppd. Uses the kernel's PPP support, or a TUN device where there is none.\n"
+                    "-d <dial plan> : Pick what answers each call by the number dialed: pppd, in-process PPP, SLIP/CSLIP (addresses from -i), an L2TP LNS, a TCP service (like a BBS) to relay the call to, or a fax receiver. Or linetest, to measure the line's quality against a loopback, or a recorded prompt (from -P) to play before hanging up. Fax machines and modems that call without dialing get picked up as soon as their calling tone's heard.\n"
+                    "-M <metrics file> : Keep this file up to date with what every line is doing, in Prometheus' text format.\n"
+                    "-I <seconds> : Hang up calls that haven't sent or received anything in this long. 0 for never. [Default: 0]\n"
+                    "-S <seconds> : Hang up PPP and L2TP calls we haven't heard anything from in this long (not even LCP echo replies). 0 for never. [Default: 90]\n"
+                    "-r <rings> : For modems on a real phone line: wait for the line to ring this many times and answer, instead of giving dialtone. Calls go to the dial plan's default.\n"
+                    "-C <caller list> : With -r, allow, deny or route calls by the caller ID number. Callers listed by number get answered on the first ring that brings their number in.\n"
+                    "-T <training file> : Remember what each caller's modem trains up to in this file, and have the modem go straight to it on their next calls instead of trying every faster carrier first.\n"
+                    "-P <prompt directory> : Recorded prompts (<name>.wav or <name>.au: mono 8 or 16-bit linear, u-law or A-law, converted to whatever each modem plays) to play to callers. notinservice gets played to callers who dial a number the dial plan doesn't take. Replace one by renaming a new file over it, and the next call gets the new one.\n"
+                    "-R <recording directory> : Record the voice audio on every call (dialtone, dialing, prompts and line tests) to a pair of WAVs in this directory: what the modem heard and what we sent it. For working out what went wrong on a call. Each file stops at 16 MB.\n"
+                    "-L <line>[,<line>...] : With -R, only record these lines, numbered from 0 in the order they're given with -m.\n"
                     "-h : Display this help.\n\n"
                     "Copyright (C) 2025 Logan C. GPLv3.\n"
                     "Have fun!\n"
@@ -401,7 +265,33 @@ int main(int argc, char **argv) {
                 } else if (optopt == 'p') {
                     fputs("Usage: -p <path to pppd>", stderr);
                 } else if (optopt == 'm') {
-                    fputs("Usage: -m <modem TTY> : The full path to the modem's TTY. Example: /dev/ttyS0", stderr);
+                    fputs("Usage: -m <modem TTY> : The full path to the modem's TTY, or rfc2217://<host>:<port> for one on a terminal server. Example: /dev/ttyS0", stderr);
+                } else if (optopt == 'l') {
+                    fputs("Usage: -l <log file>", stderr);
+                } else if (optopt == 'c') {
+                    fputs("Usage: -c <CDR file>", stderr);
+                } else if (optopt == 'i') {
+                    fputs("Usage: -i <PPP config>", stderr);
+                } else if (optopt == 'd') {
+                    fputs("Usage: -d <dial plan>", stderr);
+                } else if (optopt == 'M') {
+                    fputs("Usage: -M <metrics file>", stderr);
+                } else if (optopt == 'I') {
+                    fputs("Usage: -I <idle timeout in seconds>", stderr);
+                } else if (optopt == 'S') {
+                    fputs("Usage: -S <stall timeout in seconds>", stderr);
+                } else if (optopt == 'r') {
+                    fputs("Usage: -r <rings to answer on>", stderr);
+                } else if (optopt == 'C') {
+                    fputs("Usage: -C <caller list>", stderr);
+                } else if (optopt == 'T') {
+                    fputs("Usage: -T <training file>", stderr);
+                } else if (optopt == 'P') {
+                    fputs("Usage: -P <prompt directory>", stderr);
+                } else if (optopt == 'R') {
+                    fputs("Usage: -R <recording directory>", stderr);
+                } else if (optopt == 'L') {
+                    fputs("Usage: -L <line>[,<line>...]", stderr);
                 } else if (isprint(optopt)) {
                     fprintf(stderr, "Option -%c unknown", optopt);
                 } else {
@@ -411,36 +301,212 @@ int main(int argc, char **argv) {
         }
     }
 
-    if (tty == NULL) {
+    if (numTtys == 0) {
         puts("You must specify a modem TTY to use! Run with -h for help.");
         return -1;
     }
+    if ((dialplan_uses(&dialPlan, BACKEND_PPP) || dialplan_uses(&dialPlan, BACKEND_SLIP) || dialplan_uses(&dialPlan, BACKEND_CSLIP)) && !pppLoaded) {
+        puts("The dial plan sends calls to in-process PPP or SLIP, so it needs a PPP config (-i) for the addresses.");
+        return -1;
+    }
+    if ((callerid_uses(&callerTable, BACKEND_PPP) || callerid_uses(&callerTable, BACKEND_SLIP) || callerid_uses(&callerTable, BACKEND_CSLIP)) && !pppLoaded) {
+        puts("The caller list sends calls to in-process PPP or SLIP, so it needs a PPP config (-i) for the addresses.");
+        return -1;
+    }
+    if ((dialplan_uses(&dialPlan, BACKEND_PROMPT) || callerid_uses(&callerTable, BACKEND_PROMPT)) && promptDir == NULL) {
+        puts("The dial plan or caller list plays prompts, so it needs a prompt directory (-P).");
+        return -1;
+    }
+    if (!recordAll && recordDir == NULL) {
+        puts("-L picks the lines to record, so it needs a recording directory (-R).");
+        return -1;
+    }
+    if (callersLoaded && answerRings == 0) {
+        puts("A caller list (-C) only works on lines that answer on ring (-r).");
+        return -1;
+    }
+    if (answerRings > 0 && nodial) {
+        puts("-n and -r don't go together. Pick one.");
+        return -1;
+    }
+    if (answerRings > 0 && dialPlan.numEntries > 0 && dialplan_match(&dialPlan, "") == NULL) {
+        puts("Calls that come in on ring have no number dialed, so the dial plan needs a default line.");
+        return -1;
+    }
 
-    /* Initialize signal handlers. */
-    /* signal(SIGINT, sig_handler);
-    signal(SIGHUP, sig_handler); */
+    /*
+     * The signals we act on are only ever taken by the main thread, with
+     * sigtimedwait() once the lines are going. Blocked here, before there are
+     * any other threads, every thread after this starts with them blocked.
+     */
+    sigemptyset(&stopSignals);
+    sigaddset(&stopSignals, SIGINT);
+    sigaddset(&stopSignals, SIGTERM);
+    sigaddset(&stopSignals, SIGHUP);
+    pthread_sigmask(SIG_BLOCK, &stopSignals, NULL);
 
-    /* Init the modem */
-    modem_t modem = {0};
-    int res;
-    if ((res = init_modem(&modem, tty, rate)) != 0) {
-        printf("Initializing modem %s failed! Return val: %i; Error: %s\n", tty, res, strerror(errno));
-        return res;
+    /* Start the logger. */
+    if (logPath != NULL && (logFd = open(logPath, O_WRONLY | O_CREAT | O_APPEND, 0644)) < 0) {
+        fprintf(stderr, "Couldn't open log file %s: %s\n", logPath, strerror(errno));
+        return -1;
+    }
+    if (log_init(logFd, logLevel) != 0) {
+        fputs("Couldn't start the logger.\n", stderr);
+        return -1;
     }
 
-    /* Start the modem loop */
-    if (nodial) {
-        if (answer_call(&modem)) {
-            printf("Client connected! :D PPPD PID: %d\n", modem.pppd);
-            waitpid(modem.pppd, NULL, 0);
+    /* Start the call record writer. */
+    if (cdrPath != NULL) {
+        if (cdr_init(cdrPath) != 0) {
+            log_error(NULL, "Couldn't open CDR file %s: %s", cdrPath, strerror(errno));
+            log_shutdown();
+            return -1;
+        }
+        cdrEnabled = true;
+    }
+
+    /* Start the metrics writer. */
+    if (metricsPath != NULL && metrics_init(metricsPath) != 0) {
+        log_error(NULL, "Couldn't write metrics file %s: %s", metricsPath, strerror(errno));
+        cdr_shutdown();
+        log_shutdown();
+        return -1;
+    }
+
+    /* Load what we know about how callers train. */
+    if (trainingFile != NULL && (res = training_init(trainingFile)) != 0) {
+        if (res == -1) {
+            log_error(NULL, "Couldn't load training file %s: %s", trainingFile, strerror(errno));
+        } else if (res == -3) {
+            log_error(NULL, "Couldn't start the training file writer.");
+        }
+        metrics_shutdown();
+        cdr_shutdown();
+        log_shutdown();
+        return -1;
+    }
+
+    /* Load the prompts, and make sure everything that plays one has it. */
+    if (promptDir != NULL) {
+        bool missing = false;
+        if ((res = prompt_init(promptDir)) == -1) {
+            log_error(NULL, "Couldn't open prompt directory %s: %s", promptDir, strerror(errno));
+        }
+        for (int i = 0; i < dialPlan.numEntries; i++) {
+            missing |= missing_prompt(&dialPlan.entries[i]);
+        }
+        for (int i = 0; i < callerTable.numEntries; i++) {
+            missing |= callerTable.entries[i].action == CALLER_ROUTE && missing_prompt(&callerTable.entries[i].route);
+        }
+        if (res != 0 || missing) {
+            prompt_shutdown();
+            training_shutdown();
+            metrics_shutdown();
+            cdr_shutdown();
+            log_shutdown();
+            return -1;
+        }
+    }
+
+    /* Start the recording writer. */
+    if (recordDir != NULL && (res = record_init(recordDir)) != 0) {
+        if (res == -1) {
+            log_error(NULL, "Can't write recordings to %s: %s", recordDir, strerror(errno));
         } else {
-            puts("Client failed to connect. :(");
+            log_error(NULL, "Couldn't start the recording writer.");
+        }
+        prompt_shutdown();
+        training_shutdown();
+        metrics_shutdown();
+        cdr_shutdown();
+        log_shutdown();
+        return -1;
+    }
+
+    /* Start sampling the calls' interfaces, for the records and metrics. They can do without. */
+    if ((cdrPath != NULL || metricsPath != NULL || idleSec > 0) && linkstats_init() != 0) {
+        log_warn(NULL, "Couldn't start sampling interface stats: %s", strerror(errno));
+    }
+    if (watchdog_init(idleSec, stallSec) != 0) {
+        log_warn(NULL, "Couldn't start the watchdog. Dead calls will hold their lines until the backend notices.");
+    }
+
+    /* Start up the modems */
+    modem_t *lines = calloc(numTtys, sizeof(modem_t));
+    if (lines == NULL) {
+        log_error(NULL, "Out of memory!");
+        record_shutdown();
+        watchdog_shutdown();
+        linkstats_shutdown();
+        metrics_shutdown();
+        cdr_shutdown();
+        log_shutdown();
+        return -1;
+    }
+    for (int i = 0; i < numTtys; i++) {
+        strncpy(lines[i].path, ttys[i], sizeof(lines[i].path));
+        lines[i].path[sizeof(lines[i].path) - 1] = 0;
+        lines[i].rate = rate;
+        lines[i].recordVoice = recordDir != NULL && (recordAll || recordLines[i]);
+        lines[i].lineWatch.eventFd = -1;
+        __atomic_add_fetch(&linesRunning, 1, __ATOMIC_RELEASE);
+        if (pthread_create(&lines[i].thread, NULL, modem_thread, &lines[i]) != 0) {
+            log_error(NULL, "Couldn't start a thread for %s!", ttys[i]);
+            __atomic_sub_fetch(&linesRunning, 1, __ATOMIC_RELEASE);
+            lines[i].fd = -1;
+            lines[i].thread = 0;
+        }
+    }
+
+    /* Until the lines all end on their own, or we're told to quit. SIGHUP only hangs up the calls. */
+    while (__atomic_load_n(&linesRunning, __ATOMIC_ACQUIRE) > 0) {
+        struct timespec second = {1, 0};
+        int sig = sigtimedwait(&stopSignals, NULL, &second);
+        if (sig == SIGHUP) {
+            log_info(NULL, "Got SIGHUP. Hanging up every call.");
+            end_calls();
+        } else if (sig > 0) {
+            log_info(NULL, "Got %s. Hanging up and finishing off the call records.", sig == SIGINT ? "SIGINT" : "SIGTERM");
+            __atomic_store_n(&stopping, true, __ATOMIC_RELEASE);
+            for (int i = 0; i < numTtys; i++) {
+                linewatch_wake(&lines[i].lineWatch);
+            }
+            break;
+        }
+    }
+    /* Calls still being answered have to be up before there's anything to hang up. */
+    while (__atomic_load_n(&stopping, __ATOMIC_ACQUIRE) && __atomic_load_n(&linesRunning, __ATOMIC_ACQUIRE) > 0) {
+        end_calls();
+        clock_sleep(250000);
+    }
+
+    /* Wait for them all to finish. */
+    for (int i = 0; i < numTtys; i++) {
+        void *ret = NULL;
+        if (lines[i].thread != 0) {
+            pthread_join(lines[i].thread, &ret);
+        }
+        if (ret != NULL && res == 0) {
+            res = (int)(intptr_t)ret;
+        }
+        if (lines[i].fd >= 0) {
+            linewatch_stop(&lines[i].lineWatch);
+            close(lines[i].fd);
         }
-    } else {
-        modem_loop(&modem);
-        puts("Something went wrong. The modem loop ended.");
     }
 
     /* Clean up. */
-    close(modem.fd);
+    watchdog_shutdown();
+    linkstats_shutdown();
+    metrics_shutdown();
+    free(lines);
+    ppp_free_config(&pppConfig);
+    dialplan_free(&dialPlan);
+    callerid_free(&callerTable);
+    training_shutdown();
+    prompt_shutdown();
+    record_shutdown();
+    cdr_shutdown();
+    log_shutdown();
+    return res;
 }
\ No newline at end of file
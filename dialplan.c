@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "log.h"
+#include "dialplan.h"
+
+static const char *backendNames[] = {"pppd", "ppp", "tcp", "slip", "cslip", "l2tp", "linetest", "fax", "prompt"};
+
+const char *backend_name(backend_t backend) {
+    return backend < sizeof(backendNames)/sizeof(backendNames[0]) ? backendNames[backend] : "?";
+}
+
+static bool valid_number(const char *number) {
+    if (strcmp(number, "default") == 0) {
+        return true;
+    }
+    for (; *number; number++) {
+        if (!((*number >= '0' && *number <= '9') || *number == '*' || *number == '#' || *number == 'X')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int dialplan_parse(char *line, dialplan_entry_t *entry) {
+    char number[32], backend[16], target[128], flag[16];
+    int n;
+    memset(entry, 0, sizeof(*entry));
+    /* # in the middle of a number is a DTMF digit, not a comment. */
+    for (int i = 0; line[i]; i++) {
+        if (line[i] == '#' && (i == 0 || line[i - 1] == ' ' || line[i - 1] == '\t')) {
+            line[i] = 0;
+            break;
+        }
+    }
+    if ((n = sscanf(line, "%31s %15s %127s %15s", number, backend, target, flag)) <= 0) {
+        return 1;
+    }
+    strcpy(entry->number, number);
+    if (n >= 2 && strcmp(backend, "pppd") == 0 && (n == 2 || (n == 3 && strcmp(target, "multilink") == 0))) {
+        entry->backend = BACKEND_PPPD;
+        entry->multilink = n == 3;
+    } else if (n >= 2 && strcmp(backend, "ppp") == 0 && (n == 2 || (n == 3 && strcmp(target, "multilink") == 0))) {
+        entry->backend = BACKEND_PPP;
+        entry->multilink = n == 3;
+    } else if (n == 2 && strcmp(backend, "slip") == 0) {
+        entry->backend = BACKEND_SLIP;
+    } else if (n == 2 && strcmp(backend, "cslip") == 0) {
+        entry->backend = BACKEND_CSLIP;
+    } else if (n == 3 && strcmp(backend, "fax") == 0) {
+        entry->backend = BACKEND_FAX;
+        strcpy(entry->target, target);
+    } else if (n == 3 && strcmp(backend, "prompt") == 0 && strchr(target, '/') == NULL) {
+        entry->backend = BACKEND_PROMPT;
+        strcpy(entry->target, target);
+    } else if (n == 2 && strcmp(backend, "linetest") == 0) {
+        entry->backend = BACKEND_LINETEST;
+    } else if (n == 3 && strcmp(backend, "l2tp") == 0 && strchr(target, ':') != NULL) {
+        entry->backend = BACKEND_L2TP;
+        strcpy(entry->target, target);
+    } else if (n >= 3 && strcmp(backend, "tcp") == 0 && strchr(target, ':') != NULL) {
+        entry->backend = BACKEND_TCP;
+        strcpy(entry->target, target);
+        if (n == 4) {
+            if (strcmp(flag, "telnet") != 0) {
+                return -1;
+            }
+            entry->telnet = true;
+        }
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+int dialplan_load(const char *path, dialplan_t *plan) {
+    FILE *file;
+    char line[256];
+    int lineNum = 0;
+    memset(plan, 0, sizeof(*plan));
+    if ((file = fopen(path, "r")) == NULL) {
+        return -1;
+    }
+    while (fgets(line, sizeof(line), file) != NULL) {
+        dialplan_entry_t entry;
+        dialplan_entry_t *entries;
+        int res;
+        lineNum++;
+        if ((res = dialplan_parse(line, &entry)) == 1) {
+            continue;
+        }
+        if (res != 0 || !valid_number(entry.number)) {
+            log_error(NULL, "%s line %d doesn't make sense: %s", path, lineNum, line);
+            fclose(file);
+            dialplan_free(plan);
+            return -2;
+        }
+        if ((entries = realloc(plan->entries, (plan->numEntries + 1)*sizeof(dialplan_entry_t))) == NULL) {
+            fclose(file);
+            dialplan_free(plan);
+            return -2;
+        }
+        plan->entries = entries;
+        plan->entries[plan->numEntries++] = entry;
+    }
+    fclose(file);
+    return 0;
+}
+
+void dialplan_free(dialplan_t *plan) {
+    free(plan->entries);
+    plan->entries = NULL;
+    plan->numEntries = 0;
+}
+
+static bool number_matches(const char *pattern, const char *digits) {
+    if (strcmp(pattern, "default") == 0) {
+        return true;
+    }
+    for (; *pattern && *digits; pattern++, digits++) {
+        if (*pattern != *digits && !(*pattern == 'X' && *digits >= '0' && *digits <= '9')) {
+            return false;
+        }
+    }
+    return *pattern == 0 && *digits == 0;
+}
+
+const dialplan_entry_t *dialplan_match(const dialplan_t *plan, const char *digits) {
+    for (int i = 0; i < plan->numEntries; i++) {
+        if (number_matches(plan->entries[i].number, digits)) {
+            return &plan->entries[i];
+        }
+    }
+    return NULL;
+}
+
+const dialplan_entry_t *dialplan_find(const dialplan_t *plan, backend_t backend) {
+    for (int i = 0; i < plan->numEntries; i++) {
+        if (plan->entries[i].backend == backend) {
+            return &plan->entries[i];
+        }
+    }
+    return NULL;
+}
+
+bool dialplan_uses(const dialplan_t *plan, backend_t backend) {
+    return dialplan_find(plan, backend) != NULL;
+}
@@ -0,0 +1,76 @@
+#ifndef DIALPLAN_H
+#define DIALPLAN_H
+#include <stdbool.h>
+
+/* What takes over the line once the modem connects. */
+typedef enum {
+    BACKEND_PPPD = 0,
+    BACKEND_PPP,
+    BACKEND_TCP,
+    BACKEND_SLIP,
+    BACKEND_CSLIP,
+    BACKEND_L2TP,
+    /* Not answered as data. The line gets tested against a loopback on the other end. */
+    BACKEND_LINETEST,
+    /* A fax receiver program, given the TTY with the call answered in fax class 1. */
+    BACKEND_FAX,
+    /* Not answered as data either. The caller hears a recorded prompt (see prompt.h) and gets hung up on. */
+    BACKEND_PROMPT
+} backend_t;
+
+/*
+ * Which backend each number gets. The file has one "number backend [args]"
+ * per line:
+ *   5551234  pppd
+ *   5559999  ppp
+ *   55580XX  ppp multilink
+ *   555232X  tcp 127.0.0.1:2323 telnet
+ *   5557000  slip      (or cslip)
+ *   5558000  l2tp lns.example.net:1701
+ *   5550100  linetest  (the caller's a loopback. See linetest.h)
+ *   5553000  fax /usr/local/bin/faxrecv
+ *   5550000  prompt welcome
+ *   default  pppd
+ * X matches any digit. The first line that matches wins, and numbers that
+ * don't match anything don't get answered. # after a space starts a comment.
+ * multilink (ppp or pppd) bonds calls to the same number into one link, so a
+ * caller with two lines dials the same number on both. Calls that come in on
+ * ring get bonded by their caller ID number instead, and ones without it
+ * don't get bonded at all.
+ *
+ * Callers that don't dial but send a calling tone are picked up straight
+ * away: fax machines (CNG) go to the first fax line, and modems (the V.25
+ * calling tone) to default.
+ */
+typedef struct {
+    char number[32];
+    backend_t backend;
+    /* host:port for tcp, the LNS for l2tp, the program for fax, or the prompt's name. */
+    char target[128];
+    /* Speak telnet to the far end. */
+    bool telnet;
+    bool multilink;
+} dialplan_entry_t;
+
+typedef struct {
+    dialplan_entry_t *entries;
+    int numEntries;
+} dialplan_t;
+
+/*
+ * Parse one "number backend [args]" line into entry, taking any comment off
+ * line. 0 if it's good, 1 if there's nothing on it, -1 if it doesn't make
+ * sense. The number isn't checked.
+ */
+int dialplan_parse(char *line, dialplan_entry_t *entry);
+/* 0 if it loaded, -1 if the file couldn't be opened, -2 if a line didn't make sense. */
+int dialplan_load(const char *path, dialplan_t *plan);
+void dialplan_free(dialplan_t *plan);
+/* The entry for the dialed digits, or NULL. */
+const dialplan_entry_t *dialplan_match(const dialplan_t *plan, const char *digits);
+/* The first entry that goes to backend, or NULL. */
+const dialplan_entry_t *dialplan_find(const dialplan_t *plan, backend_t backend);
+bool dialplan_uses(const dialplan_t *plan, backend_t backend);
+const char *backend_name(backend_t backend);
+
+#endif
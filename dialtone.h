@@ -1,3098 +0,0 @@
-unsigned char dialtone[37141] = {
-	0x76, 0x6B, 0x66, 0x60, 0x5F, 0x60, 0x65, 0x6F, 0x7C, 0x88, 0x98, 0xA5,
-	0xB2, 0xBA, 0xBD, 0xBC, 0xB3, 0xA5, 0x95, 0x81, 0x70, 0x5B, 0x4B, 0x40,
-	0x3B, 0x3D, 0x44, 0x52, 0x67, 0x7D, 0x94, 0xA8, 0xBB, 0xC8, 0xCC, 0xCB,
-	0xC2, 0xB5, 0xA3, 0x8C, 0x75, 0x61, 0x4E, 0x43, 0x3D, 0x3D, 0x45, 0x52,
-	0x61, 0x76, 0x89, 0x9A, 0xA8, 0xB4, 0xBB, 0xB9, 0xB3, 0xA9, 0x9C, 0x8E,
-	0x81, 0x75, 0x6B, 0x64, 0x62, 0x61, 0x66, 0x6B, 0x72, 0x7A, 0x7F, 0x85,
-	0x89, 0x8B, 0x8A, 0x89, 0x87, 0x85, 0x85, 0x85, 0x87, 0x88, 0x8B, 0x8F,
-	0x93, 0x95, 0x94, 0x91, 0x8C, 0x85, 0x7E, 0x74, 0x69, 0x61, 0x59, 0x56,
-	0x57, 0x5D, 0x66, 0x74, 0x82, 0x95, 0xA4, 0xB3, 0xBD, 0xC2, 0xC0, 0xBA,
-	0xAE, 0x9E, 0x89, 0x74, 0x5E, 0x4D, 0x42, 0x3A, 0x38, 0x40, 0x4C, 0x5F,
-	0x76, 0x8C, 0xA4, 0xB8, 0xC3, 0xCB, 0xCA, 0xC6, 0xB9, 0xA7, 0x93, 0x7D,
-	0x68, 0x57, 0x4A, 0x41, 0x41, 0x46, 0x51, 0x5F, 0x72, 0x83, 0x94, 0xA2,
-	0xAC, 0xB2, 0xB2, 0xAE, 0xA6, 0x9B, 0x8E, 0x84, 0x7B, 0x71, 0x6E, 0x6A,
-	0x6A, 0x6B, 0x71, 0x77, 0x7C, 0x81, 0x82, 0x84, 0x84, 0x83, 0x81, 0x80,
-	0x80, 0x80, 0x82, 0x85, 0x8B, 0x90, 0x96, 0x9C, 0x9D, 0x9F, 0x9B, 0x95,
-	0x8B, 0x81, 0x75, 0x66, 0x5C, 0x52, 0x4D, 0x4D, 0x52, 0x5C, 0x6B, 0x7D,
-	0x8F, 0xA3, 0xB3, 0xBF, 0xC6, 0xC7, 0xC0, 0xB5, 0xA4, 0x90, 0x7A, 0x64,
-	0x51, 0x42, 0x3A, 0x38, 0x3E, 0x47, 0x5A, 0x71, 0x86, 0x9D, 0xB1, 0xC0,
-	0xC7, 0xCA, 0xC5, 0xBB, 0xAA, 0x96, 0x82, 0x6D, 0x5E, 0x51, 0x48, 0x47,
-	0x49, 0x52, 0x60, 0x70, 0x7F, 0x8D, 0x9A, 0xA3, 0xA9, 0xAA, 0xA7, 0xA0,
-	0x9A, 0x8E, 0x86, 0x7F, 0x78, 0x75, 0x70, 0x72, 0x74, 0x78, 0x7B, 0x7F,
-	0x7F, 0x80, 0x80, 0x7E, 0x7A, 0x79, 0x79, 0x78, 0x7B, 0x7F, 0x85, 0x8D,
-	0x95, 0x9D, 0xA1, 0xA6, 0xA6, 0xA4, 0x9C, 0x91, 0x82, 0x75, 0x67, 0x59,
-	0x4E, 0x47, 0x45, 0x49, 0x54, 0x63, 0x76, 0x8A, 0x9D, 0xB1, 0xBF, 0xC8,
-	0xCA, 0xC5, 0xBA, 0xAA, 0x97, 0x80, 0x6A, 0x55, 0x45, 0x3A, 0x38, 0x3C,
-	0x46, 0x55, 0x6A, 0x80, 0x96, 0xAB, 0xBA, 0xC5, 0xC8, 0xC4, 0xBB, 0xAC,
-	0x9B, 0x89, 0x75, 0x66, 0x59, 0x50, 0x4D, 0x50, 0x57, 0x60, 0x6E, 0x7C,
-	0x89, 0x92, 0x9C, 0xA1, 0xA2, 0xA1, 0x9B, 0x94, 0x8E, 0x88, 0x80, 0x7D,
-	0x7B, 0x7C, 0x7C, 0x7D, 0x7F, 0x80, 0x82, 0x80, 0x7D, 0x7C, 0x78, 0x73,
-	0x6F, 0x6E, 0x70, 0x74, 0x7A, 0x81, 0x8B, 0x95, 0xA1, 0xA9, 0xAE, 0xB0,
-	0xAC, 0xA6, 0x9A, 0x8B, 0x7B, 0x68, 0x5A, 0x4C, 0x43, 0x40, 0x43, 0x4C,
-	0x5B, 0x6E, 0x83, 0x99, 0xAD, 0xBE, 0xC8, 0xCB, 0xC9, 0xBF, 0xB1, 0x9E,
-	0x87, 0x70, 0x59, 0x49, 0x3E, 0x39, 0x3A, 0x44, 0x51, 0x65, 0x7C, 0x91,
-	0xA4, 0xB3, 0xBD, 0xC3, 0xBF, 0xB7, 0xAC, 0x9D, 0x8C, 0x7B, 0x6C, 0x60,
-	0x57, 0x52, 0x54, 0x5B, 0x63, 0x6E, 0x7A, 0x84, 0x8E, 0x94, 0x98, 0x9A,
-	0x98, 0x96, 0x8F, 0x8A, 0x87, 0x84, 0x81, 0x82, 0x82, 0x83, 0x83, 0x86,
-	0x86, 0x83, 0x81, 0x7B, 0x76, 0x70, 0x6A, 0x65, 0x64, 0x65, 0x6B, 0x73,
-	0x7E, 0x8A, 0x98, 0xA4, 0xAE, 0xB7, 0xBA, 0xB8, 0xB0, 0xA2, 0x93, 0x81,
-	0x6F, 0x5C, 0x4C, 0x40, 0x3D, 0x3F, 0x47, 0x55, 0x68, 0x7E, 0x93, 0xA9,
-	0xBC, 0xC7, 0xCF, 0xCA, 0xC3, 0xB5, 0xA2, 0x8C, 0x74, 0x60, 0x4D, 0x42,
-	0x3B, 0x3B, 0x43, 0x50, 0x63, 0x77, 0x8A, 0x9D, 0xAD, 0xB8, 0xBD, 0xBC,
-	0xB6, 0xAB, 0x9D, 0x8E, 0x80, 0x72, 0x67, 0x60, 0x5C, 0x5B, 0x60, 0x67,
-	0x71, 0x79, 0x81, 0x88, 0x8C, 0x91, 0x90, 0x8F, 0x8D, 0x8A, 0x87, 0x86,
-	0x85, 0x85, 0x87, 0x8A, 0x8C, 0x8E, 0x8F, 0x8C, 0x89, 0x84, 0x7D, 0x75,
-	0x6C, 0x64, 0x5E, 0x5C, 0x5C, 0x61, 0x69, 0x77, 0x85, 0x96, 0xA5, 0xB1,
-	0xBB, 0xBE, 0xBE, 0xB8, 0xAC, 0x9D, 0x87, 0x72, 0x5E, 0x4D, 0x41, 0x3C,
-	0x3B, 0x3F, 0x4C, 0x5F, 0x77, 0x8E, 0xA3, 0xB6, 0xC4, 0xCC, 0xCC, 0xC6,
-	0xB9, 0xA6, 0x92, 0x7C, 0x66, 0x54, 0x46, 0x3F, 0x3E, 0x44, 0x4F, 0x5E,
-	0x71, 0x84, 0x96, 0xA5, 0xAF, 0xB6, 0xB6, 0xB3, 0xA8, 0x9D, 0x93, 0x82,
-	0x7A, 0x6F, 0x68, 0x65, 0x66, 0x68, 0x6D, 0x74, 0x7A, 0x7F, 0x85, 0x87,
-	0x88, 0x88, 0x85, 0x85, 0x84, 0x83, 0x83, 0x87, 0x89, 0x8D, 0x92, 0x96,
-	0x98, 0x98, 0x96, 0x90, 0x89, 0x7F, 0x75, 0x68, 0x5F, 0x58, 0x53, 0x52,
-	0x57, 0x62, 0x6F, 0x7E, 0x8F, 0xA2, 0xB1, 0xBD, 0xC3, 0xC3, 0xBD, 0xB3,
-	0xA4, 0x8C, 0x78, 0x62, 0x51, 0x42, 0x3A, 0x38, 0x3C, 0x4A, 0x5A, 0x71,
-	0x89, 0x9E, 0xB2, 0xC1, 0xCA, 0xCB, 0xC6, 0xBB, 0xAA, 0x95, 0x82, 0x6E,
-	0x5C, 0x4D, 0x46, 0x43, 0x46, 0x4F, 0x5D, 0x6F, 0x80, 0x8F, 0x9C, 0xA7,
-	0xAE, 0xAF, 0xAC, 0xA5, 0x9B, 0x91, 0x86, 0x7D, 0x75, 0x70, 0x6D, 0x6D,
-	0x6F, 0x73, 0x76, 0x7C, 0x7F, 0x81, 0x82, 0x82, 0x80, 0x7F, 0x7D, 0x7D,
-	0x7F, 0x81, 0x85, 0x8C, 0x92, 0x99, 0x9D, 0xA2, 0xA2, 0x9F, 0x98, 0x8E,
-	0x83, 0x78, 0x68, 0x5C, 0x50, 0x4A, 0x4A, 0x4E, 0x59, 0x65, 0x76, 0x8C,
-	0x9F, 0xB0, 0xBE, 0xC6, 0xC7, 0xC4, 0xB9, 0xAA, 0x95, 0x7F, 0x68, 0x54,
-	0x44, 0x3A, 0x38, 0x3A, 0x45, 0x55, 0x6B, 0x83, 0x97, 0xAE, 0xBC, 0xC6,
-	0xCB, 0xC5, 0xBC, 0xAF, 0x9A, 0x87, 0x73, 0x62, 0x54, 0x4B, 0x47, 0x4C,
-	0x52, 0x5D, 0x6D, 0x7C, 0x89, 0x95, 0x9E, 0xA5, 0xA7, 0xA5, 0xA1, 0x97,
-	0x8F, 0x88, 0x81, 0x7B, 0x79, 0x76, 0x77, 0x77, 0x7B, 0x7D, 0x7E, 0x7F,
-	0x7E, 0x7D, 0x7B, 0x77, 0x75, 0x74, 0x75, 0x77, 0x7D, 0x83, 0x8B, 0x94,
-	0x9C, 0xA3, 0xAA, 0xAB, 0xA8, 0xA2, 0x97, 0x89, 0x7A, 0x6A, 0x5A, 0x4E,
-	0x48, 0x45, 0x46, 0x50, 0x5C, 0x70, 0x84, 0x9B, 0xAE, 0xBD, 0xC6, 0xCB,
-	0xC8, 0xBE, 0xB0, 0x9C, 0x85, 0x6E, 0x5A, 0x48, 0x3C, 0x38, 0x3A, 0x43,
-	0x52, 0x66, 0x7D, 0x93, 0xA6, 0xB6, 0xC1, 0xC4, 0xC5, 0xBA, 0xAF, 0x9E,
-	0x8B, 0x79, 0x69, 0x5C, 0x54, 0x51, 0x50, 0x56, 0x5F, 0x6D, 0x7B, 0x84,
-	0x90, 0x97, 0x9D, 0x9F, 0x9D, 0x9B, 0x94, 0x8E, 0x89, 0x84, 0x81, 0x7F,
-	0x7E, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7D, 0x7A, 0x74, 0x70, 0x6C,
-	0x69, 0x6B, 0x6F, 0x75, 0x7F, 0x88, 0x95, 0xA0, 0xAA, 0xB1, 0xB3, 0xB2,
-	0xAB, 0xA0, 0x90, 0x81, 0x6D, 0x5C, 0x4D, 0x42, 0x3F, 0x40, 0x48, 0x56,
-	0x69, 0x7F, 0x95, 0xAA, 0xBB, 0xC6, 0xCC, 0xCB, 0xC4, 0xB4, 0xA2, 0x8B,
-	0x75, 0x5E, 0x4D, 0x40, 0x3A, 0x3C, 0x42, 0x50, 0x61, 0x76, 0x8B, 0x9F,
-	0xAF, 0xBB, 0xBF, 0xC0, 0xBA, 0xAE, 0xA0, 0x8F, 0x7F, 0x70, 0x65, 0x5C,
-	0x57, 0x59, 0x5D, 0x63, 0x6E, 0x78, 0x81, 0x8A, 0x90, 0x95, 0x96, 0x94,
-	0x92, 0x8E, 0x8B, 0x87, 0x85, 0x84, 0x83, 0x85, 0x86, 0x89, 0x87, 0x88,
-	0x85, 0x81, 0x7C, 0x76, 0x70, 0x68, 0x63, 0x61, 0x63, 0x65, 0x6E, 0x7B,
-	0x86, 0x94, 0xA2, 0xAE, 0xB7, 0xBB, 0xBA, 0xB4, 0xA7, 0x98, 0x86, 0x73,
-	0x5F, 0x50, 0x42, 0x3C, 0x3C, 0x43, 0x4F, 0x61, 0x79, 0x8F, 0xA4, 0xB8,
-	0xC5, 0xCC, 0xCD, 0xC5, 0xB8, 0xA6, 0x91, 0x7B, 0x65, 0x51, 0x44, 0x3D,
-	0x3C, 0x41, 0x4D, 0x5F, 0x72, 0x86, 0x97, 0xA8, 0xB4, 0xB9, 0xBA, 0xB5,
-	0xAC, 0x9F, 0x92, 0x85, 0x76, 0x6B, 0x63, 0x60, 0x5E, 0x62, 0x67, 0x70,
-	0x78, 0x80, 0x85, 0x89, 0x8B, 0x8D, 0x8C, 0x8B, 0x88, 0x86, 0x85, 0x85,
-	0x87, 0x88, 0x8B, 0x8F, 0x92, 0x93, 0x91, 0x8E, 0x86, 0x7E, 0x77, 0x6C,
-	0x64, 0x5D, 0x58, 0x59, 0x5C, 0x67, 0x72, 0x7F, 0x91, 0xA2, 0xB0, 0xBB,
-	0xC0, 0xC0, 0xBB, 0xAF, 0xA0, 0x8C, 0x76, 0x62, 0x4F, 0x42, 0x3B, 0x38,
-	0x3F, 0x49, 0x5C, 0x71, 0x88, 0xA0, 0xB4, 0xC2, 0xCC, 0xCC, 0xC7, 0xBA,
-	0xAA, 0x96, 0x80, 0x6B, 0x58, 0x4C, 0x42, 0x40, 0x44, 0x4E, 0x5D, 0x6E,
-	0x80, 0x91, 0xA1, 0xAB, 0xB2, 0xB4, 0xB1, 0xAA, 0x9F, 0x93, 0x86, 0x7C,
-	0x72, 0x6C, 0x69, 0x68, 0x69, 0x6E, 0x73, 0x79, 0x7F, 0x82, 0x84, 0x84,
-	0x84, 0x82, 0x82, 0x7F, 0x80, 0x82, 0x84, 0x89, 0x8F, 0x93, 0x99, 0x9B,
-	0x9C, 0x9A, 0x93, 0x8C, 0x82, 0x76, 0x6B, 0x5E, 0x54, 0x51, 0x4F, 0x52,
-	0x5B, 0x6A, 0x7A, 0x8C, 0x9E, 0xAF, 0xBC, 0xC4, 0xC7, 0xBF, 0xB7, 0xA8,
-	0x93, 0x7E, 0x67, 0x53, 0x45, 0x3A, 0x36, 0x3D, 0x46, 0x57, 0x6C, 0x81,
-	0x9A, 0xAF, 0xBE, 0xC7, 0xCB, 0xC8, 0xBD, 0xAE, 0x9C, 0x86, 0x73, 0x60,
-	0x52, 0x49, 0x45, 0x47, 0x4F, 0x5C, 0x6C, 0x7C, 0x8C, 0x98, 0xA3, 0xAB,
-	0xAD, 0xA9, 0xA4, 0x9C, 0x93, 0x89, 0x80, 0x78, 0x73, 0x73, 0x71, 0x73,
-	0x74, 0x79, 0x7D, 0x7E, 0x81, 0x80, 0x80, 0x7D, 0x7B, 0x79, 0x79, 0x7C,
-	0x7F, 0x84, 0x8C, 0x92, 0x99, 0x9F, 0xA5, 0xA6, 0xA2, 0x9C, 0x93, 0x85,
-	0x7A, 0x6B, 0x5B, 0x4F, 0x49, 0x46, 0x49, 0x51, 0x5F, 0x73, 0x86, 0x9C,
-	0xAD, 0xBB, 0xC6, 0xC9, 0xC6, 0xBC, 0xAE, 0x99, 0x84, 0x6E, 0x58, 0x45,
-	0x3B, 0x38, 0x39, 0x43, 0x53, 0x66, 0x7E, 0x95, 0xA8, 0xB8, 0xC2, 0xC6,
-	0xC6, 0xBD, 0xAE, 0x9E, 0x8A, 0x79, 0x67, 0x59, 0x4E, 0x4C, 0x4B, 0x53,
-	0x5F, 0x6B, 0x7A, 0x86, 0x92, 0x9C, 0xA1, 0xA4, 0xA3, 0x9E, 0x98, 0x90,
-	0x8A, 0x82, 0x7D, 0x7A, 0x79, 0x79, 0x7B, 0x7C, 0x7F, 0x80, 0x80, 0x7F,
-	0x7D, 0x7A, 0x75, 0x71, 0x70, 0x71, 0x74, 0x79, 0x81, 0x89, 0x93, 0x9D,
-	0xA5, 0xAC, 0xB0, 0xAD, 0xA7, 0x9C, 0x8C, 0x7F, 0x6F, 0x5D, 0x4F, 0x45,
-	0x43, 0x43, 0x4C, 0x59, 0x6B, 0x80, 0x96, 0xA8, 0xBB, 0xC7, 0xCB, 0xC9,
-	0xC1, 0xB3, 0xA0, 0x89, 0x71, 0x5E, 0x4B, 0x3F, 0x38, 0x38, 0x41, 0x50,
-	0x61, 0x78, 0x8D, 0xA1, 0xB1, 0xBD, 0xC4, 0xC5, 0xBB, 0xB0, 0xA1, 0x8F,
-	0x7E, 0x6E, 0x61, 0x58, 0x52, 0x53, 0x57, 0x60, 0x6C, 0x78, 0x82, 0x8C,
-	0x95, 0x9A, 0x9B, 0x9B, 0x98, 0x92, 0x8D, 0x88, 0x84, 0x82, 0x80, 0x80,
-	0x82, 0x83, 0x84, 0x85, 0x82, 0x80, 0x7E, 0x79, 0x74, 0x6D, 0x68, 0x66,
-	0x67, 0x6B, 0x71, 0x7C, 0x87, 0x93, 0xA0, 0xAB, 0xB3, 0xB7, 0xB6, 0xB0,
-	0xA3, 0x95, 0x84, 0x71, 0x5E, 0x4E, 0x43, 0x3D, 0x3E, 0x43, 0x52, 0x65,
-	0x79, 0x90, 0xA6, 0xB7, 0xC5, 0xCB, 0xCC, 0xC6, 0xB8, 0xA6, 0x91, 0x79,
-	0x63, 0x51, 0x42, 0x3B, 0x3B, 0x41, 0x4C, 0x5E, 0x72, 0x87, 0x99, 0xAA,
-	0xB7, 0xBD, 0xBE, 0xBA, 0xAF, 0xA2, 0x92, 0x80, 0x74, 0x68, 0x5F, 0x5B,
-	0x5A, 0x5E, 0x65, 0x6C, 0x77, 0x80, 0x88, 0x8D, 0x90, 0x92, 0x91, 0x90,
-	0x8C, 0x8A, 0x85, 0x85, 0x85, 0x86, 0x87, 0x8C, 0x8B, 0x8C, 0x8C, 0x89,
-	0x84, 0x7F, 0x76, 0x70, 0x67, 0x62, 0x5E, 0x5E, 0x63, 0x6B, 0x74, 0x82,
-	0x93, 0xA0, 0xAF, 0xB8, 0xBE, 0xBE, 0xB8, 0xAD, 0x9E, 0x8B, 0x77, 0x62,
-	0x50, 0x42, 0x3B, 0x3A, 0x3F, 0x4C, 0x5C, 0x73, 0x8A, 0xA0, 0xB3, 0xC1,
-	0xCA, 0xCC, 0xC6, 0xBB, 0xAB, 0x96, 0x81, 0x69, 0x57, 0x49, 0x40, 0x3D,
-	0x41, 0x4C, 0x5B, 0x6E, 0x80, 0x91, 0xA3, 0xAF, 0xB8, 0xB9, 0xB5, 0xAC,
-	0xA1, 0x95, 0x87, 0x7B, 0x70, 0x67, 0x62, 0x63, 0x64, 0x6B, 0x71, 0x78,
-	0x7E, 0x82, 0x86, 0x89, 0x88, 0x88, 0x87, 0x86, 0x83, 0x84, 0x86, 0x87,
-	0x8A, 0x8E, 0x92, 0x95, 0x97, 0x95, 0x90, 0x8A, 0x81, 0x77, 0x6E, 0x64,
-	0x5A, 0x55, 0x55, 0x58, 0x62, 0x6B, 0x7E, 0x8D, 0xA0, 0xB1, 0xBA, 0xC2,
-	0xC4, 0xBF, 0xB4, 0xA5, 0x92, 0x7D, 0x68, 0x54, 0x42, 0x3B, 0x37, 0x3A,
-	0x46, 0x55, 0x6B, 0x82, 0x99, 0xAE, 0xBE, 0xC7, 0xCC, 0xC7, 0xBD, 0xAD,
-	0x9A, 0x84, 0x71, 0x5D, 0x4E, 0x44, 0x42, 0x46, 0x4E, 0x5A, 0x6A, 0x7D,
-	0x8C, 0x9D, 0xA6, 0xAF, 0xB1, 0xAF, 0xA8, 0x9E, 0x93, 0x88, 0x7F, 0x75,
-	0x6F, 0x6C, 0x6B, 0x6B, 0x70, 0x75, 0x7B, 0x7D, 0x80, 0x83, 0x82, 0x81,
-	0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x85, 0x8A, 0x8F, 0x96, 0x9C, 0x9F, 0xA0,
-	0x9E, 0x98, 0x90, 0x83, 0x7A, 0x6C, 0x5E, 0x53, 0x4D, 0x4B, 0x4E, 0x57,
-	0x62, 0x75, 0x87, 0x9C, 0xAC, 0xBB, 0xC6, 0xC6, 0xC6, 0xBB, 0xAC, 0x98,
-	0x82, 0x6C, 0x57, 0x47, 0x3D, 0x37, 0x3A, 0x42, 0x52, 0x66, 0x7E, 0x94,
-	0xA9, 0xBA, 0xC5, 0xC8, 0xC7, 0xBF, 0xB0, 0x9F, 0x8A, 0x77, 0x64, 0x54,
-	0x4C, 0x47, 0x48, 0x51, 0x5A, 0x69, 0x7A, 0x87, 0x94, 0x9F, 0xA6, 0xA9,
-	0xA7, 0xA3, 0x9D, 0x92, 0x8B, 0x81, 0x7D, 0x76, 0x74, 0x75, 0x76, 0x77,
-	0x7A, 0x7D, 0x7F, 0x7E, 0x7F, 0x7E, 0x7B, 0x76, 0x75, 0x77, 0x78, 0x7C,
-	0x80, 0x89, 0x92, 0x99, 0xA3, 0xA6, 0xA8, 0xA9, 0xA1, 0x95, 0x8A, 0x7E,
-	0x6D, 0x5E, 0x52, 0x49, 0x45, 0x47, 0x4E, 0x5C, 0x6E, 0x82, 0x97, 0xA9,
-	0xBA, 0xC5, 0xCB, 0xC9, 0xC0, 0xB1, 0xA0, 0x89, 0x74, 0x5D, 0x49, 0x3E,
-	0x38, 0x39, 0x42, 0x4F, 0x62, 0x78, 0x8D, 0xA4, 0xB5, 0xC1, 0xC5, 0xC4,
-	0xBE, 0xB2, 0xA1, 0x8E, 0x7C, 0x6C, 0x5E, 0x54, 0x4D, 0x4F, 0x53, 0x5C,
-	0x69, 0x77, 0x83, 0x8E, 0x98, 0x9E, 0xA0, 0x9F, 0x9C, 0x96, 0x8F, 0x89,
-	0x84, 0x80, 0x7D, 0x7C, 0x7D, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7B,
-	0x77, 0x72, 0x6E, 0x6C, 0x6D, 0x6E, 0x75, 0x7D, 0x88, 0x94, 0x9C, 0xA8,
-	0xAF, 0xB2, 0xB1, 0xAC, 0xA0, 0x93, 0x82, 0x71, 0x5E, 0x51, 0x47, 0x40,
-	0x42, 0x46, 0x55, 0x66, 0x7B, 0x91, 0xA6, 0xB8, 0xC5, 0xCC, 0xCB, 0xC3,
-	0xB8, 0xA5, 0x8F, 0x79, 0x63, 0x4F, 0x40, 0x3A, 0x38, 0x3F, 0x4C, 0x5D,
-	0x72, 0x87, 0x9C, 0xAD, 0xBA, 0xBF, 0xC0, 0xBB, 0xB1, 0xA3, 0x92, 0x81,
-	0x74, 0x64, 0x5B, 0x56, 0x55, 0x59, 0x60, 0x6A, 0x77, 0x80, 0x8A, 0x91,
-	0x96, 0x97, 0x97, 0x95, 0x8F, 0x8B, 0x88, 0x85, 0x82, 0x82, 0x83, 0x84,
-	0x86, 0x88, 0x87, 0x84, 0x83, 0x7D, 0x79, 0x73, 0x6B, 0x66, 0x63, 0x63,
-	0x65, 0x6E, 0x78, 0x83, 0x92, 0x9E, 0xAB, 0xB4, 0xBA, 0xBA, 0xB4, 0xAB,
-	0x9B, 0x88, 0x76, 0x63, 0x52, 0x44, 0x3F, 0x3D, 0x41, 0x4E, 0x5E, 0x73,
-	0x8B, 0xA1, 0xB4, 0xC2, 0xCB, 0xCC, 0xC5, 0xBB, 0xAA, 0x94, 0x7F, 0x69,
-	0x55, 0x46, 0x3E, 0x3B, 0x40, 0x4B, 0x59, 0x6E, 0x82, 0x95, 0xA5, 0xB2,
-	0xBA, 0xBC, 0xB7, 0xB0, 0xA2, 0x95, 0x85, 0x79, 0x6D, 0x62, 0x5E, 0x5D,
-	0x60, 0x66, 0x6F, 0x76, 0x7E, 0x85, 0x88, 0x8E, 0x8F, 0x8E, 0x8D, 0x89,
-	0x87, 0x85, 0x85, 0x85, 0x87, 0x8A, 0x8C, 0x90, 0x90, 0x8F, 0x8C, 0x86,
-	0x80, 0x78, 0x6D, 0x66, 0x5F, 0x59, 0x59, 0x5E, 0x65, 0x71, 0x7F, 0x8F,
-	0x9F, 0xAD, 0xB8, 0xBD, 0xBF, 0xBC, 0xB2, 0xA4, 0x90, 0x7C, 0x67, 0x54,
-	0x45, 0x3A, 0x3A, 0x3C, 0x48, 0x57, 0x6E, 0x84, 0x9C, 0xB0, 0xBF, 0xC9,
-	0xCD, 0xC9, 0xBE, 0xAE, 0x9A, 0x85, 0x70, 0x5C, 0x4D, 0x42, 0x3F, 0x41,
-	0x4C, 0x59, 0x6B, 0x7D, 0x8E, 0x9F, 0xAB, 0xB3, 0xB6, 0xB3, 0xAC, 0xA1,
-	0x96, 0x87, 0x7C, 0x74, 0x6C, 0x66, 0x65, 0x66, 0x6B, 0x71, 0x78, 0x7D,
-	0x80, 0x84, 0x86, 0x85, 0x85, 0x84, 0x81, 0x81, 0x83, 0x84, 0x87, 0x8C,
-	0x90, 0x96, 0x98, 0x9A, 0x99, 0x94, 0x8D, 0x82, 0x79, 0x6D, 0x60, 0x5A,
-	0x53, 0x51, 0x53, 0x5B, 0x68, 0x78, 0x8A, 0x9B, 0xAC, 0xB9, 0xC2, 0xC6,
-	0xC2, 0xB9, 0xA9, 0x97, 0x81, 0x6B, 0x55, 0x47, 0x3B, 0x37, 0x3B, 0x43,
-	0x53, 0x67, 0x7D, 0x94, 0xAA, 0xBB, 0xC6, 0xCA, 0xC8, 0xC0, 0xB0, 0x9D,
-	0x89, 0x76, 0x63, 0x52, 0x49, 0x44, 0x45, 0x4D, 0x59, 0x68, 0x79, 0x89,
-	0x98, 0xA3, 0xAA, 0xAE, 0xAA, 0xA7, 0x9F, 0x94, 0x8B, 0x80, 0x79, 0x73,
-	0x6E, 0x6F, 0x6F, 0x71, 0x77, 0x7A, 0x7D, 0x80, 0x80, 0x80, 0x80, 0x7C,
-	0x7C, 0x7B, 0x7C, 0x7F, 0x82, 0x8A, 0x90, 0x96, 0x9D, 0xA2, 0xA2, 0xA3,
-	0x9D, 0x93, 0x87, 0x7C, 0x6D, 0x60, 0x54, 0x4C, 0x49, 0x4A, 0x52, 0x5F,
-	0x6F, 0x83, 0x97, 0xAA, 0xBA, 0xC5, 0xC9, 0xC7, 0xC0, 0xB1, 0x9F, 0x88,
-	0x71, 0x5D, 0x4A, 0x3E, 0x38, 0x39, 0x41, 0x50, 0x62, 0x78, 0x90, 0xA5,
-	0xB6, 0xC2, 0xC8, 0xC7, 0xC0, 0xB3, 0xA2, 0x8F, 0x79, 0x69, 0x5A, 0x50,
-	0x4B, 0x4A, 0x51, 0x5A, 0x68, 0x78, 0x85, 0x91, 0x9B, 0xA2, 0xA7, 0xA6,
-	0xA1, 0x9B, 0x93, 0x8A, 0x84, 0x7D, 0x7A, 0x76, 0x77, 0x79, 0x7A, 0x7D,
-	0x7F, 0x7F, 0x7F, 0x7D, 0x7A, 0x77, 0x74, 0x71, 0x73, 0x74, 0x79, 0x7E,
-	0x87, 0x92, 0x99, 0xA2, 0xA8, 0xAD, 0xAB, 0xA4, 0x9C, 0x8F, 0x80, 0x72,
-	0x5F, 0x52, 0x47, 0x44, 0x43, 0x4A, 0x57, 0x68, 0x7C, 0x92, 0xA7, 0xB9,
-	0xC4, 0xCA, 0xCB, 0xC3, 0xB7, 0xA5, 0x8E, 0x77, 0x61, 0x4F, 0x41, 0x39,
-	0x39, 0x3E, 0x4C, 0x5E, 0x73, 0x89, 0x9E, 0xAE, 0xBC, 0xC3, 0xC6, 0xBE,
-	0xB3, 0xA5, 0x93, 0x80, 0x6F, 0x62, 0x57, 0x51, 0x50, 0x54, 0x5D, 0x68,
-	0x75, 0x81, 0x8B, 0x94, 0x9A, 0x9C, 0x9D, 0x9A, 0x95, 0x8F, 0x89, 0x86,
-	0x81, 0x80, 0x80, 0x80, 0x82, 0x83, 0x82, 0x82, 0x80, 0x80, 0x79, 0x75,
-	0x70, 0x6B, 0x68, 0x68, 0x6C, 0x70, 0x7B, 0x83, 0x91, 0x9D, 0xA8, 0xB2,
-	0xB6, 0xB4, 0xAF, 0xA4, 0x96, 0x85, 0x75, 0x61, 0x52, 0x46, 0x3F, 0x3E,
-	0x43, 0x50, 0x5F, 0x76, 0x8B, 0xA2, 0xB6, 0xC3, 0xCB, 0xCC, 0xC7, 0xBA,
-	0xA9, 0x95, 0x7E, 0x68, 0x54, 0x44, 0x3C, 0x3B, 0x3E, 0x4B, 0x58, 0x6D,
-	0x84, 0x97, 0xA8, 0xB5, 0xBE, 0xC0, 0xBA, 0xB2, 0xA3, 0x94, 0x85, 0x76,
-	0x6A, 0x5F, 0x59, 0x58, 0x5B, 0x61, 0x6A, 0x75, 0x7E, 0x87, 0x8F, 0x92,
-	0x93, 0x94, 0x91, 0x8E, 0x8A, 0x88, 0x86, 0x84, 0x85, 0x85, 0x88, 0x89,
-	0x8B, 0x8B, 0x87, 0x84, 0x7F, 0x77, 0x72, 0x6A, 0x62, 0x60, 0x5F, 0x61,
-	0x6A, 0x76, 0x81, 0x90, 0x9E, 0xAB, 0xB5, 0xBD, 0xBE, 0xB8, 0xB0, 0xA0,
-	0x8D, 0x7A, 0x66, 0x54, 0x46, 0x3D, 0x3A, 0x3E, 0x49, 0x5A, 0x6F, 0x86,
-	0x9D, 0xB0, 0xC0, 0xCB, 0xCD, 0xCA, 0xBE, 0xAE, 0x99, 0x82, 0x6D, 0x59,
-	0x4A, 0x41, 0x3D, 0x40, 0x49, 0x58, 0x69, 0x7D, 0x91, 0xA1, 0xAC, 0xB7,
-	0xBA, 0xB7, 0xAF, 0xA4, 0x96, 0x89, 0x7C, 0x6F, 0x69, 0x63, 0x61, 0x62,
-	0x67, 0x6E, 0x76, 0x7C, 0x83, 0x87, 0x89, 0x8C, 0x8A, 0x87, 0x87, 0x87,
-	0x85, 0x84, 0x86, 0x89, 0x8E, 0x8F, 0x92, 0x93, 0x93, 0x90, 0x89, 0x82,
-	0x79, 0x6E, 0x63, 0x5C, 0x58, 0x56, 0x5A, 0x5F, 0x6C, 0x7A, 0x8A, 0x9C,
-	0xAB, 0xB7, 0xBF, 0xC3, 0xC0, 0xB5, 0xA7, 0x95, 0x7F, 0x6B, 0x56, 0x47,
-	0x3B, 0x38, 0x3B, 0x44, 0x53, 0x67, 0x81, 0x97, 0xAC, 0xBD, 0xC7, 0xCB,
-	0xC8, 0xC1, 0xB3, 0x9E, 0x88, 0x74, 0x60, 0x50, 0x45, 0x40, 0x42, 0x4A,
-	0x58, 0x68, 0x79, 0x8A, 0x9A, 0xA7, 0xB0, 0xB4, 0xB1, 0xAB, 0xA2, 0x97,
-	0x8B, 0x80, 0x76, 0x6F, 0x6B, 0x69, 0x6A, 0x6D, 0x73, 0x78, 0x7E, 0x80,
-	0x82, 0x83, 0x83, 0x82, 0x81, 0x81, 0x80, 0x81, 0x82, 0x88, 0x8C, 0x92,
-	0x97, 0x9C, 0x9E, 0x9D, 0x98, 0x90, 0x87, 0x7A, 0x6E, 0x62, 0x59, 0x51,
-	0x4D, 0x4F, 0x56, 0x63, 0x73, 0x85, 0x97, 0xAA, 0xB8, 0xC2, 0xC7, 0xC5,
-	0xBD, 0xAF, 0x9D, 0x87, 0x70, 0x5B, 0x4A, 0x3E, 0x38, 0x37, 0x42, 0x4F,
-	0x62, 0x7A, 0x90, 0xA6, 0xB7, 0xC4, 0xCA, 0xC9, 0xC1, 0xB3, 0xA3, 0x8F,
-	0x7A, 0x67, 0x58, 0x4D, 0x47, 0x45, 0x4B, 0x58, 0x65, 0x75, 0x85, 0x93,
-	0x9F, 0xA8, 0xAA, 0xAA, 0xA6, 0x9E, 0x95, 0x8B, 0x84, 0x7B, 0x76, 0x73,
-	0x72, 0x72, 0x75, 0x79, 0x7D, 0x7F, 0x80, 0x80, 0x7F, 0x7D, 0x7A, 0x77,
-	0x78, 0x79, 0x7C, 0x81, 0x88, 0x8F, 0x98, 0x9F, 0xA4, 0xA7, 0xA6, 0xA1,
-	0x97, 0x8C, 0x7F, 0x6F, 0x60, 0x54, 0x49, 0x46, 0x48, 0x4E, 0x5A, 0x69,
-	0x7E, 0x91, 0xA7, 0xB9, 0xC3, 0xC9, 0xC9, 0xC4, 0xB5, 0xA3, 0x8E, 0x75,
-	0x61, 0x4E, 0x40, 0x39, 0x38, 0x3E, 0x4B, 0x5C, 0x74, 0x8C, 0xA0, 0xB2,
-	0xBF, 0xC6, 0xC7, 0xC1, 0xB4, 0xA5, 0x93, 0x80, 0x6E, 0x5F, 0x53, 0x4D,
-	0x4D, 0x50, 0x5A, 0x67, 0x73, 0x80, 0x8D, 0x97, 0x9E, 0xA2, 0xA3, 0x9F,
-	0x99, 0x92, 0x8C, 0x85, 0x7F, 0x7D, 0x7B, 0x7C, 0x7D, 0x7F, 0x7F, 0x80,
-	0x80, 0x7F, 0x7E, 0x79, 0x74, 0x71, 0x6F, 0x6F, 0x71, 0x76, 0x7C, 0x85,
-	0x90, 0x9A, 0xA4, 0xAC, 0xB0, 0xB0, 0xAA, 0xA1, 0x94, 0x83, 0x73, 0x63,
-	0x54, 0x48, 0x42, 0x40, 0x46, 0x52, 0x62, 0x77, 0x8D, 0xA3, 0xB5, 0xC3,
-	0xCB, 0xCB, 0xC6, 0xBB, 0xA9, 0x92, 0x7D, 0x65, 0x53, 0x44, 0x3A, 0x39,
-	0x3E, 0x49, 0x59, 0x6E, 0x84, 0x99, 0xAC, 0xB8, 0xC0, 0xC2, 0xBE, 0xB5,
-	0xA6, 0x96, 0x83, 0x75, 0x66, 0x5B, 0x56, 0x53, 0x57, 0x5F, 0x67, 0x73,
-	0x7F, 0x88, 0x91, 0x96, 0x99, 0x98, 0x97, 0x92, 0x8E, 0x8A, 0x85, 0x83,
-	0x82, 0x81, 0x83, 0x84, 0x85, 0x86, 0x84, 0x82, 0x7F, 0x78, 0x74, 0x6F,
-	0x67, 0x65, 0x65, 0x68, 0x6D, 0x76, 0x82, 0x8F, 0x9C, 0xA7, 0xB3, 0xB7,
-	0xB8, 0xB5, 0xAB, 0x9C, 0x8C, 0x7A, 0x67, 0x56, 0x46, 0x3E, 0x3D, 0x41,
-	0x4C, 0x5B, 0x70, 0x86, 0x9E, 0xB2, 0xC1, 0xCB, 0xCD, 0xC9, 0xBE, 0xAE,
-	0x98, 0x82, 0x6D, 0x58, 0x48, 0x3E, 0x3A, 0x3E, 0x47, 0x56, 0x69, 0x7E,
-	0x92, 0xA2, 0xB1, 0xB8, 0xBB, 0xBA, 0xB3, 0xA6, 0x98, 0x87, 0x7A, 0x6D,
-	0x63, 0x5D, 0x5C, 0x5C, 0x63, 0x6A, 0x74, 0x7D, 0x83, 0x89, 0x8E, 0x91,
-	0x91, 0x8F, 0x8C, 0x89, 0x87, 0x86, 0x85, 0x85, 0x88, 0x8B, 0x8C, 0x8E,
-	0x8E, 0x8B, 0x85, 0x80, 0x7A, 0x71, 0x68, 0x62, 0x5D, 0x5B, 0x5E, 0x65,
-	0x70, 0x7E, 0x8B, 0x9C, 0xAB, 0xB7, 0xBE, 0xC0, 0xBD, 0xB4, 0xA6, 0x93,
-	0x7E, 0x6A, 0x58, 0x47, 0x3E, 0x3A, 0x3C, 0x46, 0x54, 0x69, 0x7F, 0x97,
-	0xAE, 0xBD, 0xC8, 0xCD, 0xC9, 0xC1, 0xB2, 0x9F, 0x88, 0x73, 0x5E, 0x4E,
-	0x43, 0x3E, 0x40, 0x47, 0x54, 0x66, 0x79, 0x8A, 0x9C, 0xAA, 0xB2, 0xB7,
-	0xB5, 0xAE, 0xA4, 0x97, 0x8B, 0x7E, 0x73, 0x6B, 0x65, 0x63, 0x65, 0x68,
-	0x6D, 0x77, 0x7C, 0x81, 0x85, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x82,
-	0x84, 0x87, 0x8A, 0x8E, 0x94, 0x97, 0x98, 0x97, 0x93, 0x8C, 0x85, 0x7D,
-	0x70, 0x65, 0x5C, 0x56, 0x53, 0x54, 0x5B, 0x67, 0x75, 0x86, 0x98, 0xA7,
-	0xB8, 0xC0, 0xC3, 0xC3, 0xBA, 0xAB, 0x9C, 0x86, 0x6F, 0x5A, 0x4A, 0x3E,
-	0x38, 0x3B, 0x41, 0x4F, 0x63, 0x7B, 0x90, 0xA8, 0xBA, 0xC5, 0xCB, 0xCA,
-	0xC2, 0xB4, 0xA2, 0x8D, 0x79, 0x65, 0x55, 0x49, 0x43, 0x44, 0x4A, 0x55,
-	0x63, 0x76, 0x86, 0x95, 0xA2, 0xAA, 0xAF, 0xAE, 0xAA, 0xA0, 0x96, 0x8D,
-	0x81, 0x7A, 0x74, 0x6E, 0x6C, 0x6D, 0x71, 0x75, 0x79, 0x7E, 0x80, 0x80,
-	0x82, 0x80, 0x80, 0x7E, 0x7D, 0x7D, 0x80, 0x81, 0x89, 0x8F, 0x94, 0x9B,
-	0xA1, 0xA2, 0xA1, 0x9C, 0x94, 0x89, 0x7E, 0x70, 0x63, 0x58, 0x4F, 0x48,
-	0x4C, 0x52, 0x5D, 0x6D, 0x80, 0x93, 0xA7, 0xB7, 0xC2, 0xC8, 0xC8, 0xC1,
-	0xB4, 0xA1, 0x8C, 0x77, 0x61, 0x4E, 0x40, 0x38, 0x39, 0x3E, 0x4C, 0x5E,
-	0x74, 0x8C, 0xA0, 0xB3, 0xC1, 0xC8, 0xC8, 0xC3, 0xB6, 0xA5, 0x93, 0x80,
-	0x6C, 0x5C, 0x50, 0x4A, 0x48, 0x4D, 0x57, 0x65, 0x73, 0x82, 0x90, 0x9C,
-	0xA4, 0xA6, 0xA7, 0xA3, 0x9D, 0x96, 0x8D, 0x85, 0x7F, 0x79, 0x77, 0x75,
-	0x78, 0x79, 0x7C, 0x7D, 0x7E, 0x7F, 0x7D, 0x7C, 0x7A, 0x76, 0x74, 0x74,
-	0x76, 0x79, 0x7E, 0x85, 0x8F, 0x98, 0x9E, 0xA6, 0xAA, 0xAB, 0xA5, 0x9D,
-	0x91, 0x82, 0x73, 0x62, 0x55, 0x4A, 0x44, 0x44, 0x49, 0x54, 0x65, 0x78,
-	0x8E, 0xA4, 0xB4, 0xC1, 0xCA, 0xCB, 0xC5, 0xBA, 0xA8, 0x91, 0x7C, 0x64,
-	0x51, 0x43, 0x39, 0x37, 0x3D, 0x49, 0x58, 0x6E, 0x85, 0x9A, 0xAD, 0xBB,
-	0xC4, 0xC5, 0xC0, 0xB7, 0xA8, 0x96, 0x82, 0x73, 0x63, 0x58, 0x51, 0x4F,
-	0x53, 0x5B, 0x66, 0x72, 0x7F, 0x8A, 0x93, 0x9A, 0x9F, 0x9E, 0x9C, 0x97,
-	0x91, 0x8B, 0x86, 0x82, 0x7E, 0x7E, 0x7E, 0x7F, 0x82, 0x81, 0x81, 0x80,
-	0x80, 0x7C, 0x77, 0x73, 0x6E, 0x6B, 0x6A, 0x6D, 0x72, 0x78, 0x82, 0x8E,
-	0x99, 0xA4, 0xAD, 0xB2, 0xB2, 0xAE, 0xA6, 0x98, 0x89, 0x77, 0x65, 0x54,
-	0x48, 0x41, 0x3F, 0x42, 0x4D, 0x5D, 0x71, 0x89, 0x9F, 0xB3, 0xC1, 0xCB,
-	0xCC, 0xC9, 0xBF, 0xAD, 0x99, 0x81, 0x6C, 0x58, 0x47, 0x3D, 0x39, 0x3C,
-	0x47, 0x57, 0x6B, 0x80, 0x93, 0xA5, 0xB4, 0xBD, 0xC0, 0xBE, 0xB5, 0xA8,
-	0x98, 0x87, 0x79, 0x6A, 0x60, 0x59, 0x57, 0x59, 0x5F, 0x67, 0x71, 0x7D,
-	0x85, 0x8D, 0x92, 0x95, 0x95, 0x95, 0x91, 0x8D, 0x88, 0x86, 0x83, 0x83,
-	0x85, 0x85, 0x88, 0x87, 0x89, 0x87, 0x83, 0x81, 0x7A, 0x74, 0x6C, 0x67,
-	0x60, 0x61, 0x62, 0x69, 0x73, 0x7F, 0x8C, 0x9B, 0xA7, 0xB4, 0xBA, 0xBC,
-	0xB7, 0xAF, 0xA3, 0x91, 0x7E, 0x6A, 0x57, 0x48, 0x3E, 0x3C, 0x3E, 0x48,
-	0x56, 0x6B, 0x81, 0x99, 0xAD, 0xBC, 0xC9, 0xCE, 0xCB, 0xC2, 0xB1, 0x9E,
-	0x87, 0x71, 0x5D, 0x4B, 0x41, 0x3C, 0x3E, 0x46, 0x54, 0x66, 0x79, 0x8D,
-	0x9F, 0xAC, 0xB6, 0xBB, 0xB8, 0xB2, 0xA7, 0x99, 0x8B, 0x7D, 0x71, 0x67,
-	0x5F, 0x5D, 0x60, 0x64, 0x6B, 0x74, 0x7C, 0x82, 0x88, 0x8C, 0x8D, 0x8D,
-	0x8C, 0x8A, 0x86, 0x85, 0x85, 0x86, 0x87, 0x89, 0x8E, 0x91, 0x91, 0x92,
-	0x90, 0x8A, 0x83, 0x7C, 0x72, 0x68, 0x5F, 0x5A, 0x57, 0x58, 0x60, 0x6A,
-	0x78, 0x88, 0x98, 0xA7, 0xB5, 0xBE, 0xC2, 0xBF, 0xB6, 0xA9, 0x98, 0x84,
-	0x6F, 0x5A, 0x49, 0x3E, 0x3A, 0x3B, 0x41, 0x51, 0x64, 0x7B, 0x92, 0xA9,
-	0xBB, 0xC6, 0xCC, 0xCB, 0xC4, 0xB5, 0xA2, 0x8D, 0x77, 0x63, 0x51, 0x47,
-	0x41, 0x40, 0x48, 0x52, 0x62, 0x75, 0x87, 0x97, 0xA3, 0xAF, 0xB4, 0xB3,
-	0xAD, 0xA5, 0x99, 0x8D, 0x81, 0x77, 0x71, 0x6A, 0x68, 0x67, 0x6A, 0x70,
-	0x76, 0x7C, 0x80, 0x82, 0x85, 0x85, 0x84, 0x83, 0x80, 0x81, 0x81, 0x84,
-	0x87, 0x8B, 0x91, 0x95, 0x9B, 0x9D, 0x9C, 0x98, 0x93, 0x89, 0x7D, 0x72,
-	0x66, 0x5B, 0x55, 0x51, 0x50, 0x57, 0x61, 0x6F, 0x82, 0x94, 0xA7, 0xB4,
-	0xC0, 0xC5, 0xC5, 0xBE, 0xB2, 0xA1, 0x8A, 0x75, 0x5F, 0x4E, 0x3E, 0x39,
-	0x39, 0x3F, 0x4E, 0x5E, 0x77, 0x8C, 0xA2, 0xB6, 0xC2, 0xCA, 0xC9, 0xC4,
-	0xB8, 0xA5, 0x94, 0x7F, 0x69, 0x59, 0x4D, 0x46, 0x45, 0x4A, 0x55, 0x63,
-	0x73, 0x84, 0x92, 0x9E, 0xA6, 0xAC, 0xAB, 0xA8, 0xA2, 0x98, 0x8E, 0x85,
-	0x7C, 0x76, 0x72, 0x6F, 0x70, 0x73, 0x77, 0x7C, 0x7D, 0x7F, 0x80, 0x81,
-	0x7F, 0x7E, 0x7B, 0x7A, 0x7A, 0x7D, 0x81, 0x88, 0x8E, 0x96, 0x9C, 0xA1,
-	0xA5, 0xA4, 0xA0, 0x9A, 0x8D, 0x80, 0x73, 0x63, 0x55, 0x4E, 0x46, 0x47,
-	0x4D, 0x58, 0x68, 0x7B, 0x8E, 0xA2, 0xB4, 0xC1, 0xC9, 0xC8, 0xC2, 0xB8,
-	0xA6, 0x91, 0x7B, 0x66, 0x51, 0x41, 0x3A, 0x38, 0x3C, 0x48, 0x59, 0x6F,
-	0x86, 0x9C, 0xAE, 0xBC, 0xC5, 0xC8, 0xC2, 0xB8, 0xA9, 0x97, 0x83, 0x6F,
-	0x60, 0x53, 0x4D, 0x4A, 0x4E, 0x58, 0x61, 0x70, 0x7F, 0x8B, 0x97, 0x9E,
-	0xA3, 0xA5, 0xA1, 0x9C, 0x94, 0x8E, 0x86, 0x80, 0x7C, 0x79, 0x79, 0x7A,
-	0x7B, 0x7F, 0x80, 0x81, 0x7E, 0x7E, 0x7C, 0x76, 0x74, 0x72, 0x70, 0x71,
-	0x75, 0x7D, 0x84, 0x8E, 0x97, 0xA2, 0xA8, 0xAD, 0xAE, 0xAA, 0xA3, 0x97,
-	0x87, 0x77, 0x68, 0x57, 0x4B, 0x44, 0x43, 0x47, 0x50, 0x60, 0x75, 0x8B,
-	0x9F, 0xB2, 0xC2, 0xCA, 0xCC, 0xC7, 0xBD, 0xAD, 0x97, 0x80, 0x69, 0x56,
-	0x46, 0x3C, 0x37, 0x3B, 0x46, 0x55, 0x6A, 0x80, 0x94, 0xA8, 0xB6, 0xC0,
-	0xC3, 0xC0, 0xB7, 0xAA, 0x99, 0x88, 0x77, 0x69, 0x5C, 0x53, 0x50, 0x53,
-	0x5B, 0x65, 0x70, 0x7C, 0x86, 0x8F, 0x96, 0x9A, 0x9B, 0x9A, 0x96, 0x92,
-	0x8B, 0x85, 0x81, 0x81, 0x81, 0x81, 0x82, 0x84, 0x84, 0x84, 0x82, 0x81,
-	0x7C, 0x79, 0x70, 0x6C, 0x68, 0x65, 0x66, 0x6C, 0x75, 0x80, 0x8D, 0x9A,
-	0xA4, 0xAF, 0xB5, 0xB8, 0xB5, 0xAC, 0x9E, 0x90, 0x7D, 0x69, 0x58, 0x49,
-	0x41, 0x3D, 0x3E, 0x4A, 0x58, 0x6C, 0x80, 0x9A, 0xAE, 0xBF, 0xC9, 0xCC,
-	0xC9, 0xC1, 0xB0, 0x9D, 0x87, 0x70, 0x5B, 0x4A, 0x40, 0x39, 0x3B, 0x45,
-	0x53, 0x66, 0x7A, 0x8E, 0xA1, 0xB0, 0xB9, 0xBE, 0xBC, 0xB5, 0xA9, 0x9A,
-	0x8D, 0x7D, 0x6E, 0x64, 0x5C, 0x59, 0x5B, 0x60, 0x69, 0x72, 0x7A, 0x82,
-	0x8B, 0x8E, 0x93, 0x92, 0x90, 0x8F, 0x8C, 0x88, 0x86, 0x85, 0x85, 0x86,
-	0x89, 0x8C, 0x8C, 0x8D, 0x8C, 0x87, 0x81, 0x7B, 0x74, 0x6C, 0x65, 0x60,
-	0x5F, 0x60, 0x64, 0x6D, 0x7B, 0x89, 0x98, 0xA6, 0xB3, 0xBC, 0xBE, 0xBD,
-	0xB4, 0xA7, 0x96, 0x82, 0x6F, 0x5A, 0x4B, 0x3F, 0x3B, 0x3C, 0x44, 0x53,
-	0x65, 0x7D, 0x93, 0xA9, 0xBB, 0xC6, 0xCD, 0xCB, 0xC3, 0xB5, 0xA1, 0x8E,
-	0x77, 0x62, 0x51, 0x44, 0x3E, 0x3E, 0x45, 0x51, 0x61, 0x76, 0x89, 0x9A,
-	0xA9, 0xB2, 0xB8, 0xB7, 0xB1, 0xA8, 0x9C, 0x8D, 0x81, 0x75, 0x6B, 0x63,
-	0x62, 0x63, 0x66, 0x6C, 0x72, 0x7A, 0x80, 0x84, 0x88, 0x89, 0x89, 0x87,
-	0x86, 0x86, 0x84, 0x85, 0x86, 0x8A, 0x8D, 0x90, 0x95, 0x97, 0x97, 0x95,
-	0x90, 0x87, 0x7E, 0x73, 0x67, 0x5E, 0x58, 0x54, 0x55, 0x5C, 0x65, 0x73,
-	0x83, 0x95, 0xA6, 0xB4, 0xBE, 0xC2, 0xC2, 0xBC, 0xAF, 0x9D, 0x89, 0x74,
-	0x5F, 0x4D, 0x40, 0x39, 0x38, 0x40, 0x4C, 0x5F, 0x76, 0x8C, 0xA2, 0xB7,
-	0xC4, 0xCA, 0xCB, 0xC4, 0xB7, 0xA6, 0x92, 0x7E, 0x69, 0x56, 0x4A, 0x42,
-	0x42, 0x48, 0x53, 0x61, 0x73, 0x82, 0x94, 0xA0, 0xAB, 0xB0, 0xB0, 0xAC,
-	0xA4, 0x9A, 0x8E, 0x84, 0x79, 0x72, 0x6D, 0x6A, 0x6A, 0x6E, 0x72, 0x76,
-	0x7D, 0x80, 0x81, 0x82, 0x81, 0x7F, 0x80, 0x7E, 0x7E, 0x80, 0x84, 0x86,
-	0x8C, 0x92, 0x9A, 0x9E, 0x9F, 0xA1, 0x9E, 0x95, 0x89, 0x80, 0x75, 0x66,
-	0x5B, 0x52, 0x4D, 0x4E, 0x52, 0x5C, 0x6A, 0x7D, 0x8F, 0xA3, 0xB4, 0xC0,
-	0xC6, 0xC8, 0xC2, 0xB6, 0xA4, 0x90, 0x7B, 0x64, 0x50, 0x42, 0x3B, 0x37,
-	0x3D, 0x49, 0x5A, 0x70, 0x87, 0x9D, 0xB1, 0xBE, 0xC8, 0xCC, 0xC5, 0xBA,
-	0xA9, 0x98, 0x82, 0x6F, 0x5E, 0x51, 0x4C, 0x47, 0x4A, 0x54, 0x60, 0x70,
-	0x7F, 0x8D, 0x9A, 0xA2, 0xA7, 0xA9, 0xA6, 0xA0, 0x97, 0x8E, 0x86, 0x7E,
-	0x7A, 0x75, 0x74, 0x74, 0x76, 0x79, 0x7B, 0x7F, 0x80, 0x7F, 0x7F, 0x7C,
-	0x79, 0x77, 0x76, 0x77, 0x7A, 0x7F, 0x84, 0x8D, 0x96, 0x9D, 0xA5, 0xA9,
-	0xA9, 0xA6, 0x9D, 0x92, 0x84, 0x77, 0x67, 0x58, 0x4D, 0x48, 0x44, 0x48,
-	0x54, 0x63, 0x75, 0x8A, 0x9F, 0xB0, 0xC0, 0xC8, 0xCA, 0xC6, 0xBB, 0xAB,
-	0x96, 0x80, 0x69, 0x55, 0x45, 0x3B, 0x38, 0x3A, 0x46, 0x56, 0x6B, 0x80,
-	0x97, 0xAB, 0xB9, 0xC3, 0xC7, 0xC3, 0xB9, 0xAC, 0x9B, 0x86, 0x73, 0x65,
-	0x58, 0x50, 0x4C, 0x50, 0x58, 0x62, 0x6E, 0x7C, 0x88, 0x92, 0x99, 0x9F,
-	0x9F, 0x9F, 0x99, 0x94, 0x8C, 0x86, 0x82, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E,
-	0x80, 0x81, 0x81, 0x7F, 0x7C, 0x7A, 0x74, 0x6E, 0x6C, 0x6D, 0x6D, 0x72,
-	0x78, 0x80, 0x8B, 0x96, 0xA1, 0xA9, 0xB1, 0xB2, 0xAF, 0xA8, 0x9A, 0x8B,
-	0x7B, 0x69, 0x59, 0x4C, 0x41, 0x40, 0x43, 0x4C, 0x5B, 0x6E, 0x85, 0x98,
-	0xAF, 0xBE, 0xC9, 0xCC, 0xC8, 0xC1, 0xB1, 0x9D, 0x86, 0x70, 0x5A, 0x4B,
-	0x3E, 0x39, 0x3B, 0x44, 0x51, 0x64, 0x7D, 0x91, 0xA5, 0xB3, 0xBD, 0xC0,
-	0xBF, 0xB8, 0xAC, 0x9D, 0x8B, 0x7C, 0x6C, 0x61, 0x58, 0x53, 0x58, 0x5C,
-	0x64, 0x6F, 0x7A, 0x84, 0x8C, 0x92, 0x95, 0x97, 0x96, 0x93, 0x8E, 0x8B,
-	0x86, 0x85, 0x82, 0x82, 0x82, 0x84, 0x85, 0x88, 0x86, 0x85, 0x80, 0x7C,
-	0x75, 0x6F, 0x6A, 0x64, 0x61, 0x63, 0x6A, 0x72, 0x7E, 0x8A, 0x98, 0xA4,
-	0xAF, 0xB8, 0xBC, 0xB8, 0xB0, 0xA4, 0x93, 0x81, 0x6D, 0x5A, 0x4B, 0x40,
-	0x3D, 0x3D, 0x46, 0x53, 0x67, 0x7E, 0x94, 0xA9, 0xBB, 0xC7, 0xCC, 0xCA,
-	0xC2, 0xB6, 0xA3, 0x8B, 0x74, 0x60, 0x4E, 0x42, 0x3C, 0x3B, 0x43, 0x51,
-	0x63, 0x78, 0x89, 0x9D, 0xAC, 0xB5, 0xBB, 0xBB, 0xB7, 0xAA, 0x9D, 0x90,
-	0x7F, 0x73, 0x68, 0x62, 0x5D, 0x5E, 0x62, 0x68, 0x71, 0x7A, 0x80, 0x86,
-	0x8B, 0x8D, 0x8E, 0x8D, 0x8B, 0x88, 0x86, 0x85, 0x85, 0x85, 0x88, 0x8B,
-	0x8E, 0x90, 0x90, 0x8F, 0x88, 0x84, 0x7D, 0x74, 0x6B, 0x63, 0x5C, 0x5A,
-	0x5A, 0x5F, 0x6A, 0x77, 0x85, 0x95, 0xA4, 0xB3, 0xBD, 0xC0, 0xBF, 0xB8,
-	0xAC, 0x9C, 0x87, 0x72, 0x5F, 0x4D, 0x40, 0x3A, 0x39, 0x42, 0x4E, 0x61,
-	0x78, 0x8E, 0xA4, 0xB7, 0xC5, 0xCD, 0xCB, 0xC5, 0xB9, 0xA6, 0x91, 0x7C,
-	0x67, 0x55, 0x48, 0x40, 0x40, 0x45, 0x50, 0x60, 0x72, 0x84, 0x95, 0xA5,
-	0xB0, 0xB6, 0xB6, 0xB2, 0xA8, 0x9D, 0x91, 0x83, 0x7A, 0x70, 0x69, 0x67,
-	0x65, 0x6A, 0x6E, 0x74, 0x7A, 0x7F, 0x82, 0x85, 0x86, 0x85, 0x84, 0x83,
-	0x81, 0x81, 0x84, 0x85, 0x8A, 0x8E, 0x92, 0x97, 0x9B, 0x9B, 0x97, 0x92,
-	0x8A, 0x80, 0x74, 0x68, 0x5E, 0x55, 0x52, 0x51, 0x56, 0x60, 0x6D, 0x7F,
-	0x90, 0xA2, 0xB2, 0xBE, 0xC3, 0xC3, 0xC1, 0xB3, 0xA3, 0x8F, 0x78, 0x63,
-	0x50, 0x42, 0x3A, 0x37, 0x3F, 0x49, 0x5B, 0x70, 0x88, 0x9E, 0xB2, 0xC1,
-	0xC8, 0xCB, 0xC5, 0xBB, 0xAA, 0x96, 0x81, 0x6C, 0x5B, 0x4F, 0x45, 0x43,
-	0x48, 0x51, 0x5F, 0x6F, 0x80, 0x8E, 0x9C, 0xA6, 0xAD, 0xAE, 0xA9, 0xA3,
-	0x99, 0x91, 0x87, 0x7F, 0x77, 0x71, 0x6F, 0x6F, 0x72, 0x76, 0x78, 0x7B,
-	0x7F, 0x7F, 0x80, 0x80, 0x7D, 0x7D, 0x7A, 0x7C, 0x7E, 0x7F, 0x85, 0x8D,
-	0x92, 0x9A, 0x9F, 0xA2, 0xA4, 0xA0, 0x99, 0x8F, 0x84, 0x75, 0x66, 0x5B,
-	0x50, 0x49, 0x48, 0x4D, 0x56, 0x65, 0x77, 0x8A, 0xA0, 0xB2, 0xBE, 0xC6,
-	0xC9, 0xC4, 0xBA, 0xA9, 0x95, 0x7E, 0x67, 0x54, 0x44, 0x3B, 0x36, 0x3B,
-	0x46, 0x56, 0x6A, 0x84, 0x98, 0xAB, 0xBD, 0xC5, 0xC8, 0xC5, 0xBB, 0xAC,
-	0x9B, 0x86, 0x73, 0x63, 0x56, 0x4D, 0x4A, 0x4C, 0x54, 0x60, 0x6D, 0x7C,
-	0x89, 0x95, 0x9F, 0xA5, 0xA6, 0xA3, 0x9E, 0x97, 0x8F, 0x88, 0x80, 0x7C,
-	0x78, 0x78, 0x78, 0x7A, 0x7C, 0x7D, 0x7F, 0x7F, 0x7F, 0x7D, 0x7A, 0x76,
-	0x73, 0x72, 0x71, 0x75, 0x7B, 0x82, 0x8B, 0x95, 0x9E, 0xA6, 0xAC, 0xAD,
-	0xAA, 0xA2, 0x97, 0x89, 0x7A, 0x69, 0x5B, 0x4E, 0x45, 0x43, 0x46, 0x4E,
-	0x5C, 0x71, 0x84, 0x9A, 0xAE, 0xBD, 0xC8, 0xCB, 0xC7, 0xBE, 0xAF, 0x9B,
-	0x85, 0x6F, 0x5B, 0x48, 0x3C, 0x38, 0x3A, 0x43, 0x52, 0x67, 0x7D, 0x92,
-	0xA6, 0xB6, 0xC0, 0xC6, 0xC2, 0xBA, 0xAE, 0x9D, 0x8B, 0x7A, 0x6A, 0x5E,
-	0x54, 0x50, 0x51, 0x57, 0x61, 0x6E, 0x7A, 0x85, 0x90, 0x96, 0x9C, 0x9D,
-	0x9C, 0x98, 0x93, 0x8C, 0x88, 0x84, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x83,
-	0x81, 0x81, 0x7F, 0x7D, 0x79, 0x71, 0x6E, 0x6B, 0x68, 0x69, 0x6C, 0x75,
-	0x7F, 0x8A, 0x95, 0xA1, 0xAB, 0xB3, 0xB5, 0xB3, 0xAC, 0xA1, 0x91, 0x7F,
-	0x6C, 0x5C, 0x4D, 0x43, 0x3E, 0x40, 0x48, 0x56, 0x68, 0x7F, 0x95, 0xAB,
-	0xBB, 0xC7, 0xCC, 0xCA, 0xC2, 0xB4, 0xA2, 0x8A, 0x74, 0x5F, 0x4D, 0x40,
-	0x3A, 0x3B, 0x43, 0x50, 0x63, 0x77, 0x8B, 0x9E, 0xAD, 0xB9, 0xBE, 0xBE,
-	0xB9, 0xAE, 0x9E, 0x8F, 0x7F, 0x71, 0x64, 0x5D, 0x5A, 0x59, 0x5D, 0x65,
-	0x6F, 0x7A, 0x81, 0x8B, 0x90, 0x92, 0x93, 0x92, 0x90, 0x8D, 0x89, 0x85,
-	0x84, 0x84, 0x86, 0x87, 0x88, 0x8A, 0x8A, 0x8A, 0x87, 0x81, 0x7C, 0x76,
-	0x70, 0x67, 0x63, 0x5E, 0x60, 0x66, 0x6D, 0x78, 0x86, 0x95, 0xA3, 0xAF,
-	0xB8, 0xBD, 0xBC, 0xB5, 0xAA, 0x99, 0x86, 0x74, 0x5E, 0x4E, 0x43, 0x3D,
-	0x3C, 0x42, 0x4F, 0x63, 0x79, 0x8F, 0xA5, 0xB8, 0xC4, 0xCC, 0xCB, 0xC4,
-	0xB6, 0xA5, 0x90, 0x7B, 0x65, 0x52, 0x46, 0x3E, 0x3C, 0x43, 0x4F, 0x5F,
-	0x72, 0x85, 0x98, 0xA7, 0xB2, 0xB7, 0xB9, 0xB4, 0xAB, 0x9E, 0x92, 0x83,
-	0x76, 0x6D, 0x65, 0x61, 0x61, 0x65, 0x69, 0x72, 0x78, 0x80, 0x85, 0x89,
-	0x8A, 0x8A, 0x8A, 0x88, 0x87, 0x85, 0x84, 0x85, 0x87, 0x8B, 0x8D, 0x92,
-	0x94, 0x94, 0x93, 0x8E, 0x86, 0x7E, 0x77, 0x6C, 0x61, 0x5A, 0x56, 0x57,
-	0x5A, 0x64, 0x71, 0x80, 0x90, 0xA3, 0xB0, 0xBA, 0xC3, 0xC3, 0xBD, 0xB0,
-	0xA0, 0x8D, 0x78, 0x63, 0x50, 0x42, 0x3A, 0x39, 0x3D, 0x4A, 0x5B, 0x73,
-	0x89, 0x9E, 0xB3, 0xC2, 0xCA, 0xCC, 0xC6, 0xBB, 0xAB, 0x96, 0x81, 0x6C,
-	0x59, 0x4C, 0x43, 0x41, 0x46, 0x4E, 0x5D, 0x70, 0x7F, 0x92, 0xA0, 0xAA,
-	0xB1, 0xB2, 0xB0, 0xA7, 0x9E, 0x91, 0x87, 0x7C, 0x72, 0x6C, 0x69, 0x69,
-	0x6D, 0x6F, 0x75, 0x79, 0x7F, 0x81, 0x83, 0x84, 0x83, 0x82, 0x80, 0x80,
-	0x80, 0x83, 0x85, 0x8A, 0x8F, 0x94, 0x9B, 0x9E, 0x9E, 0x9C, 0x95, 0x8C,
-	0x83, 0x76, 0x69, 0x5F, 0x54, 0x4E, 0x4B, 0x51, 0x5A, 0x69, 0x7A, 0x8C,
-	0x9F, 0xB0, 0xBE, 0xC6, 0xC7, 0xC2, 0xB9, 0xA8, 0x93, 0x7E, 0x68, 0x53,
-	0x43, 0x3A, 0x38, 0x3C, 0x45, 0x56, 0x6D, 0x83, 0x9A, 0xAE, 0xBE, 0xC8,
-	0xCB, 0xC6, 0xBC, 0xAE, 0x9C, 0x85, 0x73, 0x61, 0x52, 0x49, 0x46, 0x4A,
-	0x50, 0x5D, 0x6D, 0x7D, 0x8B, 0x98, 0xA3, 0xA8, 0xAC, 0xA9, 0xA3, 0x9B,
-	0x91, 0x89, 0x80, 0x7A, 0x74, 0x72, 0x72, 0x74, 0x77, 0x7A, 0x7E, 0x7E,
-	0x80, 0x80, 0x7E, 0x7C, 0x79, 0x78, 0x79, 0x7A, 0x7F, 0x83, 0x8A, 0x93,
-	0x9A, 0xA1, 0xA6, 0xA7, 0xA6, 0x9E, 0x93, 0x87, 0x7A, 0x6A, 0x5C, 0x50,
-	0x49, 0x45, 0x49, 0x52, 0x5F, 0x72, 0x86, 0x9B, 0xAE, 0xBD, 0xC7, 0xCA,
-	0xC6, 0xBE, 0xAE, 0x9A, 0x82, 0x6D, 0x58, 0x47, 0x3C, 0x37, 0x3A, 0x43,
-	0x51, 0x67, 0x7E, 0x92, 0xA8, 0xB9, 0xC2, 0xC7, 0xC4, 0xBC, 0xAE, 0x9D,
-	0x8B, 0x78, 0x67, 0x5A, 0x50, 0x4C, 0x4C, 0x54, 0x5E, 0x6A, 0x79, 0x85,
-	0x91, 0x9B, 0xA0, 0xA2, 0xA0, 0x9B, 0x96, 0x8F, 0x89, 0x83, 0x7D, 0x7B,
-	0x7A, 0x7A, 0x7D, 0x7C, 0x7F, 0x80, 0x7E, 0x7E, 0x7B, 0x77, 0x73, 0x6F,
-	0x6C, 0x6E, 0x73, 0x78, 0x80, 0x89, 0x93, 0x9F, 0xA7, 0xAE, 0xB0, 0xAD,
-	0xA9, 0x9C, 0x8E, 0x7F, 0x6D, 0x5E, 0x4F, 0x45, 0x41, 0x43, 0x4A, 0x59,
-	0x6B, 0x80, 0x96, 0xAB, 0xBC, 0xC7, 0xCC, 0xCC, 0xC3, 0xB3, 0xA0, 0x8B,
-	0x74, 0x5D, 0x4C, 0x3E, 0x38, 0x3A, 0x41, 0x4E, 0x61, 0x77, 0x8C, 0xA1,
-	0xB2, 0xBD, 0xC3, 0xC2, 0xBB, 0xB0, 0xA0, 0x8E, 0x7F, 0x6E, 0x61, 0x59,
-	0x53, 0x54, 0x58, 0x61, 0x6D, 0x79, 0x82, 0x8C, 0x92, 0x98, 0x99, 0x98,
-	0x95, 0x90, 0x8D, 0x87, 0x84, 0x83, 0x81, 0x82, 0x83, 0x83, 0x86, 0x85,
-	0x83, 0x80, 0x7C, 0x76, 0x70, 0x6A, 0x65, 0x64, 0x64, 0x69, 0x70, 0x7A,
-	0x87, 0x95, 0xA1, 0xAC, 0xB5, 0xB9, 0xB8, 0xB2, 0xA5, 0x96, 0x86, 0x72,
-	0x5E, 0x4E, 0x44, 0x3E, 0x3F, 0x45, 0x52, 0x63, 0x7A, 0x90, 0xA8, 0xB9,
-	0xC5, 0xCD, 0xCC, 0xC5, 0xB8, 0xA6, 0x90, 0x7B, 0x63, 0x51, 0x43, 0x3A,
-	0x3A, 0x42, 0x4D, 0x5D, 0x74, 0x87, 0x9A, 0xAB, 0xB6, 0xBC, 0xBC, 0xB8,
-	0xAF, 0xA0, 0x92, 0x82, 0x74, 0x69, 0x60, 0x5B, 0x5B, 0x5F, 0x66, 0x6F,
-	0x77, 0x80, 0x87, 0x8C, 0x91, 0x90, 0x8F, 0x8F, 0x8B, 0x87, 0x85, 0x84,
-	0x85, 0x86, 0x89, 0x8B, 0x8D, 0x8F, 0x8C, 0x8A, 0x84, 0x7E, 0x75, 0x6D,
-	0x64, 0x60, 0x5C, 0x5C, 0x61, 0x68, 0x75, 0x82, 0x91, 0xA1, 0xAF, 0xBA,
-	0xBD, 0xBE, 0xB9, 0xAC, 0x9D, 0x8C, 0x76, 0x63, 0x51, 0x41, 0x3B, 0x3A,
-	0x3F, 0x4C, 0x5D, 0x74, 0x8A, 0xA0, 0xB4, 0xC2, 0xCA, 0xCB, 0xC8, 0xBB,
-	0xA9, 0x96, 0x80, 0x6A, 0x57, 0x49, 0x40, 0x40, 0x43, 0x4D, 0x5C, 0x6F,
-	0x81, 0x93, 0xA2, 0xAE, 0xB6, 0xB6, 0xB3, 0xAA, 0xA1, 0x94, 0x85, 0x7A,
-	0x71, 0x68, 0x64, 0x64, 0x66, 0x6C, 0x73, 0x78, 0x7F, 0x83, 0x86, 0x87,
-	0x87, 0x86, 0x85, 0x84, 0x84, 0x83, 0x86, 0x87, 0x8D, 0x90, 0x94, 0x98,
-	0x97, 0x97, 0x93, 0x89, 0x81, 0x75, 0x6D, 0x62, 0x5A, 0x54, 0x53, 0x57,
-	0x5E, 0x6C, 0x7D, 0x8E, 0x9E, 0xAE, 0xBC, 0xC3, 0xC3, 0xC1, 0xB6, 0xA6,
-	0x92, 0x7C, 0x67, 0x53, 0x43, 0x3A, 0x38, 0x3B, 0x47, 0x56, 0x6D, 0x83,
-	0x99, 0xAF, 0xBF, 0xC8, 0xCA, 0xC7, 0xBC, 0xAD, 0x9B, 0x85, 0x70, 0x5F,
-	0x4F, 0x45, 0x41, 0x43, 0x4D, 0x5A, 0x6C, 0x7D, 0x8B, 0x9B, 0xA6, 0xAD,
-	0xB0, 0xAD, 0xA6, 0x9D, 0x93, 0x88, 0x7F, 0x76, 0x70, 0x6D, 0x6E, 0x6E,
-	0x72, 0x77, 0x7C, 0x7E, 0x81, 0x81, 0x81, 0x7F, 0x7E, 0x7D, 0x7D, 0x7F,
-	0x81, 0x84, 0x8B, 0x91, 0x98, 0x9C, 0x9F, 0xA2, 0xA0, 0x99, 0x8F, 0x84,
-	0x78, 0x6A, 0x5E, 0x53, 0x4C, 0x4A, 0x4B, 0x56, 0x62, 0x75, 0x88, 0x9B,
-	0xAE, 0xBD, 0xC4, 0xC9, 0xC5, 0xBC, 0xAC, 0x9B, 0x83, 0x6C, 0x58, 0x47,
-	0x3C, 0x37, 0x3A, 0x43, 0x53, 0x66, 0x7E, 0x93, 0xAA, 0xBA, 0xC4, 0xC9,
-	0xC6, 0xBE, 0xB0, 0x9E, 0x8A, 0x77, 0x65, 0x56, 0x4D, 0x48, 0x4A, 0x51,
-	0x5C, 0x6B, 0x7A, 0x87, 0x94, 0x9F, 0xA6, 0xA6, 0xA6, 0xA1, 0x9B, 0x93,
-	0x89, 0x82, 0x7E, 0x78, 0x76, 0x76, 0x78, 0x79, 0x7C, 0x7E, 0x7F, 0x7F,
-	0x7D, 0x7B, 0x78, 0x75, 0x73, 0x74, 0x77, 0x7A, 0x82, 0x8A, 0x92, 0x9A,
-	0xA2, 0xA9, 0xAA, 0xA8, 0xA1, 0x98, 0x8A, 0x7D, 0x6D, 0x5C, 0x50, 0x47,
-	0x43, 0x46, 0x4E, 0x5A, 0x6D, 0x81, 0x96, 0xAA, 0xBA, 0xC6, 0xCB, 0xC8,
-	0xC1, 0xB4, 0x9F, 0x89, 0x73, 0x5E, 0x4B, 0x3D, 0x38, 0x39, 0x41, 0x4F,
-	0x62, 0x7A, 0x8D, 0xA3, 0xB3, 0xBF, 0xC6, 0xC6, 0xBE, 0xB1, 0xA1, 0x8E,
-	0x7D, 0x6C, 0x5E, 0x54, 0x4F, 0x50, 0x55, 0x5E, 0x6A, 0x77, 0x84, 0x8E,
-	0x96, 0x9D, 0xA0, 0x9F, 0x9C, 0x95, 0x8F, 0x8A, 0x84, 0x81, 0x7F, 0x7E,
-	0x7F, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7A, 0x75, 0x70, 0x6C, 0x6A,
-	0x6A, 0x6E, 0x74, 0x7D, 0x87, 0x92, 0x9E, 0xA8, 0xB0, 0xB3, 0xB2, 0xAC,
-	0xA2, 0x94, 0x83, 0x6F, 0x5F, 0x4E, 0x45, 0x40, 0x40, 0x47, 0x52, 0x64,
-	0x7B, 0x90, 0xA6, 0xB8, 0xC5, 0xCD, 0xCC, 0xC5, 0xB8, 0xA5, 0x8F, 0x78,
-	0x62, 0x4E, 0x42, 0x3B, 0x3A, 0x40, 0x4B, 0x5D, 0x73, 0x88, 0x9B, 0xAD,
-	0xB8, 0xBF, 0xC1, 0xBA, 0xB0, 0xA2, 0x92, 0x80, 0x72, 0x66, 0x5D, 0x58,
-	0x57, 0x5C, 0x62, 0x6C, 0x78, 0x81, 0x89, 0x90, 0x96, 0x95, 0x95, 0x93,
-	0x8F, 0x8B, 0x88, 0x86, 0x83, 0x82, 0x85, 0x87, 0x89, 0x88, 0x87, 0x86,
-	0x81, 0x7D, 0x79, 0x71, 0x6A, 0x64, 0x61, 0x61, 0x65, 0x6E, 0x78, 0x83,
-	0x94, 0xA2, 0xAE, 0xB5, 0xBA, 0xBB, 0xB6, 0xAA, 0x9B, 0x88, 0x76, 0x61,
-	0x50, 0x45, 0x3D, 0x3C, 0x41, 0x4D, 0x5F, 0x74, 0x8B, 0xA1, 0xB4, 0xC2,
-	0xC9, 0xCB, 0xC7, 0xBC, 0xA9, 0x95, 0x7F, 0x68, 0x56, 0x46, 0x3F, 0x3B,
-	0x40, 0x4D, 0x5A, 0x6E, 0x83, 0x95, 0xA5, 0xB1, 0xB9, 0xBB, 0xB8, 0xAE,
-	0xA2, 0x94, 0x87, 0x78, 0x6E, 0x65, 0x60, 0x5F, 0x63, 0x66, 0x70, 0x78,
-	0x7C, 0x83, 0x89, 0x8C, 0x8D, 0x8C, 0x8A, 0x88, 0x85, 0x85, 0x85, 0x87,
-	0x89, 0x8D, 0x90, 0x92, 0x92, 0x91, 0x8E, 0x87, 0x80, 0x78, 0x6C, 0x64,
-	0x5E, 0x57, 0x58, 0x5A, 0x64, 0x71, 0x7F, 0x90, 0x9F, 0xAE, 0xB9, 0xC0,
-	0xC1, 0xBD, 0xB2, 0xA3, 0x8F, 0x7B, 0x66, 0x54, 0x44, 0x3A, 0x38, 0x3D,
-	0x47, 0x57, 0x6E, 0x84, 0x9A, 0xB0, 0xBF, 0xCA, 0xCC, 0xC9, 0xBD, 0xAD,
-	0x9A, 0x86, 0x70, 0x5B, 0x4D, 0x43, 0x41, 0x44, 0x4C, 0x59, 0x6B, 0x7E,
-	0x8E, 0x9E, 0xA9, 0xB2, 0xB4, 0xB0, 0xAA, 0x9F, 0x94, 0x89, 0x7E, 0x74,
-	0x6D, 0x69, 0x68, 0x69, 0x6D, 0x72, 0x79, 0x7F, 0x81, 0x84, 0x85, 0x84,
-	0x84, 0x82, 0x81, 0x81, 0x82, 0x84, 0x89, 0x8E, 0x92, 0x97, 0x9C, 0x9C,
-	0x9A, 0x95, 0x8D, 0x83, 0x7A, 0x6D, 0x61, 0x58, 0x51, 0x4F, 0x52, 0x5B,
-	0x68, 0x76, 0x89, 0x9B, 0xAC, 0xBA, 0xC3, 0xC6, 0xC3, 0xBB, 0xAA, 0x97,
-	0x81, 0x6B, 0x58, 0x47, 0x3C, 0x38, 0x39, 0x44, 0x52, 0x67, 0x80, 0x95,
-	0xAB, 0xBB, 0xC6, 0xCA, 0xC8, 0xBE, 0xB1, 0x9E, 0x89, 0x75, 0x62, 0x53,
-	0x48, 0x44, 0x45, 0x4D, 0x59, 0x68, 0x78, 0x88, 0x98, 0xA1, 0xA8, 0xAD,
-	0xAB, 0xA5, 0x9E, 0x93, 0x8A, 0x80, 0x7A, 0x75, 0x70, 0x70, 0x71, 0x74,
-	0x78, 0x7C, 0x7E, 0x7F, 0x80, 0x80, 0x7D, 0x7B, 0x7A, 0x79, 0x7B, 0x7F,
-	0x81, 0x88, 0x91, 0x98, 0x9F, 0xA3, 0xA4, 0xA3, 0x9D, 0x94, 0x88, 0x7B,
-	0x6E, 0x5C, 0x52, 0x4A, 0x46, 0x4A, 0x50, 0x5D, 0x6E, 0x82, 0x96, 0xAA,
-	0xB9, 0xC4, 0xCA, 0xC7, 0xBF, 0xB1, 0x9E, 0x87, 0x71, 0x5C, 0x4B, 0x3D,
-	0x37, 0x37, 0x40, 0x4F, 0x62, 0x79, 0x8E, 0xA5, 0xB5, 0xC1, 0xC7, 0xC7,
-	0xBF, 0xB3, 0xA2, 0x8F, 0x7D, 0x69, 0x5A, 0x50, 0x4B, 0x4A, 0x51, 0x5B,
-	0x67, 0x76, 0x84, 0x90, 0x9A, 0xA1, 0xA4, 0xA2, 0xA0, 0x98, 0x92, 0x8A,
-	0x82, 0x7F, 0x7A, 0x79, 0x79, 0x7B, 0x7D, 0x7F, 0x80, 0x80, 0x7F, 0x7D,
-	0x79, 0x76, 0x72, 0x6F, 0x70, 0x73, 0x79, 0x7E, 0x87, 0x91, 0x9C, 0xA5,
-	0xAA, 0xAE, 0xAE, 0xA7, 0x9D, 0x91, 0x80, 0x70, 0x5F, 0x51, 0x46, 0x41,
-	0x43, 0x49, 0x56, 0x68, 0x7C, 0x92, 0xA8, 0xB9, 0xC5, 0xCB, 0xCA, 0xC4,
-	0xB7, 0xA2, 0x8F, 0x77, 0x60, 0x4E, 0x41, 0x3A, 0x37, 0x3F, 0x4C, 0x5E,
-	0x73, 0x88, 0x9F, 0xAF, 0xBC, 0xC3, 0xC3, 0xBE, 0xB1, 0xA4, 0x91, 0x80,
-	0x71, 0x63, 0x57, 0x52, 0x53, 0x55, 0x5E, 0x69, 0x75, 0x81, 0x8B, 0x91,
-	0x99, 0x9C, 0x9C, 0x99, 0x94, 0x8F, 0x89, 0x86, 0x83, 0x80, 0x80, 0x82,
-	0x83, 0x86, 0x85, 0x84, 0x81, 0x7F, 0x7A, 0x73, 0x6E, 0x6A, 0x66, 0x67,
-	0x6A, 0x70, 0x7A, 0x85, 0x92, 0x9F, 0xAA, 0xB2, 0xB7, 0xB7, 0xB1, 0xA6,
-	0x98, 0x89, 0x76, 0x63, 0x53, 0x46, 0x3E, 0x3E, 0x44, 0x4F, 0x5F, 0x76,
-	0x8C, 0xA2, 0xB5, 0xC4, 0xCB, 0xCD, 0xC7, 0xBB, 0xAB, 0x96, 0x7E, 0x68,
-	0x54, 0x44, 0x3D, 0x3A, 0x3F, 0x49, 0x5B, 0x6F, 0x84, 0x95, 0xA7, 0xB4,
-	0xBC, 0xBE, 0xBA, 0xB1, 0xA2, 0x95, 0x86, 0x76, 0x6A, 0x60, 0x5B, 0x59,
-	0x5B, 0x63, 0x6B, 0x74, 0x7F, 0x85, 0x8D, 0x8E, 0x92, 0x91, 0x8F, 0x8D,
-	0x89, 0x88, 0x85, 0x85, 0x86, 0x87, 0x89, 0x8C, 0x8C, 0x8B, 0x89, 0x84,
-	0x7F, 0x78, 0x6F, 0x68, 0x62, 0x5E, 0x5E, 0x61, 0x69, 0x74, 0x81, 0x8F,
-	0x9E, 0xAB, 0xB5, 0xBE, 0xBD, 0xB9, 0xAF, 0x9F, 0x8E, 0x79, 0x66, 0x54,
-	0x45, 0x3C, 0x39, 0x3E, 0x49, 0x59, 0x70, 0x86, 0x9C, 0xB2, 0xC1, 0xCA,
-	0xCE, 0xC9, 0xBE, 0xAD, 0x99, 0x83, 0x6D, 0x5A, 0x4B, 0x40, 0x3D, 0x41,
-	0x4B, 0x59, 0x6A, 0x7E, 0x90, 0xA0, 0xAC, 0xB4, 0xB8, 0xB6, 0xB0, 0xA3,
-	0x96, 0x88, 0x7C, 0x71, 0x68, 0x65, 0x62, 0x64, 0x68, 0x6F, 0x78, 0x7D,
-	0x81, 0x86, 0x89, 0x8A, 0x89, 0x87, 0x86, 0x84, 0x84, 0x85, 0x86, 0x8A,
-	0x8F, 0x92, 0x95, 0x97, 0x96, 0x91, 0x8A, 0x83, 0x79, 0x6E, 0x64, 0x5B,
-	0x56, 0x54, 0x57, 0x5F, 0x6B, 0x79, 0x8A, 0x9C, 0xAC, 0xBA, 0xC1, 0xC2,
-	0xC1, 0xB7, 0xA7, 0x94, 0x80, 0x6A, 0x57, 0x46, 0x3C, 0x38, 0x3B, 0x43,
-	0x52, 0x67, 0x80, 0x97, 0xAC, 0xBD, 0xC8, 0xCB, 0xCB, 0xC0, 0xB3, 0x9F,
-	0x89, 0x75, 0x61, 0x51, 0x46, 0x41, 0x44, 0x4C, 0x57, 0x68, 0x7A, 0x8A,
-	0x99, 0xA5, 0xAD, 0xB1, 0xAF, 0xA9, 0xA0, 0x96, 0x8A, 0x80, 0x77, 0x71,
-	0x6C, 0x6C, 0x6D, 0x70, 0x74, 0x78, 0x7E, 0x80, 0x82, 0x83, 0x81, 0x81,
-	0x7F, 0x7F, 0x7F, 0x80, 0x84, 0x8A, 0x8D, 0x95, 0x9A, 0x9F, 0xA0, 0x9E,
-	0x9A, 0x91, 0x86, 0x7B, 0x6E, 0x61, 0x56, 0x4E, 0x4B, 0x4D, 0x55, 0x60,
-	0x71, 0x85, 0x97, 0xAA, 0xB8, 0xC3, 0xC8, 0xC4, 0xBE, 0xAF, 0x9C, 0x86,
-	0x6F, 0x5B, 0x48, 0x3D, 0x38, 0x3A, 0x40, 0x4F, 0x62, 0x7A, 0x92, 0xA7,
-	0xB8, 0xC3, 0xC9, 0xC9, 0xC2, 0xB4, 0xA3, 0x8E, 0x7A, 0x67, 0x59, 0x4E,
-	0x48, 0x47, 0x4F, 0x59, 0x67, 0x79, 0x84, 0x92, 0x9C, 0xA6, 0xA9, 0xA8,
-	0xA4, 0x9D, 0x95, 0x8C, 0x83, 0x7C, 0x77, 0x75, 0x74, 0x75, 0x76, 0x78,
-	0x7C, 0x7E, 0x80, 0x7F, 0x7D, 0x7A, 0x77, 0x76, 0x76, 0x77, 0x7B, 0x80,
-	0x88, 0x90, 0x97, 0xA0, 0xA6, 0xA9, 0xA8, 0xA3, 0x99, 0x8D, 0x80, 0x71,
-	0x61, 0x53, 0x4B, 0x45, 0x45, 0x4D, 0x59, 0x6A, 0x7F, 0x92, 0xA7, 0xB7,
-	0xC3, 0xCA, 0xCA, 0xC2, 0xB6, 0xA3, 0x8E, 0x75, 0x61, 0x4F, 0x3F, 0x38,
-	0x37, 0x3F, 0x4B, 0x5C, 0x73, 0x8A, 0x9E, 0xB1, 0xBE, 0xC5, 0xC6, 0xBF,
-	0xB5, 0xA5, 0x94, 0x80, 0x6E, 0x60, 0x54, 0x4F, 0x4E, 0x53, 0x5A, 0x67,
-	0x76, 0x80, 0x8D, 0x97, 0x9D, 0xA1, 0xA1, 0x9D, 0x98, 0x92, 0x8A, 0x85,
-	0x81, 0x7E, 0x7C, 0x7D, 0x7D, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7D, 0x78,
-	0x72, 0x6F, 0x6C, 0x6D, 0x6E, 0x75, 0x7D, 0x85, 0x91, 0x99, 0xA4, 0xAD,
-	0xB1, 0xB1, 0xAC, 0xA2, 0x95, 0x85, 0x73, 0x62, 0x52, 0x47, 0x40, 0x3E,
-	0x46, 0x51, 0x63, 0x77, 0x8D, 0xA3, 0xB4, 0xC4, 0xCA, 0xCB, 0xC8, 0xBA,
-	0xA8, 0x93, 0x7D, 0x66, 0x51, 0x43, 0x3A, 0x3A, 0x3F, 0x4A, 0x5A, 0x6D,
-	0x83, 0x99, 0xAC, 0xB8, 0xC1, 0xC2, 0xBD, 0xB3, 0xA6, 0x95, 0x84, 0x74,
-	0x67, 0x5D, 0x56, 0x54, 0x58, 0x5F, 0x68, 0x74, 0x7E, 0x89, 0x90, 0x94,
-	0x98, 0x97, 0x96, 0x92, 0x8D, 0x89, 0x86, 0x84, 0x82, 0x83, 0x85, 0x86,
-	0x87, 0x86, 0x86, 0x81, 0x7F, 0x78, 0x72, 0x6B, 0x67, 0x62, 0x63, 0x67,
-	0x6C, 0x77, 0x81, 0x8F, 0x9C, 0xA9, 0xB4, 0xB9, 0xBA, 0xB6, 0xAA, 0x9E,
-	0x8B, 0x79, 0x66, 0x53, 0x46, 0x3D, 0x3A, 0x3F, 0x4B, 0x5C, 0x6F, 0x86,
-	0x9D, 0xB2, 0xC1, 0xCA, 0xCC, 0xC8, 0xBE, 0xAC, 0x99, 0x82, 0x6D, 0x58,
-	0x48, 0x3D, 0x3C, 0x3F, 0x48, 0x57, 0x6A, 0x7F, 0x91, 0xA4, 0xB1, 0xB8,
-	0xBC, 0xB9, 0xB1, 0xA5, 0x97, 0x88, 0x7A, 0x70, 0x64, 0x5E, 0x5E, 0x5F,
-	0x64, 0x6C, 0x76, 0x7D, 0x84, 0x89, 0x8D, 0x8F, 0x8F, 0x8D, 0x8A, 0x89,
-	0x86, 0x85, 0x87, 0x87, 0x89, 0x8D, 0x8F, 0x91, 0x90, 0x8E, 0x88, 0x80,
-	0x78, 0x70, 0x68, 0x5F, 0x5C, 0x59, 0x5D, 0x63, 0x6E, 0x7C, 0x8B, 0x9B,
-	0xAB, 0xB7, 0xBF, 0xC0, 0xBE, 0xB3, 0xA5, 0x93, 0x7E, 0x69, 0x56, 0x47,
-	0x3D, 0x39, 0x3B, 0x45, 0x54, 0x6A, 0x80, 0x97, 0xAC, 0xBD, 0xC8, 0xCC,
-	0xCA, 0xC0, 0xB2, 0x9E, 0x88, 0x73, 0x5F, 0x4F, 0x43, 0x3F, 0x41, 0x49,
-	0x55, 0x67, 0x78, 0x8A, 0x9C, 0xA9, 0xB0, 0xB5, 0xB4, 0xAD, 0xA4, 0x99,
-	0x8B, 0x7F, 0x75, 0x6E, 0x67, 0x66, 0x68, 0x6A, 0x71, 0x78, 0x7C, 0x7F,
-	0x84, 0x86, 0x86, 0x86, 0x84, 0x83, 0x82, 0x83, 0x84, 0x87, 0x8B, 0x92,
-	0x96, 0x98, 0x9B, 0x9A, 0x96, 0x8E, 0x85, 0x7C, 0x6F, 0x64, 0x5A, 0x53,
-	0x51, 0x51, 0x58, 0x64, 0x74, 0x87, 0x97, 0xA9, 0xB8, 0xC1, 0xC5, 0xC2,
-	0xBB, 0xAD, 0x9B, 0x86, 0x6F, 0x5A, 0x4A, 0x3D, 0x38, 0x38, 0x41, 0x50,
-	0x62, 0x7A, 0x92, 0xA6, 0xB9, 0xC4, 0xCA, 0xC8, 0xC1, 0xB4, 0xA2, 0x8D,
-	0x7A, 0x65, 0x55, 0x4A, 0x45, 0x45, 0x4C, 0x56, 0x65, 0x75, 0x86, 0x95,
-	0xA1, 0xAA, 0xAF, 0xAE, 0xA8, 0xA1, 0x96, 0x8B, 0x81, 0x7A, 0x73, 0x6F,
-	0x6E, 0x6F, 0x71, 0x76, 0x7A, 0x7D, 0x80, 0x7F, 0x80, 0x81, 0x7C, 0x7B,
-	0x7B, 0x7B, 0x7F, 0x83, 0x87, 0x8F, 0x95, 0x9C, 0xA2, 0xA5, 0xA2, 0x9F,
-	0x96, 0x8A, 0x7D, 0x6F, 0x61, 0x56, 0x4C, 0x48, 0x4A, 0x50, 0x5C, 0x6B,
-	0x80, 0x93, 0xA7, 0xB7, 0xC3, 0xC7, 0xC7, 0xC0, 0xB4, 0xA2, 0x8B, 0x75,
-	0x5E, 0x4D, 0x3E, 0x37, 0x38, 0x3F, 0x4C, 0x5E, 0x76, 0x8B, 0xA1, 0xB3,
-	0xC1, 0xC7, 0xC8, 0xC2, 0xB4, 0xA5, 0x93, 0x7F, 0x6B, 0x5D, 0x50, 0x4A,
-	0x4B, 0x50, 0x59, 0x65, 0x73, 0x81, 0x8F, 0x99, 0xA1, 0xA5, 0xA5, 0xA2,
-	0x9B, 0x93, 0x8C, 0x83, 0x7F, 0x7A, 0x78, 0x79, 0x79, 0x7A, 0x7D, 0x7F,
-	0x80, 0x7F, 0x7E, 0x7D, 0x79, 0x75, 0x73, 0x73, 0x74, 0x78, 0x7E, 0x86,
-	0x90, 0x97, 0xA1, 0xA7, 0xAC, 0xAC, 0xA7, 0x9E, 0x92, 0x82, 0x74, 0x63,
-	0x53, 0x49, 0x44, 0x43, 0x49, 0x54, 0x64, 0x79, 0x8F, 0xA3, 0xB6, 0xC2,
-	0xCB, 0xCC, 0xC6, 0xB9, 0xA7, 0x92, 0x7A, 0x65, 0x51, 0x42, 0x3A, 0x36,
-	0x3D, 0x49, 0x59, 0x6F, 0x85, 0x99, 0xAB, 0xBA, 0xC1, 0xC4, 0xC0, 0xB6,
-	0xA6, 0x95, 0x84, 0x73, 0x64, 0x59, 0x51, 0x50, 0x53, 0x5B, 0x66, 0x72,
-	0x80, 0x88, 0x90, 0x99, 0x9C, 0x9D, 0x9B, 0x95, 0x91, 0x8A, 0x85, 0x81,
-	0x80, 0x80, 0x80, 0x81, 0x82, 0x84, 0x82, 0x81, 0x81, 0x7B, 0x76, 0x70,
-	0x6C, 0x6A, 0x67, 0x6A, 0x71, 0x79, 0x84, 0x90, 0x9A, 0xA6, 0xAF, 0xB5,
-	0xB5, 0xB1, 0xA8, 0x9A, 0x8A, 0x78, 0x65, 0x55, 0x48, 0x41, 0x3E, 0x43,
-	0x4C, 0x5E, 0x72, 0x88, 0x9F, 0xB2, 0xC1, 0xCA, 0xCD, 0xC9, 0xBF, 0xAE,
-	0x99, 0x81, 0x6B, 0x56, 0x46, 0x3F, 0x3A, 0x3D, 0x47, 0x56, 0x6B, 0x80,
-	0x93, 0xA6, 0xB5, 0xBC, 0xC0, 0xBE, 0xB4, 0xA9, 0x98, 0x88, 0x79, 0x6B,
-	0x61, 0x59, 0x58, 0x59, 0x61, 0x68, 0x73, 0x7D, 0x85, 0x8C, 0x91, 0x94,
-	0x93, 0x92, 0x8F, 0x8E, 0x89, 0x84, 0x85, 0x84, 0x86, 0x87, 0x89, 0x88,
-	0x8A, 0x88, 0x84, 0x7F, 0x7A, 0x73, 0x6B, 0x65, 0x5F, 0x5F, 0x62, 0x66,
-	0x73, 0x7F, 0x8D, 0x9B, 0xA9, 0xB5, 0xBC, 0xBD, 0xB9, 0xB1, 0xA1, 0x93,
-	0x7E, 0x69, 0x57, 0x48, 0x3D, 0x3A, 0x3E, 0x45, 0x56, 0x6A, 0x81, 0x99,
-	0xAD, 0xBE, 0xCA, 0xCD, 0xC9, 0xC0, 0xB3, 0x9E, 0x86, 0x71, 0x5E, 0x4C,
-	0x41, 0x3C, 0x3F, 0x47, 0x54, 0x66, 0x7A, 0x8D, 0x9F, 0xAC, 0xB4, 0xBB,
-	0xB7, 0xB0, 0xA7, 0x9A, 0x8B, 0x7E, 0x72, 0x69, 0x62, 0x61, 0x63, 0x66,
-	0x6C, 0x75, 0x7B, 0x81, 0x86, 0x8A, 0x8C, 0x8B, 0x89, 0x87, 0x85, 0x84,
-	0x85, 0x86, 0x8A, 0x8D, 0x8F, 0x93, 0x94, 0x94, 0x91, 0x8B, 0x82, 0x7B,
-	0x71, 0x66, 0x5F, 0x58, 0x57, 0x58, 0x5E, 0x69, 0x77, 0x89, 0x99, 0xA9,
-	0xB6, 0xBF, 0xC2, 0xBF, 0xB9, 0xAA, 0x99, 0x84, 0x6F, 0x59, 0x48, 0x3D,
-	0x39, 0x39, 0x42, 0x4F, 0x65, 0x7C, 0x92, 0xA8, 0xBA, 0xC5, 0xCB, 0xCB,
-	0xC2, 0xB4, 0xA3, 0x8E, 0x79, 0x63, 0x53, 0x49, 0x42, 0x42, 0x48, 0x54,
-	0x64, 0x76, 0x87, 0x97, 0xA3, 0xAD, 0xB2, 0xB0, 0xAC, 0xA3, 0x98, 0x8C,
-	0x80, 0x77, 0x70, 0x6A, 0x68, 0x69, 0x6C, 0x71, 0x76, 0x7B, 0x7F, 0x81,
-	0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x83, 0x88, 0x8C, 0x92, 0x97,
-	0x9A, 0x9E, 0x9D, 0x9A, 0x92, 0x88, 0x7E, 0x70, 0x64, 0x59, 0x51, 0x4D,
-	0x4E, 0x53, 0x5F, 0x6E, 0x80, 0x94, 0xA6, 0xB5, 0xC1, 0xC7, 0xC4, 0xBE,
-	0xB1, 0xA0, 0x8B, 0x73, 0x5E, 0x4D, 0x40, 0x39, 0x38, 0x40, 0x4C, 0x5E,
-	0x75, 0x8D, 0xA1, 0xB4, 0xC2, 0xC9, 0xCA, 0xC2, 0xB7, 0xA7, 0x92, 0x80,
-	0x6A, 0x5A, 0x4D, 0x49, 0x47, 0x4C, 0x55, 0x64, 0x74, 0x83, 0x90, 0x9E,
-	0xA5, 0xAA, 0xAC, 0xA7, 0x9F, 0x97, 0x8D, 0x83, 0x7C, 0x77, 0x74, 0x72,
-	0x71, 0x74, 0x77, 0x7A, 0x7D, 0x7E, 0x7F, 0x80, 0x7C, 0x79, 0x78, 0x77,
-	0x79, 0x7B, 0x80, 0x86, 0x8E, 0x96, 0x9F, 0xA4, 0xA7, 0xA7, 0xA1, 0x9A,
-	0x8D, 0x80, 0x73, 0x63, 0x57, 0x4C, 0x47, 0x47, 0x4D, 0x57, 0x68, 0x7B,
-	0x8E, 0xA3, 0xB3, 0xC2, 0xC9, 0xCA, 0xC4, 0xB8, 0xA6, 0x91, 0x7C, 0x65,
-	0x50, 0x42, 0x39, 0x36, 0x3B, 0x49, 0x59, 0x6F, 0x85, 0x9C, 0xAE, 0xBE,
-	0xC5, 0xC6, 0xC2, 0xB7, 0xA8, 0x96, 0x82, 0x71, 0x61, 0x55, 0x4F, 0x4C,
-	0x50, 0x59, 0x63, 0x72, 0x7F, 0x8B, 0x96, 0x9D, 0xA2, 0xA2, 0x9F, 0x9B,
-	0x93, 0x8C, 0x86, 0x80, 0x7D, 0x7B, 0x7B, 0x7B, 0x7D, 0x7F, 0x80, 0x80,
-	0x7F, 0x7E, 0x79, 0x77, 0x71, 0x6D, 0x6E, 0x6F, 0x75, 0x7A, 0x83, 0x8D,
-	0x98, 0xA2, 0xAB, 0xAE, 0xB1, 0xAC, 0xA1, 0x97, 0x87, 0x77, 0x65, 0x56,
-	0x4A, 0x43, 0x41, 0x45, 0x4F, 0x60, 0x74, 0x89, 0x9E, 0xB2, 0xC1, 0xCA,
-	0xCC, 0xC8, 0xBD, 0xAD, 0x98, 0x81, 0x6A, 0x55, 0x45, 0x3B, 0x3A, 0x3C,
-	0x46, 0x58, 0x6B, 0x80, 0x95, 0xA8, 0xB7, 0xBF, 0xC3, 0xC1, 0xB6, 0xA8,
-	0x9A, 0x88, 0x77, 0x69, 0x5D, 0x56, 0x53, 0x56, 0x5D, 0x66, 0x70, 0x7D,
-	0x84, 0x8F, 0x95, 0x98, 0x9A, 0x97, 0x93, 0x8D, 0x8C, 0x85, 0x83, 0x80,
-	0x82, 0x84, 0x83, 0x85, 0x86, 0x84, 0x81, 0x80, 0x7B, 0x74, 0x6F, 0x69,
-	0x66, 0x64, 0x66, 0x6C, 0x75, 0x80, 0x8C, 0x99, 0xA6, 0xB0, 0xB7, 0xB9,
-	0xB5, 0xAD, 0xA0, 0x8F, 0x7D, 0x6A, 0x5A, 0x4A, 0x40, 0x3D, 0x3F, 0x49,
-	0x58, 0x6C, 0x83, 0x9A, 0xAE, 0xBE, 0xC9, 0xCC, 0xCA, 0xBF, 0xAF, 0x9E,
-	0x86, 0x70, 0x5B, 0x4B, 0x40, 0x3A, 0x3C, 0x45, 0x53, 0x65, 0x7B, 0x8E,
-	0xA1, 0xAF, 0xB7, 0xBC, 0xBC, 0xB3, 0xAA, 0x9B, 0x8B, 0x7D, 0x70, 0x65,
-	0x5F, 0x5C, 0x5D, 0x62, 0x69, 0x72, 0x7C, 0x84, 0x8A, 0x8F, 0x90, 0x91,
-	0x8E, 0x8C, 0x89, 0x86, 0x86, 0x84, 0x88, 0x88, 0x89, 0x8C, 0x8F, 0x8F,
-	0x8C, 0x87, 0x81, 0x7A, 0x72, 0x6A, 0x62, 0x5E, 0x5B, 0x5E, 0x64, 0x6D,
-	0x7A, 0x89, 0x97, 0xA8, 0xB4, 0xBC, 0xC1, 0xBC, 0xB4, 0xA7, 0x97, 0x82,
-	0x6C, 0x5B, 0x4A, 0x3E, 0x39, 0x3B, 0x43, 0x50, 0x65, 0x7D, 0x95, 0xAA,
-	0xBC, 0xC6, 0xCC, 0xCB, 0xC2, 0xB5, 0xA2, 0x8D, 0x77, 0x62, 0x51, 0x45,
-	0x40, 0x3F, 0x47, 0x52, 0x63, 0x76, 0x88, 0x99, 0xA8, 0xB3, 0xB6, 0xB5,
-	0xAF, 0xA7, 0x9A, 0x8D, 0x80, 0x76, 0x6D, 0x66, 0x63, 0x64, 0x6A, 0x6E,
-	0x75, 0x7B, 0x80, 0x85, 0x86, 0x88, 0x86, 0x85, 0x84, 0x82, 0x82, 0x83,
-	0x86, 0x89, 0x8E, 0x92, 0x95, 0x97, 0x97, 0x95, 0x8E, 0x85, 0x7E, 0x75,
-	0x67, 0x5D, 0x56, 0x52, 0x54, 0x5A, 0x64, 0x72, 0x83, 0x95, 0xA5, 0xB6,
-	0xC0, 0xC3, 0xC3, 0xBD, 0xAE, 0x9E, 0x88, 0x73, 0x5E, 0x4C, 0x3F, 0x37,
-	0x37, 0x3F, 0x4D, 0x5F, 0x75, 0x8E, 0xA2, 0xB6, 0xC3, 0xCB, 0xCB, 0xC4,
-	0xB8, 0xA6, 0x91, 0x7C, 0x68, 0x57, 0x4B, 0x44, 0x43, 0x49, 0x54, 0x62,
-	0x74, 0x84, 0x93, 0xA2, 0xAA, 0xAF, 0xB1, 0xA9, 0xA3, 0x9A, 0x8F, 0x84,
-	0x7B, 0x74, 0x6F, 0x6C, 0x6D, 0x70, 0x74, 0x78, 0x7D, 0x80, 0x82, 0x81,
-	0x80, 0x80, 0x7E, 0x7D, 0x7F, 0x80, 0x81, 0x88, 0x8B, 0x93, 0x99, 0x9E,
-	0xA1, 0xA1, 0x9D, 0x96, 0x8B, 0x80, 0x72, 0x65, 0x58, 0x4F, 0x4A, 0x4A,
-	0x4F, 0x5B, 0x6B, 0x7D, 0x90, 0xA3, 0xB4, 0xC1, 0xC7, 0xC8, 0xC2, 0xB6,
-	0xA4, 0x90, 0x79, 0x63, 0x50, 0x3F, 0x38, 0x37, 0x3C, 0x49, 0x5A, 0x6F,
-	0x85, 0x9D, 0xB0, 0xBE, 0xC6, 0xC8, 0xC4, 0xBA, 0xA9, 0x96, 0x81, 0x6F,
-	0x5E, 0x52, 0x4A, 0x49, 0x4C, 0x55, 0x61, 0x71, 0x80, 0x8C, 0x98, 0x9F,
-	0xA7, 0xA8, 0xA4, 0x9F, 0x98, 0x8E, 0x86, 0x7F, 0x7A, 0x77, 0x75, 0x76,
-	0x78, 0x7B, 0x7D, 0x80, 0x81, 0x7E, 0x7C, 0x7C, 0x77, 0x75, 0x74, 0x75,
-	0x78, 0x7D, 0x85, 0x8D, 0x97, 0xA0, 0xA5, 0xAA, 0xAB, 0xA6, 0x9F, 0x93,
-	0x85, 0x75, 0x66, 0x57, 0x4C, 0x47, 0x45, 0x49, 0x53, 0x63, 0x75, 0x8A,
-	0x9F, 0xB3, 0xC0, 0xC9, 0xC9, 0xC7, 0xBD, 0xAA, 0x96, 0x80, 0x69, 0x54,
-	0x44, 0x3B, 0x37, 0x3C, 0x46, 0x56, 0x6B, 0x81, 0x97, 0xAB, 0xB9, 0xC2,
-	0xC6, 0xC1, 0xB8, 0xAA, 0x9A, 0x85, 0x75, 0x66, 0x59, 0x53, 0x4F, 0x51,
-	0x59, 0x63, 0x6F, 0x7D, 0x87, 0x92, 0x9A, 0x9E, 0x9F, 0x9D, 0x9A, 0x93,
-	0x8E, 0x87, 0x82, 0x7F, 0x7E, 0x7D, 0x7F, 0x80, 0x81, 0x82, 0x81, 0x7E,
-	0x7C, 0x79, 0x74, 0x70, 0x6B, 0x6A, 0x6A, 0x70, 0x78, 0x81, 0x8E, 0x98,
-	0xA2, 0xAC, 0xB2, 0xB4, 0xAF, 0xA8, 0x9C, 0x8B, 0x7B, 0x69, 0x5A, 0x4A,
-	0x42, 0x3E, 0x42, 0x4A, 0x5A, 0x6E, 0x83, 0x9A, 0xAF, 0xBD, 0xC8, 0xCD,
-	0xC8, 0xC2, 0xB1, 0x9D, 0x86, 0x70, 0x5A, 0x49, 0x3E, 0x39, 0x3C, 0x44,
-	0x54, 0x66, 0x7C, 0x91, 0xA2, 0xB2, 0xBC, 0xC1, 0xBF, 0xB7, 0xAA, 0x9C,
-	0x8B, 0x7C, 0x6E, 0x63, 0x5B, 0x57, 0x58, 0x5D, 0x67, 0x70, 0x7A, 0x83,
-	0x8B, 0x91, 0x95, 0x96, 0x94, 0x91, 0x8D, 0x8A, 0x86, 0x85, 0x83, 0x85,
-	0x86, 0x87, 0x88, 0x89, 0x88, 0x86, 0x81, 0x7B, 0x74, 0x6E, 0x67, 0x63,
-	0x61, 0x63, 0x69, 0x70, 0x7D, 0x8A, 0x98, 0xA6, 0xB2, 0xB9, 0xBC, 0xBA,
-	0xB2, 0xA5, 0x94, 0x81, 0x6D, 0x5A, 0x4A, 0x41, 0x3B, 0x3D, 0x46, 0x53,
-	0x67, 0x7E, 0x95, 0xA9, 0xBB, 0xC7, 0xCB, 0xCB, 0xC2, 0xB5, 0xA1, 0x8A,
-	0x75, 0x5F, 0x4E, 0x42, 0x3C, 0x3C, 0x43, 0x52, 0x63, 0x76, 0x89, 0x9A,
-	0xAC, 0xB5, 0xB9, 0xBA, 0xB3, 0xAA, 0x9D, 0x8D, 0x7F, 0x73, 0x6A, 0x61,
-	0x5F, 0x60, 0x63, 0x6A, 0x72, 0x7A, 0x80, 0x87, 0x8A, 0x8D, 0x8B, 0x8B,
-	0x89, 0x87, 0x85, 0x85, 0x85, 0x86, 0x8A, 0x8F, 0x90, 0x92, 0x92, 0x8F,
-	0x8A, 0x84, 0x7D, 0x72, 0x69, 0x60, 0x5A, 0x57, 0x58, 0x60, 0x6A, 0x76,
-	0x83, 0x95, 0xA5, 0xB3, 0xBD, 0xC1, 0xC1, 0xBB, 0xAC, 0x9C, 0x87, 0x73,
-	0x5F, 0x4C, 0x3F, 0x39, 0x3A, 0x40, 0x4D, 0x61, 0x77, 0x8E, 0xA6, 0xB7,
-	0xC3, 0xCD, 0xCB, 0xC5, 0xB8, 0xA5, 0x8F, 0x7B, 0x66, 0x55, 0x49, 0x42,
-	0x40, 0x46, 0x51, 0x60, 0x72, 0x84, 0x96, 0xA2, 0xAD, 0xB3, 0xB2, 0xAF,
-	0xA5, 0x9B, 0x8F, 0x83, 0x7B, 0x6F, 0x69, 0x66, 0x68, 0x6B, 0x6D, 0x75,
-	0x7B, 0x7F, 0x82, 0x83, 0x84, 0x84, 0x83, 0x81, 0x80, 0x80, 0x83, 0x86,
-	0x8A, 0x90, 0x95, 0x99, 0x9C, 0x9B, 0x98, 0x93, 0x89, 0x81, 0x72, 0x68,
-	0x5D, 0x53, 0x50, 0x51, 0x55, 0x5F, 0x6C, 0x80, 0x90, 0xA4, 0xB4, 0xBE,
-	0xC6, 0xC6, 0xC0, 0xB3, 0xA4, 0x8F, 0x7A, 0x63, 0x50, 0x42, 0x39, 0x36,
-	0x3D, 0x4A, 0x5B, 0x71, 0x89, 0x9E, 0xB2, 0xC1, 0xC9, 0xCA, 0xC5, 0xB9,
-	0xA9, 0x96, 0x80, 0x6E, 0x5C, 0x4E, 0x46, 0x44, 0x49, 0x52, 0x5F, 0x6F,
-	0x7F, 0x90, 0x9D, 0xA6, 0xAB, 0xAC, 0xA9, 0xA3, 0x99, 0x90, 0x86, 0x7E,
-	0x77, 0x73, 0x70, 0x71, 0x73, 0x76, 0x7A, 0x7E, 0x7F, 0x80, 0x80, 0x7F,
-	0x7E, 0x7A, 0x7A, 0x7A, 0x7C, 0x80, 0x85, 0x8C, 0x94, 0x9A, 0xA1, 0xA3,
-	0xA6, 0xA2, 0x9B, 0x90, 0x83, 0x76, 0x67, 0x59, 0x4F, 0x47, 0x47, 0x4C,
-	0x56, 0x64, 0x78, 0x8A, 0xA0, 0xB1, 0xC0, 0xC7, 0xC9, 0xC6, 0xBA, 0xAA,
-	0x95, 0x80, 0x68, 0x54, 0x45, 0x3B, 0x38, 0x3B, 0x46, 0x56, 0x6B, 0x82,
-	0x99, 0xAC, 0xBC, 0xC5, 0xC8, 0xC4, 0xBB, 0xAC, 0x99, 0x87, 0x74, 0x62,
-	0x56, 0x4D, 0x4A, 0x4D, 0x55, 0x61, 0x6E, 0x7C, 0x88, 0x95, 0x9E, 0xA2,
-	0xA4, 0xA1, 0x9D, 0x96, 0x8E, 0x86, 0x80, 0x7C, 0x79, 0x79, 0x79, 0x7B,
-	0x7F, 0x81, 0x7F, 0x80, 0x7D, 0x7D, 0x79, 0x74, 0x71, 0x6F, 0x70, 0x74,
-	0x79, 0x82, 0x8C, 0x96, 0x9F, 0xA8, 0xAE, 0xAF, 0xAC, 0xA4, 0x98, 0x89,
-	0x79, 0x68, 0x5A, 0x4D, 0x45, 0x42, 0x45, 0x4D, 0x5C, 0x70, 0x85, 0x9C,
-	0xAF, 0xBE, 0xC9, 0xCC, 0xC9, 0xC0, 0xB1, 0x9D, 0x84, 0x6E, 0x59, 0x48,
-	0x3C, 0x39, 0x3A, 0x44, 0x53, 0x66, 0x7E, 0x91, 0xA6, 0xB5, 0xBE, 0xC4,
-	0xC3, 0xB9, 0xAD, 0x9E, 0x8B, 0x7A, 0x6B, 0x5E, 0x57, 0x52, 0x53, 0x5A,
-	0x62, 0x6F, 0x7C, 0x85, 0x8E, 0x94, 0x9B, 0x9B, 0x99, 0x96, 0x91, 0x8C,
-	0x87, 0x85, 0x80, 0x80, 0x80, 0x82, 0x84, 0x84, 0x84, 0x82, 0x80, 0x7C,
-	0x75, 0x71, 0x6C, 0x67, 0x66, 0x67, 0x6D, 0x73, 0x7F, 0x8A, 0x96, 0xA3,
-	0xAD, 0xB4, 0xB8, 0xB5, 0xAD, 0xA2, 0x91, 0x7F, 0x6C, 0x5B, 0x4B, 0x42,
-	0x3E, 0x3F, 0x48, 0x55, 0x68, 0x80, 0x95, 0xAB, 0xBC, 0xC7, 0xCD, 0xCB,
-	0xC2, 0xB5, 0xA1, 0x8B, 0x74, 0x5F, 0x4C, 0x40, 0x3B, 0x3B, 0x44, 0x50,
-	0x63, 0x77, 0x8A, 0x9F, 0xAD, 0xB9, 0xBC, 0xBD, 0xB7, 0xAC, 0x9E, 0x8D,
-	0x7F, 0x72, 0x65, 0x5D, 0x5A, 0x5B, 0x5D, 0x66, 0x6F, 0x7A, 0x83, 0x88,
-	0x8E, 0x91, 0x92, 0x91, 0x8D, 0x8C, 0x88, 0x86, 0x84, 0x85, 0x86, 0x87,
-	0x8B, 0x8D, 0x8B, 0x8C, 0x88, 0x82, 0x7D, 0x75, 0x6D, 0x64, 0x5E, 0x5D,
-	0x5E, 0x63, 0x6C, 0x78, 0x85, 0x96, 0xA5, 0xB2, 0xBB, 0xBF, 0xBD, 0xB7,
-	0xAA, 0x9A, 0x85, 0x71, 0x5E, 0x4E, 0x42, 0x3B, 0x3A, 0x42, 0x4F, 0x63,
-	0x79, 0x8F, 0xA6, 0xB9, 0xC5, 0xCD, 0xCD, 0xC6, 0xB9, 0xA6, 0x90, 0x7B,
-	0x66, 0x53, 0x44, 0x3D, 0x3E, 0x43, 0x4F, 0x5E, 0x72, 0x85, 0x97, 0xA6,
-	0xB0, 0xB6, 0xB7, 0xB3, 0xA9, 0x9D, 0x90, 0x83, 0x78, 0x6E, 0x67, 0x62,
-	0x63, 0x68, 0x6B, 0x72, 0x79, 0x80, 0x85, 0x88, 0x8B, 0x8A, 0x87, 0x85,
-	0x85, 0x85, 0x84, 0x85, 0x86, 0x8C, 0x90, 0x93, 0x96, 0x95, 0x93, 0x8F,
-	0x87, 0x80, 0x75, 0x6A, 0x60, 0x58, 0x55, 0x54, 0x58, 0x63, 0x70, 0x80,
-	0x92, 0xA2, 0xB2, 0xBD, 0xC2, 0xC3, 0xBE, 0xB1, 0xA0, 0x8D, 0x77, 0x61,
-	0x4F, 0x41, 0x3A, 0x3A, 0x3D, 0x49, 0x5B, 0x72, 0x88, 0xA0, 0xB1, 0xC2,
-	0xCB, 0xCC, 0xC7, 0xBB, 0xA9, 0x95, 0x80, 0x6B, 0x58, 0x4B, 0x44, 0x43,
-	0x46, 0x4F, 0x5D, 0x6F, 0x80, 0x90, 0x9E, 0xA9, 0xB0, 0xB2, 0xAD, 0xA6,
-	0x9C, 0x92, 0x85, 0x7B, 0x74, 0x6F, 0x6B, 0x6B, 0x6F, 0x71, 0x76, 0x7B,
-	0x7F, 0x81, 0x82, 0x82, 0x80, 0x81, 0x80, 0x7E, 0x80, 0x81, 0x86, 0x8B,
-	0x92, 0x97, 0x9C, 0x9F, 0x9F, 0x9C, 0x96, 0x8D, 0x81, 0x75, 0x68, 0x5C,
-	0x53, 0x4D, 0x4B, 0x4E, 0x59, 0x68, 0x79, 0x8B, 0xA0, 0xAF, 0xBC, 0xC6,
-	0xC8, 0xC3, 0xB7, 0xA8, 0x95, 0x7C, 0x67, 0x54, 0x44, 0x3B, 0x37, 0x3B,
-	0x46, 0x57, 0x6D, 0x84, 0x99, 0xAF, 0xBD, 0xC7, 0xCA, 0xC5, 0xBC, 0xAD,
-	0x99, 0x86, 0x73, 0x61, 0x55, 0x4A, 0x46, 0x4A, 0x52, 0x5E, 0x6C, 0x7D,
-	0x8B, 0x96, 0xA1, 0xA7, 0xAA, 0xA8, 0xA1, 0x9A, 0x91, 0x88, 0x81, 0x7A,
-	0x75, 0x74, 0x74, 0x76, 0x78, 0x7B, 0x7E, 0x7E, 0x80, 0x7E, 0x7D, 0x7A,
-	0x77, 0x74, 0x76, 0x79, 0x7C, 0x83, 0x8C, 0x94, 0x9B, 0xA4, 0xA8, 0xA8,
-	0xA6, 0x9E, 0x94, 0x88, 0x79, 0x6A, 0x5C, 0x4F, 0x48, 0x46, 0x49, 0x52,
-	0x60, 0x72, 0x86, 0x9C, 0xAE, 0xBD, 0xC5, 0xCA, 0xC7, 0xBD, 0xAF, 0x9A,
-	0x83, 0x6E, 0x57, 0x46, 0x3C, 0x37, 0x3A, 0x43, 0x53, 0x66, 0x7E, 0x93,
-	0xA8, 0xB7, 0xC1, 0xC6, 0xC4, 0xBC, 0xAD, 0x9D, 0x8B, 0x78, 0x68, 0x5B,
-	0x51, 0x4D, 0x4E, 0x56, 0x60, 0x6E, 0x7A, 0x86, 0x91, 0x9A, 0x9F, 0xA1,
-	0x9F, 0x9C, 0x95, 0x8F, 0x89, 0x82, 0x7F, 0x7D, 0x7D, 0x7D, 0x7E, 0x80,
-	0x81, 0x81, 0x80, 0x7E, 0x7A, 0x76, 0x72, 0x6D, 0x6B, 0x6B, 0x70, 0x77,
-	0x81, 0x8A, 0x94, 0x9F, 0xA9, 0xAF, 0xB2, 0xB0, 0xA8, 0x9C, 0x8F, 0x7E,
-	0x6A, 0x5A, 0x4D, 0x44, 0x40, 0x42, 0x4A, 0x58, 0x6B, 0x80, 0x95, 0xAB,
-	0xBC, 0xC5, 0xCC, 0xCB, 0xC2, 0xB3, 0xA0, 0x8A, 0x73, 0x5D, 0x4C, 0x40,
-	0x3A, 0x38, 0x42, 0x4F, 0x62, 0x78, 0x8E, 0xA0, 0xB0, 0xBB, 0xC1, 0xC2,
-	0xB9, 0xAD, 0x9F, 0x8E, 0x7D, 0x6F, 0x62, 0x59, 0x56, 0x56, 0x5A, 0x62,
-	0x6C, 0x7A, 0x82, 0x8B, 0x92, 0x96, 0x97, 0x96, 0x92, 0x8E, 0x8A, 0x86,
-	0x84, 0x82, 0x81, 0x83, 0x84, 0x87, 0x87, 0x87, 0x85, 0x80, 0x7E, 0x76,
-	0x70, 0x6B, 0x64, 0x63, 0x63, 0x68, 0x72, 0x7B, 0x87, 0x96, 0xA3, 0xAF,
-	0xB7, 0xBC, 0xB9, 0xB2, 0xA6, 0x97, 0x84, 0x71, 0x5D, 0x4E, 0x43, 0x3C,
-	0x3D, 0x44, 0x52, 0x64, 0x7B, 0x90, 0xA6, 0xB9, 0xC6, 0xCB, 0xCC, 0xC6,
-	0xB8, 0xA6, 0x8F, 0x79, 0x63, 0x51, 0x43, 0x3C, 0x3B, 0x42, 0x4E, 0x60,
-	0x73, 0x86, 0x99, 0xAA, 0xB4, 0xBA, 0xBB, 0xB5, 0xAD, 0x9F, 0x91, 0x83,
-	0x76, 0x6A, 0x61, 0x5D, 0x5D, 0x61, 0x67, 0x6F, 0x77, 0x80, 0x86, 0x8B,
-	0x8E, 0x90, 0x8F, 0x8D, 0x88, 0x87, 0x85, 0x86, 0x86, 0x87, 0x8A, 0x8D,
-	0x8F, 0x90, 0x8F, 0x8B, 0x85, 0x7E, 0x75, 0x6D, 0x64, 0x5F, 0x5A, 0x59,
-	0x5F, 0x67, 0x74, 0x82, 0x92, 0xA2, 0xAF, 0xBA, 0xC0, 0xC0, 0xB9, 0xAE,
-	0x9E, 0x8B, 0x78, 0x62, 0x50, 0x42, 0x3B, 0x39, 0x3D, 0x4B, 0x5D, 0x74,
-	0x8B, 0xA1, 0xB4, 0xC4, 0xCB, 0xCC, 0xC8, 0xBC, 0xA9, 0x95, 0x7F, 0x68,
-	0x57, 0x4A, 0x41, 0x3E, 0x43, 0x4E, 0x5C, 0x6E, 0x80, 0x92, 0xA1, 0xAD,
-	0xB3, 0xB4, 0xB2, 0xAA, 0xA0, 0x92, 0x85, 0x79, 0x71, 0x6A, 0x66, 0x65,
-	0x68, 0x6C, 0x73, 0x7A, 0x7F, 0x83, 0x86, 0x86, 0x86, 0x84, 0x83, 0x82,
-	0x83, 0x83, 0x85, 0x89, 0x8E, 0x92, 0x96, 0x9A, 0x9A, 0x99, 0x93, 0x8A,
-	0x81, 0x78, 0x6B, 0x61, 0x57, 0x52, 0x51, 0x55, 0x5E, 0x6B, 0x7C, 0x8E,
-	0xA1, 0xB0, 0xBC, 0xC5, 0xC6, 0xC2, 0xB6, 0xA6, 0x92, 0x7D, 0x66, 0x53,
-	0x43, 0x3B, 0x38, 0x3B, 0x47, 0x57, 0x6E, 0x84, 0x9A, 0xAF, 0xBE, 0xC8,
-	0xCB, 0xC8, 0xBE, 0xAE, 0x9A, 0x85, 0x71, 0x5E, 0x50, 0x47, 0x44, 0x46,
-	0x4D, 0x5C, 0x6D, 0x7E, 0x8C, 0x9B, 0xA4, 0xAC, 0xAE, 0xAB, 0xA3, 0x9C,
-	0x92, 0x88, 0x7E, 0x77, 0x73, 0x6F, 0x6F, 0x70, 0x74, 0x77, 0x7B, 0x7F,
-	0x80, 0x81, 0x81, 0x7E, 0x7E, 0x7B, 0x7C, 0x7F, 0x7F, 0x85, 0x8A, 0x91,
-	0x99, 0x9F, 0xA3, 0xA4, 0xA0, 0x9A, 0x91, 0x84, 0x78, 0x69, 0x5C, 0x52,
-	0x4A, 0x47, 0x4C, 0x55, 0x63, 0x73, 0x89, 0x9C, 0xAE, 0xBD, 0xC7, 0xCB,
-	0xC7, 0xBC, 0xAC, 0x99, 0x83, 0x6D, 0x57, 0x47, 0x3B, 0x37, 0x3A, 0x43,
-	0x53, 0x67, 0x7F, 0x95, 0xAA, 0xBA, 0xC3, 0xC9, 0xC6, 0xBC, 0xAF, 0x9E,
-	0x8A, 0x76, 0x65, 0x57, 0x4D, 0x49, 0x4A, 0x52, 0x5D, 0x69, 0x79, 0x86,
-	0x92, 0x9D, 0xA2, 0xA3, 0xA3, 0x9F, 0x98, 0x91, 0x89, 0x81, 0x7C, 0x78,
-	0x76, 0x77, 0x79, 0x7C, 0x7E, 0x7E, 0x80, 0x7F, 0x7E, 0x7C, 0x76, 0x74,
-	0x74, 0x72, 0x75, 0x7B, 0x81, 0x89, 0x93, 0x9D, 0xA5, 0xAA, 0xAC, 0xAC,
-	0xA4, 0x98, 0x8D, 0x7E, 0x6B, 0x5E, 0x4F, 0x46, 0x43, 0x44, 0x4F, 0x5B,
-	0x6C, 0x81, 0x97, 0xAC, 0xBC, 0xC5, 0xCB, 0xC8, 0xC1, 0xB4, 0xA0, 0x88,
-	0x71, 0x5C, 0x4C, 0x3D, 0x39, 0x3A, 0x42, 0x50, 0x63, 0x79, 0x8D, 0xA2,
-	0xB4, 0xBE, 0xC5, 0xC3, 0xBC, 0xB0, 0xA0, 0x8E, 0x7C, 0x6D, 0x5E, 0x54,
-	0x50, 0x50, 0x56, 0x5E, 0x6A, 0x78, 0x83, 0x8C, 0x94, 0x9B, 0x9D, 0x9B,
-	0x9A, 0x92, 0x8D, 0x88, 0x83, 0x81, 0x80, 0x7F, 0x81, 0x81, 0x83, 0x83,
-	0x81, 0x80, 0x7E, 0x7A, 0x73, 0x70, 0x6A, 0x68, 0x69, 0x6C, 0x72, 0x7E,
-	0x88, 0x94, 0xA0, 0xAB, 0xB2, 0xB6, 0xB3, 0xAE, 0xA4, 0x95, 0x82, 0x70,
-	0x5F, 0x4F, 0x44, 0x3D, 0x3F, 0x46, 0x54, 0x65, 0x7B, 0x93, 0xA6, 0xB9,
-	0xC5, 0xCD, 0xCC, 0xC6, 0xB8, 0xA5, 0x8F, 0x78, 0x62, 0x4F, 0x42, 0x3A,
-	0x39, 0x3F, 0x4C, 0x5D, 0x72, 0x89, 0x9B, 0xAB, 0xB8, 0xBF, 0xC0, 0xBA,
-	0xB0, 0xA2, 0x91, 0x80, 0x73, 0x66, 0x5E, 0x59, 0x58, 0x5C, 0x63, 0x6D,
-	0x77, 0x80, 0x88, 0x8E, 0x92, 0x94, 0x93, 0x90, 0x8B, 0x8A, 0x88, 0x86,
-	0x85, 0x87, 0x87, 0x88, 0x8B, 0x8A, 0x89, 0x85, 0x82, 0x7E, 0x76, 0x6E,
-	0x68, 0x62, 0x5E, 0x60, 0x65, 0x6C, 0x77, 0x84, 0x92, 0xA0, 0xAE, 0xB7,
-	0xBC, 0xBC, 0xB7, 0xAB, 0x9C, 0x89, 0x75, 0x61, 0x4F, 0x43, 0x3B, 0x3B,
-	0x40, 0x4D, 0x5E, 0x74, 0x8B, 0xA1, 0xB5, 0xC3, 0xCC, 0xCC, 0xC7, 0xBB,
-	0xAA, 0x94, 0x7E, 0x68, 0x55, 0x47, 0x3E, 0x3C, 0x40, 0x4C, 0x5C, 0x6F,
-	0x82, 0x95, 0xA6, 0xB1, 0xB8, 0xB9, 0xB7, 0xAD, 0xA1, 0x93, 0x85, 0x79,
-	0x6F, 0x64, 0x61, 0x61, 0x63, 0x69, 0x71, 0x77, 0x7E, 0x83, 0x88, 0x8B,
-	0x8C, 0x8B, 0x87, 0x86, 0x86, 0x84, 0x85, 0x87, 0x8A, 0x8F, 0x91, 0x94,
-	0x95, 0x94, 0x8F, 0x89, 0x81, 0x77, 0x6D, 0x63, 0x5B, 0x57, 0x55, 0x5A,
-	0x63, 0x6D, 0x7F, 0x8F, 0xA0, 0xAE, 0xBA, 0xC2, 0xC2, 0xBC, 0xB3, 0xA4,
-	0x8F, 0x7B, 0x66, 0x52, 0x44, 0x3B, 0x39, 0x3E, 0x47, 0x58, 0x6E, 0x83,
-	0x9C, 0xB1, 0xC0, 0xC9, 0xCC, 0xC8, 0xBD, 0xAE, 0x99, 0x83, 0x70, 0x5C,
-	0x4D, 0x44, 0x41, 0x44, 0x4D, 0x5A, 0x6B, 0x7F, 0x8D, 0x9D, 0xA9, 0xB0,
-	0xB3, 0xAE, 0xA9, 0x9F, 0x95, 0x88, 0x7C, 0x74, 0x6E, 0x6A, 0x6A, 0x6A,
-	0x6F, 0x74, 0x79, 0x80, 0x81, 0x83, 0x82, 0x84, 0x82, 0x81, 0x7E, 0x81,
-	0x82, 0x84, 0x8A, 0x8E, 0x94, 0x98, 0x9D, 0x9E, 0x9B, 0x97, 0x90, 0x83,
-	0x79, 0x6B, 0x5F, 0x56, 0x50, 0x4D, 0x50, 0x59, 0x65, 0x76, 0x88, 0x9B,
-	0xAD, 0xBA, 0xC4, 0xC7, 0xC3, 0xB9, 0xA9, 0x97, 0x81, 0x6C, 0x56, 0x46,
-	0x3C, 0x38, 0x3A, 0x43, 0x53, 0x68, 0x80, 0x97, 0xAB, 0xBB, 0xC6, 0xCB,
-	0xC9, 0xC0, 0xB0, 0x9E, 0x8B, 0x76, 0x62, 0x54, 0x4A, 0x45, 0x47, 0x4F,
-	0x5B, 0x6A, 0x7B, 0x89, 0x95, 0xA1, 0xA8, 0xAA, 0xA8, 0xA3, 0x9B, 0x93,
-	0x89, 0x81, 0x7A, 0x76, 0x73, 0x71, 0x75, 0x77, 0x7A, 0x7D, 0x7E, 0x7F,
-	0x80, 0x7E, 0x7C, 0x79, 0x78, 0x77, 0x7A, 0x7C, 0x83, 0x8A, 0x90, 0x98,
-	0xA0, 0xA4, 0xA7, 0xA4, 0x9E, 0x96, 0x89, 0x7D, 0x6C, 0x5F, 0x52, 0x48,
-	0x47, 0x48, 0x4F, 0x5C, 0x6F, 0x82, 0x97, 0xAA, 0xBA, 0xC5, 0xCA, 0xC7,
-	0xBF, 0xB1, 0x9C, 0x87, 0x70, 0x5B, 0x4B, 0x3E, 0x38, 0x38, 0x40, 0x4F,
-	0x63, 0x79, 0x91, 0xA4, 0xB5, 0xC1, 0xC7, 0xC6, 0xBE, 0xB1, 0xA0, 0x8F,
-	0x7D, 0x6A, 0x5C, 0x52, 0x4E, 0x4D, 0x52, 0x5D, 0x69, 0x78, 0x85, 0x8F,
-	0x9A, 0x9F, 0xA2, 0xA2, 0x9F, 0x97, 0x90, 0x89, 0x83, 0x7F, 0x7C, 0x7C,
-	0x7A, 0x7D, 0x7D, 0x7F, 0x7F, 0x80, 0x80, 0x7D, 0x78, 0x74, 0x71, 0x6D,
-	0x6E, 0x73, 0x76, 0x7F, 0x88, 0x93, 0x9C, 0xA6, 0xAD, 0xB1, 0xAF, 0xA8,
-	0x9E, 0x90, 0x7F, 0x6E, 0x5D, 0x50, 0x47, 0x41, 0x41, 0x49, 0x57, 0x66,
-	0x7C, 0x92, 0xA8, 0xB9, 0xC4, 0xCC, 0xCB, 0xC3, 0xB6, 0xA5, 0x8F, 0x77,
-	0x61, 0x4F, 0x40, 0x39, 0x3A, 0x40, 0x4D, 0x5E, 0x73, 0x8A, 0x9D, 0xAE,
-	0xBB, 0xC2, 0xC4, 0xBE, 0xB1, 0xA3, 0x93, 0x80, 0x72, 0x65, 0x59, 0x54,
-	0x54, 0x59, 0x60, 0x6B, 0x76, 0x81, 0x8A, 0x92, 0x98, 0x9A, 0x98, 0x96,
-	0x92, 0x8E, 0x88, 0x86, 0x82, 0x80, 0x81, 0x82, 0x84, 0x87, 0x86, 0x84,
-	0x81, 0x7E, 0x78, 0x73, 0x6E, 0x67, 0x64, 0x65, 0x68, 0x6F, 0x7A, 0x85,
-	0x92, 0x9F, 0xAB, 0xB3, 0xB9, 0xB8, 0xB2, 0xA8, 0x99, 0x87, 0x75, 0x61,
-	0x51, 0x45, 0x3D, 0x3C, 0x41, 0x4E, 0x60, 0x75, 0x8B, 0xA2, 0xB5, 0xC2,
-	0xCB, 0xCC, 0xC7, 0xBB, 0xAA, 0x94, 0x7E, 0x68, 0x54, 0x45, 0x3D, 0x3A,
-	0x3F, 0x49, 0x5B, 0x6F, 0x83, 0x96, 0xA7, 0xB4, 0xBA, 0xBD, 0xBA, 0xB0,
-	0xA3, 0x94, 0x84, 0x77, 0x6A, 0x63, 0x5C, 0x5C, 0x5F, 0x65, 0x6E, 0x76,
-	0x7F, 0x87, 0x8B, 0x90, 0x8F, 0x90, 0x8F, 0x8B, 0x89, 0x85, 0x86, 0x84,
-	0x86, 0x88, 0x8B, 0x8D, 0x8E, 0x8C, 0x8A, 0x85, 0x81, 0x79, 0x70, 0x68,
-	0x61, 0x5C, 0x5C, 0x60, 0x68, 0x72, 0x81, 0x90, 0x9E, 0xAD, 0xB8, 0xBD,
-	0xBF, 0xBB, 0xB1, 0xA0, 0x8F, 0x7C, 0x65, 0x52, 0x45, 0x3E, 0x3A, 0x3D,
-	0x49, 0x58, 0x6E, 0x86, 0x9D, 0xB2, 0xC0, 0xC9, 0xCD, 0xC8, 0xBD, 0xAE,
-	0x98, 0x82, 0x6E, 0x59, 0x4B, 0x40, 0x3E, 0x42, 0x4B, 0x59, 0x6B, 0x7F,
-	0x91, 0xA0, 0xAC, 0xB2, 0xB5, 0xB5, 0xAE, 0xA1, 0x97, 0x87, 0x7E, 0x73,
-	0x6B, 0x65, 0x63, 0x66, 0x6A, 0x71, 0x78, 0x7D, 0x82, 0x86, 0x87, 0x88,
-	0x86, 0x86, 0x83, 0x83, 0x84, 0x85, 0x87, 0x8B, 0x90, 0x94, 0x99, 0x9A,
-	0x98, 0x92, 0x8D, 0x83, 0x79, 0x6E, 0x64, 0x5A, 0x53, 0x53, 0x56, 0x5E,
-	0x6A, 0x7A, 0x89, 0x9C, 0xAD, 0xB9, 0xC2, 0xC3, 0xC0, 0xB7, 0xA8, 0x96,
-	0x80, 0x6B, 0x57, 0x47, 0x3C, 0x38, 0x3A, 0x44, 0x52, 0x68, 0x81, 0x98,
-	0xAC, 0xBD, 0xC7, 0xCC, 0xC9, 0xBF, 0xB2, 0x9F, 0x89, 0x75, 0x61, 0x51,
-	0x47, 0x43, 0x44, 0x4C, 0x58, 0x68, 0x7A, 0x89, 0x98, 0xA3, 0xAD, 0xAF,
-	0xAE, 0xA9, 0xA0, 0x95, 0x8B, 0x80, 0x78, 0x71, 0x6D, 0x6C, 0x6D, 0x71,
-	0x75, 0x79, 0x7E, 0x80, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7D, 0x7E, 0x80,
-	0x85, 0x8A, 0x90, 0x96, 0x9C, 0xA0, 0xA2, 0xA1, 0x9A, 0x92, 0x85, 0x7B,
-	0x6D, 0x5E, 0x55, 0x4C, 0x49, 0x4C, 0x54, 0x61, 0x71, 0x83, 0x98, 0xAB,
-	0xBA, 0xC3, 0xC7, 0xC5, 0xBD, 0xAE, 0x9C, 0x85, 0x6E, 0x5A, 0x49, 0x3D,
-	0x36, 0x38, 0x41, 0x4E, 0x63, 0x7B, 0x90, 0xA6, 0xB6, 0xC2, 0xC8, 0xC7,
-	0xC0, 0xB3, 0xA3, 0x8F, 0x7B, 0x69, 0x5A, 0x4F, 0x49, 0x4A, 0x4F, 0x5A,
-	0x67, 0x77, 0x86, 0x91, 0x9C, 0xA4, 0xA7, 0xA5, 0xA2, 0x9D, 0x92, 0x8B,
-	0x81, 0x7D, 0x79, 0x77, 0x75, 0x77, 0x7A, 0x7C, 0x7E, 0x80, 0x7F, 0x7F,
-	0x7D, 0x79, 0x76, 0x75, 0x74, 0x76, 0x7A, 0x80, 0x89, 0x91, 0x9A, 0xA3,
-	0xA9, 0xAB, 0xA9, 0xA5, 0x9B, 0x8E, 0x80, 0x70, 0x60, 0x53, 0x49, 0x44,
-	0x45, 0x4C, 0x59, 0x69, 0x7F, 0x94, 0xA7, 0xB8, 0xC4, 0xCA, 0xCA, 0xC4,
-	0xB6, 0xA3, 0x8D, 0x76, 0x60, 0x4E, 0x3F, 0x38, 0x38, 0x40, 0x4D, 0x5E,
-	0x74, 0x8A, 0x9F, 0xB1, 0xBE, 0xC4, 0xC5, 0xBF, 0xB3, 0xA4, 0x94, 0x80,
-	0x70, 0x60, 0x56, 0x4F, 0x4F, 0x53, 0x5D, 0x68, 0x76, 0x81, 0x8D, 0x95,
-	0x9C, 0x9E, 0x9E, 0x9B, 0x95, 0x91, 0x89, 0x84, 0x80, 0x7E, 0x7D, 0x7F,
-	0x7F, 0x80, 0x81, 0x81, 0x80, 0x7E, 0x7B, 0x76, 0x71, 0x6C, 0x6A, 0x69,
-	0x6D, 0x72, 0x7A, 0x85, 0x90, 0x9C, 0xA8, 0xAF, 0xB2, 0xB2, 0xAD, 0xA3,
-	0x95, 0x84, 0x74, 0x62, 0x51, 0x46, 0x3F, 0x3E, 0x44, 0x51, 0x61, 0x77,
-	0x8D, 0xA2, 0xB6, 0xC3, 0xCB, 0xCC, 0xC5, 0xBB, 0xA9, 0x95, 0x7D, 0x66,
-	0x52, 0x45, 0x3A, 0x3A, 0x3E, 0x49, 0x5A, 0x6D, 0x83, 0x99, 0xAA, 0xB6,
-	0xBE, 0xC1, 0xBC, 0xB2, 0xA5, 0x95, 0x84, 0x75, 0x68, 0x5D, 0x56, 0x56,
-	0x5A, 0x61, 0x6A, 0x75, 0x7F, 0x87, 0x8D, 0x93, 0x96, 0x95, 0x93, 0x90,
-	0x8B, 0x87, 0x85, 0x84, 0x83, 0x82, 0x85, 0x88, 0x88, 0x88, 0x88, 0x82,
-	0x7E, 0x7A, 0x73, 0x6B, 0x64, 0x61, 0x62, 0x64, 0x6C, 0x76, 0x82, 0x8F,
-	0xA0, 0xAB, 0xB6, 0xBB, 0xBC, 0xB8, 0xAC, 0x9E, 0x8D, 0x7B, 0x64, 0x54,
-	0x47, 0x3D, 0x3B, 0x3F, 0x4A, 0x5B, 0x70, 0x86, 0x9D, 0xB2, 0xC1, 0xCA,
-	0xCC, 0xC8, 0xBE, 0xAC, 0x99, 0x81, 0x6B, 0x57, 0x4A, 0x3F, 0x3C, 0x3F,
-	0x49, 0x59, 0x6B, 0x7F, 0x92, 0xA2, 0xAF, 0xB8, 0xBB, 0xB8, 0xB1, 0xA4,
-	0x97, 0x89, 0x7B, 0x6F, 0x65, 0x60, 0x5E, 0x61, 0x66, 0x6C, 0x77, 0x7F,
-	0x84, 0x87, 0x8B, 0x8D, 0x8D, 0x8B, 0x8A, 0x86, 0x85, 0x86, 0x86, 0x89,
-	0x8C, 0x8F, 0x91, 0x92, 0x92, 0x8D, 0x88, 0x81, 0x79, 0x6E, 0x67, 0x5F,
-	0x59, 0x58, 0x5B, 0x63, 0x6D, 0x7B, 0x8C, 0x9B, 0xAA, 0xB8, 0xBE, 0xC2,
-	0xBF, 0xB5, 0xA6, 0x95, 0x7F, 0x6A, 0x56, 0x45, 0x3E, 0x38, 0x3B, 0x44,
-	0x55, 0x69, 0x80, 0x98, 0xAB, 0xBD, 0xC8, 0xCB, 0xC9, 0xC0, 0xB1, 0x9F,
-	0x88, 0x73, 0x5F, 0x4E, 0x44, 0x40, 0x41, 0x4B, 0x57, 0x68, 0x7C, 0x8C,
-	0x9B, 0xA7, 0xB0, 0xB4, 0xB3, 0xAC, 0xA3, 0x97, 0x89, 0x7F, 0x74, 0x6E,
-	0x6A, 0x67, 0x69, 0x6C, 0x71, 0x77, 0x7C, 0x80, 0x83, 0x85, 0x84, 0x83,
-	0x81, 0x80, 0x81, 0x81, 0x83, 0x88, 0x8C, 0x90, 0x95, 0x9A, 0x9C, 0x9B,
-	0x97, 0x8F, 0x85, 0x7A, 0x6F, 0x62, 0x59, 0x52, 0x50, 0x51, 0x59, 0x63,
-	0x74, 0x87, 0x99, 0xAB, 0xB9, 0xC3, 0xC7, 0xC3, 0xBC, 0xAD, 0x9A, 0x84,
-	0x6E, 0x5A, 0x4A, 0x3D, 0x39, 0x3A, 0x40, 0x50, 0x63, 0x7A, 0x92, 0xA7,
-	0xBA, 0xC5, 0xCA, 0xCA, 0xC2, 0xB3, 0xA2, 0x8C, 0x78, 0x65, 0x56, 0x4B,
-	0x46, 0x46, 0x4C, 0x57, 0x66, 0x78, 0x86, 0x95, 0xA0, 0xA8, 0xAD, 0xAC,
-	0xA7, 0xA0, 0x97, 0x8C, 0x84, 0x7C, 0x75, 0x71, 0x6F, 0x71, 0x74, 0x78,
-	0x7A, 0x7D, 0x7F, 0x80, 0x80, 0x7D, 0x7D, 0x79, 0x79, 0x7B, 0x7E, 0x81,
-	0x88, 0x8F, 0x96, 0x9D, 0xA3, 0xA5, 0xA4, 0x9F, 0x96, 0x8B, 0x7E, 0x6F,
-	0x5F, 0x54, 0x4C, 0x48, 0x49, 0x4F, 0x5C, 0x6C, 0x80, 0x94, 0xA9, 0xB8,
-	0xC4, 0xC7, 0xC8, 0xC1, 0xB4, 0xA1, 0x8D, 0x76, 0x5E, 0x4D, 0x3F, 0x37,
-	0x37, 0x40, 0x4C, 0x5E, 0x77, 0x8B, 0xA0, 0xB3, 0xC0, 0xC7, 0xC7, 0xC0,
-	0xB5, 0xA5, 0x91, 0x7F, 0x6C, 0x5E, 0x52, 0x4C, 0x4B, 0x50, 0x59, 0x65,
-	0x76, 0x84, 0x8F, 0x99, 0x9E, 0xA4, 0xA5, 0xA0, 0x9B, 0x92, 0x8C, 0x83,
-	0x80, 0x7B, 0x79, 0x79, 0x79, 0x7C, 0x7E, 0x7F, 0x7E, 0x7F, 0x7D, 0x7B,
-	0x77, 0x74, 0x70, 0x6F, 0x70, 0x77, 0x7D, 0x84, 0x8F, 0x99, 0xA3, 0xAA,
-	0xAE, 0xAD, 0xA8, 0x9E, 0x92, 0x84, 0x70, 0x62, 0x55, 0x49, 0x42, 0x42,
-	0x48, 0x53, 0x64, 0x79, 0x8F, 0xA3, 0xB6, 0xC3, 0xCB, 0xCC, 0xC6, 0xB8,
-	0xA8, 0x92, 0x7B, 0x64, 0x51, 0x42, 0x38, 0x38, 0x3D, 0x49, 0x5A, 0x6F,
-	0x85, 0x9A, 0xAD, 0xBA, 0xC1, 0xC4, 0xBF, 0xB5, 0xA4, 0x95, 0x84, 0x73,
-	0x65, 0x5A, 0x53, 0x52, 0x55, 0x5E, 0x68, 0x72, 0x80, 0x89, 0x92, 0x97,
-	0x9A, 0x9B, 0x99, 0x95, 0x90, 0x8C, 0x86, 0x83, 0x80, 0x80, 0x80, 0x83,
-	0x84, 0x85, 0x83, 0x82, 0x7F, 0x79, 0x75, 0x6F, 0x6A, 0x66, 0x66, 0x69,
-	0x6F, 0x77, 0x82, 0x8E, 0x9B, 0xA7, 0xAF, 0xB6, 0xB8, 0xB2, 0xA8, 0x9A,
-	0x89, 0x77, 0x64, 0x54, 0x46, 0x3E, 0x3D, 0x42, 0x4C, 0x5D, 0x72, 0x88,
-	0xA0, 0xB3, 0xC1, 0xCA, 0xCC, 0xC8, 0xBD, 0xAC, 0x98, 0x81, 0x6B, 0x57,
-	0x46, 0x3D, 0x3B, 0x3D, 0x48, 0x56, 0x6B, 0x80, 0x93, 0xA5, 0xB2, 0xBB,
-	0xBE, 0xBB, 0xB2, 0xA5, 0x97, 0x88, 0x7A, 0x6C, 0x61, 0x5B, 0x5A, 0x5B,
-	0x62, 0x6A, 0x74, 0x7C, 0x85, 0x8A, 0x91, 0x92, 0x92, 0x91, 0x8E, 0x8A,
-	0x88, 0x86, 0x85, 0x86, 0x87, 0x89, 0x8B, 0x8D, 0x8C, 0x8A, 0x85, 0x80,
-	0x7A, 0x73, 0x69, 0x62, 0x5E, 0x5D, 0x5F, 0x67, 0x71, 0x7E, 0x8C, 0x9B,
-	0xAA, 0xB5, 0xBC, 0xBE, 0xBB, 0xB2, 0xA3, 0x92, 0x7D, 0x6A, 0x56, 0x47,
-	0x3F, 0x3A, 0x3E, 0x46, 0x56, 0x6A, 0x81, 0x99, 0xAE, 0xC0, 0xC9, 0xCD,
-	0xCA, 0xC0, 0xB0, 0x9E, 0x87, 0x72, 0x5D, 0x4C, 0x42, 0x3E, 0x40, 0x4A,
-	0x57, 0x68, 0x7B, 0x8D, 0x9E, 0xAB, 0xB5, 0xB8, 0xB8, 0xAF, 0xA4, 0x99,
-	0x8B, 0x7E, 0x72, 0x6B, 0x64, 0x62, 0x64, 0x68, 0x6F, 0x75, 0x7C, 0x82,
-	0x86, 0x89, 0x89, 0x89, 0x88, 0x84, 0x85, 0x84, 0x84, 0x86, 0x8A, 0x8E,
-	0x92, 0x94, 0x96, 0x97, 0x92, 0x8B, 0x84, 0x7B, 0x70, 0x67, 0x5E, 0x56,
-	0x55, 0x57, 0x5E, 0x69, 0x77, 0x87, 0x98, 0xA9, 0xB5, 0xC0, 0xC4, 0xC1,
-	0xB9, 0xAB, 0x9B, 0x84, 0x6E, 0x5A, 0x49, 0x3E, 0x37, 0x3A, 0x43, 0x4F,
-	0x64, 0x7C, 0x92, 0xA8, 0xBA, 0xC5, 0xCB, 0xCA, 0xC2, 0xB4, 0xA2, 0x8C,
-	0x78, 0x63, 0x54, 0x49, 0x44, 0x44, 0x49, 0x54, 0x66, 0x77, 0x86, 0x97,
-	0xA3, 0xAD, 0xB1, 0xB1, 0xAB, 0xA2, 0x97, 0x8E, 0x82, 0x78, 0x72, 0x6D,
-	0x6B, 0x6B, 0x6F, 0x73, 0x78, 0x7E, 0x7F, 0x80, 0x82, 0x82, 0x80, 0x80,
-	0x80, 0x7E, 0x80, 0x83, 0x89, 0x8D, 0x94, 0x9A, 0x9D, 0xA0, 0x9F, 0x9B,
-	0x93, 0x87, 0x7D, 0x71, 0x63, 0x57, 0x51, 0x4B, 0x4C, 0x53, 0x5F, 0x6E,
-	0x80, 0x95, 0xA8, 0xB8, 0xC1, 0xC7, 0xC7, 0xBE, 0xB2, 0x9F, 0x8A, 0x74,
-	0x5E, 0x4C, 0x3F, 0x38, 0x38, 0x40, 0x4D, 0x5E, 0x76, 0x8C, 0xA2, 0xB5,
-	0xC2, 0xC9, 0xC9, 0xC2, 0xB5, 0xA6, 0x91, 0x7E, 0x6A, 0x5B, 0x4E, 0x46,
-	0x49, 0x4D, 0x56, 0x65, 0x73, 0x82, 0x90, 0x9C, 0xA4, 0xAA, 0xA9, 0xA5,
-	0x9F, 0x96, 0x8D, 0x84, 0x7E, 0x78, 0x74, 0x75, 0x75, 0x76, 0x79, 0x7E,
-	0x7E, 0x80, 0x7F, 0x7E, 0x7B, 0x78, 0x76, 0x76, 0x77, 0x7A, 0x7F, 0x86,
-	0x8E, 0x97, 0xA0, 0xA6, 0xAA, 0xA9, 0xA3, 0x9C, 0x91, 0x82, 0x71, 0x63,
-	0x57, 0x4A, 0x47, 0x46, 0x4A, 0x57, 0x65, 0x7B, 0x91, 0xA3, 0xB6, 0xC3,
-	0xC9, 0xCA, 0xC5, 0xB8, 0xA6, 0x91, 0x7B, 0x64, 0x4F, 0x43, 0x39, 0x37,
-	0x3D, 0x49, 0x59, 0x70, 0x86, 0x9B, 0xAE, 0xBB, 0xC4, 0xC6, 0xC2, 0xB7,
-	0xA7, 0x94, 0x82, 0x72, 0x61, 0x57, 0x51, 0x4E, 0x53, 0x59, 0x64, 0x73,
-	0x80, 0x8B, 0x95, 0x9C, 0xA1, 0x9F, 0x9D, 0x99, 0x93, 0x8D, 0x85, 0x81,
-	0x7F, 0x7B, 0x7B, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x81, 0x7C, 0x78, 0x73,
-	0x70, 0x6D, 0x6D, 0x6E, 0x71, 0x7A, 0x81, 0x8E, 0x99, 0xA4, 0xAC, 0xB1,
-	0xB0, 0xAD, 0xA4, 0x97, 0x87, 0x77, 0x67, 0x55, 0x49, 0x42, 0x40, 0x46,
-	0x4F, 0x60, 0x75, 0x8A, 0xA0, 0xB3, 0xC1, 0xCA, 0xCF, 0xC9, 0xBC, 0xAC,
-	0x97, 0x80, 0x69, 0x56, 0x46, 0x3C, 0x38, 0x3B, 0x46, 0x56, 0x6A, 0x7F,
-	0x95, 0xA7, 0xB4, 0xBE, 0xC1, 0xC0, 0xB6, 0xA7, 0x98, 0x87, 0x77, 0x69,
-	0x5D, 0x57, 0x55, 0x57, 0x5E, 0x66, 0x72, 0x7E, 0x85, 0x8E, 0x94, 0x96,
-	0x97, 0x95, 0x92, 0x8E, 0x8A, 0x86, 0x83, 0x81, 0x83, 0x84, 0x86, 0x87,
-	0x86, 0x86, 0x82, 0x7F, 0x7B, 0x74, 0x6F, 0x67, 0x64, 0x62, 0x65, 0x6D,
-	0x75, 0x80, 0x8D, 0x9B, 0xA9, 0xB3, 0xB9, 0xBC, 0xB7, 0xAE, 0xA1, 0x91,
-	0x7C, 0x69, 0x58, 0x49, 0x3F, 0x3C, 0x3F, 0x49, 0x59, 0x6C, 0x82, 0x9A,
-	0xAC, 0xBF, 0xC9, 0xCE, 0xCA, 0xC1, 0xB1, 0x9C, 0x85, 0x70, 0x5C, 0x4B,
-	0x3F, 0x3C, 0x3E, 0x45, 0x55, 0x66, 0x7C, 0x8E, 0xA1, 0xAF, 0xB7, 0xBB,
-	0xBB, 0xB2, 0xA7, 0x9A, 0x8A, 0x7D, 0x70, 0x65, 0x61, 0x5E, 0x5E, 0x64,
-	0x6B, 0x73, 0x7D, 0x83, 0x88, 0x8B, 0x8F, 0x8F, 0x8D, 0x8B, 0x88, 0x86,
-	0x84, 0x87, 0x87, 0x88, 0x8C, 0x8F, 0x90, 0x90, 0x8D, 0x88, 0x83, 0x7C,
-	0x71, 0x6A, 0x62, 0x5B, 0x59, 0x5B, 0x62, 0x6C, 0x79, 0x89, 0x99, 0xA8,
-	0xB4, 0xBC, 0xC0, 0xBC, 0xB6, 0xA9, 0x97, 0x84, 0x6E, 0x59, 0x4A, 0x3E,
-	0x3B, 0x3B, 0x43, 0x53, 0x66, 0x7E, 0x95, 0xA9, 0xBB, 0xC8, 0xCB, 0xCA,
-	0xC2, 0xB4, 0xA1, 0x8D, 0x75, 0x62, 0x51, 0x45, 0x3F, 0x3F, 0x46, 0x54,
-	0x64, 0x75, 0x89, 0x99, 0xA7, 0xB1, 0xB3, 0xB4, 0xAE, 0xA6, 0x9A, 0x8C,
-	0x80, 0x77, 0x6E, 0x67, 0x66, 0x67, 0x6B, 0x71, 0x76, 0x7C, 0x7F, 0x84,
-	0x86, 0x85, 0x85, 0x85, 0x83, 0x82, 0x82, 0x83, 0x86, 0x8B, 0x8F, 0x94,
-	0x98, 0x9A, 0x9A, 0x97, 0x90, 0x87, 0x7E, 0x71, 0x66, 0x5C, 0x55, 0x50,
-	0x53, 0x5A, 0x63, 0x72, 0x83, 0x96, 0xA7, 0xB4, 0xBF, 0xC6, 0xC5, 0xBD,
-	0xAF, 0x9D, 0x89, 0x72, 0x5E, 0x4C, 0x3F, 0x38, 0x39, 0x40, 0x4D, 0x5F,
-	0x76, 0x8E, 0xA4, 0xB6, 0xC4, 0xCA, 0xCA, 0xC3, 0xB7, 0xA6, 0x92, 0x7C,
-	0x69, 0x58, 0x4C, 0x44, 0x44, 0x4B, 0x54, 0x61, 0x75, 0x83, 0x92, 0xA0,
-	0xA7, 0xAD, 0xAF, 0xAA, 0xA2, 0x99, 0x8D, 0x83, 0x7C, 0x75, 0x70, 0x6E,
-	0x6E, 0x72, 0x75, 0x79, 0x7D, 0x81, 0x80, 0x80, 0x80, 0x7E, 0x7C, 0x7C,
-	0x7D, 0x7D, 0x80, 0x87, 0x8D, 0x92, 0x9B, 0xA0, 0xA2, 0xA3, 0x9E, 0x96,
-	0x8C, 0x7F, 0x71, 0x65, 0x57, 0x4D, 0x48, 0x49, 0x4F, 0x5A, 0x69, 0x7C,
-	0x90, 0xA4, 0xB4, 0xC1, 0xC8, 0xC9, 0xC2, 0xB6, 0xA5, 0x90, 0x79, 0x63,
-	0x51, 0x41, 0x39, 0x38, 0x3D, 0x49, 0x5A, 0x71, 0x87, 0x9D, 0xB1, 0xBD,
-	0xC5, 0xC8, 0xC3, 0xB7, 0xA8, 0x95, 0x81, 0x6E, 0x5E, 0x52, 0x4B, 0x4A,
-	0x4D, 0x55, 0x63, 0x6F, 0x80, 0x8C, 0x97, 0xA0, 0xA5, 0xA5, 0xA3, 0x9D,
-	0x94, 0x8D, 0x86, 0x7F, 0x7B, 0x77, 0x79, 0x77, 0x79, 0x7D, 0x7E, 0x7F,
-	0x7F, 0x7E, 0x7B, 0x78, 0x75, 0x72, 0x71, 0x72, 0x76, 0x7C, 0x84, 0x8C,
-	0x96, 0x9F, 0xA7, 0xAC, 0xAC, 0xA7, 0x9F, 0x93, 0x84, 0x76, 0x66, 0x55,
-	0x4B, 0x44, 0x43, 0x47, 0x53, 0x62, 0x76, 0x8A, 0x9F, 0xB3, 0xC1, 0xC8,
-	0xCB, 0xC7, 0xBC, 0xAB, 0x97, 0x80, 0x69, 0x55, 0x44, 0x3B, 0x38, 0x3C,
-	0x48, 0x57, 0x6D, 0x81, 0x96, 0xAB, 0xB9, 0xC3, 0xC4, 0xC1, 0xB7, 0xA8,
-	0x99, 0x87, 0x76, 0x65, 0x5B, 0x53, 0x50, 0x53, 0x5A, 0x65, 0x71, 0x7D,
-	0x88, 0x91, 0x98, 0x9D, 0x9D, 0x9A, 0x97, 0x91, 0x8D, 0x87, 0x82, 0x80,
-	0x80, 0x81, 0x7F, 0x82, 0x81, 0x83, 0x81, 0x80, 0x7B, 0x77, 0x72, 0x6C,
-	0x6A, 0x69, 0x69, 0x6E, 0x77, 0x80, 0x8C, 0x9A, 0xA5, 0xAE, 0xB3, 0xB4,
-	0xB2, 0xA9, 0x9C, 0x8D, 0x7C, 0x68, 0x58, 0x49, 0x41, 0x3D, 0x41, 0x4A,
-	0x59, 0x6D, 0x83, 0x9A, 0xB0, 0xBE, 0xC9, 0xCC, 0xCA, 0xBF, 0xB0, 0x9C,
-	0x84, 0x6F, 0x5A, 0x49, 0x3E, 0x3A, 0x3C, 0x45, 0x55, 0x65, 0x7D, 0x8E,
-	0xA2, 0xB2, 0xBB, 0xBF, 0xBD, 0xB6, 0xAA, 0x9B, 0x8B, 0x7C, 0x6D, 0x62,
-	0x5B, 0x58, 0x5A, 0x5F, 0x66, 0x71, 0x7B, 0x82, 0x8C, 0x91, 0x93, 0x94,
-	0x93, 0x8F, 0x8D, 0x88, 0x86, 0x84, 0x85, 0x85, 0x87, 0x89, 0x8A, 0x8A,
-	0x8A, 0x85, 0x80, 0x7B, 0x72, 0x6C, 0x66, 0x60, 0x5E, 0x60, 0x66, 0x71,
-	0x7D, 0x88, 0x97, 0xA6, 0xB2, 0xBA, 0xBC, 0xBA, 0xB3, 0xA5, 0x94, 0x81,
-	0x6D, 0x59, 0x4B, 0x41, 0x3C, 0x3D, 0x44, 0x54, 0x67, 0x7E, 0x96, 0xAA,
-	0xBB, 0xC8, 0xCD, 0xCC, 0xC3, 0xB5, 0xA2, 0x8D, 0x77, 0x60, 0x4F, 0x44,
-	0x3D, 0x3D, 0x46, 0x52, 0x63, 0x77, 0x89, 0x9C, 0xAA, 0xB4, 0xB9, 0xB9,
-	0xB3, 0xAA, 0x9B, 0x8E, 0x80, 0x75, 0x6B, 0x64, 0x5F, 0x62, 0x66, 0x6B,
-	0x72, 0x7B, 0x81, 0x86, 0x8A, 0x8C, 0x8C, 0x8A, 0x88, 0x86, 0x85, 0x85,
-	0x85, 0x89, 0x8A, 0x8F, 0x91, 0x94, 0x92, 0x91, 0x8C, 0x85, 0x7F, 0x73,
-	0x68, 0x60, 0x59, 0x55, 0x57, 0x5D, 0x67, 0x74, 0x83, 0x95, 0xA5, 0xB4,
-	0xBE, 0xC2, 0xC2, 0xBA, 0xAD, 0x9C, 0x87, 0x72, 0x5E, 0x4D, 0x40, 0x39,
-	0x39, 0x41, 0x4F, 0x61, 0x77, 0x8E, 0xA5, 0xB8, 0xC5, 0xCC, 0xCB, 0xC4,
-	0xB7, 0xA5, 0x91, 0x7D, 0x66, 0x55, 0x48, 0x42, 0x41, 0x47, 0x53, 0x61,
-	0x71, 0x84, 0x93, 0xA2, 0xAC, 0xB0, 0xB2, 0xAF, 0xA4, 0x9A, 0x8F, 0x83,
-	0x79, 0x70, 0x6C, 0x6A, 0x6A, 0x6D, 0x71, 0x78, 0x7A, 0x80, 0x82, 0x83,
-	0x84, 0x83, 0x82, 0x81, 0x80, 0x80, 0x82, 0x87, 0x8B, 0x90, 0x96, 0x9B,
-	0x9E, 0x9D, 0x9B, 0x91, 0x89, 0x80, 0x72, 0x66, 0x5B, 0x52, 0x4C, 0x4F,
-	0x53, 0x5D, 0x6D, 0x7E, 0x90, 0xA3, 0xB3, 0xC0, 0xC6, 0xC7, 0xC1, 0xB4,
-	0xA3, 0x8E, 0x78, 0x62, 0x4F, 0x41, 0x39, 0x38, 0x3D, 0x4A, 0x5C, 0x72,
-	0x89, 0x9F, 0xB3, 0xC0, 0xC8, 0xCA, 0xC4, 0xB9, 0xA8, 0x95, 0x80, 0x6B,
-	0x5C, 0x4F, 0x46, 0x46, 0x4A, 0x54, 0x60, 0x70, 0x80, 0x8F, 0x9A, 0xA3,
-	0xAA, 0xAB, 0xA7, 0xA0, 0x97, 0x8F, 0x87, 0x7F, 0x78, 0x74, 0x71, 0x73,
-	0x74, 0x78, 0x7C, 0x7D, 0x80, 0x7F, 0x7F, 0x7E, 0x7B, 0x7A, 0x78, 0x79,
-	0x7B, 0x80, 0x87, 0x8B, 0x95, 0x9D, 0xA2, 0xA7, 0xA6, 0xA4, 0x9A, 0x90,
-	0x83, 0x75, 0x65, 0x57, 0x4D, 0x47, 0x47, 0x4B, 0x55, 0x64, 0x77, 0x8A,
-	0xA0, 0xB1, 0xC0, 0xC8, 0xCA, 0xC6, 0xBA, 0xA9, 0x96, 0x7F, 0x67, 0x54,
-	0x44, 0x3C, 0x38, 0x3B, 0x47, 0x57, 0x6C, 0x82, 0x99, 0xAD, 0xBB, 0xC3,
-	0xC6, 0xC4, 0xBA, 0xAA, 0x99, 0x86, 0x74, 0x64, 0x57, 0x4F, 0x4D, 0x4E,
-	0x58, 0x62, 0x6E, 0x7D, 0x88, 0x95, 0x9C, 0xA2, 0xA3, 0x9F, 0x9D, 0x95,
-	0x8E, 0x87, 0x81, 0x7E, 0x7B, 0x7A, 0x7C, 0x7E, 0x80, 0x7F, 0x80, 0x80,
-	0x7E, 0x7B, 0x77, 0x73, 0x6E, 0x6F, 0x70, 0x73, 0x7C, 0x83, 0x8C, 0x97,
-	0xA1, 0xA9, 0xAE, 0xB0, 0xAD, 0xA5, 0x9A, 0x89, 0x78, 0x68, 0x5A, 0x4B,
-	0x42, 0x40, 0x45, 0x4D, 0x5C, 0x6F, 0x85, 0x9A, 0xAD, 0xBF, 0xC9, 0xCC,
-	0xC9, 0xBE, 0xAF, 0x9B, 0x83, 0x6E, 0x58, 0x47, 0x3C, 0x38, 0x3B, 0x44,
-	0x53, 0x66, 0x7E, 0x92, 0xA4, 0xB5, 0xBE, 0xC3, 0xC2, 0xB8, 0xAC, 0x9C,
-	0x8B, 0x7A, 0x6A, 0x5F, 0x56, 0x53, 0x55, 0x5A, 0x63, 0x6E, 0x7B, 0x84,
-	0x8D, 0x94, 0x99, 0x9B, 0x98, 0x95, 0x90, 0x8C, 0x88, 0x84, 0x83, 0x82,
-	0x82, 0x83, 0x85, 0x86, 0x86, 0x83, 0x80, 0x7C, 0x76, 0x70, 0x6C, 0x66,
-	0x65, 0x66, 0x6B, 0x74, 0x80, 0x8B, 0x98, 0xA5, 0xB1, 0xB6, 0xBA, 0xB6,
-	0xAF, 0xA4, 0x92, 0x80, 0x6D, 0x5C, 0x4C, 0x41, 0x3E, 0x3E, 0x48, 0x56,
-	0x6A, 0x80, 0x94, 0xAC, 0xBC, 0xC8, 0xCE, 0xCA, 0xC3, 0xB4, 0xA1, 0x8A,
-	0x75, 0x60, 0x4D, 0x41, 0x3B, 0x3C, 0x45, 0x51, 0x62, 0x77, 0x8B, 0x9E,
-	0xAD, 0xB7, 0xBC, 0xBB, 0xB5, 0xAB, 0x9D, 0x8E, 0x7F, 0x71, 0x66, 0x5F,
-	0x5B, 0x5C, 0x60, 0x67, 0x71, 0x7A, 0x81, 0x88, 0x8D, 0x8F, 0x8F, 0x8F,
-	0x8D, 0x8A, 0x89, 0x85, 0x85, 0x86, 0x86, 0x89, 0x8C, 0x8E, 0x8E, 0x8C,
-	0x88, 0x82, 0x7D, 0x74, 0x6C, 0x64, 0x5D, 0x5C, 0x5C, 0x62, 0x6B, 0x77,
-	0x86, 0x95, 0xA5, 0xB1, 0xBB, 0xBF, 0xBD, 0xB6, 0xAA, 0x99, 0x85, 0x71,
-	0x5C, 0x4D, 0x3F, 0x3A, 0x3B, 0x41, 0x50, 0x62, 0x79, 0x90, 0xA6, 0xB9,
-	0xC5, 0xCC, 0xCA, 0xC4, 0xB9, 0xA4, 0x8F, 0x7A, 0x64, 0x53, 0x47, 0x3F,
-	0x3E, 0x43, 0x51, 0x5F, 0x73, 0x85, 0x96, 0xA4, 0xB0, 0xB6, 0xB6, 0xB2,
-	0xA9, 0x9D, 0x90, 0x82, 0x77, 0x6F, 0x68, 0x64, 0x65, 0x68, 0x6D, 0x72,
-	0x7A, 0x80, 0x84, 0x86, 0x89, 0x88, 0x86, 0x85, 0x83, 0x83, 0x85, 0x85,
-	0x89, 0x8C, 0x92, 0x96, 0x98, 0x98, 0x95, 0x90, 0x88, 0x7F, 0x74, 0x69,
-	0x5F, 0x57, 0x53, 0x53, 0x58, 0x61, 0x6F, 0x80, 0x91, 0xA4, 0xB3, 0xBE,
-	0xC3, 0xC2, 0xBE, 0xB2, 0xA0, 0x8C, 0x77, 0x63, 0x4F, 0x40, 0x39, 0x37,
-	0x3F, 0x4A, 0x5B, 0x73, 0x8A, 0xA0, 0xB4, 0xC3, 0xCA, 0xCB, 0xC5, 0xBA,
-	0xA9, 0x96, 0x80, 0x6C, 0x5B, 0x4C, 0x46, 0x42, 0x48, 0x51, 0x5E, 0x70,
-	0x80, 0x8E, 0x9E, 0xA8, 0xAE, 0xAF, 0xAB, 0xA5, 0x9A, 0x90, 0x85, 0x7B,
-	0x75, 0x6E, 0x6C, 0x6C, 0x6F, 0x72, 0x77, 0x7B, 0x7E, 0x7F, 0x81, 0x81,
-	0x80, 0x7E, 0x7D, 0x7E, 0x7F, 0x81, 0x87, 0x8B, 0x93, 0x9A, 0x9D, 0xA1,
-	0xA1, 0x9E, 0x98, 0x8D, 0x81, 0x75, 0x68, 0x5A, 0x50, 0x4B, 0x4A, 0x4E,
-	0x58, 0x66, 0x79, 0x8B, 0x9E, 0xB2, 0xBE, 0xC6, 0xC8, 0xC3, 0xB8, 0xA8,
-	0x94, 0x7E, 0x68, 0x53, 0x44, 0x3A, 0x37, 0x3B, 0x46, 0x57, 0x6C, 0x83,
-	0x9A, 0xAD, 0xBD, 0xC6, 0xC9, 0xC5, 0xBB, 0xAC, 0x9A, 0x84, 0x72, 0x61,
-	0x53, 0x4B, 0x48, 0x4B, 0x53, 0x5F, 0x6E, 0x7D, 0x8B, 0x95, 0x9F, 0xA5,
-	0xA6, 0xA4, 0x9F, 0x99, 0x8F, 0x87, 0x80, 0x7A, 0x76, 0x75, 0x75, 0x78,
-	0x7A, 0x7C, 0x7E, 0x7F, 0x7E, 0x7D, 0x7D, 0x77, 0x75, 0x74, 0x74, 0x77,
-	0x7D, 0x83, 0x8B, 0x94, 0x9D, 0xA6, 0xAA, 0xAB, 0xA9, 0xA0, 0x95, 0x88,
-	0x78, 0x68, 0x5C, 0x4E, 0x46, 0x43, 0x47, 0x51, 0x60, 0x71, 0x87, 0x9C,
-	0xAD, 0xBC, 0xC8, 0xCB, 0xC8, 0xBD, 0xAE, 0x9B, 0x82, 0x6D, 0x57, 0x47,
-	0x3C, 0x38, 0x3B, 0x43, 0x53, 0x67, 0x7E, 0x92, 0xA7, 0xB6, 0xC1, 0xC6,
-	0xC4, 0xBA, 0xAD, 0x9C, 0x8B, 0x78, 0x69, 0x5C, 0x54, 0x50, 0x51, 0x56,
-	0x61, 0x6E, 0x7B, 0x86, 0x91, 0x98, 0x9D, 0x9F, 0x9C, 0x9A, 0x93, 0x8F,
-	0x88, 0x82, 0x7F, 0x7E, 0x7E, 0x7E, 0x80, 0x81, 0x82, 0x81, 0x81, 0x7D,
-	0x7A, 0x74, 0x6F, 0x6C, 0x6A, 0x6B, 0x6F, 0x77, 0x7F, 0x8A, 0x97, 0xA1,
-	0xAB, 0xB2, 0xB3, 0xB1, 0xAB, 0x9D, 0x8F, 0x7F, 0x6C, 0x5B, 0x4C, 0x43,
-	0x3F, 0x41, 0x49, 0x57, 0x6A, 0x80, 0x97, 0xAB, 0xBC, 0xC8, 0xCD, 0xCB,
-	0xC2, 0xB4, 0xA0, 0x88, 0x72, 0x5D, 0x4C, 0x3F, 0x39, 0x3B, 0x42, 0x50,
-	0x61, 0x77, 0x8B, 0xA1, 0xB1, 0xBC, 0xC0, 0xC0, 0xB8, 0xAD, 0x9E, 0x8E,
-	0x7D, 0x6D, 0x63, 0x5A, 0x57, 0x57, 0x5C, 0x65, 0x6E, 0x79, 0x81, 0x89,
-	0x90, 0x96, 0x95, 0x95, 0x92, 0x8E, 0x8A, 0x87, 0x85, 0x83, 0x83, 0x85,
-	0x85, 0x88, 0x88, 0x88, 0x85, 0x81, 0x7C, 0x74, 0x6E, 0x68, 0x63, 0x60,
-	0x62, 0x69, 0x70, 0x79, 0x87, 0x95, 0xA2, 0xAF, 0xB7, 0xBC, 0xBB, 0xB3,
-	0xA8, 0x96, 0x84, 0x71, 0x5C, 0x4C, 0x40, 0x3D, 0x3C, 0x43, 0x52, 0x63,
-	0x7A, 0x90, 0xA7, 0xBA, 0xC5, 0xCC, 0xCB, 0xC4, 0xB7, 0xA4, 0x8F, 0x79,
-	0x62, 0x53, 0x44, 0x3D, 0x3D, 0x43, 0x4E, 0x60, 0x73, 0x86, 0x99, 0xAB,
-	0xB3, 0xBB, 0xBA, 0xB5, 0xAD, 0x9F, 0x91, 0x82, 0x76, 0x6B, 0x63, 0x61,
-	0x60, 0x63, 0x69, 0x71, 0x7A, 0x80, 0x85, 0x8A, 0x8C, 0x8D, 0x8D, 0x8A,
-	0x89, 0x86, 0x85, 0x85, 0x85, 0x8A, 0x8C, 0x90, 0x92, 0x92, 0x91, 0x8C,
-	0x85, 0x7E, 0x74, 0x6D, 0x62, 0x5B, 0x59, 0x58, 0x5D, 0x66, 0x72, 0x81,
-	0x92, 0xA3, 0xB1, 0xBC, 0xC2, 0xC2, 0xBB, 0xAF, 0x9F, 0x8B, 0x77, 0x61,
-	0x4F, 0x41, 0x3A, 0x3A, 0x3E, 0x4B, 0x5D, 0x73, 0x8A, 0xA1, 0xB4, 0xC4,
-	0xCB, 0xCC, 0xC7, 0xBB, 0xAA, 0x95, 0x7F, 0x69, 0x56, 0x49, 0x42, 0x41,
-	0x44, 0x4F, 0x5D, 0x6F, 0x81, 0x92, 0x9F, 0xAC, 0xB3, 0xB4, 0xB1, 0xA8,
-	0x9F, 0x92, 0x87, 0x7A, 0x72, 0x6B, 0x68, 0x67, 0x6B, 0x6F, 0x74, 0x79,
-	0x7F, 0x81, 0x84, 0x85, 0x84, 0x84, 0x82, 0x80, 0x7F, 0x83, 0x86, 0x88,
-	0x8F, 0x95, 0x99, 0x9B, 0x9C, 0x9A, 0x94, 0x8B, 0x80, 0x76, 0x69, 0x5E,
-	0x54, 0x50, 0x4E, 0x54, 0x5D, 0x6B, 0x7B, 0x8D, 0x9F, 0xB0, 0xBF, 0xC5,
-	0xC6, 0xC2, 0xB6, 0xA7, 0x91, 0x7D, 0x67, 0x53, 0x45, 0x3A, 0x38, 0x3C,
-	0x47, 0x58, 0x6C, 0x84, 0x9B, 0xAF, 0xC0, 0xC9, 0xCB, 0xC8, 0xBD, 0xAC,
-	0x99, 0x85, 0x71, 0x5F, 0x50, 0x48, 0x45, 0x46, 0x50, 0x5D, 0x6E, 0x7E,
-	0x8B, 0x9A, 0xA3, 0xAB, 0xAD, 0xAB, 0xA5, 0x9B, 0x90, 0x88, 0x80, 0x78,
-	0x73, 0x70, 0x6F, 0x72, 0x75, 0x79, 0x7C, 0x7E, 0x7F, 0x80, 0x7F, 0x7D,
-	0x7B, 0x7A, 0x79, 0x7B, 0x80, 0x84, 0x8C, 0x93, 0x9B, 0xA0, 0xA5, 0xA7,
-	0xA3, 0x9C, 0x93, 0x86, 0x78, 0x6A, 0x5C, 0x4F, 0x49, 0x46, 0x4A, 0x54,
-	0x61, 0x74, 0x86, 0x9D, 0xAF, 0xBD, 0xC8, 0xC9, 0xC6, 0xBE, 0xAD, 0x99,
-	0x82, 0x6D, 0x56, 0x46, 0x3C, 0x38, 0x3B, 0x45, 0x54, 0x68, 0x7F, 0x95,
-	0xAA, 0xBA, 0xC2, 0xC7, 0xC4, 0xBD, 0xAD, 0x9C, 0x8A, 0x78, 0x66, 0x58,
-	0x4F, 0x4B, 0x4D, 0x54, 0x5F, 0x6A, 0x7A, 0x87, 0x94, 0x9C, 0xA4, 0xA4,
-	0xA2, 0x9E, 0x97, 0x8F, 0x89, 0x82, 0x7E, 0x7A, 0x79, 0x7A, 0x7A, 0x7D,
-	0x80, 0x80, 0x80, 0x7F, 0x7D, 0x7A, 0x75, 0x72, 0x71, 0x70, 0x72, 0x7B,
-	0x81, 0x8B, 0x95, 0x9F, 0xA7, 0xAB, 0xAD, 0xAC, 0xA6, 0x9A, 0x8C, 0x7C,
-	0x6B, 0x5C, 0x4F, 0x44, 0x43, 0x44, 0x4B, 0x59, 0x6C, 0x81, 0x98, 0xAB,
-	0xBB, 0xC6, 0xCB, 0xC9, 0xC1, 0xB2, 0x9E, 0x89, 0x73, 0x5C, 0x4A, 0x3E,
-	0x38, 0x39, 0x40, 0x50, 0x63, 0x79, 0x8E, 0xA2, 0xB2, 0xBF, 0xC3, 0xC3,
-	0xBB, 0xB0, 0x9F, 0x8D, 0x7D, 0x6C, 0x5F, 0x57, 0x52, 0x52, 0x59, 0x61,
-	0x6D, 0x7A, 0x82, 0x8D, 0x95, 0x99, 0x9B, 0x9A, 0x97, 0x93, 0x8E, 0x86,
-	0x84, 0x81, 0x80, 0x81, 0x83, 0x83, 0x85, 0x84, 0x83, 0x81, 0x7E, 0x79,
-	0x72, 0x6D, 0x68, 0x66, 0x67, 0x6B, 0x73, 0x7B, 0x89, 0x94, 0xA1, 0xAD,
-	0xB5, 0xB8, 0xB6, 0xAF, 0xA3, 0x95, 0x83, 0x6F, 0x5E, 0x4F, 0x44, 0x3D,
-	0x3F, 0x46, 0x52, 0x65, 0x7B, 0x92, 0xA7, 0xB8, 0xC5, 0xCC, 0xCB, 0xC4,
-	0xB7, 0xA4, 0x8D, 0x77, 0x62, 0x50, 0x42, 0x3C, 0x3B, 0x41, 0x4D, 0x5F,
-	0x74, 0x87, 0x9B, 0xAB, 0xB6, 0xBD, 0xBF, 0xB9, 0xAD, 0xA1, 0x91, 0x81,
-	0x74, 0x68, 0x60, 0x5A, 0x5B, 0x5F, 0x65, 0x6E, 0x78, 0x80, 0x88, 0x8D,
-	0x91, 0x93, 0x91, 0x8F, 0x8C, 0x88, 0x86, 0x85, 0x85, 0x85, 0x87, 0x89,
-	0x8D, 0x8C, 0x8B, 0x88, 0x83, 0x7E, 0x76, 0x6E, 0x67, 0x61, 0x5E, 0x5E,
-	0x62, 0x6B, 0x77, 0x84, 0x93, 0xA1, 0xAF, 0xB8, 0xBE, 0xBC, 0xB7, 0xAB,
-	0x9D, 0x89, 0x75, 0x61, 0x50, 0x42, 0x3B, 0x3B, 0x41, 0x4E, 0x5F, 0x75,
-	0x8A, 0xA2, 0xB5, 0xC3, 0xCD, 0xCD, 0xC7, 0xBB, 0xA8, 0x94, 0x7E, 0x68,
-	0x55, 0x46, 0x3E, 0x3D, 0x42, 0x4D, 0x5C, 0x6D, 0x82, 0x95, 0xA5, 0xAE,
-	0xB7, 0xB8, 0xB3, 0xAD, 0xA0, 0x94, 0x84, 0x79, 0x6E, 0x68, 0x64, 0x62,
-	0x64, 0x6A, 0x72, 0x77, 0x7F, 0x84, 0x87, 0x89, 0x88, 0x89, 0x86, 0x83,
-	0x84, 0x83, 0x85, 0x87, 0x8B, 0x8F, 0x93, 0x97, 0x97, 0x94, 0x90, 0x89,
-	0x7F, 0x77, 0x6D, 0x62, 0x5A, 0x57, 0x54, 0x5A, 0x61, 0x6E, 0x7E, 0x8F,
-	0x9F, 0xB0, 0xBC, 0xC2, 0xC3, 0xBE, 0xB2, 0xA3, 0x91, 0x7B, 0x64, 0x52,
-	0x42, 0x3A, 0x38, 0x3C, 0x48, 0x59, 0x6D, 0x85, 0x9D, 0xAF, 0xBF, 0xC8,
-	0xCC, 0xC9, 0xBC, 0xAD, 0x9A, 0x83, 0x70, 0x5C, 0x4E, 0x45, 0x42, 0x44,
-	0x4E, 0x5B, 0x6C, 0x7F, 0x8E, 0x9B, 0xA7, 0xAF, 0xB1, 0xAE, 0xA8, 0x9F,
-	0x92, 0x87, 0x7E, 0x74, 0x6E, 0x6A, 0x6A, 0x6D, 0x70, 0x75, 0x7A, 0x7E,
-	0x80, 0x80, 0x81, 0x80, 0x80, 0x7E, 0x7D, 0x7F, 0x82, 0x85, 0x8B, 0x8E,
-	0x96, 0x9C, 0x9E, 0xA0, 0x9E, 0x97, 0x8D, 0x84, 0x78, 0x69, 0x5D, 0x54,
-	0x4D, 0x4C, 0x4D, 0x57, 0x66, 0x76, 0x88, 0x9E, 0xAF, 0xBC, 0xC5, 0xC8,
-	0xC4, 0xB9, 0xAA, 0x97, 0x80, 0x6B, 0x56, 0x45, 0x3C, 0x37, 0x39, 0x44,
-	0x54, 0x67, 0x7F, 0x96, 0xAA, 0xBB, 0xC5, 0xC9, 0xC7, 0xBD, 0xAF, 0x9E,
-	0x89, 0x75, 0x63, 0x55, 0x4B, 0x47, 0x49, 0x50, 0x5C, 0x6B, 0x7B, 0x89,
-	0x97, 0xA0, 0xA6, 0xA9, 0xA8, 0xA4, 0x9A, 0x91, 0x89, 0x81, 0x7B, 0x76,
-	0x74, 0x73, 0x75, 0x77, 0x7B, 0x7D, 0x80, 0x7F, 0x7E, 0x7D, 0x7A, 0x78,
-	0x76, 0x76, 0x78, 0x7D, 0x83, 0x89, 0x91, 0x9A, 0xA2, 0xA6, 0xA9, 0xA7,
-	0xA0, 0x97, 0x8A, 0x7C, 0x6C, 0x5E, 0x51, 0x47, 0x45, 0x47, 0x4E, 0x5C,
-	0x6F, 0x83, 0x98, 0xAC, 0xBB, 0xC7, 0xCC, 0xC8, 0xC0, 0xB2, 0x9E, 0x86,
-	0x71, 0x5D, 0x4A, 0x3D, 0x38, 0x3A, 0x42, 0x51, 0x63, 0x7A, 0x8F, 0xA5,
-	0xB5, 0xC1, 0xC7, 0xC4, 0xBE, 0xB0, 0xA1, 0x8D, 0x7C, 0x69, 0x5D, 0x53,
-	0x4F, 0x4E, 0x54, 0x5E, 0x6A, 0x77, 0x84, 0x8F, 0x96, 0x9D, 0x9F, 0x9E,
-	0x9C, 0x97, 0x91, 0x89, 0x83, 0x80, 0x7C, 0x7C, 0x7E, 0x80, 0x81, 0x80,
-	0x80, 0x80, 0x7E, 0x7C, 0x77, 0x72, 0x6E, 0x6C, 0x6B, 0x70, 0x75, 0x7D,
-	0x88, 0x93, 0x9F, 0xA8, 0xAE, 0xB1, 0xB0, 0xAA, 0x9F, 0x91, 0x82, 0x70,
-	0x5E, 0x50, 0x46, 0x3F, 0x41, 0x49, 0x55, 0x67, 0x7C, 0x94, 0xA6, 0xB9,
-	0xC5, 0xCA, 0xCB, 0xC4, 0xB6, 0xA4, 0x8E, 0x76, 0x61, 0x4E, 0x41, 0x3A,
-	0x3A, 0x40, 0x4C, 0x5E, 0x73, 0x89, 0x9E, 0xAF, 0xBA, 0xC0, 0xC1, 0xBB,
-	0xB1, 0xA2, 0x91, 0x81, 0x71, 0x64, 0x5B, 0x56, 0x57, 0x59, 0x60, 0x6B,
-	0x76, 0x82, 0x8A, 0x91, 0x95, 0x97, 0x96, 0x94, 0x91, 0x8B, 0x88, 0x84,
-	0x82, 0x83, 0x84, 0x85, 0x85, 0x88, 0x86, 0x84, 0x82, 0x7D, 0x77, 0x71,
-	0x6B, 0x66, 0x63, 0x63, 0x66, 0x6E, 0x78, 0x85, 0x93, 0x9F, 0xAD, 0xB5,
-	0xBA, 0xBA, 0xB5, 0xA9, 0x99, 0x89, 0x74, 0x62, 0x51, 0x44, 0x3D, 0x3E,
-	0x43, 0x4E, 0x60, 0x76, 0x8C, 0xA3, 0xB4, 0xC3, 0xCA, 0xCC, 0xC5, 0xBA,
-	0xA9, 0x94, 0x7C, 0x67, 0x54, 0x46, 0x3D, 0x3A, 0x42, 0x4A, 0x5B, 0x6F,
-	0x83, 0x97, 0xA6, 0xB3, 0xBA, 0xBB, 0xB7, 0xAF, 0xA2, 0x94, 0x84, 0x76,
-	0x6C, 0x63, 0x5F, 0x5E, 0x60, 0x67, 0x6E, 0x77, 0x7F, 0x85, 0x8B, 0x8E,
-	0x8F, 0x8E, 0x8C, 0x8A, 0x88, 0x87, 0x85, 0x86, 0x87, 0x8B, 0x8C, 0x8F,
-	0x90, 0x8F, 0x8C, 0x85, 0x80, 0x78, 0x6E, 0x64, 0x5E, 0x59, 0x5A, 0x5E,
-	0x66, 0x72, 0x80, 0x90, 0x9E, 0xAE, 0xB9, 0xBF, 0xC0, 0xBB, 0xB0, 0xA0,
-	0x8E, 0x7B, 0x65, 0x52, 0x43, 0x3A, 0x38, 0x3E, 0x49, 0x59, 0x6D, 0x86,
-	0x9D, 0xB1, 0xC0, 0xCA, 0xCC, 0xC8, 0xBE, 0xAE, 0x9A, 0x81, 0x6E, 0x5A,
-	0x4B, 0x42, 0x3F, 0x42, 0x4C, 0x5B, 0x6C, 0x80, 0x90, 0x9F, 0xAB, 0xB3,
-	0xB5, 0xB4, 0xAB, 0xA0, 0x95, 0x88, 0x7D, 0x72, 0x6C, 0x66, 0x65, 0x68,
-	0x6B, 0x72, 0x78, 0x7E, 0x81, 0x84, 0x85, 0x85, 0x85, 0x83, 0x81, 0x81,
-	0x82, 0x85, 0x87, 0x8C, 0x91, 0x94, 0x9A, 0x9A, 0x97, 0x94, 0x8C, 0x81,
-	0x7A, 0x6C, 0x60, 0x58, 0x52, 0x51, 0x54, 0x5C, 0x6A, 0x78, 0x8B, 0x9E,
-	0xAD, 0xBB, 0xC2, 0xC6, 0xC2, 0xB7, 0xA9, 0x96, 0x81, 0x6B, 0x55, 0x46,
-	0x3B, 0x38, 0x3B, 0x44, 0x54, 0x69, 0x80, 0x97, 0xAA, 0xBB, 0xC7, 0xCA,
-	0xC9, 0xBF, 0xAF, 0x9E, 0x87, 0x73, 0x62, 0x52, 0x49, 0x44, 0x46, 0x4E,
-	0x5B, 0x6B, 0x7B, 0x89, 0x9A, 0xA4, 0xAB, 0xAE, 0xAD, 0xA7, 0x9F, 0x95,
-	0x8B, 0x80, 0x7A, 0x73, 0x6F, 0x6E, 0x6F, 0x73, 0x77, 0x7B, 0x7F, 0x80,
-	0x81, 0x80, 0x7F, 0x7D, 0x7B, 0x7B, 0x7D, 0x7F, 0x83, 0x88, 0x8F, 0x97,
-	0x9C, 0xA2, 0xA3, 0xA0, 0x9C, 0x92, 0x88, 0x7B, 0x6D, 0x5E, 0x52, 0x4C,
-	0x48, 0x4C, 0x53, 0x60, 0x6F, 0x83, 0x99, 0xAB, 0xBB, 0xC5, 0xC9, 0xC5,
-	0xBE, 0xB0, 0x9D, 0x87, 0x6F, 0x59, 0x49, 0x3D, 0x37, 0x39, 0x42, 0x4F,
-	0x63, 0x7B, 0x91, 0xA5, 0xB7, 0xC3, 0xC7, 0xC6, 0xBF, 0xB2, 0xA0, 0x8E,
-	0x7A, 0x68, 0x59, 0x4F, 0x49, 0x49, 0x4F, 0x5B, 0x68, 0x77, 0x84, 0x90,
-	0x9C, 0xA3, 0xA5, 0xA5, 0xA1, 0x9B, 0x91, 0x89, 0x82, 0x7D, 0x79, 0x77,
-	0x78, 0x79, 0x7B, 0x7D, 0x7F, 0x81, 0x80, 0x7E, 0x7B, 0x79, 0x73, 0x72,
-	0x70, 0x73, 0x78, 0x7F, 0x89, 0x90, 0x9A, 0xA4, 0xAA, 0xAC, 0xAA, 0xA3,
-	0x9B, 0x8F, 0x7F, 0x6D, 0x60, 0x50, 0x48, 0x44, 0x44, 0x4A, 0x58, 0x69,
-	0x7E, 0x93, 0xA9, 0xBB, 0xC5, 0xCB, 0xCA, 0xC4, 0xB5, 0xA2, 0x8D, 0x76,
-	0x5E, 0x4D, 0x40, 0x39, 0x39, 0x40, 0x4D, 0x5F, 0x74, 0x8B, 0xA0, 0xB0,
-	0xBD, 0xC3, 0xC4, 0xBF, 0xB2, 0xA3, 0x92, 0x80, 0x6F, 0x61, 0x57, 0x52,
-	0x52, 0x55, 0x5E, 0x6A, 0x76, 0x82, 0x8E, 0x94, 0x99, 0x9C, 0x9D, 0x9A,
-	0x94, 0x90, 0x8A, 0x85, 0x82, 0x80, 0x80, 0x80, 0x81, 0x83, 0x83, 0x83,
-	0x80, 0x7F, 0x7A, 0x75, 0x71, 0x6B, 0x68, 0x67, 0x6C, 0x72, 0x7A, 0x85,
-	0x92, 0xA0, 0xA9, 0xB1, 0xB5, 0xB4, 0xAF, 0xA4, 0x96, 0x86, 0x74, 0x61,
-	0x50, 0x46, 0x3F, 0x3F, 0x44, 0x51, 0x60, 0x77, 0x8D, 0xA3, 0xB6, 0xC3,
-	0xCB, 0xCC, 0xC7, 0xB9, 0xA7, 0x93, 0x7D, 0x66, 0x52, 0x43, 0x3B, 0x3A,
-	0x3F, 0x4A, 0x5A, 0x6F, 0x84, 0x99, 0xAA, 0xB6, 0xBE, 0xBF, 0xBB, 0xB2,
-	0xA3, 0x95, 0x84, 0x77, 0x68, 0x5F, 0x5A, 0x58, 0x5B, 0x61, 0x6C, 0x75,
-	0x7F, 0x88, 0x8D, 0x92, 0x94, 0x93, 0x91, 0x8E, 0x8A, 0x89, 0x85, 0x84,
-	0x84, 0x86, 0x88, 0x89, 0x8B, 0x8A, 0x86, 0x84, 0x7E, 0x78, 0x70, 0x6A,
-	0x64, 0x5F, 0x5E, 0x63, 0x6B, 0x75, 0x82, 0x8F, 0x9E, 0xAA, 0xB6, 0xBB,
-	0xBC, 0xB8, 0xAE, 0x9F, 0x8D, 0x7A, 0x64, 0x54, 0x46, 0x3C, 0x3C, 0x3F,
-	0x49, 0x5A, 0x6F, 0x87, 0x9E, 0xB1, 0xC2, 0xCA, 0xCD, 0xC9, 0xBD, 0xAC,
-	0x97, 0x7F, 0x6B, 0x58, 0x49, 0x3F, 0x3C, 0x40, 0x48, 0x58, 0x6A, 0x7E,
-	0x92, 0xA1, 0xAF, 0xB7, 0xB9, 0xB7, 0xAF, 0xA4, 0x96, 0x88, 0x7B, 0x72,
-	0x67, 0x62, 0x61, 0x63, 0x6A, 0x6E, 0x78, 0x7E, 0x84, 0x8A, 0x89, 0x8C,
-	0x8C, 0x89, 0x87, 0x85, 0x85, 0x85, 0x87, 0x89, 0x8D, 0x90, 0x93, 0x94,
-	0x91, 0x8F, 0x89, 0x81, 0x79, 0x6E, 0x65, 0x5D, 0x58, 0x57, 0x58, 0x60,
-	0x6C, 0x7B, 0x8A, 0x9D, 0xAC, 0xB8, 0xBF, 0xC2, 0xBF, 0xB5, 0xA6, 0x93,
-	0x80, 0x69, 0x56, 0x46, 0x3B, 0x38, 0x3C, 0x45, 0x54, 0x69, 0x80, 0x98,
-	0xAD, 0xBD, 0xC9, 0xCC, 0xC9, 0xBF, 0xB0, 0x9D, 0x88, 0x72, 0x60, 0x4F,
-	0x44, 0x40, 0x42, 0x4B, 0x59, 0x6A, 0x7C, 0x8B, 0x9B, 0xA7, 0xAF, 0xB3,
-	0xB2, 0xAB, 0xA1, 0x94, 0x8A, 0x7F, 0x75, 0x70, 0x6B, 0x69, 0x6C, 0x6F,
-	0x74, 0x79, 0x7D, 0x80, 0x83, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81,
-	0x85, 0x88, 0x8C, 0x94, 0x99, 0x9D, 0x9E, 0x9D, 0x98, 0x90, 0x86, 0x7A,
-	0x6D, 0x61, 0x57, 0x50, 0x4D, 0x4F, 0x58, 0x63, 0x74, 0x85, 0x99, 0xAB,
-	0xB9, 0xC2, 0xC8, 0xC5, 0xBB, 0xAD, 0x9C, 0x84, 0x70, 0x5A, 0x4A, 0x3D,
-	0x37, 0x39, 0x42, 0x4F, 0x64, 0x7C, 0x93, 0xA7, 0xB9, 0xC4, 0xC9, 0xC9,
-	0xC1, 0xB2, 0xA1, 0x8D, 0x79, 0x66, 0x56, 0x4B, 0x46, 0x48, 0x4D, 0x58,
-	0x67, 0x77, 0x86, 0x93, 0x9F, 0xA6, 0xAA, 0xAA, 0xA6, 0x9D, 0x94, 0x8B,
-	0x82, 0x7C, 0x76, 0x75, 0x73, 0x74, 0x76, 0x7A, 0x7B, 0x7D, 0x80, 0x80,
-	0x7F, 0x7D, 0x7B, 0x79, 0x78, 0x7B, 0x7C, 0x81, 0x88, 0x91, 0x98, 0x9F,
-	0xA5, 0xA7, 0xA6, 0xA1, 0x97, 0x8A, 0x7E, 0x6F, 0x60, 0x54, 0x49, 0x47,
-	0x47, 0x4E, 0x5C, 0x6C, 0x80, 0x96, 0xA7, 0xB9, 0xC4, 0xC9, 0xCA, 0xC2,
-	0xB4, 0xA2, 0x8C, 0x76, 0x5F, 0x4D, 0x3E, 0x39, 0x39, 0x3F, 0x4C, 0x5E,
-	0x75, 0x8B, 0xA0, 0xB0, 0xBF, 0xC5, 0xC7, 0xC0, 0xB4, 0xA3, 0x91, 0x7F,
-	0x6D, 0x5E, 0x52, 0x4C, 0x4C, 0x52, 0x5A, 0x66, 0x75, 0x81, 0x8E, 0x99,
-	0x9F, 0xA1, 0xA2, 0x9F, 0x99, 0x92, 0x8B, 0x84, 0x7F, 0x7D, 0x7B, 0x7B,
-	0x7C, 0x7E, 0x7F, 0x80, 0x80, 0x7F, 0x7D, 0x79, 0x74, 0x71, 0x6E, 0x6D,
-	0x70, 0x77, 0x7D, 0x87, 0x90, 0x9A, 0xA5, 0xAD, 0xB0, 0xB1, 0xAB, 0x9F,
-	0x93, 0x83, 0x74, 0x62, 0x54, 0x47, 0x41, 0x41, 0x48, 0x53, 0x62, 0x79,
-	0x90, 0xA3, 0xB6, 0xC4, 0xCC, 0xCC, 0xC6, 0xB9, 0xA8, 0x92, 0x7C, 0x65,
-	0x50, 0x42, 0x3B, 0x37, 0x3E, 0x4A, 0x5A, 0x6F, 0x85, 0x99, 0xAB, 0xB9,
-	0xC1, 0xC2, 0xBE, 0xB3, 0xA5, 0x95, 0x83, 0x73, 0x65, 0x5B, 0x54, 0x53,
-	0x57, 0x5E, 0x68, 0x75, 0x80, 0x88, 0x90, 0x97, 0x98, 0x98, 0x97, 0x92,
-	0x8E, 0x8A, 0x86, 0x82, 0x81, 0x82, 0x81, 0x84, 0x87, 0x86, 0x85, 0x81,
-	0x7E, 0x7B, 0x74, 0x6D, 0x69, 0x64, 0x64, 0x67, 0x6E, 0x76, 0x82, 0x91,
-	0x9D, 0xA9, 0xB3, 0xB9, 0xB9, 0xB5, 0xAA, 0x9C, 0x8A, 0x78, 0x64, 0x52,
-	0x46, 0x3F, 0x3C, 0x41, 0x4D, 0x5C, 0x71, 0x88, 0x9F, 0xB3, 0xC1, 0xCB,
-	0xCD, 0xC8, 0xBB, 0xAC, 0x99, 0x80, 0x6B, 0x56, 0x47, 0x3E, 0x3A, 0x3E,
-	0x47, 0x58, 0x6B, 0x81, 0x92, 0xA4, 0xB2, 0xBB, 0xBD, 0xB9, 0xB1, 0xA6,
-	0x98, 0x86, 0x78, 0x6D, 0x63, 0x5C, 0x5B, 0x5D, 0x63, 0x6B, 0x75, 0x7E,
-	0x82, 0x8A, 0x8F, 0x90, 0x90, 0x8E, 0x8C, 0x87, 0x87, 0x87, 0x84, 0x86,
-	0x88, 0x8B, 0x8F, 0x8F, 0x8E, 0x8D, 0x86, 0x80, 0x78, 0x71, 0x69, 0x60,
-	0x5D, 0x5B, 0x5E, 0x65, 0x70, 0x7C, 0x8C, 0x9B, 0xAA, 0xB7, 0xBD, 0xBE,
-	0xBC, 0xB2, 0xA2, 0x91, 0x7D, 0x69, 0x56, 0x46, 0x3D, 0x3B, 0x3D, 0x46,
-	0x57, 0x6A, 0x81, 0x98, 0xAD, 0xBF, 0xC9, 0xCE, 0xCA, 0xC1, 0xB1, 0x9D,
-	0x86, 0x70, 0x5E, 0x4D, 0x42, 0x3D, 0x40, 0x48, 0x57, 0x67, 0x7A, 0x8E,
-	0x9D, 0xAC, 0xB3, 0xB6, 0xB5, 0xAE, 0xA4, 0x97, 0x89, 0x7E, 0x74, 0x6A,
-	0x65, 0x65, 0x64, 0x6A, 0x70, 0x76, 0x7C, 0x81, 0x85, 0x87, 0x87, 0x86,
-	0x86, 0x84, 0x83, 0x83, 0x84, 0x87, 0x8A, 0x8D, 0x94, 0x97, 0x99, 0x97,
-	0x94, 0x8B, 0x84, 0x7A, 0x6F, 0x64, 0x5A, 0x55, 0x52, 0x55, 0x5B, 0x67,
-	0x76, 0x86, 0x9A, 0xA9, 0xB8, 0xC2, 0xC3, 0xC1, 0xB9, 0xAC, 0x97, 0x83,
-	0x6E, 0x59, 0x48, 0x3E, 0x38, 0x3A, 0x42, 0x51, 0x65, 0x7C, 0x94, 0xA8,
-	0xBA, 0xC5, 0xCC, 0xC9, 0xC1, 0xB3, 0xA1, 0x8E, 0x77, 0x65, 0x53, 0x49,
-	0x43, 0x44, 0x4C, 0x56, 0x66, 0x76, 0x86, 0x96, 0xA3, 0xAC, 0xB0, 0xAF,
-	0xA9, 0xA1, 0x97, 0x8C, 0x80, 0x7A, 0x74, 0x6E, 0x6D, 0x6C, 0x70, 0x76,
-	0x7B, 0x7E, 0x80, 0x81, 0x80, 0x80, 0x7F, 0x7D, 0x7D, 0x7E, 0x80, 0x82,
-	0x89, 0x8E, 0x94, 0x9B, 0xA0, 0xA1, 0xA1, 0x9C, 0x94, 0x89, 0x7D, 0x71,
-	0x63, 0x57, 0x4E, 0x4A, 0x4B, 0x52, 0x5F, 0x6E, 0x81, 0x95, 0xA9, 0xB7,
-	0xC3, 0xC8, 0xC6, 0xBF, 0xB3, 0xA0, 0x8B, 0x74, 0x5E, 0x4C, 0x3E, 0x39,
-	0x3A, 0x3F, 0x4D, 0x60, 0x75, 0x8D, 0xA3, 0xB5, 0xC1, 0xC9, 0xC9, 0xC1,
-	0xB5, 0xA5, 0x92, 0x7E, 0x6B, 0x5A, 0x4E, 0x4A, 0x4A, 0x4E, 0x58, 0x66,
-	0x76, 0x84, 0x90, 0x9A, 0xA3, 0xA7, 0xA7, 0xA4, 0x9C, 0x94, 0x8C, 0x84,
-	0x7F, 0x7A, 0x77, 0x76, 0x77, 0x79, 0x7B, 0x7E, 0x7F, 0x7F, 0x7F, 0x7D,
-	0x79, 0x76, 0x73, 0x74, 0x76, 0x79, 0x7F, 0x87, 0x8F, 0x98, 0xA0, 0xA7,
-	0xAB, 0xAA, 0xA4, 0x9C, 0x8F, 0x80, 0x72, 0x61, 0x54, 0x49, 0x45, 0x44,
-	0x4A, 0x56, 0x67, 0x7A, 0x90, 0xA3, 0xB5, 0xC3, 0xCA, 0xCB, 0xC4, 0xB8,
-	0xA6, 0x91, 0x7B, 0x64, 0x50, 0x41, 0x3A, 0x38, 0x3E, 0x4A, 0x5C, 0x71,
-	0x85, 0x9C, 0xAE, 0xBD, 0xC4, 0xC5, 0xC1, 0xB7, 0xA6, 0x94, 0x82, 0x72,
-	0x62, 0x56, 0x51, 0x4E, 0x53, 0x5B, 0x66, 0x73, 0x7F, 0x8B, 0x94, 0x9B,
-	0x9E, 0x9F, 0x9C, 0x97, 0x92, 0x8B, 0x85, 0x83, 0x7F, 0x7E, 0x7E, 0x80,
-	0x81, 0x83, 0x83, 0x81, 0x80, 0x7C, 0x77, 0x72, 0x6E, 0x6A, 0x6A, 0x6D,
-	0x71, 0x7A, 0x83, 0x8F, 0x9A, 0xA5, 0xAD, 0xB2, 0xB2, 0xAF, 0xA6, 0x98,
-	0x88, 0x75, 0x65, 0x54, 0x47, 0x3F, 0x3E, 0x44, 0x4E, 0x5E, 0x72, 0x89,
-	0xA0, 0xB4, 0xC2, 0xCB, 0xCD, 0xC8, 0xBD, 0xAB, 0x97, 0x80, 0x6B, 0x57,
-	0x46, 0x3C, 0x3A, 0x3C, 0x48, 0x57, 0x6C, 0x80, 0x95, 0xA6, 0xB5, 0xBE,
-	0xC0, 0xBC, 0xB4, 0xA7, 0x97, 0x87, 0x78, 0x6A, 0x5E, 0x57, 0x57, 0x5A,
-	0x61, 0x68, 0x72, 0x7D, 0x86, 0x8D, 0x93, 0x95, 0x96, 0x93, 0x90, 0x8C,
-	0x88, 0x86, 0x83, 0x82, 0x82, 0x86, 0x87, 0x89, 0x88, 0x85, 0x84, 0x7F,
-	0x7A, 0x73, 0x6C, 0x65, 0x62, 0x60, 0x63, 0x6B, 0x74, 0x7F, 0x8D, 0x9B,
-	0xA9, 0xB3, 0xBA, 0xBC, 0xB8, 0xAE, 0xA0, 0x91, 0x7D, 0x67, 0x57, 0x47,
-	0x3D, 0x3A, 0x3E, 0x47, 0x58, 0x6C, 0x83, 0x9B, 0xAD, 0xBF, 0xCA, 0xCC,
-	0xCB, 0xC0, 0xB1, 0x9D, 0x86, 0x6F, 0x5C, 0x4B, 0x42, 0x3C, 0x3F, 0x48,
-	0x55, 0x68, 0x7D, 0x8E, 0xA0, 0xAE, 0xB7, 0xBB, 0xBA, 0xB2, 0xA6, 0x99,
-	0x8A, 0x7D, 0x71, 0x67, 0x60, 0x5E, 0x61, 0x65, 0x6B, 0x74, 0x7D, 0x83,
-	0x89, 0x8B, 0x8D, 0x8B, 0x8B, 0x89, 0x85, 0x86, 0x85, 0x86, 0x88, 0x8C,
-	0x8F, 0x90, 0x92, 0x92, 0x90, 0x8A, 0x81, 0x7B, 0x70, 0x67, 0x60, 0x59,
-	0x57, 0x5A, 0x60, 0x6B, 0x79, 0x88, 0x99, 0xA8, 0xB5, 0xBE, 0xC1, 0xBF,
-	0xB7, 0xA8, 0x97, 0x82, 0x6C, 0x59, 0x48, 0x3E, 0x39, 0x3A, 0x44, 0x52,
-	0x65, 0x7D, 0x94, 0xA9, 0xBB, 0xC6, 0xCB, 0xCA, 0xC3, 0xB4, 0xA2, 0x8C,
-	0x77, 0x61, 0x51, 0x45, 0x40, 0x42, 0x49, 0x56, 0x63, 0x77, 0x89, 0x98,
-	0xA5, 0xB0, 0xB4, 0xB3, 0xAD, 0xA4, 0x99, 0x8D, 0x82, 0x77, 0x6E, 0x6A,
-	0x67, 0x68, 0x6C, 0x72, 0x78, 0x7D, 0x80, 0x84, 0x85, 0x86, 0x83, 0x84,
-	0x81, 0x80, 0x80, 0x83, 0x88, 0x8C, 0x92, 0x96, 0x9A, 0x9D, 0x9C, 0x99,
-	0x90, 0x87, 0x7E, 0x72, 0x65, 0x5B, 0x52, 0x4E, 0x50, 0x58, 0x62, 0x6F,
-	0x83, 0x95, 0xA8, 0xB6, 0xBF, 0xC6, 0xC5, 0xBD, 0xAE, 0x9E, 0x89, 0x74,
-	0x5E, 0x4B, 0x3F, 0x38, 0x39, 0x3F, 0x4C, 0x60, 0x76, 0x8E, 0xA4, 0xB8,
-	0xC3, 0xCA, 0xCA, 0xC3, 0xB5, 0xA5, 0x91, 0x7C, 0x69, 0x57, 0x4E, 0x45,
-	0x45, 0x4A, 0x56, 0x64, 0x72, 0x84, 0x91, 0x9D, 0xA7, 0xAB, 0xAC, 0xA6,
-	0xA1, 0x98, 0x8D, 0x84, 0x7D, 0x76, 0x73, 0x70, 0x71, 0x75, 0x77, 0x7A,
-	0x7E, 0x7F, 0x7F, 0x80, 0x81, 0x7D, 0x7A, 0x7A, 0x7A, 0x7D, 0x81, 0x87,
-	0x8F, 0x96, 0x9C, 0xA3, 0xA5, 0xA6, 0xA0, 0x98, 0x8D, 0x81, 0x72, 0x64,
-	0x57, 0x4D, 0x48, 0x48, 0x4F, 0x5A, 0x69, 0x7E, 0x91, 0xA3, 0xB5, 0xC2,
-	0xC8, 0xC9, 0xC2, 0xB7, 0xA5, 0x90, 0x7A, 0x64, 0x4E, 0x42, 0x39, 0x38,
-	0x3E, 0x4A, 0x5A, 0x71, 0x88, 0x9D, 0xB1, 0xBD, 0xC6, 0xC8, 0xC3, 0xB8,
-	0xA8, 0x96, 0x81, 0x6F, 0x60, 0x54, 0x4D, 0x4B, 0x4F, 0x58, 0x62, 0x72,
-	0x7F, 0x8D, 0x97, 0xA0, 0xA2, 0xA3, 0xA0, 0x9B, 0x93, 0x8B, 0x85, 0x80,
-	0x7C, 0x79, 0x78, 0x7A, 0x7C, 0x7E, 0x7F, 0x80, 0x7F, 0x7D, 0x7B, 0x77,
-	0x74, 0x72, 0x6F, 0x72, 0x76, 0x7C, 0x85, 0x8D, 0x98, 0xA2, 0xA9, 0xAE,
-	0xAD, 0xA9, 0xA1, 0x95, 0x85, 0x75, 0x64, 0x55, 0x4A, 0x43, 0x41, 0x46,
-	0x51, 0x61, 0x75, 0x8A, 0x9F, 0xB2, 0xC1, 0xC9, 0xCB, 0xC7, 0xBD, 0xAB,
-	0x95, 0x7F, 0x68, 0x54, 0x44, 0x3A, 0x38, 0x3C, 0x46, 0x58, 0x6C, 0x80,
-	0x96, 0xAA, 0xB7, 0xC1, 0xC3, 0xC0, 0xB6, 0xA8, 0x98, 0x85, 0x76, 0x66,
-	0x5B, 0x54, 0x52, 0x53, 0x5A, 0x65, 0x70, 0x7C, 0x87, 0x8F, 0x96, 0x9A,
-	0x9C, 0x99, 0x96, 0x90, 0x8A, 0x87, 0x83, 0x80, 0x80, 0x82, 0x81, 0x84,
-	0x84, 0x84, 0x81, 0x80, 0x7C, 0x76, 0x71, 0x6B, 0x68, 0x65, 0x68, 0x6E,
-	0x76, 0x82, 0x8E, 0x9A, 0xA5, 0xAF, 0xB5, 0xB6, 0xB4, 0xA9, 0x9D, 0x8E,
-	0x7C, 0x68, 0x55, 0x4A, 0x42, 0x3D, 0x41, 0x4B, 0x58, 0x6E, 0x85, 0x9A,
-	0xAE, 0xC0, 0xC9, 0xCC, 0xC9, 0xC1, 0xB1, 0x9C, 0x85, 0x70, 0x5B, 0x4A,
-	0x3F, 0x3A, 0x3C, 0x46, 0x55, 0x67, 0x7C, 0x90, 0xA2, 0xB3, 0xBA, 0xBE,
-	0xBC, 0xB4, 0xA8, 0x9A, 0x8A, 0x7C, 0x6E, 0x62, 0x5D, 0x5A, 0x5B, 0x61,
-	0x68, 0x71, 0x7C, 0x83, 0x8B, 0x8E, 0x91, 0x92, 0x91, 0x8E, 0x8A, 0x87,
-	0x85, 0x85, 0x86, 0x87, 0x88, 0x8B, 0x8C, 0x8C, 0x8A, 0x87, 0x80, 0x7B,
-	0x73, 0x6C, 0x64, 0x5F, 0x5D, 0x5F, 0x65, 0x70, 0x7D, 0x8A, 0x99, 0xA6,
-	0xB4, 0xBC, 0xBF, 0xBC, 0xB2, 0xA4, 0x94, 0x80, 0x6C, 0x59, 0x48, 0x3F,
-	0x3A, 0x3B, 0x43, 0x53, 0x67, 0x7D, 0x95, 0xAB, 0xBA, 0xC6, 0xCC, 0xCB,
-	0xC2, 0xB3, 0xA0, 0x8B, 0x75, 0x60, 0x50, 0x42, 0x3E, 0x3E, 0x46, 0x53,
-	0x64, 0x77, 0x8A, 0x9D, 0xA9, 0xB3, 0xB8, 0xB7, 0xB1, 0xA7, 0x9B, 0x8D,
-	0x7F, 0x75, 0x6B, 0x65, 0x63, 0x62, 0x67, 0x6D, 0x74, 0x7A, 0x80, 0x86,
-	0x88, 0x89, 0x88, 0x87, 0x87, 0x84, 0x84, 0x84, 0x87, 0x89, 0x8C, 0x90,
-	0x96, 0x97, 0x97, 0x95, 0x8D, 0x85, 0x7E, 0x72, 0x69, 0x5F, 0x58, 0x54,
-	0x56, 0x5A, 0x66, 0x73, 0x84, 0x96, 0xA6, 0xB4, 0xBE, 0xC3, 0xC2, 0xBB,
-	0xAD, 0x9B, 0x86, 0x72, 0x5D, 0x4B, 0x3F, 0x38, 0x39, 0x41, 0x4E, 0x60,
-	0x79, 0x8F, 0xA5, 0xB7, 0xC4, 0xCC, 0xCB, 0xC4, 0xB7, 0xA4, 0x91, 0x7B,
-	0x67, 0x56, 0x49, 0x42, 0x42, 0x46, 0x53, 0x63, 0x74, 0x84, 0x95, 0xA2,
-	0xAB, 0xB0, 0xB2, 0xAC, 0xA4, 0x99, 0x8E, 0x84, 0x78, 0x72, 0x6C, 0x6A,
-	0x6C, 0x6E, 0x73, 0x77, 0x7C, 0x7F, 0x81, 0x82, 0x81, 0x81, 0x80, 0x7E,
-	0x7E, 0x80, 0x83, 0x87, 0x8D, 0x93, 0x99, 0x9D, 0x9F, 0xA0, 0x9B, 0x95,
-	0x8B, 0x80, 0x73, 0x65, 0x5A, 0x50, 0x4C, 0x4C, 0x52, 0x5D, 0x6B, 0x7F,
-	0x91, 0xA4, 0xB6, 0xC0, 0xC7, 0xC6, 0xC1, 0xB3, 0xA2, 0x8D, 0x78, 0x61,
-	0x4E, 0x41, 0x39, 0x37, 0x3D, 0x49, 0x5B, 0x72, 0x89, 0x9F, 0xB1, 0xC1,
-	0xC9, 0xC9, 0xC6, 0xBA, 0xA9, 0x95, 0x81, 0x6E, 0x5D, 0x4F, 0x48, 0x46,
-	0x4C, 0x56, 0x60, 0x71, 0x80, 0x8E, 0x9A, 0xA3, 0xA7, 0xA9, 0xA5, 0x9F,
-	0x98, 0x8E, 0x86, 0x7F, 0x78, 0x76, 0x74, 0x74, 0x77, 0x7A, 0x7B, 0x7D,
-	0x80, 0x7F, 0x7E, 0x7B, 0x78, 0x76, 0x75, 0x76, 0x79, 0x7E, 0x84, 0x8D,
-	0x95, 0x9D, 0xA5, 0xA8, 0xA8, 0xA4, 0x9D, 0x92, 0x83, 0x75, 0x66, 0x59,
-	0x4D, 0x47, 0x44, 0x49, 0x55, 0x63, 0x78, 0x8C, 0xA0, 0xB3, 0xC0, 0xC9,
-	0xCA, 0xC6, 0xBB, 0xAB, 0x96, 0x7F, 0x66, 0x55, 0x44, 0x39, 0x3A, 0x3D,
-	0x47, 0x56, 0x6C, 0x83, 0x9A, 0xAC, 0xBA, 0xC4, 0xC6, 0xC3, 0xB8, 0xAA,
-	0x99, 0x85, 0x74, 0x65, 0x58, 0x51, 0x4C, 0x51, 0x59, 0x63, 0x70, 0x7E,
-	0x8B, 0x94, 0x9B, 0x9E, 0xA1, 0x9E, 0x99, 0x92, 0x8C, 0x86, 0x82, 0x7F,
-	0x7D, 0x7D, 0x7C, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7C, 0x79, 0x74, 0x6F,
-	0x6C, 0x6B, 0x6C, 0x70, 0x78, 0x82, 0x8C, 0x97, 0xA0, 0xAA, 0xB0, 0xB2,
-	0xAD, 0xA6, 0x99, 0x8C, 0x7B, 0x68, 0x58, 0x4B, 0x43, 0x40, 0x44, 0x4C,
-	0x5C, 0x70, 0x85, 0x9C, 0xB0, 0xC1, 0xC8, 0xCC, 0xC9, 0xC0, 0xAE, 0x9B,
-	0x84, 0x6D, 0x5A, 0x49, 0x3C, 0x39, 0x3B, 0x45, 0x53, 0x67, 0x7D, 0x92,
-	0xA6, 0xB4, 0xBF, 0xC2, 0xBE, 0xB7, 0xAA, 0x9B, 0x89, 0x7A, 0x6A, 0x5F,
-	0x58, 0x55, 0x56, 0x5C, 0x65, 0x6F, 0x7B, 0x83, 0x8B, 0x93, 0x96, 0x97,
-	0x96, 0x94, 0x8E, 0x8A, 0x85, 0x83, 0x82, 0x82, 0x81, 0x86, 0x87, 0x89,
-	0x86, 0x84, 0x80, 0x7A, 0x76, 0x6F, 0x68, 0x63, 0x62, 0x64, 0x69, 0x73,
-	0x7F, 0x8A, 0x99, 0xA7, 0xB1, 0xB8, 0xBA, 0xB9, 0xB0, 0xA3, 0x92, 0x7F,
-	0x6B, 0x59, 0x4A, 0x41, 0x3B, 0x3D, 0x46, 0x54, 0x69, 0x7F, 0x95, 0xAB,
-	0xBC, 0xC8, 0xCC, 0xCB, 0xC3, 0xB3, 0xA0, 0x8A, 0x73, 0x5E, 0x4E, 0x41,
-	0x3B, 0x3D, 0x44, 0x53, 0x63, 0x78, 0x8B, 0x9E, 0xAE, 0xB8, 0xBC, 0xBA,
-	0xB5, 0xA9, 0x9D, 0x8D, 0x7F, 0x73, 0x67, 0x61, 0x5E, 0x5F, 0x62, 0x69,
-	0x72, 0x7B, 0x81, 0x88, 0x8D, 0x8F, 0x8F, 0x8E, 0x8B, 0x89, 0x87, 0x86,
-	0x86, 0x87, 0x88, 0x8C, 0x8F, 0x90, 0x91, 0x8E, 0x8A, 0x83, 0x7C, 0x74,
-	0x6A, 0x63, 0x5C, 0x59, 0x5B, 0x60, 0x6A, 0x78, 0x86, 0x96, 0xA6, 0xB3,
-	0xBB, 0xC0, 0xBE, 0xB8, 0xAA, 0x99, 0x86, 0x70, 0x5D, 0x4C, 0x40, 0x3A,
-	0x38, 0x41, 0x4E, 0x61, 0x79, 0x8F, 0xA5, 0xB8, 0xC5, 0xCC, 0xCB, 0xC5,
-	0xB8, 0xA5, 0x8F, 0x79, 0x66, 0x53, 0x47, 0x40, 0x40, 0x45, 0x51, 0x60,
-	0x73, 0x86, 0x95, 0xA4, 0xAF, 0xB4, 0xB5, 0xB1, 0xA7, 0x9B, 0x8F, 0x82,
-	0x77, 0x6F, 0x69, 0x65, 0x67, 0x69, 0x6E, 0x73, 0x7B, 0x80, 0x83, 0x86,
-	0x86, 0x85, 0x84, 0x82, 0x81, 0x82, 0x84, 0x85, 0x89, 0x8E, 0x93, 0x97,
-	0x98, 0x9A, 0x97, 0x90, 0x87, 0x80, 0x75, 0x68, 0x5E, 0x56, 0x52, 0x51,
-	0x58, 0x61, 0x6E, 0x7F, 0x91, 0xA3, 0xB3, 0xBD, 0xC4, 0xC5, 0xBE, 0xB2,
-	0xA1, 0x8C, 0x78, 0x61, 0x4F, 0x41, 0x3A, 0x37, 0x3E, 0x49, 0x5B, 0x73,
-	0x8A, 0xA0, 0xB2, 0xC1, 0xC9, 0xCB, 0xC6, 0xBA, 0xA8, 0x95, 0x80, 0x6C,
-	0x5A, 0x4D, 0x45, 0x45, 0x49, 0x52, 0x5F, 0x71, 0x80, 0x90, 0x9E, 0xA9,
-	0xAD, 0xAE, 0xA9, 0xA4, 0x9A, 0x8F, 0x86, 0x7D, 0x76, 0x71, 0x6F, 0x6F,
-	0x72, 0x75, 0x79, 0x7C, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7D, 0x7C, 0x7B,
-	0x7F, 0x81, 0x86, 0x8B, 0x93, 0x99, 0xA0, 0xA3, 0xA3, 0xA0, 0x99, 0x8F,
-	0x82, 0x73, 0x65, 0x5A, 0x4F, 0x4A, 0x48, 0x4E, 0x57, 0x66, 0x79, 0x8D,
-	0x9F, 0xB2, 0xC2, 0xC8, 0xC7, 0xC4, 0xBA, 0xA7, 0x94, 0x7C, 0x67, 0x53,
-	0x43, 0x3B, 0x38, 0x3C, 0x48, 0x56, 0x6C, 0x83, 0x9A, 0xAE, 0xBA, 0xC5,
-	0xC8, 0xC5, 0xBC, 0xAA, 0x98, 0x85, 0x74, 0x61, 0x55, 0x4C, 0x4B, 0x4C,
-	0x55, 0x61, 0x6E, 0x7D, 0x8A, 0x96, 0x9F, 0xA5, 0xA6, 0xA3, 0x9E, 0x96,
-	0x8E, 0x89, 0x81, 0x7C, 0x79, 0x77, 0x77, 0x79, 0x7B, 0x7E, 0x7F, 0x7E,
-	0x7E, 0x7E, 0x79, 0x76, 0x74, 0x71, 0x73, 0x76, 0x7C, 0x83, 0x8B, 0x96,
-	0xA0, 0xA6, 0xAB, 0xAB, 0xA9, 0xA2, 0x96, 0x88, 0x7A, 0x67, 0x58, 0x4D,
-	0x46, 0x43, 0x46, 0x50, 0x5E, 0x73, 0x86, 0x9C, 0xB0, 0xBE, 0xC9, 0xCB,
-	0xC7, 0xBD, 0xAE, 0x99, 0x84, 0x6D, 0x56, 0x46, 0x3B, 0x36, 0x3A, 0x44,
-	0x53, 0x66, 0x7D, 0x92, 0xA7, 0xB6, 0xBF, 0xC4, 0xC0, 0xBA, 0xAC, 0x9B,
-	0x8A, 0x79, 0x69, 0x5C, 0x55, 0x51, 0x52, 0x59, 0x61, 0x6D, 0x7B, 0x85,
-	0x90, 0x95, 0x9B, 0x9D, 0x9C, 0x97, 0x91, 0x8C, 0x87, 0x84, 0x80, 0x80,
-	0x80, 0x81, 0x82, 0x83, 0x82, 0x80, 0x80, 0x7C, 0x77, 0x72, 0x6D, 0x69,
-	0x67, 0x69, 0x6F, 0x75, 0x7F, 0x8C, 0x98, 0xA3, 0xAD, 0xB3, 0xB6, 0xB2,
-	0xAB, 0xA0, 0x90, 0x7F, 0x6D, 0x5C, 0x4C, 0x44, 0x3E, 0x40, 0x47, 0x57,
-	0x6B, 0x80, 0x96, 0xAB, 0xBD, 0xC8, 0xCE, 0xCC, 0xC2, 0xB3, 0xA0, 0x88,
-	0x73, 0x5D, 0x4C, 0x41, 0x39, 0x3C, 0x42, 0x51, 0x63, 0x79, 0x8C, 0x9F,
-	0xAF, 0xB9, 0xBF, 0xBD, 0xB7, 0xAC, 0x9E, 0x8E, 0x7E, 0x71, 0x65, 0x5C,
-	0x58, 0x59, 0x5E, 0x66, 0x6F, 0x7A, 0x82, 0x8A, 0x8F, 0x92, 0x94, 0x94,
-	0x90, 0x8D, 0x8A, 0x87, 0x85, 0x84, 0x84, 0x87, 0x89, 0x8A, 0x8A, 0x8A,
-	0x86, 0x82, 0x7C, 0x76, 0x6E, 0x67, 0x63, 0x5F, 0x61, 0x66, 0x6E, 0x79,
-	0x88, 0x96, 0xA5, 0xB0, 0xBA, 0xBD, 0xBB, 0xB5, 0xA7, 0x98, 0x85, 0x71,
-	0x5D, 0x4E, 0x40, 0x3B, 0x3C, 0x42, 0x52, 0x64, 0x7B, 0x90, 0xA7, 0xB9,
-	0xC5, 0xCC, 0xCC, 0xC5, 0xB7, 0xA5, 0x90, 0x78, 0x62, 0x52, 0x44, 0x3C,
-	0x3C, 0x43, 0x4F, 0x60, 0x74, 0x85, 0x97, 0xA7, 0xB2, 0xB9, 0xBA, 0xB3,
-	0xAA, 0x9D, 0x90, 0x82, 0x77, 0x6B, 0x65, 0x61, 0x61, 0x65, 0x6A, 0x72,
-	0x7A, 0x81, 0x86, 0x88, 0x8B, 0x8B, 0x8A, 0x89, 0x87, 0x84, 0x85, 0x83,
-	0x88, 0x8B, 0x8E, 0x92, 0x93, 0x93, 0x92, 0x8E, 0x87, 0x7E, 0x75, 0x6B,
-	0x62, 0x5A, 0x57, 0x56, 0x5B, 0x65, 0x73, 0x81, 0x93, 0xA5, 0xB2, 0xBC,
-	0xC1, 0xC3, 0xBC, 0xB1, 0x9F, 0x8C, 0x76, 0x60, 0x4F, 0x41, 0x3A, 0x38,
-	0x40, 0x4B, 0x5C, 0x72, 0x89, 0xA1, 0xB5, 0xC4, 0xCB, 0xCC, 0xC5, 0xBB,
-	0xAA, 0x94, 0x7F, 0x6A, 0x57, 0x4B, 0x41, 0x3F, 0x48, 0x4F, 0x5E, 0x70,
-	0x81, 0x91, 0xA1, 0xAC, 0xB2, 0xB3, 0xAF, 0xA9, 0x9D, 0x90, 0x86, 0x7C,
-	0x72, 0x6D, 0x69, 0x69, 0x6B, 0x71, 0x74, 0x7A, 0x80, 0x82, 0x84, 0x83,
-	0x83, 0x81, 0x80, 0x7F, 0x7F, 0x82, 0x85, 0x8B, 0x8F, 0x95, 0x9B, 0x9E,
-	0x9E, 0x9B, 0x95, 0x8C, 0x80, 0x75, 0x69, 0x5D, 0x54, 0x4F, 0x4D, 0x52,
-	0x5C, 0x68, 0x7A, 0x8C, 0xA0, 0xB0, 0xBD, 0xC5, 0xC6, 0xC2, 0xB5, 0xA7,
-	0x92, 0x7C, 0x65, 0x50, 0x43, 0x39, 0x37, 0x3C, 0x47, 0x58, 0x6E, 0x85,
-	0x9C, 0xAF, 0xBE, 0xC9, 0xCB, 0xC6, 0xBC, 0xAB, 0x99, 0x85, 0x71, 0x5E,
-	0x52, 0x48, 0x46, 0x47, 0x51, 0x5F, 0x6E, 0x7D, 0x8C, 0x99, 0xA3, 0xA9,
-	0xAA, 0xA9, 0xA2, 0x99, 0x90, 0x87, 0x7F, 0x79, 0x74, 0x72, 0x72, 0x75,
-	0x77, 0x79, 0x7D, 0x7E, 0x7F, 0x7E, 0x7E, 0x7B, 0x78, 0x77, 0x78, 0x7B,
-	0x7F, 0x84, 0x8B, 0x92, 0x9C, 0xA2, 0xA6, 0xA6, 0xA4, 0x9E, 0x93, 0x85,
-	0x79, 0x69, 0x5A, 0x4F, 0x47, 0x45, 0x4A, 0x52, 0x62, 0x74, 0x88, 0x9D,
-	0xAF, 0xBF, 0xC7, 0xCA, 0xC7, 0xBC, 0xAC, 0x99, 0x81, 0x6B, 0x57, 0x46,
-	0x3B, 0x38, 0x3A, 0x44, 0x54, 0x68, 0x7E, 0x95, 0xA9, 0xB9, 0xC3, 0xC7,
-	0xC4, 0xBB, 0xAE, 0x9C, 0x8A, 0x77, 0x67, 0x59, 0x50, 0x4C, 0x4E, 0x55,
-	0x5E, 0x6C, 0x7A, 0x85, 0x92, 0x9A, 0xA1, 0xA2, 0xA1, 0x9C, 0x96, 0x8F,
-	0x88, 0x82, 0x7E, 0x7C, 0x7A, 0x7B, 0x7D, 0x7F, 0x7F, 0x80, 0x80, 0x7E,
-	0x7B, 0x77, 0x73, 0x6E, 0x6C, 0x6E, 0x71, 0x78, 0x80, 0x89, 0x95, 0x9F,
-	0xA8, 0xAF, 0xAF, 0xAD, 0xA7, 0x9A, 0x8C, 0x7D, 0x6B, 0x5B, 0x4E, 0x45,
-	0x41, 0x43, 0x4A, 0x59, 0x6C, 0x81, 0x98, 0xAC, 0xBC, 0xC7, 0xCC, 0xCB,
-	0xC2, 0xB2, 0xA0, 0x88, 0x72, 0x5D, 0x4C, 0x3E, 0x38, 0x3B, 0x42, 0x51,
-	0x63, 0x78, 0x8E, 0xA3, 0xB2, 0xBE, 0xC2, 0xC1, 0xBC, 0xAF, 0x9F, 0x8E,
-	0x7F, 0x6C, 0x61, 0x58, 0x54, 0x55, 0x5B, 0x61, 0x6D, 0x7A, 0x82, 0x8B,
-	0x93, 0x99, 0x99, 0x99, 0x95, 0x90, 0x8C, 0x87, 0x83, 0x82, 0x81, 0x81,
-	0x83, 0x84, 0x85, 0x85, 0x83, 0x80, 0x7B, 0x76, 0x70, 0x6A, 0x66, 0x63,
-	0x64, 0x69, 0x71, 0x7C, 0x88, 0x94, 0xA2, 0xAD, 0xB4, 0xB9, 0xB9, 0xB0,
-	0xA5, 0x95, 0x83, 0x70, 0x5C, 0x4D, 0x43, 0x3F, 0x3E, 0x45, 0x52, 0x65,
-	0x7B, 0x93, 0xA8, 0xBA, 0xC6, 0xCC, 0xCB, 0xC5, 0xB8, 0xA5, 0x8F, 0x77,
-	0x62, 0x50, 0x42, 0x3C, 0x3C, 0x41, 0x4F, 0x61, 0x74, 0x89, 0x9B, 0xAB,
-	0xB6, 0xBC, 0xBD, 0xB7, 0xAE, 0xA0, 0x91, 0x82, 0x76, 0x6A, 0x61, 0x5C,
-	0x5C, 0x5F, 0x66, 0x70, 0x79, 0x80, 0x87, 0x8C, 0x90, 0x90, 0x8F, 0x8D,
-	0x8B, 0x88, 0x85, 0x84, 0x86, 0x89, 0x88, 0x8C, 0x8D, 0x8E, 0x8D, 0x88,
-	0x84, 0x7E, 0x76, 0x6E, 0x65, 0x5F, 0x5B, 0x5D, 0x61, 0x6A, 0x76, 0x84,
-	0x93, 0xA2, 0xB0, 0xBA, 0xBF, 0xBE, 0xB8, 0xAC, 0x9D, 0x8A, 0x74, 0x61,
-	0x4F, 0x42, 0x3B, 0x3B, 0x40, 0x4D, 0x5E, 0x74, 0x8A, 0xA3, 0xB5, 0xC2,
-	0xCB, 0xCD, 0xC7, 0xB8, 0xAA, 0x94, 0x7E, 0x68, 0x55, 0x49, 0x40, 0x3E,
-	0x43, 0x4F, 0x5D, 0x6F, 0x82, 0x94, 0xA3, 0xAE, 0xB5, 0xB7, 0xB2, 0xAB,
-	0x9F, 0x92, 0x85, 0x79, 0x70, 0x68, 0x64, 0x64, 0x68, 0x6C, 0x73, 0x77,
-	0x7F, 0x83, 0x87, 0x88, 0x88, 0x86, 0x85, 0x85, 0x83, 0x84, 0x85, 0x89,
-	0x8C, 0x91, 0x94, 0x97, 0x97, 0x95, 0x91, 0x89, 0x80, 0x76, 0x6A, 0x60,
-	0x58, 0x53, 0x51, 0x57, 0x5F, 0x6D, 0x7E, 0x8F, 0xA2, 0xB0, 0xBD, 0xC2,
-	0xC4, 0xBE, 0xB4, 0xA5, 0x90, 0x7B, 0x65, 0x53, 0x43, 0x3B, 0x38, 0x3E,
-	0x47, 0x59, 0x6E, 0x85, 0x9C, 0xB1, 0xC0, 0xC8, 0xCB, 0xC5, 0xBC, 0xAC,
-	0x99, 0x83, 0x70, 0x5D, 0x4D, 0x44, 0x42, 0x47, 0x4F, 0x5C, 0x6D, 0x7E,
-	0x8F, 0x9C, 0xA7, 0xAD, 0xB0, 0xAE, 0xA6, 0x9D, 0x91, 0x88, 0x7F, 0x77,
-	0x72, 0x6C, 0x6E, 0x6E, 0x73, 0x77, 0x7B, 0x81, 0x81, 0x7F, 0x81, 0x80,
-	0x7F, 0x7D, 0x7D, 0x7F, 0x81, 0x85, 0x8A, 0x91, 0x96, 0x9E, 0xA1, 0xA2,
-	0x9F, 0x99, 0x90, 0x84, 0x78, 0x6A, 0x5E, 0x52, 0x4A, 0x49, 0x4E, 0x57,
-	0x63, 0x77, 0x88, 0x9D, 0xAF, 0xBE, 0xC6, 0xC8, 0xC4, 0xBB, 0xAB, 0x98,
-	0x81, 0x6A, 0x56, 0x46, 0x3A, 0x39, 0x3B, 0x45, 0x53, 0x68, 0x7F, 0x97,
-	0xAB, 0xBB, 0xC5, 0xC9, 0xC6, 0xBC, 0xAF, 0x9F, 0x89, 0x75, 0x63, 0x56,
-	0x4B, 0x48, 0x4A, 0x50, 0x5D, 0x6B, 0x79, 0x88, 0x94, 0x9C, 0xA4, 0xA9,
-	0xA6, 0xA0, 0x9A, 0x91, 0x88, 0x80, 0x7C, 0x76, 0x75, 0x76, 0x78, 0x7A,
-	0x7B, 0x7F, 0x7F, 0x7F, 0x7D, 0x7C, 0x79, 0x75, 0x73, 0x75, 0x76, 0x7B,
-	0x82, 0x8A, 0x92, 0x9B, 0xA2, 0xAA, 0xAA, 0xA8, 0xA4, 0x96, 0x8A, 0x7A,
-	0x69, 0x5B, 0x4F, 0x46, 0x42, 0x45, 0x4E, 0x5C, 0x6F, 0x83, 0x97, 0xAC,
-	0xBB, 0xC6, 0xCB, 0xC9, 0xBF, 0xB0, 0x9D, 0x87, 0x71, 0x5B, 0x49, 0x3E,
-	0x38, 0x39, 0x42, 0x4F, 0x63, 0x7A, 0x91, 0xA5, 0xB4, 0xC0, 0xC5, 0xC4,
-	0xBD, 0xB0, 0x9F, 0x8E, 0x7D, 0x6A, 0x5E, 0x55, 0x4F, 0x50, 0x56, 0x5F,
-	0x6B, 0x79, 0x83, 0x8F, 0x96, 0x9C, 0x9E, 0x9E, 0x9B, 0x95, 0x8F, 0x89,
-	0x85, 0x80, 0x7F, 0x7D, 0x7E, 0x80, 0x81, 0x82, 0x82, 0x80, 0x7E, 0x79,
-	0x76, 0x70, 0x6D, 0x6B, 0x6A, 0x6D, 0x75, 0x80, 0x87, 0x94, 0xA0, 0xAA,
-	0xB0, 0xB4, 0xB2, 0xAC, 0x9F, 0x92, 0x82, 0x6F, 0x5D, 0x4F, 0x45, 0x3F,
-	0x40, 0x47, 0x54, 0x68, 0x7E, 0x92, 0xA8, 0xBA, 0xC7, 0xCC, 0xCB, 0xC5,
-	0xB5, 0xA2, 0x8D, 0x76, 0x61, 0x4E, 0x41, 0x3A, 0x3B, 0x40, 0x4D, 0x5F,
-	0x73, 0x89, 0x9E, 0xAE, 0xB9, 0xBE, 0xBF, 0xBA, 0xAE, 0xA1, 0x92, 0x80,
-	0x72, 0x65, 0x5C, 0x57, 0x56, 0x5C, 0x62, 0x6D, 0x78, 0x80, 0x89, 0x91,
-	0x94, 0x96, 0x97, 0x92, 0x8F, 0x8C, 0x87, 0x84, 0x83, 0x84, 0x84, 0x86,
-	0x88, 0x8A, 0x88, 0x85, 0x81, 0x7E, 0x77, 0x70, 0x69, 0x63, 0x61, 0x62,
-	0x66, 0x6E, 0x78, 0x86, 0x93, 0xA1, 0xAD, 0xB7, 0xBB, 0xBB, 0xB5, 0xA9,
-	0x9C, 0x88, 0x74, 0x60, 0x50, 0x44, 0x3D, 0x3C, 0x41, 0x4D, 0x5F, 0x76,
-	0x8D, 0xA3, 0xB5, 0xC4, 0xCB, 0xCB, 0xC6, 0xB9, 0xA8, 0x93, 0x7B, 0x64,
-	0x54, 0x45, 0x3D, 0x3A, 0x41, 0x4C, 0x5C, 0x6F, 0x83, 0x94, 0xA6, 0xB2,
-	0xB9, 0xBB, 0xB6, 0xAD, 0xA1, 0x93, 0x85, 0x76, 0x6E, 0x64, 0x5F, 0x5E,
-	0x62, 0x67, 0x6F, 0x78, 0x7F, 0x86, 0x89, 0x8C, 0x8D, 0x8B, 0x8A, 0x88,
-	0x86, 0x84, 0x85, 0x87, 0x89, 0x8D, 0x90, 0x93, 0x92, 0x90, 0x8D, 0x86,
-	0x80, 0x77, 0x6D, 0x65, 0x5E, 0x57, 0x57, 0x5B, 0x64, 0x72, 0x7F, 0x8F,
-	0xA0, 0xAF, 0xB9, 0xC1, 0xC1, 0xBC, 0xB1, 0xA1, 0x8F, 0x79, 0x65, 0x52,
-	0x44, 0x3B, 0x39, 0x3E, 0x49, 0x59, 0x6E, 0x86, 0x9C, 0xB1, 0xC1, 0xC9,
-	0xCC, 0xC8, 0xBD, 0xAD, 0x98, 0x82, 0x6E, 0x5B, 0x4C, 0x41, 0x40, 0x43,
-	0x4B, 0x5A, 0x6C, 0x7F, 0x90, 0x9F, 0xAA, 0xB1, 0xB4, 0xB1, 0xA9, 0xA0,
-	0x94, 0x87, 0x7D, 0x73, 0x6C, 0x68, 0x68, 0x69, 0x6E, 0x74, 0x7A, 0x7E,
-	0x81, 0x83, 0x86, 0x85, 0x84, 0x84, 0x80, 0x82, 0x83, 0x85, 0x89, 0x8E,
-	0x94, 0x98, 0x9C, 0x9D, 0x9B, 0x95, 0x8C, 0x83, 0x78, 0x6C, 0x61, 0x57,
-	0x50, 0x4D, 0x53, 0x5B, 0x67, 0x76, 0x89, 0x9C, 0xAF, 0xBB, 0xC3, 0xC7,
-	0xC2, 0xB8, 0xAB, 0x96, 0x80, 0x6A, 0x56, 0x47, 0x3B, 0x38, 0x3B, 0x44,
-	0x54, 0x68, 0x81, 0x97, 0xAA, 0xBB, 0xC7, 0xCB, 0xC6, 0xBE, 0xAF, 0x9C,
-	0x87, 0x74, 0x62, 0x51, 0x49, 0x43, 0x45, 0x4E, 0x5A, 0x6A, 0x7A, 0x89,
-	0x96, 0xA2, 0xA8, 0xAC, 0xAA, 0xA4, 0x9C, 0x91, 0x88, 0x80, 0x78, 0x73,
-	0x70, 0x6F, 0x71, 0x75, 0x7A, 0x7B, 0x7E, 0x80, 0x7F, 0x80, 0x7E, 0x7C,
-	0x7A, 0x79, 0x7C, 0x80, 0x84, 0x8A, 0x91, 0x99, 0xA0, 0xA4, 0xA5, 0xA4,
-	0x9D, 0x94, 0x88, 0x7A, 0x6C, 0x5D, 0x51, 0x4B, 0x46, 0x48, 0x51, 0x5F,
-	0x70, 0x85, 0x98, 0xAB, 0xBC, 0xC5, 0xCA, 0xC8, 0xBE, 0xB0, 0x9D, 0x87,
-	0x71, 0x5B, 0x49, 0x3E, 0x38, 0x39, 0x42, 0x50, 0x64, 0x7D, 0x91, 0xA5,
-	0xB8, 0xC2, 0xC8, 0xC6, 0xBF, 0xB1, 0xA1, 0x8D, 0x7A, 0x67, 0x5A, 0x50,
-	0x4A, 0x4A, 0x52, 0x5C, 0x69, 0x77, 0x83, 0x91, 0x9B, 0xA1, 0xA4, 0xA3,
-	0x9F, 0x98, 0x91, 0x8A, 0x83, 0x7E, 0x7A, 0x78, 0x79, 0x7B, 0x7E, 0x7E,
-	0x81, 0x80, 0x7D, 0x7E, 0x7A, 0x77, 0x71, 0x70, 0x6F, 0x73, 0x79, 0x80,
-	0x88, 0x91, 0x9B, 0xA5, 0xAB, 0xAF, 0xAD, 0xA6, 0x9B, 0x8F, 0x80, 0x70,
-	0x5F, 0x50, 0x46, 0x42, 0x44, 0x49, 0x57, 0x69, 0x7E, 0x95, 0xAA, 0xBA,
-	0xC5, 0xCC, 0xCB, 0xC3, 0xB7, 0xA3, 0x8C, 0x76, 0x60, 0x4C, 0x40, 0x3A,
-	0x3A, 0x40, 0x4D, 0x5F, 0x75, 0x8C, 0xA0, 0xB0, 0xBC, 0xC2, 0xC2, 0xBD,
-	0xB2, 0xA1, 0x90, 0x80, 0x6F, 0x61, 0x57, 0x51, 0x51, 0x58, 0x5F, 0x6A,
-	0x76, 0x81, 0x8B, 0x92, 0x97, 0x9B, 0x9A, 0x98, 0x93, 0x8F, 0x8A, 0x85,
-	0x82, 0x81, 0x80, 0x81, 0x84, 0x84, 0x84, 0x83, 0x81, 0x7D, 0x79, 0x73,
-	0x6E, 0x69, 0x66, 0x66, 0x68, 0x6F, 0x7A, 0x85, 0x92, 0x9F, 0xAA, 0xB4,
-	0xB7, 0xB6, 0xB1, 0xA6, 0x98, 0x85, 0x73, 0x60, 0x52, 0x45, 0x3E, 0x3E,
-	0x44, 0x4E, 0x62, 0x77, 0x8C, 0xA4, 0xB6, 0xC3, 0xCC, 0xCD, 0xC6, 0xB9,
-	0xA8, 0x93, 0x7C, 0x67, 0x53, 0x45, 0x3C, 0x3A, 0x40, 0x4C, 0x5C, 0x6F,
-	0x85, 0x97, 0xA8, 0xB6, 0xBD, 0xBD, 0xBA, 0xB1, 0xA3, 0x94, 0x83, 0x76,
-	0x6A, 0x60, 0x5A, 0x5A, 0x5D, 0x63, 0x6C, 0x75, 0x7F, 0x87, 0x8E, 0x91,
-	0x93, 0x90, 0x8F, 0x8D, 0x89, 0x86, 0x86, 0x85, 0x85, 0x89, 0x8A, 0x8B,
-	0x8D, 0x8B, 0x8A, 0x85, 0x7F, 0x78, 0x71, 0x69, 0x62, 0x5D, 0x5D, 0x60,
-	0x67, 0x74, 0x80, 0x8E, 0x9E, 0xAE, 0xB8, 0xBD, 0xBF, 0xB9, 0xAE, 0xA0,
-	0x8D, 0x7B, 0x63, 0x53, 0x44, 0x3B, 0x3A, 0x3F, 0x4B, 0x59, 0x70, 0x87,
-	0x9F, 0xB2, 0xC2, 0xCB, 0xCD, 0xC9, 0xBC, 0xAD, 0x99, 0x82, 0x6D, 0x5A,
-	0x4A, 0x40, 0x3E, 0x40, 0x4A, 0x59, 0x6C, 0x80, 0x92, 0xA2, 0xAF, 0xB5,
-	0xB8, 0xB4, 0xAE, 0xA2, 0x95, 0x87, 0x7B, 0x70, 0x68, 0x63, 0x62, 0x64,
-	0x69, 0x70, 0x77, 0x7D, 0x82, 0x85, 0x89, 0x87, 0x88, 0x87, 0x85, 0x83,
-	0x83, 0x85, 0x85, 0x8A, 0x8E, 0x92, 0x95, 0x97, 0x96, 0x90, 0x89, 0x81,
-	0x78, 0x6D, 0x63, 0x5A, 0x55, 0x53, 0x56, 0x5F, 0x6C, 0x7B, 0x8B, 0x9D,
-	0xAD, 0xB9, 0xC2, 0xC4, 0xC1, 0xB5, 0xA6, 0x93, 0x7E, 0x67, 0x55, 0x45,
-	0x3B, 0x38, 0x3B, 0x46, 0x54, 0x69, 0x81, 0x98, 0xAE, 0xBD, 0xC8, 0xCB,
-	0xC8, 0xBF, 0xB0, 0x9C, 0x89, 0x74, 0x5F, 0x50, 0x46, 0x41, 0x44, 0x4C,
-	0x59, 0x69, 0x7C, 0x8B, 0x99, 0xA6, 0xAD, 0xB2, 0xAF, 0xA9, 0xA0, 0x95,
-	0x8A, 0x7F, 0x77, 0x71, 0x6B, 0x6B, 0x6C, 0x6F, 0x75, 0x7A, 0x7E, 0x80,
-	0x82, 0x82, 0x81, 0x7F, 0x7F, 0x7E, 0x81, 0x80, 0x84, 0x89, 0x8E, 0x95,
-	0x9B, 0x9F, 0xA0, 0x9E, 0x99, 0x91, 0x86, 0x7B, 0x6B, 0x60, 0x56, 0x4D,
-	0x4B, 0x4D, 0x56, 0x63, 0x74, 0x86, 0x9A, 0xAA, 0xBA, 0xC4, 0xC7, 0xC6,
-	0xBC, 0xAD, 0x9B, 0x85, 0x6E, 0x59, 0x49, 0x3D, 0x38, 0x3A, 0x42, 0x50,
-	0x65, 0x7C, 0x92, 0xA8, 0xB8, 0xC4, 0xC8, 0xC8, 0xC0, 0xB1, 0xA2, 0x8D,
-	0x79, 0x66, 0x56, 0x4C, 0x48, 0x47, 0x4D, 0x5B, 0x66, 0x78, 0x86, 0x92,
-	0x9F, 0xA5, 0xA8, 0xA8, 0xA4, 0x9B, 0x93, 0x8C, 0x82, 0x7C, 0x77, 0x74,
-	0x73, 0x75, 0x77, 0x7B, 0x7E, 0x7E, 0x7F, 0x7E, 0x7E, 0x7B, 0x78, 0x76,
-	0x75, 0x77, 0x7B, 0x81, 0x88, 0x91, 0x98, 0xA1, 0xA6, 0xA9, 0xA8, 0xA1,
-	0x97, 0x8C, 0x7E, 0x6E, 0x60, 0x52, 0x49, 0x46, 0x45, 0x4E, 0x5A, 0x6A,
-	0x80, 0x94, 0xA7, 0xB9, 0xC6, 0xCA, 0xC9, 0xC2, 0xB3, 0xA3, 0x8C, 0x74,
-	0x5F, 0x4C, 0x3F, 0x39, 0x38, 0x3F, 0x4E, 0x5F, 0x78, 0x8C, 0xA1, 0xB2,
-	0xBF, 0xC6, 0xC5, 0xBF, 0xB3, 0xA3, 0x91, 0x7F, 0x6D, 0x60, 0x54, 0x4E,
-	0x4E, 0x53, 0x5C, 0x68, 0x76, 0x82, 0x8D, 0x97, 0x9E, 0xA2, 0xA0, 0x9D,
-	0x98, 0x90, 0x8A, 0x85, 0x7F, 0x7E, 0x7D, 0x7D, 0x7F, 0x80, 0x80, 0x82,
-	0x7F, 0x7E, 0x7D, 0x77, 0x73, 0x6F, 0x6B, 0x6C, 0x6F, 0x75, 0x7D, 0x86,
-	0x91, 0x9D, 0xA6, 0xAD, 0xB1, 0xAF, 0xAA, 0xA1, 0x92, 0x84, 0x71, 0x61,
-	0x51, 0x46, 0x41, 0x40, 0x46, 0x52, 0x63, 0x78, 0x8E, 0xA4, 0xB6, 0xC5,
-	0xCB, 0xCC, 0xC5, 0xB9, 0xA7, 0x91, 0x7C, 0x64, 0x51, 0x44, 0x3A, 0x39,
-	0x3F, 0x4A, 0x5B, 0x6F, 0x86, 0x99, 0xAB, 0xB9, 0xC0, 0xC1, 0xBD, 0xB3,
-	0xA4, 0x94, 0x83, 0x73, 0x66, 0x5B, 0x56, 0x55, 0x59, 0x5F, 0x69, 0x74,
-	0x7F, 0x88, 0x8F, 0x95, 0x96, 0x98, 0x95, 0x91, 0x8E, 0x89, 0x85, 0x83,
-	0x82, 0x84, 0x85, 0x86, 0x88, 0x87, 0x85, 0x81, 0x7F, 0x78, 0x72, 0x6C,
-	0x66, 0x63, 0x64, 0x66, 0x6C, 0x75, 0x82, 0x90, 0x9F, 0xAB, 0xB4, 0xBA,
-	0xBA, 0xB5, 0xAB, 0x9E, 0x8B, 0x77, 0x64, 0x53, 0x45, 0x3D, 0x3B, 0x40,
-	0x4B, 0x5D, 0x71, 0x89, 0x9E, 0xB3, 0xC3, 0xCB, 0xCC, 0xC8, 0xBD, 0xAC,
-	0x96, 0x7F, 0x6B, 0x56, 0x4A, 0x3E, 0x3C, 0x3F, 0x4A, 0x58, 0x6B, 0x80,
-	0x94, 0xA4, 0xB2, 0xBB, 0xBC, 0xB8, 0xB1, 0xA4, 0x96, 0x88, 0x7B, 0x6E,
-	0x64, 0x5F, 0x5F, 0x5F, 0x64, 0x6D, 0x75, 0x7E, 0x85, 0x8A, 0x8D, 0x90,
-	0x8F, 0x8B, 0x8A, 0x88, 0x86, 0x85, 0x85, 0x86, 0x8A, 0x8D, 0x8F, 0x90,
-	0x90, 0x8D, 0x87, 0x80, 0x79, 0x70, 0x68, 0x5F, 0x5B, 0x59, 0x5C, 0x64,
-	0x6F, 0x7D, 0x8C, 0x9C, 0xAB, 0xB7, 0xBF, 0xBF, 0xBC, 0xB2, 0xA4, 0x91,
-	0x7D, 0x68, 0x55, 0x46, 0x3D, 0x39, 0x3D, 0x46, 0x57, 0x6B, 0x82, 0x98,
-	0xAF, 0xBD, 0xC9, 0xCD, 0xC8, 0xC0, 0xB0, 0x9D, 0x87, 0x72, 0x5F, 0x4F,
-	0x44, 0x3F, 0x40, 0x49, 0x58, 0x68, 0x7B, 0x8D, 0x9E, 0xA9, 0xB1, 0xB5,
-	0xB5, 0xAD, 0xA2, 0x96, 0x89, 0x7E, 0x73, 0x6D, 0x67, 0x66, 0x68, 0x6C,
-	0x70, 0x77, 0x7D, 0x80, 0x84, 0x87, 0x86, 0x85, 0x84, 0x81, 0x81, 0x82,
-	0x85, 0x88, 0x8B, 0x91, 0x95, 0x98, 0x99, 0x99, 0x96, 0x8D, 0x84, 0x7B,
-	0x6E, 0x62, 0x5B, 0x52, 0x50, 0x52, 0x5B, 0x67, 0x75, 0x87, 0x98, 0xA9,
-	0xB8, 0xC3, 0xC6, 0xC3, 0xBA, 0xAC, 0x99, 0x84, 0x6D, 0x5A, 0x49, 0x3C,
-	0x39, 0x3A, 0x41, 0x51, 0x66, 0x7C, 0x93, 0xA8, 0xB9, 0xC6, 0xCB, 0xC9,
-	0xC0, 0xB2, 0xA1, 0x8C, 0x78, 0x64, 0x54, 0x4A, 0x44, 0x43, 0x4B, 0x56,
-	0x65, 0x77, 0x86, 0x94, 0xA1, 0xA8, 0xAD, 0xAC, 0xA6, 0x9F, 0x95, 0x8A,
-	0x81, 0x79, 0x72, 0x6F, 0x6D, 0x6F, 0x72, 0x76, 0x7A, 0x7E, 0x80, 0x80,
-	0x80, 0x80, 0x7E, 0x7C, 0x7B, 0x7D, 0x7F, 0x82, 0x88, 0x8F, 0x96, 0x9E,
-	0xA3, 0xA5, 0xA4, 0x9D, 0x95, 0x88, 0x7D, 0x6E, 0x60, 0x55, 0x4B, 0x48,
-	0x4A, 0x50, 0x5D, 0x6F, 0x81, 0x96, 0xA9, 0xB8, 0xC4, 0xC8, 0xC8, 0xBF,
-	0xB3, 0xA0, 0x8A, 0x74, 0x5E, 0x4C, 0x3F, 0x37, 0x3A, 0x3F, 0x4D, 0x5E,
-	0x77, 0x8D, 0xA2, 0xB5, 0xC2, 0xC9, 0xC8, 0xC2, 0xB6, 0xA5, 0x91, 0x7E,
-	0x6A, 0x5A, 0x4F, 0x4A, 0x4A, 0x4E, 0x59, 0x65, 0x75, 0x83, 0x8F, 0x9B,
-	0xA1, 0xA6, 0xA4, 0xA1, 0x9B, 0x93, 0x8A, 0x83, 0x7F, 0x7A, 0x78, 0x77,
-	0x79, 0x7A, 0x7D, 0x7E, 0x81, 0x7F, 0x7E, 0x7C, 0x78, 0x75, 0x72, 0x71,
-	0x74, 0x78, 0x7E, 0x86, 0x90, 0x99, 0xA3, 0xA9, 0xAD, 0xAD, 0xA7, 0x9D,
-	0x93, 0x82, 0x71, 0x61, 0x54, 0x49, 0x43, 0x43, 0x4A, 0x56, 0x65, 0x7A,
-	0x8F, 0xA4, 0xB6, 0xC3, 0xCB, 0xCA, 0xC5, 0xB9, 0xA6, 0x91, 0x7A, 0x63,
-	0x51, 0x42, 0x39, 0x38, 0x3C, 0x4A, 0x5A, 0x70, 0x87, 0x9C, 0xAD, 0xBB,
-	0xC3, 0xC4, 0xBE, 0xB5, 0xA6, 0x94, 0x81, 0x71, 0x62, 0x59, 0x51, 0x50,
-	0x54, 0x5B, 0x66, 0x73, 0x80, 0x89, 0x92, 0x99, 0x9B, 0x9D, 0x9A, 0x95,
-	0x90, 0x8A, 0x85, 0x82, 0x80, 0x7F, 0x80, 0x80, 0x83, 0x84, 0x83, 0x81,
-	0x7F, 0x7C, 0x76, 0x71, 0x6C, 0x67, 0x67, 0x6B, 0x71, 0x7A, 0x84, 0x8F,
-	0x9C, 0xA7, 0xB0, 0xB5, 0xB6, 0xB1, 0xA7, 0x98, 0x8A, 0x78, 0x65, 0x54,
-	0x47, 0x3F, 0x3E, 0x43, 0x4D, 0x5F, 0x74, 0x89, 0x9F, 0xB3, 0xC1, 0xCC,
-	0xCE, 0xC8, 0xBD, 0xAB, 0x96, 0x80, 0x69, 0x56, 0x46, 0x3D, 0x38, 0x3E,
-	0x48, 0x59, 0x6C, 0x80, 0x96, 0xA7, 0xB6, 0xBE, 0xC0, 0xBD, 0xB3, 0xA7,
-	0x98, 0x87, 0x78, 0x6B, 0x60, 0x5A, 0x58, 0x5B, 0x60, 0x69, 0x74, 0x7D,
-	0x84, 0x8C, 0x90, 0x94, 0x94, 0x91, 0x8F, 0x8B, 0x8A, 0x85, 0x83, 0x84,
-	0x85, 0x87, 0x8A, 0x8A, 0x8A, 0x87, 0x84, 0x7F, 0x7A, 0x72, 0x6B, 0x64,
-	0x60, 0x5F, 0x62, 0x69, 0x73, 0x7F, 0x8F, 0x9C, 0xAA, 0xB5, 0xBC, 0xBE,
-	0xB8, 0xB0, 0xA2, 0x8F, 0x7D, 0x68, 0x56, 0x47, 0x3E, 0x3B, 0x3E, 0x48,
-	0x56, 0x6C, 0x83, 0x9A, 0xAF, 0xBF, 0xCA, 0xCC, 0xCA, 0xBF, 0xAF, 0x9D,
-	0x86, 0x70, 0x5D, 0x4C, 0x40, 0x3D, 0x40, 0x48, 0x56, 0x69, 0x7E, 0x8F,
-	0xA0, 0xAE, 0xB6, 0xBA, 0xB7, 0xB0, 0xA4, 0x99, 0x8A, 0x7C, 0x73, 0x68,
-	0x62, 0x5F, 0x62, 0x67, 0x6D, 0x75, 0x7C, 0x82, 0x86, 0x8A, 0x8C, 0x8B,
-	0x87, 0x86, 0x85, 0x84, 0x85, 0x86, 0x8A, 0x8C, 0x8F, 0x93, 0x93, 0x93,
-	0x90, 0x8C, 0x83, 0x7A, 0x70, 0x67, 0x5E, 0x57, 0x57, 0x58, 0x5F, 0x6A,
-	0x79, 0x89, 0x9A, 0xA9, 0xB6, 0xC0, 0xC3, 0xC1, 0xB8, 0xA9, 0x97, 0x83,
-	0x6D, 0x5A, 0x49, 0x3D, 0x39, 0x3A, 0x41, 0x52, 0x66, 0x7D, 0x94, 0xA9,
-	0xBB, 0xC8, 0xCD, 0xCA, 0xC1, 0xB2, 0xA0, 0x8B, 0x77, 0x62, 0x51, 0x48,
-	0x40, 0x42, 0x49, 0x55, 0x65, 0x78, 0x88, 0x99, 0xA4, 0xAE, 0xB1, 0xB1,
-	0xAC, 0xA2, 0x98, 0x8C, 0x81, 0x78, 0x6F, 0x6B, 0x69, 0x6A, 0x6E, 0x73,
-	0x78, 0x7C, 0x80, 0x82, 0x83, 0x82, 0x83, 0x81, 0x80, 0x7F, 0x7F, 0x84,
-	0x88, 0x8D, 0x92, 0x98, 0x9D, 0x9E, 0x9C, 0x9A, 0x90, 0x85, 0x7C, 0x71,
-	0x63, 0x5A, 0x4F, 0x4D, 0x4F, 0x54, 0x61, 0x70, 0x82, 0x95, 0xA7, 0xB9,
-	0xC2, 0xC7, 0xC5, 0xBE, 0xB1, 0x9D, 0x89, 0x73, 0x5D, 0x4C, 0x3E, 0x37,
-	0x39, 0x41, 0x4E, 0x5F, 0x77, 0x8C, 0xA3, 0xB6, 0xC2, 0xC9, 0xCA, 0xC3,
-	0xB5, 0xA5, 0x91, 0x7C, 0x69, 0x59, 0x4C, 0x47, 0x46, 0x4B, 0x56, 0x65,
-	0x75, 0x83, 0x91, 0x9C, 0xA4, 0xAB, 0xAB, 0xA6, 0x9F, 0x96, 0x8B, 0x83,
-	0x7C, 0x76, 0x72, 0x73, 0x72, 0x74, 0x78, 0x7B, 0x7E, 0x7E, 0x7F, 0x7E,
-	0x7C, 0x7A, 0x78, 0x78, 0x79, 0x7B, 0x80, 0x88, 0x8F, 0x96, 0x9D, 0xA3,
-	0xA5, 0xA6, 0xA1, 0x99, 0x8D, 0x81, 0x70, 0x63, 0x56, 0x49, 0x46, 0x45,
-	0x4C, 0x58, 0x68, 0x7C, 0x8F, 0xA4, 0xB6, 0xC3, 0xC8, 0xC9, 0xC3, 0xB7,
-	0xA5, 0x8F, 0x78, 0x64, 0x4F, 0x3F, 0x38, 0x39, 0x3E, 0x49, 0x5C, 0x72,
-	0x88, 0x9C, 0xB0, 0xBD, 0xC6, 0xC8, 0xC1, 0xB6, 0xA7, 0x96, 0x82, 0x71,
-	0x61, 0x56, 0x4F, 0x4C, 0x50, 0x59, 0x65, 0x72, 0x80, 0x8B, 0x97, 0x9E,
-	0xA2, 0xA1, 0x9F, 0x9A, 0x93, 0x8C, 0x84, 0x80, 0x7C, 0x7A, 0x7B, 0x7D,
-	0x7F, 0x80, 0x80, 0x80, 0x7E, 0x7C, 0x7A, 0x77, 0x73, 0x6F, 0x6E, 0x6F,
-	0x75, 0x7D, 0x84, 0x8F, 0x99, 0xA3, 0xAA, 0xAE, 0xB0, 0xAC, 0xA2, 0x96,
-	0x86, 0x77, 0x64, 0x53, 0x4A, 0x42, 0x40, 0x46, 0x51, 0x60, 0x75, 0x8A,
-	0xA0, 0xB4, 0xC1, 0xC9, 0xCB, 0xC7, 0xBB, 0xAB, 0x96, 0x7E, 0x68, 0x54,
-	0x44, 0x3B, 0x38, 0x3C, 0x48, 0x56, 0x6C, 0x81, 0x96, 0xA9, 0xB6, 0xC0,
-	0xC4, 0xBE, 0xB5, 0xA8, 0x98, 0x86, 0x76, 0x68, 0x5C, 0x55, 0x53, 0x56,
-	0x5E, 0x66, 0x72, 0x7C, 0x87, 0x8F, 0x96, 0x99, 0x9B, 0x98, 0x94, 0x8F,
-	0x8A, 0x86, 0x83, 0x82, 0x81, 0x81, 0x85, 0x85, 0x86, 0x85, 0x82, 0x80,
-	0x7C, 0x74, 0x6E, 0x68, 0x64, 0x64, 0x66, 0x6D, 0x75, 0x80, 0x8D, 0x99,
-	0xA7, 0xB0, 0xB5, 0xBB, 0xB5, 0xAC, 0x9E, 0x8E, 0x7B, 0x68, 0x57, 0x49,
-	0x3F, 0x3D, 0x41, 0x4A, 0x58, 0x6E, 0x82, 0x9A, 0xAF, 0xBF, 0xC9, 0xCD,
-	0xC9, 0xBF, 0xB0, 0x9C, 0x86, 0x6F, 0x5B, 0x4A, 0x40, 0x3C, 0x3E, 0x46,
-	0x56, 0x68, 0x7D, 0x90, 0xA1, 0xB1, 0xBA, 0xBE, 0xBB, 0xB4, 0xA8, 0x9A,
-	0x8C, 0x7C, 0x71, 0x64, 0x5E, 0x5D, 0x5D, 0x63, 0x6B, 0x73, 0x7C, 0x83,
-	0x89, 0x8E, 0x91, 0x90, 0x8F, 0x8C, 0x8A, 0x86, 0x85, 0x86, 0x85, 0x88,
-	0x8B, 0x8C, 0x8E, 0x8E, 0x8C, 0x87, 0x82, 0x7B, 0x73, 0x6A, 0x62, 0x5E,
-	0x5C, 0x5D, 0x63, 0x6D, 0x7C, 0x8A, 0x9C, 0xA9, 0xB5, 0xBC, 0xBF, 0xBD,
-	0xB4, 0xA6, 0x95, 0x81, 0x6C, 0x5A, 0x49, 0x3E, 0x39, 0x3C, 0x43, 0x53,
-	0x66, 0x7F, 0x95, 0xAA, 0xBD, 0xC7, 0xCC, 0xCA, 0xC1, 0xB2, 0xA0, 0x8B,
-	0x75, 0x60, 0x4F, 0x44, 0x3D, 0x3F, 0x47, 0x53, 0x64, 0x78, 0x89, 0x9A,
-	0xA9, 0xB2, 0xB6, 0xB5, 0xB0, 0xA7, 0x9A, 0x8D, 0x80, 0x74, 0x6C, 0x67,
-	0x63, 0x66, 0x68, 0x6E, 0x75, 0x7B, 0x80, 0x85, 0x87, 0x87, 0x86, 0x85,
-	0x85, 0x81, 0x83, 0x84, 0x85, 0x88, 0x8F, 0x94, 0x96, 0x98, 0x98, 0x94,
-	0x8D, 0x86, 0x7D, 0x72, 0x67, 0x5D, 0x56, 0x52, 0x54, 0x5A, 0x64, 0x73,
-	0x84, 0x95, 0xA7, 0xB5, 0xC0, 0xC3, 0xC1, 0xBA, 0xAD, 0x9D, 0x87, 0x71,
-	0x5D, 0x4A, 0x3F, 0x38, 0x39, 0x40, 0x4E, 0x61, 0x78, 0x8E, 0xA4, 0xB7,
-	0xC4, 0xCB, 0xCB, 0xC2, 0xB7, 0xA5, 0x90, 0x7B, 0x68, 0x56, 0x4A, 0x43,
-	0x43, 0x49, 0x54, 0x63, 0x75, 0x85, 0x93, 0xA1, 0xAA, 0xAE, 0xAF, 0xAB,
-	0xA3, 0x98, 0x8F, 0x83, 0x7A, 0x74, 0x6F, 0x6C, 0x6D, 0x70, 0x74, 0x79,
-	0x7D, 0x7F, 0x81, 0x80, 0x81, 0x80, 0x7E, 0x7E, 0x7D, 0x80, 0x82, 0x87,
-	0x8D, 0x95, 0x9B, 0x9F, 0xA1, 0xA2, 0x9D, 0x95, 0x8B, 0x80, 0x71, 0x65,
-	0x58, 0x4E, 0x4A, 0x4A, 0x50, 0x5D, 0x69, 0x7E, 0x92, 0xA4, 0xB7, 0xC2,
-	0xC6, 0xC7, 0xC1, 0xB5, 0xA3, 0x8E, 0x78, 0x61, 0x4F, 0x40, 0x39, 0x37,
-	0x3D, 0x4A, 0x5C, 0x71, 0x88, 0x9E, 0xB1, 0xC0, 0xC9, 0xC9, 0xC2, 0xB9,
-	0xA7, 0x95, 0x81, 0x6E, 0x5D, 0x51, 0x49, 0x49, 0x4C, 0x55, 0x63, 0x72,
-	0x80, 0x8F, 0x99, 0xA2, 0xA7, 0xA8, 0xA5, 0x9E, 0x97, 0x8E, 0x85, 0x80,
-	0x7A, 0x76, 0x75, 0x76, 0x79, 0x7B, 0x7C, 0x7F, 0x80, 0x7E, 0x7D, 0x7A,
-	0x76, 0x74, 0x73, 0x75, 0x7A, 0x7E, 0x86, 0x8E, 0x95, 0xA0, 0xA6, 0xAA,
-	0xAA, 0xA5, 0x9F, 0x93, 0x84, 0x75, 0x65, 0x56, 0x4B, 0x46, 0x43, 0x49,
-	0x55, 0x64, 0x77, 0x8C, 0xA2, 0xB2, 0xC1, 0xCA, 0xCA, 0xC5, 0xBA, 0xAB,
-	0x96, 0x7E, 0x68, 0x53, 0x45, 0x3A, 0x38, 0x3C, 0x48, 0x57, 0x6D, 0x83,
-	0x99, 0xAD, 0xBB, 0xC4, 0xC5, 0xC2, 0xB8, 0xA8, 0x98, 0x86, 0x74, 0x65,
-	0x59, 0x53, 0x4F, 0x52, 0x58, 0x64, 0x70, 0x7F, 0x88, 0x91, 0x99, 0x9D,
-	0x9F, 0x9E, 0x98, 0x93, 0x8C, 0x85, 0x81, 0x80, 0x7E, 0x7D, 0x80, 0x81,
-	0x81, 0x81, 0x81, 0x80, 0x7D, 0x78, 0x72, 0x6E, 0x6B, 0x6B, 0x6C, 0x71,
-	0x79, 0x82, 0x8C, 0x99, 0xA4, 0xAE, 0xB4, 0xB5, 0xB2, 0xA8, 0x9C, 0x8B,
-	0x7B, 0x68, 0x59, 0x4A, 0x41, 0x40, 0x43, 0x4D, 0x5B, 0x70, 0x87, 0x9C,
-	0xB0, 0xC0, 0xCA, 0xCC, 0xC9, 0xBE, 0xAF, 0x9C, 0x82, 0x6E, 0x59, 0x48,
-	0x3C, 0x39, 0x3B, 0x45, 0x54, 0x67, 0x7D, 0x92, 0xA4, 0xB3, 0xBD, 0xC1,
-	0xBD, 0xB7, 0xAA, 0x9B, 0x8A, 0x7A, 0x6C, 0x61, 0x59, 0x57, 0x59, 0x5E,
-	0x65, 0x72, 0x7C, 0x84, 0x8C, 0x92, 0x95, 0x96, 0x95, 0x90, 0x8D, 0x89,
-	0x88, 0x83, 0x84, 0x83, 0x86, 0x87, 0x88, 0x89, 0x86, 0x85, 0x80, 0x7B,
-	0x75, 0x6C, 0x65, 0x63, 0x60, 0x62, 0x68, 0x71, 0x7E, 0x8A, 0x99, 0xA7,
-	0xB2, 0xB9, 0xBB, 0xB8, 0xAF, 0xA4, 0x93, 0x80, 0x6C, 0x59, 0x4A, 0x40,
-	0x3B, 0x3D, 0x46, 0x54, 0x67, 0x7F, 0x95, 0xAD, 0xBE, 0xC7, 0xCE, 0xCA,
-	0xC1, 0xB4, 0x9F, 0x89, 0x73, 0x5D, 0x4D, 0x41, 0x3C, 0x3D, 0x45, 0x51,
-	0x63, 0x77, 0x8A, 0x9E, 0xAA, 0xB5, 0xBA, 0xBA, 0xB2, 0xA8, 0x9C, 0x8D,
-	0x80, 0x71, 0x68, 0x61, 0x5F, 0x61, 0x65, 0x6A, 0x72, 0x7A, 0x82, 0x87,
-	0x8A, 0x8C, 0x8D, 0x8B, 0x8A, 0x89, 0x86, 0x85, 0x86, 0x87, 0x88, 0x8D,
-	0x90, 0x93, 0x92, 0x8E, 0x8B, 0x84, 0x7D, 0x73, 0x69, 0x60, 0x5B, 0x58,
-	0x59, 0x5F, 0x69, 0x76, 0x85, 0x96, 0xA7, 0xB4, 0xBC, 0xC2, 0xC0, 0xB7,
-	0xAB, 0x9A, 0x86, 0x72, 0x5C, 0x4B, 0x3F, 0x39, 0x39, 0x42, 0x50, 0x60,
-	0x79, 0x91, 0xA6, 0xB9, 0xC4, 0xCB, 0xCC, 0xC4, 0xB7, 0xA5, 0x90, 0x7A,
-	0x66, 0x54, 0x48, 0x40, 0x41, 0x47, 0x52, 0x63, 0x73, 0x88, 0x96, 0xA3,
-	0xAE, 0xB2, 0xB4, 0xAF, 0xA6, 0x9A, 0x8F, 0x82, 0x78, 0x70, 0x69, 0x66,
-	0x67, 0x6A, 0x6F, 0x78, 0x7C, 0x80, 0x82, 0x84, 0x85, 0x84, 0x84, 0x81,
-	0x81, 0x7F, 0x83, 0x86, 0x8B, 0x8F, 0x95, 0x99, 0x9B, 0x9D, 0x98, 0x90,
-	0x89, 0x80, 0x72, 0x66, 0x5C, 0x54, 0x51, 0x50, 0x55, 0x5F, 0x6D, 0x80,
-	0x93, 0xA3, 0xB5, 0xBF, 0xC5, 0xC5, 0xBF, 0xB4, 0xA3, 0x8C, 0x77, 0x61,
-	0x4E, 0x41, 0x3A, 0x38, 0x3F, 0x4A, 0x5C, 0x74, 0x89, 0xA0, 0xB4, 0xC1,
-	0xC9, 0xCB, 0xC5, 0xB9, 0xA8, 0x94, 0x80, 0x6A, 0x5A, 0x4D, 0x46, 0x43,
-	0x47, 0x53, 0x60, 0x70, 0x81, 0x8F, 0x9D, 0xA8, 0xAB, 0xAC, 0xAA, 0xA3,
-	0x9A, 0x90, 0x86, 0x7E, 0x78, 0x71, 0x6F, 0x71, 0x73, 0x78, 0x7A, 0x7C,
-	0x80, 0x80, 0x80, 0x7E, 0x7C, 0x7A, 0x78, 0x7B, 0x7C, 0x80, 0x86, 0x8D,
-	0x93, 0x9B, 0xA2, 0xA5, 0xA4, 0xA1, 0x9A, 0x8F, 0x82, 0x74, 0x66, 0x59,
-	0x4D, 0x48, 0x47, 0x4D, 0x57, 0x65, 0x78, 0x8D, 0xA2, 0xB3, 0xC1, 0xC8,
-	0xCA, 0xC5, 0xBA, 0xA9, 0x93, 0x7D, 0x65, 0x53, 0x44, 0x39, 0x38, 0x3C,
-	0x47, 0x58, 0x6D, 0x83, 0x99, 0xAD, 0xBB, 0xC6, 0xC8, 0xC4, 0xBA, 0xAB,
-	0x98, 0x83, 0x74, 0x63, 0x56, 0x4D, 0x4B, 0x4D, 0x56, 0x61, 0x6F, 0x7E,
-	0x8C, 0x96, 0x9E, 0xA2, 0xA4, 0xA3, 0x9D, 0x94, 0x8F, 0x86, 0x81, 0x7E,
-	0x7A, 0x7A, 0x79, 0x7C, 0x7E, 0x80, 0x80, 0x7F, 0x7E, 0x7B, 0x78, 0x74,
-	0x70, 0x6E, 0x70, 0x75, 0x7B, 0x83, 0x8B, 0x96, 0xA1, 0xA7, 0xAB, 0xAD,
-	0xAA, 0xA3, 0x96, 0x87, 0x79, 0x67, 0x58, 0x4C, 0x44, 0x42, 0x46, 0x50,
-	0x5F, 0x6F, 0x86, 0x9D, 0xB0, 0xBF, 0xCA, 0xCB, 0xC8, 0xBF, 0xAC, 0x9C,
-	0x83, 0x6C, 0x58, 0x47, 0x3B, 0x39, 0x3C, 0x46, 0x55, 0x66, 0x80, 0x95,
-	0xA6, 0xB6, 0xBE, 0xC4, 0xC1, 0xB8, 0xAC, 0x9B, 0x8A, 0x78, 0x68, 0x5D,
-	0x56, 0x52, 0x54, 0x59, 0x63, 0x6F, 0x7B, 0x85, 0x8E, 0x96, 0x9B, 0x9B,
-	0x99, 0x97, 0x91, 0x8B, 0x86, 0x83, 0x82, 0x80, 0x7F, 0x81, 0x84, 0x84,
-	0x83, 0x81, 0x80, 0x7C, 0x77, 0x72, 0x6B, 0x68, 0x66, 0x67, 0x6C, 0x74,
-	0x7E, 0x8B, 0x97, 0xA3, 0xAD, 0xB5, 0xB8, 0xB4, 0xAD, 0xA0, 0x8E, 0x7D,
-	0x6B, 0x59, 0x4B, 0x40, 0x3C, 0x41, 0x48, 0x57, 0x69, 0x80, 0x96, 0xAC,
-	0xBD, 0xC8, 0xCD, 0xCA, 0xC1, 0xB2, 0x9F, 0x89, 0x73, 0x5C, 0x4C, 0x3F,
-	0x3A, 0x3C, 0x43, 0x50, 0x63, 0x78, 0x8B, 0x9F, 0xAF, 0xB9, 0xBE, 0xBD,
-	0xB6, 0xAB, 0x9D, 0x8D, 0x7D, 0x6F, 0x65, 0x5D, 0x5A, 0x5B, 0x60, 0x67,
-	0x70, 0x7A, 0x82, 0x89, 0x8E, 0x93, 0x93, 0x92, 0x8F, 0x8B, 0x89, 0x86,
-	0x85, 0x85, 0x85, 0x89, 0x8B, 0x8C, 0x8D, 0x8B, 0x86, 0x82, 0x7E, 0x75,
-	0x6C, 0x66, 0x5F, 0x5D, 0x5E, 0x64, 0x6D, 0x7A, 0x89, 0x97, 0xA5, 0xB1,
-	0xBA, 0xBE, 0xBC, 0xB6, 0xA8, 0x98, 0x85, 0x6F, 0x5C, 0x4C, 0x40, 0x3A,
-	0x3B, 0x43, 0x51, 0x64, 0x7A, 0x92, 0xA6, 0xBA, 0xC5, 0xCC, 0xCC, 0xC4,
-	0xB7, 0xA4, 0x8F, 0x79, 0x63, 0x52, 0x45, 0x3E, 0x3E, 0x43, 0x50, 0x61,
-	0x74, 0x86, 0x98, 0xA7, 0xB2, 0xB7, 0xB7, 0xB1, 0xA9, 0x9D, 0x8E, 0x81,
-	0x76, 0x6D, 0x66, 0x60, 0x63, 0x67, 0x6C, 0x73, 0x79, 0x81, 0x85, 0x89,
-	0x8A, 0x89, 0x87, 0x86, 0x84, 0x84, 0x83, 0x86, 0x88, 0x8B, 0x91, 0x94,
-	0x95, 0x96, 0x94, 0x8E, 0x87, 0x7D, 0x74, 0x69, 0x60, 0x58, 0x54, 0x55,
-	0x5A, 0x64, 0x70, 0x81, 0x93, 0xA2, 0xB2, 0xBD, 0xC3, 0xC2, 0xBB, 0xB0,
-	0xA0, 0x8A, 0x76, 0x60, 0x4E, 0x41, 0x39, 0x39, 0x3E, 0x4A, 0x5D, 0x73,
-	0x8B, 0xA2, 0xB5, 0xC3, 0xCC, 0xCC, 0xC5, 0xBB, 0xA9, 0x94, 0x80, 0x69,
-	0x59, 0x4A, 0x43, 0x42, 0x45, 0x51, 0x5F, 0x70, 0x81, 0x91, 0xA1, 0xAA,
-	0xB0, 0xB1, 0xAD, 0xA6, 0x9B, 0x90, 0x85, 0x7C, 0x74, 0x6F, 0x6B, 0x6C,
-	0x6F, 0x73, 0x78, 0x7B, 0x80, 0x81, 0x81, 0x83, 0x81, 0x80, 0x7F, 0x7F,
-	0x80, 0x82, 0x86, 0x8B, 0x91, 0x97, 0x9D, 0xA0, 0x9F, 0x9E, 0x97, 0x8C,
-	0x80, 0x76, 0x69, 0x5B, 0x52, 0x4C, 0x4D, 0x50, 0x5A, 0x69, 0x7B, 0x8E,
-	0xA2, 0xB2, 0xBE, 0xC7, 0xC8, 0xC2, 0xB7, 0xA7, 0x92, 0x7C, 0x64, 0x52,
-	0x43, 0x3A, 0x37, 0x3B, 0x48, 0x57, 0x6E, 0x84, 0x9C, 0xAE, 0xBE, 0xC7,
-	0xC9, 0xC6, 0xBC, 0xAB, 0x97, 0x82, 0x71, 0x5F, 0x53, 0x4A, 0x46, 0x4A,
-	0x53, 0x5F, 0x6E, 0x7E, 0x8B, 0x98, 0xA2, 0xA9, 0xA9, 0xA6, 0xA0, 0x99,
-	0x90, 0x87, 0x80, 0x79, 0x75, 0x73, 0x74, 0x75, 0x7A, 0x7C, 0x7E, 0x80,
-	0x80, 0x7E, 0x7C, 0x79, 0x76, 0x76, 0x76, 0x7A, 0x7D, 0x85, 0x8C, 0x94,
-	0x9C, 0xA2, 0xA8, 0xA8, 0xA7, 0x9E, 0x93, 0x86, 0x78, 0x67, 0x59, 0x4E,
-	0x47, 0x46, 0x49, 0x52, 0x61, 0x74, 0x88, 0x9D, 0xB1, 0xBF, 0xC7, 0xCB,
-	0xC7, 0xBC, 0xAD, 0x98, 0x82, 0x6B, 0x57, 0x46, 0x3B, 0x37, 0x3A, 0x45,
-	0x53, 0x68, 0x7E, 0x94, 0xA8, 0xB8, 0xC3, 0xC6, 0xC4, 0xBA, 0xAD, 0x9C,
-	0x89, 0x78, 0x67, 0x59, 0x51, 0x4D, 0x51, 0x57, 0x60, 0x6E, 0x7B, 0x87,
-	0x92, 0x99, 0x9F, 0x9F, 0x9E, 0x9B, 0x95, 0x8F, 0x88, 0x82, 0x7E, 0x7E,
-	0x7D, 0x7E, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7E, 0x7A, 0x76, 0x72, 0x6F,
-	0x6C, 0x6D, 0x71, 0x77, 0x81, 0x8B, 0x96, 0xA3, 0xAA, 0xAF, 0xB1, 0xAE,
-	0xA7, 0x9C, 0x8E, 0x7D, 0x6B, 0x58, 0x4D, 0x43, 0x3D, 0x42, 0x4B, 0x58,
-	0x6D, 0x82, 0x98, 0xAC, 0xBD, 0xC8, 0xCC, 0xCA, 0xC2, 0xB2, 0x9F, 0x89,
-	0x71, 0x5C, 0x4B, 0x3F, 0x39, 0x3A, 0x42, 0x51, 0x63, 0x7A, 0x8E, 0xA1,
-	0xB2, 0xBD, 0xC1, 0xC0, 0xBA, 0xAD, 0x9E, 0x8E, 0x7E, 0x6D, 0x62, 0x58,
-	0x56, 0x56, 0x5B, 0x64, 0x6D, 0x7B, 0x82, 0x8C, 0x92, 0x97, 0x98, 0x95,
-	0x93, 0x90, 0x8C, 0x86, 0x85, 0x85, 0x83, 0x83, 0x85, 0x87, 0x87, 0x85,
-	0x84, 0x80, 0x7C, 0x75, 0x71, 0x69, 0x63, 0x61, 0x63, 0x69, 0x6F, 0x7C,
-	0x87, 0x96, 0xA3, 0xAE, 0xB8, 0xBB, 0xB9, 0xB3, 0xA6, 0x95, 0x83, 0x6F,
-	0x5C, 0x4D, 0x42, 0x3D, 0x3D, 0x44, 0x52, 0x64, 0x7C, 0x91, 0xA6, 0xB9,
-	0xC5, 0xCC, 0xCB, 0xC5, 0xB7, 0xA3, 0x8E, 0x77, 0x61, 0x50, 0x42, 0x3D,
-	0x3B, 0x42, 0x4F, 0x60, 0x73, 0x88, 0x9A, 0xA9, 0xB4, 0xBA, 0xBC, 0xB5,
-	0xAC, 0x9F, 0x90, 0x81, 0x74, 0x69, 0x61, 0x5C, 0x5E, 0x62, 0x66, 0x70,
-	0x79, 0x7F, 0x87, 0x8B, 0x8E, 0x8E, 0x8E, 0x8B, 0x89, 0x86, 0x85, 0x85,
-	0x86, 0x88, 0x8B, 0x8E, 0x90, 0x91, 0x8F, 0x8B, 0x85, 0x7E, 0x76, 0x6C,
-	0x63, 0x5D, 0x59, 0x5A, 0x5F, 0x68, 0x74, 0x82, 0x94, 0xA3, 0xB0, 0xBB,
-	0xBF, 0xBE, 0xB9, 0xAE, 0x9E, 0x88, 0x75, 0x60, 0x4F, 0x41, 0x3B, 0x3A,
-	0x40, 0x4D, 0x5E, 0x76, 0x8D, 0xA1, 0xB6, 0xC3, 0xCB, 0xCC, 0xC5, 0xBA,
-	0xA8, 0x94, 0x7E, 0x6A, 0x57, 0x48, 0x40, 0x3D, 0x43, 0x4F, 0x5E, 0x70,
-	0x82, 0x93, 0xA1, 0xAD, 0xB2, 0xB5, 0xB0, 0xA9, 0x9E, 0x92, 0x86, 0x7B,
-	0x72, 0x6C, 0x66, 0x66, 0x68, 0x6F, 0x74, 0x7A, 0x80, 0x82, 0x85, 0x86,
-	0x86, 0x85, 0x84, 0x81, 0x82, 0x83, 0x85, 0x89, 0x8D, 0x93, 0x96, 0x9A,
-	0x9A, 0x96, 0x92, 0x8A, 0x81, 0x76, 0x69, 0x61, 0x57, 0x51, 0x51, 0x56,
-	0x5E, 0x6C, 0x7E, 0x8E, 0xA0, 0xB1, 0xBB, 0xC3, 0xC5, 0xBF, 0xB4, 0xA4,
-	0x91, 0x7B, 0x65, 0x53, 0x43, 0x3A, 0x37, 0x3D, 0x49, 0x58, 0x6E, 0x83,
-	0x9D, 0xB2, 0xBF, 0xC9, 0xCC, 0xC7, 0xBC, 0xAB, 0x99, 0x82, 0x6E, 0x5D,
-	0x4F, 0x47, 0x44, 0x46, 0x50, 0x5C, 0x6F, 0x7F, 0x8E, 0x9B, 0xA4, 0xAC,
-	0xAD, 0xAA, 0xA3, 0x9A, 0x92, 0x87, 0x7F, 0x76, 0x71, 0x6D, 0x6E, 0x71,
-	0x74, 0x78, 0x7B, 0x7E, 0x80, 0x80, 0x7F, 0x7F, 0x7D, 0x7C, 0x7B, 0x7D,
-	0x80, 0x85, 0x8B, 0x91, 0x98, 0x9F, 0xA3, 0xA2, 0x9F, 0x9A, 0x90, 0x84,
-	0x78, 0x69, 0x5A, 0x51, 0x4A, 0x48, 0x4C, 0x55, 0x62, 0x76, 0x8A, 0x9D,
-	0xAF, 0xBE, 0xC7, 0xC9, 0xC5, 0xBB, 0xAB, 0x98, 0x82, 0x6A, 0x57, 0x46,
-	0x3A, 0x38, 0x3B, 0x44, 0x54, 0x69, 0x80, 0x97, 0xAB, 0xBB, 0xC4, 0xC8,
-	0xC7, 0xBD, 0xAE, 0x9D, 0x89, 0x76, 0x65, 0x56, 0x4C, 0x49, 0x4B, 0x53,
-	0x5E, 0x6C, 0x7B, 0x88, 0x95, 0x9D, 0xA3, 0xA5, 0xA2, 0x9F, 0x98, 0x8F,
-	0x88, 0x81, 0x7D, 0x7A, 0x77, 0x77, 0x79, 0x7C, 0x7F, 0x80, 0x7F, 0x7E,
-	0x7C, 0x7A, 0x76, 0x74, 0x72, 0x72, 0x75, 0x7A, 0x81, 0x8B, 0x94, 0x9D,
-	0xA3, 0xAC, 0xAC, 0xA9, 0xA3, 0x98, 0x8B, 0x7C, 0x6A, 0x5A, 0x4F, 0x45,
-	0x43, 0x46, 0x4E, 0x5B, 0x6D, 0x83, 0x99, 0xAD, 0xBC, 0xC7, 0xCC, 0xC9,
-	0xC1, 0xB1, 0x9F, 0x87, 0x6F, 0x5B, 0x49, 0x3D, 0x3A, 0x3A, 0x43, 0x51,
-	0x63, 0x7B, 0x8F, 0xA6, 0xB5, 0xBE, 0xC5, 0xC2, 0xBB, 0xAF, 0x9F, 0x8E,
-	0x7C, 0x6A, 0x5E, 0x55, 0x51, 0x51, 0x57, 0x61, 0x6C, 0x78, 0x82, 0x8D,
-	0x95, 0x9B, 0x9E, 0x9D, 0x97, 0x92, 0x8E, 0x89, 0x83, 0x81, 0x80, 0x80,
-	0x7F, 0x81, 0x82, 0x83, 0x82, 0x80, 0x7C, 0x79, 0x74, 0x6C, 0x6A, 0x68,
-	0x69, 0x6C, 0x73, 0x7D, 0x89, 0x95, 0xA1, 0xAC, 0xB3, 0xB5, 0xB4, 0xAF,
-	0xA1, 0x92, 0x80, 0x70, 0x5D, 0x4E, 0x44, 0x3E, 0x40, 0x47, 0x54, 0x66,
-	0x7C, 0x93, 0xA9, 0xBA, 0xC6, 0xCE, 0xCB, 0xC4, 0xB6, 0xA4, 0x8D, 0x76,
-	0x61, 0x4E, 0x42, 0x3B, 0x3B, 0x41, 0x4E, 0x60, 0x75, 0x89, 0x9D, 0xAD,
-	0xB9, 0xBF, 0xBE, 0xB8, 0xAE, 0xA0, 0x8F, 0x80, 0x72, 0x66, 0x5D, 0x58,
-	0x59, 0x5D, 0x65, 0x6D, 0x77, 0x80, 0x88, 0x8E, 0x93, 0x95, 0x93, 0x91,
-	0x8E, 0x8A, 0x87, 0x84, 0x84, 0x85, 0x87, 0x88, 0x8A, 0x8A, 0x89, 0x85,
-	0x82, 0x7C, 0x76, 0x6F, 0x68, 0x62, 0x61, 0x5F, 0x65, 0x6D, 0x77, 0x85,
-	0x93, 0xA3, 0xAE, 0xB6, 0xBC, 0xBB, 0xB7, 0xAA, 0x9A, 0x88, 0x74, 0x60,
-	0x4E, 0x43, 0x3C, 0x3B, 0x42, 0x4E, 0x60, 0x76, 0x8D, 0xA4, 0xB5, 0xC4,
-	0xCC, 0xCD, 0xC6, 0xBA, 0xA9, 0x93, 0x7D, 0x67, 0x55, 0x46, 0x3F, 0x3D,
-	0x41, 0x4D, 0x5C, 0x70, 0x82, 0x97, 0xA7, 0xB1, 0xB8, 0xB9, 0xB4, 0xAC,
-	0xA0, 0x93, 0x84, 0x77, 0x6C, 0x64, 0x60, 0x61, 0x63, 0x68, 0x6F, 0x77,
-	0x81, 0x85, 0x88, 0x8B, 0x8B, 0x8A, 0x88, 0x87, 0x85, 0x84, 0x84, 0x87,
-	0x8A, 0x8D, 0x91, 0x94, 0x95, 0x93, 0x8D, 0x87, 0x80, 0x76, 0x6C, 0x62,
-	0x59, 0x57, 0x56, 0x5A, 0x64, 0x6F, 0x7F, 0x8F, 0xA0, 0xAF, 0xBA, 0xC0,
-	0xC2, 0xBC, 0xB2, 0xA2, 0x8E, 0x79, 0x65, 0x52, 0x42, 0x3C, 0x38, 0x3C,
-	0x4A, 0x5A, 0x6F, 0x87, 0x9E, 0xB2, 0xC1, 0xC9, 0xCC, 0xC7, 0xBC, 0xAC,
-	0x98, 0x82, 0x6D, 0x5C, 0x4C, 0x43, 0x40, 0x45, 0x4E, 0x5B, 0x6D, 0x81,
-	0x90, 0xA0, 0xA8, 0xB1, 0xB3, 0xB0, 0xA9, 0x9E, 0x94, 0x89, 0x7D, 0x74,
-	0x6B, 0x69, 0x6A, 0x6B, 0x6F, 0x75, 0x79, 0x7F, 0x82, 0x84, 0x84, 0x83,
-	0x82, 0x80, 0x80, 0x80, 0x81, 0x85, 0x8A, 0x8F, 0x95, 0x9A, 0x9C, 0x9E,
-	0x9D, 0x97, 0x8D, 0x83, 0x78, 0x6A, 0x5F, 0x55, 0x4F, 0x4E, 0x50, 0x5A,
-	0x66, 0x77, 0x8A, 0x9C, 0xAD, 0xBB, 0xC5, 0xC7, 0xC2, 0xBA, 0xA9, 0x96,
-	0x81, 0x68, 0x57, 0x45, 0x3A, 0x37, 0x3B, 0x45, 0x54, 0x6A, 0x80, 0x97,
-	0xAD, 0xBC, 0xC7, 0xCA, 0xC8, 0xBE, 0xAF, 0x9C, 0x89, 0x75, 0x62, 0x54,
-	0x4A, 0x46, 0x48, 0x50, 0x5A, 0x6A, 0x7B, 0x89, 0x97, 0xA2, 0xA8, 0xAA,
-	0xA9, 0xA2, 0x9A, 0x92, 0x88, 0x80, 0x7B, 0x74, 0x72, 0x72, 0x74, 0x77,
-	0x7A, 0x7C, 0x7E, 0x7E, 0x80, 0x7E, 0x7B, 0x79, 0x77, 0x78, 0x79, 0x7D,
-	0x84, 0x8A, 0x91, 0x9B, 0xA1, 0xA5, 0xA7, 0xA7, 0xA0, 0x95, 0x87, 0x7B,
-	0x6B, 0x5C, 0x51, 0x48, 0x46, 0x48, 0x52, 0x5E, 0x6F, 0x84, 0x98, 0xAB,
-	0xBA, 0xC5, 0xCA, 0xC7, 0xBE, 0xAF, 0x9C, 0x86, 0x6F, 0x5A, 0x48, 0x3E,
-	0x38, 0x39, 0x42, 0x4F, 0x65, 0x7A, 0x90, 0xA4, 0xB4, 0xC1, 0xC6, 0xC6,
-	0xBD, 0xB0, 0xA0, 0x8E, 0x7B, 0x69, 0x5B, 0x52, 0x4D, 0x4E, 0x54, 0x5D,
-	0x6B, 0x79, 0x83, 0x90, 0x99, 0xA0, 0xA2, 0xA1, 0x9D, 0x96, 0x90, 0x89,
-	0x83, 0x7F, 0x7C, 0x7C, 0x7A, 0x7B, 0x7D, 0x80, 0x7F, 0x80, 0x80, 0x7D,
-	0x78, 0x74, 0x71, 0x6F, 0x6D, 0x72, 0x77, 0x81, 0x8B, 0x93, 0x9E, 0xA7,
-	0xAE, 0xB0, 0xAE, 0xA8, 0x9D, 0x90, 0x80, 0x6D, 0x5D, 0x50, 0x46, 0x41,
-	0x42, 0x49, 0x56, 0x68, 0x7D, 0x94, 0xA9, 0xB9, 0xC6, 0xCB, 0xCA, 0xC4,
-	0xB5, 0xA3, 0x8C, 0x75, 0x5F, 0x4D, 0x40, 0x39, 0x39, 0x3F, 0x4E, 0x5F,
-	0x75, 0x8A, 0x9D, 0xAF, 0xBB, 0xC1, 0xC2, 0xBC, 0xB0, 0xA0, 0x91, 0x80,
-	0x6F, 0x62, 0x59, 0x55, 0x52, 0x58, 0x60, 0x6A, 0x76, 0x81, 0x8B, 0x92,
-	0x97, 0x99, 0x99, 0x96, 0x90, 0x8C, 0x88, 0x86, 0x83, 0x81, 0x83, 0x83,
-	0x83, 0x87, 0x85, 0x83, 0x81, 0x7E, 0x79, 0x71, 0x6C, 0x66, 0x64, 0x65,
-	0x68, 0x71, 0x7A, 0x86, 0x91, 0xA0, 0xAB, 0xB3, 0xB9, 0xB8, 0xB2, 0xA6,
-	0x99, 0x86, 0x74, 0x61, 0x50, 0x44, 0x3D, 0x3D, 0x44, 0x50, 0x61, 0x77,
-	0x8E, 0xA3, 0xB5, 0xC4, 0xCB, 0xCB, 0xC6, 0xB9, 0xA8, 0x91, 0x7D, 0x64,
-	0x52, 0x44, 0x3C, 0x38, 0x40, 0x4B, 0x5D, 0x70, 0x83, 0x98, 0xA9, 0xB4,
-	0xBB, 0xBD, 0xB8, 0xAF, 0xA2, 0x93, 0x84, 0x77, 0x6B, 0x62, 0x5F, 0x5D,
-	0x5F, 0x65, 0x6E, 0x77, 0x7F, 0x86, 0x8C, 0x8F, 0x90, 0x8E, 0x8D, 0x8A,
-	0x88, 0x86, 0x85, 0x86, 0x88, 0x89, 0x8C, 0x8D, 0x8E, 0x8D, 0x8A, 0x84,
-	0x80, 0x79, 0x6F, 0x66, 0x5F, 0x5C, 0x5C, 0x60, 0x68, 0x73, 0x80, 0x90,
-	0x9F, 0xAE, 0xB9, 0xBE, 0xBF, 0xB9, 0xAF, 0x9E, 0x8D, 0x79, 0x63, 0x51,
-	0x43, 0x3C, 0x3A, 0x3E, 0x49, 0x5A, 0x6F, 0x86, 0x9E, 0xB1, 0xC1, 0xCB,
-	0xCD, 0xC8, 0xBC, 0xAD, 0x97, 0x80, 0x6B, 0x59, 0x49, 0x41, 0x3E, 0x41,
-	0x4C, 0x5A, 0x6D, 0x80, 0x90, 0xA1, 0xAD, 0xB5, 0xB7, 0xB5, 0xAC, 0xA1,
-	0x94, 0x87, 0x7B, 0x72, 0x6A, 0x65, 0x64, 0x66, 0x6A, 0x6F, 0x79, 0x7F,
-	0x83, 0x85, 0x87, 0x88, 0x87, 0x86, 0x85, 0x83, 0x83, 0x85, 0x88, 0x8C,
-	0x90, 0x94, 0x98, 0x99, 0x97, 0x92, 0x8B, 0x83, 0x78, 0x6C, 0x61, 0x5A,
-	0x54, 0x51, 0x56, 0x5E, 0x6A, 0x7B, 0x8B, 0x9C, 0xAD, 0xBA, 0xC3, 0xC3,
-	0xC0, 0xB6, 0xA8, 0x94, 0x7E, 0x68, 0x55, 0x45, 0x3C, 0x38, 0x3B, 0x45,
-	0x55, 0x6A, 0x82, 0x98, 0xAD, 0xBE, 0xC7, 0xCB, 0xC9, 0xBF, 0xB0, 0x9C,
-	0x87, 0x71, 0x60, 0x51, 0x46, 0x43, 0x44, 0x4D, 0x5A, 0x6A, 0x7B, 0x8B,
-	0x99, 0xA4, 0xAC, 0xAF, 0xAD, 0xA6, 0x9E, 0x95, 0x8A, 0x7F, 0x77, 0x72,
-	0x6C, 0x6B, 0x6E, 0x71, 0x76, 0x7C, 0x7F, 0x7F, 0x81, 0x83, 0x7F, 0x7F,
-	0x80, 0x7E, 0x7E, 0x80, 0x85, 0x8B, 0x90, 0x97, 0x9D, 0xA1, 0xA2, 0xA0,
-	0x9B, 0x91, 0x87, 0x7A, 0x6C, 0x5F, 0x54, 0x4D, 0x48, 0x4C, 0x55, 0x62,
-	0x72, 0x85, 0x99, 0xAC, 0xBB, 0xC4, 0xC8, 0xC5, 0xBC, 0xAE, 0x9A, 0x84,
-	0x6F, 0x59, 0x47, 0x3C, 0x38, 0x3A, 0x41, 0x50, 0x64, 0x7C, 0x93, 0xA7,
-	0xB9, 0xC4, 0xC9, 0xC6, 0xBF, 0xB3, 0xA0, 0x8D, 0x7B, 0x67, 0x5A, 0x4E,
-	0x4A, 0x49, 0x4F, 0x5B, 0x69, 0x79, 0x86, 0x92, 0x9D, 0xA5, 0xA7, 0xA5,
-	0xA2, 0x9B, 0x92, 0x8A, 0x83, 0x7D, 0x79, 0x77, 0x75, 0x77, 0x7A, 0x7C,
-	0x7E, 0x80, 0x80, 0x7E, 0x7D, 0x7A, 0x76, 0x75, 0x75, 0x77, 0x7B, 0x81,
-	0x89, 0x92, 0x9B, 0xA3, 0xA8, 0xAB, 0xA8, 0xA4, 0x9A, 0x8C, 0x7F, 0x6E,
-	0x5F, 0x51, 0x47, 0x44, 0x45, 0x4E, 0x5A, 0x6B, 0x80, 0x94, 0xA8, 0xB9,
-	0xC4, 0xCB, 0xC9, 0xC3, 0xB4, 0xA1, 0x8B, 0x72, 0x5C, 0x4B, 0x3F, 0x37,
-	0x38, 0x40, 0x4E, 0x5F, 0x75, 0x8C, 0xA0, 0xB3, 0xBE, 0xC4, 0xC4, 0xBE,
-	0xB3, 0xA2, 0x91, 0x7F, 0x6E, 0x5F, 0x55, 0x4F, 0x4F, 0x54, 0x5E, 0x68,
-	0x77, 0x83, 0x8C, 0x96, 0x9C, 0x9E, 0x9E, 0x9B, 0x94, 0x8E, 0x89, 0x84,
-	0x80, 0x7E, 0x7D, 0x7E, 0x7F, 0x80, 0x82, 0x81, 0x80, 0x7D, 0x79, 0x76,
-	0x70, 0x6C, 0x69, 0x6A, 0x6D, 0x73, 0x7C, 0x87, 0x91, 0x9E, 0xA8, 0xAF,
-	0xB4, 0xB3, 0xAD, 0xA2, 0x95, 0x84, 0x73, 0x60, 0x51, 0x46, 0x3F, 0x3F,
-	0x46, 0x51, 0x64, 0x7A, 0x8E, 0xA4, 0xB6, 0xC4, 0xCB, 0xCB, 0xC6, 0xB9,
-	0xA8, 0x91, 0x7A, 0x64, 0x52, 0x43, 0x3A, 0x39, 0x3F, 0x4B, 0x5C, 0x71,
-	0x85, 0x9A, 0xAB, 0xB8, 0xBF, 0xC1, 0xBB, 0xB2, 0xA3, 0x93, 0x83, 0x74,
-	0x67, 0x5E, 0x57, 0x57, 0x5B, 0x61, 0x6B, 0x76, 0x80, 0x88, 0x8E, 0x94,
-	0x96, 0x95, 0x92, 0x8E, 0x8B, 0x88, 0x84, 0x83, 0x83, 0x83, 0x86, 0x87,
-	0x88, 0x88, 0x87, 0x82, 0x7F, 0x78, 0x6F, 0x69, 0x64, 0x60, 0x60, 0x66,
-	0x6E, 0x78, 0x82, 0x92, 0x9F, 0xAC, 0xB5, 0xBA, 0xBB, 0xB6, 0xAC, 0x9D,
-	0x8B, 0x79, 0x64, 0x53, 0x45, 0x3D, 0x3A, 0x41, 0x4B, 0x5D, 0x72, 0x88,
-	0x9F, 0xB4, 0xC1, 0xC9, 0xCC, 0xC7, 0xBC, 0xAB, 0x98, 0x80, 0x69, 0x57,
-	0x47, 0x3E, 0x3D, 0x3F, 0x4A, 0x5A, 0x6C, 0x80, 0x94, 0xA2, 0xAF, 0xB9,
-	0xBA, 0xB7, 0xAE, 0xA5, 0x97, 0x87, 0x7B, 0x6E, 0x66, 0x60, 0x5E, 0x61,
-	0x67, 0x6C, 0x76, 0x7E, 0x83, 0x89, 0x8C, 0x8D, 0x8E, 0x8B, 0x88, 0x87,
-	0x85, 0x87, 0x87, 0x88, 0x8B, 0x8F, 0x91, 0x92, 0x90, 0x8D, 0x87, 0x80,
-	0x79, 0x6D, 0x66, 0x5F, 0x58, 0x57, 0x5B, 0x63, 0x6D, 0x7D, 0x8E, 0x9D,
-	0xAD, 0xB9, 0xC0, 0xC2, 0xBF, 0xB4, 0xA5, 0x93, 0x7E, 0x68, 0x55, 0x46,
-	0x3D, 0x39, 0x3C, 0x46, 0x56, 0x6B, 0x81, 0x9B, 0xB0, 0xBE, 0xC8, 0xCC,
-	0xC8, 0xBF, 0xB0, 0x9D, 0x86, 0x71, 0x5E, 0x4F, 0x44, 0x40, 0x42, 0x4C,
-	0x59, 0x69, 0x7C, 0x8E, 0x9D, 0xAA, 0xB1, 0xB6, 0xB2, 0xAC, 0xA4, 0x96,
-	0x8B, 0x7F, 0x75, 0x6E, 0x6A, 0x68, 0x68, 0x6C, 0x72, 0x76, 0x7D, 0x80,
-	0x82, 0x84, 0x84, 0x83, 0x83, 0x81, 0x80, 0x81, 0x84, 0x88, 0x8C, 0x92,
-	0x98, 0x9B, 0x9B, 0x9B, 0x96, 0x8E, 0x84, 0x7A, 0x6E, 0x62, 0x58, 0x50,
-	0x4F, 0x51, 0x59, 0x66, 0x75, 0x87, 0x99, 0xAB, 0xB9, 0xC3, 0xC6, 0xC3,
-	0xBA, 0xAC, 0x99, 0x83, 0x6E, 0x59, 0x48, 0x3C, 0x39, 0x38, 0x41, 0x51,
-	0x64, 0x7E, 0x94, 0xA9, 0xBA, 0xC6, 0xCA, 0xC8, 0xC0, 0xB2, 0xA1, 0x8B,
-	0x77, 0x64, 0x54, 0x49, 0x46, 0x47, 0x4C, 0x59, 0x68, 0x78, 0x87, 0x95,
-	0xA2, 0xA9, 0xAD, 0xAB, 0xA7, 0x9E, 0x95, 0x8B, 0x83, 0x7A, 0x75, 0x70,
-	0x71, 0x73, 0x74, 0x78, 0x7B, 0x7E, 0x80, 0x81, 0x80, 0x7E, 0x7C, 0x7B,
-	0x7B, 0x7B, 0x7E, 0x83, 0x8A, 0x8F, 0x98, 0x9E, 0xA3, 0xA5, 0xA2, 0x9E,
-	0x96, 0x8A, 0x7C, 0x6E, 0x5E, 0x53, 0x4B, 0x47, 0x47, 0x4F, 0x5B, 0x6D,
-	0x80, 0x94, 0xA8, 0xB8, 0xC4, 0xC8, 0xC7, 0xC0, 0xB2, 0xA0, 0x8A, 0x72,
-	0x5D, 0x4A, 0x3E, 0x38, 0x38, 0x40, 0x4D, 0x5F, 0x77, 0x8D, 0xA2, 0xB5,
-	0xC1, 0xC7, 0xC8, 0xC2, 0xB3, 0xA2, 0x91, 0x7E, 0x6B, 0x5B, 0x54, 0x4D,
-	0x4A, 0x51, 0x5B, 0x66, 0x75, 0x83, 0x8F, 0x99, 0xA0, 0xA4, 0xA4, 0xA1,
-	0x9B, 0x93, 0x8C, 0x83, 0x7F, 0x7C, 0x79, 0x7A, 0x7B, 0x7C, 0x7F, 0x81,
-	0x80, 0x7F, 0x7D, 0x79, 0x75, 0x73, 0x70, 0x6F, 0x72, 0x76, 0x7E, 0x86,
-	0x90, 0x9C, 0xA3, 0xAA, 0xAE, 0xAD, 0xA8, 0x9E, 0x92, 0x81, 0x71, 0x61,
-	0x53, 0x47, 0x41, 0x41, 0x48, 0x54, 0x63, 0x7A, 0x8F, 0xA5, 0xB7, 0xC4,
-	0xCB, 0xCA, 0xC5, 0xB9, 0xA7, 0x92, 0x79, 0x63, 0x4F, 0x41, 0x3B, 0x39,
-	0x3D, 0x4A, 0x5D, 0x72, 0x86, 0x9C, 0xAE, 0xBB, 0xC2, 0xC4, 0xBF, 0xB5,
-	0xA5, 0x95, 0x82, 0x74, 0x64, 0x59, 0x54, 0x53, 0x57, 0x5D, 0x67, 0x74,
-	0x80, 0x8B, 0x90, 0x98, 0x9B, 0x9B, 0x99, 0x94, 0x90, 0x8A, 0x84, 0x81,
-	0x80, 0x80, 0x81, 0x81, 0x84, 0x84, 0x82, 0x81, 0x7E, 0x7A, 0x73, 0x6F,
-	0x6A, 0x66, 0x67, 0x69, 0x6F, 0x79, 0x83, 0x90, 0x9D, 0xA8, 0xB0, 0xB5,
-	0xB6, 0xB4, 0xA7, 0x99, 0x89, 0x76, 0x64, 0x54, 0x46, 0x3E, 0x3D, 0x42,
-	0x4D, 0x5F, 0x73, 0x89, 0xA0, 0xB4, 0xC4, 0xCA, 0xCC, 0xC6, 0xBB, 0xAB,
-	0x96, 0x7F, 0x69, 0x55, 0x46, 0x3B, 0x3A, 0x3E, 0x49, 0x59, 0x6D, 0x80,
-	0x94, 0xA6, 0xB5, 0xBB, 0xBF, 0xBC, 0xB3, 0xA4, 0x96, 0x87, 0x77, 0x6B,
-	0x61, 0x5C, 0x59, 0x5C, 0x63, 0x6B, 0x74, 0x7F, 0x86, 0x8C, 0x90, 0x92,
-	0x91, 0x90, 0x8C, 0x8B, 0x89, 0x86, 0x84, 0x86, 0x88, 0x8A, 0x8C, 0x8D,
-	0x8D, 0x8A, 0x86, 0x80, 0x7A, 0x70, 0x69, 0x63, 0x5E, 0x5D, 0x61, 0x67,
-	0x71, 0x7F, 0x8E, 0x9D, 0xAC, 0xB5, 0xBC, 0xBE, 0xBA, 0xB3, 0xA2, 0x8F,
-	0x7C, 0x67, 0x56, 0x47, 0x3D, 0x3A, 0x3E, 0x47, 0x58, 0x6D, 0x82, 0x9A,
-	0xAF, 0xBF, 0xC9, 0xCC, 0xCA, 0xBF, 0xB1, 0x9B, 0x84, 0x6F, 0x5C, 0x4C,
-	0x41, 0x3D, 0x3F, 0x49, 0x56, 0x68, 0x7C, 0x8E, 0x9F, 0xAC, 0xB5, 0xB8,
-	0xB5, 0xAF, 0xA4, 0x98, 0x8A, 0x7E, 0x73, 0x69, 0x63, 0x62, 0x64, 0x66,
-	0x6E, 0x75, 0x7C, 0x82, 0x85, 0x89, 0x8A, 0x89, 0x87, 0x85, 0x84, 0x83,
-	0x84, 0x87, 0x89, 0x8E, 0x92, 0x94, 0x97, 0x95, 0x92, 0x8C, 0x84, 0x7B,
-	0x6F, 0x66, 0x5E, 0x57, 0x54, 0x55, 0x5D, 0x69, 0x78, 0x89, 0x9B, 0xAA,
-	0xB7, 0xC0, 0xC2, 0xC1, 0xB7, 0xA9, 0x97, 0x81, 0x6D, 0x59, 0x49, 0x3D,
-	0x38, 0x3A, 0x43, 0x52, 0x67, 0x7E, 0x93, 0xA9, 0xBB, 0xC5, 0xCB, 0xC8,
-	0xC0, 0xB2, 0xA0, 0x8C, 0x76, 0x62, 0x53, 0x47, 0x40, 0x42, 0x4A, 0x56,
-	0x66, 0x78, 0x88, 0x98, 0xA3, 0xAC, 0xB1, 0xAE, 0xAB, 0xA1, 0x97, 0x8B,
-	0x7F, 0x77, 0x72, 0x6D, 0x6B, 0x6D, 0x6F, 0x74, 0x78, 0x7D, 0x80, 0x82,
-	0x82, 0x81, 0x80, 0x7E, 0x7E, 0x7F, 0x80, 0x83, 0x88, 0x8D, 0x93, 0x99,
-	0x9F, 0xA0, 0x9E, 0x9A, 0x91, 0x87, 0x7B, 0x6F, 0x62, 0x57, 0x4F, 0x4B,
-	0x4D, 0x54, 0x60, 0x6F, 0x83, 0x96, 0xA8, 0xB7, 0xC2, 0xC8, 0xC6, 0xBF,
-	0xB1, 0x9E, 0x89, 0x73, 0x5D, 0x4A, 0x3D, 0x37, 0x38, 0x3F, 0x4E, 0x61,
-	0x76, 0x8E, 0xA4, 0xB6, 0xC2, 0xC9, 0xC8, 0xC1, 0xB6, 0xA4, 0x90, 0x7D,
-	0x6A, 0x59, 0x4F, 0x48, 0x48, 0x4E, 0x58, 0x66, 0x74, 0x83, 0x90, 0x9C,
-	0xA4, 0xA9, 0xA7, 0xA4, 0x9E, 0x95, 0x8C, 0x84, 0x7E, 0x77, 0x73, 0x73,
-	0x74, 0x76, 0x7A, 0x7C, 0x7F, 0x80, 0x7F, 0x7E, 0x7A, 0x78, 0x76, 0x75,
-	0x77, 0x7C, 0x80, 0x88, 0x90, 0x96, 0x9F, 0xA7, 0xA9, 0xA8, 0xA3, 0x9B,
-	0x8E, 0x80, 0x71, 0x61, 0x55, 0x49, 0x46, 0x47, 0x4D, 0x58, 0x69, 0x7C,
-	0x91, 0xA6, 0xB7, 0xC3, 0xCA, 0xCB, 0xC4, 0xB7, 0xA5, 0x90, 0x7B, 0x62,
-	0x4F, 0x41, 0x38, 0x37, 0x3D, 0x49, 0x5C, 0x71, 0x86, 0x9D, 0xAF, 0xBE,
-	0xC4, 0xC5, 0xC1, 0xB5, 0xA5, 0x94, 0x82, 0x70, 0x60, 0x56, 0x4E, 0x4F,
-	0x52, 0x5A, 0x64, 0x73, 0x80, 0x8B, 0x95, 0x9B, 0x9F, 0xA0, 0x9C, 0x98,
-	0x92, 0x8B, 0x84, 0x81, 0x7D, 0x7E, 0x7D, 0x7D, 0x80, 0x7F, 0x7F, 0x80,
-	0x7E, 0x7C, 0x78, 0x74, 0x6E, 0x6D, 0x6C, 0x6D, 0x74, 0x7B, 0x84, 0x8F,
-	0x99, 0xA4, 0xAC, 0xB1, 0xB1, 0xAC, 0xA3, 0x97, 0x88, 0x75, 0x64, 0x55,
-	0x47, 0x40, 0x3E, 0x44, 0x50, 0x60, 0x75, 0x8B, 0xA1, 0xB3, 0xC3, 0xCB,
-	0xCD, 0xC8, 0xBC, 0xAB, 0x97, 0x80, 0x69, 0x54, 0x45, 0x3D, 0x38, 0x3D,
-	0x48, 0x5A, 0x6C, 0x81, 0x96, 0xA8, 0xB6, 0xBF, 0xC1, 0xBE, 0xB5, 0xA6,
-	0x97, 0x86, 0x77, 0x68, 0x5D, 0x56, 0x56, 0x58, 0x5F, 0x67, 0x73, 0x7E,
-	0x87, 0x8E, 0x94, 0x96, 0x98, 0x95, 0x93, 0x8E, 0x89, 0x86, 0x84, 0x83,
-	0x83, 0x85, 0x86, 0x87, 0x87, 0x86, 0x82, 0x7F, 0x78, 0x73, 0x6C, 0x66,
-	0x64, 0x62, 0x65, 0x6B, 0x74, 0x80, 0x8E, 0x9C, 0xA9, 0xB4, 0xB9, 0xBB,
-	0xB7, 0xAE, 0x9F, 0x8E, 0x7B, 0x66, 0x56, 0x49, 0x3E, 0x3C, 0x3F, 0x49,
-	0x59, 0x6E, 0x85, 0x9C, 0xB0, 0xC0, 0xCA, 0xCD, 0xC9, 0xC0, 0xB0, 0x9B,
-	0x83, 0x6E, 0x5A, 0x4A, 0x41, 0x3C, 0x3D, 0x46, 0x54, 0x68, 0x7D, 0x90,
-	0xA2, 0xAF, 0xB7, 0xBD, 0xBA, 0xB4, 0xA6, 0x99, 0x8A, 0x7B, 0x6F, 0x64,
-	0x5F, 0x5D, 0x5E, 0x64, 0x6A, 0x73, 0x7B, 0x83, 0x89, 0x8D, 0x8F, 0x90,
-	0x8D, 0x8A, 0x88, 0x85, 0x85, 0x85, 0x87, 0x89, 0x8C, 0x8F, 0x8F, 0x90,
-	0x8E, 0x88, 0x81, 0x7A, 0x71, 0x68, 0x61, 0x5B, 0x58, 0x5C, 0x63, 0x6D,
-	0x7A, 0x89, 0x99, 0xA9, 0xB4, 0xBD, 0xC2, 0xBE, 0xB4, 0xA7, 0x96, 0x80,
-	0x6C, 0x5A, 0x48, 0x3D, 0x3A, 0x3C, 0x44, 0x52, 0x67, 0x7E, 0x95, 0xAB,
-	0xBC, 0xC7, 0xCD, 0xCB, 0xC2, 0xB5, 0xA0, 0x8B, 0x75, 0x61, 0x50, 0x44,
-	0x40, 0x41, 0x47, 0x56, 0x65, 0x79, 0x89, 0x9A, 0xAA, 0xB0, 0xB5, 0xB5,
-	0xAD, 0xA5, 0x9A, 0x8C, 0x80, 0x75, 0x6E, 0x67, 0x65, 0x67, 0x6A, 0x70,
-	0x76, 0x7C, 0x81, 0x84, 0x85, 0x86, 0x85, 0x85, 0x83, 0x81, 0x80, 0x85,
-	0x86, 0x8A, 0x90, 0x95, 0x98, 0x99, 0x99, 0x96, 0x8F, 0x85, 0x7D, 0x71,
-	0x64, 0x5B, 0x55, 0x51, 0x53, 0x59, 0x65, 0x73, 0x85, 0x98, 0xA7, 0xB8,
-	0xC1, 0xC5, 0xC5, 0xBC, 0xAE, 0x9D, 0x88, 0x72, 0x5D, 0x4B, 0x3F, 0x39,
-	0x38, 0x40, 0x4E, 0x61, 0x78, 0x8E, 0xA5, 0xB6, 0xC3, 0xC8, 0xC9, 0xC1,
-	0xB6, 0xA3, 0x90, 0x7A, 0x66, 0x57, 0x4A, 0x43, 0x45, 0x4A, 0x55, 0x63,
-	0x74, 0x84, 0x93, 0xA1, 0xA9, 0xAE, 0xAE, 0xA9, 0xA3, 0x97, 0x8D, 0x83,
-	0x7B, 0x75, 0x70, 0x6F, 0x6F, 0x73, 0x76, 0x79, 0x7D, 0x80, 0x80, 0x80,
-	0x80, 0x7D, 0x7C, 0x7B, 0x7B, 0x7E, 0x81, 0x87, 0x8B, 0x95, 0x9C, 0xA0,
-	0xA2, 0xA2, 0x9F, 0x96, 0x8C, 0x7F, 0x71, 0x63, 0x56, 0x4C, 0x49, 0x49,
-	0x4F, 0x5A, 0x6A, 0x7E, 0x92, 0xA5, 0xB5, 0xC2, 0xC9, 0xC9, 0xC2, 0xB6,
-	0xA4, 0x8E, 0x79, 0x61, 0x4E, 0x41, 0x39, 0x39, 0x3D, 0x49, 0x5D, 0x72,
-	0x88, 0x9F, 0xB2, 0xBE, 0xC6, 0xC8, 0xC3, 0xB8, 0xA6, 0x96, 0x80, 0x6E,
-	0x5E, 0x52, 0x4B, 0x4A, 0x4E, 0x58, 0x64, 0x72, 0x80, 0x8E, 0x98, 0xA2,
-	0xA5, 0xA6, 0xA1, 0x9C, 0x95, 0x8C, 0x86, 0x80, 0x7C, 0x78, 0x77, 0x77,
-	0x7A, 0x7D, 0x7E, 0x80, 0x80, 0x7E, 0x7D, 0x78, 0x74, 0x71, 0x71, 0x73,
-	0x77, 0x7D, 0x84, 0x8E, 0x97, 0xA0, 0xA6, 0xAB, 0xAD, 0xA8, 0x9F, 0x92,
-	0x84, 0x74, 0x65, 0x55, 0x4A, 0x45, 0x42, 0x48, 0x53, 0x64, 0x78, 0x8C,
-	0xA1, 0xB4, 0xC2, 0xC9, 0xCB, 0xC7, 0xBB, 0xA9, 0x93, 0x7E, 0x68, 0x53,
-	0x43, 0x3A, 0x36, 0x3C, 0x48, 0x58, 0x6C, 0x82, 0x98, 0xAA, 0xB8, 0xC2,
-	0xC5, 0xBF, 0xB7, 0xA8, 0x97, 0x85, 0x73, 0x65, 0x5B, 0x51, 0x50, 0x54,
-	0x5A, 0x65, 0x71, 0x7D, 0x88, 0x91, 0x99, 0x9C, 0x9D, 0x9A, 0x97, 0x91,
-	0x8B, 0x87, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x83, 0x83, 0x84, 0x82, 0x7F,
-	0x7D, 0x77, 0x72, 0x6D, 0x6A, 0x69, 0x6A, 0x70, 0x77, 0x81, 0x8D, 0x99,
-	0xA5, 0xAD, 0xB3, 0xB5, 0xB1, 0xA8, 0x9B, 0x8C, 0x7A, 0x67, 0x56, 0x48,
-	0x40, 0x3D, 0x42, 0x4B, 0x5A, 0x6E, 0x85, 0x9D, 0xB2, 0xBF, 0xCA, 0xCD,
-	0xC8, 0xBF, 0xB0, 0x9A, 0x82, 0x6E, 0x59, 0x46, 0x3E, 0x3A, 0x3C, 0x45,
-	0x54, 0x66, 0x7C, 0x91, 0xA4, 0xB2, 0xBB, 0xC0, 0xBD, 0xB5, 0xA9, 0x9A,
-	0x8A, 0x7A, 0x6C, 0x62, 0x5B, 0x58, 0x59, 0x61, 0x68, 0x70, 0x7E, 0x85,
-	0x8B, 0x91, 0x92, 0x93, 0x92, 0x90, 0x8C, 0x88, 0x85, 0x85, 0x84, 0x84,
-	0x88, 0x88, 0x8A, 0x8B, 0x88, 0x86, 0x80, 0x7A, 0x73, 0x6C, 0x66, 0x61,
-	0x60, 0x61, 0x67, 0x71, 0x7C, 0x8B, 0x99, 0xA6, 0xB3, 0xBA, 0xBC, 0xB8,
-	0xB2, 0xA3, 0x92, 0x80, 0x6B, 0x5A, 0x4A, 0x3F, 0x3C, 0x3D, 0x47, 0x54,
-	0x68, 0x80, 0x97, 0xAA, 0xBD, 0xC9, 0xCD, 0xCB, 0xC2, 0xB3, 0x9E, 0x89,
-	0x73, 0x5F, 0x4E, 0x41, 0x3D, 0x3E, 0x46, 0x52, 0x64, 0x78, 0x8B, 0x9D,
-	0xAB, 0xB5, 0xB9, 0xB7, 0xB1, 0xA7, 0x9A, 0x8C, 0x7F, 0x73, 0x6A, 0x64,
-	0x60, 0x62, 0x67, 0x6C, 0x74, 0x7B, 0x81, 0x86, 0x8A, 0x8A, 0x8A, 0x8A,
-	0x87, 0x86, 0x86, 0x86, 0x86, 0x89, 0x8C, 0x90, 0x93, 0x93, 0x93, 0x91,
-	0x8C, 0x84, 0x7C, 0x72, 0x68, 0x60, 0x59, 0x56, 0x57, 0x5E, 0x68, 0x75,
-	0x85, 0x96, 0xA5, 0xB4, 0xBE, 0xC2, 0xC0, 0xBA, 0xAC, 0x9A, 0x86, 0x70,
-	0x5C, 0x4B, 0x3F, 0x39, 0x39, 0x41, 0x4F, 0x63, 0x79, 0x90, 0xA5, 0xB9,
-	0xC6, 0xCB, 0xCB, 0xC3, 0xB6, 0xA4, 0x90, 0x79, 0x66, 0x55, 0x48, 0x42,
-	0x41, 0x49, 0x53, 0x62, 0x74, 0x85, 0x96, 0xA3, 0xAC, 0xB2, 0xB2, 0xAC,
-	0xA5, 0x9B, 0x8F, 0x83, 0x78, 0x72, 0x6B, 0x69, 0x6B, 0x6C, 0x72, 0x77,
-	0x7B, 0x80, 0x82, 0x85, 0x83, 0x83, 0x82, 0x7F, 0x80, 0x80, 0x83, 0x87,
-	0x8C, 0x91, 0x98, 0x9D, 0x9D, 0x9E, 0x9A, 0x94, 0x89, 0x7F, 0x73, 0x66,
-	0x59, 0x52, 0x4F, 0x4E, 0x54, 0x5E, 0x6D, 0x7F, 0x92, 0xA3, 0xB4, 0xC0,
-	0xC6, 0xC7, 0xC0, 0xB4, 0xA2, 0x8D, 0x76, 0x60, 0x4D, 0x40, 0x38, 0x37,
-	0x3E, 0x4A, 0x5C, 0x73, 0x8A, 0xA1, 0xB5, 0xC1, 0xCA, 0xC9, 0xC4, 0xBA,
-	0xA8, 0x94, 0x80, 0x6D, 0x5B, 0x4F, 0x48, 0x46, 0x4A, 0x55, 0x62, 0x71,
-	0x81, 0x8F, 0x9C, 0xA5, 0xA9, 0xAA, 0xA6, 0xA1, 0x99, 0x90, 0x85, 0x7F,
-	0x77, 0x75, 0x73, 0x72, 0x74, 0x78, 0x7C, 0x7D, 0x7F, 0x80, 0x7F, 0x7D,
-	0x78, 0x79, 0x77, 0x78, 0x7A, 0x80, 0x86, 0x8D, 0x95, 0x9C, 0xA3, 0xA6,
-	0xA6, 0xA2, 0x9A, 0x90, 0x82, 0x74, 0x64, 0x58, 0x4D, 0x47, 0x49, 0x4A,
-	0x56, 0x64, 0x78, 0x8D, 0xA1, 0xB3, 0xC1, 0xC9, 0xC9, 0xC5, 0xB9, 0xA9,
-	0x94, 0x7E, 0x67, 0x52, 0x44, 0x3A, 0x37, 0x3E, 0x48, 0x58, 0x6D, 0x84,
-	0x9B, 0xAC, 0xBB, 0xC4, 0xC7, 0xC2, 0xB9, 0xAA, 0x97, 0x84, 0x74, 0x62,
-	0x56, 0x4E, 0x4C, 0x4F, 0x57, 0x63, 0x70, 0x7E, 0x89, 0x94, 0x9C, 0xA1,
-	0xA2, 0xA0, 0x9B, 0x95, 0x8D, 0x87, 0x82, 0x7E, 0x7C, 0x7B, 0x7C, 0x7F,
-	0x81, 0x81, 0x80, 0x7F, 0x7D, 0x79, 0x77, 0x71, 0x70, 0x6F, 0x6E, 0x73,
-	0x7A, 0x83, 0x8D, 0x96, 0xA1, 0xA9, 0xAF, 0xB1, 0xAC, 0xA4, 0x99, 0x89,
-	0x79, 0x66, 0x59, 0x4C, 0x43, 0x42, 0x44, 0x4E, 0x60, 0x72, 0x87, 0x9D,
-	0xB0, 0xC1, 0xCA, 0xCB, 0xC9, 0xC0, 0xAF, 0x9A, 0x82, 0x6C, 0x57, 0x46,
-	0x3E, 0x37, 0x3B, 0x45, 0x53, 0x67, 0x7E, 0x93, 0xA6, 0xB5, 0xC0, 0xC2,
-	0xBF, 0xB7, 0xAA, 0x9B, 0x89, 0x7A, 0x69, 0x5D, 0x57, 0x52, 0x54, 0x5B,
-	0x64, 0x6F, 0x7A, 0x85, 0x8F, 0x95, 0x98, 0x9A, 0x98, 0x95, 0x91, 0x8C,
-	0x89, 0x85, 0x82, 0x82, 0x82, 0x85, 0x86, 0x86, 0x85, 0x84, 0x81, 0x7B,
-	0x75, 0x70, 0x6A, 0x65, 0x64, 0x66, 0x6B, 0x73, 0x7F, 0x8A, 0x99, 0xA4,
-	0xAD, 0xB6, 0xB9, 0xB7, 0xAE, 0xA1, 0x91, 0x80, 0x6B, 0x59, 0x4A, 0x42,
-	0x3D, 0x3E, 0x48, 0x56, 0x6B, 0x7F, 0x98, 0xAC, 0xBD, 0xC8, 0xCD, 0xCA,
-	0xC1, 0xB2, 0x9F, 0x8A, 0x72, 0x5E, 0x4F, 0x41, 0x3C, 0x3D, 0x44, 0x53,
-	0x65, 0x79, 0x8C, 0xA1, 0xAF, 0xB7, 0xBD, 0xBC, 0xB5, 0xAA, 0x9C, 0x8D,
-	0x7E, 0x70, 0x65, 0x5F, 0x5A, 0x5B, 0x5F, 0x67, 0x72, 0x79, 0x81, 0x88,
-	0x8C, 0x8F, 0x90, 0x8F, 0x8C, 0x8B, 0x87, 0x85, 0x85, 0x86, 0x88, 0x89,
-	0x8D, 0x8E, 0x8F, 0x8D, 0x89, 0x83, 0x7D, 0x74, 0x6B, 0x63, 0x5D, 0x5B,
-	0x5C, 0x63, 0x6C, 0x78, 0x88, 0x97, 0xA6, 0xB3, 0xBC, 0xBF, 0xBD, 0xB6,
-	0xAA, 0x99, 0x84, 0x70, 0x5C, 0x4A, 0x3F, 0x3A, 0x3A, 0x42, 0x52, 0x65,
-	0x7A, 0x91, 0xA7, 0xBA, 0xC6, 0xCB, 0xCB, 0xC4, 0xB6, 0xA4, 0x90, 0x79,
-	0x64, 0x52, 0x45, 0x40, 0x3F, 0x46, 0x52, 0x61, 0x75, 0x86, 0x98, 0xA6,
-	0xB0, 0xB6, 0xB7, 0xB0, 0xA8, 0x9C, 0x8E, 0x81, 0x76, 0x6E, 0x67, 0x64,
-	0x65, 0x67, 0x6D, 0x75, 0x7C, 0x80, 0x84, 0x87, 0x89, 0x87, 0x86, 0x84,
-	0x83, 0x83, 0x84, 0x86, 0x88, 0x8C, 0x90, 0x96, 0x98, 0x98, 0x96, 0x8F,
-	0x87, 0x7E, 0x73, 0x68, 0x5E, 0x57, 0x53, 0x53, 0x58, 0x62, 0x70, 0x82,
-	0x94, 0xA4, 0xB3, 0xBF, 0xC4, 0xC4, 0xBD, 0xB0, 0xA0, 0x8D, 0x75, 0x5F,
-	0x4E, 0x41, 0x39, 0x38, 0x3F, 0x4B, 0x5D, 0x75, 0x8B, 0xA0, 0xB4, 0xC2,
-	0xC8, 0xCB, 0xC6, 0xB7, 0xA9, 0x92, 0x80, 0x6A, 0x58, 0x4C, 0x44, 0x42,
-	0x47, 0x53, 0x5F, 0x6F, 0x82, 0x91, 0x9F, 0xA9, 0xAE, 0xAF, 0xAB, 0xA3,
-	0x99, 0x90, 0x82, 0x7B, 0x74, 0x6F, 0x6C, 0x6C, 0x70, 0x73, 0x78, 0x7A,
-	0x7F, 0x80, 0x81, 0x81, 0x80, 0x7E, 0x7D, 0x7C, 0x7F, 0x82, 0x86, 0x8B,
-	0x92, 0x9A, 0x9E, 0xA2, 0xA2, 0x9F, 0x97, 0x8D, 0x81, 0x74, 0x67, 0x59,
-	0x52, 0x4B, 0x49, 0x4D, 0x59, 0x68, 0x7A, 0x8D, 0xA1, 0xB2, 0xBE, 0xC6,
-	0xC9, 0xC4, 0xB6, 0xA7, 0x92, 0x7B, 0x64, 0x51, 0x43, 0x3A, 0x36, 0x3C,
-	0x49, 0x58, 0x6E, 0x85, 0x9B, 0xAF, 0xBE, 0xC7, 0xC9, 0xC5, 0xBB, 0xAC,
-	0x99, 0x85, 0x70, 0x60, 0x53, 0x49, 0x49, 0x4A, 0x53, 0x62, 0x6F, 0x7D,
-	0x8B, 0x97, 0xA0, 0xA6, 0xA7, 0xA4, 0x9F, 0x97, 0x90, 0x87, 0x80, 0x7A,
-	0x77, 0x74, 0x75, 0x78, 0x7A, 0x7E, 0x7F, 0x7E, 0x7D, 0x7E, 0x7C, 0x75,
-	0x76, 0x74, 0x75, 0x77, 0x7D, 0x84, 0x8C, 0x96, 0x9D, 0xA5, 0xAA, 0xAB,
-	0xA7, 0x9E, 0x95, 0x87, 0x78, 0x68, 0x57, 0x4D, 0x46, 0x43, 0x48, 0x52,
-	0x60, 0x73, 0x88, 0x9D, 0xB0, 0xC0, 0xC7, 0xCB, 0xC6, 0xBE, 0xAD, 0x97,
-	0x82, 0x6C, 0x57, 0x47, 0x3A, 0x39, 0x3A, 0x45, 0x56, 0x67, 0x7F, 0x94,
-	0xA8, 0xB7, 0xC2, 0xC6, 0xC3, 0xBA, 0xAC, 0x9B, 0x8A, 0x78, 0x67, 0x5A,
-	0x53, 0x50, 0x50, 0x58, 0x63, 0x6E, 0x7C, 0x87, 0x91, 0x99, 0x9C, 0xA0,
-	0x9D, 0x99, 0x93, 0x8C, 0x86, 0x82, 0x80, 0x7D, 0x7D, 0x7F, 0x80, 0x81,
-	0x82, 0x81, 0x80, 0x7D, 0x79, 0x74, 0x6E, 0x6B, 0x69, 0x6B, 0x70, 0x76,
-	0x81, 0x8A, 0x96, 0xA2, 0xAB, 0xB2, 0xB4, 0xAF, 0xA9, 0x9D, 0x8D, 0x7D,
-	0x6A, 0x5B, 0x4C, 0x42, 0x40, 0x42, 0x4A, 0x5A, 0x6C, 0x82, 0x97, 0xAC,
-	0xBD, 0xC7, 0xCD, 0xCA, 0xC2, 0xB3, 0x9F, 0x87, 0x72, 0x5B, 0x4C, 0x40,
-	0x39, 0x3B, 0x43, 0x51, 0x63, 0x79, 0x8D, 0xA2, 0xB1, 0xBB, 0xC1, 0xBF,
-	0xB9, 0xAC, 0x9E, 0x8D, 0x7D, 0x6E, 0x65, 0x5B, 0x58, 0x58, 0x5D, 0x64,
-	0x6F, 0x7A, 0x82, 0x8A, 0x91, 0x96, 0x96, 0x95, 0x93, 0x8E, 0x8B, 0x87,
-	0x83, 0x83, 0x83, 0x85, 0x88, 0x88, 0x8A, 0x88, 0x84, 0x7F, 0x7C, 0x75,
-	0x6E, 0x68, 0x63, 0x61, 0x63, 0x67, 0x70, 0x79, 0x88, 0x97, 0xA4, 0xB1,
-	0xB8, 0xBC, 0xBB, 0xB2, 0xA6, 0x94, 0x83, 0x6E, 0x5D, 0x4D, 0x40, 0x3C,
-	0x3D, 0x43, 0x50, 0x64, 0x7C, 0x92, 0xA8, 0xBA, 0xC6, 0xCC, 0xCB, 0xC3,
-	0xB7, 0xA4, 0x8E, 0x78, 0x61, 0x50, 0x44, 0x3D, 0x3C, 0x44, 0x50, 0x61,
-	0x75, 0x89, 0x9A, 0xA9, 0xB5, 0xBA, 0xBB, 0xB4, 0xAB, 0x9E, 0x90, 0x7F,
-	0x75, 0x6C, 0x62, 0x5D, 0x60, 0x65, 0x69, 0x71, 0x7B, 0x7F, 0x87, 0x8A,
-	0x8E, 0x8D, 0x8C, 0x89, 0x87, 0x87, 0x86, 0x86, 0x87, 0x8A, 0x8D, 0x90,
-	0x93, 0x93, 0x8F, 0x8B, 0x85, 0x7E, 0x74, 0x6A, 0x62, 0x5B, 0x58, 0x57,
-	0x5E, 0x67, 0x74, 0x82, 0x93, 0xA5, 0xB2, 0xBB, 0xC1, 0xC0, 0xB9, 0xAE,
-	0x9C, 0x88, 0x74, 0x5F, 0x4D, 0x40, 0x39, 0x38, 0x3E, 0x4C, 0x5E, 0x74,
-	0x8B, 0xA0, 0xB5, 0xC3, 0xCA, 0xCC, 0xC5, 0xB9, 0xA9, 0x94, 0x7D, 0x68,
-	0x57, 0x49, 0x40, 0x40, 0x46, 0x50, 0x5E, 0x71, 0x82, 0x93, 0xA4, 0xAC,
-	0xB2, 0xB4, 0xB0, 0xA7, 0x9D, 0x91, 0x83, 0x7A, 0x71, 0x6B, 0x67, 0x67,
-	0x6A, 0x6F, 0x74, 0x7A, 0x7F, 0x81, 0x84, 0x85, 0x84, 0x83, 0x80, 0x81,
-	0x80, 0x83, 0x86, 0x8A, 0x90, 0x93, 0x98, 0x9C, 0x9B, 0x99, 0x94, 0x8B,
-	0x80, 0x76, 0x69, 0x5F, 0x56, 0x51, 0x4E, 0x52, 0x5E, 0x6B, 0x7D, 0x8F,
-	0xA1, 0xB2, 0xBC, 0xC4, 0xC5, 0xC0, 0xB6, 0xA4, 0x90, 0x79, 0x64, 0x51,
-	0x43, 0x3A, 0x36, 0x3C, 0x49, 0x59, 0x6F, 0x86, 0x9C, 0xAF, 0xBF, 0xC8,
-	0xCA, 0xC7, 0xBD, 0xAA, 0x97, 0x83, 0x6E, 0x5E, 0x4F, 0x47, 0x43, 0x48,
-	0x51, 0x5E, 0x6E, 0x7F, 0x8E, 0x9A, 0xA6, 0xAC, 0xAD, 0xAB, 0xA3, 0x9B,
-	0x90, 0x87, 0x7F, 0x78, 0x72, 0x70, 0x6F, 0x71, 0x75, 0x79, 0x7D, 0x80,
-	0x7F, 0x80, 0x7E, 0x7D, 0x7B, 0x79, 0x79, 0x7D, 0x80, 0x84, 0x8B, 0x93,
-	0x9B, 0xA0, 0xA3, 0xA6, 0xA1, 0x9C, 0x91, 0x83, 0x76, 0x69, 0x5B, 0x51,
-	0x4A, 0x46, 0x4A, 0x55, 0x61, 0x74, 0x89, 0x9C, 0xB0, 0xBE, 0xC7, 0xC9,
-	0xC6, 0xBD, 0xAB, 0x98, 0x80, 0x69, 0x56, 0x46, 0x3B, 0x37, 0x3A, 0x43,
-	0x55, 0x69, 0x81, 0x97, 0xAA, 0xBA, 0xC4, 0xC7, 0xC5, 0xBC, 0xAD, 0x9C,
-	0x87, 0x76, 0x66, 0x57, 0x4D, 0x4C, 0x4E, 0x54, 0x60, 0x6D, 0x7C, 0x88,
-	0x95, 0x9E, 0xA2, 0xA4, 0xA1, 0x9E, 0x98, 0x8E, 0x88, 0x82, 0x7E, 0x7A,
-	0x7A, 0x7A, 0x7B, 0x7D, 0x7D, 0x81, 0x7F, 0x7E, 0x7D, 0x79, 0x76, 0x71,
-	0x70, 0x6F, 0x74, 0x7A, 0x80, 0x8B, 0x95, 0x9F, 0xA6, 0xAB, 0xAF, 0xAC,
-	0xA5, 0x99, 0x8C, 0x7A, 0x6A, 0x5B, 0x4C, 0x45, 0x43, 0x44, 0x4D, 0x5B,
-	0x6F, 0x82, 0x98, 0xAC, 0xBC, 0xC6, 0xCA, 0xC8, 0xC1, 0xB1, 0x9E, 0x88,
-	0x6F, 0x5B, 0x49, 0x3E, 0x38, 0x3A, 0x43, 0x51, 0x64, 0x79, 0x90, 0xA3,
-	0xB3, 0xBF, 0xC4, 0xC1, 0xBB, 0xAE, 0x9F, 0x8D, 0x7C, 0x6C, 0x5F, 0x56,
-	0x53, 0x52, 0x58, 0x61, 0x6C, 0x79, 0x84, 0x8E, 0x94, 0x9A, 0x9A, 0x9A,
-	0x97, 0x92, 0x8B, 0x87, 0x84, 0x81, 0x80, 0x81, 0x82, 0x83, 0x85, 0x85,
-	0x83, 0x7F, 0x7E, 0x79, 0x72, 0x6D, 0x69, 0x66, 0x67, 0x6C, 0x73, 0x7E,
-	0x88, 0x95, 0xA4, 0xAD, 0xB4, 0xB8, 0xB5, 0xAD, 0xA2, 0x93, 0x81, 0x6E,
-	0x5E, 0x4C, 0x41, 0x3D, 0x3E, 0x46, 0x53, 0x66, 0x7D, 0x94, 0xAA, 0xB9,
-	0xC8, 0xCD, 0xCC, 0xC4, 0xB4, 0xA3, 0x8C, 0x77, 0x60, 0x4F, 0x42, 0x3B,
-	0x3B, 0x42, 0x4E, 0x60, 0x75, 0x89, 0x9C, 0xAD, 0xB8, 0xBD, 0xBE, 0xB8,
-	0xAD, 0xA0, 0x90, 0x80, 0x72, 0x67, 0x5E, 0x5A, 0x5B, 0x5E, 0x66, 0x6F,
-	0x78, 0x80, 0x88, 0x8E, 0x91, 0x92, 0x91, 0x8E, 0x8B, 0x89, 0x86, 0x83,
-	0x85, 0x86, 0x87, 0x8A, 0x8D, 0x8B, 0x8C, 0x88, 0x83, 0x7C, 0x75, 0x6E,
-	0x66, 0x60, 0x5D, 0x5F, 0x62, 0x6C, 0x77, 0x85, 0x95, 0xA2, 0xAF, 0xB8,
-	0xBE, 0xBD, 0xB7, 0xAB, 0x9A, 0x88, 0x74, 0x5F, 0x4D, 0x40, 0x3A, 0x3A,
-	0x40, 0x4D, 0x60, 0x77, 0x8E, 0xA2, 0xB7, 0xC3, 0xCB, 0xCE, 0xC7, 0xB9,
-	0xA8, 0x93, 0x7D, 0x68, 0x55, 0x47, 0x3E, 0x3C, 0x42, 0x4D, 0x5D, 0x6F,
-	0x83, 0x96, 0xA5, 0xAF, 0xB6, 0xB8, 0xB3, 0xAA, 0xA0, 0x91, 0x84, 0x78,
-	0x6F, 0x66, 0x62, 0x64, 0x66, 0x6B, 0x71, 0x79, 0x80, 0x83, 0x88, 0x88,
-	0x8A, 0x8A, 0x86, 0x86, 0x84, 0x84, 0x85, 0x87, 0x8B, 0x90, 0x93, 0x97,
-	0x96, 0x93, 0x8F, 0x88, 0x80, 0x75, 0x6A, 0x61, 0x58, 0x55, 0x55, 0x59,
-	0x62, 0x6E, 0x7E, 0x8F, 0xA0, 0xB3, 0xBC, 0xC3, 0xC3, 0xBE, 0xB2, 0xA2,
-	0x8F, 0x78, 0x64, 0x53, 0x42, 0x3A, 0x38, 0x3E, 0x48, 0x5A, 0x70, 0x86,
-	0x9C, 0xB1, 0xC0, 0xC9, 0xCC, 0xC8, 0xBB, 0xAC, 0x99, 0x82, 0x6D, 0x5C,
-	0x4D, 0x46, 0x41, 0x45, 0x50, 0x5C, 0x6D, 0x80, 0x8D, 0x9D, 0xA9, 0xAE,
-	0xB1, 0xAF, 0xA7, 0x9D, 0x92, 0x86, 0x7E, 0x75, 0x6F, 0x6B, 0x6B, 0x6D,
-	0x71, 0x76, 0x7A, 0x7E, 0x81, 0x82, 0x82, 0x81, 0x7F, 0x7E, 0x7F, 0x81,
-	0x82, 0x86, 0x8B, 0x90, 0x97, 0x9C, 0xA0, 0xA0, 0x9E, 0x97, 0x8E, 0x83,
-	0x77, 0x69, 0x5C, 0x51, 0x4D, 0x4D, 0x50, 0x59, 0x66, 0x77, 0x8A, 0x9E,
-	0xAE, 0xBD, 0xC7, 0xC7, 0xC4, 0xBB, 0xAA, 0x97, 0x80, 0x6A, 0x55, 0x45,
-	0x3A, 0x36, 0x3A, 0x43, 0x54, 0x6A, 0x82, 0x98, 0xAC, 0xBC, 0xC7, 0xCB,
-	0xC8, 0xBF, 0xAE, 0x9D, 0x88, 0x76, 0x64, 0x53, 0x4C, 0x47, 0x4A, 0x50,
-	0x5D, 0x6C, 0x7C, 0x89, 0x96, 0xA0, 0xA5, 0xAA, 0xA6, 0xA2, 0x9A, 0x93,
-	0x88, 0x80, 0x7D, 0x77, 0x74, 0x73, 0x76, 0x78, 0x7B, 0x7D, 0x7F, 0x7E,
-	0x7D, 0x7C, 0x79, 0x77, 0x76, 0x77, 0x79, 0x7D, 0x82, 0x89, 0x93, 0x9B,
-	0xA3, 0xA7, 0xA9, 0xA5, 0x9E, 0x97, 0x88, 0x7B, 0x6B, 0x5B, 0x50, 0x48,
-	0x46, 0x47, 0x51, 0x5E, 0x70, 0x85, 0x99, 0xAD, 0xBC, 0xC7, 0xCB, 0xC8,
-	0xBF, 0xAF, 0x9D, 0x86, 0x6F, 0x5A, 0x48, 0x3D, 0x39, 0x3A, 0x43, 0x51,
-	0x64, 0x7C, 0x91, 0xA7, 0xB6, 0xC1, 0xC6, 0xC4, 0xBD, 0xAF, 0x9F, 0x8D,
-	0x7B, 0x6B, 0x5C, 0x51, 0x4E, 0x50, 0x55, 0x5D, 0x6B, 0x7A, 0x85, 0x90,
-	0x9A, 0x9E, 0xA1, 0x9F, 0x9B, 0x95, 0x8F, 0x88, 0x82, 0x80, 0x7D, 0x7C,
-	0x7D, 0x7F, 0x7F, 0x81, 0x81, 0x80, 0x7F, 0x7B, 0x76, 0x71, 0x6F, 0x6D,
-	0x6D, 0x6F, 0x76, 0x80, 0x88, 0x93, 0xA0, 0xA8, 0xAE, 0xB2, 0xB1, 0xAA,
-	0x9F, 0x91, 0x80, 0x6D, 0x5E, 0x50, 0x45, 0x41, 0x42, 0x49, 0x58, 0x68,
-	0x80, 0x93, 0xA8, 0xBC, 0xC6, 0xCC, 0xCC, 0xC3, 0xB4, 0xA3, 0x8C, 0x75,
-	0x5F, 0x4D, 0x41, 0x3A, 0x38, 0x40, 0x4F, 0x5F, 0x75, 0x8A, 0x9E, 0xB0,
-	0xBB, 0xC1, 0xC1, 0xBB, 0xB0, 0xA2, 0x8E, 0x7F, 0x72, 0x64, 0x58, 0x55,
-	0x55, 0x59, 0x62, 0x6C, 0x78, 0x80, 0x8A, 0x91, 0x95, 0x98, 0x97, 0x95,
-	0x90, 0x8E, 0x87, 0x83, 0x83, 0x82, 0x83, 0x85, 0x87, 0x88, 0x87, 0x83,
-	0x81, 0x7D, 0x77, 0x70, 0x6A, 0x64, 0x62, 0x63, 0x66, 0x6F, 0x79, 0x85,
-	0x93, 0xA1, 0xAD, 0xB6, 0xBB, 0xB9, 0xB3, 0xA9, 0x99, 0x87, 0x73, 0x60,
-	0x50, 0x44, 0x3D, 0x3C, 0x42, 0x50, 0x60, 0x76, 0x8E, 0xA4, 0xB7, 0xC5,
-	0xCD, 0xCD, 0xC6, 0xB8, 0xA7, 0x93, 0x7B, 0x65, 0x52, 0x45, 0x3C, 0x3A,
-	0x40, 0x4C, 0x5B, 0x71, 0x84, 0x96, 0xA8, 0xB5, 0xB9, 0xBB, 0xB8, 0xB0,
-	0xA0, 0x91, 0x83, 0x76, 0x69, 0x63, 0x5E, 0x5D, 0x61, 0x66, 0x6E, 0x77,
-	0x80, 0x86, 0x8B, 0x8D, 0x8F, 0x8E, 0x8C, 0x89, 0x86, 0x85, 0x85, 0x85,
-	0x87, 0x8B, 0x8D, 0x90, 0x90, 0x8E, 0x8C, 0x86, 0x7E, 0x77, 0x6D, 0x64,
-	0x5E, 0x59, 0x59, 0x5E, 0x66, 0x72, 0x81, 0x92, 0xA0, 0xAE, 0xB9, 0xBF,
-	0xBF, 0xBB, 0xAF, 0xA0, 0x8D, 0x77, 0x64, 0x50, 0x42, 0x3B, 0x38, 0x3D,
-	0x49, 0x5A, 0x70, 0x87, 0x9E, 0xB2, 0xC1, 0xC9, 0xCC, 0xC8, 0xBC, 0xAB,
-	0x98, 0x81, 0x6B, 0x59, 0x4A, 0x41, 0x3F, 0x44, 0x4E, 0x5B, 0x6C, 0x7F,
-	0x8F, 0xA1, 0xAC, 0xB4, 0xB7, 0xB2, 0xAA, 0x9F, 0x92, 0x86, 0x7C, 0x71,
-	0x69, 0x67, 0x65, 0x67, 0x6C, 0x72, 0x78, 0x7F, 0x81, 0x85, 0x87, 0x86,
-	0x86, 0x83, 0x83, 0x81, 0x83, 0x86, 0x89, 0x8C, 0x90, 0x96, 0x9A, 0x9B,
-	0x98, 0x93, 0x8C, 0x81, 0x78, 0x6C, 0x61, 0x58, 0x52, 0x51, 0x55, 0x5D,
-	0x6B, 0x7B, 0x8C, 0x9E, 0xAF, 0xBB, 0xC3, 0xC6, 0xC1, 0xB6, 0xA7, 0x95,
-	0x7F, 0x69, 0x55, 0x46, 0x39, 0x38, 0x3B, 0x45, 0x55, 0x6A, 0x82, 0x98,
-	0xAD, 0xBD, 0xC7, 0xCB, 0xC8, 0xBF, 0xB0, 0x9C, 0x88, 0x73, 0x60, 0x52,
-	0x49, 0x44, 0x47, 0x4D, 0x5A, 0x6B, 0x7C, 0x89, 0x99, 0xA5, 0xAC, 0xAF,
-	0xAB, 0xA7, 0x9C, 0x93, 0x88, 0x80, 0x79, 0x71, 0x6F, 0x6E, 0x6F, 0x72,
-	0x76, 0x7A, 0x7E, 0x7F, 0x80, 0x81, 0x7E, 0x7E, 0x7C, 0x7C, 0x7E, 0x80,
-	0x84, 0x8A, 0x91, 0x99, 0x9F, 0xA2, 0xA2, 0xA3, 0x9D, 0x90, 0x86, 0x7A,
-	0x6C, 0x5D, 0x53, 0x4B, 0x48, 0x4B, 0x53, 0x61, 0x70, 0x85, 0x99, 0xAD,
-	0xBC, 0xC4, 0xC8, 0xC7, 0xBE, 0xAF, 0x9B, 0x84, 0x6E, 0x59, 0x48, 0x3C,
-	0x36, 0x39, 0x42, 0x50, 0x64, 0x7B, 0x92, 0xA8, 0xB8, 0xC3, 0xC8, 0xC7,
-	0xBF, 0xB1, 0x9F, 0x8B, 0x77, 0x68, 0x59, 0x4D, 0x49, 0x4B, 0x52, 0x5B,
-	0x6A, 0x79, 0x85, 0x93, 0x9B, 0xA3, 0xA6, 0xA6, 0xA1, 0x9A, 0x93, 0x8A,
-	0x83, 0x7D, 0x79, 0x77, 0x78, 0x79, 0x7B, 0x7D, 0x7F, 0x80, 0x7F, 0x7E,
-	0x7B, 0x78, 0x75, 0x71, 0x72, 0x75, 0x79, 0x81, 0x88, 0x92, 0x9C, 0xA4,
-	0xAA, 0xAD, 0xAB, 0xA4, 0x9C, 0x8C, 0x7F, 0x6F, 0x5D, 0x50, 0x47, 0x43,
-	0x45, 0x4C, 0x59, 0x6B, 0x80, 0x96, 0xA9, 0xBA, 0xC5, 0xCC, 0xCB, 0xC2,
-	0xB5, 0xA2, 0x8B, 0x74, 0x60, 0x4C, 0x3F, 0x38, 0x39, 0x41, 0x4D, 0x5F,
-	0x76, 0x8B, 0xA1, 0xB1, 0xBD, 0xC4, 0xC5, 0xBD, 0xB1, 0xA1, 0x90, 0x7F,
-	0x6E, 0x60, 0x57, 0x50, 0x51, 0x56, 0x5E, 0x6A, 0x75, 0x82, 0x8C, 0x94,
-	0x9B, 0x9D, 0x9C, 0x99, 0x94, 0x8E, 0x89, 0x84, 0x81, 0x7F, 0x80, 0x80,
-	0x80, 0x82, 0x84, 0x83, 0x80, 0x7E, 0x7B, 0x75, 0x6F, 0x69, 0x68, 0x67,
-	0x6C, 0x72, 0x7C, 0x87, 0x92, 0x9F, 0xAA, 0xB1, 0xB5, 0xB4, 0xAC, 0xA3,
-	0x95, 0x85, 0x72, 0x5F, 0x50, 0x44, 0x3F, 0x3E, 0x45, 0x52, 0x62, 0x79,
-	0x8F, 0xA5, 0xB7, 0xC4, 0xCB, 0xCD, 0xC6, 0xB7, 0xA7, 0x92, 0x7B, 0x65,
-	0x52, 0x42, 0x3B, 0x39, 0x3F, 0x4A, 0x5B, 0x70, 0x85, 0x9A, 0xAA, 0xB7,
-	0xBF, 0xBF, 0xB8, 0xAF, 0xA2, 0x94, 0x83, 0x76, 0x68, 0x60, 0x59, 0x58,
-	0x5C, 0x63, 0x6C, 0x76, 0x7F, 0x87, 0x8E, 0x93, 0x94, 0x93, 0x92, 0x8E,
-	0x8A, 0x87, 0x86, 0x84, 0x86, 0x86, 0x88, 0x8A, 0x8B, 0x8A, 0x89, 0x82,
-	0x7E, 0x79, 0x6F, 0x69, 0x63, 0x5E, 0x5E, 0x63, 0x6C, 0x75, 0x82, 0x92,
-	0x9F, 0xAC, 0xB6, 0xBB, 0xBC, 0xB7, 0xAB, 0x9D, 0x8B, 0x76, 0x63, 0x51,
-	0x42, 0x3D, 0x3C, 0x41, 0x4B, 0x5D, 0x72, 0x88, 0xA0, 0xB4, 0xC2, 0xCB,
-	0xCC, 0xC8, 0xBC, 0xAC, 0x96, 0x80, 0x6B, 0x57, 0x49, 0x3F, 0x3D, 0x40,
-	0x4B, 0x59, 0x6C, 0x80, 0x93, 0xA3, 0xAF, 0xB7, 0xB8, 0xB6, 0xAE, 0xA2,
-	0x94, 0x88, 0x7A, 0x70, 0x67, 0x62, 0x61, 0x61, 0x69, 0x71, 0x77, 0x7E,
-	0x83, 0x86, 0x8B, 0x8B, 0x8A, 0x88, 0x86, 0x86, 0x84, 0x85, 0x86, 0x8A,
-	0x8C, 0x90, 0x96, 0x94, 0x93, 0x90, 0x89, 0x81, 0x78, 0x6E, 0x64, 0x5C,
-	0x58, 0x57, 0x5A, 0x60, 0x6B, 0x7C, 0x8D, 0x9E, 0xAD, 0xBA, 0xC2, 0xC2,
-	0xBF, 0xB4, 0xA6, 0x93, 0x7D, 0x68, 0x56, 0x46, 0x3D, 0x3A, 0x3D, 0x47,
-	0x56, 0x6C, 0x83, 0x9A, 0xAF, 0xBD, 0xC8, 0xCC, 0xC9, 0xBE, 0xAE, 0x9B,
-	0x86, 0x71, 0x5E, 0x4E, 0x44, 0x42, 0x43, 0x4C, 0x5A, 0x69, 0x7C, 0x8D,
-	0x9C, 0xA8, 0xB0, 0xB2, 0xB1, 0xAA, 0xA1, 0x96, 0x89, 0x80, 0x76, 0x6E,
-	0x69, 0x69, 0x69, 0x6F, 0x73, 0x78, 0x7D, 0x80, 0x82, 0x83, 0x83, 0x81,
-	0x80, 0x7F, 0x80, 0x82, 0x84, 0x88, 0x8D, 0x94, 0x99, 0x9D, 0x9F, 0x9D,
-	0x96, 0x8F, 0x84, 0x7A, 0x6E, 0x61, 0x57, 0x4F, 0x4E, 0x4F, 0x57, 0x65,
-	0x75, 0x87, 0x9B, 0xAC, 0xBA, 0xC4, 0xC9, 0xC4, 0xBB, 0xAC, 0x99, 0x83,
-	0x6E, 0x5A, 0x48, 0x3D, 0x37, 0x3B, 0x43, 0x52, 0x66, 0x7E, 0x94, 0xA8,
-	0xB9, 0xC5, 0xCA, 0xCA, 0xC0, 0xB1, 0xA0, 0x8B, 0x78, 0x64, 0x55, 0x4C,
-	0x46, 0x46, 0x4F, 0x59, 0x68, 0x79, 0x87, 0x95, 0x9F, 0xA7, 0xAB, 0xA9,
-	0xA5, 0x9D, 0x94, 0x8B, 0x81, 0x7B, 0x77, 0x72, 0x73, 0x73, 0x76, 0x7A,
-	0x7D, 0x7E, 0x80, 0x80, 0x7E, 0x7B, 0x79, 0x77, 0x78, 0x79, 0x7D, 0x81,
-	0x89, 0x91, 0x98, 0x9F, 0xA5, 0xA7, 0xA5, 0xA0, 0x97, 0x8A, 0x7C, 0x6E,
-	0x5F, 0x54, 0x4C, 0x47, 0x48, 0x51, 0x5C, 0x6D, 0x81, 0x95, 0xA9, 0xBA,
-	0xC4, 0xCA, 0xC8, 0xC1, 0xB2, 0xA1, 0x8A, 0x74, 0x5E, 0x4B, 0x40, 0x39,
-	0x39, 0x40, 0x4D, 0x61, 0x77, 0x8C, 0xA1, 0xB3, 0xC0, 0xC5, 0xC5, 0xC0,
-	0xB4, 0xA3, 0x90, 0x7E, 0x6B, 0x5C, 0x53, 0x4D, 0x4D, 0x53, 0x5A, 0x67,
-	0x76, 0x82, 0x8E, 0x99, 0x9F, 0xA1, 0xA2, 0x9E, 0x98, 0x91, 0x8A, 0x84,
-	0x80, 0x7C, 0x7B, 0x7D, 0x7C, 0x7D, 0x7E, 0x80, 0x7F, 0x7D, 0x7B, 0x78,
-	0x74, 0x70, 0x6E, 0x6D, 0x71, 0x76, 0x7D, 0x86, 0x91, 0x9B, 0xA4, 0xAC,
-	0xB0, 0xAE, 0xA9, 0x9E, 0x92, 0x82, 0x72, 0x61, 0x52, 0x47, 0x41, 0x40,
-	0x48, 0x54, 0x66, 0x7B, 0x90, 0xA6, 0xB7, 0xC4, 0xCD, 0xCD, 0xC7, 0xB7,
-	0xA7, 0x91, 0x79, 0x64, 0x51, 0x43, 0x3B, 0x3A, 0x3D, 0x4A, 0x5E, 0x71,
-	0x88, 0x9B, 0xAE, 0xBA, 0xC1, 0xC2, 0xBD, 0xB3, 0xA4, 0x93, 0x82, 0x73,
-	0x65, 0x5B, 0x55, 0x55, 0x58, 0x5F, 0x69, 0x76, 0x80, 0x89, 0x91, 0x97,
-	0x98, 0x99, 0x96, 0x92, 0x8D, 0x89, 0x85, 0x83, 0x81, 0x83, 0x83, 0x84,
-	0x85, 0x85, 0x85, 0x7F, 0x7D, 0x79, 0x73, 0x6D, 0x67, 0x65, 0x64, 0x67,
-	0x6E, 0x78, 0x83, 0x90, 0x9F, 0xAA, 0xB2, 0xB8, 0xB8, 0xB4, 0xA9, 0x9A,
-	0x89, 0x75, 0x64, 0x51, 0x47, 0x3E, 0x3D, 0x42, 0x4C, 0x5E, 0x74, 0x8A,
-	0xA0, 0xB2, 0xC3, 0xCB, 0xCC, 0xC8, 0xBC, 0xAC, 0x97, 0x80, 0x68, 0x55,
-	0x46, 0x3D, 0x39, 0x3E, 0x4A, 0x59, 0x6D, 0x80, 0x94, 0xA6, 0xB2, 0xBC,
-	0xBB, 0xB9, 0xB0, 0xA4, 0x95, 0x85, 0x78, 0x6C, 0x62, 0x5C, 0x5B, 0x5E,
-	0x65, 0x6C, 0x75, 0x7F, 0x86, 0x8A, 0x8F, 0x90, 0x90, 0x8F, 0x8A, 0x88,
-	0x85, 0x85, 0x84, 0x85, 0x89, 0x89, 0x8D, 0x8F, 0x8E, 0x8C, 0x85, 0x7F,
-	0x78, 0x70, 0x67, 0x60, 0x5C, 0x5B, 0x60, 0x67, 0x70, 0x80, 0x8D, 0x9D,
-	0xAB, 0xB6, 0xBE, 0xBE, 0xBB, 0xB1, 0xA1, 0x91, 0x7D, 0x67, 0x54, 0x46,
-	0x3B, 0x3A, 0x3D, 0x47, 0x56, 0x6D, 0x83, 0x9A, 0xAE, 0xBF, 0xC9, 0xCE,
-	0xC9, 0xC1, 0xB1, 0x9C, 0x85, 0x70, 0x5C, 0x4C, 0x43, 0x3E, 0x40, 0x4B,
-	0x58, 0x6A, 0x7C, 0x8F, 0x9D, 0xAA, 0xB3, 0xB7, 0xB4, 0xAD, 0xA2, 0x96,
-	0x8A, 0x7D, 0x73, 0x6A, 0x65, 0x63, 0x66, 0x69, 0x70, 0x78, 0x7D, 0x81,
-	0x86, 0x89, 0x87, 0x89, 0x87, 0x84, 0x84, 0x83, 0x84, 0x87, 0x8A, 0x8E,
-	0x93, 0x98, 0x9B, 0x97, 0x93, 0x8C, 0x82, 0x7B, 0x6F, 0x64, 0x5B, 0x54,
-	0x52, 0x55, 0x5D, 0x68, 0x78, 0x88, 0x99, 0xAC, 0xB9, 0xC2, 0xC4, 0xC2,
-	0xBA, 0xAB, 0x98, 0x80, 0x6C, 0x58, 0x48, 0x3C, 0x37, 0x3B, 0x43, 0x52,
-	0x66, 0x7E, 0x94, 0xAA, 0xBA, 0xC7, 0xCC, 0xC9, 0xC2, 0xB3, 0xA2, 0x8A,
-	0x74, 0x62, 0x53, 0x47, 0x43, 0x44, 0x4B, 0x58, 0x67, 0x77, 0x87, 0x99,
-	0xA4, 0xAB, 0xB0, 0xAF, 0xAA, 0xA0, 0x97, 0x8D, 0x80, 0x78, 0x72, 0x6E,
-	0x6D, 0x6E, 0x72, 0x76, 0x79, 0x7E, 0x80, 0x82, 0x80, 0x81, 0x80, 0x7E,
-	0x7D, 0x7E, 0x80, 0x84, 0x88, 0x8E, 0x94, 0x9B, 0xA0, 0xA1, 0xA0, 0x9A,
-	0x92, 0x87, 0x7B, 0x6E, 0x5F, 0x54, 0x4D, 0x48, 0x4A, 0x52, 0x5F, 0x6F,
-	0x81, 0x95, 0xA8, 0xB9, 0xC4, 0xC8, 0xC6, 0xBF, 0xB1, 0x9F, 0x88, 0x72,
-	0x5E, 0x4A, 0x3F, 0x37, 0x38, 0x41, 0x4E, 0x5F, 0x77, 0x8D, 0xA4, 0xB6,
-	0xC3, 0xC9, 0xC8, 0xC1, 0xB5, 0xA3, 0x8F, 0x7C, 0x68, 0x59, 0x4D, 0x49,
-	0x48, 0x50, 0x59, 0x65, 0x74, 0x82, 0x90, 0x9C, 0xA3, 0xA7, 0xA8, 0xA3,
-	0x9C, 0x95, 0x8A, 0x84, 0x7D, 0x78, 0x76, 0x76, 0x77, 0x79, 0x7C, 0x7E,
-	0x7F, 0x7F, 0x7E, 0x7E, 0x7A, 0x77, 0x75, 0x75, 0x77, 0x78, 0x80, 0x88,
-	0x90, 0x99, 0xA2, 0xA8, 0xAA, 0xA9, 0xA4, 0x9B, 0x8F, 0x82, 0x70, 0x61,
-	0x53, 0x4B, 0x45, 0x45, 0x4B, 0x57, 0x67, 0x7C, 0x92, 0xA5, 0xB7, 0xC4,
-	0xCA, 0xCA, 0xC3, 0xB7, 0xA4, 0x8F, 0x78, 0x61, 0x4F, 0x40, 0x39, 0x39,
-	0x40, 0x4A, 0x5D, 0x71, 0x89, 0x9D, 0xAF, 0xBC, 0xC4, 0xC6, 0xBE, 0xB4,
-	0xA5, 0x94, 0x80, 0x71, 0x60, 0x57, 0x50, 0x4F, 0x54, 0x5B, 0x66, 0x73,
-	0x80, 0x8A, 0x94, 0x9A, 0x9F, 0x9D, 0x9B, 0x97, 0x90, 0x8B, 0x85, 0x80,
-	0x80, 0x7D, 0x7E, 0x81, 0x80, 0x81, 0x83, 0x80, 0x7E, 0x7D, 0x77, 0x71,
-	0x6E, 0x6A, 0x6B, 0x6C, 0x72, 0x7A, 0x84, 0x90, 0x9B, 0xA6, 0xAF, 0xB3,
-	0xB3, 0xAE, 0xA5, 0x97, 0x87, 0x75, 0x62, 0x53, 0x46, 0x41, 0x3E, 0x43,
-	0x50, 0x60, 0x75, 0x8A, 0xA1, 0xB5, 0xC2, 0xCB, 0xCB, 0xC7, 0xBC, 0xAA,
-	0x95, 0x80, 0x68, 0x54, 0x45, 0x3C, 0x38, 0x3E, 0x49, 0x58, 0x6C, 0x81,
-	0x96, 0xA9, 0xB6, 0xBF, 0xC0, 0xBD, 0xB2, 0xA7, 0x97, 0x85, 0x78, 0x69,
-	0x5E, 0x56, 0x57, 0x59, 0x60, 0x69, 0x74, 0x7E, 0x87, 0x8F, 0x92, 0x96,
-	0x96, 0x93, 0x91, 0x8D, 0x89, 0x85, 0x84, 0x84, 0x86, 0x85, 0x88, 0x88,
-	0x8A, 0x86, 0x84, 0x80, 0x7A, 0x73, 0x6C, 0x65, 0x62, 0x61, 0x65, 0x6C,
-	0x74, 0x80, 0x8E, 0x9C, 0xA9, 0xB5, 0xBB, 0xBC, 0xB8, 0xAE, 0x9F, 0x8D,
-	0x7B, 0x68, 0x54, 0x46, 0x3E, 0x3B, 0x3F, 0x48, 0x59, 0x6E, 0x84, 0x9A,
-	0xAF, 0xBF, 0xC9, 0xCD, 0xC9, 0xC0, 0xAF, 0x9A, 0x84, 0x6C, 0x5A, 0x4B,
-	0x3F, 0x3C, 0x3F, 0x47, 0x55, 0x68, 0x7C, 0x8F, 0xA1, 0xAE, 0xB7, 0xBA,
-	0xB9, 0xB1, 0xA5, 0x97, 0x89, 0x7B, 0x6F, 0x68, 0x5F, 0x5F, 0x61, 0x65,
-	0x6C, 0x74, 0x7C, 0x83, 0x88, 0x8A, 0x8D, 0x8D, 0x8A, 0x87, 0x86, 0x85,
-	0x84, 0x85, 0x89, 0x8A, 0x8E, 0x92, 0x93, 0x91, 0x8E, 0x88, 0x81, 0x7B,
-	0x70, 0x67, 0x60, 0x59, 0x58, 0x5A, 0x61, 0x6C, 0x7B, 0x89, 0x9A, 0xAA,
-	0xB6, 0xBE, 0xC1, 0xBF, 0xB6, 0xA7, 0x96, 0x80, 0x6B, 0x59, 0x49, 0x3D,
-	0x39, 0x3A, 0x44, 0x54, 0x67, 0x7E, 0x96, 0xAC, 0xBD, 0xC5, 0xCC, 0xCA,
-	0xC2, 0xB3, 0xA0, 0x8A, 0x76, 0x61, 0x50, 0x45, 0x40, 0x41, 0x48, 0x54,
-	0x66, 0x78, 0x89, 0x9A, 0xA5, 0xAF, 0xB5, 0xB2, 0xAC, 0xA4, 0x98, 0x8B,
-	0x80, 0x76, 0x6F, 0x6B, 0x66, 0x68, 0x6B, 0x71, 0x79, 0x7D, 0x80, 0x85,
-	0x86, 0x85, 0x84, 0x82, 0x81, 0x82, 0x82, 0x85, 0x87, 0x8C, 0x92, 0x97,
-	0x9B, 0x9E, 0x9B, 0x99, 0x91, 0x86, 0x7C, 0x70, 0x65, 0x5B, 0x52, 0x4F,
-	0x51, 0x5A, 0x63, 0x72, 0x84, 0x97, 0xA9, 0xB7, 0xC1, 0xC6, 0xC4, 0xBD,
-	0xAF, 0x9C, 0x87, 0x72, 0x5D, 0x4A, 0x3E, 0x38, 0x39, 0x41, 0x4E, 0x61,
-	0x79, 0x8F, 0xA6, 0xB6, 0xC4, 0xCA, 0xCA, 0xC3, 0xB6, 0xA4, 0x90, 0x7C,
-	0x67, 0x56, 0x4C, 0x46, 0x44, 0x4C, 0x56, 0x64, 0x76, 0x84, 0x91, 0x9F,
-	0xA8, 0xAC, 0xAC, 0xA6, 0xA0, 0x95, 0x8C, 0x83, 0x7C, 0x75, 0x73, 0x70,
-	0x71, 0x74, 0x77, 0x7B, 0x7D, 0x7F, 0x7F, 0x81, 0x7E, 0x7C, 0x7A, 0x7B,
-	0x7B, 0x7D, 0x81, 0x89, 0x8F, 0x96, 0x9D, 0xA3, 0xA4, 0xA2, 0x9E, 0x97,
-	0x8B, 0x7F, 0x71, 0x62, 0x55, 0x4D, 0x48, 0x48, 0x4E, 0x58, 0x6A, 0x7D,
-	0x90, 0xA6, 0xB6, 0xC2, 0xC9, 0xC8, 0xC2, 0xB6, 0xA4, 0x8D, 0x78, 0x62,
-	0x4D, 0x41, 0x39, 0x37, 0x3E, 0x4A, 0x5D, 0x72, 0x88, 0xA0, 0xB1, 0xBF,
-	0xC7, 0xC7, 0xC1, 0xB6, 0xA7, 0x94, 0x80, 0x6E, 0x5F, 0x54, 0x4C, 0x4B,
-	0x4E, 0x58, 0x63, 0x73, 0x80, 0x8F, 0x97, 0xA0, 0xA3, 0xA4, 0xA1, 0x9B,
-	0x93, 0x8B, 0x85, 0x80, 0x7C, 0x78, 0x79, 0x7A, 0x7D, 0x7E, 0x80, 0x80,
-	0x7F, 0x7C, 0x7A, 0x77, 0x74, 0x72, 0x70, 0x71, 0x76, 0x7C, 0x85, 0x8F,
-	0x99, 0xA2, 0xA8, 0xAC, 0xAD, 0xAA, 0x9F, 0x95, 0x85, 0x75, 0x64, 0x55,
-	0x48, 0x42, 0x42, 0x47, 0x52, 0x61, 0x77, 0x8D, 0xA0, 0xB4, 0xC2, 0xC9,
-	0xCD, 0xC8, 0xBB, 0xAB, 0x94, 0x7E, 0x66, 0x52, 0x43, 0x3A, 0x38, 0x3D,
-	0x47, 0x59, 0x6E, 0x82, 0x99, 0xAA, 0xB8, 0xC1, 0xC2, 0xBF, 0xB6, 0xA8,
-	0x96, 0x85, 0x74, 0x66, 0x5A, 0x53, 0x52, 0x55, 0x5B, 0x66, 0x72, 0x7F,
-	0x87, 0x90, 0x97, 0x9C, 0x9B, 0x99, 0x95, 0x90, 0x8B, 0x85, 0x82, 0x81,
-	0x80, 0x81, 0x82, 0x84, 0x84, 0x83, 0x83, 0x80, 0x7A, 0x75, 0x6F, 0x6B,
-	0x66, 0x67, 0x68, 0x6D, 0x78, 0x82, 0x8E, 0x9A, 0xA6, 0xB0, 0xB7, 0xB8,
-	0xB3, 0xAA, 0x9C, 0x8B, 0x79, 0x67, 0x55, 0x48, 0x40, 0x3D, 0x41, 0x4B,
-	0x5B, 0x6F, 0x85, 0x9C, 0xB0, 0xC0, 0xCA, 0xCD, 0xC9, 0xBE, 0xAF, 0x9A,
-	0x83, 0x6E, 0x58, 0x48, 0x3E, 0x3B, 0x3D, 0x46, 0x55, 0x6A, 0x7E, 0x90,
-	0xA4, 0xB0, 0xBA, 0xBE, 0xBC, 0xB5, 0xA6, 0x99, 0x89, 0x7A, 0x6D, 0x62,
-	0x5B, 0x5A, 0x5A, 0x60, 0x69, 0x72, 0x7C, 0x83, 0x8A, 0x8E, 0x91, 0x92,
-	0x8F, 0x8E, 0x8B, 0x87, 0x86, 0x84, 0x84, 0x87, 0x89, 0x8B, 0x8C, 0x8C,
-	0x8A, 0x85, 0x81, 0x7A, 0x72, 0x6B, 0x64, 0x5E, 0x5D, 0x5E, 0x66, 0x70,
-	0x7C, 0x88, 0x9A, 0xA9, 0xB4, 0xBC, 0xBE, 0xBB, 0xB3, 0xA5, 0x94, 0x7F,
-	0x6A, 0x58, 0x49, 0x40, 0x3B, 0x3C, 0x45, 0x54, 0x69, 0x81, 0x96, 0xAC,
-	0xBD, 0xC8, 0xCC, 0xCA, 0xC2, 0xB4, 0xA0, 0x89, 0x74, 0x60, 0x50, 0x42,
-	0x3D, 0x40, 0x48, 0x54, 0x66, 0x7B, 0x8B, 0x9D, 0xAC, 0xB5, 0xB9, 0xB6,
-	0xB1, 0xA7, 0x9A, 0x8B, 0x80, 0x73, 0x6A, 0x64, 0x62, 0x64, 0x65, 0x6D,
-	0x73, 0x7B, 0x81, 0x86, 0x88, 0x8A, 0x8A, 0x87, 0x86, 0x84, 0x83, 0x85,
-	0x86, 0x89, 0x8E, 0x91, 0x93, 0x94, 0x95, 0x92, 0x8D, 0x86, 0x7C, 0x72,
-	0x67, 0x5D, 0x56, 0x55, 0x56, 0x5B, 0x67, 0x75, 0x86, 0x96, 0xA7, 0xB5,
-	0xC0, 0xC4, 0xC1, 0xB9, 0xAD, 0x9C, 0x86, 0x71, 0x5C, 0x4B, 0x3F, 0x38,
-	0x3A, 0x41, 0x4F, 0x61, 0x78, 0x91, 0xA5, 0xBA, 0xC6, 0xCC, 0xCA, 0xC3,
-	0xB5, 0xA4, 0x90, 0x7A, 0x66, 0x55, 0x49, 0x42, 0x42, 0x48, 0x54, 0x64,
-	0x75, 0x87, 0x96, 0xA2, 0xAB, 0xB1, 0xB0, 0xAB, 0xA3, 0x98, 0x8D, 0x82,
-	0x79, 0x73, 0x6E, 0x6A, 0x6C, 0x6D, 0x72, 0x78, 0x7C, 0x80, 0x81, 0x82,
-	0x82, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x82, 0x88, 0x8E, 0x92, 0x99, 0x9D,
-	0xA0, 0xA0, 0x9C, 0x94, 0x89, 0x7E, 0x71, 0x65, 0x58, 0x51, 0x4C, 0x4C,
-	0x52, 0x5D, 0x6C, 0x7F, 0x93, 0xA4, 0xB5, 0xC0, 0xC6, 0xC7, 0xC0, 0xB2,
-	0xA2, 0x8B, 0x75, 0x60, 0x4D, 0x40, 0x38, 0x38, 0x3E, 0x4A, 0x5D, 0x73,
-	0x89, 0xA1, 0xB4, 0xC1, 0xCA, 0xCA, 0xC3, 0xB9, 0xA7, 0x94, 0x80, 0x6D,
-	0x5C, 0x50, 0x48, 0x48, 0x4C, 0x56, 0x63, 0x73, 0x80, 0x8E, 0x9A, 0xA4,
-	0xA8, 0xAA, 0xA6, 0x9E, 0x95, 0x8D, 0x85, 0x7E, 0x7A, 0x76, 0x73, 0x74,
-	0x76, 0x79, 0x7C, 0x7E, 0x80, 0x7F, 0x7E, 0x7C, 0x78, 0x77, 0x76, 0x77,
-	0x7B, 0x80, 0x85, 0x8D, 0x96, 0x9E, 0xA4, 0xA9, 0xA9, 0xA4, 0x9E, 0x90,
-	0x82, 0x76, 0x64, 0x56, 0x4B, 0x45, 0x45, 0x4A, 0x54, 0x63, 0x78, 0x8B,
-	0xA2, 0xB3, 0xC1, 0xC9, 0xC9, 0xC5, 0xB9, 0xA8, 0x93, 0x7B, 0x65, 0x51,
-	0x42, 0x3A, 0x38, 0x3C, 0x48, 0x57, 0x6E, 0x82, 0x99, 0xAD, 0xBB, 0xC6,
-	0xC6, 0xC2, 0xB9, 0xA8, 0x96, 0x84, 0x74, 0x63, 0x56, 0x50, 0x4E, 0x51,
-	0x5A, 0x64, 0x70, 0x7D, 0x89, 0x94, 0x9C, 0xA0, 0x9F, 0x9E, 0x9A, 0x94,
-	0x8C, 0x86, 0x80, 0x7F, 0x7D, 0x7C, 0x7E, 0x7F, 0x80, 0x80, 0x80, 0x7F,
-	0x7C, 0x79, 0x74, 0x6F, 0x6C, 0x6C, 0x6D, 0x73, 0x7A, 0x81, 0x8E, 0x99,
-	0xA2, 0xAB, 0xB0, 0xB1, 0xAD, 0xA5, 0x99, 0x8A, 0x79, 0x68, 0x56, 0x4A,
-	0x42, 0x3E, 0x44, 0x4F, 0x5D, 0x70, 0x86, 0x9C, 0xB1, 0xBF, 0xC8, 0xCD,
-	0xC8, 0xBD, 0xAE, 0x9A, 0x81, 0x6C, 0x57, 0x46, 0x3D, 0x38, 0x3C, 0x45,
-	0x55, 0x69, 0x7F, 0x94, 0xA6, 0xB5, 0xBD, 0xC2, 0xBE, 0xB6, 0xA9, 0x98,
-	0x89, 0x79, 0x6A, 0x5E, 0x58, 0x54, 0x57, 0x5E, 0x65, 0x70, 0x7C, 0x84,
-	0x8C, 0x93, 0x96, 0x98, 0x95, 0x92, 0x8E, 0x8B, 0x86, 0x84, 0x82, 0x83,
-	0x84, 0x85, 0x87, 0x87, 0x86, 0x84, 0x80, 0x7B, 0x74, 0x6E, 0x68, 0x64,
-	0x62, 0x63, 0x6A, 0x72, 0x7D, 0x8B, 0x99, 0xA6, 0xB2, 0xB9, 0xBB, 0xB7,
-	0xB0, 0xA3, 0x92, 0x80, 0x6B, 0x58, 0x49, 0x40, 0x3C, 0x3D, 0x46, 0x55,
-	0x6A, 0x80, 0x98, 0xAD, 0xBD, 0xC9, 0xCD, 0xCB, 0xC0, 0xB2, 0x9E, 0x86,
-	0x73, 0x5D, 0x4B, 0x40, 0x3B, 0x3D, 0x45, 0x53, 0x65, 0x79, 0x8E, 0x9F,
-	0xAF, 0xB7, 0xBC, 0xBA, 0xB4, 0xAA, 0x9B, 0x8C, 0x7E, 0x71, 0x66, 0x5F,
-	0x5D, 0x5E, 0x65, 0x6A, 0x73, 0x7A, 0x81, 0x88, 0x8C, 0x8E, 0x8F, 0x8D,
-	0x8B, 0x88, 0x87, 0x84, 0x85, 0x87, 0x88, 0x8B, 0x8D, 0x90, 0x90, 0x8D,
-	0x8A, 0x82, 0x7B, 0x72, 0x69, 0x62, 0x5B, 0x59, 0x5A, 0x60, 0x6B, 0x78,
-	0x87, 0x98, 0xA7, 0xB4, 0xBD, 0xC1, 0xBF, 0xB8, 0xAA, 0x97, 0x83, 0x71,
-	0x5B, 0x4A, 0x3F, 0x39, 0x3A, 0x41, 0x50, 0x64, 0x79, 0x90, 0xA6, 0xBA,
-	0xC6, 0xCC, 0xCB, 0xC3, 0xB5, 0xA3, 0x8F, 0x79, 0x63, 0x52, 0x47, 0x3F,
-	0x40, 0x47, 0x53, 0x62, 0x75, 0x87, 0x97, 0xA6, 0xB0, 0xB4, 0xB5, 0xAF,
-	0xA6, 0x9B, 0x8E, 0x81, 0x78, 0x6E, 0x68, 0x66, 0x66, 0x6A, 0x6F, 0x75,
-	0x7B, 0x80, 0x83, 0x86, 0x87, 0x86, 0x84, 0x83, 0x81, 0x82, 0x84, 0x86,
-	0x8B, 0x8E, 0x94, 0x97, 0x99, 0x9A, 0x97, 0x91, 0x88, 0x7F, 0x73, 0x67,
-	0x5D, 0x55, 0x51, 0x52, 0x57, 0x61, 0x71, 0x81, 0x93, 0xA6, 0xB4, 0xBF,
-	0xC5, 0xC4, 0xBF, 0xB1, 0xA0, 0x8C, 0x76, 0x5F, 0x4D, 0x40, 0x38, 0x39,
-	0x3E, 0x4A, 0x5E, 0x75, 0x8B, 0xA2, 0xB4, 0xC2, 0xCC, 0xCA, 0xC4, 0xB9,
-	0xA6, 0x94, 0x7F, 0x6A, 0x5A, 0x4C, 0x44, 0x44, 0x49, 0x53, 0x60, 0x70,
-	0x81, 0x92, 0x9E, 0xA8, 0xAC, 0xAE, 0xAA, 0xA3, 0x99, 0x8E, 0x84, 0x7C,
-	0x76, 0x70, 0x6E, 0x6F, 0x72, 0x75, 0x7A, 0x7C, 0x7F, 0x80, 0x80, 0x7E,
-	0x7D, 0x7E, 0x7C, 0x7C, 0x7E, 0x81, 0x87, 0x8D, 0x93, 0x9A, 0xA0, 0xA3,
-	0xA4, 0xA1, 0x99, 0x8D, 0x81, 0x76, 0x65, 0x58, 0x4F, 0x49, 0x49, 0x4D,
-	0x58, 0x68, 0x7A, 0x8E, 0xA3, 0xB3, 0xC0, 0xC7, 0xC8, 0xC3, 0xB7, 0xA6,
-	0x91, 0x7B, 0x66, 0x51, 0x40, 0x39, 0x37, 0x3B, 0x46, 0x58, 0x6E, 0x85,
-	0x9A, 0xAE, 0xBD, 0xC5, 0xC8, 0xC5, 0xB9, 0xAA, 0x98, 0x85, 0x71, 0x60,
-	0x54, 0x4C, 0x4A, 0x4D, 0x55, 0x62, 0x6F, 0x7E, 0x8B, 0x96, 0x9F, 0xA5,
-	0xA5, 0xA4, 0x9C, 0x95, 0x8D, 0x86, 0x80, 0x7B, 0x79, 0x77, 0x78, 0x7B,
-	0x7C, 0x7D, 0x7F, 0x80, 0x80, 0x7C, 0x79, 0x76, 0x73, 0x72, 0x74, 0x77,
-	0x7A, 0x83, 0x8D, 0x96, 0x9F, 0xA9, 0xAC, 0xAD, 0xA8, 0xA2, 0x95, 0x86,
-	0x77, 0x67, 0x59, 0x4C, 0x45, 0x42, 0x47, 0x51, 0x60, 0x73, 0x88, 0x9E,
-	0xB1, 0xBF, 0xC9, 0xCC, 0xC7, 0xBE, 0xAC, 0x9A, 0x80, 0x6B, 0x57, 0x46,
-	0x3C, 0x37, 0x3B, 0x46, 0x54, 0x67, 0x7F, 0x95, 0xA7, 0xB6, 0xC1, 0xC5,
-	0xC2, 0xB9, 0xAB, 0x9B, 0x87, 0x78, 0x68, 0x5B, 0x54, 0x4F, 0x51, 0x5A,
-	0x63, 0x6D, 0x7C, 0x86, 0x91, 0x98, 0x9B, 0x9E, 0x9A, 0x97, 0x91, 0x8C,
-	0x87, 0x82, 0x7F, 0x7F, 0x80, 0x81, 0x81, 0x83, 0x83, 0x80, 0x7E, 0x7C,
-	0x78, 0x72, 0x6D, 0x69, 0x68, 0x6A, 0x6E, 0x74, 0x81, 0x8B, 0x98, 0xA3,
-	0xAD, 0xB4, 0xB4, 0xB3, 0xAA, 0x9F, 0x8D, 0x7D, 0x6A, 0x59, 0x4B, 0x42,
-	0x3E, 0x40, 0x4A, 0x58, 0x6C, 0x82, 0x98, 0xAD, 0xBD, 0xC8, 0xCC, 0xCA,
-	0xC2, 0xB3, 0x9F, 0x87, 0x71, 0x5C, 0x4B, 0x3F, 0x3A, 0x3C, 0x45, 0x53,
-	0x65, 0x7A, 0x8E, 0xA2, 0xB2, 0xBB, 0xBF, 0xBE, 0xB7, 0xAB, 0x9C, 0x8D,
-	0x7D, 0x6F, 0x62, 0x5B, 0x59, 0x59, 0x5E, 0x67, 0x70, 0x7A, 0x82, 0x8A,
-	0x90, 0x94, 0x94, 0x93, 0x8F, 0x8B, 0x89, 0x85, 0x84, 0x85, 0x85, 0x85,
-	0x89, 0x89, 0x8B, 0x89, 0x86, 0x80, 0x7C, 0x74, 0x6C, 0x66, 0x61, 0x5F,
-	0x60, 0x65, 0x6F, 0x79, 0x87, 0x98, 0xA6, 0xB1, 0xBA, 0xBD, 0xBB, 0xB3,
-	0xA7, 0x95, 0x83, 0x6F, 0x5B, 0x4A, 0x40, 0x3A, 0x3C, 0x44, 0x52, 0x65,
-	0x7C, 0x91, 0xA8, 0xBA, 0xC7, 0xCD, 0xCA, 0xC5, 0xB6, 0xA3, 0x8D, 0x78,
-	0x62, 0x51, 0x44, 0x3D, 0x3C, 0x44, 0x50, 0x62, 0x75, 0x88, 0x9A, 0xA9,
-	0xB3, 0xBB, 0xB9, 0xB3, 0xAA, 0x9C, 0x90, 0x81, 0x77, 0x6D, 0x64, 0x61,
-	0x60, 0x64, 0x6B, 0x72, 0x7A, 0x80, 0x86, 0x88, 0x8B, 0x8B, 0x8B, 0x88,
-	0x86, 0x84, 0x82, 0x86, 0x86, 0x8A, 0x8E, 0x91, 0x94, 0x93, 0x92, 0x8D,
-	0x85, 0x7E, 0x74, 0x69, 0x61, 0x59, 0x56, 0x58, 0x5D, 0x66, 0x74, 0x82,
-	0x92, 0xA6, 0xB3, 0xBE, 0xC3, 0xC1, 0xBB, 0xAF, 0x9F, 0x8A, 0x74, 0x5F,
-	0x4E, 0x41, 0x3A, 0x39, 0x40, 0x4C, 0x5E, 0x75, 0x8C, 0xA3, 0xB6, 0xC4,
-	0xCB, 0xCA, 0xC5, 0xB7, 0xA8, 0x94, 0x7D, 0x67, 0x56, 0x4A, 0x43, 0x42,
-	0x46, 0x50, 0x60, 0x72, 0x83, 0x92, 0xA0, 0xAC, 0xB3, 0xB2, 0xAF, 0xA7,
-	0x9B, 0x90, 0x84, 0x7B, 0x72, 0x6B, 0x69, 0x69, 0x6B, 0x70, 0x76, 0x7A,
-	0x7F, 0x80, 0x83, 0x83, 0x82, 0x80, 0x80, 0x80, 0x80, 0x82, 0x85, 0x8B,
-	0x91, 0x95, 0x9A, 0x9D, 0x9E, 0x9A, 0x94, 0x8A, 0x80, 0x74, 0x68, 0x5C,
-	0x52, 0x4D, 0x4D, 0x53, 0x5C, 0x6B, 0x7E, 0x90, 0xA2, 0xB2, 0xBD, 0xC5,
-	0xC6, 0xC2, 0xB7, 0xA4, 0x91, 0x7A, 0x64, 0x4F, 0x42, 0x39, 0x37, 0x3C,
-	0x48, 0x5A, 0x6E, 0x85, 0x9D, 0xB0, 0xBF, 0xC8, 0xCA, 0xC6, 0xBB, 0xAB,
-	0x98, 0x82, 0x6F, 0x5E, 0x51, 0x4A, 0x47, 0x4A, 0x53, 0x60, 0x6F, 0x7E,
-	0x8E, 0x99, 0xA3, 0xAA, 0xAB, 0xA8, 0xA2, 0x9A, 0x91, 0x88, 0x7F, 0x78,
-	0x76, 0x72, 0x72, 0x73, 0x77, 0x7A, 0x7D, 0x7F, 0x7F, 0x7F, 0x7D, 0x7B,
-	0x79, 0x78, 0x78, 0x7A, 0x80, 0x84, 0x8B, 0x93, 0x9A, 0xA2, 0xA4, 0xA7,
-	0xA4, 0x9D, 0x92, 0x85, 0x77, 0x67, 0x5A, 0x4C, 0x46, 0x45, 0x49, 0x54,
-	0x62, 0x76, 0x8A, 0x9E, 0xB0, 0xBE, 0xC7, 0xC9, 0xC6, 0xBB, 0xAC, 0x97,
-	0x80, 0x6A, 0x55, 0x46, 0x3B, 0x38, 0x3B, 0x45, 0x54, 0x67, 0x80, 0x95,
-	0xAA, 0xB8, 0xC2, 0xC6, 0xC3, 0xBA, 0xAC, 0x9A, 0x88, 0x74, 0x65, 0x57,
-	0x4F, 0x4C, 0x4E, 0x55, 0x60, 0x6D, 0x7B, 0x88, 0x94, 0x9C, 0xA0, 0xA1,
-	0xA2, 0x9B, 0x96, 0x8E, 0x88, 0x82, 0x7E, 0x7C, 0x7B, 0x7D, 0x7D, 0x7E,
-	0x7F, 0x80, 0x7F, 0x7F, 0x7A, 0x76, 0x73, 0x6E, 0x6E, 0x6E, 0x72, 0x77,
-	0x80, 0x8C, 0x96, 0x9F, 0xA8, 0xAE, 0xB0, 0xAE, 0xA6, 0x9A, 0x8C, 0x7B,
-	0x6A, 0x5B, 0x4C, 0x44, 0x41, 0x44, 0x4D, 0x5A, 0x6E, 0x83, 0x98, 0xAD,
-	0xBD, 0xC8, 0xCD, 0xCA, 0xC0, 0xB1, 0x9E, 0x85, 0x70, 0x5A, 0x49, 0x3D,
-	0x38, 0x3B, 0x43, 0x51, 0x64, 0x7C, 0x90, 0xA3, 0xB4, 0xBD, 0xC3, 0xC1,
-	0xB9, 0xAE, 0x9E, 0x8C, 0x7C, 0x6D, 0x60, 0x57, 0x52, 0x53, 0x5A, 0x63,
-	0x6F, 0x7A, 0x82, 0x8C, 0x93, 0x98, 0x9A, 0x98, 0x95, 0x91, 0x8C, 0x87,
-	0x85, 0x82, 0x82, 0x82, 0x84, 0x85, 0x86, 0x85, 0x82, 0x80, 0x7C, 0x76,
-	0x70, 0x69, 0x65, 0x64, 0x66, 0x6A, 0x71, 0x7D, 0x89, 0x97, 0xA3, 0xAD,
-	0xB4, 0xB9, 0xB8, 0xB0, 0xA3, 0x95, 0x81, 0x6F, 0x5D, 0x4C, 0x41, 0x3D,
-	0x3D, 0x46, 0x54, 0x65, 0x7D, 0x95, 0xA8, 0xBB, 0xC7, 0xCC, 0xCB, 0xC3,
-	0xB6, 0xA2, 0x8B, 0x77, 0x60, 0x4E, 0x42, 0x3C, 0x3B, 0x42, 0x4F, 0x5F,
-	0x75, 0x89, 0x9C, 0xAB, 0xB7, 0xBE, 0xBC, 0xB7, 0xAB, 0x9F, 0x8F, 0x80,
-	0x74, 0x68, 0x60, 0x5C, 0x5C, 0x61, 0x68, 0x6F, 0x78, 0x81, 0x87, 0x8C,
-	0x8F, 0x90, 0x8F, 0x8D, 0x8C, 0x88, 0x86, 0x85, 0x86, 0x86, 0x8A, 0x8C,
-	0x8E, 0x8E, 0x8C, 0x88, 0x83, 0x7D, 0x74, 0x6B, 0x64, 0x5E, 0x5B, 0x5B,
-	0x60, 0x69, 0x76, 0x84, 0x94, 0xA4, 0xB1, 0xBA, 0xBE, 0xBE, 0xB8, 0xAB,
-	0x9C, 0x89, 0x73, 0x5F, 0x4E, 0x41, 0x3A, 0x39, 0x40, 0x4E, 0x5F, 0x76,
-	0x8C, 0xA4, 0xB6, 0xC3, 0xCC, 0xCC, 0xC6, 0xBA, 0xA7, 0x93, 0x7B, 0x68,
-	0x54, 0x47, 0x3F, 0x3E, 0x43, 0x4F, 0x5D, 0x71, 0x83, 0x94, 0xA3, 0xAF,
-	0xB5, 0xB6, 0xB2, 0xA9, 0x9E, 0x91, 0x85, 0x79, 0x70, 0x68, 0x64, 0x63,
-	0x65, 0x6C, 0x74, 0x79, 0x80, 0x84, 0x86, 0x88, 0x88, 0x87, 0x86, 0x84,
-	0x84, 0x85, 0x87, 0x8A, 0x8D, 0x91, 0x96, 0x9A, 0x9A, 0x98, 0x91, 0x89,
-	0x80, 0x75, 0x6A, 0x60, 0x58, 0x53, 0x53, 0x57, 0x60, 0x6F, 0x7E, 0x90,
-	0xA1, 0xB0, 0xBC, 0xC1, 0xC4, 0xBF, 0xB3, 0xA4, 0x8F, 0x7A, 0x64, 0x50,
-	0x43, 0x3A, 0x38, 0x3C, 0x48, 0x5A, 0x70, 0x86, 0x9D, 0xB2, 0xC1, 0xC9,
-	0xCB, 0xC6, 0xBB, 0xAB, 0x97, 0x81, 0x6E, 0x5C, 0x4E, 0x45, 0x43, 0x47,
-	0x50, 0x5E, 0x6E, 0x7F, 0x8F, 0x9C, 0xA6, 0xAE, 0xAE, 0xAC, 0xA6, 0x9B,
-	0x92, 0x87, 0x7D, 0x76, 0x70, 0x6E, 0x6D, 0x6E, 0x72, 0x77, 0x7D, 0x7D,
-	0x80, 0x82, 0x81, 0x80, 0x7E, 0x7C, 0x7D, 0x7F, 0x81, 0x85, 0x8B, 0x91,
-	0x97, 0x9D, 0xA1, 0xA0, 0x9F, 0x99, 0x8E, 0x84, 0x77, 0x68, 0x5C, 0x51,
-	0x4C, 0x4A, 0x4E, 0x58, 0x65, 0x77, 0x89, 0x9E, 0xAF, 0xBD, 0xC5, 0xC7,
-	0xC5, 0xB9, 0xAA, 0x96, 0x81, 0x68, 0x55, 0x44, 0x3A, 0x36, 0x39, 0x45,
-	0x54, 0x69, 0x81, 0x97, 0xAD, 0xBD, 0xC6, 0xC9, 0xC5, 0xBD, 0xAE, 0x9C,
-	0x89, 0x74, 0x62, 0x55, 0x4C, 0x49, 0x4B, 0x52, 0x5E, 0x6C, 0x7B, 0x89,
-	0x95, 0x9E, 0xA5, 0xA7, 0xA5, 0x9F, 0x99, 0x8F, 0x88, 0x81, 0x7B, 0x77,
-	0x75, 0x76, 0x79, 0x7A, 0x7C, 0x7E, 0x81, 0x7F, 0x7E, 0x7B, 0x78, 0x75,
-	0x74, 0x74, 0x78, 0x7B, 0x82, 0x8A, 0x93, 0x9D, 0xA4, 0xA9, 0xAB, 0xA8,
-	0xA1, 0x98, 0x8A, 0x7B, 0x6B, 0x5B, 0x4F, 0x46, 0x44, 0x46, 0x4F, 0x5D,
-	0x6F, 0x84, 0x9A, 0xAD, 0xBD, 0xC7, 0xCA, 0xCA, 0xBF, 0xB1, 0x9D, 0x86,
-	0x6F, 0x5A, 0x4B, 0x3C, 0x38, 0x3A, 0x41, 0x51, 0x64, 0x7B, 0x91, 0xA6,
-	0xB4, 0xC0, 0xC5, 0xC5, 0xBB, 0xAE, 0x9E, 0x8B, 0x7B, 0x6A, 0x5D, 0x54,
-	0x50, 0x51, 0x56, 0x60, 0x6C, 0x7B, 0x85, 0x90, 0x98, 0x9D, 0xA0, 0x9F,
-	0x9B, 0x95, 0x8F, 0x89, 0x84, 0x80, 0x7F, 0x7D, 0x7F, 0x81, 0x81, 0x83,
-	0x81, 0x80, 0x7D, 0x79, 0x74, 0x70, 0x6B, 0x69, 0x6B, 0x6D, 0x75, 0x7F,
-	0x89, 0x94, 0x9F, 0xAA, 0xB1, 0xB3, 0xB1, 0xAB, 0x9E, 0x91, 0x7F, 0x6E,
-	0x5C, 0x4D, 0x44, 0x3E, 0x41, 0x48, 0x56, 0x69, 0x7E, 0x94, 0xA8, 0xBA,
-	0xC7, 0xCD, 0xC9, 0xC4, 0xB6, 0xA3, 0x8C, 0x75, 0x5F, 0x4D, 0x40, 0x3A,
-	0x39, 0x40, 0x4E, 0x5F, 0x74, 0x8A, 0x9E, 0xAE, 0xB9, 0xC0, 0xBF, 0xBA,
-	0xAE, 0xA0, 0x90, 0x7F, 0x73, 0x64, 0x5B, 0x56, 0x56, 0x5B, 0x63, 0x6E,
-	0x78, 0x81, 0x8A, 0x90, 0x94, 0x96, 0x96, 0x91, 0x8F, 0x8B, 0x87, 0x86,
-	0x85, 0x85, 0x85, 0x86, 0x87, 0x88, 0x89, 0x86, 0x82, 0x7E, 0x76, 0x6F,
-	0x69, 0x64, 0x60, 0x61, 0x67, 0x6D, 0x78, 0x86, 0x94, 0xA3, 0xAC, 0xB7,
-	0xBB, 0xBA, 0xB5, 0xA9, 0x9A, 0x88, 0x72, 0x5E, 0x4F, 0x42, 0x3B, 0x3C,
-	0x44, 0x51, 0x62, 0x78, 0x8E, 0xA5, 0xB6, 0xC4, 0xCC, 0xCC, 0xC5, 0xB9,
-	0xA7, 0x91, 0x7C, 0x67, 0x53, 0x45, 0x3D, 0x3C, 0x43, 0x4E, 0x5E, 0x71,
-	0x83, 0x96, 0xA7, 0xB2, 0xBA, 0xBA, 0xB6, 0xAB, 0x9F, 0x92, 0x83, 0x76,
-	0x6D, 0x64, 0x5F, 0x5F, 0x61, 0x68, 0x71, 0x78, 0x81, 0x85, 0x88, 0x8C,
-	0x8E, 0x8C, 0x8A, 0x89, 0x86, 0x85, 0x85, 0x87, 0x89, 0x8C, 0x91, 0x91,
-	0x93, 0x91, 0x8D, 0x87, 0x7F, 0x77, 0x6C, 0x63, 0x5C, 0x5A, 0x58, 0x5D,
-	0x64, 0x71, 0x82, 0x91, 0xA1, 0xAF, 0xBA, 0xC1, 0xC0, 0xBC, 0xB1, 0xA1,
-	0x8E, 0x79, 0x63, 0x52, 0x43, 0x3B, 0x39, 0x3E, 0x4A, 0x5B, 0x71, 0x88,
-	0x9E, 0xB4, 0xC1, 0xCA, 0xCB, 0xC8, 0xBC, 0xAA, 0x97, 0x80, 0x6D, 0x59,
-	0x4A, 0x42, 0x3F, 0x44, 0x4D, 0x5C, 0x6E, 0x80, 0x8F, 0xA0, 0xAB, 0xB1,
-	0xB3, 0xB1, 0xAA, 0x9E, 0x93, 0x86, 0x7B, 0x73, 0x6C, 0x67, 0x67, 0x68,
-	0x6F, 0x74, 0x7A, 0x7E, 0x81, 0x85, 0x84, 0x83, 0x85, 0x82, 0x80, 0x80,
-	0x81, 0x85, 0x88, 0x8F, 0x94, 0x97, 0x9C, 0x9C, 0x99, 0x94, 0x8C, 0x83,
-	0x77, 0x6B, 0x5E, 0x56, 0x50, 0x4E, 0x53, 0x5B, 0x68, 0x78, 0x8A, 0x9F,
-	0xAE, 0xBC, 0xC4, 0xC5, 0xC2, 0xB8, 0xA9, 0x95, 0x7F, 0x69, 0x54, 0x45,
-	0x3B, 0x38, 0x3A, 0x45, 0x56, 0x6B, 0x82, 0x9A, 0xAE, 0xBD, 0xC6, 0xC9,
-	0xC7, 0xBE, 0xAE, 0x9B, 0x87, 0x73, 0x61, 0x52, 0x48, 0x45, 0x46, 0x4F,
-	0x5B, 0x6B, 0x7B, 0x8B, 0x98, 0xA4, 0xA9, 0xAD, 0xAB, 0xA4, 0x9B, 0x92,
-	0x88, 0x80, 0x79, 0x74, 0x70, 0x6F, 0x72, 0x75, 0x78, 0x7D, 0x7E, 0x80,
-	0x81, 0x80, 0x7E, 0x7C, 0x7A, 0x7A, 0x7C, 0x7F, 0x84, 0x8A, 0x90, 0x99,
-	0xA0, 0xA5, 0xA6, 0xA3, 0x9B, 0x92, 0x86, 0x7A, 0x6B, 0x5D, 0x51, 0x47,
-	0x47, 0x48, 0x51, 0x60, 0x72, 0x85, 0x9A, 0xAC, 0xBC, 0xC6, 0xC9, 0xC7,
-	0xBE, 0xAE, 0x9B, 0x85, 0x6E, 0x5A, 0x48, 0x3C, 0x37, 0x39, 0x42, 0x51,
-	0x66, 0x7D, 0x90, 0xA6, 0xB7, 0xC3, 0xC6, 0xC5, 0xBE, 0xB0, 0x9F, 0x8B,
-	0x78, 0x67, 0x59, 0x4F, 0x4C, 0x4D, 0x53, 0x5E, 0x6B, 0x79, 0x85, 0x93,
-	0x9A, 0xA1, 0xA3, 0xA1, 0x9E, 0x97, 0x90, 0x89, 0x82, 0x7D, 0x7A, 0x7A,
-	0x79, 0x7A, 0x7C, 0x7D, 0x81, 0x80, 0x7D, 0x7B, 0x78, 0x74, 0x71, 0x71,
-	0x71, 0x74, 0x78, 0x80, 0x89, 0x92, 0x9D, 0xA5, 0xAB, 0xAF, 0xAC, 0xA6,
-	0x9C, 0x8E, 0x7F, 0x6E, 0x5C, 0x4F, 0x45, 0x40, 0x43, 0x4C, 0x58, 0x69,
-	0x80, 0x96, 0xAA, 0xBA, 0xC6, 0xCA, 0xCA, 0xC3, 0xB4, 0xA1, 0x8B, 0x74,
-	0x5F, 0x4B, 0x3F, 0x39, 0x3A, 0x41, 0x4F, 0x60, 0x76, 0x8B, 0xA0, 0xB1,
-	0xBD, 0xC4, 0xC4, 0xBD, 0xAF, 0xA1, 0x90, 0x7E, 0x70, 0x62, 0x57, 0x52,
-	0x52, 0x57, 0x60, 0x6B, 0x77, 0x81, 0x8C, 0x95, 0x9A, 0x9C, 0x9A, 0x98,
-	0x93, 0x8F, 0x88, 0x85, 0x82, 0x80, 0x81, 0x81, 0x82, 0x85, 0x84, 0x83,
-	0x80, 0x7E, 0x79, 0x73, 0x6D, 0x69, 0x67, 0x66, 0x6A, 0x72, 0x7C, 0x86,
-	0x93, 0x9F, 0xAB, 0xB3, 0xB5, 0xB6, 0xAF, 0xA5, 0x96, 0x85, 0x72, 0x60,
-	0x50, 0x43, 0x3E, 0x3F, 0x44, 0x51, 0x63, 0x79, 0x8E, 0xA6, 0xB8, 0xC6,
-	0xCB, 0xCC, 0xC6, 0xBA, 0xA7, 0x90, 0x7A, 0x64, 0x52, 0x43, 0x3C, 0x3B,
-	0x3E, 0x4C, 0x5E, 0x70, 0x84, 0x99, 0xA9, 0xB6, 0xBD, 0xBE, 0xBA, 0xAF,
-	0xA1, 0x93, 0x82, 0x75, 0x69, 0x60, 0x5A, 0x59, 0x5D, 0x64, 0x6E, 0x78,
-	0x7F, 0x87, 0x8E, 0x8F, 0x92, 0x91, 0x90, 0x8C, 0x89, 0x87, 0x86, 0x85,
-	0x86, 0x87, 0x8B, 0x8C, 0x8B, 0x8C, 0x89, 0x85, 0x7E, 0x77, 0x6F, 0x68,
-	0x61, 0x5C, 0x5D, 0x61, 0x69, 0x75, 0x81, 0x92, 0xA0, 0xAE, 0xB7, 0xBC,
-	0xBE, 0xB9, 0xAC, 0x9D, 0x8C, 0x77, 0x62, 0x51, 0x43, 0x3B, 0x3A, 0x3F,
-	0x4B, 0x5C, 0x72, 0x89, 0xA0, 0xB3, 0xC2, 0xCC, 0xCC, 0xC8, 0xBD, 0xAB,
-	0x97, 0x80, 0x6B, 0x57, 0x4A, 0x3F, 0x3D, 0x42, 0x4C, 0x5A, 0x6D, 0x80,
-	0x93, 0xA3, 0xB0, 0xB7, 0xB8, 0xB5, 0xAE, 0x9F, 0x94, 0x87, 0x7C, 0x70,
-	0x68, 0x64, 0x63, 0x67, 0x6A, 0x71, 0x78, 0x81, 0x84, 0x85, 0x8A, 0x8A,
-	0x89, 0x86, 0x85, 0x85, 0x83, 0x85, 0x87, 0x8B, 0x90, 0x94, 0x96, 0x96,
-	0x93, 0x90, 0x8B, 0x80, 0x76, 0x6D, 0x63, 0x5A, 0x55, 0x55, 0x56, 0x61,
-	0x6C, 0x7B, 0x8C, 0x9E, 0xAC, 0xBB, 0xC0, 0xC3, 0xBF, 0xB5, 0xA6, 0x92,
-	0x7D, 0x67, 0x55, 0x45, 0x3C, 0x39, 0x3C, 0x47, 0x55, 0x6A, 0x83, 0x9B,
-	0xAE, 0xBF, 0xCA, 0xCC, 0xC9, 0xC0, 0xAF, 0x9A, 0x85, 0x71, 0x5D, 0x4E,
-	0x46, 0x42, 0x44, 0x4E, 0x59, 0x6A, 0x7B, 0x8B, 0x9C, 0xA6, 0xAD, 0xB0,
-	0xAE, 0xA8, 0x9F, 0x95, 0x88, 0x7F, 0x75, 0x70, 0x6C, 0x6B, 0x6C, 0x70,
-	0x75, 0x7A, 0x7E, 0x81, 0x82, 0x83, 0x82, 0x80, 0x7F, 0x7F, 0x7F, 0x81,
-	0x86, 0x89, 0x8F, 0x95, 0x9A, 0x9E, 0xA1, 0x9E, 0x99, 0x90, 0x84, 0x79,
-	0x6A, 0x5F, 0x54, 0x4D, 0x4B, 0x4E, 0x55, 0x62, 0x73, 0x85, 0x99, 0xAD,
-	0xBA, 0xC4, 0xC7, 0xC5, 0xBC, 0xAC, 0x99, 0x83, 0x6E, 0x58, 0x47, 0x3C,
-	0x38, 0x39, 0x42, 0x52, 0x64, 0x7D, 0x93, 0xA8, 0xB9, 0xC5, 0xCA, 0xC7,
-	0xBF, 0xB0, 0xA0, 0x8B, 0x76, 0x64, 0x56, 0x4D, 0x47, 0x49, 0x4F, 0x5A,
-	0x69, 0x78, 0x86, 0x94, 0x9D, 0xA5, 0xA9, 0xA7, 0xA3, 0x9B, 0x92, 0x8A,
-	0x82, 0x7B, 0x77, 0x74, 0x73, 0x73, 0x77, 0x7B, 0x7D, 0x7F, 0x81, 0x7F,
-	0x7D, 0x7A, 0x78, 0x76, 0x76, 0x79, 0x7C, 0x81, 0x8A, 0x92, 0x9A, 0xA1,
-	0xA7, 0xA9, 0xA7, 0xA2, 0x96, 0x8A, 0x7F, 0x6E, 0x5F, 0x52, 0x49, 0x44,
-	0x47, 0x4F, 0x5A, 0x6B, 0x81, 0x94, 0xA9, 0xB9, 0xC5, 0xCB, 0xC8, 0xC1,
-	0xB3, 0x9E, 0x8A, 0x73, 0x5F, 0x4C, 0x3E, 0x38, 0x3A, 0x40, 0x4E, 0x5F,
-	0x77, 0x8C, 0xA2, 0xB4, 0xC1, 0xC6, 0xC5, 0xC0, 0xB2, 0xA2, 0x90, 0x7F,
-	0x6C, 0x5D, 0x54, 0x4D, 0x50, 0x55, 0x5D, 0x68, 0x77, 0x83, 0x8E, 0x97,
-	0x9E, 0xA0, 0xA0, 0x9E, 0x98, 0x91, 0x8B, 0x84, 0x80, 0x7D, 0x7D, 0x7D,
-	0x7F, 0x80, 0x81, 0x82, 0x80, 0x7F, 0x7C, 0x78, 0x73, 0x6F, 0x6C, 0x6C,
-	0x6F, 0x75, 0x7D, 0x87, 0x92, 0x9C, 0xA8, 0xAD, 0xB2, 0xB1, 0xAC, 0xA1,
-	0x92, 0x82, 0x70, 0x5F, 0x50, 0x43, 0x3F, 0x3F, 0x47, 0x53, 0x64, 0x7A,
-	0x90, 0xA6, 0xB7, 0xC4, 0xCC, 0xCA, 0xC4, 0xB8, 0xA6, 0x8F, 0x7A, 0x63,
-	0x50, 0x43, 0x3C, 0x3A, 0x3D, 0x4A, 0x5C, 0x71, 0x87, 0x99, 0xAC, 0xBB,
-	0xBF, 0xC1, 0xBC, 0xB1, 0xA3, 0x93, 0x82, 0x72, 0x64, 0x5B, 0x55, 0x55,
-	0x57, 0x60, 0x6A, 0x75, 0x7F, 0x87, 0x90, 0x94, 0x97, 0x97, 0x92, 0x91,
-	0x8D, 0x87, 0x85, 0x83, 0x82, 0x84, 0x85, 0x85, 0x87, 0x86, 0x84, 0x81,
-	0x7E, 0x79, 0x72, 0x6A, 0x65, 0x63, 0x63, 0x67, 0x6E, 0x78, 0x84, 0x92,
-	0x9F, 0xAB, 0xB5, 0xB9, 0xBA, 0xB5, 0xAA, 0x9D, 0x89, 0x76, 0x64, 0x53,
-	0x45, 0x3F, 0x3D, 0x42, 0x4D, 0x5D, 0x74, 0x8A, 0x9F, 0xB3, 0xC2, 0xCB,
-	0xCD, 0xC7, 0xBB, 0xAC, 0x96, 0x80, 0x6A, 0x57, 0x47, 0x3D, 0x3B, 0x3F,
-	0x49, 0x5A, 0x6C, 0x81, 0x95, 0xA5, 0xB1, 0xBA, 0xBD, 0xB9, 0xAE, 0xA3,
-	0x95, 0x86, 0x79, 0x6C, 0x63, 0x5D, 0x5D, 0x60, 0x66, 0x6D, 0x76, 0x7E,
-	0x84, 0x8A, 0x8D, 0x8E, 0x8F, 0x8C, 0x8B, 0x88, 0x86, 0x85, 0x85, 0x88,
-	0x89, 0x8E, 0x90, 0x90, 0x90, 0x8B, 0x87, 0x80, 0x78, 0x6F, 0x67, 0x61,
-	0x59, 0x5A, 0x5F, 0x65, 0x6F, 0x7E, 0x8E, 0x9E, 0xAD, 0xB7, 0xC0, 0xC1,
-	0xBC, 0xB2, 0xA4, 0x91, 0x7C, 0x67, 0x54, 0x46, 0x3C, 0x39, 0x3D, 0x47,
-	0x57, 0x6C, 0x84, 0x9A, 0xAE, 0xBF, 0xC9, 0xCD, 0xC8, 0xBF, 0xAF, 0x9B,
-	0x84, 0x6F, 0x5C, 0x4C, 0x41, 0x3F, 0x40, 0x4B, 0x58, 0x6A, 0x7E, 0x8E,
-	0xA0, 0xAA, 0xB2, 0xB5, 0xB5, 0xAD, 0xA1, 0x95, 0x89, 0x7D, 0x72, 0x6B,
-	0x68, 0x66, 0x67, 0x6B, 0x71, 0x77, 0x7D, 0x81, 0x86, 0x87, 0x86, 0x85,
-	0x84, 0x82, 0x82, 0x82, 0x84, 0x87, 0x8B, 0x91, 0x97, 0x9A, 0x9A, 0x99,
-	0x94, 0x8D, 0x83, 0x7A, 0x6E, 0x62, 0x59, 0x54, 0x51, 0x53, 0x5B, 0x66,
-	0x75, 0x88, 0x9B, 0xAC, 0xB9, 0xC1, 0xC5, 0xC2, 0xBA, 0xA9, 0x97, 0x81,
-	0x6A, 0x57, 0x47, 0x3C, 0x39, 0x3A, 0x42, 0x52, 0x66, 0x7D, 0x95, 0xAA,
-	0xBA, 0xC7, 0xCB, 0xCA, 0xC1, 0xB2, 0xA1, 0x8B, 0x76, 0x63, 0x53, 0x48,
-	0x43, 0x45, 0x4C, 0x59, 0x66, 0x79, 0x89, 0x97, 0xA2, 0xAB, 0xAE, 0xAB,
-	0xA6, 0x9D, 0x94, 0x8A, 0x81, 0x7A, 0x74, 0x6F, 0x6D, 0x6F, 0x71, 0x76,
-	0x7B, 0x7D, 0x80, 0x80, 0x81, 0x80, 0x7D, 0x7C, 0x7C, 0x7D, 0x80, 0x82,
-	0x89, 0x92, 0x98, 0x9D, 0xA4, 0xA4, 0xA2, 0x9C, 0x93, 0x88, 0x7C, 0x70,
-	0x61, 0x55, 0x4C, 0x49, 0x49, 0x52, 0x5F, 0x6F, 0x82, 0x96, 0xA9, 0xB9,
-	0xC4, 0xC9, 0xC8, 0xBF, 0xB1, 0x9F, 0x89, 0x72, 0x5C, 0x4A, 0x3E, 0x38,
-	0x39, 0x42, 0x4D, 0x61, 0x79, 0x8F, 0xA5, 0xB6, 0xC1, 0xC8, 0xC8, 0xC1,
-	0xB5, 0xA4, 0x90, 0x7C, 0x6A, 0x5C, 0x51, 0x4B, 0x4A, 0x50, 0x5B, 0x67,
-	0x77, 0x84, 0x90, 0x9A, 0xA2, 0xA5, 0xA3, 0xA0, 0x9B, 0x93, 0x89, 0x84,
-	0x80, 0x7A, 0x77, 0x77, 0x78, 0x7A, 0x7C, 0x7D, 0x7F, 0x7F, 0x7D, 0x7A,
-	0x77, 0x74, 0x72, 0x72, 0x74, 0x78, 0x7E, 0x87, 0x91, 0x9B, 0xA1, 0xA9,
-	0xAC, 0xAB, 0xA6, 0x9C, 0x90, 0x80, 0x70, 0x60, 0x52, 0x47, 0x43, 0x44,
-	0x4A, 0x57, 0x67, 0x7C, 0x91, 0xA5, 0xB8, 0xC4, 0xCA, 0xCA, 0xC4, 0xB6,
-	0xA6, 0x8F, 0x78, 0x63, 0x4D, 0x40, 0x39, 0x38, 0x40, 0x4A, 0x5C, 0x73,
-	0x88, 0x9C, 0xAF, 0xBA, 0xC3, 0xC5, 0xBE, 0xB5, 0xA4, 0x93, 0x82, 0x71,
-	0x62, 0x57, 0x52, 0x50, 0x55, 0x5D, 0x68, 0x76, 0x80, 0x8B, 0x94, 0x99,
-	0x9E, 0x9C, 0x99, 0x96, 0x90, 0x8A, 0x85, 0x80, 0x80, 0x80, 0x80, 0x81,
-	0x82, 0x82, 0x84, 0x82, 0x7E, 0x7A, 0x75, 0x70, 0x6C, 0x68, 0x68, 0x6A,
-	0x71, 0x79, 0x83, 0x91, 0x9C, 0xA8, 0xB0, 0xB6, 0xB5, 0xAF, 0xA8, 0x9A,
-	0x88, 0x76, 0x63, 0x54, 0x48, 0x40, 0x3E, 0x45, 0x4F, 0x61, 0x74, 0x8A,
-	0xA1, 0xB3, 0xC4, 0xCB, 0xCB, 0xC6, 0xBB, 0xAA, 0x95, 0x7F, 0x67, 0x54,
-	0x45, 0x3C, 0x38, 0x3E, 0x49, 0x58, 0x6D, 0x81, 0x96, 0xA8, 0xB7, 0xBE,
-	0xC0, 0xBB, 0xB2, 0xA6, 0x96, 0x86, 0x76, 0x6B, 0x5F, 0x59, 0x59, 0x5A,
-	0x61, 0x6A, 0x74, 0x7F, 0x86, 0x8B, 0x91, 0x93, 0x92, 0x91, 0x8D, 0x8C,
-	0x88, 0x85, 0x84, 0x84, 0x85, 0x87, 0x88, 0x8A, 0x89, 0x89, 0x84, 0x7E,
-	0x79, 0x71, 0x69, 0x65, 0x60, 0x60, 0x62, 0x6B, 0x72, 0x7F, 0x8E, 0x9D,
-	0xAA, 0xB5, 0xBC, 0xBD, 0xB8, 0xAF, 0xA1, 0x8F, 0x7B, 0x67, 0x56, 0x47,
-	0x3E, 0x3A, 0x3F, 0x49, 0x59, 0x6F, 0x87, 0x9B, 0xAF, 0xC1, 0xCA, 0xCD,
-	0xCA, 0xBF, 0xB0, 0x9B, 0x84, 0x6D, 0x5A, 0x4B, 0x41, 0x3C, 0x3F, 0x4A,
-	0x58, 0x68, 0x7C, 0x8E, 0xA1, 0xAE, 0xB6, 0xB9, 0xB7, 0xAF, 0xA6, 0x98,
-	0x89, 0x7B, 0x71, 0x68, 0x62, 0x61, 0x63, 0x67, 0x6E, 0x76, 0x7E, 0x82,
-	0x87, 0x89, 0x8C, 0x8B, 0x87, 0x86, 0x85, 0x85, 0x83, 0x87, 0x8A, 0x8C,
-	0x8F, 0x93, 0x93, 0x93, 0x90, 0x89, 0x80, 0x79, 0x70, 0x66, 0x5D, 0x57,
-	0x57, 0x59, 0x5F, 0x6B, 0x7A, 0x8B, 0x9C, 0xAB, 0xB7, 0xC1, 0xC4, 0xBF,
-	0xB7, 0xA7, 0x96, 0x80, 0x6B, 0x58, 0x47, 0x3D, 0x39, 0x3A, 0x44, 0x53,
-	0x66, 0x80, 0x95, 0xAA, 0xBB, 0xC7, 0xCB, 0xC9, 0xC1, 0xB3, 0xA0, 0x8A,
-	0x76, 0x60, 0x51, 0x45, 0x41, 0x42, 0x49, 0x57, 0x67, 0x79, 0x88, 0x9A,
-	0xA7, 0xAE, 0xB2, 0xB0, 0xAC, 0xA2, 0x97, 0x8B, 0x80, 0x77, 0x6F, 0x6C,
-	0x69, 0x6A, 0x6E, 0x73, 0x78, 0x7D, 0x80, 0x82, 0x83, 0x83, 0x82, 0x7F,
-	0x81, 0x7F, 0x81, 0x84, 0x88, 0x8B, 0x92, 0x98, 0x9C, 0x9E, 0x9D, 0x9A,
-	0x91, 0x88, 0x7C, 0x6E, 0x63, 0x59, 0x50, 0x4E, 0x4F, 0x57, 0x62, 0x72,
-	0x83, 0x97, 0xA9, 0xB7, 0xC2, 0xC6, 0xC6, 0xBC, 0xAE, 0x9C, 0x86, 0x71,
-	0x5D, 0x4A, 0x3D, 0x38, 0x38, 0x3F, 0x4E, 0x61, 0x77, 0x90, 0xA5, 0xB7,
-	0xC3, 0xCA, 0xC9, 0xC2, 0xB5, 0xA3, 0x90, 0x7C, 0x68, 0x58, 0x4D, 0x47,
-	0x47, 0x4D, 0x58, 0x66, 0x76, 0x84, 0x93, 0x9F, 0xA7, 0xAB, 0xAB, 0xA6,
-	0x9E, 0x95, 0x8D, 0x84, 0x7C, 0x75, 0x74, 0x72, 0x73, 0x77, 0x79, 0x7C,
-	0x7E, 0x7F, 0x80, 0x80, 0x7C, 0x7A, 0x78, 0x78, 0x79, 0x7C, 0x81, 0x87,
-	0x8F, 0x97, 0xA0, 0xA3, 0xA8, 0xA7, 0xA0, 0x99, 0x8D, 0x80, 0x71, 0x62,
-	0x55, 0x4B, 0x46, 0x47, 0x4E, 0x5A, 0x69, 0x7E, 0x92, 0xA6, 0xB7, 0xC4,
-	0xC9, 0xC8, 0xC2, 0xB5, 0xA6, 0x8F, 0x78, 0x62, 0x4E, 0x40, 0x39, 0x39,
-	0x3E, 0x4A, 0x5D, 0x73, 0x89, 0x9F, 0xB1, 0xC0, 0xC6, 0xC6, 0xC1, 0xB3,
-	0xA5, 0x93, 0x80, 0x6F, 0x60, 0x54, 0x4D, 0x4C, 0x51, 0x5A, 0x65, 0x74,
-	0x81, 0x8E, 0x96, 0x9F, 0xA4, 0xA2, 0xA0, 0x99, 0x92, 0x8D, 0x85, 0x80,
-	0x7D, 0x7C, 0x7B, 0x7C, 0x7E, 0x80, 0x81, 0x7F, 0x7F, 0x7D, 0x79, 0x75,
-	0x70, 0x6D, 0x6D, 0x71, 0x75, 0x7C, 0x85, 0x8F, 0x9A, 0xA4, 0xAB, 0xB0,
-	0xAE, 0xAB, 0xA1, 0x95, 0x84, 0x74, 0x64, 0x53, 0x48, 0x41, 0x41, 0x46,
-	0x52, 0x62, 0x77, 0x8D, 0xA1, 0xB4, 0xC2, 0xCA, 0xCB, 0xC6, 0xBA, 0xA9,
-	0x94, 0x7E, 0x67, 0x52, 0x43, 0x3A, 0x38, 0x3D, 0x47, 0x59, 0x6E, 0x83,
-	0x97, 0xA9, 0xB8, 0xC0, 0xC2, 0xBD, 0xB5, 0xA8, 0x96, 0x84, 0x74, 0x66,
-	0x5B, 0x55, 0x54, 0x56, 0x5D, 0x68, 0x73, 0x7E, 0x87, 0x90, 0x96, 0x99,
-	0x98, 0x97, 0x93, 0x8F, 0x8A, 0x85, 0x83, 0x83, 0x82, 0x82, 0x85, 0x86,
-	0x87, 0x84, 0x83, 0x7F, 0x7A, 0x75, 0x6D, 0x68, 0x65, 0x65, 0x66, 0x6C,
-	0x76, 0x81, 0x8E, 0x9B, 0xA8, 0xB2, 0xB8, 0xBA, 0xB6, 0xAB, 0x9E, 0x8D,
-	0x7B, 0x67, 0x56, 0x48, 0x3F, 0x3D, 0x41, 0x4C, 0x5A, 0x70, 0x87, 0x9A,
-	0xB0, 0xC0, 0xC8, 0xCD, 0xC8, 0xBF, 0xAF, 0x9A, 0x83, 0x6C, 0x59, 0x48,
-	0x3E, 0x3B, 0x3F, 0x47, 0x56, 0x69, 0x7E, 0x91, 0xA2, 0xB1, 0xB9, 0xBD,
-	0xBB, 0xB4, 0xA8, 0x99, 0x8A, 0x7B, 0x70, 0x65, 0x5E, 0x5D, 0x5E, 0x62,
-	0x6B, 0x74, 0x7D, 0x85, 0x8A, 0x8E, 0x90, 0x91, 0x8F, 0x8B, 0x87, 0x86,
-	0x84, 0x85, 0x86, 0x87, 0x8B, 0x8D, 0x8F, 0x8E, 0x8C, 0x88, 0x80, 0x7B,
-	0x70, 0x6A, 0x62, 0x5D, 0x5C, 0x5E, 0x65, 0x6F, 0x7D, 0x8B, 0x9B, 0xA9,
-	0xB5, 0xBF, 0xC0, 0xBB, 0xB4, 0xA5, 0x93, 0x80, 0x6B, 0x58, 0x48, 0x3E,
-	0x3A, 0x3C, 0x46, 0x54, 0x68, 0x81, 0x97, 0xAC, 0xBC, 0xC7, 0xCD, 0xCA,
-	0xC1, 0xB2, 0x9F, 0x89, 0x73, 0x5E, 0x4E, 0x43, 0x3E, 0x3F, 0x48, 0x55,
-	0x66, 0x78, 0x8A, 0x9D, 0xA9, 0xB2, 0xB7, 0xB4, 0xB0, 0xA5, 0x99, 0x8C,
-	0x7E, 0x73, 0x6C, 0x65, 0x63, 0x64, 0x68, 0x6F, 0x77, 0x7C, 0x81, 0x83,
-	0x87, 0x88, 0x87, 0x85, 0x84, 0x83, 0x84, 0x83, 0x86, 0x8A, 0x8F, 0x93,
-	0x98, 0x98, 0x98, 0x94, 0x8F, 0x85, 0x7B, 0x71, 0x66, 0x5D, 0x56, 0x53,
-	0x55, 0x5C, 0x66, 0x74, 0x85, 0x97, 0xA8, 0xB7, 0xC0, 0xC6, 0xC3, 0xBB,
-	0xAD, 0x9B, 0x86, 0x70, 0x5B, 0x4A, 0x3E, 0x38, 0x3A, 0x41, 0x50, 0x62,
-	0x7B, 0x92, 0xA5, 0xB9, 0xC3, 0xCB, 0xC9, 0xC3, 0xB7, 0xA3, 0x8F, 0x79,
-	0x65, 0x55, 0x49, 0x41, 0x43, 0x4B, 0x55, 0x64, 0x75, 0x85, 0x93, 0xA1,
-	0xAA, 0xB0, 0xAE, 0xA9, 0xA1, 0x98, 0x8C, 0x81, 0x7A, 0x74, 0x6E, 0x6D,
-	0x6E, 0x70, 0x75, 0x79, 0x7D, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7D, 0x7D,
-	0x7E, 0x7F, 0x83, 0x88, 0x8E, 0x94, 0x9B, 0x9F, 0xA2, 0xA1, 0x9C, 0x95,
-	0x8A, 0x7E, 0x71, 0x64, 0x57, 0x4E, 0x49, 0x49, 0x50, 0x5D, 0x6C, 0x7F,
-	0x93, 0xA6, 0xB6, 0xC1, 0xC8, 0xC7, 0xC0, 0xB4, 0xA3, 0x8C, 0x77, 0x61,
-	0x4E, 0x3F, 0x38, 0x38, 0x3E, 0x4B, 0x5D, 0x74, 0x8C, 0xA2, 0xB2, 0xC0,
-	0xC6, 0xC9, 0xC2, 0xB6, 0xA7, 0x94, 0x7F, 0x6B, 0x5D, 0x51, 0x49, 0x49,
-	0x4D, 0x56, 0x62, 0x72, 0x80, 0x8D, 0x9A, 0xA2, 0xA6, 0xA8, 0xA3, 0x9D,
-	0x96, 0x8E, 0x86, 0x7D, 0x79, 0x77, 0x75, 0x77, 0x79, 0x7B, 0x7F, 0x80,
-	0x7F, 0x7F, 0x7D, 0x7A, 0x77, 0x74, 0x75, 0x76, 0x78, 0x7F, 0x85, 0x8E,
-	0x97, 0xA0, 0xA8, 0xAB, 0xA9, 0xA5, 0x9E, 0x91, 0x83, 0x74, 0x63, 0x57,
-	0x4B, 0x44, 0x44, 0x4A, 0x54, 0x64, 0x78, 0x8D, 0xA3, 0xB5, 0xC1, 0xCA,
-	0xCA, 0xC5, 0xB9, 0xA9, 0x94, 0x7D, 0x67, 0x52, 0x43, 0x39, 0x37, 0x3D,
-	0x47, 0x58, 0x6E, 0x85, 0x99, 0xAD, 0xBB, 0xC3, 0xC5, 0xC1, 0xB8, 0xA9,
-	0x99, 0x85, 0x73, 0x65, 0x59, 0x51, 0x4F, 0x53, 0x59, 0x65, 0x71, 0x7E,
-	0x89, 0x93, 0x99, 0x9E, 0x9F, 0x9C, 0x98, 0x93, 0x8C, 0x86, 0x81, 0x7F,
-	0x7E, 0x7E, 0x80, 0x80, 0x81, 0x81, 0x82, 0x80, 0x7C, 0x78, 0x73, 0x6E,
-	0x6B, 0x6A, 0x6D, 0x71, 0x79, 0x82, 0x8D, 0x99, 0xA5, 0xAE, 0xB2, 0xB4,
-	0xB0, 0xA6, 0x9A, 0x8A, 0x79, 0x66, 0x56, 0x4A, 0x43, 0x3F, 0x43, 0x4D,
-	0x5D, 0x71, 0x87, 0x9C, 0xB1, 0xBF, 0xC9, 0xCC, 0xC7, 0xBD, 0xAE, 0x9A,
-	0x82, 0x6C, 0x57, 0x46, 0x3C, 0x39, 0x3C, 0x47, 0x55, 0x69, 0x7E, 0x93,
-	0xA6, 0xB4, 0xBD, 0xC0, 0xBE, 0xB6, 0xA8, 0x99, 0x8A, 0x79, 0x6B, 0x61,
-	0x59, 0x56, 0x58, 0x5F, 0x68, 0x71, 0x7C, 0x85, 0x8C, 0x91, 0x95, 0x95,
-	0x94, 0x91, 0x8D, 0x8A, 0x86, 0x85, 0x83, 0x82, 0x85, 0x86, 0x88, 0x89,
-	0x87, 0x84, 0x7F, 0x7A, 0x73, 0x6B, 0x66, 0x62, 0x60, 0x62, 0x68, 0x72,
-	0x7E, 0x8C, 0x9A, 0xA7, 0xB2, 0xB9, 0xBB, 0xB8, 0xAF, 0xA3, 0x90, 0x7E,
-	0x6A, 0x58, 0x48, 0x3F, 0x3B, 0x3D, 0x45, 0x56, 0x6A, 0x81, 0x98, 0xAD,
-	0xBE, 0xC8, 0xCD, 0xC9, 0xC1, 0xB2, 0xA0, 0x88, 0x73, 0x5D, 0x4C, 0x41,
-	0x3C, 0x3D, 0x45, 0x54, 0x66, 0x7A, 0x8B, 0x9F, 0xAD, 0xB6, 0xBB, 0xBA,
-	0xB2, 0xA7, 0x9A, 0x8C, 0x7E, 0x72, 0x68, 0x61, 0x5F, 0x60, 0x65, 0x6B,
-	0x72, 0x7B, 0x81, 0x88, 0x8B, 0x8C, 0x8D, 0x8B, 0x88, 0x87, 0x84, 0x84,
-	0x86, 0x88, 0x89, 0x8C, 0x90, 0x93, 0x91, 0x8E, 0x88, 0x83, 0x7C, 0x72,
-	0x68, 0x60, 0x5A, 0x58, 0x59, 0x5F, 0x6A, 0x77, 0x87, 0x98, 0xA8, 0xB4,
-	0xBF, 0xC1, 0xC0, 0xB8, 0xAA, 0x99, 0x84, 0x6F, 0x5C, 0x4B, 0x3F, 0x39,
-	0x3A, 0x42, 0x4F, 0x63, 0x7C, 0x90, 0xA8, 0xB9, 0xC5, 0xCB, 0xCA, 0xC4,
-	0xB5, 0xA4, 0x8E, 0x78, 0x64, 0x53, 0x46, 0x41, 0x41, 0x48, 0x53, 0x62,
-	0x76, 0x87, 0x98, 0xA5, 0xAE, 0xB3, 0xB3, 0xAF, 0xA4, 0x9A, 0x8E, 0x83,
-	0x78, 0x6F, 0x6A, 0x67, 0x69, 0x6B, 0x71, 0x76, 0x7C, 0x7F, 0x80, 0x83,
-	0x83, 0x83, 0x82, 0x81, 0x7F, 0x81, 0x82, 0x86, 0x8B, 0x8F, 0x95, 0x9B,
-	0x9C, 0x9C, 0x98, 0x92, 0x88, 0x7E, 0x71, 0x66, 0x5A, 0x53, 0x4F, 0x51,
-	0x57, 0x61, 0x6F, 0x7F, 0x92, 0xA7, 0xB6, 0xC0, 0xC6, 0xC5, 0xBF, 0xB2,
-	0xA1, 0x8C, 0x76, 0x60, 0x4D, 0x41, 0x39, 0x39, 0x3F, 0x4B, 0x5F, 0x72,
-	0x8A, 0xA1, 0xB4, 0xC2, 0xCA, 0xCA, 0xC3, 0xB7, 0xA6, 0x93, 0x7F, 0x6B,
-	0x59, 0x4C, 0x47, 0x44, 0x49, 0x54, 0x63, 0x72, 0x81, 0x91, 0x9F, 0xA7,
-	0xAC, 0xAD, 0xA9, 0xA1, 0x9A, 0x8F, 0x86, 0x7D, 0x78, 0x73, 0x70, 0x70,
-	0x73, 0x77, 0x7A, 0x7D, 0x80, 0x80, 0x80, 0x7F, 0x7D, 0x7B, 0x7A, 0x7A,
-	0x7D, 0x80, 0x85, 0x8D, 0x95, 0x9C, 0xA2, 0xA5, 0xA5, 0xA1, 0x98, 0x8E,
-	0x81, 0x73, 0x64, 0x58, 0x4D, 0x48, 0x47, 0x4D, 0x58, 0x68, 0x7A, 0x8E,
-	0xA3, 0xB3, 0xC2, 0xC8, 0xC9, 0xC3, 0xB8, 0xA7, 0x93, 0x7C, 0x65, 0x52,
-	0x42, 0x3A, 0x38, 0x3C, 0x47, 0x59, 0x6E, 0x85, 0x9B, 0xAF, 0xBD, 0xC5,
-	0xC8, 0xC2, 0xB9, 0xA9, 0x96, 0x83, 0x70, 0x60, 0x54, 0x4E, 0x4B, 0x4E,
-	0x57, 0x63, 0x72, 0x7F, 0x8B, 0x96, 0x9F, 0xA4, 0xA4, 0xA2, 0x9B, 0x95,
-	0x8E, 0x85, 0x80, 0x7D, 0x7A, 0x79, 0x7A, 0x7C, 0x7F, 0x7F, 0x80, 0x80,
-	0x7F, 0x7A, 0x77, 0x74, 0x70, 0x70, 0x70, 0x76, 0x7C, 0x82, 0x8D, 0x97,
-	0xA1, 0xA8, 0xAD, 0xAD, 0xAA, 0xA4, 0x97, 0x87, 0x79, 0x65, 0x57, 0x4B,
-	0x44, 0x42, 0x44, 0x50, 0x5F, 0x73, 0x89, 0x9F, 0xB2, 0xBF, 0xCA, 0xCB,
-	0xC6, 0xBE, 0xAC, 0x99, 0x82, 0x69, 0x57, 0x47, 0x3A, 0x37, 0x3B, 0x46,
-	0x55, 0x69, 0x80, 0x94, 0xA8, 0xB5, 0xBF, 0xC1, 0xC1, 0xB8, 0xAA, 0x9A,
-	0x88, 0x78, 0x69, 0x5C, 0x55, 0x52, 0x52, 0x5A, 0x64, 0x71, 0x7C, 0x85,
-	0x8F, 0x98, 0x9B, 0x9B, 0x99, 0x96, 0x90, 0x8B, 0x86, 0x83, 0x7F, 0x80,
-	0x80, 0x81, 0x82, 0x83, 0x85, 0x82, 0x7F, 0x7B, 0x76, 0x70, 0x6B, 0x66,
-	0x66, 0x68, 0x6D, 0x75, 0x80, 0x8B, 0x98, 0xA5, 0xB0, 0xB5, 0xB8, 0xB5,
-	0xAC, 0x9F, 0x8F, 0x7E, 0x69, 0x58, 0x4A, 0x41, 0x3D, 0x3F, 0x4A, 0x58,
-	0x6B, 0x81, 0x9A, 0xAD, 0xBC, 0xCA, 0xCC, 0xCB, 0xC1, 0xB3, 0x9E, 0x88,
-	0x71, 0x5B, 0x4C, 0x40, 0x39, 0x3C, 0x44, 0x53, 0x65, 0x7A, 0x8D, 0xA0,
-	0xAF, 0xBB, 0xBF, 0xBC, 0xB5, 0xA9, 0x9A, 0x8C, 0x7C, 0x70, 0x65, 0x5D,
-	0x59, 0x5A, 0x60, 0x67, 0x71, 0x7B, 0x82, 0x8A, 0x8E, 0x92, 0x92, 0x92,
-	0x8F, 0x8B, 0x88, 0x86, 0x85, 0x86, 0x86, 0x88, 0x8A, 0x8B, 0x8C, 0x8C,
-	0x86, 0x81, 0x7B, 0x73, 0x6C, 0x64, 0x5F, 0x5C, 0x5F, 0x65, 0x6E, 0x7A,
-	0x88, 0x97, 0xA7, 0xB2, 0xBA, 0xBF, 0xBD, 0xB3, 0xA6, 0x96, 0x83, 0x70,
-	0x5C, 0x4C, 0x3F, 0x39, 0x3B, 0x42, 0x51, 0x64, 0x7B, 0x92, 0xA9, 0xBA,
-	0xC4, 0xCC, 0xCB, 0xC3, 0xB4, 0xA3, 0x8D, 0x76, 0x63, 0x51, 0x43, 0x3F,
-	0x3D, 0x44, 0x51, 0x60, 0x75, 0x87, 0x99, 0xA7, 0xB3, 0xB9, 0xB7, 0xB4,
-	0xA7, 0x9B, 0x8F, 0x81, 0x77, 0x6D, 0x65, 0x63, 0x63, 0x68, 0x6B, 0x74,
-	0x7C, 0x80, 0x85, 0x88, 0x89, 0x88, 0x88, 0x87, 0x84, 0x84, 0x84, 0x86,
-	0x89, 0x8C, 0x91, 0x94, 0x95, 0x96, 0x94, 0x8E, 0x86, 0x7F, 0x75, 0x69,
-	0x61, 0x58, 0x55, 0x55, 0x5B, 0x65, 0x72, 0x83, 0x94, 0xA5, 0xB2, 0xBE,
-	0xC3, 0xC1, 0xBD, 0xAE, 0x9E, 0x8A, 0x74, 0x5F, 0x4E, 0x40, 0x38, 0x39,
-	0x40, 0x4C, 0x60, 0x76, 0x8D, 0xA2, 0xB5, 0xC3, 0xCA, 0xCB, 0xC6, 0xB8,
-	0xA7, 0x93, 0x7E, 0x67, 0x57, 0x4A, 0x42, 0x42, 0x46, 0x52, 0x5F, 0x72,
-	0x82, 0x93, 0xA1, 0xAA, 0xB1, 0xB0, 0xAD, 0xA5, 0x9B, 0x90, 0x85, 0x7C,
-	0x74, 0x6E, 0x6B, 0x6B, 0x6E, 0x72, 0x76, 0x7B, 0x7F, 0x81, 0x81, 0x82,
-	0x81, 0x80, 0x7F, 0x80, 0x80, 0x82, 0x87, 0x8B, 0x90, 0x97, 0x9C, 0xA0,
-	0x9F, 0x9C, 0x96, 0x8B, 0x81, 0x74, 0x65, 0x5B, 0x52, 0x4D, 0x4B, 0x51,
-	0x5B, 0x69, 0x7D, 0x90, 0xA1, 0xB3, 0xC0, 0xC6, 0xC7, 0xC1, 0xB7, 0xA5,
-	0x92, 0x7A, 0x64, 0x50, 0x42, 0x39, 0x37, 0x3D, 0x47, 0x59, 0x6F, 0x86,
-	0x9C, 0xAF, 0xBE, 0xC5, 0xCA, 0xC4, 0xBB, 0xAB, 0x97, 0x83, 0x6F, 0x5D,
-	0x50, 0x4A, 0x46, 0x47, 0x52, 0x5F, 0x6F, 0x7F, 0x8A, 0x99, 0xA0, 0xA7,
-	0xAA, 0xA6, 0xA0, 0x98, 0x8F, 0x86, 0x7E, 0x7A, 0x76, 0x74, 0x75, 0x76,
-	0x7A, 0x7C, 0x7E, 0x7F, 0x81, 0x7F, 0x7B, 0x7A, 0x76, 0x75, 0x77, 0x7A,
-	0x7E, 0x85, 0x8D, 0x95, 0x9D, 0xA3, 0xA9, 0xA9, 0xA6, 0x9E, 0x94, 0x86,
-	0x76, 0x68, 0x5A, 0x4D, 0x45, 0x45, 0x49, 0x52, 0x63, 0x74, 0x8A, 0x9E,
-	0xB0, 0xC0, 0xC8, 0xCB, 0xC7, 0xBC, 0xAB, 0x99, 0x81, 0x69, 0x58, 0x47,
-	0x3B, 0x38, 0x3C, 0x45, 0x55, 0x69, 0x81, 0x96, 0xAA, 0xB8, 0xC0, 0xC6,
-	0xC2, 0xBB, 0xAC, 0x9A, 0x88, 0x76, 0x66, 0x58, 0x50, 0x4F, 0x50, 0x55,
-	0x60, 0x6E, 0x7C, 0x86, 0x92, 0x9B, 0x9F, 0xA1, 0x9E, 0x9A, 0x94, 0x8D,
-	0x88, 0x82, 0x7E, 0x7C, 0x7D, 0x7D, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7D,
-	0x7B, 0x75, 0x71, 0x6D, 0x6C, 0x6D, 0x71, 0x78, 0x80, 0x8B, 0x96, 0xA1,
-	0xA9, 0xAF, 0xB1, 0xAE, 0xA7, 0x9A, 0x8D, 0x7B, 0x68, 0x59, 0x4D, 0x42,
-	0x40, 0x43, 0x4C, 0x5C, 0x6D, 0x83, 0x9A, 0xAE, 0xBE, 0xC8, 0xCB, 0xC9,
-	0xC1, 0xB1, 0x9F, 0x86, 0x6F, 0x5A, 0x49, 0x3E, 0x39, 0x3B, 0x43, 0x52,
-	0x65, 0x7B, 0x8F, 0xA2, 0xB2, 0xBD, 0xC1, 0xBF, 0xB8, 0xAB, 0x9D, 0x8C,
-	0x7B, 0x6C, 0x5F, 0x57, 0x55, 0x57, 0x5B, 0x63, 0x6F, 0x7A, 0x84, 0x8C,
-	0x92, 0x98, 0x99, 0x96, 0x93, 0x8F, 0x8B, 0x87, 0x84, 0x81, 0x83, 0x82,
-	0x84, 0x87, 0x88, 0x87, 0x83, 0x80, 0x7C, 0x75, 0x6E, 0x69, 0x64, 0x62,
-	0x64, 0x69, 0x71, 0x7D, 0x88, 0x96, 0xA3, 0xAF, 0xB7, 0xBB, 0xB7, 0xB0,
-	0xA5, 0x94, 0x80, 0x6F, 0x5C, 0x4C, 0x41, 0x3C, 0x3D, 0x44, 0x53, 0x66,
-	0x7E, 0x94, 0xA8, 0xBB, 0xC6, 0xCE, 0xCC, 0xC4, 0xB5, 0xA2, 0x8D, 0x77,
-	0x60, 0x4F, 0x43, 0x3D, 0x3C, 0x42, 0x4F, 0x62, 0x77, 0x89, 0x9C, 0xAB,
-	0xB6, 0xBB, 0xBA, 0xB6, 0xAA, 0x9D, 0x90, 0x80, 0x74, 0x68, 0x60, 0x5D,
-	0x5C, 0x61, 0x66, 0x71, 0x79, 0x80, 0x87, 0x8C, 0x8F, 0x8E, 0x8D, 0x8C,
-	0x88, 0x86, 0x86, 0x85, 0x87, 0x89, 0x8B, 0x8F, 0x90, 0x90, 0x8F, 0x8B,
-	0x85, 0x7E, 0x76, 0x6C, 0x63, 0x5D, 0x5A, 0x5B, 0x60, 0x69, 0x75, 0x85,
-	0x95, 0xA4, 0xB2, 0xBB, 0xC0, 0xBF, 0xB8, 0xAD, 0x9C, 0x88, 0x73, 0x5F,
-	0x4F, 0x40, 0x3B, 0x3A, 0x40, 0x4D, 0x60, 0x78, 0x8D, 0xA4, 0xB6, 0xC5,
-	0xCB, 0xCA, 0xC5, 0xB9, 0xA8, 0x93, 0x7E, 0x67, 0x56, 0x49, 0x40, 0x40,
-	0x46, 0x50, 0x5F, 0x72, 0x83, 0x95, 0xA3, 0xAE, 0xB5, 0xB5, 0xB1, 0xA8,
-	0x9C, 0x90, 0x83, 0x7A, 0x70, 0x69, 0x66, 0x65, 0x68, 0x6D, 0x73, 0x79,
-	0x7F, 0x82, 0x85, 0x86, 0x86, 0x84, 0x84, 0x82, 0x81, 0x82, 0x87, 0x8A,
-	0x8D, 0x92, 0x97, 0x99, 0x99, 0x97, 0x93, 0x88, 0x81, 0x75, 0x69, 0x5F,
-	0x55, 0x50, 0x51, 0x55, 0x60, 0x6C, 0x7E, 0x90, 0xA1, 0xB1, 0xBC, 0xC4,
-	0xC6, 0xBF, 0xB4, 0xA3, 0x8F, 0x7A, 0x63, 0x50, 0x42, 0x3A, 0x37, 0x3D,
-	0x49, 0x5A, 0x71, 0x87, 0xA0, 0xB2, 0xC1, 0xC9, 0xCA, 0xC8, 0xBC, 0xAB,
-	0x97, 0x82, 0x6E, 0x5C, 0x4E, 0x47, 0x44, 0x48, 0x51, 0x5E, 0x71, 0x80,
-	0x8F, 0x9B, 0xA7, 0xAC, 0xAD, 0xAB, 0xA4, 0x9C, 0x91, 0x86, 0x7D, 0x77,
-	0x70, 0x70, 0x6F, 0x72, 0x75, 0x78, 0x7D, 0x7F, 0x81, 0x81, 0x80, 0x7F,
-	0x7D, 0x7C, 0x7B, 0x7E, 0x7F, 0x84, 0x8D, 0x93, 0x99, 0x9E, 0xA3, 0xA4,
-	0xA1, 0x9A, 0x8E, 0x83, 0x76, 0x67, 0x5B, 0x51, 0x4A, 0x48, 0x4D, 0x55,
-	0x64, 0x77, 0x8A, 0x9E, 0xB1, 0xBD, 0xC6, 0xC9, 0xC4, 0xBB, 0xA9, 0x96,
-	0x7F, 0x68, 0x55, 0x45, 0x3B, 0x37, 0x3B, 0x46, 0x56, 0x6B, 0x81, 0x98,
-	0xAC, 0xBC, 0xC5, 0xC9, 0xC4, 0xBC, 0xAD, 0x9B, 0x88, 0x74, 0x62, 0x56,
-	0x4D, 0x49, 0x4B, 0x53, 0x5D, 0x6D, 0x7C, 0x88, 0x95, 0x9E, 0xA4, 0xA5,
-	0xA3, 0x9F, 0x97, 0x91, 0x88, 0x82, 0x7D, 0x79, 0x77, 0x7A, 0x7A, 0x7B,
-	0x7E, 0x7F, 0x80, 0x7E, 0x7D, 0x7A, 0x75, 0x73, 0x72, 0x72, 0x76, 0x7C,
-	0x82, 0x8A, 0x95, 0x9D, 0xA5, 0xAA, 0xAC, 0xAA, 0xA3, 0x98, 0x89, 0x7B,
-	0x68, 0x59, 0x4E, 0x47, 0x42, 0x46, 0x4E, 0x5E, 0x70, 0x84, 0x9A, 0xAC,
-	0xBD, 0xC8, 0xCC, 0xC9, 0xC0, 0xB0, 0x9C, 0x85, 0x6F, 0x59, 0x47, 0x3D,
-	0x38, 0x3A, 0x43, 0x52, 0x65, 0x7B, 0x91, 0xA6, 0xB4, 0xBE, 0xC3, 0xC3,
-	0xBB, 0xAE, 0x9E, 0x8B, 0x7B, 0x6B, 0x5D, 0x55, 0x51, 0x51, 0x58, 0x61,
-	0x6D, 0x7A, 0x84, 0x8E, 0x95, 0x9B, 0x9D, 0x9C, 0x9A, 0x93, 0x8E, 0x88,
-	0x83, 0x80, 0x80, 0x80, 0x80, 0x82, 0x83, 0x84, 0x84, 0x80, 0x7F, 0x79,
-	0x73, 0x6F, 0x6B, 0x69, 0x6A, 0x6D, 0x75, 0x7F, 0x89, 0x96, 0xA0, 0xAC,
-	0xB1, 0xB5, 0xB4, 0xAB, 0x9F, 0x91, 0x80, 0x6C, 0x5B, 0x4C, 0x44, 0x3E,
-	0x40, 0x47, 0x53, 0x68, 0x7E, 0x93, 0xAA, 0xBB, 0xC7, 0xCC, 0xCA, 0xC5,
-	0xB5, 0xA2, 0x8E, 0x75, 0x5F, 0x4E, 0x3F, 0x3A, 0x3B, 0x42, 0x4F, 0x61,
-	0x76, 0x8B, 0x9D, 0xAD, 0xB9, 0xBF, 0xBE, 0xB7, 0xAD, 0xA0, 0x8F, 0x7F,
-	0x71, 0x66, 0x5D, 0x59, 0x58, 0x5F, 0x65, 0x6E, 0x79, 0x80, 0x89, 0x8F,
-	0x93, 0x94, 0x92, 0x90, 0x8D, 0x8A, 0x86, 0x85, 0x84, 0x84, 0x87, 0x89,
-	0x8A, 0x8A, 0x8A, 0x87, 0x81, 0x7E, 0x76, 0x6D, 0x67, 0x62, 0x5F, 0x60,
-	0x63, 0x6E, 0x78, 0x86, 0x94, 0xA2, 0xAE, 0xB8, 0xBE, 0xBB, 0xB4, 0xA8,
-	0x99, 0x86, 0x72, 0x5E, 0x4E, 0x41, 0x3A, 0x3B, 0x41, 0x4F, 0x61, 0x78,
-	0x8E, 0xA3, 0xB8, 0xC5, 0xCC, 0xCB, 0xC5, 0xB9, 0xA7, 0x92, 0x7B, 0x66,
-	0x51, 0x46, 0x3E, 0x3E, 0x43, 0x4E, 0x5E, 0x72, 0x85, 0x98, 0xA6, 0xB3,
-	0xB8, 0xBA, 0xB4, 0xAB, 0x9F, 0x92, 0x82, 0x75, 0x6D, 0x66, 0x60, 0x60,
-	0x63, 0x69, 0x71, 0x78, 0x7E, 0x84, 0x88, 0x8B, 0x8A, 0x8A, 0x88, 0x86,
-	0x86, 0x83, 0x85, 0x88, 0x8A, 0x8D, 0x92, 0x94, 0x96, 0x93, 0x8D, 0x86,
-	0x7F, 0x76, 0x6B, 0x60, 0x59, 0x56, 0x56, 0x5B, 0x64, 0x6F, 0x80, 0x91,
-	0xA2, 0xB0, 0xBA, 0xC2, 0xC2, 0xBC, 0xB0, 0xA0, 0x8C, 0x78, 0x63, 0x4F,
-	0x43, 0x3A, 0x38, 0x3E, 0x4A, 0x5B, 0x70, 0x88, 0xA0, 0xB1, 0xC1, 0xCA,
-	0xCB, 0xC7, 0xBC, 0xAA, 0x96, 0x81, 0x6D, 0x5A, 0x4C, 0x44, 0x40, 0x46,
-	0x4F, 0x5D, 0x6E, 0x80, 0x8F, 0x9F, 0xAB, 0xB0, 0xB2, 0xAE, 0xA7, 0x9E,
-	0x92, 0x84, 0x7B, 0x74, 0x6D, 0x6A, 0x69, 0x6B, 0x6F, 0x75, 0x7B, 0x7E,
-	0x81, 0x83, 0x83, 0x84, 0x81, 0x80, 0x80, 0x80, 0x81, 0x85, 0x8B, 0x90,
-	0x95, 0x9B, 0x9E, 0xA0, 0x9C, 0x95, 0x8E, 0x84, 0x77, 0x6A, 0x5E, 0x54,
-	0x4F, 0x4C, 0x50, 0x5A, 0x68, 0x79, 0x8B, 0x9E, 0xB0, 0xBC, 0xC4, 0xC7,
-	0xC3, 0xB8, 0xA7, 0x95, 0x7F, 0x68, 0x54, 0x44, 0x3A, 0x36, 0x3B, 0x45,
-	0x56, 0x6C, 0x81, 0x98, 0xAB, 0xBE, 0xC6, 0xCA, 0xC7, 0xBD, 0xAE, 0x9A,
-	0x86, 0x72, 0x60, 0x53, 0x49, 0x46, 0x47, 0x4F, 0x5E, 0x6C, 0x7C, 0x8A,
-	0x98, 0xA2, 0xA9, 0xA9, 0xA9, 0xA3, 0x9A, 0x91, 0x87, 0x80, 0x79, 0x75,
-	0x73, 0x72, 0x74, 0x77, 0x7A, 0x7D, 0x7F, 0x80, 0x80, 0x7E, 0x7A, 0x79,
-	0x78, 0x79, 0x7B, 0x7C, 0x83, 0x8B, 0x92, 0x9B, 0xA1, 0xA7, 0xA7, 0xA5,
-	0x9E, 0x94, 0x88, 0x79, 0x6A, 0x5D, 0x50, 0x49, 0x45, 0x48, 0x52, 0x5F,
-	0x71, 0x86, 0x9C, 0xAC, 0xBD, 0xC6, 0xCA, 0xC9, 0xBE, 0xB0, 0x9B, 0x84,
-	0x6E, 0x59, 0x49, 0x3C, 0x38, 0x39, 0x43, 0x51, 0x65, 0x7D, 0x91, 0xA7,
-	0xB7, 0xC2, 0xC7, 0xC6, 0xBD, 0xAF, 0x9E, 0x8C, 0x7A, 0x68, 0x5B, 0x4F,
-	0x4B, 0x4E, 0x56, 0x5D, 0x6B, 0x79, 0x86, 0x92, 0x9A, 0x9F, 0xA3, 0xA1,
-	0x9D, 0x97, 0x8F, 0x88, 0x83, 0x80, 0x7B, 0x78, 0x7B, 0x7C, 0x7E, 0x7F,
-	0x80, 0x80, 0x7E, 0x7D, 0x77, 0x73, 0x70, 0x6D, 0x6E, 0x71, 0x76, 0x7F,
-	0x89, 0x94, 0x9D, 0xA7, 0xAD, 0xB0, 0xAE, 0xA8, 0x9D, 0x8E, 0x7F, 0x6D,
-	0x5C, 0x4F, 0x45, 0x41, 0x43, 0x4A, 0x58, 0x6B, 0x7F, 0x95, 0xAB, 0xBC,
-	0xC7, 0xCC, 0xCA, 0xC4, 0xB5, 0xA1, 0x8B, 0x74, 0x5F, 0x4D, 0x3F, 0x39,
-	0x39, 0x41, 0x4E, 0x61, 0x77, 0x8C, 0x9F, 0xAF, 0xBB, 0xC1, 0xC1, 0xBB,
-	0xAF, 0xA2, 0x90, 0x7E, 0x6E, 0x61, 0x5A, 0x52, 0x54, 0x58, 0x60, 0x6C,
-	0x76, 0x82, 0x8A, 0x92, 0x96, 0x99, 0x98, 0x95, 0x91, 0x8C, 0x87, 0x84,
-	0x82, 0x81, 0x82, 0x83, 0x86, 0x86, 0x86, 0x83, 0x80, 0x7D, 0x78, 0x71,
-	0x6B, 0x68, 0x63, 0x65, 0x69, 0x72, 0x7C, 0x86, 0x94, 0x9F, 0xAC, 0xB5,
-	0xB9, 0xB8, 0xB2, 0xA6, 0x96, 0x85, 0x72, 0x5F, 0x50, 0x43, 0x3C, 0x3D,
-	0x44, 0x51, 0x63, 0x79, 0x8F, 0xA5, 0xB8, 0xC4, 0xCC, 0xCC, 0xC6, 0xB9,
-	0xA5, 0x8F, 0x78, 0x65, 0x52, 0x44, 0x3D, 0x3A, 0x42, 0x4D, 0x5D, 0x73,
-	0x86, 0x99, 0xA9, 0xB5, 0xBC, 0xBD, 0xB8, 0xAE, 0xA1, 0x92, 0x83, 0x76,
-	0x69, 0x61, 0x5C, 0x5B, 0x5F, 0x66, 0x6E, 0x77, 0x81, 0x86, 0x8B, 0x90,
-	0x91, 0x90, 0x8D, 0x8B, 0x88, 0x87, 0x85, 0x85, 0x86, 0x88, 0x8C, 0x8E,
-	0x8E, 0x8F, 0x89, 0x83, 0x7F, 0x77, 0x6F, 0x66, 0x5F, 0x5A, 0x5C, 0x60,
-	0x69, 0x74, 0x83, 0x93, 0xA0, 0xAF, 0xB9, 0xBE, 0xC0, 0xBA, 0xAF, 0x9F,
-	0x8B, 0x77, 0x63, 0x51, 0x43, 0x3B, 0x3A, 0x3F, 0x4C, 0x5A, 0x71, 0x89,
-	0x9E, 0xB3, 0xC2, 0xCB, 0xCD, 0xC7, 0xBC, 0xAA, 0x96, 0x80, 0x6A, 0x57,
-	0x49, 0x40, 0x3E, 0x42, 0x4D, 0x5A, 0x6E, 0x80, 0x91, 0xA1, 0xAE, 0xB4,
-	0xB6, 0xB3, 0xAC, 0xA1, 0x94, 0x87, 0x7C, 0x70, 0x68, 0x65, 0x62, 0x67,
-	0x6B, 0x72, 0x79, 0x7F, 0x82, 0x86, 0x89, 0x87, 0x87, 0x84, 0x83, 0x83,
-	0x81, 0x85, 0x88, 0x8C, 0x92, 0x95, 0x98, 0x99, 0x97, 0x92, 0x8B, 0x80,
-	0x77, 0x6C, 0x61, 0x58, 0x55, 0x53, 0x57, 0x5F, 0x6C, 0x7B, 0x8D, 0x9F,
-	0xB0, 0xBB, 0xC3, 0xC5, 0xC1, 0xB7, 0xA6, 0x93, 0x7D, 0x68, 0x54, 0x44,
-	0x3B, 0x37, 0x3C, 0x46, 0x56, 0x6B, 0x82, 0x9A, 0xAE, 0xBE, 0xC9, 0xCA,
-	0xC8, 0xBE, 0xAD, 0x9D, 0x85, 0x71, 0x5F, 0x4F, 0x46, 0x43, 0x45, 0x4F,
-	0x5B, 0x6A, 0x7B, 0x8C, 0x9A, 0xA5, 0xAD, 0xB0, 0xAD, 0xA8, 0x9E, 0x92,
-	0x88, 0x7F, 0x75, 0x70, 0x6D, 0x6D, 0x6E, 0x72, 0x76, 0x7B, 0x7F, 0x80,
-	0x81, 0x80, 0x80, 0x80, 0x80, 0x7E, 0x80, 0x80, 0x84, 0x8A, 0x90, 0x97,
-	0x9D, 0xA1, 0xA2, 0xA1, 0x9A, 0x90, 0x86, 0x79, 0x6B, 0x5F, 0x52, 0x4D,
-	0x4A, 0x4C, 0x54, 0x62, 0x73, 0x86, 0x9A, 0xAC, 0xBB, 0xC5, 0xC8, 0xC6,
-	0xBC, 0xAC, 0x99, 0x83, 0x6E, 0x58, 0x47, 0x3A, 0x35, 0x3A, 0x44, 0x53,
-	0x66, 0x7D, 0x94, 0xAA, 0xBA, 0xC4, 0xC8, 0xC7, 0xBF, 0xB1, 0x9F, 0x8A,
-	0x78, 0x66, 0x58, 0x4C, 0x47, 0x4B, 0x51, 0x5B, 0x6A, 0x79, 0x86, 0x95,
-	0x9C, 0xA4, 0xA7, 0xA5, 0xA2, 0x9A, 0x94, 0x8A, 0x81, 0x7D, 0x78, 0x74,
-	0x76, 0x77, 0x79, 0x7C, 0x7F, 0x7F, 0x80, 0x7E, 0x7A, 0x77, 0x75, 0x72,
-	0x73, 0x75, 0x7A, 0x81, 0x89, 0x92, 0x9B, 0xA1, 0xA8, 0xAA, 0xA8, 0xA2,
-	0x99, 0x8B, 0x7E, 0x6E, 0x5E, 0x51, 0x47, 0x45, 0x45, 0x4D, 0x5A, 0x6C,
-	0x81, 0x96, 0xAA, 0xBA, 0xC5, 0xCA, 0xC9, 0xC2, 0xB2, 0x9F, 0x89, 0x73,
-	0x5E, 0x49, 0x3E, 0x3A, 0x39, 0x3F, 0x50, 0x63, 0x78, 0x8D, 0xA2, 0xB4,
-	0xC0, 0xC7, 0xC4, 0xBF, 0xB3, 0xA3, 0x90, 0x7D, 0x6D, 0x5E, 0x54, 0x51,
-	0x4F, 0x55, 0x5E, 0x6A, 0x77, 0x81, 0x8D, 0x96, 0x9D, 0x9F, 0x9D, 0x9A,
-	0x96, 0x90, 0x89, 0x83, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x80, 0x81,
-	0x80, 0x7F, 0x7B, 0x75, 0x71, 0x6C, 0x6A, 0x6B, 0x6D, 0x73, 0x7D, 0x88,
-	0x93, 0x9E, 0xA7, 0xB1, 0xB4, 0xB2, 0xAC, 0xA2, 0x94, 0x82, 0x71, 0x60,
-	0x50, 0x45, 0x3E, 0x3F, 0x46, 0x51, 0x65, 0x7B, 0x90, 0xA7, 0xB8, 0xC5,
-	0xCB, 0xCA, 0xC5, 0xB8, 0xA6, 0x90, 0x79, 0x63, 0x50, 0x41, 0x3A, 0x3A,
-	0x40, 0x4B, 0x5D, 0x72, 0x86, 0x9A, 0xAB, 0xB8, 0xBF, 0xC0, 0xBC, 0xB1,
-	0xA3, 0x93, 0x82, 0x73, 0x66, 0x5C, 0x57, 0x56, 0x5A, 0x61, 0x6C, 0x75,
-	0x80, 0x88, 0x8E, 0x92, 0x96, 0x95, 0x92, 0x8E, 0x8B, 0x88, 0x85, 0x83,
-	0x83, 0x85, 0x86, 0x87, 0x8A, 0x88, 0x84, 0x82, 0x7E, 0x7A, 0x71, 0x69,
-	0x64, 0x60, 0x5E, 0x65, 0x6C, 0x76, 0x84, 0x91, 0xA0, 0xAD, 0xB6, 0xBC,
-	0xBB, 0xB4, 0xAA, 0x9D, 0x8B, 0x77, 0x63, 0x51, 0x45, 0x3D, 0x3B, 0x41,
-	0x4C, 0x5D, 0x74, 0x89, 0xA1, 0xB5, 0xC3, 0xCA, 0xCC, 0xC8, 0xBC, 0xAB,
-	0x96, 0x7F, 0x68, 0x56, 0x46, 0x3E, 0x3B, 0x40, 0x4B, 0x5B, 0x6D, 0x82,
-	0x93, 0xA5, 0xB1, 0xB9, 0xBA, 0xB7, 0xB0, 0xA2, 0x95, 0x85, 0x78, 0x6E,
-	0x64, 0x60, 0x5F, 0x62, 0x68, 0x70, 0x77, 0x7F, 0x84, 0x8B, 0x8C, 0x8E,
-	0x8D, 0x8B, 0x89, 0x87, 0x86, 0x86, 0x88, 0x89, 0x8B, 0x8F, 0x91, 0x92,
-	0x91, 0x8D, 0x87, 0x80, 0x78, 0x6F, 0x64, 0x5C, 0x59, 0x57, 0x5B, 0x63,
-	0x6F, 0x7D, 0x8D, 0x9E, 0xAD, 0xB9, 0xC0, 0xC1, 0xBD, 0xB3, 0xA4, 0x91,
-	0x7C, 0x67, 0x53, 0x43, 0x3B, 0x37, 0x3B, 0x47, 0x58, 0x6D, 0x84, 0x9B,
-	0xB0, 0xBF, 0xC8, 0xCC, 0xC8, 0xBE, 0xAF, 0x9B, 0x85, 0x70, 0x5C, 0x4E,
-	0x43, 0x3F, 0x43, 0x4B, 0x58, 0x6A, 0x7D, 0x8E, 0x9D, 0xA9, 0xB2, 0xB5,
-	0xB2, 0xAA, 0xA1, 0x95, 0x88, 0x7E, 0x74, 0x6E, 0x68, 0x69, 0x69, 0x6D,
-	0x74, 0x78, 0x7E, 0x81, 0x82, 0x85, 0x83, 0x82, 0x82, 0x80, 0x80, 0x81,
-	0x84, 0x89, 0x8D, 0x92, 0x98, 0x9C, 0x9B, 0x9C, 0x96, 0x8E, 0x84, 0x78,
-	0x6C, 0x62, 0x57, 0x51, 0x50, 0x52, 0x5B, 0x66, 0x77, 0x87, 0x9A, 0xAC,
-	0xBB, 0xC3, 0xC7, 0xC3, 0xB9, 0xAC, 0x97, 0x82, 0x6C, 0x56, 0x47, 0x3B,
-	0x37, 0x39, 0x43, 0x52, 0x67, 0x7F, 0x94, 0xA9, 0xBA, 0xC5, 0xCB, 0xC8,
-	0xBF, 0xB1, 0x9F, 0x8A, 0x77, 0x62, 0x54, 0x49, 0x45, 0x45, 0x4E, 0x5A,
-	0x68, 0x79, 0x89, 0x97, 0xA0, 0xA9, 0xAC, 0xAB, 0xA6, 0x9E, 0x94, 0x8A,
-	0x81, 0x79, 0x74, 0x71, 0x70, 0x71, 0x74, 0x78, 0x7C, 0x7D, 0x80, 0x80,
-	0x80, 0x7F, 0x7A, 0x7A, 0x7B, 0x7B, 0x7E, 0x83, 0x88, 0x90, 0x98, 0x9E,
-	0xA3, 0xA4, 0xA4, 0x9F, 0x95, 0x89, 0x7B, 0x6E, 0x60, 0x53, 0x4A, 0x46,
-	0x48, 0x51, 0x5E, 0x70, 0x82, 0x97, 0xAA, 0xBB, 0xC5, 0xC8, 0xC9, 0xBF,
-	0xB2, 0x9F, 0x88, 0x71, 0x5C, 0x49, 0x3E, 0x38, 0x38, 0x41, 0x4E, 0x63,
-	0x78, 0x8F, 0xA4, 0xB4, 0xC1, 0xC7, 0xC7, 0xC0, 0xB2, 0xA2, 0x90, 0x7B,
-	0x69, 0x5B, 0x51, 0x4C, 0x4B, 0x51, 0x59, 0x68, 0x77, 0x85, 0x91, 0x9A,
-	0xA0, 0xA3, 0xA4, 0xA0, 0x98, 0x92, 0x8A, 0x82, 0x7E, 0x7A, 0x79, 0x7A,
-	0x7A, 0x7D, 0x7F, 0x81, 0x80, 0x7F, 0x7D, 0x78, 0x74, 0x73, 0x70, 0x72,
-	0x71, 0x76, 0x7F, 0x87, 0x92, 0x9B, 0xA5, 0xAB, 0xAE, 0xAE, 0xA7, 0x9E,
-	0x91, 0x81, 0x70, 0x60, 0x50, 0x48, 0x42, 0x42, 0x48, 0x56, 0x67, 0x7B,
-	0x92, 0xA7, 0xB6, 0xC4, 0xCB, 0xCA, 0xC3, 0xB6, 0xA3, 0x8E, 0x78, 0x61,
-	0x4E, 0x40, 0x38, 0x38, 0x3E, 0x4B, 0x5C, 0x71, 0x89, 0x9B, 0xAE, 0xBB,
-	0xC2, 0xC1, 0xBD, 0xB3, 0xA3, 0x93, 0x80, 0x71, 0x63, 0x5A, 0x52, 0x53,
-	0x56, 0x5E, 0x69, 0x75, 0x7F, 0x8A, 0x92, 0x98, 0x9A, 0x9C, 0x99, 0x94,
-	0x8D, 0x89, 0x85, 0x81, 0x7F, 0x80, 0x82, 0x82, 0x82, 0x85, 0x83, 0x81,
-	0x7E, 0x79, 0x74, 0x6E, 0x69, 0x66, 0x66, 0x6A, 0x70, 0x79, 0x82, 0x90,
-	0x9E, 0xAA, 0xB2, 0xB9, 0xB6, 0xB1, 0xA8, 0x99, 0x87, 0x76, 0x63, 0x53,
-	0x46, 0x40, 0x3E, 0x43, 0x4E, 0x5F, 0x74, 0x8C, 0xA3, 0xB5, 0xC3, 0xCC,
-	0xCB, 0xC7, 0xBB, 0xA9, 0x94, 0x7E, 0x67, 0x54, 0x45, 0x3B, 0x3B, 0x3F,
-	0x4A, 0x59, 0x6E, 0x82, 0x96, 0xA6, 0xB4, 0xBC, 0xBE, 0xBA, 0xB2, 0xA4,
-	0x95, 0x85, 0x77, 0x6A, 0x61, 0x5C, 0x5B, 0x5E, 0x64, 0x6B, 0x75, 0x7E,
-	0x85, 0x8C, 0x90, 0x93, 0x93, 0x8F, 0x8D, 0x8A, 0x86, 0x86, 0x83, 0x84,
-	0x86, 0x89, 0x8C, 0x8E, 0x8B, 0x89, 0x85, 0x7E, 0x79, 0x71, 0x69, 0x62,
-	0x5D, 0x5D, 0x60, 0x68, 0x72, 0x7F, 0x8E, 0x9E, 0xAD, 0xB7, 0xBD, 0xBE,
-	0xBA, 0xB0, 0xA1, 0x90, 0x7B, 0x66, 0x56, 0x45, 0x3C, 0x3B, 0x3C, 0x49,
-	0x59, 0x6E, 0x85, 0x9B, 0xB0, 0xC0, 0xCB, 0xCD, 0xC9, 0xBE, 0xAD, 0x9A,
-	0x83, 0x6D, 0x59, 0x4B, 0x40, 0x3D, 0x3F, 0x4A, 0x58, 0x69, 0x7E, 0x8F,
-	0xA0, 0xAD, 0xB5, 0xB7, 0xB5, 0xAF, 0xA3, 0x95, 0x88, 0x7D, 0x72, 0x69,
-	0x64, 0x63, 0x64, 0x69, 0x6F, 0x78, 0x7D, 0x83, 0x87, 0x89, 0x88, 0x89,
-	0x87, 0x84, 0x85, 0x84, 0x85, 0x88, 0x8A, 0x8E, 0x92, 0x96, 0x96, 0x95,
-	0x91, 0x8B, 0x83, 0x78, 0x6E, 0x65, 0x5D, 0x56, 0x54, 0x58, 0x5E, 0x6B,
-	0x79, 0x89, 0x9B, 0xAB, 0xB9, 0xC1, 0xC4, 0xC1, 0xB6, 0xA9, 0x96, 0x80,
-	0x6B, 0x58, 0x47, 0x3C, 0x37, 0x3B, 0x43, 0x54, 0x68, 0x80, 0x96, 0xAD,
-	0xBD, 0xC7, 0xCC, 0xCA, 0xC0, 0xB2, 0x9F, 0x8B, 0x74, 0x62, 0x51, 0x47,
-	0x42, 0x43, 0x4A, 0x58, 0x68, 0x79, 0x89, 0x97, 0xA5, 0xAF, 0xB2, 0xB0,
-	0xA9, 0xA1, 0x97, 0x8B, 0x80, 0x78, 0x72, 0x6C, 0x6B, 0x6C, 0x6E, 0x75,
-	0x79, 0x7D, 0x80, 0x82, 0x82, 0x81, 0x81, 0x7E, 0x7D, 0x7F, 0x80, 0x82,
-	0x89, 0x8E, 0x94, 0x9A, 0x9E, 0xA0, 0x9E, 0x9B, 0x92, 0x86, 0x7C, 0x6E,
-	0x61, 0x56, 0x4E, 0x4B, 0x4D, 0x55, 0x61, 0x71, 0x84, 0x97, 0xA9, 0xBA,
-	0xC3, 0xC7, 0xC5, 0xBE, 0xB0, 0x9D, 0x88, 0x70, 0x5C, 0x4B, 0x3D, 0x37,
-	0x39, 0x40, 0x4D, 0x62, 0x79, 0x8E, 0xA4, 0xB6, 0xC3, 0xC9, 0xC9, 0xC2,
-	0xB4, 0xA3, 0x90, 0x7D, 0x68, 0x58, 0x4D, 0x47, 0x48, 0x4E, 0x59, 0x67,
-	0x76, 0x82, 0x92, 0x9D, 0xA5, 0xA8, 0xA8, 0xA4, 0x9D, 0x94, 0x8B, 0x83,
-	0x7D, 0x77, 0x75, 0x73, 0x74, 0x77, 0x7A, 0x7C, 0x7E, 0x7E, 0x7E, 0x7F,
-	0x7B, 0x78, 0x76, 0x76, 0x77, 0x7B, 0x80, 0x87, 0x8F, 0x98, 0xA1, 0xA6,
-	0xA8, 0xA7, 0xA3, 0x9A, 0x8D, 0x7E, 0x71, 0x60, 0x53, 0x49, 0x45, 0x46,
-	0x4D, 0x58, 0x69, 0x7D, 0x92, 0xA5, 0xB7, 0xC4, 0xC9, 0xCA, 0xC1, 0xB5,
-	0xA5, 0x8E, 0x77, 0x5F, 0x4D, 0x41, 0x39, 0x38, 0x3F, 0x4B, 0x5E, 0x73,
-	0x89, 0x9E, 0xB0, 0xBF, 0xC5, 0xC5, 0xC0, 0xB4, 0xA5, 0x93, 0x81, 0x6E,
-	0x60, 0x55, 0x4F, 0x4E, 0x51, 0x5B, 0x68, 0x74, 0x81, 0x8C, 0x97, 0x9C,
-	0xA0, 0xA0, 0x9D, 0x98, 0x91, 0x8C, 0x84, 0x80, 0x7E, 0x7C, 0x7B, 0x7D,
-	0x80, 0x80, 0x7F, 0x80, 0x80, 0x7B, 0x77, 0x73, 0x6F, 0x6D, 0x6C, 0x6F,
-	0x73, 0x7A, 0x83, 0x8F, 0x9B, 0xA5, 0xAD, 0xB1, 0xB2, 0xAD, 0xA3, 0x95,
-	0x84, 0x75, 0x63, 0x52, 0x49, 0x41, 0x40, 0x46, 0x50, 0x62, 0x77, 0x8C,
-	0xA2, 0xB5, 0xC4, 0xCC, 0xCC, 0xC6, 0xBA, 0xAC, 0x94, 0x7C, 0x66, 0x54,
-	0x43, 0x3A, 0x3A, 0x3E, 0x49, 0x59, 0x6D, 0x83, 0x98, 0xAB, 0xB8, 0xC0,
-	0xC1, 0xBD, 0xB4, 0xA6, 0x96, 0x84, 0x75, 0x68, 0x5D, 0x56, 0x57, 0x58,
-	0x5F, 0x69, 0x75, 0x7E, 0x87, 0x8F, 0x94, 0x98, 0x97, 0x94, 0x90, 0x8D,
-	0x89, 0x87, 0x84, 0x81, 0x84, 0x85, 0x86, 0x89, 0x87, 0x85, 0x82, 0x7E,
-	0x79, 0x73, 0x6C, 0x67, 0x63, 0x62, 0x65, 0x6B, 0x76, 0x81, 0x90, 0x9C,
-	0xA9, 0xB3, 0xB8, 0xBA, 0xB6, 0xAD, 0x9E, 0x8D, 0x79, 0x66, 0x55, 0x47,
-	0x3F, 0x3B, 0x40, 0x4B, 0x5B, 0x70, 0x85, 0x9C, 0xB2, 0xC1, 0xCA, 0xCC,
-	0xCA, 0xBF, 0xAE, 0x9A, 0x84, 0x6E, 0x58, 0x49, 0x40, 0x3A, 0x3E, 0x49,
-	0x58, 0x69, 0x7F, 0x92, 0xA3, 0xB1, 0xBA, 0xBB, 0xBA, 0xB2, 0xA5, 0x98,
-	0x89, 0x7C, 0x6F, 0x66, 0x5F, 0x5D, 0x60, 0x64, 0x6C, 0x75, 0x7C, 0x83,
-	0x89, 0x8D, 0x90, 0x90, 0x8E, 0x8B, 0x88, 0x86, 0x86, 0x86, 0x86, 0x89,
-	0x8D, 0x8F, 0x90, 0x90, 0x8D, 0x86, 0x81, 0x7A, 0x70, 0x67, 0x5F, 0x5C,
-	0x59, 0x5C, 0x63, 0x6D, 0x7C, 0x8B, 0x9B, 0xAA, 0xB7, 0xBD, 0xBF, 0xBC,
-	0xB4, 0xA6, 0x94, 0x80, 0x6A, 0x57, 0x48, 0x3D, 0x39, 0x3C, 0x46, 0x54,
-	0x69, 0x80, 0x97, 0xAD, 0xBE, 0xCA, 0xCF, 0xCB, 0xC1, 0xB2, 0x9F, 0x89,
-	0x73, 0x5E, 0x4E, 0x43, 0x3F, 0x41, 0x48, 0x54, 0x66, 0x7A, 0x8B, 0x9B,
-	0xAA, 0xB1, 0xB4, 0xB4, 0xAD, 0xA3, 0x97, 0x8B, 0x80, 0x75, 0x6E, 0x67,
-	0x66, 0x67, 0x6B, 0x71, 0x77, 0x7D, 0x80, 0x85, 0x86, 0x85, 0x86, 0x84,
-	0x84, 0x83, 0x82, 0x84, 0x87, 0x8B, 0x8F, 0x93, 0x98, 0x9B, 0x98, 0x94,
-	0x8E, 0x85, 0x7C, 0x6F, 0x64, 0x5A, 0x55, 0x4F, 0x51, 0x5A, 0x64, 0x73,
-	0x86, 0x97, 0xA8, 0xB6, 0xC1, 0xC5, 0xC3, 0xBB, 0xAD, 0x9A, 0x85, 0x70,
-	0x5B, 0x4A, 0x3E, 0x36, 0x38, 0x42, 0x4F, 0x63, 0x7A, 0x90, 0xA6, 0xB8,
-	0xC4, 0xCA, 0xC9, 0xC2, 0xB5, 0xA4, 0x8F, 0x7A, 0x67, 0x56, 0x4B, 0x44,
-	0x43, 0x4B, 0x57, 0x65, 0x77, 0x87, 0x95, 0xA1, 0xA9, 0xAE, 0xAD, 0xA9,
-	0xA1, 0x97, 0x8D, 0x83, 0x7A, 0x74, 0x70, 0x6F, 0x71, 0x72, 0x76, 0x7A,
-	0x7D, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7D, 0x7C, 0x7C, 0x7E, 0x81, 0x88,
-	0x8E, 0x95, 0x9B, 0x9F, 0xA2, 0xA2, 0x9E, 0x94, 0x8A, 0x7D, 0x70, 0x63,
-	0x55, 0x4D, 0x48, 0x4A, 0x4F, 0x5C, 0x6B, 0x7F, 0x93, 0xA6, 0xB6, 0xC3,
-	0xC7, 0xC8, 0xC0, 0xB2, 0xA1, 0x8C, 0x74, 0x61, 0x4D, 0x3F, 0x39, 0x38,
-	0x3D, 0x4B, 0x5E, 0x75, 0x8A, 0xA1, 0xB3, 0xBF, 0xC8, 0xC9, 0xC4, 0xB7,
-	0xA6, 0x93, 0x80, 0x6C, 0x5E, 0x52, 0x4B, 0x4A, 0x4F, 0x57, 0x64, 0x74,
-	0x82, 0x8E, 0x99, 0xA1, 0xA5, 0xA4, 0xA0, 0x9D, 0x95, 0x8C, 0x86, 0x7F,
-	0x7A, 0x76, 0x77, 0x78, 0x7A, 0x7D, 0x7E, 0x80, 0x7F, 0x7E, 0x7A, 0x77,
-	0x76, 0x72, 0x72, 0x72, 0x78, 0x7E, 0x86, 0x8F, 0x99, 0xA2, 0xA8, 0xAB,
-	0xAB, 0xA6, 0x9E, 0x92, 0x84, 0x74, 0x63, 0x53, 0x4A, 0x43, 0x44, 0x4A,
-	0x53, 0x63, 0x79, 0x8C, 0xA2, 0xB4, 0xC2, 0xC8, 0xCA, 0xC6, 0xB9, 0xA9,
-	0x92, 0x7E, 0x65, 0x51, 0x43, 0x3A, 0x38, 0x3D, 0x49, 0x5A, 0x6D, 0x84,
-	0x9A, 0xAC, 0xBA, 0xC1, 0xC4, 0xC1, 0xB6, 0xA8, 0x96, 0x84, 0x74, 0x64,
-	0x59, 0x52, 0x50, 0x53, 0x5B, 0x66, 0x72, 0x7E, 0x89, 0x92, 0x98, 0x9D,
-	0x9C, 0x99, 0x96, 0x90, 0x8B, 0x85, 0x81, 0x80, 0x80, 0x80, 0x80, 0x82,
-	0x83, 0x82, 0x81, 0x7F, 0x7A, 0x77, 0x71, 0x6B, 0x69, 0x67, 0x69, 0x6E,
-	0x78, 0x82, 0x8E, 0x9A, 0xA7, 0xAF, 0xB5, 0xB5, 0xB1, 0xA7, 0x9B, 0x8B,
-	0x79, 0x67, 0x55, 0x49, 0x41, 0x3E, 0x42, 0x4C, 0x5D, 0x71, 0x87, 0x9F,
-	0xB2, 0xC0, 0xCA, 0xCD, 0xC8, 0xBE, 0xAD, 0x99, 0x82, 0x6C, 0x57, 0x47,
-	0x3E, 0x3B, 0x3C, 0x47, 0x57, 0x69, 0x7F, 0x94, 0xA5, 0xB4, 0xBD, 0xBF,
-	0xBD, 0xB5, 0xA6, 0x99, 0x89, 0x79, 0x6B, 0x62, 0x5B, 0x59, 0x5B, 0x61,
-	0x68, 0x73, 0x7E, 0x84, 0x8C, 0x92, 0x94, 0x94, 0x91, 0x8F, 0x8B, 0x89,
-	0x86, 0x86, 0x85, 0x84, 0x89, 0x87, 0x8A, 0x8B, 0x89, 0x84, 0x80, 0x7B,
-	0x72, 0x6B, 0x64, 0x61, 0x5F, 0x60, 0x68, 0x72, 0x7D, 0x8B, 0x9B, 0xA9,
-	0xB5, 0xBB, 0xBC, 0xB9, 0xB0, 0xA2, 0x92, 0x80, 0x6A, 0x57, 0x4A, 0x40,
-	0x3B, 0x3C, 0x47, 0x55, 0x6A, 0x80, 0x97, 0xAD, 0xBC, 0xC8, 0xCC, 0xCA,
-	0xC1, 0xB2, 0x9E, 0x87, 0x73, 0x5C, 0x4D, 0x42, 0x3D, 0x3E, 0x46, 0x54,
-	0x66, 0x79, 0x8C, 0x9E, 0xAB, 0xB4, 0xB8, 0xB8, 0xB1, 0xA6, 0x9A, 0x8C,
-	0x80, 0x71, 0x69, 0x63, 0x60, 0x62, 0x66, 0x6C, 0x75, 0x7D, 0x82, 0x86,
-	0x89, 0x8C, 0x8B, 0x88, 0x89, 0x86, 0x85, 0x85, 0x86, 0x88, 0x8C, 0x90,
-	0x93, 0x94, 0x94, 0x90, 0x8B, 0x84, 0x7C, 0x72, 0x68, 0x5F, 0x59, 0x56,
-	0x56, 0x5E, 0x69, 0x76, 0x87, 0x98, 0xA7, 0xB5, 0xC0, 0xC3, 0xC1, 0xB8,
-	0xAB, 0x98, 0x83, 0x6F, 0x5A, 0x4A, 0x3D, 0x37, 0x3A, 0x42, 0x50, 0x63,
-	0x79, 0x92, 0xA8, 0xB8, 0xC7, 0xCC, 0xCB, 0xC3, 0xB5, 0xA4, 0x8D, 0x78,
-	0x63, 0x53, 0x47, 0x42, 0x42, 0x48, 0x55, 0x63, 0x75, 0x86, 0x97, 0xA4,
-	0xAD, 0xB1, 0xB1, 0xAD, 0xA4, 0x99, 0x8E, 0x80, 0x78, 0x71, 0x6C, 0x69,
-	0x6A, 0x6D, 0x72, 0x77, 0x7C, 0x80, 0x82, 0x84, 0x84, 0x83, 0x80, 0x7F,
-	0x81, 0x80, 0x82, 0x88, 0x8D, 0x92, 0x96, 0x9C, 0x9E, 0x9E, 0x9A, 0x91,
-	0x89, 0x7F, 0x71, 0x65, 0x5B, 0x52, 0x4D, 0x4E, 0x55, 0x60, 0x6E, 0x7F,
-	0x92, 0xA6, 0xB5, 0xC1, 0xC7, 0xC6, 0xBF, 0xB3, 0xA2, 0x8B, 0x76, 0x5E,
-	0x4F, 0x40, 0x38, 0x38, 0x3E, 0x4B, 0x5D, 0x74, 0x8C, 0xA2, 0xB5, 0xC2,
-	0xC9, 0xC9, 0xC3, 0xB8, 0xA7, 0x91, 0x7F, 0x6B, 0x5A, 0x4E, 0x47, 0x46,
-	0x4B, 0x55, 0x63, 0x72, 0x82, 0x90, 0x9B, 0xA5, 0xAA, 0xAA, 0xA7, 0xA0,
-	0x98, 0x8E, 0x84, 0x7D, 0x77, 0x74, 0x72, 0x72, 0x75, 0x77, 0x7B, 0x7F,
-	0x7E, 0x7F, 0x7E, 0x7D, 0x79, 0x78, 0x78, 0x79, 0x7D, 0x80, 0x86, 0x8D,
-	0x96, 0x9D, 0xA3, 0xA8, 0xA5, 0xA1, 0x9A, 0x8F, 0x81, 0x72, 0x63, 0x56,
-	0x4D, 0x46, 0x46, 0x4C, 0x56, 0x65, 0x7B, 0x8E, 0xA2, 0xB4, 0xC2, 0xCA,
-	0xCA, 0xC5, 0xB8, 0xA8, 0x91, 0x7B, 0x64, 0x51, 0x43, 0x3B, 0x38, 0x3D,
-	0x49, 0x59, 0x6F, 0x86, 0x9A, 0xAE, 0xBD, 0xC5, 0xC6, 0xC2, 0xB7, 0xA9,
-	0x97, 0x84, 0x71, 0x61, 0x55, 0x4E, 0x4C, 0x51, 0x57, 0x65, 0x70, 0x80,
-	0x89, 0x97, 0x9C, 0xA0, 0xA2, 0xA0, 0x9C, 0x90, 0x93, 0x7C, 0x92, 0x4E,
-	0x3E
-};
@@ -0,0 +1,220 @@
+#include <string.h>
+#include <pthread.h>
+#include "hdlc.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* Both FCSes are bit reversed CRCs, so the tables index on the low byte. */
+static uint16_t fcs16Table[8][256];
+static uint32_t fcs32Table[8][256];
+static pthread_once_t tablesOnce = PTHREAD_ONCE_INIT;
+
+static void make_tables(void) {
+    for (int i = 0; i < 256; i++) {
+        uint16_t f16 = i;
+        uint32_t f32 = i;
+        for (int bit = 0; bit < 8; bit++) {
+            f16 = (f16 >> 1) ^ (f16 & 1 ? 0x8408 : 0);
+            f32 = (f32 >> 1) ^ (f32 & 1 ? 0xedb88320 : 0);
+        }
+        fcs16Table[0][i] = f16;
+        fcs32Table[0][i] = f32;
+    }
+    /* Table n is what a byte does to the FCS with n more bytes after it. */
+    for (int n = 1; n < 8; n++) {
+        for (int i = 0; i < 256; i++) {
+            uint16_t f16 = fcs16Table[n - 1][i];
+            uint32_t f32 = fcs32Table[n - 1][i];
+            fcs16Table[n][i] = (f16 >> 8) ^ fcs16Table[0][f16 & 0xff];
+            fcs32Table[n][i] = (f32 >> 8) ^ fcs32Table[0][f32 & 0xff];
+        }
+    }
+}
+
+uint16_t fcs16(uint16_t fcs, const uint8_t *buf, size_t len) {
+    pthread_once(&tablesOnce, make_tables);
+    while (len >= 8) {
+        fcs = fcs16Table[7][(fcs ^ buf[0]) & 0xff] ^ fcs16Table[6][((fcs >> 8) ^ buf[1]) & 0xff] ^
+            fcs16Table[5][buf[2]] ^ fcs16Table[4][buf[3]] ^ fcs16Table[3][buf[4]] ^
+            fcs16Table[2][buf[5]] ^ fcs16Table[1][buf[6]] ^ fcs16Table[0][buf[7]];
+        buf += 8;
+        len -= 8;
+    }
+    while (len-- > 0) {
+        fcs = (fcs >> 8) ^ fcs16Table[0][(fcs ^ *buf++) & 0xff];
+    }
+    return fcs;
+}
+
+uint32_t fcs32(uint32_t fcs, const uint8_t *buf, size_t len) {
+    pthread_once(&tablesOnce, make_tables);
+    while (len >= 8) {
+        uint32_t lo = fcs ^ (buf[0] | (buf[1] << 8) | (buf[2] << 16) | ((uint32_t)buf[3] << 24));
+        fcs = fcs32Table[7][lo & 0xff] ^ fcs32Table[6][(lo >> 8) & 0xff] ^
+            fcs32Table[5][(lo >> 16) & 0xff] ^ fcs32Table[4][lo >> 24] ^
+            fcs32Table[3][buf[4]] ^ fcs32Table[2][buf[5]] ^ fcs32Table[1][buf[6]] ^ fcs32Table[0][buf[7]];
+        buf += 8;
+        len -= 8;
+    }
+    while (len-- > 0) {
+        fcs = (fcs >> 8) ^ fcs32Table[0][(fcs ^ *buf++) & 0xff];
+    }
+    return fcs;
+}
+
+/*
+ * How many bytes from the start of buf can be copied as they are: up to the
+ * first flag or escape, or control character if ctrl is set. Most of a frame
+ * is like that, so look at 16 bytes at a time where we can.
+ */
+static size_t plain_run(const uint8_t *buf, size_t len, bool ctrl) {
+    size_t i = 0;
+#ifdef __SSE2__
+    const __m128i flag = _mm_set1_epi8(HDLC_FLAG);
+    const __m128i escape = _mm_set1_epi8(HDLC_ESCAPE);
+    const __m128i space = _mm_set1_epi8(0x1f);
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(buf + i));
+        __m128i hits = _mm_or_si128(_mm_cmpeq_epi8(v, flag), _mm_cmpeq_epi8(v, escape));
+        int mask;
+        if (ctrl) {
+            /* v <= 0x1f, unsigned. */
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi8(_mm_min_epu8(v, space), v));
+        }
+        if ((mask = _mm_movemask_epi8(hits)) != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (buf[i] == HDLC_FLAG || buf[i] == HDLC_ESCAPE || (ctrl && buf[i] < 0x20)) {
+            break;
+        }
+    }
+    return i;
+}
+
+static inline bool needs_escape(uint32_t accm, uint8_t c) {
+    return c == HDLC_FLAG || c == HDLC_ESCAPE || (c < 0x20 && (accm >> c) & 1);
+}
+
+static uint8_t *escape_bytes(uint32_t accm, const uint8_t *buf, size_t len, uint8_t *out) {
+    while (len > 0) {
+        size_t run = plain_run(buf, len, accm != 0);
+        memcpy(out, buf, run);
+        out += run;
+        buf += run;
+        len -= run;
+        if (len > 0) {
+            if (needs_escape(accm, *buf)) {
+                *out++ = HDLC_ESCAPE;
+                *out++ = *buf ^ 0x20;
+            } else {
+                /* A control character they don't mind. */
+                *out++ = *buf;
+            }
+            buf++;
+            len--;
+        }
+    }
+    return out;
+}
+
+size_t hdlc_encode(const hdlc_tx_t *tx, const uint8_t *hdr, size_t hdrLen, const uint8_t *data, size_t len, uint8_t *out) {
+    uint8_t *p = out;
+    uint8_t fcs[4];
+    int fcsLen;
+    if (tx->fcs32) {
+        uint32_t f = ~fcs32(fcs32(FCS32_INIT, hdr, hdrLen), data, len);
+        fcs[0] = f;
+        fcs[1] = f >> 8;
+        fcs[2] = f >> 16;
+        fcs[3] = f >> 24;
+        fcsLen = 4;
+    } else {
+        uint16_t f = ~fcs16(fcs16(FCS16_INIT, hdr, hdrLen), data, len);
+        fcs[0] = f;
+        fcs[1] = f >> 8;
+        fcsLen = 2;
+    }
+    *p++ = HDLC_FLAG;
+    p = escape_bytes(tx->accm, hdr, hdrLen, p);
+    p = escape_bytes(tx->accm, data, len, p);
+    p = escape_bytes(tx->accm, fcs, fcsLen, p);
+    *p++ = HDLC_FLAG;
+    return p - out;
+}
+
+void hdlc_rx_init(hdlc_rx_t *rx, uint8_t *buf, size_t size) {
+    memset(rx, 0, sizeof(*rx));
+    rx->buf = buf;
+    rx->size = size;
+}
+
+static void end_frame(hdlc_rx_t *rx, hdlc_frame_cb got_frame, void *ctx) {
+    size_t fcsLen = rx->fcs32 ? 4 : 2;
+    if (!rx->discard && !rx->escaped && rx->len > fcsLen) {
+        bool good = rx->fcs32 ? fcs32(FCS32_INIT, rx->buf, rx->len) == FCS32_GOOD :
+            fcs16(FCS16_INIT, rx->buf, rx->len) == FCS16_GOOD;
+        if (good) {
+            rx->frames++;
+            got_frame(ctx, rx->buf, rx->len - fcsLen);
+        } else {
+            rx->badFcs++;
+        }
+    }
+    /* Back to back flags are just idle. */
+    rx->len = 0;
+    rx->escaped = false;
+    rx->discard = false;
+}
+
+void hdlc_decode(hdlc_rx_t *rx, const uint8_t *in, size_t len, hdlc_frame_cb got_frame, void *ctx) {
+    while (len > 0) {
+        size_t run = plain_run(in, len, rx->accm != 0);
+        if (run > 0) {
+            if (rx->escaped) {
+                /* The escaped byte is the first of the run. */
+                if (rx->len < rx->size) {
+                    rx->buf[rx->len++] = *in ^ 0x20;
+                } else if (!rx->discard) {
+                    rx->discard = true;
+                    rx->tooLong++;
+                }
+                rx->escaped = false;
+                in++;
+                len--;
+                run--;
+            }
+            if (rx->len + run <= rx->size) {
+                memcpy(rx->buf + rx->len, in, run);
+                rx->len += run;
+            } else if (!rx->discard) {
+                rx->discard = true;
+                rx->tooLong++;
+            }
+            in += run;
+            len -= run;
+            continue;
+        }
+        if (*in == HDLC_FLAG) {
+            end_frame(rx, got_frame, ctx);
+        } else if (*in == HDLC_ESCAPE) {
+            rx->escaped = true;
+        } else if (!((rx->accm >> *in) & 1)) {
+            /* A control character that's really data. */
+            if (rx->escaped) {
+                rx->escaped = false;
+                if (rx->len < rx->size) {
+                    rx->buf[rx->len++] = *in ^ 0x20;
+                }
+            } else if (rx->len < rx->size) {
+                rx->buf[rx->len++] = *in;
+            }
+        }
+        /* Anything else was stuck in by something along the way, so drop it. */
+        in++;
+        len--;
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef HDLC_H
+#define HDLC_H
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Async HDLC framing (RFC 1662) for when the kernel can't do it for us.
+ * Frames are flag, escaped data, escaped FCS, flag.
+ */
+#define HDLC_FLAG 0x7e
+#define HDLC_ESCAPE 0x7d
+
+#define FCS16_INIT 0xffff
+#define FCS16_GOOD 0xf0b8
+#define FCS32_INIT 0xffffffff
+#define FCS32_GOOD 0xdebb20e3
+
+/* Table driven, 8 bytes at a time. */
+uint16_t fcs16(uint16_t fcs, const uint8_t *buf, size_t len);
+uint32_t fcs32(uint32_t fcs, const uint8_t *buf, size_t len);
+
+/* Most an encoded frame of len bytes (header included) can take up. */
+#define HDLC_MAX_ENCODED(len) (2*((len) + 4) + 2)
+
+typedef struct {
+    /* Control characters the other end wants escaped. */
+    uint32_t accm;
+    bool fcs32;
+} hdlc_tx_t;
+
+/*
+ * Frame hdr followed by data (hdr is there so the PPP header doesn't have to
+ * be copied in front of the packet). out needs HDLC_MAX_ENCODED(hdrLen + len)
+ * bytes. Returns how many it used.
+ */
+size_t hdlc_encode(const hdlc_tx_t *tx, const uint8_t *hdr, size_t hdrLen, const uint8_t *data, size_t len, uint8_t *out);
+
+typedef void (*hdlc_frame_cb)(void *ctx, uint8_t *frame, size_t len);
+
+typedef struct {
+    /* Control characters that show up unescaped get dropped if they're in here. */
+    uint32_t accm;
+    bool fcs32;
+    bool escaped;
+    /* The frame in progress is bad. Drop everything up to the next flag. */
+    bool discard;
+    uint8_t *buf;
+    size_t size;
+    size_t len;
+    uint64_t frames;
+    uint64_t badFcs;
+    uint64_t tooLong;
+} hdlc_rx_t;
+
+/* buf holds the frame being put back together, FCS and all. */
+void hdlc_rx_init(hdlc_rx_t *rx, uint8_t *buf, size_t size);
+/* Feed it bytes from the line. got_frame gets every good frame, minus the FCS. */
+void hdlc_decode(hdlc_rx_t *rx, const uint8_t *in, size_t len, hdlc_frame_cb got_frame, void *ctx);
+
+#endif
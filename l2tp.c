@@ -0,0 +1,1051 @@
+#define _GNU_SOURCE
+#include <poll.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/eventfd.h>
+#include <netinet/in.h>
+#include "log.h"
+#include "clock.h"
+#include "l2tp.h"
+#include "rfc2217.h"
+#include "linewatch.h"
+
+/* Header (RFC 2661 section 3.1). */
+#define HDR_T 0x8000
+#define HDR_L 0x4000
+#define HDR_S 0x0800
+#define HDR_O 0x0200
+#define HDR_VER_MASK 0x000f
+#define HDR_VER 2
+#define CONTROL_HDR_LEN 12
+#define DATA_HDR_LEN 6
+
+/* Message types. */
+#define MSG_SCCRQ 1
+#define MSG_SCCRP 2
+#define MSG_SCCCN 3
+#define MSG_STOPCCN 4
+#define MSG_HELLO 6
+#define MSG_ICRQ 10
+#define MSG_ICRP 11
+#define MSG_ICCN 12
+#define MSG_CDN 14
+#define MSG_SLI 16
+
+/* AVPs. */
+#define AVP_M 0x8000
+#define AVP_H 0x4000
+#define AVP_LEN_MASK 0x03ff
+#define AVP_HDR_LEN 6
+#define AVP_MESSAGE_TYPE 0
+#define AVP_RESULT_CODE 1
+#define AVP_PROTOCOL_VERSION 2
+#define AVP_FRAMING_CAPS 3
+#define AVP_HOST_NAME 7
+#define AVP_TUNNEL_ID 9
+#define AVP_WINDOW 10
+#define AVP_CHALLENGE 11
+#define AVP_SESSION_ID 14
+#define AVP_CALL_SERIAL 15
+#define AVP_BEARER_TYPE 18
+#define AVP_FRAMING_TYPE 19
+#define AVP_CALLED_NUMBER 21
+#define AVP_TX_SPEED 24
+#define AVP_ACCM 35
+
+#define PROTOCOL_VERSION 0x0100
+#define FRAMING_ASYNC 2
+#define BEARER_ANALOG 2
+#define STOPCCN_CLEAR 1
+#define CDN_CARRIER_LOST 1
+#define CDN_ERROR 2
+#define CDN_ADMIN 3
+
+/* What we tell the LNS it can have outstanding. We only take control messages in order. */
+#define WINDOW 4
+#define DEFAULT_PEER_WINDOW 4
+#define QUEUE_SIZE 64
+#define CONTROL_MAX 256
+#define RETRANSMIT_USEC 1000000
+#define RETRANSMIT_MAX_USEC 8000000
+#define MAX_RETRIES 5
+/* Hold an ack back this long in case something's going out it can ride on. */
+#define ACK_DELAY_USEC 100000
+#define HELLO_USEC 60000000
+/* How long a tunnel with nothing in it waits around for the next call. */
+#define IDLE_USEC 60000000
+#define CONNECT_USEC 30000000
+#define MAX_SESSIONS 1024
+#define BATCH 32
+#define DGRAM_SIZE 2048
+#define FRAME_SIZE 1600
+#define TTY_READ_SIZE 4096
+/* How often the line looks at DCD and for a close request. */
+#define CHECK_USEC 250000
+
+enum {
+    TUNNEL_WAIT_REPLY = 0,
+    TUNNEL_UP,
+    /* We sent a StopCCN and are waiting for it to be acked. */
+    TUNNEL_CLOSING,
+    TUNNEL_DEAD
+};
+
+enum {
+    SESSION_WAIT_TUNNEL = 0,
+    SESSION_WAIT_REPLY,
+    SESSION_UP,
+    SESSION_CLOSED
+};
+
+typedef struct {
+    uint16_t ns;
+    uint16_t len;
+    uint8_t data[CONTROL_MAX];
+} control_msg_t;
+
+/* The AVPs we care about out of a control message. */
+typedef struct {
+    int type;
+    int tunnelId;
+    int sessionId;
+    int window;
+    int result;
+    bool challenge;
+    bool accm;
+    uint32_t sendAccm;
+    uint32_t recvAccm;
+} avps_t;
+
+struct l2tp_tunnel_s {
+    char target[128];
+    int sock;
+    int wakeFd;
+    pthread_mutex_t lock;
+    int state;
+    /* In tunnels, so new calls can use it. */
+    bool listed;
+    /* Sessions plus the thread. */
+    int refs;
+    uint16_t localId;
+    uint16_t peerId;
+    /* The next Ns we'll send and the next one we expect. */
+    uint16_t ns;
+    uint16_t nr;
+    int peerWindow;
+    /* Messages sent but not acked, then ones waiting for room in the LNS's window. */
+    control_msg_t queue[QUEUE_SIZE];
+    int queueHead;
+    int queueLen;
+    int numSent;
+    uint64_t retransmitAt;
+    uint64_t retransmitUsec;
+    int retries;
+    bool ackPending;
+    uint64_t ackAt;
+    uint64_t lastHeard;
+    uint64_t idleSince;
+    uint32_t serial;
+    uint16_t nextSession;
+    int numSessions;
+    l2tp_t *sessions[MAX_SESSIONS + 1];
+    uint8_t dgrams[BATCH][DGRAM_SIZE];
+    struct l2tp_tunnel_s *next;
+};
+
+static l2tp_tunnel_t *tunnels = NULL;
+static pthread_mutex_t tunnelsLock = PTHREAD_MUTEX_INITIALIZER;
+static uint16_t nextTunnelId = 0;
+
+static uint16_t get_u16(const uint8_t *p) {
+    return (p[0] << 8) | p[1];
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static void put_u16(uint8_t *p, uint16_t val) {
+    p[0] = val >> 8;
+    p[1] = val;
+}
+
+static void put_u32(uint8_t *p, uint32_t val) {
+    p[0] = val >> 24;
+    p[1] = val >> 16;
+    p[2] = val >> 8;
+    p[3] = val;
+}
+
+/* a comes before b, with 16 bit wraparound. */
+static bool seq_before(uint16_t a, uint16_t b) {
+    return (int16_t)(a - b) < 0;
+}
+
+static void wake(int fd) {
+    uint64_t one = 1;
+    if (write(fd, &one, sizeof(one)) < 0) {
+        /* The counter's full, so whoever it is has plenty to wake up for. */
+    }
+}
+
+static void drain(int fd) {
+    uint64_t count;
+    if (read(fd, &count, sizeof(count)) < 0) {
+        /* Nothing there. */
+    }
+}
+
+/* Start a control message in the next free slot. It isn't queued until send_message. */
+static control_msg_t *new_message(l2tp_tunnel_t *tunnel, uint16_t session, uint16_t type) {
+    control_msg_t *msg;
+    if (tunnel->queueLen == QUEUE_SIZE) {
+        log_warn(NULL, "L2TP control queue to %s is full.", tunnel->target);
+        return NULL;
+    }
+    msg = &tunnel->queue[(tunnel->queueHead + tunnel->queueLen) % QUEUE_SIZE];
+    put_u16(msg->data, HDR_T | HDR_L | HDR_S | HDR_VER);
+    put_u16(msg->data + 4, tunnel->peerId);
+    put_u16(msg->data + 6, session);
+    msg->len = CONTROL_HDR_LEN;
+    /* Message Type goes first. */
+    put_u16(msg->data + msg->len, AVP_M | (AVP_HDR_LEN + 2));
+    put_u16(msg->data + msg->len + 2, 0);
+    put_u16(msg->data + msg->len + 4, AVP_MESSAGE_TYPE);
+    put_u16(msg->data + msg->len + 6, type);
+    msg->len += AVP_HDR_LEN + 2;
+    return msg;
+}
+
+static void add_avp(control_msg_t *msg, uint16_t type, const void *value, size_t len) {
+    if (msg->len + AVP_HDR_LEN + len > CONTROL_MAX) {
+        return;
+    }
+    put_u16(msg->data + msg->len, AVP_M | (AVP_HDR_LEN + len));
+    put_u16(msg->data + msg->len + 2, 0);
+    put_u16(msg->data + msg->len + 4, type);
+    memcpy(msg->data + msg->len + AVP_HDR_LEN, value, len);
+    msg->len += AVP_HDR_LEN + len;
+}
+
+static void add_avp_u16(control_msg_t *msg, uint16_t type, uint16_t val) {
+    uint8_t buf[2];
+    put_u16(buf, val);
+    add_avp(msg, type, buf, sizeof(buf));
+}
+
+static void add_avp_u32(control_msg_t *msg, uint16_t type, uint32_t val) {
+    uint8_t buf[4];
+    put_u32(buf, val);
+    add_avp(msg, type, buf, sizeof(buf));
+}
+
+/* Queue it up. The tunnel's thread sends it, along with whatever else is waiting. */
+static void send_message(l2tp_tunnel_t *tunnel, control_msg_t *msg) {
+    put_u16(msg->data + 2, msg->len);
+    put_u16(msg->data + 8, tunnel->ns);
+    msg->ns = tunnel->ns++;
+    tunnel->queueLen++;
+    wake(tunnel->wakeFd);
+}
+
+/* Messages from..to in the queue, in one go. Each one acks everything we've got so far. */
+static void transmit(l2tp_tunnel_t *tunnel, int from, int to) {
+    struct mmsghdr msgs[QUEUE_SIZE];
+    struct iovec iovs[QUEUE_SIZE];
+    int count = to - from;
+    memset(msgs, 0, count*sizeof(struct mmsghdr));
+    for (int i = 0; i < count; i++) {
+        control_msg_t *msg = &tunnel->queue[(tunnel->queueHead + from + i) % QUEUE_SIZE];
+        put_u16(msg->data + 10, tunnel->nr);
+        iovs[i].iov_base = msg->data;
+        iovs[i].iov_len = msg->len;
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    /* Anything that doesn't make it out gets sent again. */
+    if (sendmmsg(tunnel->sock, msgs, count, MSG_DONTWAIT) < 0) {
+        log_debug(NULL, "Couldn't send to %s: %s", tunnel->target, strerror(errno));
+    }
+    tunnel->ackPending = false;
+}
+
+static void send_zlb(l2tp_tunnel_t *tunnel) {
+    uint8_t zlb[CONTROL_HDR_LEN];
+    put_u16(zlb, HDR_T | HDR_L | HDR_S | HDR_VER);
+    put_u16(zlb + 2, CONTROL_HDR_LEN);
+    put_u16(zlb + 4, tunnel->peerId);
+    put_u16(zlb + 6, 0);
+    put_u16(zlb + 8, tunnel->ns);
+    put_u16(zlb + 10, tunnel->nr);
+    if (send(tunnel->sock, zlb, sizeof(zlb), MSG_DONTWAIT) < 0) {
+        log_debug(NULL, "Couldn't send to %s: %s", tunnel->target, strerror(errno));
+    }
+    tunnel->ackPending = false;
+}
+
+/* Send what the LNS's window has room for, and an ack on its own if it's due and nothing took it. */
+static void flush_queue(l2tp_tunnel_t *tunnel, uint64_t now) {
+    int window = tunnel->queueLen < tunnel->peerWindow ? tunnel->queueLen : tunnel->peerWindow;
+    if (tunnel->numSent < window) {
+        if (tunnel->numSent == 0) {
+            tunnel->retransmitAt = now + tunnel->retransmitUsec;
+        }
+        transmit(tunnel, tunnel->numSent, window);
+        tunnel->numSent = window;
+    }
+    if (tunnel->ackPending && now >= tunnel->ackAt) {
+        send_zlb(tunnel);
+    }
+}
+
+/* The LNS has everything before nr. */
+static void got_ack(l2tp_tunnel_t *tunnel, uint16_t nr, uint64_t now) {
+    bool acked = false;
+    while (tunnel->numSent > 0 && seq_before(tunnel->queue[tunnel->queueHead].ns, nr)) {
+        tunnel->queueHead = (tunnel->queueHead + 1) % QUEUE_SIZE;
+        tunnel->queueLen--;
+        tunnel->numSent--;
+        acked = true;
+    }
+    if (acked) {
+        tunnel->retries = 0;
+        tunnel->retransmitUsec = RETRANSMIT_USEC;
+        tunnel->retransmitAt = now + RETRANSMIT_USEC;
+    }
+}
+
+static void end_session(l2tp_tunnel_t *tunnel, l2tp_t *session, int result, uint64_t now) {
+    tunnel->sessions[session->localId] = NULL;
+    if (--tunnel->numSessions == 0) {
+        tunnel->idleSince = now;
+    }
+    __atomic_store_n(&session->result, result, __ATOMIC_RELAXED);
+    __atomic_store_n(&session->state, SESSION_CLOSED, __ATOMIC_RELEASE);
+    wake(session->wakeFd);
+}
+
+static void send_icrq(l2tp_tunnel_t *tunnel, l2tp_t *session, uint64_t now) {
+    control_msg_t *msg = new_message(tunnel, 0, MSG_ICRQ);
+    if (msg == NULL) {
+        end_session(tunnel, session, L2TP_EXIT_CONNECT_FAILED, now);
+        return;
+    }
+    add_avp_u16(msg, AVP_SESSION_ID, session->localId);
+    add_avp_u32(msg, AVP_CALL_SERIAL, ++tunnel->serial);
+    add_avp_u32(msg, AVP_BEARER_TYPE, BEARER_ANALOG);
+    if (session->called[0] != 0) {
+        add_avp(msg, AVP_CALLED_NUMBER, session->called, strlen(session->called));
+    }
+    send_message(tunnel, msg);
+    __atomic_store_n(&session->state, SESSION_WAIT_REPLY, __ATOMIC_RELEASE);
+}
+
+/* Everything in the tunnel goes down with it. */
+static void fail_tunnel(l2tp_tunnel_t *tunnel, int result, uint64_t now) {
+    tunnel->state = TUNNEL_DEAD;
+    for (int i = 1; i <= MAX_SESSIONS && tunnel->numSessions > 0; i++) {
+        if (tunnel->sessions[i] != NULL) {
+            end_session(tunnel, tunnel->sessions[i], result, now);
+        }
+    }
+    tunnel->queueLen = 0;
+    tunnel->numSent = 0;
+}
+
+static bool parse_avps(const uint8_t *p, const uint8_t *end, avps_t *avps) {
+    memset(avps, 0, sizeof(*avps));
+    avps->type = avps->tunnelId = avps->sessionId = avps->window = avps->result = -1;
+    while (p < end) {
+        uint16_t flags;
+        size_t len;
+        uint16_t vendor, type;
+        const uint8_t *value;
+        if (end - p < AVP_HDR_LEN) {
+            return false;
+        }
+        flags = get_u16(p);
+        len = flags & AVP_LEN_MASK;
+        if (len < AVP_HDR_LEN || len > (size_t)(end - p)) {
+            return false;
+        }
+        vendor = get_u16(p + 2);
+        type = get_u16(p + 4);
+        value = p + AVP_HDR_LEN;
+        len -= AVP_HDR_LEN;
+        p = value + len;
+        /* Hidden ones need the tunnel secret, which we don't have. */
+        if (vendor != 0 || (flags & AVP_H)) {
+            continue;
+        }
+        if (type == AVP_MESSAGE_TYPE && len == 2) {
+            avps->type = get_u16(value);
+        } else if (type == AVP_TUNNEL_ID && len == 2) {
+            avps->tunnelId = get_u16(value);
+        } else if (type == AVP_SESSION_ID && len == 2) {
+            avps->sessionId = get_u16(value);
+        } else if (type == AVP_WINDOW && len == 2) {
+            avps->window = get_u16(value);
+        } else if (type == AVP_RESULT_CODE && len >= 2) {
+            avps->result = get_u16(value);
+        } else if (type == AVP_CHALLENGE) {
+            avps->challenge = true;
+        } else if (type == AVP_ACCM && len == 10) {
+            avps->accm = true;
+            avps->sendAccm = get_u32(value + 2);
+            avps->recvAccm = get_u32(value + 6);
+        }
+    }
+    return avps->type >= 0;
+}
+
+static void got_message(l2tp_tunnel_t *tunnel, uint16_t sessionId, const avps_t *avps, uint64_t now) {
+    l2tp_t *session = sessionId <= MAX_SESSIONS ? tunnel->sessions[sessionId] : NULL;
+    control_msg_t *msg;
+    switch (avps->type) {
+        case MSG_SCCRP:
+            if (tunnel->state != TUNNEL_WAIT_REPLY) {
+                break;
+            }
+            if (avps->challenge) {
+                log_warn(NULL, "The LNS at %s wants a tunnel secret. We don't do those.", tunnel->target);
+                fail_tunnel(tunnel, L2TP_EXIT_CONNECT_FAILED, now);
+                break;
+            }
+            if (avps->tunnelId <= 0 || (msg = new_message(tunnel, 0, MSG_SCCCN)) == NULL) {
+                fail_tunnel(tunnel, L2TP_EXIT_CONNECT_FAILED, now);
+                break;
+            }
+            tunnel->peerId = avps->tunnelId;
+            /* new_message didn't know the LNS's ID yet. */
+            put_u16(msg->data + 4, tunnel->peerId);
+            send_message(tunnel, msg);
+            if (avps->window > 0) {
+                tunnel->peerWindow = avps->window < QUEUE_SIZE ? avps->window : QUEUE_SIZE;
+            }
+            tunnel->state = TUNNEL_UP;
+            log_info(NULL, "L2TP tunnel %u/%u to %s is up.", tunnel->localId, tunnel->peerId, tunnel->target);
+            for (int i = 1; i <= MAX_SESSIONS; i++) {
+                if (tunnel->sessions[i] != NULL && tunnel->sessions[i]->state == SESSION_WAIT_TUNNEL) {
+                    send_icrq(tunnel, tunnel->sessions[i], now);
+                }
+            }
+            break;
+        case MSG_STOPCCN:
+            log_info(NULL, "The LNS at %s closed the tunnel. Result: %d", tunnel->target, avps->result);
+            fail_tunnel(tunnel, L2TP_EXIT_REMOTE_CLOSED, now);
+            /* Ack it before we go. */
+            tunnel->ackAt = now;
+            break;
+        case MSG_ICRP:
+            if (session == NULL || session->state != SESSION_WAIT_REPLY) {
+                break;
+            }
+            if (avps->sessionId <= 0 || (msg = new_message(tunnel, avps->sessionId, MSG_ICCN)) == NULL) {
+                end_session(tunnel, session, L2TP_EXIT_CONNECT_FAILED, now);
+                break;
+            }
+            add_avp_u32(msg, AVP_TX_SPEED, session->speed);
+            add_avp_u32(msg, AVP_FRAMING_TYPE, FRAMING_ASYNC);
+            send_message(tunnel, msg);
+            session->peerId = avps->sessionId;
+            session->peerTunnel = tunnel->peerId;
+            __atomic_store_n(&session->state, SESSION_UP, __ATOMIC_RELEASE);
+            wake(session->wakeFd);
+            break;
+        case MSG_CDN:
+            if (session != NULL) {
+                log_info(session->tag, "The LNS hung up. Result: %d", avps->result);
+                end_session(tunnel, session, L2TP_EXIT_REMOTE_CLOSED, now);
+            }
+            break;
+        case MSG_SLI:
+            /* The ACCM the caller and the LNS agreed on. Until then we escape everything going out and take anything coming in. */
+            if (session != NULL && avps->accm) {
+                session->tx.accm = avps->sendAccm;
+                __atomic_store_n(&session->recvAccm, avps->recvAccm, __ATOMIC_RELAXED);
+            }
+            break;
+        default:
+            /* HELLO and anything else just gets acked. */
+            break;
+    }
+}
+
+static void got_control(l2tp_tunnel_t *tunnel, const uint8_t *buf, size_t len, uint64_t now) {
+    uint16_t flags = get_u16(buf);
+    uint16_t length, sessionId, ns, nr;
+    avps_t avps;
+    if ((flags & (HDR_L | HDR_S)) != (HDR_L | HDR_S) || len < CONTROL_HDR_LEN) {
+        return;
+    }
+    length = get_u16(buf + 2);
+    if (length < CONTROL_HDR_LEN || length > len || get_u16(buf + 4) != tunnel->localId) {
+        return;
+    }
+    sessionId = get_u16(buf + 6);
+    ns = get_u16(buf + 8);
+    nr = get_u16(buf + 10);
+    tunnel->lastHeard = now;
+    got_ack(tunnel, nr, now);
+    if (length == CONTROL_HDR_LEN) {
+        /* Just an ack. */
+        return;
+    }
+    if (ns != tunnel->nr) {
+        /* Seen it already (our ack must have been lost), or it's ahead of one we missed, which the LNS will send again. */
+        if (seq_before(ns, tunnel->nr)) {
+            tunnel->ackPending = true;
+            tunnel->ackAt = now;
+        }
+        return;
+    }
+    tunnel->nr++;
+    if (!tunnel->ackPending) {
+        tunnel->ackPending = true;
+        tunnel->ackAt = now + ACK_DELAY_USEC;
+    }
+    if (parse_avps(buf + CONTROL_HDR_LEN, buf + length, &avps)) {
+        got_message(tunnel, sessionId, &avps, now);
+    }
+}
+
+static void got_data(l2tp_tunnel_t *tunnel, uint8_t *buf, size_t len) {
+    static const hdlc_tx_t lcpTx = {0xffffffff, false};
+    uint16_t flags = get_u16(buf);
+    size_t off = 2;
+    uint16_t sessionId;
+    l2tp_t *session;
+    uint8_t *frame;
+    size_t frameLen;
+    bool lcp;
+    if (flags & HDR_L) {
+        off += 2;
+    }
+    if (off + 4 > len) {
+        return;
+    }
+    sessionId = get_u16(buf + off + 2);
+    off += 4;
+    if (flags & HDR_S) {
+        off += 4;
+    }
+    if (flags & HDR_O) {
+        if (off + 2 > len) {
+            return;
+        }
+        off += 2 + get_u16(buf + off);
+    }
+    if (sessionId == 0 || sessionId > MAX_SESSIONS || (session = tunnel->sessions[sessionId]) == NULL ||
+            session->state != SESSION_UP || off + 2 > len || len - off > FRAME_SIZE) {
+        return;
+    }
+    frame = buf + off;
+    frameLen = len - off;
+    /* LCP always goes out with every control character escaped, like RFC 1662 says. */
+    lcp = (frameLen >= 4 && frame[0] == 0xff && frame[1] == 0x03 && frame[2] == 0xc0 && frame[3] == 0x21) ||
+        (frame[0] == 0xc0 && frame[1] == 0x21);
+    pthread_mutex_lock(&session->txLock);
+    if (session->txLen + HDLC_MAX_ENCODED(frameLen) <= L2TP_TX_SIZE) {
+        bool wasEmpty = session->txLen == session->txOff;
+        session->txLen += hdlc_encode(lcp ? &lcpTx : &session->tx, frame, 2, frame + 2, frameLen - 2, session->txBuf + session->txLen);
+        if (wasEmpty) {
+            wake(session->wakeFd);
+        }
+    } else {
+        /* The line can't keep up. PPP on both ends copes with a lost frame better than with a backlog. */
+        session->dropped++;
+    }
+    pthread_mutex_unlock(&session->txLock);
+}
+
+/* Take it out of tunnels, so the next call makes a new one. */
+static void unlist(l2tp_tunnel_t *tunnel) {
+    pthread_mutex_lock(&tunnelsLock);
+    for (l2tp_tunnel_t **p = &tunnels; *p != NULL; p = &(*p)->next) {
+        if (*p == tunnel) {
+            *p = tunnel->next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&tunnelsLock);
+    pthread_mutex_lock(&tunnel->lock);
+    tunnel->listed = false;
+    pthread_mutex_unlock(&tunnel->lock);
+}
+
+/* Drop a reference. Call with the lock held. Unlocks it, and frees the tunnel if that was the last one. */
+static void release(l2tp_tunnel_t *tunnel) {
+    bool last = --tunnel->refs == 0 && !tunnel->listed;
+    pthread_mutex_unlock(&tunnel->lock);
+    if (last) {
+        close(tunnel->sock);
+        close(tunnel->wakeFd);
+        pthread_mutex_destroy(&tunnel->lock);
+        free(tunnel);
+    }
+}
+
+static void check_timers(l2tp_tunnel_t *tunnel, uint64_t now) {
+    if (tunnel->numSent > 0 && now >= tunnel->retransmitAt) {
+        if (++tunnel->retries > MAX_RETRIES) {
+            if (tunnel->state != TUNNEL_CLOSING) {
+                log_warn(NULL, "The LNS at %s stopped answering.", tunnel->target);
+            }
+            fail_tunnel(tunnel, tunnel->state == TUNNEL_WAIT_REPLY ? L2TP_EXIT_CONNECT_FAILED : L2TP_EXIT_ERROR, now);
+            return;
+        }
+        transmit(tunnel, 0, tunnel->numSent);
+        tunnel->retransmitUsec = tunnel->retransmitUsec*2 < RETRANSMIT_MAX_USEC ? tunnel->retransmitUsec*2 : RETRANSMIT_MAX_USEC;
+        tunnel->retransmitAt = now + tunnel->retransmitUsec;
+    }
+    if (tunnel->state == TUNNEL_UP && tunnel->queueLen == 0 && now - tunnel->lastHeard >= HELLO_USEC) {
+        control_msg_t *msg = new_message(tunnel, 0, MSG_HELLO);
+        send_message(tunnel, msg);
+        tunnel->lastHeard = now;
+    }
+}
+
+/* Nobody's used it for a while. New calls get a new tunnel from here on. */
+static void retire(l2tp_tunnel_t *tunnel) {
+    control_msg_t *msg;
+    if ((msg = new_message(tunnel, 0, MSG_STOPCCN)) == NULL) {
+        tunnel->state = TUNNEL_DEAD;
+        return;
+    }
+    add_avp_u16(msg, AVP_TUNNEL_ID, tunnel->localId);
+    add_avp_u16(msg, AVP_RESULT_CODE, STOPCCN_CLEAR);
+    send_message(tunnel, msg);
+    tunnel->state = TUNNEL_CLOSING;
+    log_info(NULL, "Closing the idle L2TP tunnel to %s.", tunnel->target);
+}
+
+static void *tunnel_thread(void *arg) {
+    l2tp_tunnel_t *tunnel = arg;
+    struct mmsghdr msgs[BATCH];
+    struct iovec iovs[BATCH];
+    bool done = false;
+    while (!done) {
+        struct pollfd fds[2] = {{tunnel->sock, POLLIN, 0}, {tunnel->wakeFd, POLLIN, 0}};
+        uint64_t now = clock_usec();
+        uint64_t wait = 1000000;
+        int count = 0;
+        pthread_mutex_lock(&tunnel->lock);
+        if (tunnel->numSent > 0) {
+            wait = tunnel->retransmitAt > now ? (tunnel->retransmitAt - now < wait ? tunnel->retransmitAt - now : wait) : 0;
+        }
+        if (tunnel->ackPending) {
+            wait = tunnel->ackAt > now ? (tunnel->ackAt - now < wait ? tunnel->ackAt - now : wait) : 0;
+        }
+        pthread_mutex_unlock(&tunnel->lock);
+        if (clock_poll(fds, 2, wait) < 0 && errno != EINTR) {
+            log_error(NULL, "poll failed: %s", strerror(errno));
+            clock_sleep(wait);
+        }
+        if (fds[1].revents & POLLIN) {
+            drain(tunnel->wakeFd);
+        }
+        if (fds[0].revents & POLLIN) {
+            memset(msgs, 0, sizeof(msgs));
+            for (int i = 0; i < BATCH; i++) {
+                iovs[i].iov_base = tunnel->dgrams[i];
+                iovs[i].iov_len = DGRAM_SIZE;
+                msgs[i].msg_hdr.msg_iov = &iovs[i];
+                msgs[i].msg_hdr.msg_iovlen = 1;
+            }
+            /* An ICMP error from a connected socket shows up here too. The retransmits deal with it. */
+            if ((count = recvmmsg(tunnel->sock, msgs, BATCH, MSG_DONTWAIT, NULL)) < 0) {
+                count = 0;
+            }
+        }
+        pthread_mutex_lock(&tunnel->lock);
+        now = clock_usec();
+        for (int i = 0; i < count; i++) {
+            uint8_t *buf = tunnel->dgrams[i];
+            size_t len = msgs[i].msg_len;
+            if (len < DATA_HDR_LEN || (get_u16(buf) & HDR_VER_MASK) != HDR_VER) {
+                continue;
+            }
+            if (get_u16(buf) & HDR_T) {
+                got_control(tunnel, buf, len, now);
+            } else {
+                got_data(tunnel, buf, len);
+            }
+        }
+        if (tunnel->state != TUNNEL_DEAD) {
+            check_timers(tunnel, now);
+        }
+        if (tunnel->state == TUNNEL_UP && tunnel->numSessions == 0 && now - tunnel->idleSince >= IDLE_USEC) {
+            retire(tunnel);
+        }
+        flush_queue(tunnel, now);
+        done = tunnel->state == TUNNEL_DEAD || (tunnel->state == TUNNEL_CLOSING && tunnel->queueLen == 0);
+        pthread_mutex_unlock(&tunnel->lock);
+    }
+    unlist(tunnel);
+    pthread_mutex_lock(&tunnel->lock);
+    release(tunnel);
+    return NULL;
+}
+
+/* Make a tunnel to target and start bringing it up. Call with tunnelsLock held. */
+static l2tp_tunnel_t *open_tunnel(const char *tag, const char *target) {
+    struct addrinfo hints = {0};
+    struct addrinfo *addrs, *addr;
+    char host[128];
+    char hostname[64];
+    const char *port = strrchr(target, ':');
+    l2tp_tunnel_t *tunnel;
+    control_msg_t *msg;
+    pthread_t thread;
+    int sock = -1;
+    int res;
+    if (port == NULL || port - target >= sizeof(host)) {
+        return NULL;
+    }
+    memcpy(host, target, port - target);
+    host[port - target] = 0;
+    port++;
+    /* [::1]:1701 */
+    if (host[0] == '[' && host[strlen(host) - 1] == ']') {
+        memmove(host, host + 1, strlen(host) - 2);
+        host[strlen(host) - 2] = 0;
+    }
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+    if ((res = getaddrinfo(host, port, &hints, &addrs)) != 0) {
+        log_warn(tag, "Couldn't look up %s: %s", host, gai_strerror(res));
+        return NULL;
+    }
+    for (addr = addrs; addr != NULL; addr = addr->ai_next) {
+        if ((sock = socket(addr->ai_family, addr->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, addr->ai_protocol)) < 0) {
+            continue;
+        }
+        if (connect(sock, addr->ai_addr, addr->ai_addrlen) == 0) {
+            break;
+        }
+        close(sock);
+        sock = -1;
+    }
+    freeaddrinfo(addrs);
+    if (sock < 0 || (tunnel = calloc(1, sizeof(l2tp_tunnel_t))) == NULL) {
+        log_warn(tag, "Couldn't open a socket to %s: %s", target, strerror(errno));
+        if (sock >= 0) {
+            close(sock);
+        }
+        return NULL;
+    }
+    strcpy(tunnel->target, target);
+    tunnel->sock = sock;
+    if ((tunnel->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0) {
+        close(sock);
+        free(tunnel);
+        return NULL;
+    }
+    pthread_mutex_init(&tunnel->lock, NULL);
+    if (++nextTunnelId == 0) {
+        nextTunnelId = 1;
+    }
+    tunnel->localId = nextTunnelId;
+    tunnel->peerWindow = DEFAULT_PEER_WINDOW;
+    tunnel->retransmitUsec = RETRANSMIT_USEC;
+    tunnel->lastHeard = clock_usec();
+    tunnel->idleSince = tunnel->lastHeard;
+    tunnel->refs = 1;
+    tunnel->listed = true;
+
+    if (gethostname(hostname, sizeof(hostname)) != 0) {
+        strcpy(hostname, "dialin");
+    }
+    hostname[sizeof(hostname) - 1] = 0;
+    msg = new_message(tunnel, 0, MSG_SCCRQ);
+    add_avp_u16(msg, AVP_PROTOCOL_VERSION, PROTOCOL_VERSION);
+    add_avp(msg, AVP_HOST_NAME, hostname, strlen(hostname));
+    add_avp_u32(msg, AVP_FRAMING_CAPS, FRAMING_ASYNC);
+    add_avp_u16(msg, AVP_TUNNEL_ID, tunnel->localId);
+    add_avp_u16(msg, AVP_WINDOW, WINDOW);
+    send_message(tunnel, msg);
+
+    if (pthread_create(&thread, NULL, tunnel_thread, tunnel) != 0) {
+        log_error(tag, "Couldn't start a thread for the tunnel to %s!", target);
+        close(tunnel->sock);
+        close(tunnel->wakeFd);
+        pthread_mutex_destroy(&tunnel->lock);
+        free(tunnel);
+        return NULL;
+    }
+    pthread_detach(thread);
+    tunnel->next = tunnels;
+    tunnels = tunnel;
+    log_debug(tag, "Opening an L2TP tunnel to %s.", target);
+    return tunnel;
+}
+
+/* Put the session in the tunnel and ask for the call. Call with the tunnel locked. */
+static bool add_session(l2tp_tunnel_t *tunnel, l2tp_t *l2tp) {
+    uint64_t now = clock_usec();
+    if (tunnel->numSessions == MAX_SESSIONS) {
+        return false;
+    }
+    do {
+        tunnel->nextSession = tunnel->nextSession % MAX_SESSIONS + 1;
+    } while (tunnel->sessions[tunnel->nextSession] != NULL);
+    l2tp->localId = tunnel->nextSession;
+    l2tp->tunnel = tunnel;
+    l2tp->state = SESSION_WAIT_TUNNEL;
+    tunnel->sessions[l2tp->localId] = l2tp;
+    tunnel->numSessions++;
+    tunnel->refs++;
+    if (tunnel->state == TUNNEL_UP) {
+        send_icrq(tunnel, l2tp, now);
+    }
+    return true;
+}
+
+void l2tp_init(l2tp_t *l2tp, const char *tag) {
+    memset(l2tp, 0, sizeof(*l2tp));
+    l2tp->tag = tag;
+    l2tp->ttyFd = -1;
+    l2tp->ttyFlags = -1;
+    l2tp->wakeFd = -1;
+    l2tp->statusFd = -1;
+    l2tp->result = L2TP_EXIT_CONNECT_FAILED;
+    pthread_mutex_init(&l2tp->txLock, NULL);
+}
+
+int l2tp_connect(l2tp_t *l2tp, const char *target, const char *called, uint32_t speed, int ttyFd) {
+    l2tp_tunnel_t *tunnel;
+    uint64_t deadline;
+    int state;
+    snprintf(l2tp->called, sizeof(l2tp->called), "%s", called);
+    l2tp->speed = speed;
+    l2tp->rxBuf = malloc(FRAME_SIZE + 8);
+    l2tp->txBuf = malloc(L2TP_TX_SIZE);
+    if (l2tp->rxBuf == NULL || l2tp->txBuf == NULL) {
+        return -1;
+    }
+    if ((l2tp->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0) {
+        return -2;
+    }
+    /* Until the LNS tells us what the caller asked for. */
+    hdlc_rx_init(&l2tp->rx, l2tp->rxBuf, FRAME_SIZE + 8);
+    l2tp->tx.accm = 0xffffffff;
+
+    pthread_mutex_lock(&tunnelsLock);
+    for (tunnel = tunnels; tunnel != NULL; tunnel = tunnel->next) {
+        if (strcmp(tunnel->target, target) == 0) {
+            pthread_mutex_lock(&tunnel->lock);
+            if ((tunnel->state == TUNNEL_WAIT_REPLY || tunnel->state == TUNNEL_UP) && add_session(tunnel, l2tp)) {
+                pthread_mutex_unlock(&tunnel->lock);
+                break;
+            }
+            pthread_mutex_unlock(&tunnel->lock);
+        }
+    }
+    if (tunnel == NULL && (tunnel = open_tunnel(l2tp->tag, target)) != NULL) {
+        pthread_mutex_lock(&tunnel->lock);
+        add_session(tunnel, l2tp);
+        pthread_mutex_unlock(&tunnel->lock);
+    }
+    pthread_mutex_unlock(&tunnelsLock);
+    if (tunnel == NULL) {
+        return -3;
+    }
+
+    /* Wait for the tunnel to come up and the LNS to take the call. */
+    deadline = clock_usec() + CONNECT_USEC;
+    while ((state = __atomic_load_n(&l2tp->state, __ATOMIC_ACQUIRE)) != SESSION_UP && state != SESSION_CLOSED) {
+        uint64_t now = clock_usec();
+        if (now >= deadline) {
+            break;
+        }
+        if (clock_wait_readable(l2tp->wakeFd, deadline - now) == 1) {
+            drain(l2tp->wakeFd);
+        }
+    }
+    if (state != SESSION_UP) {
+        log_warn(l2tp->tag, "The LNS at %s didn't take the call.", target);
+        return -4;
+    }
+    l2tp->ttyFd = ttyFd;
+    l2tp->ttyFlags = fcntl(ttyFd, F_GETFL);
+    fcntl(ttyFd, F_SETFL, l2tp->ttyFlags | O_NONBLOCK);
+    log_info(l2tp->tag, "Call tunneled to %s as session %u (%u at the LNS).", target, l2tp->localId, l2tp->peerId);
+    return 0;
+}
+
+/* A frame from the caller, straight out of the HDLC buffer. */
+static void send_frame(void *ctx, uint8_t *frame, size_t len) {
+    l2tp_t *l2tp = ctx;
+    uint8_t hdr[DATA_HDR_LEN];
+    struct iovec iov[2] = {{hdr, sizeof(hdr)}, {frame, len}};
+    struct msghdr msg = {.msg_iov = iov, .msg_iovlen = 2};
+    put_u16(hdr, HDR_VER);
+    put_u16(hdr + 2, l2tp->peerTunnel);
+    put_u16(hdr + 4, l2tp->peerId);
+    if (sendmsg(l2tp->tunnel->sock, &msg, MSG_DONTWAIT) < 0) {
+        log_debug(l2tp->tag, "Couldn't send a frame to the LNS: %s", strerror(errno));
+    }
+}
+
+static void flush_tx(l2tp_t *l2tp) {
+    pthread_mutex_lock(&l2tp->txLock);
+    while (l2tp->txOff < l2tp->txLen) {
+        ssize_t bytes = write(l2tp->ttyFd, l2tp->txBuf + l2tp->txOff, l2tp->txLen - l2tp->txOff);
+        if (bytes <= 0) {
+            if (bytes < 0 && errno != EAGAIN && errno != EINTR) {
+                log_debug(l2tp->tag, "Write failed: %s", strerror(errno));
+                l2tp->txOff = l2tp->txLen;
+            }
+            break;
+        }
+        l2tp->txOff += bytes;
+        l2tp->txBytes += bytes;
+    }
+    if (l2tp->txOff == l2tp->txLen) {
+        l2tp->txOff = 0;
+        l2tp->txLen = 0;
+    } else if (l2tp->txOff > L2TP_TX_SIZE/2) {
+        /* Make room at the end for the tunnel's thread. */
+        memmove(l2tp->txBuf, l2tp->txBuf + l2tp->txOff, l2tp->txLen - l2tp->txOff);
+        l2tp->txLen -= l2tp->txOff;
+        l2tp->txOff = 0;
+    }
+    pthread_mutex_unlock(&l2tp->txLock);
+}
+
+/* Same as pppd's modem option: once we've seen DCD, losing it is a hangup. */
+static bool carrier_lost(l2tp_t *l2tp) {
+    int bits;
+    l2tp->carrierTimer = clock_usec() + (l2tp->statusFd >= 0 ? LINEWATCH_CHECK_USEC : 1000000);
+    if (rfc2217_ioctl(l2tp->ttyFd, TIOCMGET, &bits) < 0) {
+        return false;
+    }
+    if (bits & TIOCM_CD) {
+        l2tp->carrierSeen = true;
+        return false;
+    }
+    return l2tp->carrierSeen;
+}
+
+int l2tp_run(l2tp_t *l2tp) {
+    int exitCode = -1;
+    l2tp->carrierTimer = clock_usec();
+    while (exitCode < 0) {
+        struct pollfd fds[3] = {{l2tp->ttyFd, POLLIN, 0}, {l2tp->wakeFd, POLLIN, 0}, {l2tp->statusFd, POLLIN, 0}};
+        uint64_t now = clock_usec();
+        uint64_t wait = l2tp->carrierTimer > now ? l2tp->carrierTimer - now : 0;
+        if (__atomic_exchange_n(&l2tp->closeRequest, 0, __ATOMIC_ACQ_REL)) {
+            exitCode = L2TP_EXIT_USER_REQUEST;
+            break;
+        }
+        pthread_mutex_lock(&l2tp->txLock);
+        if (l2tp->txLen > 0) {
+            fds[0].events |= POLLOUT;
+        }
+        pthread_mutex_unlock(&l2tp->txLock);
+        if (clock_poll(fds, 3, wait < CHECK_USEC ? wait : CHECK_USEC) < 0 && errno != EINTR) {
+            log_error(l2tp->tag, "poll failed: %s", strerror(errno));
+            exitCode = L2TP_EXIT_ERROR;
+            break;
+        }
+        if (fds[2].revents & POLLIN) {
+            drain(l2tp->statusFd);
+            l2tp->carrierTimer = 0;
+        }
+        if (fds[1].revents & POLLIN) {
+            drain(l2tp->wakeFd);
+            if (__atomic_load_n(&l2tp->state, __ATOMIC_ACQUIRE) == SESSION_CLOSED) {
+                exitCode = __atomic_load_n(&l2tp->result, __ATOMIC_RELAXED);
+            }
+        }
+        if (fds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+            uint8_t buf[TTY_READ_SIZE];
+            ssize_t bytes = read(l2tp->ttyFd, buf, sizeof(buf));
+            if (bytes > 0) {
+                l2tp->rxBytes += bytes;
+                l2tp->rx.accm = __atomic_load_n(&l2tp->recvAccm, __ATOMIC_RELAXED);
+                hdlc_decode(&l2tp->rx, buf, bytes, send_frame, l2tp);
+            } else if (bytes == 0 || errno == EIO) {
+                exitCode = L2TP_EXIT_HANGUP;
+            }
+        }
+        /* Whatever the LNS sent last (a Terminate-Ack, say) still goes out. */
+        flush_tx(l2tp);
+        if (exitCode < 0 && clock_usec() >= l2tp->carrierTimer && carrier_lost(l2tp)) {
+            exitCode = L2TP_EXIT_HANGUP;
+        }
+    }
+    if (exitCode == L2TP_EXIT_HANGUP) {
+        log_info(l2tp->tag, "The line hung up.");
+    }
+    l2tp->result = exitCode;
+    return exitCode;
+}
+
+void l2tp_close(l2tp_t *l2tp) {
+    __atomic_store_n(&l2tp->closeRequest, 1, __ATOMIC_RELEASE);
+}
+
+void l2tp_free(l2tp_t *l2tp) {
+    l2tp_tunnel_t *tunnel = l2tp->tunnel;
+    if (tunnel != NULL) {
+        pthread_mutex_lock(&tunnel->lock);
+        if (tunnel->sessions[l2tp->localId] == l2tp) {
+            /* The LNS doesn't know it's over yet, unless we never got as far as asking it. */
+            control_msg_t *msg = l2tp->state != SESSION_WAIT_TUNNEL ? new_message(tunnel, l2tp->peerId, MSG_CDN) : NULL;
+            if (msg != NULL) {
+                add_avp_u16(msg, AVP_RESULT_CODE, l2tp->result == L2TP_EXIT_HANGUP ? CDN_CARRIER_LOST :
+                    l2tp->result == L2TP_EXIT_USER_REQUEST ? CDN_ADMIN : CDN_ERROR);
+                add_avp_u16(msg, AVP_SESSION_ID, l2tp->localId);
+                send_message(tunnel, msg);
+            }
+            tunnel->sessions[l2tp->localId] = NULL;
+            if (--tunnel->numSessions == 0) {
+                tunnel->idleSince = clock_usec();
+            }
+        }
+        release(tunnel);
+        l2tp->tunnel = NULL;
+    }
+    if (l2tp->ttyFlags >= 0) {
+        fcntl(l2tp->ttyFd, F_SETFL, l2tp->ttyFlags);
+        l2tp->ttyFlags = -1;
+    }
+    if (l2tp->wakeFd >= 0) {
+        close(l2tp->wakeFd);
+        l2tp->wakeFd = -1;
+    }
+    if (l2tp->dropped > 0) {
+        log_debug(l2tp->tag, "Dropped %lu frames from the LNS the line couldn't keep up with.", (unsigned long)l2tp->dropped);
+    }
+    free(l2tp->rxBuf);
+    free(l2tp->txBuf);
+    l2tp->rxBuf = NULL;
+    l2tp->txBuf = NULL;
+    pthread_mutex_destroy(&l2tp->txLock);
+}
+
+int l2tp_snapshot(l2tp_info_t *info, int max) {
+    int count = 0;
+    pthread_mutex_lock(&tunnelsLock);
+    for (l2tp_tunnel_t *tunnel = tunnels; tunnel != NULL && count < max; tunnel = tunnel->next) {
+        pthread_mutex_lock(&tunnel->lock);
+        if (tunnel->state == TUNNEL_UP) {
+            strcpy(info[count].target, tunnel->target);
+            info[count].numSessions = tunnel->numSessions;
+            count++;
+        }
+        pthread_mutex_unlock(&tunnel->lock);
+    }
+    pthread_mutex_unlock(&tunnelsLock);
+    return count;
+}
@@ -0,0 +1,92 @@
+#ifndef L2TP_H
+#define L2TP_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <pthread.h>
+#include "hdlc.h"
+
+/*
+ * L2TP access concentrator (RFC 2661). Instead of doing PPP with the caller
+ * ourselves, we pass their frames over UDP to an LNS that does.
+ *
+ * Every call to the same LNS goes through one tunnel. The tunnel has a thread
+ * of its own that runs the control connection and gets data from the LNS to
+ * the lines: it takes datagrams in batches, HDLC encodes each frame straight
+ * into its line's buffer and wakes the line up to write it. Going the other
+ * way, the line's thread sends each frame right out of the buffer HDLC put it
+ * back together in, with the header in front of it in the same sendmsg.
+ *
+ * Control messages from all the lines are queued on the tunnel and go out
+ * together, acks riding along on them where they can.
+ */
+
+/* How the session ended, for the call record. Same as the TCP relay's. */
+#define L2TP_EXIT_REMOTE_CLOSED 0
+#define L2TP_EXIT_CONNECT_FAILED 1
+#define L2TP_EXIT_HANGUP 2
+#define L2TP_EXIT_ERROR 3
+#define L2TP_EXIT_USER_REQUEST 5
+
+#define L2TP_TX_SIZE 32768
+
+typedef struct l2tp_tunnel_s l2tp_tunnel_t;
+
+/* For metrics. */
+typedef struct {
+    char target[128];
+    int numSessions;
+} l2tp_info_t;
+
+typedef struct {
+    const char *tag;
+    int ttyFd;
+    int ttyFlags;
+    l2tp_tunnel_t *tunnel;
+    /* Our session ID and the LNS's, plus the LNS's tunnel ID to go with it. */
+    uint16_t localId;
+    uint16_t peerId;
+    uint16_t peerTunnel;
+    /* Set by the tunnel's thread, which writes wakeFd when it changes. */
+    int state;
+    int result;
+    int wakeFd;
+    /* For the ICRQ and ICCN. */
+    char called[32];
+    uint32_t speed;
+    /* Caller to LNS. recvAccm comes from the LNS, once the caller and it have agreed on one. */
+    hdlc_rx_t rx;
+    uint8_t *rxBuf;
+    uint32_t recvAccm;
+    /* LNS to caller. The tunnel's thread fills txBuf and we write it out. */
+    hdlc_tx_t tx;
+    uint8_t *txBuf;
+    size_t txLen;
+    size_t txOff;
+    pthread_mutex_t txLock;
+    uint64_t rxBytes;
+    uint64_t txBytes;
+    uint64_t dropped;
+    bool carrierSeen;
+    uint64_t carrierTimer;
+    /* The line watcher's eventFd, or -1. Readable means look at DCD now. */
+    int statusFd;
+    int closeRequest;
+} l2tp_t;
+
+void l2tp_init(l2tp_t *l2tp, const char *tag);
+/*
+ * Open a session for the call through the tunnel to target (host:port), making
+ * the tunnel if there isn't one. Blocks until the LNS takes the call. 0 if it did.
+ */
+int l2tp_connect(l2tp_t *l2tp, const char *target, const char *called, uint32_t speed, int ttyFd);
+/* Move frames until the call ends. Returns an L2TP_EXIT code. */
+int l2tp_run(l2tp_t *l2tp);
+/* Ask it to stop. Safe to call from another thread. */
+void l2tp_close(l2tp_t *l2tp);
+/* Tells the LNS the call is over if it doesn't know yet. */
+void l2tp_free(l2tp_t *l2tp);
+/* Copy out up to max tunnels. Returns how many. */
+int l2tp_snapshot(l2tp_info_t *info, int max);
+
+#endif
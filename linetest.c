@@ -0,0 +1,117 @@
+#include <math.h>
+#include <string.h>
+#include "linetest.h"
+
+const float linetestFreqs[LINETEST_FREQS] = {300, 500, 1000, 1500, 2000, 2500, 3000, 3300};
+/* The 1000 Hz tone. Everything else is relative to it. */
+#define REF_TONE 2
+/* Quieter than -50 dB and nothing came back. */
+#define NOTHING_BACK 1e-5f
+/*
+ * Roughly what V.34 wants to get to its faster rates. 8-bit samples can't
+ * show much better than 40 dB SNR or a noise floor under -50 dBFS anyway.
+ */
+#define GOOD_SNR_DB 30
+#define GOOD_FLATNESS_DB 3
+#define GOOD_NOISE_DB -45
+
+void goertzel_init(goertzel_bank_t *bank) {
+    memset(bank, 0, sizeof(*bank));
+    for (int i = 0; i < LINETEST_FREQS; i++) {
+        bank->coeff[i] = 2*cosf(2*(float)M_PI*linetestFreqs[i]/LINETEST_RATE);
+    }
+}
+
+void goertzel_feed(goertzel_bank_t *bank, const int16_t *samples, int count) {
+    linetest_vec_t s1 = bank->s1;
+    linetest_vec_t s2 = bank->s2;
+    double energy = 0;
+    for (int i = 0; i < count; i++) {
+        float x = samples[i]/32768.0f;
+        linetest_vec_t s0 = bank->coeff*s1 - s2 + x;
+        s2 = s1;
+        s1 = s0;
+        energy += x*x;
+    }
+    bank->s1 = s1;
+    bank->s2 = s2;
+    bank->energy += energy;
+    bank->count += count;
+}
+
+void goertzel_power(const goertzel_bank_t *bank, float *power, float *total) {
+    float n = bank->count > 0 ? bank->count : 1;
+    linetest_vec_t mag = bank->s1*bank->s1 + bank->s2*bank->s2 - bank->coeff*bank->s1*bank->s2;
+    /* A sine with peak a comes out as (a*n/2)^2. */
+    for (int i = 0; i < LINETEST_FREQS; i++) {
+        power[i] = 4*mag[i]/(n*n);
+    }
+    /* A full scale sine's mean square is 1/2. */
+    *total = 2*bank->energy/n;
+}
+
+int linetest_window(int64_t pos, int *offset, int *left) {
+    int window;
+    if (pos < LINETEST_NOISE_SAMPLES) {
+        *offset = pos;
+        *left = LINETEST_NOISE_SAMPLES - pos;
+        return -1;
+    }
+    pos -= LINETEST_NOISE_SAMPLES;
+    window = pos/LINETEST_TONE_SAMPLES;
+    if (window >= LINETEST_FREQS) {
+        *offset = 0;
+        *left = 0;
+        return LINETEST_FREQS;
+    }
+    *offset = pos % LINETEST_TONE_SAMPLES;
+    *left = LINETEST_TONE_SAMPLES - *offset;
+    return window;
+}
+
+static float to_db(float power) {
+    return 10*log10f(power > 1e-12f ? power : 1e-12f);
+}
+
+bool linetest_score(line_quality_t *quality, const goertzel_bank_t *noise, const goertzel_bank_t *tones) {
+    float power[LINETEST_FREQS];
+    float level[LINETEST_FREQS];
+    float total;
+    float flatness = 0;
+    float score = 100;
+    goertzel_power(noise, power, &total);
+    quality->noiseDb = to_db(total);
+    quality->snrDb = 1000;
+    for (int i = 0; i < LINETEST_FREQS; i++) {
+        float snr;
+        goertzel_power(&tones[i], power, &total);
+        level[i] = power[i];
+        /* Everything that isn't the tone is noise or distortion. */
+        snr = to_db(power[i]) - to_db(total - power[i]);
+        if (snr < quality->snrDb) {
+            quality->snrDb = snr;
+        }
+    }
+    if (level[REF_TONE] < NOTHING_BACK) {
+        return false;
+    }
+    for (int i = 0; i < LINETEST_FREQS; i++) {
+        quality->responseDb[i] = to_db(level[i]) - to_db(level[REF_TONE]);
+        if (fabsf(quality->responseDb[i]) > flatness) {
+            flatness = fabsf(quality->responseDb[i]);
+        }
+    }
+    if (quality->snrDb < GOOD_SNR_DB) {
+        score -= 3*(GOOD_SNR_DB - quality->snrDb);
+    }
+    if (flatness > GOOD_FLATNESS_DB) {
+        score -= 4*(flatness - GOOD_FLATNESS_DB);
+    }
+    if (quality->noiseDb > GOOD_NOISE_DB) {
+        score -= 2*(quality->noiseDb - GOOD_NOISE_DB);
+    }
+    quality->score = score < 0 ? 0 : (int)score;
+    quality->when = time(NULL);
+    quality->tested = true;
+    return true;
+}
@@ -0,0 +1,72 @@
+#ifndef LINETEST_H
+#define LINETEST_H
+#include <time.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Line quality tests. A call routed to linetest (with a loopback on the other
+ * end) gets a second of silence and then a tone at each of linetestFreqs,
+ * sent and recorded at the same time in full duplex voice mode. What comes
+ * back gives the line's noise floor, how flat it is across the band and the
+ * SNR at each tone, boiled down to a score out of 100.
+ *
+ * Lines in a hunt group that score under LINETEST_MARGINAL stay busy while a
+ * better line's free, so the exchange sends calls to the better ones first.
+ */
+
+#define LINETEST_FREQS 8
+#define LINETEST_RATE 8000
+/* Samples of silence, and of each tone. */
+#define LINETEST_NOISE_SAMPLES 8000
+#define LINETEST_TONE_SAMPLES 4000
+/* What we don't count at the start of each, while the loopback catches up. */
+#define LINETEST_SETTLE_SAMPLES 1200
+#define LINETEST_SAMPLES (LINETEST_NOISE_SAMPLES + LINETEST_FREQS*LINETEST_TONE_SAMPLES)
+/* Peak of the test tones, out of full scale. About -13 dBm0. */
+#define LINETEST_LEVEL 0.3
+#define LINETEST_MARGINAL 60
+
+extern const float linetestFreqs[LINETEST_FREQS];
+
+/* A Goertzel filter for every test frequency, one per vector lane, so they all run at once. */
+typedef float linetest_vec_t __attribute__((vector_size(LINETEST_FREQS*sizeof(float))));
+
+typedef struct {
+    linetest_vec_t coeff;
+    linetest_vec_t s1;
+    linetest_vec_t s2;
+    uint32_t count;
+    /* Sum of the squares of every sample, for the total power. */
+    double energy;
+} goertzel_bank_t;
+
+void goertzel_init(goertzel_bank_t *bank);
+void goertzel_feed(goertzel_bank_t *bank, const int16_t *samples, int count);
+/* Power at each test frequency, and all together, relative to a full scale sine. Linear, not dB. */
+void goertzel_power(const goertzel_bank_t *bank, float *power, float *total);
+
+typedef struct {
+    bool tested;
+    time_t when;
+    /* What came back while we sent silence, in dBFS. */
+    float noiseDb;
+    /* The worst of the tones. */
+    float snrDb;
+    /* How loud each tone came back, relative to 1000 Hz. */
+    float responseDb[LINETEST_FREQS];
+    int score;
+} line_quality_t;
+
+/*
+ * Where in the test sample pos is: -1 for the silence, the tone's index, or
+ * LINETEST_FREQS once it's over. offset is how far into it pos is.
+ */
+int linetest_window(int64_t pos, int *offset, int *left);
+/*
+ * Score the line from the banks fed during the silence and each tone. False
+ * if nothing came back, so there was nothing to score.
+ */
+bool linetest_score(line_quality_t *quality, const goertzel_bank_t *noise, const goertzel_bank_t *tones);
+
+#endif
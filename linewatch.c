@@ -0,0 +1,190 @@
+#define _GNU_SOURCE
+#include <time.h>
+#include <errno.h>
+#include <stdint.h>
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/ioctl.h>
+#include <sys/eventfd.h>
+#include <linux/serial.h>
+#include "log.h"
+#include "clock.h"
+#include "rfc2217.h"
+#include "linewatch.h"
+
+/* Sent to a watcher to get it out of TIOCMIWAIT. */
+#define LINEWATCH_SIGNAL SIGUSR2
+#define WATCH_MASK (TIOCM_CD | TIOCM_RNG | TIOCM_DSR)
+#define STOP_RETRY_NSEC 100000000
+#define POWER_WAIT_USEC 60000000
+
+static pthread_once_t signalOnce = PTHREAD_ONCE_INIT;
+
+static void wake_handler(int sig) {
+    (void)sig;
+}
+
+static void install_handler(void) {
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = wake_handler;
+    sigemptyset(&action.sa_mask);
+    /* No SA_RESTART, so TIOCMIWAIT comes back with EINTR. */
+    action.sa_flags = 0;
+    sigaction(LINEWATCH_SIGNAL, &action, NULL);
+}
+
+static bool ring_count(linewatch_t *watch, uint32_t *rng) {
+    struct serial_icounter_struct counts;
+    if (rfc2217_ioctl(watch->fd, TIOCGICOUNT, &counts) != 0) {
+        return false;
+    }
+    *rng = counts.rng;
+    return true;
+}
+
+static void post(linewatch_t *watch, linewatch_event_t event) {
+    eventfd_write(watch->eventFd, 1);
+    if (watch->cb != NULL) {
+        watch->cb(watch->ctx, event);
+    }
+}
+
+static void got_change(linewatch_t *watch, int bits) {
+    int old = watch->bits;
+    uint32_t rng;
+    __atomic_store_n(&watch->bits, bits, __ATOMIC_RELEASE);
+    if ((old ^ bits) & TIOCM_DSR) {
+        if (bits & TIOCM_DSR) {
+            watch->dsrSeen = true;
+            if (__atomic_exchange_n(&watch->poweredOff, false, __ATOMIC_ACQ_REL)) {
+                log_info(watch->tag, "The modem's back.");
+                post(watch, LINEWATCH_POWER_ON);
+            }
+        } else if (watch->dsrSeen) {
+            __atomic_store_n(&watch->poweredOff, true, __ATOMIC_RELEASE);
+            log_error(watch->tag, "Lost DSR. The modem's been turned off or unplugged.");
+            post(watch, LINEWATCH_POWER_OFF);
+        }
+    }
+    if ((old ^ bits) & TIOCM_CD) {
+        log_debug(watch->tag, "DCD %s.", bits & TIOCM_CD ? "up" : "down");
+        post(watch, bits & TIOCM_CD ? LINEWATCH_CARRIER_UP : LINEWATCH_CARRIER_LOST);
+    }
+    /* The driver counts rings on the trailing edge of RI, so short ones between wakeups still count. */
+    if (ring_count(watch, &rng)) {
+        for (; watch->lastRng != rng; watch->lastRng++) {
+            __atomic_add_fetch(&watch->rings, 1, __ATOMIC_RELEASE);
+            post(watch, LINEWATCH_RING);
+        }
+    } else if ((old & TIOCM_RNG) && !(bits & TIOCM_RNG)) {
+        __atomic_add_fetch(&watch->rings, 1, __ATOMIC_RELEASE);
+        post(watch, LINEWATCH_RING);
+    }
+}
+
+static void *watch_thread(void *arg) {
+    linewatch_t *watch = arg;
+    while (__atomic_load_n(&watch->running, __ATOMIC_ACQUIRE)) {
+        int bits;
+        if (rfc2217_ioctl(watch->fd, TIOCMIWAIT, (void*)(uintptr_t)WATCH_MASK) != 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            log_debug(watch->tag, "Can't wait on the modem's control lines: %s", strerror(errno));
+            __atomic_store_n(&watch->running, false, __ATOMIC_RELEASE);
+            break;
+        }
+        if (rfc2217_ioctl(watch->fd, TIOCMGET, &bits) == 0) {
+            got_change(watch, bits);
+        }
+    }
+    return NULL;
+}
+
+bool linewatch_start(linewatch_t *watch, int fd, const char *tag, linewatch_cb cb, void *ctx) {
+    int bits;
+    memset(watch, 0, sizeof(*watch));
+    watch->fd = fd;
+    watch->tag = tag;
+    watch->cb = cb;
+    watch->ctx = ctx;
+    watch->eventFd = -1;
+    if (rfc2217_ioctl(fd, TIOCMGET, &bits) != 0) {
+        return false;
+    }
+    pthread_once(&signalOnce, install_handler);
+    if ((watch->eventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)) < 0) {
+        return false;
+    }
+    watch->bits = bits;
+    watch->dsrSeen = (bits & TIOCM_DSR) != 0;
+    ring_count(watch, &watch->lastRng);
+    watch->running = true;
+    if (pthread_create(&watch->thread, NULL, watch_thread, watch) != 0) {
+        watch->running = false;
+        close(watch->eventFd);
+        watch->eventFd = -1;
+        return false;
+    }
+    return true;
+}
+
+void linewatch_stop(linewatch_t *watch) {
+    if (watch->eventFd < 0) {
+        return;
+    }
+    __atomic_store_n(&watch->running, false, __ATOMIC_RELEASE);
+    /* Keep poking it, in case the first one landed before it got into TIOCMIWAIT. */
+    while (true) {
+        struct timespec until;
+        pthread_kill(watch->thread, LINEWATCH_SIGNAL);
+        clock_gettime(CLOCK_REALTIME, &until);
+        until.tv_nsec += STOP_RETRY_NSEC;
+        if (until.tv_nsec >= 1000000000) {
+            until.tv_sec++;
+            until.tv_nsec -= 1000000000;
+        }
+        if (pthread_timedjoin_np(watch->thread, NULL, &until) == 0) {
+            break;
+        }
+    }
+    close(watch->eventFd);
+    watch->eventFd = -1;
+}
+
+bool linewatch_active(const linewatch_t *watch) {
+    return watch->eventFd >= 0 && __atomic_load_n(&watch->running, __ATOMIC_ACQUIRE);
+}
+
+bool linewatch_powered(const linewatch_t *watch) {
+    /* Without a watcher we'd never hear it come back, so assume it's on. */
+    return !linewatch_active(watch) || !__atomic_load_n(&watch->poweredOff, __ATOMIC_ACQUIRE);
+}
+
+uint32_t linewatch_rings(const linewatch_t *watch) {
+    return __atomic_load_n(&watch->rings, __ATOMIC_ACQUIRE);
+}
+
+void linewatch_ack(const linewatch_t *watch) {
+    eventfd_t value;
+    if (watch->eventFd >= 0) {
+        eventfd_read(watch->eventFd, &value);
+    }
+}
+
+void linewatch_wake(const linewatch_t *watch) {
+    if (watch->eventFd >= 0) {
+        eventfd_write(watch->eventFd, 1);
+    }
+}
+
+void linewatch_wait_power(linewatch_t *watch, const bool *stop) {
+    while (linewatch_active(watch) && !linewatch_powered(watch) && !__atomic_load_n(stop, __ATOMIC_ACQUIRE)) {
+        if (clock_wait_readable(watch->eventFd, POWER_WAIT_USEC) == 1) {
+            linewatch_ack(watch);
+        }
+    }
+}
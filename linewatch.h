@@ -0,0 +1,65 @@
+#ifndef LINEWATCH_H
+#define LINEWATCH_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+/*
+ * Watches a modem's control lines (DCD, RI, DSR) without polling: a thread
+ * per line sits in TIOCMIWAIT and wakes up the moment one of them changes.
+ * Every change is handed to the callback (on the watcher's thread) and makes
+ * eventFd readable, so anything polling the line can add eventFd and look at
+ * DCD right away instead of on a timer.
+ *
+ * Lines that can't report their control lines (ptys, terminal server ports
+ * without com port control) don't get a thread, and everything that cares
+ * falls back to checking DCD every so often.
+ */
+
+/* How often to look at DCD anyway when there's a watcher, in case it missed something. */
+#define LINEWATCH_CHECK_USEC 60000000
+
+typedef enum {
+    LINEWATCH_CARRIER_UP = 0,
+    LINEWATCH_CARRIER_LOST,
+    LINEWATCH_RING,
+    /* DSR went away after we'd seen it, so the modem's been turned off or unplugged. */
+    LINEWATCH_POWER_OFF,
+    LINEWATCH_POWER_ON
+} linewatch_event_t;
+
+typedef void (*linewatch_cb)(void *ctx, linewatch_event_t event);
+
+typedef struct {
+    const char *tag;
+    int fd;
+    pthread_t thread;
+    bool running;
+    /* Readable after every change. Whoever's running the line reads it. -1 when there's no watcher. */
+    int eventFd;
+    linewatch_cb cb;
+    void *ctx;
+    /* TIOCMGET as of the last change. */
+    int bits;
+    bool dsrSeen;
+    bool poweredOff;
+    uint32_t rings;
+    /* The driver's ring counter when we last looked. */
+    uint32_t lastRng;
+} linewatch_t;
+
+/* Start watching fd. False (with eventFd -1) if the line can't tell us about its control lines. */
+bool linewatch_start(linewatch_t *watch, int fd, const char *tag, linewatch_cb cb, void *ctx);
+void linewatch_stop(linewatch_t *watch);
+bool linewatch_active(const linewatch_t *watch);
+bool linewatch_powered(const linewatch_t *watch);
+/* Rings since the watch started. */
+uint32_t linewatch_rings(const linewatch_t *watch);
+/* Clear eventFd after it's polled readable. */
+void linewatch_ack(const linewatch_t *watch);
+/* Make eventFd readable, to wake up whoever's waiting on the line. */
+void linewatch_wake(const linewatch_t *watch);
+/* Block until DSR comes back, or *stop is set and the watch woken. Returns right away if the modem's on or there's no watcher. */
+void linewatch_wait_power(linewatch_t *watch, const bool *stop);
+
+#endif
@@ -0,0 +1,317 @@
+#include <time.h>
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <linux/if_link.h>
+#include <linux/ppp-ioctl.h>
+#include <linux/ppp_defs.h>
+#include "log.h"
+#include "clock.h"
+#include "modem.h"
+#include "linkstats.h"
+
+#define LINKSTATS_TICK_NSEC 250000000
+#define DUMP_SIZE 32768
+#define MIN_RATE_USEC 1000000
+
+typedef struct {
+    bool watching;
+    /* Bumped by every watch, so a sample taken for an earlier call gets thrown away. */
+    uint32_t generation;
+    uint64_t lastUsec;
+    uint64_t lastActiveUsec;
+    /* Counters when the call started watching, and at the last sample. */
+    struct rtnl_link_stats64 base;
+    struct rtnl_link_stats64 last;
+    linkstats_t stats;
+} slot_t;
+
+typedef struct {
+    int line;
+    uint32_t generation;
+    char ifname[IFNAMSIZ];
+    bool found;
+    struct rtnl_link_stats64 counters;
+    uint64_t uncompressed;
+    uint64_t compressed;
+} sample_t;
+
+static slot_t slots[MAX_MODEMS];
+static pthread_mutex_t statsLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_t statsThread;
+static atomic_bool statsRunning = false;
+static int statsSock = -1;
+static int statsCtlSock = -1;
+
+static int open_sockets(int *ctlSock) {
+    struct timeval timeout = {1, 0};
+    int sock = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (sock < 0) {
+        return -1;
+    }
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    if (ctlSock != NULL && (*ctlSock = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0)) < 0) {
+        close(sock);
+        return -1;
+    }
+    return sock;
+}
+
+static void got_link(struct nlmsghdr *hdr, sample_t *samples, int count) {
+    struct ifinfomsg *link = NLMSG_DATA(hdr);
+    int len = IFLA_PAYLOAD(hdr);
+    const char *name = NULL;
+    struct rtattr *stats = NULL;
+    for (struct rtattr *attr = IFLA_RTA(link); RTA_OK(attr, len); attr = RTA_NEXT(attr, len)) {
+        if (attr->rta_type == IFLA_IFNAME) {
+            name = RTA_DATA(attr);
+        } else if (attr->rta_type == IFLA_STATS64) {
+            stats = attr;
+        }
+    }
+    if (name == NULL || stats == NULL) {
+        return;
+    }
+    for (int i = 0; i < count; i++) {
+        if (!samples[i].found && strcmp(samples[i].ifname, name) == 0) {
+            size_t size = RTA_PAYLOAD(stats) < sizeof(samples[i].counters) ? RTA_PAYLOAD(stats) : sizeof(samples[i].counters);
+            memset(&samples[i].counters, 0, sizeof(samples[i].counters));
+            memcpy(&samples[i].counters, RTA_DATA(stats), size);
+            samples[i].found = true;
+        }
+    }
+}
+
+/* One dump of every link for all the counters, then the compression counters of any ppp units. */
+static bool read_counters(int sock, int ctlSock, sample_t *samples, int count) {
+    uint8_t buf[DUMP_SIZE];
+    struct {
+        struct nlmsghdr hdr;
+        struct ifinfomsg link;
+    } req;
+    struct sockaddr_nl kernel = {.nl_family = AF_NETLINK};
+    ssize_t bytes;
+    bool done = false;
+    memset(&req, 0, sizeof(req));
+    req.hdr.nlmsg_len = NLMSG_LENGTH(sizeof(struct ifinfomsg));
+    req.hdr.nlmsg_type = RTM_GETLINK;
+    req.hdr.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    req.link.ifi_family = AF_UNSPEC;
+    for (int i = 0; i < count; i++) {
+        samples[i].found = false;
+    }
+    if (sendto(sock, &req, req.hdr.nlmsg_len, 0, (struct sockaddr*)&kernel, sizeof(kernel)) < 0) {
+        return false;
+    }
+    while (!done && (bytes = recv(sock, buf, sizeof(buf), 0)) > 0) {
+        for (struct nlmsghdr *hdr = (struct nlmsghdr*)buf; NLMSG_OK(hdr, bytes); hdr = NLMSG_NEXT(hdr, bytes)) {
+            if (hdr->nlmsg_type == NLMSG_DONE || hdr->nlmsg_type == NLMSG_ERROR) {
+                done = true;
+                break;
+            }
+            if (hdr->nlmsg_type == RTM_NEWLINK) {
+                got_link(hdr, samples, count);
+            }
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        struct ppp_comp_stats comp;
+        struct ifreq ifr;
+        samples[i].uncompressed = 0;
+        samples[i].compressed = 0;
+        if (!samples[i].found || strncmp(samples[i].ifname, "ppp", 3) != 0) {
+            continue;
+        }
+        memset(&ifr, 0, sizeof(ifr));
+        memset(&comp, 0, sizeof(comp));
+        strcpy(ifr.ifr_name, samples[i].ifname);
+        ifr.ifr_data = (char*)&comp;
+        if (ioctl(ctlSock, SIOCGPPPCSTATS, &ifr) == 0) {
+            samples[i].uncompressed = (uint64_t)comp.c.unc_bytes + comp.d.unc_bytes;
+            samples[i].compressed = (uint64_t)comp.c.comp_bytes + comp.d.comp_bytes;
+        }
+    }
+    return done;
+}
+
+static void update(slot_t *slot, const sample_t *sample, uint64_t now) {
+    const struct rtnl_link_stats64 *counters = &sample->counters;
+    linkstats_t *stats = &slot->stats;
+    uint64_t elapsed = now - slot->lastUsec;
+    bool active = counters->rx_packets != slot->last.rx_packets || counters->tx_packets != slot->last.tx_packets;
+    /* A sample right after the last one (the first, or the one when the call ends) would make a silly rate. */
+    if (elapsed >= MIN_RATE_USEC) {
+        stats->rxRate = (counters->rx_bytes - slot->last.rx_bytes)*1000000/elapsed;
+        stats->txRate = (counters->tx_bytes - slot->last.tx_bytes)*1000000/elapsed;
+    }
+    stats->peakRxRate = stats->rxRate > stats->peakRxRate ? stats->rxRate : stats->peakRxRate;
+    stats->peakTxRate = stats->txRate > stats->peakTxRate ? stats->txRate : stats->peakTxRate;
+    if (active) {
+        slot->lastActiveUsec = now;
+    } else {
+        stats->idleMs += elapsed/1000;
+    }
+    stats->idleForMs = (now - slot->lastActiveUsec)/1000;
+    stats->rxBytes = counters->rx_bytes - slot->base.rx_bytes;
+    stats->txBytes = counters->tx_bytes - slot->base.tx_bytes;
+    stats->rxPackets = counters->rx_packets - slot->base.rx_packets;
+    stats->txPackets = counters->tx_packets - slot->base.tx_packets;
+    stats->uncompressed = sample->uncompressed;
+    stats->compressed = sample->compressed;
+    slot->last = *counters;
+    slot->lastUsec = now;
+}
+
+static void sample_lines(void) {
+    static sample_t samples[MAX_MODEMS];
+    int lines = __atomic_load_n(&numModems, __ATOMIC_ACQUIRE);
+    int count = 0;
+    uint64_t now;
+    pthread_mutex_lock(&statsLock);
+    for (int i = 0; i < lines; i++) {
+        if (slots[i].watching) {
+            samples[count].line = i;
+            samples[count].generation = slots[i].generation;
+            strcpy(samples[count].ifname, slots[i].stats.ifname);
+            count++;
+        }
+    }
+    pthread_mutex_unlock(&statsLock);
+    if (count == 0) {
+        return;
+    }
+    read_counters(statsSock, statsCtlSock, samples, count);
+    now = clock_usec();
+    pthread_mutex_lock(&statsLock);
+    for (int i = 0; i < count; i++) {
+        slot_t *slot = &slots[samples[i].line];
+        if (samples[i].found && slot->watching && slot->generation == samples[i].generation) {
+            update(slot, &samples[i], now);
+        }
+    }
+    pthread_mutex_unlock(&statsLock);
+}
+
+static void *stats_thread(void *arg) {
+    struct timespec wait = {0, LINKSTATS_TICK_NSEC};
+    int ticks = 0;
+    (void)arg;
+    while (atomic_load(&statsRunning)) {
+        if (ticks-- <= 0) {
+            sample_lines();
+            ticks = LINKSTATS_INTERVAL_SEC*(1000000000/LINKSTATS_TICK_NSEC);
+        }
+        nanosleep(&wait, NULL);
+    }
+    return NULL;
+}
+
+int linkstats_init(void) {
+    if (atomic_load(&statsRunning)) {
+        return -1;
+    }
+    if ((statsSock = open_sockets(&statsCtlSock)) < 0) {
+        return -2;
+    }
+    atomic_store(&statsRunning, true);
+    if (pthread_create(&statsThread, NULL, stats_thread, NULL) != 0) {
+        atomic_store(&statsRunning, false);
+        close(statsSock);
+        close(statsCtlSock);
+        statsSock = -1;
+        return -3;
+    }
+    return 0;
+}
+
+void linkstats_shutdown(void) {
+    if (atomic_exchange(&statsRunning, false)) {
+        pthread_join(statsThread, NULL);
+        close(statsSock);
+        close(statsCtlSock);
+        statsSock = -1;
+    }
+}
+
+/* Sample just this line's interface, from the line's own thread. */
+static bool sample_now(const char *ifname, sample_t *sample) {
+    int sock;
+    int ctlSock;
+    memset(sample, 0, sizeof(*sample));
+    strcpy(sample->ifname, ifname);
+    if ((sock = open_sockets(&ctlSock)) < 0) {
+        return false;
+    }
+    read_counters(sock, ctlSock, sample, 1);
+    close(sock);
+    close(ctlSock);
+    return sample->found;
+}
+
+void linkstats_watch(int line, const char *ifname) {
+    sample_t sample;
+    slot_t *slot = &slots[line];
+    uint64_t now;
+    if (!atomic_load(&statsRunning) || line < 0 || line >= MAX_MODEMS || ifname[0] == 0) {
+        return;
+    }
+    pthread_mutex_lock(&statsLock);
+    if (slot->watching && strcmp(slot->stats.ifname, ifname) == 0) {
+        /* IPCP came up again on the same interface. Same call. */
+        pthread_mutex_unlock(&statsLock);
+        return;
+    }
+    pthread_mutex_unlock(&statsLock);
+    /* Count from here. pppd's interface doesn't exist yet, so it'll start from zero anyway. */
+    sample_now(ifname, &sample);
+    now = clock_usec();
+    pthread_mutex_lock(&statsLock);
+    memset(&slot->stats, 0, sizeof(slot->stats));
+    snprintf(slot->stats.ifname, sizeof(slot->stats.ifname), "%s", ifname);
+    slot->base = sample.counters;
+    slot->last = sample.counters;
+    slot->lastUsec = now;
+    slot->lastActiveUsec = now;
+    slot->generation++;
+    slot->watching = true;
+    pthread_mutex_unlock(&statsLock);
+    log_debug(NULL, "Watching %s for line %d.", ifname, line);
+}
+
+bool linkstats_get(int line, linkstats_t *stats) {
+    bool watching;
+    if (line < 0 || line >= MAX_MODEMS) {
+        return false;
+    }
+    pthread_mutex_lock(&statsLock);
+    if ((watching = slots[line].watching)) {
+        *stats = slots[line].stats;
+    }
+    pthread_mutex_unlock(&statsLock);
+    return watching;
+}
+
+bool linkstats_end(int line, linkstats_t *stats) {
+    sample_t sample;
+    slot_t *slot = &slots[line];
+    if (!linkstats_get(line, stats)) {
+        return false;
+    }
+    if (sample_now(stats->ifname, &sample)) {
+        pthread_mutex_lock(&statsLock);
+        update(slot, &sample, clock_usec());
+        pthread_mutex_unlock(&statsLock);
+    }
+    pthread_mutex_lock(&statsLock);
+    *stats = slot->stats;
+    slot->watching = false;
+    pthread_mutex_unlock(&statsLock);
+    return true;
+}
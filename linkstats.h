@@ -0,0 +1,50 @@
+#ifndef LINKSTATS_H
+#define LINKSTATS_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <net/if.h>
+
+/*
+ * Traffic through each call's network interface (the ppp or sl unit, or TUN
+ * device), for metrics and call records. Backends say which interface their
+ * line's call has, and every LINKSTATS_INTERVAL_SEC a background thread reads
+ * the counters of every interface being watched with one rtnetlink dump (and
+ * the compression counters of ppp units), so it costs the same with one call
+ * up as with hundreds.
+ *
+ * Lines in a multilink bundle share its interface, so they all show the
+ * bundle's traffic.
+ */
+
+#define LINKSTATS_INTERVAL_SEC 5
+
+typedef struct {
+    char ifname[IFNAMSIZ];
+    /* Since the call started watching. */
+    uint64_t rxBytes;
+    uint64_t txBytes;
+    uint64_t rxPackets;
+    uint64_t txPackets;
+    /* Bytes/s over the last interval, and the most it's been. */
+    uint32_t rxRate;
+    uint32_t txRate;
+    uint32_t peakRxRate;
+    uint32_t peakTxRate;
+    /* Time nothing went either way in: all of it, and since the last packet. */
+    uint64_t idleMs;
+    uint64_t idleForMs;
+    /* Both directions, before and after compression. 0 if it doesn't compress. */
+    uint64_t uncompressed;
+    uint64_t compressed;
+} linkstats_t;
+
+int linkstats_init(void);
+void linkstats_shutdown(void);
+/* Watch ifname for line's call. Does nothing unless linkstats_init() was called. */
+void linkstats_watch(int line, const char *ifname);
+/* Copy out the line's stats as of the last sample. False if it isn't being watched. */
+bool linkstats_get(int line, linkstats_t *stats);
+/* Take one last sample (if the interface is still there) and stop watching. */
+bool linkstats_end(int line, linkstats_t *stats);
+
+#endif
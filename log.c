@@ -0,0 +1,376 @@
+#include <time.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <errno.h>
+#include <stdarg.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include "ring.h"
+#include "log.h"
+
+#define LOG_SLOTS 4096
+#define LOG_TAG_MAX 16
+#define LOG_MSG_MAX 200
+/* Room for a record's arguments. Strings are copied in whole, so this is mostly them. */
+#define LOG_ARGS_MAX 192
+/* How long the writer naps when there's nothing to do. */
+#define LOG_IDLE_NSEC 10000000
+
+/*
+ * Records hold the format (always a literal, so it's still there when the
+ * writer gets to it) and the arguments as they were passed, so the printf
+ * work happens on the writer's thread instead of the caller's.
+ */
+typedef struct {
+    uint64_t nsec;
+    const char *fmt;
+    uint8_t level;
+    /* How many of fmt's conversions have their arguments in args. */
+    uint8_t numArgs;
+    char tag[LOG_TAG_MAX];
+    uint8_t args[LOG_ARGS_MAX];
+} log_record_t;
+
+typedef enum {
+    ARG_NONE = 0,
+    ARG_INT,
+    ARG_UINT,
+    ARG_DOUBLE,
+    ARG_STR,
+    ARG_PTR
+} log_arg_t;
+
+/* One conversion in a format. */
+typedef struct {
+    const char *start;
+    size_t len;
+    int stars;
+    /* 0 for int, 1 for long, 2 for long long, 3 for size_t. */
+    int size;
+    log_arg_t type;
+} log_spec_t;
+
+static ring_t logRing;
+static pthread_t logThread;
+static int logFd = -1;
+static log_level_t logMinLevel = LOG_LEVEL_INFO;
+/* Taking records. */
+static atomic_bool logRunning = false;
+/* Writing them. Stays up after logRunning goes down, until the last log_write that got in is done. */
+static atomic_bool logWriting = false;
+/* log_writes between checking logRunning and publishing. */
+static atomic_int logWriters = 0;
+static const char *levelNames[] = {"DEBUG", "INFO", "WARN", "ERROR"};
+
+static uint64_t monotonic_nsec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+static void write_all(int fd, const char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t res = write(fd, buf, len);
+        if (res < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        buf += res;
+        len -= res;
+    }
+}
+
+/* The conversion at p (a %). Returns where the text after it starts. */
+static const char *parse_spec(const char *p, log_spec_t *spec) {
+    spec->start = p++;
+    spec->stars = 0;
+    spec->size = 0;
+    while (*p != 0 && strchr("-+ #0'", *p) != NULL) {
+        p++;
+    }
+    while (*p == '*' || *p == '.' || isdigit((unsigned char)*p)) {
+        spec->stars += *p == '*';
+        p++;
+    }
+    for (; *p != 0 && strchr("hlqjztL", *p) != NULL; p++) {
+        if (*p == 'l' || *p == 'q') {
+            spec->size++;
+        } else if (*p == 'j') {
+            spec->size = 2;
+        } else if (*p == 'z' || *p == 't') {
+            spec->size = 3;
+        }
+    }
+    switch (*p) {
+        case 'd': case 'i': case 'c':
+            spec->type = ARG_INT;
+            break;
+        case 'u': case 'o': case 'x': case 'X':
+            spec->type = ARG_UINT;
+            break;
+        case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+            spec->type = ARG_DOUBLE;
+            break;
+        case 's':
+            spec->type = ARG_STR;
+            break;
+        case 'p':
+            spec->type = ARG_PTR;
+            break;
+        default:
+            spec->type = ARG_NONE;
+            break;
+    }
+    if (*p != 0) {
+        p++;
+    }
+    spec->len = p - spec->start;
+    return p;
+}
+
+/* Copy the arguments for fmt into rec. The ones that don't fit are left off, and the writer stops there. */
+static void put_args(log_record_t *rec, const char *fmt, va_list args) {
+    size_t used = 0;
+    rec->numArgs = 0;
+    while ((fmt = strchr(fmt, '%')) != NULL) {
+        log_spec_t spec;
+        fmt = parse_spec(fmt, &spec);
+        if (spec.type == ARG_NONE) {
+            continue;
+        }
+        if (used + (spec.stars + 1)*8 > LOG_ARGS_MAX || rec->numArgs == UINT8_MAX) {
+            return;
+        }
+        for (int i = 0; i < spec.stars; i++) {
+            int64_t star = va_arg(args, int);
+            memcpy(rec->args + used, &star, 8);
+            used += 8;
+        }
+        if (spec.type == ARG_STR) {
+            const char *str = va_arg(args, const char*);
+            size_t len;
+            str = str != NULL ? str : "(null)";
+            len = strnlen(str, LOG_ARGS_MAX - used - 1);
+            memcpy(rec->args + used, str, len);
+            rec->args[used + len] = 0;
+            used += len + 1;
+        } else if (spec.type == ARG_DOUBLE) {
+            double value = va_arg(args, double);
+            memcpy(rec->args + used, &value, 8);
+            used += 8;
+        } else if (spec.type == ARG_PTR) {
+            uint64_t value = (uintptr_t)va_arg(args, void*);
+            memcpy(rec->args + used, &value, 8);
+            used += 8;
+        } else {
+            int64_t value;
+            if (spec.size == 0) {
+                value = spec.type == ARG_INT ? (int64_t)va_arg(args, int) : (int64_t)va_arg(args, unsigned int);
+            } else if (spec.size == 1) {
+                value = spec.type == ARG_INT ? (int64_t)va_arg(args, long) : (int64_t)va_arg(args, unsigned long);
+            } else if (spec.size == 2) {
+                value = spec.type == ARG_INT ? (int64_t)va_arg(args, long long) : (int64_t)va_arg(args, unsigned long long);
+            } else {
+                value = spec.type == ARG_INT ? (int64_t)va_arg(args, ssize_t) : (int64_t)va_arg(args, size_t);
+            }
+            memcpy(rec->args + used, &value, 8);
+            used += 8;
+        }
+        rec->numArgs++;
+    }
+}
+
+/* Put the record's message together. Returns its length. */
+static int format_record(const log_record_t *rec, char *msg, size_t size) {
+    const char *p = rec->fmt;
+    const uint8_t *arg = rec->args;
+    size_t used = 0;
+    int numArgs = 0;
+    while (*p != 0 && used < size - 1) {
+        log_spec_t spec;
+        char conv[48];
+        size_t convLen = 0;
+        int64_t value;
+        int len;
+        if (*p != '%') {
+            msg[used++] = *p++;
+            continue;
+        }
+        p = parse_spec(p, &spec);
+        if (spec.type == ARG_NONE) {
+            /* %%, or something we don't know. */
+            msg[used++] = spec.len > 1 && spec.start[spec.len - 1] == '%' ? '%' : '?';
+            continue;
+        }
+        if (numArgs++ == rec->numArgs) {
+            used += snprintf(msg + used, size - used, "...");
+            break;
+        }
+        /* Write the *s out as the numbers they were. */
+        for (size_t i = 0; i < spec.len && convLen < sizeof(conv) - 12; i++) {
+            if (spec.start[i] == '*') {
+                memcpy(&value, arg, 8);
+                arg += 8;
+                convLen += snprintf(conv + convLen, sizeof(conv) - convLen, "%d", (int)value);
+            } else {
+                conv[convLen++] = spec.start[i];
+            }
+        }
+        conv[convLen] = 0;
+        if (spec.type == ARG_STR) {
+            len = snprintf(msg + used, size - used, conv, (const char*)arg);
+            arg += strlen((const char*)arg) + 1;
+        } else if (spec.type == ARG_DOUBLE) {
+            double d;
+            memcpy(&d, arg, 8);
+            arg += 8;
+            len = snprintf(msg + used, size - used, conv, d);
+        } else {
+            memcpy(&value, arg, 8);
+            arg += 8;
+            if (spec.type == ARG_PTR) {
+                len = snprintf(msg + used, size - used, conv, (void*)(uintptr_t)value);
+            } else if (spec.size == 0) {
+                len = spec.type == ARG_INT ? snprintf(msg + used, size - used, conv, (int)value) : snprintf(msg + used, size - used, conv, (unsigned int)value);
+            } else if (spec.size == 1) {
+                len = spec.type == ARG_INT ? snprintf(msg + used, size - used, conv, (long)value) : snprintf(msg + used, size - used, conv, (unsigned long)value);
+            } else if (spec.size == 2) {
+                len = spec.type == ARG_INT ? snprintf(msg + used, size - used, conv, (long long)value) : snprintf(msg + used, size - used, conv, (unsigned long long)value);
+            } else {
+                len = spec.type == ARG_INT ? snprintf(msg + used, size - used, conv, (ssize_t)value) : snprintf(msg + used, size - used, conv, (size_t)value);
+            }
+        }
+        if (len > 0) {
+            used += len;
+        }
+    }
+    used = used < size - 1 ? used : size - 1;
+    msg[used] = 0;
+    return used;
+}
+
+/* Format everything in the ring into one buffer and write it with a single call. */
+static bool log_drain(uint64_t *lastDropped) {
+    static char out[65536];
+    char msg[LOG_MSG_MAX];
+    size_t used = 0;
+    log_record_t *rec;
+    bool any = false;
+    while ((rec = ring_peek(&logRing)) != NULL) {
+        if (sizeof(out) - used < LOG_MSG_MAX + LOG_TAG_MAX + 48) {
+            write_all(logFd, out, used);
+            used = 0;
+        }
+        format_record(rec, msg, sizeof(msg));
+        used += snprintf(out + used, sizeof(out) - used, "[%5" PRIu64 ".%06" PRIu64 "] %-5s %s%s%s\n",
+            rec->nsec/1000000000, (rec->nsec/1000)%1000000, levelNames[rec->level],
+            rec->tag, rec->tag[0] ? ": " : "", msg);
+        ring_release(&logRing);
+        any = true;
+    }
+    uint64_t dropped = ring_dropped(&logRing);
+    if (dropped != *lastDropped) {
+        if (sizeof(out) - used < LOG_MSG_MAX + LOG_TAG_MAX + 48) {
+            write_all(logFd, out, used);
+            used = 0;
+        }
+        used += snprintf(out + used, sizeof(out) - used, "[%5" PRIu64 ".%06" PRIu64 "] WARN  log: %" PRIu64 " records dropped\n",
+            monotonic_nsec()/1000000000, (monotonic_nsec()/1000)%1000000, dropped - *lastDropped);
+        *lastDropped = dropped;
+    }
+    if (used > 0) {
+        write_all(logFd, out, used);
+    }
+    return any;
+}
+
+static void *log_thread(void *arg) {
+    uint64_t lastDropped = 0;
+    struct timespec idle = {0, LOG_IDLE_NSEC};
+    (void)arg;
+    while (atomic_load(&logWriting)) {
+        if (!log_drain(&lastDropped)) {
+            nanosleep(&idle, NULL);
+        }
+    }
+    /* Get out whatever is left. */
+    log_drain(&lastDropped);
+    return NULL;
+}
+
+int log_init(int fd, log_level_t minLevel) {
+    if (atomic_load(&logRunning)) {
+        return -1;
+    }
+    if (ring_init(&logRing, LOG_SLOTS, sizeof(log_record_t)) != 0) {
+        return -2;
+    }
+    logFd = fd;
+    logMinLevel = minLevel;
+    atomic_store(&logWriting, true);
+    if (pthread_create(&logThread, NULL, log_thread, NULL) != 0) {
+        atomic_store(&logWriting, false);
+        ring_free(&logRing);
+        return -3;
+    }
+    atomic_store(&logRunning, true);
+    return 0;
+}
+
+void log_shutdown(void) {
+    struct timespec wait = {0, 1000000};
+    if (atomic_exchange(&logRunning, false)) {
+        /* Anything that got in before we stopped taking records still gets written, and nothing's using the ring once it's freed. */
+        while (atomic_load(&logWriters) > 0) {
+            nanosleep(&wait, NULL);
+        }
+        atomic_store(&logWriting, false);
+        pthread_join(logThread, NULL);
+        ring_free(&logRing);
+    }
+}
+
+void log_write(log_level_t level, const char *tag, const char *fmt, ...) {
+    va_list args;
+    log_record_t *rec;
+    if (level < logMinLevel) {
+        return;
+    }
+    va_start(args, fmt);
+    atomic_fetch_add(&logWriters, 1);
+    if (!atomic_load(&logRunning)) {
+        /* Logger isn't up (or is gone). Just print it. */
+        atomic_fetch_sub(&logWriters, 1);
+        if (tag != NULL && tag[0]) {
+            fprintf(stderr, "%s: ", tag);
+        }
+        vfprintf(stderr, fmt, args);
+        fputc('\n', stderr);
+        va_end(args);
+        return;
+    }
+    if ((rec = ring_claim(&logRing)) != NULL) {
+        rec->nsec = monotonic_nsec();
+        rec->level = level;
+        rec->fmt = fmt;
+        if (tag != NULL) {
+            strncpy(rec->tag, tag, LOG_TAG_MAX - 1);
+            rec->tag[LOG_TAG_MAX - 1] = 0;
+        } else {
+            rec->tag[0] = 0;
+        }
+        put_args(rec, fmt, args);
+        ring_publish(&logRing, rec);
+    }
+    atomic_fetch_sub(&logWriters, 1);
+    va_end(args);
+}
+
+uint64_t log_dropped(void) {
+    return ring_dropped(&logRing);
+}
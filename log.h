@@ -0,0 +1,28 @@
+#ifndef LOG_H
+#define LOG_H
+#include <stdint.h>
+
+typedef enum {
+    LOG_LEVEL_DEBUG = 0,
+    LOG_LEVEL_INFO,
+    LOG_LEVEL_WARN,
+    LOG_LEVEL_ERROR
+} log_level_t;
+
+/*
+ * Logging never blocks the caller. Records go into a lock-free ring and a
+ * background thread formats them and writes them out. If the ring is full the
+ * record is dropped and counted. Only the arguments get copied, so the format
+ * has to be a literal.
+ */
+int log_init(int fd, log_level_t minLevel);
+void log_shutdown(void);
+void log_write(log_level_t level, const char *tag, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+uint64_t log_dropped(void);
+
+#define log_debug(tag, ...) log_write(LOG_LEVEL_DEBUG, tag, __VA_ARGS__)
+#define log_info(tag, ...) log_write(LOG_LEVEL_INFO, tag, __VA_ARGS__)
+#define log_warn(tag, ...) log_write(LOG_LEVEL_WARN, tag, __VA_ARGS__)
+#define log_error(tag, ...) log_write(LOG_LEVEL_ERROR, tag, __VA_ARGS__)
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef MD5_H
+#define MD5_H
+#include <stddef.h>
+#include <stdint.h>
+
+/* Plain RFC 1321 MD5. Only here for CHAP. */
+typedef struct {
+    uint32_t state[4];
+    uint64_t length;
+    uint8_t buf[64];
+} md5_t;
+
+void md5_init(md5_t *md5);
+void md5_update(md5_t *md5, const void *data, size_t len);
+void md5_final(md5_t *md5, uint8_t digest[16]);
+
+#endif
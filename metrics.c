@@ -0,0 +1,270 @@
+#include <time.h>
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "log.h"
+#include "cdr.h"
+#include "mp.h"
+#include "modem.h"
+#include "linkstats.h"
+#include "metrics.h"
+#include "record.h"
+
+#define METRICS_TICK_NSEC 250000000
+#define MAX_BUNDLES 64
+#define MAX_TUNNELS 16
+
+static pthread_t metricsThread;
+static atomic_bool metricsRunning = false;
+static char metricsPath[512];
+static char metricsTmp[520];
+
+static const char *stateNames[] = {"idle", "dialtone", "dialing", "connecting", "connected", "prompt"};
+
+/* Label values can't have raw quotes, backslashes or newlines. */
+static void put_label(FILE *file, const char *value) {
+    for (; *value; value++) {
+        if (*value == '"' || *value == '\\') {
+            fputc('\\', file);
+        }
+        if (*value == '\n') {
+            fputs("\\n", file);
+        } else {
+            fputc(*value, file);
+        }
+    }
+}
+
+/* From each line's last line test. Lines that haven't had one are left out. */
+static void write_quality(FILE *file, int lines) {
+    fputs("# HELP dialin_line_quality_score How the line did in its last line test, out of 100.\n"
+          "# TYPE dialin_line_quality_score gauge\n", file);
+    for (int i = 0; i < lines; i++) {
+        if (modems[i]->quality.tested) {
+            fputs("dialin_line_quality_score{line=\"", file);
+            put_label(file, modems[i]->tag);
+            fprintf(file, "\"} %d\n", modems[i]->quality.score);
+        }
+    }
+    fputs("# HELP dialin_line_snr_db Worst SNR of the tones in the line's last line test.\n"
+          "# TYPE dialin_line_snr_db gauge\n", file);
+    for (int i = 0; i < lines; i++) {
+        if (modems[i]->quality.tested) {
+            fputs("dialin_line_snr_db{line=\"", file);
+            put_label(file, modems[i]->tag);
+            fprintf(file, "\"} %.1f\n", modems[i]->quality.snrDb);
+        }
+    }
+    fputs("# HELP dialin_line_noise_dbfs The line's noise floor in its last line test.\n"
+          "# TYPE dialin_line_noise_dbfs gauge\n", file);
+    for (int i = 0; i < lines; i++) {
+        if (modems[i]->quality.tested) {
+            fputs("dialin_line_noise_dbfs{line=\"", file);
+            put_label(file, modems[i]->tag);
+            fprintf(file, "\"} %.1f\n", modems[i]->quality.noiseDb);
+        }
+    }
+    fputs("# HELP dialin_line_response_db How loud each test tone came back, relative to 1000 Hz.\n"
+          "# TYPE dialin_line_response_db gauge\n", file);
+    for (int i = 0; i < lines; i++) {
+        if (modems[i]->quality.tested) {
+            for (int f = 0; f < LINETEST_FREQS; f++) {
+                fputs("dialin_line_response_db{line=\"", file);
+                put_label(file, modems[i]->tag);
+                fprintf(file, "\",hz=\"%.0f\"} %.1f\n", linetestFreqs[f], modems[i]->quality.responseDb[f]);
+            }
+        }
+    }
+}
+
+static void write_lines(FILE *file) {
+    int lines = __atomic_load_n(&numModems, __ATOMIC_ACQUIRE);
+    fputs("# HELP dialin_line_state What each line is doing. 1 for the state it's in.\n"
+          "# TYPE dialin_line_state gauge\n", file);
+    for (int i = 0; i < lines; i++) {
+        modem_state_t state = modems[i]->state;
+        for (int s = 0; s < sizeof(stateNames)/sizeof(stateNames[0]); s++) {
+            fputs("dialin_line_state{line=\"", file);
+            put_label(file, modems[i]->tag);
+            fprintf(file, "\",state=\"%s\"} %d\n", stateNames[s], state == s);
+        }
+    }
+    fputs("# HELP dialin_line_backend What's got the line, for lines with a call on them.\n"
+          "# TYPE dialin_line_backend gauge\n", file);
+    for (int i = 0; i < lines; i++) {
+        if (modems[i]->state == CONNECTED) {
+            fputs("dialin_line_backend{line=\"", file);
+            put_label(file, modems[i]->tag);
+            fprintf(file, "\",backend=\"%s\"} 1\n", backend_name(modems[i]->backend));
+        }
+    }
+    write_quality(file, lines);
+}
+
+static void write_bundles(FILE *file) {
+    static mp_info_t bundles[MAX_BUNDLES];
+    int count = mp_snapshot(bundles, MAX_BUNDLES);
+    int lines = __atomic_load_n(&numModems, __ATOMIC_ACQUIRE);
+    fputs("# HELP dialin_bundle_links How many lines are in each multilink bundle.\n"
+          "# TYPE dialin_bundle_links gauge\n", file);
+    for (int i = 0; i < count; i++) {
+        fputs("dialin_bundle_links{bundle=\"", file);
+        put_label(file, bundles[i].key);
+        fputs("\",interface=\"", file);
+        put_label(file, bundles[i].ifname);
+        fprintf(file, "\"} %d\n", bundles[i].numLinks);
+    }
+    fputs("# HELP dialin_bundle_member Which lines are in which multilink bundle.\n"
+          "# TYPE dialin_bundle_member gauge\n", file);
+    for (int i = 0; i < count; i++) {
+        for (int j = 0; j < MP_MAX_LINKS && bundles[i].tags[j][0]; j++) {
+            fputs("dialin_bundle_member{bundle=\"", file);
+            put_label(file, bundles[i].key);
+            fputs("\",line=\"", file);
+            put_label(file, bundles[i].tags[j]);
+            fputs("\",backend=\"ppp\"} 1\n", file);
+        }
+    }
+    /* pppd does its own bundling, so all we know is which calls we told it to bundle. */
+    for (int i = 0; i < lines; i++) {
+        const dialplan_entry_t *route = modems[i]->route;
+        if (modems[i]->state == CONNECTED && modems[i]->backend == BACKEND_PPPD && route != NULL && route->multilink) {
+            fputs("dialin_bundle_member{bundle=\"", file);
+            put_label(file, modems[i]->call.digits);
+            fputs("\",line=\"", file);
+            put_label(file, modems[i]->tag);
+            fputs("\",backend=\"pppd\"} 1\n", file);
+        }
+    }
+}
+
+static void write_tunnels(FILE *file) {
+    static l2tp_info_t tunnels[MAX_TUNNELS];
+    int count = l2tp_snapshot(tunnels, MAX_TUNNELS);
+    fputs("# HELP dialin_l2tp_sessions Calls in the L2TP tunnel to each LNS.\n"
+          "# TYPE dialin_l2tp_sessions gauge\n", file);
+    for (int i = 0; i < count; i++) {
+        fputs("dialin_l2tp_sessions{lns=\"", file);
+        put_label(file, tunnels[i].target);
+        fprintf(file, "\"} %d\n", tunnels[i].numSessions);
+    }
+}
+
+static void put_session(FILE *file, const char *name, const modem_t *modem, const linkstats_t *stats, const char *direction) {
+    fprintf(file, "%s{line=\"", name);
+    put_label(file, modem->tag);
+    fputs("\",interface=\"", file);
+    put_label(file, stats->ifname);
+    if (direction != NULL) {
+        fprintf(file, "\",direction=\"%s", direction);
+    }
+    fputs("\"} ", file);
+}
+
+static void write_sessions(FILE *file) {
+    static linkstats_t stats[MAX_MODEMS];
+    static bool watched[MAX_MODEMS];
+    int lines = __atomic_load_n(&numModems, __ATOMIC_ACQUIRE);
+    for (int i = 0; i < lines; i++) {
+        watched[i] = modems[i]->state == CONNECTED && linkstats_get(modems[i]->index, &stats[i]);
+    }
+    fputs("# HELP dialin_session_bytes What's gone through each call's interface so far.\n"
+          "# TYPE dialin_session_bytes gauge\n", file);
+    for (int i = 0; i < lines; i++) {
+        if (watched[i]) {
+            put_session(file, "dialin_session_bytes", modems[i], &stats[i], "rx");
+            fprintf(file, "%llu\n", (unsigned long long)stats[i].rxBytes);
+            put_session(file, "dialin_session_bytes", modems[i], &stats[i], "tx");
+            fprintf(file, "%llu\n", (unsigned long long)stats[i].txBytes);
+        }
+    }
+    fputs("# HELP dialin_session_throughput_bytes_per_second Bytes/s through each call's interface over the last sample.\n"
+          "# TYPE dialin_session_throughput_bytes_per_second gauge\n", file);
+    for (int i = 0; i < lines; i++) {
+        if (watched[i]) {
+            put_session(file, "dialin_session_throughput_bytes_per_second", modems[i], &stats[i], "rx");
+            fprintf(file, "%u\n", stats[i].rxRate);
+            put_session(file, "dialin_session_throughput_bytes_per_second", modems[i], &stats[i], "tx");
+            fprintf(file, "%u\n", stats[i].txRate);
+        }
+    }
+    fputs("# HELP dialin_session_idle_seconds How long since each call's interface last carried a packet.\n"
+          "# TYPE dialin_session_idle_seconds gauge\n", file);
+    for (int i = 0; i < lines; i++) {
+        if (watched[i]) {
+            put_session(file, "dialin_session_idle_seconds", modems[i], &stats[i], NULL);
+            fprintf(file, "%.1f\n", stats[i].idleForMs/1000.0);
+        }
+    }
+    fputs("# HELP dialin_session_compression_ratio Bytes before compression per byte after, for calls that compress.\n"
+          "# TYPE dialin_session_compression_ratio gauge\n", file);
+    for (int i = 0; i < lines; i++) {
+        if (watched[i] && stats[i].compressed > 0) {
+            put_session(file, "dialin_session_compression_ratio", modems[i], &stats[i], NULL);
+            fprintf(file, "%.2f\n", (double)stats[i].uncompressed/stats[i].compressed);
+        }
+    }
+}
+
+static void write_metrics(void) {
+    FILE *file = fopen(metricsTmp, "w");
+    if (file == NULL) {
+        log_warn("metrics", "Couldn't open %s: %s", metricsTmp, strerror(errno));
+        return;
+    }
+    write_lines(file);
+    write_bundles(file);
+    write_tunnels(file);
+    write_sessions(file);
+    fputs("# HELP dialin_cdr_overflow_total Call records that didn't fit in the queue, and were written straight out.\n"
+          "# TYPE dialin_cdr_overflow_total counter\n", file);
+    fprintf(file, "dialin_cdr_overflow_total %llu\n", cdrEnabled ? (unsigned long long)cdr_overflowed() : 0ULL);
+    fputs("# HELP dialin_recording_dropped_total Blocks of recorded call audio that didn't fit in the queue.\n"
+          "# TYPE dialin_recording_dropped_total counter\n", file);
+    fprintf(file, "dialin_recording_dropped_total %llu\n", (unsigned long long)record_dropped());
+    if (fclose(file) != 0 || rename(metricsTmp, metricsPath) != 0) {
+        log_warn("metrics", "Couldn't write %s: %s", metricsPath, strerror(errno));
+    }
+}
+
+static void *metrics_thread(void *arg) {
+    struct timespec wait = {0, METRICS_TICK_NSEC};
+    int ticks = 0;
+    (void)arg;
+    while (atomic_load(&metricsRunning)) {
+        if (ticks-- <= 0) {
+            write_metrics();
+            ticks = METRICS_INTERVAL_SEC*(1000000000/METRICS_TICK_NSEC);
+        }
+        nanosleep(&wait, NULL);
+    }
+    return NULL;
+}
+
+int metrics_init(const char *path) {
+    FILE *file;
+    if (atomic_load(&metricsRunning)) {
+        return -1;
+    }
+    snprintf(metricsPath, sizeof(metricsPath), "%s", path);
+    snprintf(metricsTmp, sizeof(metricsTmp), "%s.tmp", path);
+    /* Make sure we can write there before we go. */
+    if ((file = fopen(metricsTmp, "w")) == NULL) {
+        return -2;
+    }
+    fclose(file);
+    atomic_store(&metricsRunning, true);
+    if (pthread_create(&metricsThread, NULL, metrics_thread, NULL) != 0) {
+        atomic_store(&metricsRunning, false);
+        return -3;
+    }
+    return 0;
+}
+
+void metrics_shutdown(void) {
+    if (atomic_exchange(&metricsRunning, false)) {
+        pthread_join(metricsThread, NULL);
+    }
+}
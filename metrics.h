@@ -0,0 +1,16 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+/*
+ * Every few seconds a background thread writes what the lines are doing to a
+ * file in Prometheus' text format, for node_exporter's textfile collector (or
+ * anything else that can read a file). It's written to path.tmp and renamed
+ * over path, so readers never see half of it.
+ */
+
+#define METRICS_INTERVAL_SEC 5
+
+int metrics_init(const char *path);
+void metrics_shutdown(void);
+
+#endif
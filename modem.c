@@ -0,0 +1,1559 @@
+#define _GNU_SOURCE
+#include <time.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <poll.h>
+#include <termios.h>
+#include <sys/wait.h>
+#include <inttypes.h>
+#include <sys/ioctl.h>
+#include "log.h"
+#include "cdr.h"
+#include "at.h"
+#include "voice.h"
+#include "clock.h"
+#include "modem.h"
+#include "rfc2217.h"
+#include "linkstats.h"
+#include "watchdog.h"
+#include "linewatch.h"
+#include "training.h"
+#include "linetest.h"
+#include "prompt.h"
+#include "audio.h"
+#include "assets.h"
+#include "record.h"
+
+char pppdPath[256] = "/usr/sbin/pppd";
+modem_t *modems[MAX_MODEMS];
+int numModems = 0;
+bool cdrEnabled = false;
+ppp_config_t pppConfig;
+dialplan_t dialPlan;
+backend_t defaultBackend = BACKEND_PPPD;
+unsigned int answerRings = 0;
+bool stopping = false;
+caller_table_t callerTable;
+static pthread_mutex_t modemsLock = PTHREAD_MUTEX_INITIALIZER;
+/* Every line plays the dialtone from here, in whatever format its modem uses. Unpacked from assets.c the first time it's needed. */
+static audio_asset_t dialtoneAsset;
+static uint8_t *dialtone = NULL;
+static pthread_once_t dialtoneOnce = PTHREAD_ONCE_INIT;
+
+static uint64_t mono_msec(void) {
+    return clock_usec()/1000;
+}
+
+/* ms spent in the current phase of the call. Starts the next one. */
+uint32_t end_phase(modem_t *modem) {
+    uint64_t now = mono_msec();
+    uint32_t ms = now - modem->phaseStart;
+    modem->phaseStart = now;
+    return ms;
+}
+
+bool send_string(int fd, char* str) {
+    return write(fd, str, strlen(str)) == strlen(str);
+}
+
+/* Drop DTR long enough for the modem to hang up. Lines without DTR get +++ and ATH. */
+void hangup_line(modem_t *modem) {
+    int bits = TIOCM_DTR;
+    if (rfc2217_ioctl(modem->fd, TIOCMBIC, &bits) == 0) {
+        clock_sleep(1000000);
+        rfc2217_ioctl(modem->fd, TIOCMBIS, &bits);
+        return;
+    }
+    clock_sleep(1100000);
+    send_string(modem->fd, "+++");
+    clock_sleep(1100000);
+    tcflush(modem->fd, TCIFLUSH);
+    send_string(modem->fd, "ATH\r\n");
+    get_response(modem, 5);
+}
+
+void reset_modem(modem_t *modem) {
+    send_string(modem->fd, "ATZ0\r\n");
+    clock_sleep(1000000);
+	send_string(modem->fd, "ATE\r\n");
+	send_string(modem->fd, "ATV\r\n");
+    /* Let the responses come in before we throw them away. */
+    clock_sleep(200000);
+    tcflush(modem->fd, TCIFLUSH);
+    modem->state = IDLE;
+}
+
+/* Runs on the line watcher's thread. */
+static void line_event(void *ctx, linewatch_event_t event) {
+    modem_t *modem = ctx;
+    pid_t pppd = __atomic_load_n(&modem->pppd, __ATOMIC_ACQUIRE);
+    switch (event) {
+        case LINEWATCH_RING:
+            log_debug(modem->tag, "Ring.");
+            break;
+        case LINEWATCH_CARRIER_LOST:
+        case LINEWATCH_POWER_OFF:
+            /* Our own backends hear about it through statusFd. pppd has CLOCAL set, so it has to be told. */
+            if (modem->state == CONNECTED && modem->backend == BACKEND_PPPD && pppd > 0) {
+                log_info(modem->tag, "Lost carrier. Hanging up pppd.");
+                kill(pppd, SIGHUP);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/* The watcher's eventFd, for a backend to poll. -1 if there's no watcher. */
+static int status_fd(modem_t *modem) {
+    return linewatch_active(&modem->lineWatch) ? modem->lineWatch.eventFd : -1;
+}
+
+int init_modem(modem_t *modem, char *path, unsigned int rate) {
+    struct termios tty;
+    speed_t speed;
+    char ttyPath[64] = "";
+
+    if (numModems < MAX_MODEMS) {
+        switch (rate) {
+            case 50:
+                speed = B50;
+                break;
+            case 75:
+                speed = B75;
+                break;
+            case 110:
+                speed = B110;
+                break;
+            case 134:
+                speed = B134;
+                break;
+            case 150:
+                speed = B150;
+                break;
+            case 200:
+                speed = B200;
+                break;
+            case 300:
+                speed = B300;
+                break;
+            case 600:
+                speed = B600;
+                break;
+            case 1200:
+                speed = B1200;
+                break;
+            case 1800:
+                speed = B1800;
+                break;
+            case 2400:
+                speed = B2400;
+                break;
+            case 4800:
+                speed = B4800;
+                break;
+            case 9600:
+                speed = B9600;
+                break;
+            case 19200:
+                speed = B19200;
+                break;
+            case 38400:
+                speed = B38400;
+                break;
+            case 57600:
+                speed = B57600;
+                break;
+            case 115200:
+                speed = B115200;
+                break;
+            case 230400:
+                speed = B230400;
+                break;
+            default:
+                return -1;
+        }
+
+        /* Open the TTY device */
+        if (modem == NULL) {
+            return -2;
+        }
+        modem->lineWatch.eventFd = -1;
+        if (rfc2217_is_remote(path)) {
+            /* A port on a terminal server. We get a pty that stands in for it. */
+            modem->fd = rfc2217_open(path, rate, ttyPath, sizeof(ttyPath));
+        } else {
+            modem->fd = open(path, O_RDWR | O_NOCTTY);
+        }
+        if (modem->fd < 0) {
+            return -3;
+        }
+
+        /* Get the TTY device's attributes. */
+        if (tcgetattr(modem->fd, &tty) != 0) {
+            return -4;
+        }
+
+        /* Assuming defaults for reasonably modern modems. */
+        cfsetispeed(&tty, speed);
+        cfsetospeed(&tty, speed);
+        tty.c_cflag &= ~(PARENB | CSTOPB | CSIZE);
+        tty.c_cflag |= CS8 | CREAD | CLOCAL;
+        tty.c_lflag = 0;
+        tty.c_oflag = 0;
+        tty.c_cc[VMIN] = 0;
+        tty.c_cc[VTIME] = 10;
+
+        /* Apply configuration. */
+        if (tcsetattr(modem->fd, TCSANOW, &tty) != 0) {
+            return -4;
+        }
+        reset_modem(modem);
+        if (modem->path != path) {
+            strncpy(modem->path, path, sizeof(modem->path));
+            modem->path[sizeof(modem->path) - 1] = 0;
+        }
+        /* Tag log messages with the TTY's name, minus the /dev/ part (or the host:port of a remote one). */
+        strncpy(modem->tag, strrchr(path, '/') ? strrchr(path, '/') + 1 : path, sizeof(modem->tag));
+        modem->tag[sizeof(modem->tag) - 1] = 0;
+        if (ttyPath[0] != 0) {
+            /* pppd wants a TTY. */
+            log_info(modem->tag, "Remote port is on %s.", ttyPath);
+            strcpy(modem->path, ttyPath);
+        }
+        modem->rate = rate;
+        /* Modems start up on their own threads. */
+        pthread_mutex_lock(&modemsLock);
+        if (numModems >= MAX_MODEMS) {
+            pthread_mutex_unlock(&modemsLock);
+            rfc2217_close(modem->fd);
+            return -5;
+        }
+        modem->index = numModems;
+        modems[numModems] = modem;
+        numModems++;
+        pthread_mutex_unlock(&modemsLock);
+        if (!linewatch_start(&modem->lineWatch, modem->fd, modem->tag, line_event, modem)) {
+            log_debug(modem->tag, "Can't watch the control lines. Checking DCD every second instead.");
+        }
+        return 0;
+    }
+    return -5;
+}
+
+/* Get a response code from the modem. */
+int get_response(modem_t *modem, unsigned int attempts) {
+    char buf[1024] = {0};
+    int bytes;
+    /* 0 attempts to read doesn't make sense. */
+    if (attempts == 0) {
+        attempts = 1;
+    }
+
+    /* Each attempt waits up to 1s for something to come in. */
+    for (int i = 0; i < attempts; i++) {
+        if (clock_wait_readable(modem->fd, 1000000) == 1 && (bytes = read(modem->fd, buf, 1024)) > 0) {
+            break;
+        }
+        bytes = 0;
+    }
+
+    if (bytes <= 0) {
+        return -1;
+    }
+
+    if (bytes < 1024) {
+        buf[bytes] = 0;
+    } else {
+        buf[1023] = 0;
+    }
+
+    log_debug(modem->tag, "Response: %s", buf);
+    strncpy(modem->lastResponse, buf, sizeof(modem->lastResponse));
+    modem->lastResponse[sizeof(modem->lastResponse) - 1] = 0;
+
+    return at_parse_result(buf, bytes);
+}
+
+/* Pull what we can about the connection out of the CONNECT response. */
+void parse_connect(modem_t *modem, int code) {
+    char *str;
+    unsigned int rate;
+    modem->call.connectCode = code;
+    modem->call.connectRate = at_connect_rate(code);
+    /* Verbose result codes. */
+    if ((str = strstr(modem->lastResponse, "CONNECT ")) != NULL && sscanf(str + 8, "%u", &rate) == 1) {
+        modem->call.connectRate = rate;
+    }
+    /* Modems that report the error correction protocol. */
+    if ((str = strstr(modem->lastResponse, "PROTOCOL: ")) != NULL) {
+        str += 10;
+    } else if ((str = strstr(modem->lastResponse, "+ER: ")) != NULL) {
+        str += 5;
+    } else if ((str = strchr(modem->lastResponse, '/')) != NULL) {
+        str += 1;
+    }
+    if (str != NULL) {
+        int i;
+        for (i = 0; i < sizeof(modem->call.protocol) - 1 && str[i] > ' '; i++) {
+            modem->call.protocol[i] = str[i];
+        }
+        modem->call.protocol[i] = 0;
+    }
+}
+
+/* Start a new call record. */
+void begin_call(modem_t *modem) {
+    memset(&modem->call, 0, sizeof(modem->call));
+    strcpy(modem->call.modem, modem->tag);
+    modem->call.startUsec = clock_wall_usec();
+    modem->call.exitStatus = -1;
+    modem->call.connectCode = -1;
+    modem->phaseStart = mono_msec();
+}
+
+/* Finish the call record and queue it up to be written. */
+void end_call(modem_t *modem) {
+    struct serial_icounter_struct counts;
+    if (modem->recording != NULL) {
+        record_stop(modem->recording);
+        modem->recording = NULL;
+    }
+    if (!cdrEnabled) {
+        return;
+    }
+    modem->call.endUsec = clock_wall_usec();
+    if (modem->state == CONNECTED && rfc2217_ioctl(modem->fd, TIOCGICOUNT, &counts) == 0) {
+        modem->call.rxBytes = (uint32_t)(counts.rx - modem->callCounts.rx);
+        modem->call.txBytes = (uint32_t)(counts.tx - modem->callCounts.tx);
+    }
+    if (!cdr_submit(&modem->call)) {
+        log_error(modem->tag, "Couldn't write the call record.");
+    }
+}
+
+/* Add any DTMF digits in events to the call's dialed digits. Returns true if there were any. */
+bool add_digits(modem_t *modem, const char *events, int numEvents) {
+    bool found = false;
+    size_t len = strlen(modem->call.digits);
+    for (int i = 0; i < numEvents; i++) {
+        if (isdigit(events[i]) || events[i] == '*' || events[i] == '#') {
+            if (len < sizeof(modem->call.digits) - 1) {
+                modem->call.digits[len++] = events[i];
+                modem->call.digits[len] = 0;
+            }
+            found = true;
+        }
+    }
+    return found;
+}
+
+bool send_escape(modem_t *modem) {
+    send_string(modem->fd, "+++");
+    clock_sleep(1100000);
+    return get_response(modem, 1) == 0;
+}
+
+/* For when a line's modem stops making sense: hang up and start it over. The other lines carry on. */
+static void reset_line(modem_t *modem) {
+    modem->state = IDLE;
+    hangup_line(modem);
+    reset_modem(modem);
+}
+
+/* Keep the modem fed with whatever we're playing: the dialtone, or a prompt. False if the modem won't take it. */
+bool send_voice(modem_t *modem) {
+    /* Probably an unnecessary check. */
+    if (modem->state == SENDING_DIALTONE || modem->state == PLAYING_PROMPT) {
+        /* Work out what's due from the start, so rounding never adds up to drift. A sample a second over, so the modem never runs dry. */
+        int sampleSize = audio_sample_size(modem->voiceFormat.encoding);
+        int bytesToSend = voice_samples_due(clock_usec() - modem->voiceStart, modem->voiceFormat.rate + 1)*sampleSize - modem->voiceSent;
+        if (!modem->voiceLoop && bytesToSend > modem->voiceSize - (int64_t)modem->voiceSent) {
+            /* Prompts only play once. */
+            bytesToSend = modem->voiceSize - modem->voiceSent;
+        }
+        while (bytesToSend > 0) {
+            /* Send it all in one go, wrapping around the end as needed. */
+            struct iovec iov[8];
+            int numIov = voice_chunks(modem->voiceBuf, modem->voiceSize, &modem->voicePos, bytesToSend, iov, 8);
+            ssize_t size = voice_write(modem->fd, iov, numIov);
+            if (size <= 0) {
+                log_error(modem->tag, "Couldn't send voice to the modem: %s", size < 0 ? strerror(errno) : "nothing written");
+                return false;
+            }
+            for (int i = 0, left = size; modem->recording != NULL && i < numIov && left > 0; left -= iov[i++].iov_len) {
+                record_samples(modem->recording, RECORD_TX, iov[i].iov_base, left < iov[i].iov_len ? left : iov[i].iov_len);
+            }
+            bytesToSend -= size;
+            modem->voiceSent += size;
+        }
+    }
+    return true;
+}
+
+/* Play buf to the caller from the top. The modem has to be taking voice already (AT+VTX). */
+static void start_playing(modem_t *modem, const unsigned char *buf, int size, bool loop) {
+    modem->voiceBuf = buf;
+    modem->voiceSize = size;
+    modem->voiceLoop = loop;
+    modem->voicePos = 0;
+    /* Start a second ahead so the modem always has some buffered. */
+    modem->voiceStart = clock_usec() - 1000000;
+    modem->voiceSent = 0;
+    send_voice(modem);
+}
+
+/* Read a response that's more than a result code, up to and including the result. Returns the result code. */
+static int get_lines(modem_t *modem, char *buf, size_t size) {
+    size_t len = 0;
+    buf[0] = 0;
+    while (len < size - 1 && clock_wait_readable(modem->fd, 1000000) == 1) {
+        char *last;
+        ssize_t bytes = read(modem->fd, buf + len, size - 1 - len);
+        if (bytes <= 0) {
+            break;
+        }
+        len += bytes;
+        buf[len] = 0;
+        /* Done once the last line is a result code on its own. */
+        while (len > 0 && (buf[len - 1] == '\r' || buf[len - 1] == '\n')) {
+            len--;
+        }
+        for (last = buf + len; last > buf && last[-1] != '\r' && last[-1] != '\n'; last--);
+        buf[len] = 0;
+        if (strcmp(last, "0") == 0 || strcmp(last, "OK") == 0 || strcmp(last, "4") == 0 || strcmp(last, "ERROR") == 0) {
+            log_debug(modem->tag, "Response: %s", buf);
+            return strcmp(last, "0") == 0 || strcmp(last, "OK") == 0 ? 0 : 4;
+        }
+    }
+    return -1;
+}
+
+/* Ask the modem what voice formats it has and pick one. Ones that won't say get 8-bit linear at 8000 Hz, like always. */
+static void pick_voice_format(modem_t *modem) {
+    char list[1024];
+    modem->voiceFormat = AUDIO_DEFAULT_FORMAT;
+    modem->voiceCml = 1;
+    modem->voiceFormatKnown = true;
+    send_string(modem->fd, "AT+VSM=?\r\n");
+    if (get_lines(modem, list, sizeof(list)) != 0 || !audio_pick_vsm(list, &modem->voiceFormat, &modem->voiceCml)) {
+        log_debug(modem->tag, "The modem didn't list any voice formats we can do. Trying 8-bit linear at 8000 Hz.");
+        return;
+    }
+    log_info(modem->tag, "Voice is %s at %d Hz (AT+VSM=%d).", audio_encoding_name(modem->voiceFormat.encoding), modem->voiceFormat.rate, modem->voiceCml);
+}
+
+/* Voice mode, off hook, in the modem's voice format. */
+static bool start_voice(modem_t *modem) {
+    int res;
+    char cmd[32];
+    send_string(modem->fd, "AT+FCLASS=8\r\n");
+    if ((res = get_response(modem, 1)) != 0) {
+        log_warn(modem->tag, "AT+FCLASS=8 returned %d", res);
+        return false;
+    }
+    if (!modem->voiceFormatKnown) {
+        pick_voice_format(modem);
+    }
+    send_string(modem->fd, "AT+VLS=1\r\n");
+    if ((res = get_response(modem, 1)) != 0) {
+        log_warn(modem->tag, "AT+VLS=1 returned %d", res);
+        return false;
+    }
+    snprintf(cmd, sizeof(cmd), "AT+VSM=%d,%d\r\n", modem->voiceCml, modem->voiceFormat.rate);
+    send_string(modem->fd, cmd);
+    if ((res = get_response(modem, 1)) != 0) {
+        log_warn(modem->tag, "AT+VSM=%d,%d returned %d", modem->voiceCml, modem->voiceFormat.rate, res);
+        return false;
+    }
+    if (modem->recordVoice && modem->recording == NULL) {
+        modem->recording = record_start(modem->tag, modem->voiceFormat);
+    }
+    return true;
+}
+
+/*
+ * Start sending voice. Lines being recorded ask for full duplex (AT+VTR), so
+ * there's something to record of the caller's side. Modems that won't do it,
+ * and every other line, just send (AT+VTX).
+ */
+static bool start_sending(modem_t *modem) {
+    modem->voiceDuplex = false;
+    if (modem->recording != NULL) {
+        send_string(modem->fd, "AT+VTR\r\n");
+        if (get_response(modem, 1) == 1) {
+            modem->voiceDuplex = true;
+            return true;
+        }
+        log_debug(modem->tag, "The modem can't do full duplex voice (AT+VTR). Only what we send gets recorded.");
+    }
+    send_string(modem->fd, "AT+VTX\r\n");
+    return get_response(modem, 1) == 1;
+}
+
+/* Read what the modem's sent us while it's sending voice, and find the events in it. What it hears gets recorded. */
+static int read_voice(modem_t *modem, char *events, int maxEvents) {
+    char buf[1024];
+    uint8_t samples[sizeof(buf)];
+    int numEvents = 0;
+    int bytes = read(modem->fd, buf, sizeof(buf));
+    if (bytes <= 0) {
+        return 0;
+    }
+    if (!modem->voiceDuplex) {
+        return dle_scan(&modem->dlePending, buf, bytes, events, maxEvents);
+    }
+    bytes = dle_decode(&modem->dlePending, buf, bytes, samples, events, maxEvents, &numEvents);
+    if (modem->recording != NULL) {
+        record_samples(modem->recording, RECORD_RX, samples, bytes);
+    }
+    return numEvents;
+}
+
+static void unpack_dialtone(void) {
+    audio_format_t format;
+    int count = audio_unpack(&assetDialtone, &dialtone, &format);
+    if (count < 0) {
+        log_error(NULL, "Out of memory unpacking the dialtone!");
+        return;
+    }
+    audio_asset_init(&dialtoneAsset, dialtone, count, format);
+}
+
+bool start_dialtone(modem_t *modem) {
+    pthread_once(&dialtoneOnce, unpack_dialtone);
+    if (modem->state == IDLE && dialtone != NULL) {
+        int res;
+        int size;
+        const uint8_t *tone;
+        char cmd[32];
+        send_string(modem->fd, "ATH\r\n");
+        if ((res = get_response(modem, 5)) != 0) {
+            log_warn(modem->tag, "ATH returned %d", res);
+            return false;
+        }
+        if (!start_voice(modem)) {
+            return false;
+        }
+        /* Have the modem tell us (DLE s) when the caller's gone quiet, so a line they've left doesn't sit in dialtone. Not every modem can. */
+        snprintf(cmd, sizeof(cmd), "AT+VSD=128,%d\r\n", DIALTONE_SILENCE_DS);
+        send_string(modem->fd, cmd);
+        if (get_response(modem, 1) != 0) {
+            log_debug(modem->tag, "The modem won't detect silence. Only hangups it hears get noticed.");
+        }
+        if (!start_sending(modem)) {
+            return false;
+        }
+        if ((tone = audio_asset_get(&dialtoneAsset, modem->voiceFormat, &size)) == NULL) {
+            log_warn(modem->tag, "Couldn't convert the dialtone to %s at %d Hz.", audio_encoding_name(modem->voiceFormat.encoding), modem->voiceFormat.rate);
+            return false;
+        }
+        modem->state = SENDING_DIALTONE;
+        start_playing(modem, tone, size, true);
+        return true;
+    }
+    return false;
+}
+
+/* Back to command mode. False if the modem wouldn't go, in which case the line's been hung up and reset. */
+bool stop_dialtone(modem_t *modem) {
+    if (modem->state == SENDING_DIALTONE || modem->state == CLIENT_DIALING || modem->state == PLAYING_PROMPT) {
+        /* Throw away the second of dialtone the modem's still got, so it stops now and not once that's played. */
+        char buf[] = {DLE, CAN, DLE, ETX};
+        int res;
+        modem->state = IDLE;
+        tcflush(modem->fd, TCIOFLUSH);
+        write(modem->fd, buf, sizeof(buf));
+        /* Modems that don't come back to command mode on their own get escaped. */
+        if (get_response(modem, 1) != 0 && !send_escape(modem)) {
+            log_error(modem->tag, "The modem won't come out of voice mode. Resetting it.");
+            reset_line(modem);
+            return false;
+        }
+        send_string(modem->fd, "AT+FCLASS=0\r\n");
+        if ((res = get_response(modem, 1)) != 0) {
+            log_error(modem->tag, "AT+FCLASS=0 returned %d. Resetting the modem.", res);
+            reset_line(modem);
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Pick the backend for the digits the caller dialed. Returns false if nothing takes the number. */
+bool route_call(modem_t *modem) {
+    modem->route = NULL;
+    if (dialPlan.numEntries == 0) {
+        modem->backend = defaultBackend;
+        return true;
+    }
+    if ((modem->route = dialplan_match(&dialPlan, modem->call.digits)) == NULL) {
+        return false;
+    }
+    modem->backend = modem->route->backend;
+    return true;
+}
+
+/*
+ * Pick the backend for a caller that sent a calling tone instead of dialing.
+ * Fax machines go to the first fax line, modems wherever a call with no
+ * digits would.
+ */
+static bool route_tone(modem_t *modem, char tone) {
+    if (tone != EVENT_FAX_CNG) {
+        return route_call(modem);
+    }
+    if ((modem->route = dialplan_find(&dialPlan, BACKEND_FAX)) == NULL) {
+        return false;
+    }
+    modem->backend = BACKEND_FAX;
+    return true;
+}
+
+/*
+ * Who's calling, as far as training and multilink go: their caller ID if we
+ * got a number, otherwise what they dialed. Empty if we've got neither.
+ */
+static const char *caller_key(modem_t *modem) {
+    const char *number = modem->call.callerNumber;
+    if (number[0] != 0 && strspn(number, "0123456789") == strlen(number)) {
+        return number;
+    }
+    return modem->call.digits;
+}
+
+/* Forked children get the signals dialin keeps to its main thread back before they exec. */
+static void unblock_signals(void) {
+    sigset_t none;
+    sigemptyset(&none);
+    pthread_sigmask(SIG_SETMASK, &none, NULL);
+}
+
+/*
+ * The modem's answer to ATA. Modems reporting the carrier (AT+MR=2) send
+ * those lines ahead of it, sometimes on their own, so they're saved up in
+ * reports and we keep reading.
+ */
+static int get_answer(modem_t *modem, unsigned int attempts, char *reports, size_t size) {
+    int res;
+    size_t used = strlen(reports);
+    for (;;) {
+        /* So a timeout doesn't look like another report. */
+        modem->lastResponse[0] = 0;
+        res = get_response(modem, attempts);
+        if (used < size - 1) {
+            snprintf(reports + used, size - used, "%s", modem->lastResponse);
+            used = strlen(reports);
+        }
+        if (res != -1 || modem->lastResponse[at_skip_reports(modem->lastResponse, strlen(modem->lastResponse))] != 0 || modem->lastResponse[0] == 0) {
+            return res;
+        }
+    }
+}
+
+bool answer_call(modem_t *modem) {
+    if (modem->state == IDLE) {
+        int res;
+        bool limited = false;
+        char limit[32];
+        const char *carrier;
+        unsigned int carrierRate;
+        char reports[256] = {0};
+        /* Don't know if this is needed and takes forever to execute on my G4 modem. */
+        /* Anything left over from ringing (like caller ID) isn't the answer to this. */
+        tcflush(modem->fd, TCIFLUSH);
+        send_string(modem->fd, "ATH1\r\n");
+        if ((res = get_response(modem, 10)) != 0) {
+            log_error(modem->tag, "ATH1 returned %d", res);
+            hangup_line(modem);
+            return false;
+        }
+        tcflush(modem->fd, TCIFLUSH);
+        send_string(modem->fd, "ATM1\r\n");
+        if ((res = get_response(modem, 1)) != 0) {
+            log_error(modem->tag, "ATM1 returned %d", res);
+            hangup_line(modem);
+            return false;
+        }
+        if (modem->backend == BACKEND_FAX) {
+            /* The fax receiver takes over from the answer on, in class 1. */
+            send_string(modem->fd, "AT+FCLASS=1\r\n");
+            if (get_response(modem, 1) != 0) {
+                log_warn(modem->tag, "The modem won't do fax class 1.");
+                return false;
+            }
+        } else if (training_enabled()) {
+            /* Training only learns from the carrier the modem says it got, never the DTE rate in the CONNECT code. */
+            send_string(modem->fd, "AT+MR=2\r\n");
+            if (get_response(modem, 1) != 0) {
+                log_debug(modem->tag, "Modem won't report its carrier (AT+MR=2). Training won't learn from this call.");
+            }
+            if (training_plan(caller_key(modem), limit, sizeof(limit))) {
+                /* We know what this caller trains up to. Skip the carriers above it. */
+                send_string(modem->fd, limit);
+                if ((limited = get_response(modem, 1) == 0)) {
+                    log_debug(modem->tag, "Training %s straight to what it got last time.", caller_key(modem));
+                } else {
+                    log_debug(modem->tag, "Modem doesn't take AT+MS. Doing a full negotiation.");
+                }
+            }
+        }
+        modem->phaseStart = mono_msec();
+        send_string(modem->fd, "ATA\r\n");
+        res = get_answer(modem, 1, reports, sizeof(reports));
+        /* Callers that were already waiting with their calling tone can connect inside the first second. */
+        if (res == 1 || at_connect_rate(res) != 0) {
+            /* Connected. */
+        } else if (res != 0 && res != -1) {
+            /* If we get some kind of error answering the call, return. */
+            training_result(caller_key(modem), limited, false, NULL, 0);
+            return false;
+        } else {
+            /* Handle modems with respond with OK after ATA */
+            /* Wait 60s for the modem to respond. */
+            res = get_answer(modem, 60, reports, sizeof(reports));
+        }
+        /* Don't know rn what reponse codes modems will return. */
+        if (res == 3 || res == 4 || res == -1) {
+            log_warn(modem->tag, "Modem failed to connect!");
+            training_result(caller_key(modem), limited, false, NULL, 0);
+            modem->state = IDLE;
+            return false;
+        }
+        modem->call.answerMs = end_phase(modem);
+        parse_connect(modem, res);
+        if (modem->backend != BACKEND_FAX) {
+            carrier = at_modulation(reports, &carrierRate);
+            training_result(caller_key(modem), limited, true, carrier, carrierRate);
+        }
+        log_info(modem->tag, "Modem returned code %d.", res);
+        if (modem->backend == BACKEND_PPP) {
+            /* Do PPP ourselves. */
+            strcpy(modem->call.backend, "ppp");
+            ppp_init(&modem->ppp, &pppConfig, modem->tag, modem->index);
+            modem->ppp.statusFd = status_fd(modem);
+            if (modem->route != NULL && modem->route->multilink && caller_key(modem)[0] != 0) {
+                /* Calls from the same caller get bonded. One we can't tell apart from everyone else doesn't. */
+                ppp_multilink(&modem->ppp, caller_key(modem));
+            }
+            if ((res = ppp_attach(&modem->ppp, modem->fd)) != 0) {
+                log_error(modem->tag, "Couldn't put the line into PPP mode. Return val: %d; Error: %s", res, strerror(errno));
+                ppp_detach(&modem->ppp);
+                hangup_line(modem);
+                return false;
+            }
+            modem->pppd = 0;
+        } else if (modem->backend == BACKEND_TCP) {
+            /* Hand the line to a TCP service. */
+            strcpy(modem->call.backend, "tcp");
+            relay_init(&modem->relay, modem->tag);
+            modem->relay.statusFd = status_fd(modem);
+            if ((res = relay_connect(&modem->relay, modem->route->target, modem->route->telnet, modem->fd)) != 0) {
+                log_error(modem->tag, "Couldn't connect the call to %s. Return val: %d", modem->route->target, res);
+                relay_free(&modem->relay);
+                hangup_line(modem);
+                return false;
+            }
+            modem->pppd = 0;
+        } else if (modem->backend == BACKEND_L2TP) {
+            /* Hand the caller's PPP to the LNS. */
+            strcpy(modem->call.backend, "l2tp");
+            l2tp_init(&modem->l2tp, modem->tag);
+            modem->l2tp.statusFd = status_fd(modem);
+            if ((res = l2tp_connect(&modem->l2tp, modem->route->target, modem->call.digits, modem->call.connectRate, modem->fd)) != 0) {
+                log_error(modem->tag, "Couldn't tunnel the call to %s. Return val: %d", modem->route->target, res);
+                l2tp_free(&modem->l2tp);
+                hangup_line(modem);
+                return false;
+            }
+            modem->pppd = 0;
+        } else if (modem->backend == BACKEND_SLIP || modem->backend == BACKEND_CSLIP) {
+            strcpy(modem->call.backend, backend_name(modem->backend));
+            slip_init(&modem->slip, &pppConfig, modem->tag, modem->index, modem->backend == BACKEND_CSLIP);
+            modem->slip.statusFd = status_fd(modem);
+            if ((res = slip_attach(&modem->slip, modem->fd)) != 0) {
+                log_error(modem->tag, "Couldn't put the line into SLIP mode. Return val: %d; Error: %s", res, strerror(errno));
+                slip_detach(&modem->slip);
+                hangup_line(modem);
+                return false;
+            }
+            linkstats_watch(modem->index, modem->slip.ifname);
+            modem->pppd = 0;
+        } else if (modem->backend == BACKEND_FAX) {
+            pid_t id;
+            strcpy(modem->call.backend, "fax");
+            if ((id = fork()) == 0) {
+                char *args[] = {(char*)modem->route->target, modem->path, NULL};
+                unblock_signals();
+                execv(args[0], args);
+                _exit(127);
+            }
+            if (id < 0) {
+                log_error(modem->tag, "Couldn't start the fax receiver: %s", strerror(errno));
+                hangup_line(modem);
+                return false;
+            }
+            __atomic_store_n(&modem->pppd, id, __ATOMIC_RELEASE);
+        } else {
+            /* Start PPPD. */
+            clock_sleep(100000);
+            strcpy(modem->call.backend, "pppd");
+            int out[2];
+            pid_t id;
+            /* What pppd says comes back to us, for the log and the name of its interface. Close on exec, so no other line's pppd holds it open. */
+            if (pipe2(out, O_CLOEXEC) != 0) {
+                log_error(modem->tag, "Couldn't start pppd: %s", strerror(errno));
+                hangup_line(modem);
+                return false;
+            }
+            if ((id = fork()) == 0) {
+                char buf[16];
+                char unit[16];
+                char endpoint[32];
+                char echo[16];
+                char *args[24] = {modem->path, buf, "nodetach", "file", "options.modem", "unit", unit};
+                int numArgs = 7;
+                sprintf(buf, "%d", modem->rate);
+                sprintf(unit, "%d", PPPD_UNIT_BASE + modem->index);
+                if (modem->route != NULL && modem->route->multilink && caller_key(modem)[0] != 0) {
+                    /* Every line of the bundle shows the caller the same endpoint, so their end bonds them. pppd bonds ours. */
+                    sprintf(endpoint, "local:%08x", ppp_endpoint(caller_key(modem)));
+                    args[numArgs++] = "multilink";
+                    args[numArgs++] = "mrru";
+                    args[numArgs++] = "1500";
+                    args[numArgs++] = "endpoint";
+                    args[numArgs++] = endpoint;
+                }
+                if (watchdog_echo_interval() > 0) {
+                    /* Keep the caller talking so the watchdog can tell a live call from a dead one. It decides when to give up. */
+                    sprintf(echo, "%u", watchdog_echo_interval());
+                    args[numArgs++] = "lcp-echo-interval";
+                    args[numArgs++] = echo;
+                    args[numArgs++] = "lcp-echo-failure";
+                    args[numArgs++] = "0";
+                }
+                args[numArgs] = NULL;
+                unblock_signals();
+                dup2(out[1], STDOUT_FILENO);
+                execv(pppdPath, args);
+                /* wait_session() reports it as pppd exiting with 127. */
+                _exit(127);
+            }
+            close(out[1]);
+            if (id < 0) {
+                log_error(modem->tag, "Couldn't start pppd: %s", strerror(errno));
+                close(out[0]);
+                hangup_line(modem);
+                return false;
+            }
+            modem->pppdOut = out[0];
+            __atomic_store_n(&modem->pppd, id, __ATOMIC_RELEASE);
+        }
+        modem->watchdogEnded = false;
+        modem->state = CONNECTED;
+        modem->call.setupMs = end_phase(modem);
+        if (rfc2217_ioctl(modem->fd, TIOCGICOUNT, &modem->callCounts) != 0) {
+            memset(&modem->callCounts, 0, sizeof(modem->callCounts));
+        }
+        return true;
+    }
+    return false;
+}
+
+/* Put what went through the call's interface in its record. */
+static void end_linkstats(modem_t *modem) {
+    linkstats_t stats;
+    if (!linkstats_end(modem->index, &stats)) {
+        return;
+    }
+    modem->call.ifRxBytes = stats.rxBytes;
+    modem->call.ifTxBytes = stats.txBytes;
+    modem->call.peakRxRate = stats.peakRxRate;
+    modem->call.peakTxRate = stats.peakTxRate;
+    modem->call.idleMs = stats.idleMs;
+    modem->call.compressionPct = stats.compressed > 0 ? stats.uncompressed*100/stats.compressed : 0;
+    log_debug(modem->tag, "%s: %" PRIu64 " bytes in, %" PRIu64 " out, idle %" PRIu64 " ms.", stats.ifname, stats.rxBytes, stats.txBytes, stats.idleMs);
+}
+
+/*
+ * Pass what pppd says on to the debug log until it's done, and watch the
+ * interface it says it's got. It can end up on another unit than the one we
+ * asked for, so that's the only way to know which one's this call's.
+ */
+static void watch_pppd(modem_t *modem) {
+    char buf[512];
+    size_t len = 0;
+    bool watching = false;
+    while (true) {
+        char *line = buf;
+        char *eol;
+        ssize_t bytes;
+        siginfo_t info = {0};
+        if (clock_wait_readable(modem->pppdOut, 250000) != 1) {
+            /* Something it started could still have its stdout, so don't count on seeing the end of it. */
+            if (waitid(P_PID, modem->pppd, &info, WEXITED | WNOHANG | WNOWAIT) == 0 && info.si_pid == modem->pppd) {
+                break;
+            }
+            continue;
+        }
+        if ((bytes = read(modem->pppdOut, buf + len, sizeof(buf) - 1 - len)) <= 0) {
+            break;
+        }
+        len += bytes;
+        buf[len] = 0;
+        while ((eol = strchr(line, '\n')) != NULL) {
+            char ifname[IFNAMSIZ];
+            *eol = 0;
+            log_debug(modem->tag, "pppd: %s", line);
+            if (!watching && (sscanf(line, "Using interface %15s", ifname) == 1 || sscanf(line, "Connect: %15s", ifname) == 1 ||
+                sscanf(line, "Link attached to %15s", ifname) == 1)) {
+                linkstats_watch(modem->index, ifname);
+                watching = true;
+            }
+            line = eol + 1;
+        }
+        len = strlen(line);
+        /* Something that long isn't a line of pppd's. */
+        len = len < sizeof(buf) - 1 ? len : 0;
+        memmove(buf, line, len);
+    }
+    close(modem->pppdOut);
+    modem->pppdOut = -1;
+    if (!watching) {
+        log_debug(modem->tag, "pppd never said which interface it got, so there are no interface stats for this call.");
+    }
+}
+
+/* Wait for the backend to finish with the call. Returns its wait status. */
+int wait_session(modem_t *modem) {
+    int res;
+    if (modem->backend == BACKEND_PPP) {
+        res = ppp_run(&modem->ppp);
+        log_info(modem->tag, "PPP finished. Code: %d", res);
+        /* Before the interface goes away. */
+        end_linkstats(modem);
+        ppp_detach(&modem->ppp);
+        /* pppd hangs up by dropping DTR when it closes the TTY, so we do too. */
+        hangup_line(modem);
+        res = W_EXITCODE(res, 0);
+    } else if (modem->backend == BACKEND_TCP) {
+        res = relay_run(&modem->relay);
+        log_info(modem->tag, "Relay finished. Code: %d", res);
+        /* What went through the relay, in case the serial driver can't count. */
+        modem->call.rxBytes = modem->relay.up.bytes;
+        modem->call.txBytes = modem->relay.down.bytes;
+        relay_free(&modem->relay);
+        hangup_line(modem);
+        res = W_EXITCODE(res, 0);
+    } else if (modem->backend == BACKEND_L2TP) {
+        res = l2tp_run(&modem->l2tp);
+        log_info(modem->tag, "L2TP session finished. Code: %d", res);
+        modem->call.rxBytes = modem->l2tp.rxBytes;
+        modem->call.txBytes = modem->l2tp.txBytes;
+        l2tp_free(&modem->l2tp);
+        hangup_line(modem);
+        res = W_EXITCODE(res, 0);
+    } else if (modem->backend == BACKEND_SLIP || modem->backend == BACKEND_CSLIP) {
+        res = slip_run(&modem->slip);
+        log_info(modem->tag, "SLIP finished. Code: %d", res);
+        end_linkstats(modem);
+        slip_detach(&modem->slip);
+        hangup_line(modem);
+        res = W_EXITCODE(res, 0);
+    } else if (modem->backend == BACKEND_FAX) {
+        waitpid(modem->pppd, &res, 0);
+        __atomic_store_n(&modem->pppd, 0, __ATOMIC_RELEASE);
+        log_info(modem->tag, "Fax receiver exited. Code: %d", res);
+        hangup_line(modem);
+    } else {
+        watch_pppd(modem);
+        waitpid(modem->pppd, &res, 0);
+        __atomic_store_n(&modem->pppd, 0, __ATOMIC_RELEASE);
+        log_info(modem->tag, "PPPd exited. Code: %d", res);
+        /* Its interface is gone, so this is as of the last sample. */
+        end_linkstats(modem);
+        if (WIFEXITED(res) && WEXITSTATUS(res) == 127) {
+            /* It never started, so nothing's hung up on the caller. */
+            log_error(modem->tag, "Couldn't run %s.", pppdPath);
+            hangup_line(modem);
+        } else if (__atomic_load_n(&modem->watchdogEnded, __ATOMIC_ACQUIRE)) {
+            /* The caller's still there. pppd may not have hung up if it had to be killed, and a line without DTR never does. */
+            hangup_line(modem);
+        }
+    }
+    modem->call.sessionMs = end_phase(modem);
+    modem->call.exitStatus = res;
+    return res;
+}
+
+/* Wait for the modem to have something for us. A change on its control lines cuts it short. */
+static bool wait_modem(modem_t *modem, uint64_t usec) {
+    struct pollfd fds[2] = {{modem->fd, POLLIN, 0}, {status_fd(modem), POLLIN, 0}};
+    if (clock_poll(fds, 2, usec) <= 0) {
+        return false;
+    }
+    if (fds[1].revents & POLLIN) {
+        linewatch_ack(&modem->lineWatch);
+    }
+    return (fds[0].revents & POLLIN) != 0;
+}
+
+/* The test signal from pos on: silence, each tone in turn, then silence while the last of it comes back. */
+static void render_test(tone_t *tones, int64_t pos, uint8_t *out, int count) {
+    while (count > 0) {
+        int offset, left;
+        int window = linetest_window(pos, &offset, &left);
+        int len = left > 0 && left < count ? left : count;
+        if (window < 0 || window >= LINETEST_FREQS) {
+            memset(out, 0x80, len);
+        } else {
+            tone_render_u8(&tones[window], out, len);
+        }
+        out += len;
+        pos += len;
+        count -= len;
+    }
+}
+
+/* Feed what came back into the bank for the part of the test it goes with, once the loopback's caught up. */
+static void analyze_test(goertzel_bank_t *noise, goertzel_bank_t *banks, int64_t pos, const uint8_t *in, int count) {
+    int16_t samples[256];
+    while (count > 0) {
+        int offset, left, len, skip;
+        int window = linetest_window(pos, &offset, &left);
+        if (window >= LINETEST_FREQS) {
+            return;
+        }
+        len = left < count ? left : count;
+        len = len < 256 ? len : 256;
+        skip = offset < LINETEST_SETTLE_SAMPLES ? LINETEST_SETTLE_SAMPLES - offset : 0;
+        if (skip < len) {
+            pcm_u8_to_s16(in + skip, samples, len - skip);
+            goertzel_feed(window < 0 ? noise : &banks[window], samples, len - skip);
+        }
+        in += len;
+        pos += len;
+        count -= len;
+    }
+}
+
+/* Play the test tones to the loopback on the other end of the line, and score it on what comes back. */
+void test_line(modem_t *modem) {
+    tone_t tones[LINETEST_FREQS];
+    goertzel_bank_t noise;
+    goertzel_bank_t banks[LINETEST_FREQS];
+    line_quality_t quality = {0};
+    /* End of transmit. Dropping DTR takes care of the rest. */
+    char end[] = {DLE, ETX};
+    uint64_t start;
+    int64_t sent = 0;
+    int64_t received = 0;
+    bool dle = false;
+
+    strcpy(modem->call.backend, "linetest");
+    modem->state = CONNECTING;
+    goertzel_init(&noise);
+    for (int i = 0; i < LINETEST_FREQS; i++) {
+        double freq = linetestFreqs[i];
+        tone_init(&tones[i], &freq, 1, LINETEST_LEVEL, LINETEST_RATE);
+        goertzel_init(&banks[i]);
+    }
+    if (!start_voice(modem)) {
+        hangup_line(modem);
+        reset_modem(modem);
+        return;
+    }
+    if (!audio_format_equal(modem->voiceFormat, AUDIO_DEFAULT_FORMAT)) {
+        log_warn(modem->tag, "The line test only works in 8-bit linear at 8000 Hz, and this modem's using %s at %d Hz.",
+            audio_encoding_name(modem->voiceFormat.encoding), modem->voiceFormat.rate);
+        hangup_line(modem);
+        reset_modem(modem);
+        return;
+    }
+    send_string(modem->fd, "AT+VTR\r\n");
+    if (get_response(modem, 1) != 1) {
+        log_warn(modem->tag, "The modem can't do full duplex voice (AT+VTR), so it can't test the line.");
+        hangup_line(modem);
+        reset_modem(modem);
+        return;
+    }
+    log_info(modem->tag, "Testing the line...");
+    start = clock_usec();
+    while (received < LINETEST_SAMPLES && clock_usec() - start < LINETEST_TIMEOUT_USEC) {
+        uint8_t buf[1024];
+        /* Like the dialtone: what's due from the start, plus a bit so the modem never runs dry. The tones never get near DLE. */
+        int due = voice_samples_due(clock_usec() - start + LINETEST_LEAD_USEC, LINETEST_RATE) - sent;
+        while (due > 0) {
+            int len = due < sizeof(buf) ? due : sizeof(buf);
+            ssize_t res;
+            render_test(tones, sent, buf, len);
+            if ((res = write(modem->fd, buf, len)) <= 0) {
+                break;
+            }
+            if (modem->recording != NULL) {
+                record_samples(modem->recording, RECORD_TX, buf, res);
+            }
+            sent += res;
+            due -= res;
+        }
+        if (wait_modem(modem, 20000)) {
+            char in[sizeof(buf)];
+            char events[16];
+            int numEvents;
+            ssize_t bytes = read(modem->fd, in, sizeof(in));
+            int samples = bytes > 0 ? dle_decode(&dle, in, bytes, buf, events, sizeof(events), &numEvents) : 0;
+            analyze_test(&noise, banks, received, buf, samples);
+            if (modem->recording != NULL) {
+                record_samples(modem->recording, RECORD_RX, buf, samples);
+            }
+            received += samples;
+        }
+    }
+    write(modem->fd, end, sizeof(end));
+    modem->call.sessionMs = end_phase(modem);
+    hangup_line(modem);
+    reset_modem(modem);
+    if (received < LINETEST_SAMPLES) {
+        log_warn(modem->tag, "The line test timed out. Only %" PRId64 " of %d samples came back.", received, LINETEST_SAMPLES);
+        return;
+    }
+    if (!linetest_score(&quality, &noise, banks)) {
+        log_warn(modem->tag, "Nothing came back from the line test. Is there a loopback on the other end?");
+        return;
+    }
+    log_info(modem->tag, "Line quality %d/100: SNR %.1f dB, noise %.1f dBFS, %.0f Hz %+.1f dB and %.0f Hz %+.1f dB from 1000 Hz.",
+        quality.score, quality.snrDb, quality.noiseDb,
+        linetestFreqs[0], quality.responseDb[0], linetestFreqs[LINETEST_FREQS - 1], quality.responseDb[LINETEST_FREQS - 1]);
+    for (int i = 0; i < LINETEST_FREQS; i++) {
+        log_debug(modem->tag, "%4.0f Hz: %+.1f dB", linetestFreqs[i], quality.responseDb[i]);
+    }
+    if (quality.score < LINETEST_MARGINAL) {
+        log_warn(modem->tag, "The line's marginal. On a hunt group it'll only take calls when nothing better's free.");
+    }
+    modem->quality = quality;
+}
+
+/* Why the caller's gone, going by the modem's events, or NULL if they're still there. */
+static const char *hangup_event(const char *events, int numEvents) {
+    for (int i = 0; i < numEvents; i++) {
+        switch (events[i]) {
+            case EVENT_BUSY:
+                return "busy tone";
+            case EVENT_SILENCE:
+            case EVENT_QUIET:
+                return "silence";
+            case EVENT_LOOP_BREAK:
+            case EVENT_LINE_BREAK:
+                return "loop current dropped";
+        }
+    }
+    return NULL;
+}
+
+/* A fax or modem calling tone in events, or 0 if there isn't one. */
+static char calling_tone(const char *events, int numEvents) {
+    for (int i = 0; i < numEvents; i++) {
+        if (events[i] == EVENT_FAX_CNG || events[i] == EVENT_DATA_CALLING) {
+            return events[i];
+        }
+    }
+    return 0;
+}
+
+/*
+ * Play a prompt to the caller in place of whatever's playing, and wait for
+ * it to play out (or for them to hang up). The modem's left in voice mode.
+ * False if there's no such prompt.
+ */
+static bool play_prompt(modem_t *modem, const char *name) {
+    /* Throw away any dialtone the modem's still got, so the prompt starts now. */
+    char flush[] = {DLE, CAN};
+    prompt_audio_t *audio = prompt_get(name);
+    const uint8_t *samples;
+    int size;
+    uint64_t end;
+    if (audio == NULL) {
+        return false;
+    }
+    if ((samples = audio_asset_get(&audio->asset, modem->voiceFormat, &size)) == NULL) {
+        log_warn(modem->tag, "Couldn't convert the %s prompt to %s at %d Hz.", name, audio_encoding_name(modem->voiceFormat.encoding), modem->voiceFormat.rate);
+        prompt_put(audio);
+        return true;
+    }
+    log_info(modem->tag, "Playing the %s prompt.", name);
+    write(modem->fd, flush, sizeof(flush));
+    modem->state = PLAYING_PROMPT;
+    start_playing(modem, samples, size, false);
+    /* The modem gets to the end a second after the last of it's due. */
+    end = modem->voiceStart + 1000000 + (uint64_t)size/audio_sample_size(modem->voiceFormat.encoding)*1000000/modem->voiceFormat.rate;
+    while (clock_usec() < end && linewatch_powered(&modem->lineWatch)) {
+        if (!send_voice(modem)) {
+            break;
+        }
+        if (wait_modem(modem, 50000)) {
+            char events[64];
+            int numEvents = read_voice(modem, events, sizeof(events));
+            if (hangup_event(events, numEvents) != NULL) {
+                break;
+            }
+        }
+    }
+    prompt_put(audio);
+    return true;
+}
+
+/* Answer a call that's not in voice mode yet (on ring, or with no dial) just to play it a prompt, and hang up. */
+void answer_prompt(modem_t *modem, const char *name) {
+    strcpy(modem->call.backend, "prompt");
+    if (start_voice(modem)) {
+        if (start_sending(modem)) {
+            modem->state = PLAYING_PROMPT;
+            if (!play_prompt(modem, name)) {
+                log_warn(modem->tag, "There's no %s prompt to play.", name);
+            }
+            stop_dialtone(modem);
+        }
+    }
+    modem->call.sessionMs = end_phase(modem);
+    hangup_line(modem);
+    reset_modem(modem);
+}
+
+void modem_loop(modem_t *modem) {
+	while (!__atomic_load_n(&stopping, __ATOMIC_ACQUIRE)) {
+        char tone = 0;
+        const char *gone = NULL;
+        bool failed = false;
+        if (!linewatch_powered(&modem->lineWatch)) {
+            linewatch_wait_power(&modem->lineWatch, &stopping);
+            /* It's forgotten everything we told it. */
+            reset_modem(modem);
+        }
+		if (!start_dialtone(modem)) {
+            if (!linewatch_powered(&modem->lineWatch)) {
+                continue;
+            }
+			break;
+		}
+		begin_call(modem);
+		log_info(modem->tag, "Listening for dial...");
+		while (tone == 0 && gone == NULL && (modem->state != CLIENT_DIALING || mono_msec() - modem->phaseStart < DIAL_WAIT_MS)) {
+            if (!linewatch_powered(&modem->lineWatch) || __atomic_load_n(&stopping, __ATOMIC_ACQUIRE)) {
+                break;
+            }
+            if (!send_voice(modem)) {
+                failed = true;
+                break;
+            }
+            /* Wait 50ms to see if the modem has any data for us. */
+            if (wait_modem(modem, 50000)) {
+                /* See if we recieved any DTMF nums. */
+                char events[64];
+                int numEvents = read_voice(modem, events, sizeof(events));
+                if ((gone = hangup_event(events, numEvents)) != NULL) {
+                    /* They've hung up. Whatever else came in with it doesn't matter. */
+                    if (modem->state == SENDING_DIALTONE) {
+                        modem->call.dialtoneMs = end_phase(modem);
+                    }
+                /* The client is dialing a number. Stop the dialtone and collect the rest of the digits. */
+                } else if (add_digits(modem, events, numEvents) && modem->state == SENDING_DIALTONE) {
+                    modem->call.dialtoneMs = end_phase(modem);
+                    modem->state = CLIENT_DIALING;
+                } else if (modem->state == SENDING_DIALTONE && (tone = calling_tone(events, numEvents)) != 0) {
+                    /* A fax machine or a modem that won't be dialing. Don't keep them waiting. */
+                    modem->call.dialtoneMs = end_phase(modem);
+                }
+            }
+        }
+        if (!linewatch_powered(&modem->lineWatch)) {
+            /* Nothing to stop. The modem's forgotten all about it. */
+            log_warn(modem->tag, "The modem went away with the caller on the line.");
+            modem->state = IDLE;
+            continue;
+        }
+        if (failed) {
+            reset_line(modem);
+            end_call(modem);
+            continue;
+        }
+        if (__atomic_load_n(&stopping, __ATOMIC_ACQUIRE)) {
+            /* Nobody new gets put through. It's only a call if they'd started dialing. */
+            bool dialed = modem->call.digits[0] != 0;
+            stop_dialtone(modem);
+            if (dialed) {
+                modem->call.dialingMs = end_phase(modem);
+                strcpy(modem->call.backend, "abandoned");
+                end_call(modem);
+            } else if (modem->recording != NULL) {
+                record_stop(modem->recording);
+                modem->recording = NULL;
+            }
+            break;
+        }
+        modem->call.dialingMs = end_phase(modem);
+        if (gone != NULL) {
+            stop_dialtone(modem);
+            if (modem->call.digits[0] != 0) {
+                log_info(modem->tag, "The caller hung up after dialing %s (%s).", modem->call.digits, gone);
+            } else {
+                log_info(modem->tag, "The caller hung up without dialing (%s).", gone);
+            }
+            strcpy(modem->call.backend, "abandoned");
+            end_call(modem);
+            continue;
+        }
+        if (tone != 0) {
+            const char *who = tone == EVENT_FAX_CNG ? "A fax machine" : "A modem";
+            if (!route_tone(modem, tone)) {
+                log_warn(modem->tag, "%s called without dialing. Nothing in the dial plan takes it.", who);
+                stop_dialtone(modem);
+                end_call(modem);
+                continue;
+            }
+            log_info(modem->tag, "%s called without dialing. Picking up...", who);
+        } else if (!route_call(modem)) {
+            log_warn(modem->tag, "Client dialed %s. Nothing in the dial plan takes it.", modem->call.digits);
+            /* Tell them so, if there's a recording to tell them with. We're still in voice mode. */
+            play_prompt(modem, PROMPT_NOT_IN_SERVICE);
+            stop_dialtone(modem);
+            end_call(modem);
+            continue;
+        } else {
+            log_info(modem->tag, "Client dialed %s! Picking up...", modem->call.digits);
+        }
+        if (modem->backend == BACKEND_PROMPT) {
+            strcpy(modem->call.backend, "prompt");
+            if (!play_prompt(modem, modem->route->target)) {
+                log_warn(modem->tag, "There's no %s prompt to play.", modem->route->target);
+            }
+            modem->call.sessionMs = end_phase(modem);
+            stop_dialtone(modem);
+            end_call(modem);
+            continue;
+        }
+        if (!stop_dialtone(modem)) {
+            end_call(modem);
+            continue;
+        }
+        if (modem->backend == BACKEND_LINETEST) {
+            test_line(modem);
+            end_call(modem);
+            continue;
+        }
+        if (answer_call(modem)) {
+			log_info(modem->tag, "Client connected!");
+            wait_session(modem);
+            end_call(modem);
+            reset_modem(modem);
+		} else {
+			log_warn(modem->tag, "Client failed to connect. :(");
+            end_call(modem);
+		}
+	}
+}
+
+
+/* Get the modem ready to hear a call come in, with caller ID if it'll do it. */
+static bool setup_ring(modem_t *modem) {
+    int res;
+    send_string(modem->fd, "ATH\r\n");
+    if ((res = get_response(modem, 5)) != 0) {
+        log_warn(modem->tag, "ATH returned %d", res);
+        return false;
+    }
+    send_string(modem->fd, "AT+VCID=1\r\n");
+    if (get_response(modem, 1) != 0) {
+        /* Older Rockwell chipsets. */
+        send_string(modem->fd, "AT#CID=1\r\n");
+        if (get_response(modem, 1) != 0) {
+            log_warn(modem->tag, "The modem won't do caller ID. Calls get answered on rings alone.");
+        }
+    }
+    modem->state = IDLE;
+    return true;
+}
+
+/* A line that tested marginal, while there's one that didn't waiting for a call. */
+static bool should_busy_out(modem_t *modem) {
+    int lines = __atomic_load_n(&numModems, __ATOMIC_ACQUIRE);
+    if (!modem->quality.tested || modem->quality.score >= LINETEST_MARGINAL) {
+        return false;
+    }
+    for (int i = 0; i < lines; i++) {
+        modem_t *other = modems[i];
+        if (other != modem && __atomic_load_n(&other->waitingForRing, __ATOMIC_ACQUIRE) &&
+            (!other->quality.tested || other->quality.score >= LINETEST_MARGINAL)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Keep the line off hook so the exchange's hunt group skips over it to a
+ * better one, for as long as there's a better one free. When they're all in
+ * use, this one takes calls again.
+ */
+static void busy_out(modem_t *modem) {
+    log_info(modem->tag, "Busying out the line (it scored %d/100) while a better one's free.", modem->quality.score);
+    send_string(modem->fd, "ATH1\r\n");
+    get_response(modem, 5);
+    while (linewatch_powered(&modem->lineWatch) && should_busy_out(modem) && !__atomic_load_n(&stopping, __ATOMIC_ACQUIRE)) {
+        clock_sleep(BUSY_OUT_CHECK_USEC);
+    }
+    log_info(modem->tag, "No better line's free. Taking calls again.");
+}
+
+/*
+ * Count the rings of the next call and work out whether to take it. 1 to
+ * answer (with the caller's entry in entry), -1 if we're not answering this
+ * one (they hung up or aren't allowed) and 0 if there was no call.
+ */
+static int wait_rings(modem_t *modem, const caller_entry_t **entry) {
+    char buf[256];
+    size_t len = 0;
+    callerid_t id = {0};
+    unsigned int rings = 0;
+    uint64_t lastRing = 0;
+    uint64_t lastId = 0;
+    bool looked = false;
+    bool known = false;
+    *entry = NULL;
+    while (linewatch_powered(&modem->lineWatch) && !__atomic_load_n(&stopping, __ATOMIC_ACQUIRE)) {
+        char *line = buf;
+        char *eol;
+        ssize_t bytes;
+        if (rings == 0 && should_busy_out(modem)) {
+            return 0;
+        }
+        if (rings > 0 && mono_msec() - lastRing >= RING_GAP_MS) {
+            log_info(modem->tag, "The caller hung up after %u ring%s.", rings, rings == 1 ? "" : "s");
+            return -1;
+        }
+        /* Nothing new still gets a look below, so a caller we know gets answered once their caller ID's all in. */
+        if (!wait_modem(modem, 100000) || (bytes = read(modem->fd, buf + len, sizeof(buf) - 1 - len)) <= 0) {
+            bytes = 0;
+        }
+        len += bytes;
+        buf[len] = 0;
+        /* A line at a time. RING is "2" with numeric result codes. */
+        while ((eol = strpbrk(line, "\r\n")) != NULL) {
+            *eol = 0;
+            if (strcmp(line, "2") == 0 || strcmp(line, "RING") == 0) {
+                if (rings++ == 0) {
+                    begin_call(modem);
+                    __atomic_store_n(&modem->waitingForRing, false, __ATOMIC_RELEASE);
+                }
+                lastRing = mono_msec();
+                modem->call.rings = rings;
+                log_debug(modem->tag, "Ring %u.", rings);
+            } else if (rings > 0 && callerid_parse(&id, line)) {
+                lastId = mono_msec();
+                strcpy(modem->call.callerNumber, id.number);
+                strcpy(modem->call.callerName, id.name);
+            }
+            line = eol + 1;
+        }
+        len = strlen(line);
+        /* Something that long isn't a line from the modem. */
+        len = len < sizeof(buf) - 1 ? len : 0;
+        memmove(buf, line, len);
+
+        if (rings == 0 || (looked && *entry != NULL && (*entry)->action == CALLER_DENY)) {
+            continue;
+        }
+        /* Decide once we know who it is, or once we've waited long enough to know we won't. */
+        if (!looked && (id.haveNumber || rings >= answerRings)) {
+            const char *who = !id.haveNumber || id.number[0] == 0 || strcmp(id.number, "O") == 0 ? "an unknown number" :
+                strcmp(id.number, "P") == 0 ? "a withheld number" : id.number;
+            looked = true;
+            *entry = callerid_lookup(&callerTable, id.haveNumber ? &id : NULL, &known);
+            log_info(modem->tag, "Call from %s%s%s%s: %s.", who,
+                id.name[0] ? " (" : "", id.name, id.name[0] ? ")" : "",
+                *entry != NULL ? callerid_action_name((*entry)->action) : "allow");
+            if (*entry != NULL && (*entry)->action == CALLER_DENY) {
+                /* Let it ring out, so the rest of its rings don't look like another call. */
+                strcpy(modem->call.backend, "denied");
+                continue;
+            }
+        }
+        /*
+         * Callers we know don't have to wait, but the rest of their caller ID
+         * (the name comes after the number) has to be in first, or it gets
+         * taken for the answer to ATH1.
+         */
+        if (looked && (known || rings >= answerRings) && (lastId == 0 || mono_msec() - lastId >= CALLERID_QUIET_MS)) {
+            return 1;
+        }
+    }
+    return rings > 0 ? -1 : 0;
+}
+
+void ring_loop(modem_t *modem) {
+    while (!__atomic_load_n(&stopping, __ATOMIC_ACQUIRE)) {
+        const caller_entry_t *entry;
+        int res;
+        if (!linewatch_powered(&modem->lineWatch)) {
+            linewatch_wait_power(&modem->lineWatch, &stopping);
+            reset_modem(modem);
+        }
+        if (should_busy_out(modem)) {
+            busy_out(modem);
+            continue;
+        }
+        if (!setup_ring(modem)) {
+            if (!linewatch_powered(&modem->lineWatch)) {
+                continue;
+            }
+            break;
+        }
+        log_info(modem->tag, "Waiting for the line to ring...");
+        __atomic_store_n(&modem->waitingForRing, true, __ATOMIC_RELEASE);
+        res = wait_rings(modem, &entry);
+        __atomic_store_n(&modem->waitingForRing, false, __ATOMIC_RELEASE);
+        if (res <= 0) {
+            if (res < 0) {
+                end_call(modem);
+            }
+            continue;
+        }
+        modem->call.dialingMs = end_phase(modem);
+        if (entry != NULL && entry->action == CALLER_ROUTE) {
+            modem->route = &entry->route;
+            modem->backend = entry->route.backend;
+        } else if (!route_call(modem)) {
+            /* dialin checks for a default before it starts, so this shouldn't happen. */
+            log_warn(modem->tag, "Nothing in the dial plan takes calls with no number.");
+            end_call(modem);
+            continue;
+        }
+        if (modem->backend == BACKEND_LINETEST) {
+            test_line(modem);
+            end_call(modem);
+            continue;
+        }
+        if (modem->backend == BACKEND_PROMPT) {
+            answer_prompt(modem, modem->route->target);
+            end_call(modem);
+            continue;
+        }
+        log_info(modem->tag, "Picking up after %u ring%s...", modem->call.rings, modem->call.rings == 1 ? "" : "s");
+        if (answer_call(modem)) {
+            log_info(modem->tag, "Client connected!");
+            wait_session(modem);
+            end_call(modem);
+            reset_modem(modem);
+        } else {
+            log_warn(modem->tag, "Client failed to connect. :(");
+            end_call(modem);
+        }
+    }
+}
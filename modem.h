@@ -0,0 +1,141 @@
+#ifndef MODEM_H
+#define MODEM_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <linux/serial.h>
+#include "cdr.h"
+#include "ppp.h"
+#include "relay.h"
+#include "slip.h"
+#include "l2tp.h"
+#include "dialplan.h"
+#include "linewatch.h"
+#include "callerid.h"
+#include "linetest.h"
+#include "audio.h"
+#include "record.h"
+
+typedef enum {
+    IDLE = 0,
+    SENDING_DIALTONE,
+    CLIENT_DIALING,
+    CONNECTING,
+    CONNECTED,
+    PLAYING_PROMPT
+} modem_state_t;
+
+typedef struct {
+    int fd;
+    /* What we're playing to the caller (the dialtone, or a prompt), and whether it goes round again at the end. */
+    const unsigned char *voiceBuf;
+    int voiceSize;
+    bool voiceLoop;
+    /* When it started (minus the second we send up front), how much of it we've sent and where we're up to. In bytes. */
+    uint64_t voiceStart;
+    uint64_t voiceSent;
+    int voicePos;
+    /* The voice format we picked from the modem's AT+VSM=? list, and its compression method number. */
+    bool voiceFormatKnown;
+    audio_format_t voiceFormat;
+    int voiceCml;
+    /* The modem's sending us what it hears as well (AT+VTR), not just events. */
+    bool voiceDuplex;
+    /* Record the voice audio on this line's calls (-R), and the call's recording while there's one going. */
+    bool recordVoice;
+    recording_t *recording;
+    modem_state_t state;
+    backend_t backend;
+    /* pppd, or the fax receiver when backend is BACKEND_FAX. */
+    pid_t pppd;
+    /* Read end of pppd's stdout, while it's running. */
+    int pppdOut;
+    /* The in-process PPP session when backend is BACKEND_PPP. */
+    ppp_t ppp;
+    /* The TCP relay when backend is BACKEND_TCP, and the dial plan entry that picked it. */
+    relay_t relay;
+    const dialplan_entry_t *route;
+    /* SLIP when backend is BACKEND_SLIP or BACKEND_CSLIP. */
+    slip_t slip;
+    /* The session to the LNS when backend is BACKEND_L2TP. */
+    l2tp_t l2tp;
+    pthread_t thread;
+    /* Where we are in modems[]. */
+    int index;
+    int rate;
+    char path[512];
+    /* Short name used to tag log messages. */
+    char tag[16];
+    /* Text of the last response we got from the modem. */
+    char lastResponse[256];
+    /* We got a DLE as the last byte of a read. */
+    bool dlePending;
+    /* Record for the call in progress. */
+    cdr_t call;
+    uint64_t phaseStart;
+    struct serial_icounter_struct callCounts;
+    /* The watchdog ended the call. */
+    bool watchdogEnded;
+    /* DCD, RI and DSR, on lines that can tell us about them. */
+    linewatch_t lineWatch;
+    /* How the line did the last time it was tested. */
+    line_quality_t quality;
+    /* On hook waiting for a call, in ring mode. */
+    bool waitingForRing;
+} modem_t;
+
+#define MAX_MODEMS 1024
+/* How long we give the client to finish dialing after the first digit. */
+#define DIAL_WAIT_MS 5000
+/* Silence from the caller during dialtone for this long (in 1/10s) and they've left. */
+#define DIALTONE_SILENCE_DS 100
+/* Rings come every 6s. Nothing for longer than this and the caller's hung up. */
+#define RING_GAP_MS 8000
+/* Caller ID lines come together. Nothing for this long after one and that's all of them. */
+#define CALLERID_QUIET_MS 300
+/* How often a busied out line looks for whether it's still needed. */
+#define BUSY_OUT_CHECK_USEC 5000000
+/* How far ahead of the modem we keep the test tones. */
+#define LINETEST_LEAD_USEC 250000
+#define LINETEST_TIMEOUT_USEC 10000000
+/* pppd asks for unit PPPD_UNIT_BASE + line. It takes another if that's in use, so its interface is whatever it says it got. */
+#define PPPD_UNIT_BASE 100
+
+extern char pppdPath[256];
+extern modem_t *modems[MAX_MODEMS];
+extern int numModems;
+extern bool cdrEnabled;
+extern ppp_config_t pppConfig;
+/* Calls go to defaultBackend unless there's a dial plan. */
+extern dialplan_t dialPlan;
+extern backend_t defaultBackend;
+/* On a real phone line: answer after this many rings instead of giving dialtone. 0 for dialtone. */
+extern unsigned int answerRings;
+/* Set when dialin's been told to quit. Lines finish the call they're on and their loops end. */
+extern bool stopping;
+extern caller_table_t callerTable;
+
+uint32_t end_phase(modem_t *modem);
+bool send_string(int fd, char* str);
+void hangup_line(modem_t *modem);
+void reset_modem(modem_t *modem);
+int init_modem(modem_t *modem, char *path, unsigned int rate);
+int get_response(modem_t *modem, unsigned int attempts);
+void parse_connect(modem_t *modem, int code);
+void begin_call(modem_t *modem);
+void end_call(modem_t *modem);
+bool add_digits(modem_t *modem, const char *events, int numEvents);
+bool send_escape(modem_t *modem);
+bool send_voice(modem_t *modem);
+bool start_dialtone(modem_t *modem);
+bool stop_dialtone(modem_t *modem);
+void test_line(modem_t *modem);
+void answer_prompt(modem_t *modem, const char *name);
+bool route_call(modem_t *modem);
+bool answer_call(modem_t *modem);
+int wait_session(modem_t *modem);
+void modem_loop(modem_t *modem);
+void ring_loop(modem_t *modem);
+
+#endif
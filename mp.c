@@ -0,0 +1,334 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "mp.h"
+
+#define CONTROL_QUEUE 8
+
+typedef struct {
+    bool used;
+    uint8_t flags;
+    uint32_t seq;
+    uint16_t len;
+    uint8_t data[MP_MAX_PACKET];
+} mp_frag_t;
+
+struct mp_bundle_s {
+    char key[160];
+    char ifname[IFNAMSIZ];
+    int fd;
+    int unit;
+    pthread_mutex_t lock;
+    const char *tags[MP_MAX_LINKS];
+    int numLinks;
+    bool masterGone;
+    uint32_t txSeq;
+    /* Reassembly. lastSeq is the newest fragment each line has given us. */
+    bool rxStarted;
+    uint32_t rxNext;
+    bool linkHeard[MP_MAX_LINKS];
+    uint32_t lastSeq[MP_MAX_LINKS];
+    mp_frag_t frags[MP_WINDOW];
+    uint8_t packet[MP_MAX_PACKET];
+    /* Control packets for the first line. */
+    pthread_mutex_t controlLock;
+    uint8_t control[CONTROL_QUEUE][MP_MAX_PACKET];
+    size_t controlLen[CONTROL_QUEUE];
+    int controlHead;
+    int controlTail;
+    struct mp_bundle_s *next;
+};
+
+static mp_bundle_t *bundles = NULL;
+static pthread_mutex_t bundlesLock = PTHREAD_MUTEX_INITIALIZER;
+
+/* a comes before b, with 24 bit wraparound. */
+static bool seq_before(uint32_t a, uint32_t b) {
+    return ((a - b) & 0x800000) != 0;
+}
+
+static uint32_t seq_diff(uint32_t a, uint32_t b) {
+    return (a - b) & MP_SEQ_MASK;
+}
+
+mp_bundle_t *mp_join(const char *key, const char *tag, int fd, int unit, const char *ifname, int *slot) {
+    mp_bundle_t *bundle;
+    pthread_mutex_lock(&bundlesLock);
+    for (bundle = bundles; bundle != NULL; bundle = bundle->next) {
+        /* One that's on its way out doesn't count. */
+        if (!bundle->masterGone && strcmp(bundle->key, key) == 0) {
+            break;
+        }
+    }
+    if (bundle != NULL) {
+        pthread_mutex_lock(&bundle->lock);
+        for (*slot = 1; *slot < MP_MAX_LINKS && bundle->tags[*slot] != NULL; (*slot)++) {
+        }
+        if (*slot == MP_MAX_LINKS) {
+            pthread_mutex_unlock(&bundle->lock);
+            pthread_mutex_unlock(&bundlesLock);
+            return NULL;
+        }
+        bundle->tags[*slot] = tag;
+        bundle->linkHeard[*slot] = false;
+        bundle->numLinks++;
+        pthread_mutex_unlock(&bundle->lock);
+        pthread_mutex_unlock(&bundlesLock);
+        return bundle;
+    }
+    if ((bundle = calloc(1, sizeof(mp_bundle_t))) == NULL) {
+        pthread_mutex_unlock(&bundlesLock);
+        return NULL;
+    }
+    snprintf(bundle->key, sizeof(bundle->key), "%s", key);
+    snprintf(bundle->ifname, sizeof(bundle->ifname), "%s", ifname);
+    bundle->fd = fd;
+    bundle->unit = unit;
+    pthread_mutex_init(&bundle->lock, NULL);
+    pthread_mutex_init(&bundle->controlLock, NULL);
+    bundle->tags[0] = tag;
+    bundle->numLinks = 1;
+    bundle->next = bundles;
+    bundles = bundle;
+    *slot = 0;
+    pthread_mutex_unlock(&bundlesLock);
+    return bundle;
+}
+
+int mp_leave(mp_bundle_t *bundle, int slot) {
+    int left;
+    pthread_mutex_lock(&bundlesLock);
+    pthread_mutex_lock(&bundle->lock);
+    bundle->tags[slot] = NULL;
+    bundle->linkHeard[slot] = false;
+    if (slot == 0) {
+        __atomic_store_n(&bundle->masterGone, true, __ATOMIC_RELEASE);
+    }
+    left = --bundle->numLinks;
+    pthread_mutex_unlock(&bundle->lock);
+    if (left == 0) {
+        for (mp_bundle_t **p = &bundles; *p != NULL; p = &(*p)->next) {
+            if (*p == bundle) {
+                *p = bundle->next;
+                break;
+            }
+        }
+    }
+    pthread_mutex_unlock(&bundlesLock);
+    if (left == 0) {
+        if (bundle->fd >= 0) {
+            close(bundle->fd);
+        }
+        pthread_mutex_destroy(&bundle->lock);
+        pthread_mutex_destroy(&bundle->controlLock);
+        free(bundle);
+    }
+    return left;
+}
+
+int mp_fd(const mp_bundle_t *bundle) {
+    return bundle->fd;
+}
+
+int mp_unit(const mp_bundle_t *bundle) {
+    return bundle->unit;
+}
+
+const char *mp_ifname(const mp_bundle_t *bundle) {
+    return bundle->ifname;
+}
+
+int mp_links(mp_bundle_t *bundle) {
+    int links;
+    pthread_mutex_lock(&bundle->lock);
+    links = bundle->numLinks;
+    pthread_mutex_unlock(&bundle->lock);
+    return links;
+}
+
+bool mp_master_gone(mp_bundle_t *bundle) {
+    return __atomic_load_n(&bundle->masterGone, __ATOMIC_ACQUIRE);
+}
+
+uint32_t mp_next_seq(mp_bundle_t *bundle, int count) {
+    return __atomic_fetch_add(&bundle->txSeq, count, __ATOMIC_RELAXED);
+}
+
+size_t mp_header(uint8_t *out, uint8_t flags, uint32_t seq, bool shortSeq) {
+    if (shortSeq) {
+        out[0] = flags | ((seq >> 8) & 0x0f);
+        out[1] = seq;
+        return 2;
+    }
+    out[0] = flags;
+    out[1] = seq >> 16;
+    out[2] = seq >> 8;
+    out[3] = seq;
+    return 4;
+}
+
+static void drop(mp_bundle_t *bundle, uint32_t seq) {
+    mp_frag_t *frag = &bundle->frags[seq % MP_WINDOW];
+    if (frag->used && frag->seq == seq) {
+        frag->used = false;
+    }
+}
+
+static mp_frag_t *find(mp_bundle_t *bundle, uint32_t seq) {
+    mp_frag_t *frag = &bundle->frags[seq % MP_WINDOW];
+    return frag->used && frag->seq == seq ? frag : NULL;
+}
+
+/*
+ * Hand over every packet that's complete from rxNext on. A fragment that
+ * hasn't shown up by the time every line has sent something newer is lost
+ * (each line keeps its own order), so skip past it.
+ */
+static void reassemble(mp_bundle_t *bundle, mp_deliver_cb deliver, void *ctx) {
+    uint32_t oldest = 0;
+    bool any = false;
+    for (int i = 0; i < MP_MAX_LINKS; i++) {
+        if (bundle->tags[i] != NULL && bundle->linkHeard[i] && (!any || seq_before(bundle->lastSeq[i], oldest))) {
+            oldest = bundle->lastSeq[i];
+            any = true;
+        }
+    }
+    while (true) {
+        mp_frag_t *frag = find(bundle, bundle->rxNext);
+        uint32_t seq = bundle->rxNext;
+        size_t len = 0;
+        bool complete = false;
+        if (frag == NULL) {
+            if (any && seq_before(bundle->rxNext, oldest)) {
+                bundle->rxNext = (bundle->rxNext + 1) & MP_SEQ_MASK;
+                continue;
+            }
+            return;
+        }
+        if (!(frag->flags & MP_BEGIN)) {
+            /* The start of this one was lost. */
+            drop(bundle, seq);
+            bundle->rxNext = (seq + 1) & MP_SEQ_MASK;
+            continue;
+        }
+        while ((frag = find(bundle, seq)) != NULL && seq_diff(seq, bundle->rxNext) < MP_WINDOW) {
+            if (seq != bundle->rxNext && (frag->flags & MP_BEGIN)) {
+                break;
+            }
+            if (frag->flags & MP_END) {
+                complete = true;
+                break;
+            }
+            seq = (seq + 1) & MP_SEQ_MASK;
+        }
+        if (complete) {
+            for (uint32_t s = bundle->rxNext; ; s = (s + 1) & MP_SEQ_MASK) {
+                frag = find(bundle, s);
+                if (len + frag->len <= sizeof(bundle->packet)) {
+                    memcpy(bundle->packet + len, frag->data, frag->len);
+                }
+                len += frag->len;
+                frag->used = false;
+                if (s == seq) {
+                    break;
+                }
+            }
+            if (len <= sizeof(bundle->packet)) {
+                deliver(ctx, bundle->packet, len);
+            }
+            bundle->rxNext = (seq + 1) & MP_SEQ_MASK;
+            continue;
+        }
+        if (find(bundle, seq) != NULL || (any && seq_before(seq, oldest))) {
+            /* A new packet started before this one ended, or the gap is a lost fragment. Give up on it. */
+            for (uint32_t s = bundle->rxNext; s != seq; s = (s + 1) & MP_SEQ_MASK) {
+                drop(bundle, s);
+            }
+            bundle->rxNext = seq;
+            if (find(bundle, seq) == NULL) {
+                bundle->rxNext = (seq + 1) & MP_SEQ_MASK;
+            }
+            continue;
+        }
+        return;
+    }
+}
+
+void mp_receive(mp_bundle_t *bundle, int slot, const uint8_t *frag, size_t len, mp_deliver_cb deliver, void *ctx) {
+    uint32_t seq;
+    mp_frag_t *slotFrag;
+    /* We never ask for short sequence numbers, so they're always long. */
+    if (len < 4) {
+        return;
+    }
+    seq = ((uint32_t)frag[1] << 16) | (frag[2] << 8) | frag[3];
+    pthread_mutex_lock(&bundle->lock);
+    if (!bundle->rxStarted) {
+        bundle->rxStarted = true;
+        bundle->rxNext = seq;
+    }
+    bundle->lastSeq[slot] = seq;
+    bundle->linkHeard[slot] = true;
+    if (seq_before(seq, bundle->rxNext) || len - 4 > MP_MAX_PACKET) {
+        pthread_mutex_unlock(&bundle->lock);
+        return;
+    }
+    /* Too far ahead to hold. Whatever we were waiting for isn't coming. */
+    while (seq_diff(seq, bundle->rxNext) >= MP_WINDOW) {
+        drop(bundle, bundle->rxNext);
+        bundle->rxNext = (bundle->rxNext + 1) & MP_SEQ_MASK;
+    }
+    slotFrag = &bundle->frags[seq % MP_WINDOW];
+    slotFrag->used = true;
+    slotFrag->flags = frag[0] & (MP_BEGIN | MP_END);
+    slotFrag->seq = seq;
+    slotFrag->len = len - 4;
+    memcpy(slotFrag->data, frag + 4, len - 4);
+    reassemble(bundle, deliver, ctx);
+    pthread_mutex_unlock(&bundle->lock);
+}
+
+void mp_push_control(mp_bundle_t *bundle, const uint8_t *packet, size_t len) {
+    pthread_mutex_lock(&bundle->controlLock);
+    if (bundle->controlTail - bundle->controlHead < CONTROL_QUEUE && len <= MP_MAX_PACKET) {
+        int i = bundle->controlTail++ % CONTROL_QUEUE;
+        memcpy(bundle->control[i], packet, len);
+        bundle->controlLen[i] = len;
+    }
+    pthread_mutex_unlock(&bundle->controlLock);
+}
+
+size_t mp_pop_control(mp_bundle_t *bundle, uint8_t *packet, size_t size) {
+    size_t len = 0;
+    pthread_mutex_lock(&bundle->controlLock);
+    if (bundle->controlHead != bundle->controlTail) {
+        int i = bundle->controlHead++ % CONTROL_QUEUE;
+        len = bundle->controlLen[i] <= size ? bundle->controlLen[i] : 0;
+        memcpy(packet, bundle->control[i], len);
+    }
+    pthread_mutex_unlock(&bundle->controlLock);
+    return len;
+}
+
+int mp_snapshot(mp_info_t *info, int max) {
+    int count = 0;
+    pthread_mutex_lock(&bundlesLock);
+    for (mp_bundle_t *bundle = bundles; bundle != NULL && count < max; bundle = bundle->next, count++) {
+        int n = 0;
+        pthread_mutex_lock(&bundle->lock);
+        memcpy(info[count].key, bundle->key, sizeof(info[count].key));
+        memcpy(info[count].ifname, bundle->ifname, sizeof(info[count].ifname));
+        info[count].numLinks = bundle->numLinks;
+        for (int i = 0; i < MP_MAX_LINKS; i++) {
+            info[count].tags[i][0] = 0;
+            if (bundle->tags[i] != NULL) {
+                snprintf(info[count].tags[n++], sizeof(info[count].tags[0]), "%s", bundle->tags[i]);
+            }
+        }
+        pthread_mutex_unlock(&bundle->lock);
+    }
+    pthread_mutex_unlock(&bundlesLock);
+    return count;
+}
@@ -0,0 +1,67 @@
+#ifndef MP_H
+#define MP_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <net/if.h>
+
+/*
+ * Multilink PPP (RFC 1990) bundles. Every line in a bundle has its own PPP
+ * session on its own thread, and they meet here: the bundle holds the ppp
+ * unit or TUN device they share, hands out sequence numbers, and puts
+ * fragments from all of them back together in order.
+ *
+ * The first line in makes the bundle and runs IPCP for it. The bundle lasts
+ * until every line has left, but once the first one goes the rest follow.
+ */
+
+#define MP_MAX_LINKS 8
+/* Fragments we'll hold while waiting for a missing one. */
+#define MP_WINDOW 64
+#define MP_MAX_PACKET 1600
+#define MP_BEGIN 0x80
+#define MP_END 0x40
+#define MP_SEQ_MASK 0xffffff
+#define MP_SHORT_SEQ_MASK 0xfff
+
+typedef struct mp_bundle_s mp_bundle_t;
+
+/* Gets every packet the bundle puts back together, with the bundle locked, so don't call back into it. */
+typedef void (*mp_deliver_cb)(void *ctx, const uint8_t *packet, size_t len);
+
+/* For metrics. */
+typedef struct {
+    char key[160];
+    char ifname[IFNAMSIZ];
+    int numLinks;
+    char tags[MP_MAX_LINKS][16];
+} mp_info_t;
+
+/*
+ * Join the bundle for key, or make one with the shared fd, unit and interface
+ * if there isn't one. The bundle closes fd once everyone has left. *slot is
+ * 0 if we made it. NULL if the bundle is full.
+ */
+mp_bundle_t *mp_join(const char *key, const char *tag, int fd, int unit, const char *ifname, int *slot);
+/* Returns how many lines are left. */
+int mp_leave(mp_bundle_t *bundle, int slot);
+int mp_fd(const mp_bundle_t *bundle);
+int mp_unit(const mp_bundle_t *bundle);
+const char *mp_ifname(const mp_bundle_t *bundle);
+int mp_links(mp_bundle_t *bundle);
+/* The line that made the bundle has left. */
+bool mp_master_gone(mp_bundle_t *bundle);
+/* Sequence numbers for count fragments in a row. Returns the first. */
+uint32_t mp_next_seq(mp_bundle_t *bundle, int count);
+/* Write a fragment header. Returns its length. */
+size_t mp_header(uint8_t *out, uint8_t flags, uint32_t seq, bool shortSeq);
+/* A fragment (header and all) that came in on slot's line. */
+void mp_receive(mp_bundle_t *bundle, int slot, const uint8_t *frag, size_t len, mp_deliver_cb deliver, void *ctx);
+/* Packets that came in on other lines for the one running IPCP. */
+void mp_push_control(mp_bundle_t *bundle, const uint8_t *packet, size_t len);
+/* Returns the length, or 0 if there aren't any. */
+size_t mp_pop_control(mp_bundle_t *bundle, uint8_t *packet, size_t size);
+/* Copy out up to max bundles. Returns how many. */
+int mp_snapshot(mp_info_t *info, int max);
+
+#endif
@@ -0,0 +1,116 @@
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <linux/if_addr.h>
+#include "netlink.h"
+
+typedef struct {
+    struct nlmsghdr hdr;
+    union {
+        struct ifinfomsg link;
+        struct ifaddrmsg addr;
+    };
+    uint8_t attrs[64];
+} nl_request_t;
+
+static void add_attr(nl_request_t *req, uint16_t type, const void *data, uint16_t len) {
+    struct rtattr *attr = (struct rtattr*)((uint8_t*)req + NLMSG_ALIGN(req->hdr.nlmsg_len));
+    attr->rta_type = type;
+    attr->rta_len = RTA_LENGTH(len);
+    memcpy(RTA_DATA(attr), data, len);
+    req->hdr.nlmsg_len = NLMSG_ALIGN(req->hdr.nlmsg_len) + RTA_ALIGN(attr->rta_len);
+}
+
+/* Send it and wait for the kernel's ack. */
+static bool talk(int sock, nl_request_t *req) {
+    struct sockaddr_nl kernel = {.nl_family = AF_NETLINK};
+    uint8_t buf[1024];
+    ssize_t bytes;
+    req->hdr.nlmsg_flags |= NLM_F_REQUEST | NLM_F_ACK;
+    if (sendto(sock, req, req->hdr.nlmsg_len, 0, (struct sockaddr*)&kernel, sizeof(kernel)) < 0) {
+        return false;
+    }
+    while ((bytes = recv(sock, buf, sizeof(buf), 0)) > 0) {
+        for (struct nlmsghdr *hdr = (struct nlmsghdr*)buf; NLMSG_OK(hdr, bytes); hdr = NLMSG_NEXT(hdr, bytes)) {
+            if (hdr->nlmsg_type == NLMSG_ERROR) {
+                int err = ((struct nlmsgerr*)NLMSG_DATA(hdr))->error;
+                errno = -err;
+                return err == 0;
+            }
+        }
+    }
+    return false;
+}
+
+static int open_netlink(void) {
+    struct timeval timeout = {1, 0};
+    int sock = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (sock >= 0) {
+        setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    }
+    return sock;
+}
+
+static bool set_link(int sock, int index, int mtu, bool up) {
+    nl_request_t req;
+    memset(&req, 0, sizeof(req));
+    req.hdr.nlmsg_len = NLMSG_LENGTH(sizeof(struct ifinfomsg));
+    req.hdr.nlmsg_type = RTM_NEWLINK;
+    req.link.ifi_family = AF_UNSPEC;
+    req.link.ifi_index = index;
+    req.link.ifi_flags = up ? IFF_UP : 0;
+    req.link.ifi_change = IFF_UP;
+    if (mtu > 0) {
+        uint32_t val = mtu;
+        add_attr(&req, IFLA_MTU, &val, sizeof(val));
+    }
+    return talk(sock, &req);
+}
+
+bool netif_up(const char *ifname, struct in_addr local, struct in_addr peer, int mtu) {
+    nl_request_t req;
+    int index = if_nametoindex(ifname);
+    int sock;
+    bool ok;
+    if (index == 0 || (sock = open_netlink()) < 0) {
+        return false;
+    }
+    /* Point to point: IFA_LOCAL is us, IFA_ADDRESS is the other end. */
+    memset(&req, 0, sizeof(req));
+    req.hdr.nlmsg_len = NLMSG_LENGTH(sizeof(struct ifaddrmsg));
+    req.hdr.nlmsg_type = RTM_NEWADDR;
+    req.hdr.nlmsg_flags = NLM_F_CREATE | NLM_F_REPLACE;
+    req.addr.ifa_family = AF_INET;
+    req.addr.ifa_prefixlen = 32;
+    req.addr.ifa_index = index;
+    add_attr(&req, IFA_LOCAL, &local, sizeof(local));
+    add_attr(&req, IFA_ADDRESS, &peer, sizeof(peer));
+    ok = talk(sock, &req) && set_link(sock, index, mtu, true);
+    close(sock);
+    return ok;
+}
+
+bool netif_down(const char *ifname) {
+    nl_request_t req;
+    int index = if_nametoindex(ifname);
+    int sock;
+    bool ok;
+    if (index == 0 || (sock = open_netlink()) < 0) {
+        return false;
+    }
+    ok = set_link(sock, index, 0, false);
+    /* Taking the addresses off too means the next call on this interface starts clean. */
+    memset(&req, 0, sizeof(req));
+    req.hdr.nlmsg_len = NLMSG_LENGTH(sizeof(struct ifaddrmsg));
+    req.hdr.nlmsg_type = RTM_DELADDR;
+    req.addr.ifa_family = AF_INET;
+    req.addr.ifa_index = index;
+    for (int i = 0; i < 8 && talk(sock, &req); i++) {
+    }
+    close(sock);
+    return ok;
+}
@@ -0,0 +1,13 @@
+#ifndef NETLINK_H
+#define NETLINK_H
+#include <stdbool.h>
+#include <netinet/in.h>
+
+/* Point to point interface setup over rtnetlink, so we don't need ip or ifconfig. */
+
+/* Give ifname our address and the peer's, set the MTU and bring it up. */
+bool netif_up(const char *ifname, struct in_addr local, struct in_addr peer, int mtu);
+/* Take it down and drop its addresses. */
+bool netif_down(const char *ifname);
+
+#endif
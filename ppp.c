@@ -0,0 +1,1716 @@
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <arpa/inet.h>
+#include <sys/ioctl.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <linux/ppp-ioctl.h>
+#include <linux/ppp_defs.h>
+#include <linux/if_tun.h>
+#include "log.h"
+#include "md5.h"
+#include "clock.h"
+#include "ppp.h"
+#include "linkstats.h"
+#include "rfc2217.h"
+#include "linewatch.h"
+
+/* Packet codes. 1-7 are shared by LCP and IPCP. */
+#define CONFREQ 1
+#define CONFACK 2
+#define CONFNAK 3
+#define CONFREJ 4
+#define TERMREQ 5
+#define TERMACK 6
+#define CODEREJ 7
+#define PROTREJ 8
+#define ECHOREQ 9
+#define ECHOREP 10
+#define DISCREQ 11
+
+/* LCP options. */
+#define LCP_MRU 1
+#define LCP_ACCM 2
+#define LCP_AUTH 3
+#define LCP_MAGIC 5
+#define LCP_PFC 7
+#define LCP_ACFC 8
+#define LCP_MRRU 17
+#define LCP_SSNHF 18
+#define LCP_EPDISC 19
+/* Locally assigned endpoint discriminator. */
+#define EPDISC_LOCAL 1
+
+/* IPCP options. */
+#define IPCP_ADDR 3
+#define IPCP_DNS1 129
+#define IPCP_DNS2 131
+
+/* The same numbers pppd uses. */
+#define RESTART_USEC 3000000
+#define MAX_CONFIGURE 10
+#define MAX_TERMINATE 2
+#define MAX_FAILURE 5
+#define AUTH_WAIT_USEC 30000000
+#define MIN_MRU 128
+/* Longest we go without looking for a close request. */
+#define CHECK_USEC 250000
+#define CHAP_MD5 5
+#define CHAP_NAME "dialin"
+
+#define FRAME_SIZE 1504
+/* Enough for a second of a fast line. IP from the TUN waits when it's full. */
+#define TX_SIZE 32768
+#define TTY_READ_SIZE 4096
+/* Packets read from the TUN per wakeup. */
+#define TUN_BATCH 32
+
+/* RFC 1661's option negotiation automaton, minus the states we never use since the link is already up. */
+enum {
+    FSM_CLOSED = 0,
+    FSM_STOPPED,
+    FSM_CLOSING,
+    FSM_STOPPING,
+    FSM_REQSENT,
+    FSM_ACKRCVD,
+    FSM_ACKSENT,
+    FSM_OPENED
+};
+
+typedef struct fsm_callbacks_s {
+    const char *name;
+    uint16_t protocol;
+    /* Write our Configure-Request options to buf. Returns the length. */
+    int (*add_request)(ppp_t *ppp, uint8_t *buf);
+    /* The peer Nak'd or rejected some of our options. */
+    void (*got_nak)(ppp_t *ppp, const uint8_t *opts, int len, bool reject);
+    /* Look over the peer's options. Returns CONFACK, or CONFNAK or CONFREJ with the options to send back in reply. */
+    int (*check_request)(ppp_t *ppp, const uint8_t *opts, int len, uint8_t *reply, int *replyLen);
+    void (*up)(ppp_t *ppp);
+    void (*down)(ppp_t *ppp);
+    /* Negotiation is over for good. */
+    void (*finished)(ppp_t *ppp);
+    /* Codes past CODEREJ. Returns false if we don't know it. */
+    bool (*other)(ppp_t *ppp, uint8_t code, uint8_t id, const uint8_t *data, int len);
+} fsm_callbacks_t;
+
+static uint32_t get_u32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static void put_u32(uint8_t *p, uint32_t val) {
+    p[0] = val >> 24;
+    p[1] = val >> 16;
+    p[2] = val >> 8;
+    p[3] = val;
+}
+
+static void get_random(void *buf, size_t len) {
+    int fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+    if (fd < 0 || read(fd, buf, len) != len) {
+        for (size_t i = 0; i < len; i++) {
+            ((uint8_t*)buf)[i] = rand();
+        }
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+/* Write out as much of the queued frames as the TTY will take. */
+static void flush_tx(ppp_t *ppp) {
+    while (ppp->txOff < ppp->txLen) {
+        ssize_t bytes = write(ppp->ttyFd, ppp->txBuf + ppp->txOff, ppp->txLen - ppp->txOff);
+        if (bytes <= 0) {
+            if (bytes < 0 && errno != EAGAIN && errno != EINTR) {
+                log_debug(ppp->tag, "Write failed: %s", strerror(errno));
+                ppp->txOff = ppp->txLen;
+            }
+            break;
+        }
+        ppp->txOff += bytes;
+    }
+    if (ppp->txOff == ppp->txLen) {
+        ppp->txOff = 0;
+        ppp->txLen = 0;
+    }
+}
+
+static bool tx_room(ppp_t *ppp, int len) {
+    return ppp->txLen + HDLC_MAX_ENCODED(len + 4) <= TX_SIZE;
+}
+
+/* Once multilink is up, everything but LCP and auth goes out as MP fragments that fit the peer's MRU. */
+static void queue_mp(ppp_t *ppp, uint16_t protocol, const uint8_t *data, int len) {
+    uint8_t packet[FRAME_SIZE + 2];
+    int hdrMax = ppp->peerShortSeq ? 2 : 4;
+    int chunk = ppp->peerMru - hdrMax;
+    int total, count;
+    uint32_t seq;
+    if (len > FRAME_SIZE) {
+        len = FRAME_SIZE;
+    }
+    packet[0] = protocol >> 8;
+    packet[1] = protocol;
+    memcpy(packet + 2, data, len);
+    total = len + 2;
+    count = (total + chunk - 1)/chunk;
+    if (!tx_room(ppp, total + count*(hdrMax + 4))) {
+        flush_tx(ppp);
+        if (!tx_room(ppp, total + count*(hdrMax + 4))) {
+            log_debug(ppp->tag, "TX queue full. Dropping a %04x packet.", protocol);
+            return;
+        }
+    }
+    seq = mp_next_seq(ppp->bundle, count);
+    for (int off = 0; off < total; off += chunk, seq++) {
+        uint8_t hdr[8];
+        int hdrLen = 0;
+        int n = total - off < chunk ? total - off : chunk;
+        uint8_t flags = (off == 0 ? MP_BEGIN : 0) | (off + n == total ? MP_END : 0);
+        if (!ppp->peerAcfc) {
+            hdr[hdrLen++] = 0xff;
+            hdr[hdrLen++] = 0x03;
+        }
+        if (!ppp->peerPfc) {
+            hdr[hdrLen++] = 0;
+        }
+        hdr[hdrLen++] = PPP_MP;
+        hdrLen += mp_header(hdr + hdrLen, flags, seq, ppp->peerShortSeq);
+        ppp->txLen += hdlc_encode(&ppp->tx, hdr, hdrLen, packet + off, n, ppp->txBuf + ppp->txLen);
+    }
+}
+
+/* Frame a packet onto the end of the TX queue. */
+static void queue_frame(ppp_t *ppp, uint16_t protocol, const uint8_t *data, int len) {
+    uint8_t hdr[4];
+    int hdrLen = 0;
+    /* LCP always goes out with every control character escaped and the full header (RFC 1662). */
+    static const hdlc_tx_t lcpTx = {0xffffffff, false};
+    bool lcp = protocol == PPP_LCP;
+    if (ppp->bundle != NULL && protocol < 0xc000) {
+        queue_mp(ppp, protocol, data, len);
+        return;
+    }
+    if (!tx_room(ppp, len)) {
+        flush_tx(ppp);
+        if (!tx_room(ppp, len)) {
+            log_debug(ppp->tag, "TX queue full. Dropping a %04x frame.", protocol);
+            return;
+        }
+    }
+    if (lcp || !ppp->peerAcfc) {
+        hdr[hdrLen++] = 0xff;
+        hdr[hdrLen++] = 0x03;
+    }
+    if (lcp || !ppp->peerPfc || protocol > 0xff) {
+        hdr[hdrLen++] = protocol >> 8;
+    }
+    hdr[hdrLen++] = protocol;
+    ppp->txLen += hdlc_encode(lcp ? &lcpTx : &ppp->tx, hdr, hdrLen, data, len, ppp->txBuf + ppp->txLen);
+}
+
+/* Control protocols go to the channel, network protocols to the unit, same as pppd. */
+static void send_frame(ppp_t *ppp, uint16_t protocol, const uint8_t *data, int len) {
+    uint8_t buf[FRAME_SIZE + 2];
+    int fd = protocol >= 0xc000 ? ppp->chanFd : ppp->unitFd;
+    if (ppp->userFraming) {
+        queue_frame(ppp, protocol, data, len);
+        flush_tx(ppp);
+        return;
+    }
+    if (len > FRAME_SIZE) {
+        len = FRAME_SIZE;
+    }
+    buf[0] = protocol >> 8;
+    buf[1] = protocol;
+    memcpy(buf + 2, data, len);
+    if (fd >= 0 && write(fd, buf, len + 2) != len + 2) {
+        log_debug(ppp->tag, "Couldn't send a %04x frame: %s", protocol, strerror(errno));
+    }
+}
+
+static void send_packet(ppp_t *ppp, uint16_t protocol, uint8_t code, uint8_t id, const uint8_t *data, int len) {
+    uint8_t buf[FRAME_SIZE];
+    if (len > FRAME_SIZE - 4) {
+        len = FRAME_SIZE - 4;
+    }
+    buf[0] = code;
+    buf[1] = id;
+    buf[2] = (len + 4) >> 8;
+    buf[3] = len + 4;
+    if (len > 0) {
+        memcpy(buf + 4, data, len);
+    }
+    send_frame(ppp, protocol, buf, len + 4);
+}
+
+static void fsm_send_confreq(ppp_fsm_t *fsm) {
+    uint8_t opts[64];
+    int len = fsm->cb->add_request(fsm->ppp, opts);
+    send_packet(fsm->ppp, fsm->cb->protocol, CONFREQ, ++fsm->id, opts, len);
+    fsm->retries--;
+    fsm->timer = clock_usec() + RESTART_USEC;
+}
+
+static void fsm_send_termreq(ppp_fsm_t *fsm) {
+    send_packet(fsm->ppp, fsm->cb->protocol, TERMREQ, ++fsm->id, NULL, 0);
+    fsm->retries--;
+    fsm->timer = clock_usec() + RESTART_USEC;
+}
+
+static void fsm_open(ppp_fsm_t *fsm) {
+    fsm->retries = MAX_CONFIGURE;
+    fsm->naks = 0;
+    fsm_send_confreq(fsm);
+    fsm->state = FSM_REQSENT;
+}
+
+static void fsm_close(ppp_fsm_t *fsm) {
+    if (fsm->state == FSM_OPENED) {
+        fsm->cb->down(fsm->ppp);
+    }
+    if (fsm->state >= FSM_REQSENT) {
+        fsm->retries = MAX_TERMINATE;
+        fsm_send_termreq(fsm);
+        fsm->state = FSM_CLOSING;
+    } else if (fsm->state != FSM_CLOSING) {
+        fsm->state = FSM_CLOSED;
+        fsm->timer = 0;
+        fsm->cb->finished(fsm->ppp);
+    }
+}
+
+/* The link went away under us. No packets, just stop. */
+static void fsm_lower_down(ppp_fsm_t *fsm) {
+    if (fsm->state == FSM_OPENED) {
+        fsm->cb->down(fsm->ppp);
+    }
+    fsm->state = FSM_CLOSED;
+    fsm->timer = 0;
+}
+
+static void fsm_timeout(ppp_fsm_t *fsm) {
+    fsm->timer = 0;
+    switch (fsm->state) {
+        case FSM_CLOSING:
+        case FSM_STOPPING:
+            if (fsm->retries > 0) {
+                fsm_send_termreq(fsm);
+            } else {
+                fsm->state = fsm->state == FSM_CLOSING ? FSM_CLOSED : FSM_STOPPED;
+                fsm->cb->finished(fsm->ppp);
+            }
+            break;
+        case FSM_REQSENT:
+        case FSM_ACKRCVD:
+        case FSM_ACKSENT:
+            if (fsm->retries > 0) {
+                fsm_send_confreq(fsm);
+                if (fsm->state == FSM_ACKRCVD) {
+                    fsm->state = FSM_REQSENT;
+                }
+            } else {
+                log_warn(fsm->ppp->tag, "%s: No answer to our Configure-Requests.", fsm->cb->name);
+                if (fsm->ppp->exitCode == PPP_EXIT_OK) {
+                    fsm->ppp->exitCode = PPP_EXIT_NEGOTIATION_FAILED;
+                }
+                fsm->state = FSM_STOPPED;
+                fsm->cb->finished(fsm->ppp);
+            }
+            break;
+    }
+}
+
+static void fsm_got_confreq(ppp_fsm_t *fsm, uint8_t id, const uint8_t *opts, int len) {
+    uint8_t reply[FRAME_SIZE];
+    int replyLen = 0;
+    int code;
+    switch (fsm->state) {
+        case FSM_CLOSED:
+            send_packet(fsm->ppp, fsm->cb->protocol, TERMACK, id, NULL, 0);
+            return;
+        case FSM_CLOSING:
+        case FSM_STOPPING:
+            return;
+        case FSM_OPENED:
+            /* The peer wants to start over. */
+            fsm->cb->down(fsm->ppp);
+            fsm->retries = MAX_CONFIGURE;
+            fsm_send_confreq(fsm);
+            fsm->state = FSM_REQSENT;
+            break;
+        case FSM_STOPPED:
+            fsm->retries = MAX_CONFIGURE;
+            fsm_send_confreq(fsm);
+            fsm->state = FSM_REQSENT;
+            break;
+    }
+
+    code = fsm->cb->check_request(fsm->ppp, opts, len, reply, &replyLen);
+    if (code != CONFACK && ++fsm->naks > MAX_CONFIGURE*MAX_FAILURE) {
+        log_warn(fsm->ppp->tag, "%s: We can't agree on options.", fsm->cb->name);
+        fsm->ppp->exitCode = PPP_EXIT_NEGOTIATION_FAILED;
+        fsm_close(fsm);
+        return;
+    }
+    if (code == CONFACK) {
+        send_packet(fsm->ppp, fsm->cb->protocol, code, id, opts, len);
+    } else {
+        send_packet(fsm->ppp, fsm->cb->protocol, code, id, reply, replyLen);
+    }
+    if (code == CONFACK) {
+        if (fsm->state == FSM_ACKRCVD) {
+            fsm->state = FSM_OPENED;
+            fsm->timer = 0;
+            fsm->cb->up(fsm->ppp);
+        } else {
+            fsm->state = FSM_ACKSENT;
+        }
+    } else if (fsm->state != FSM_ACKRCVD) {
+        fsm->state = FSM_REQSENT;
+    }
+}
+
+static void fsm_got_confack(ppp_fsm_t *fsm, uint8_t id) {
+    if (id != fsm->id) {
+        return;
+    }
+    switch (fsm->state) {
+        case FSM_REQSENT:
+            fsm->state = FSM_ACKRCVD;
+            fsm->retries = MAX_CONFIGURE;
+            fsm->timer = clock_usec() + RESTART_USEC;
+            break;
+        case FSM_ACKRCVD:
+            fsm_send_confreq(fsm);
+            fsm->state = FSM_REQSENT;
+            break;
+        case FSM_ACKSENT:
+            fsm->state = FSM_OPENED;
+            fsm->timer = 0;
+            fsm->retries = MAX_CONFIGURE;
+            fsm->cb->up(fsm->ppp);
+            break;
+        case FSM_OPENED:
+            fsm->cb->down(fsm->ppp);
+            fsm_send_confreq(fsm);
+            fsm->state = FSM_REQSENT;
+            break;
+    }
+}
+
+static void fsm_got_confnak(ppp_fsm_t *fsm, uint8_t id, const uint8_t *opts, int len, bool reject) {
+    if (id != fsm->id || fsm->state < FSM_REQSENT) {
+        return;
+    }
+    fsm->cb->got_nak(fsm->ppp, opts, len, reject);
+    if (fsm->ppp->done || fsm->state < FSM_REQSENT) {
+        /* got_nak gave up on the link. */
+        return;
+    }
+    if (fsm->state == FSM_OPENED) {
+        fsm->cb->down(fsm->ppp);
+    }
+    if (fsm->state != FSM_ACKSENT) {
+        fsm->state = FSM_REQSENT;
+    }
+    fsm->retries = MAX_CONFIGURE;
+    fsm_send_confreq(fsm);
+}
+
+static void fsm_got_termreq(ppp_fsm_t *fsm, uint8_t id) {
+    send_packet(fsm->ppp, fsm->cb->protocol, TERMACK, id, NULL, 0);
+    switch (fsm->state) {
+        case FSM_OPENED:
+            log_info(fsm->ppp->tag, "%s: The peer closed the link.", fsm->cb->name);
+            fsm->cb->down(fsm->ppp);
+            /* Give the Terminate-Ack a restart period to get out before we're finished. */
+            fsm->retries = 0;
+            fsm->timer = clock_usec() + RESTART_USEC;
+            fsm->state = FSM_STOPPING;
+            break;
+        case FSM_ACKRCVD:
+        case FSM_ACKSENT:
+            fsm->state = FSM_REQSENT;
+            break;
+    }
+}
+
+static void fsm_got_termack(ppp_fsm_t *fsm) {
+    switch (fsm->state) {
+        case FSM_CLOSING:
+        case FSM_STOPPING:
+            fsm->timer = 0;
+            fsm->state = fsm->state == FSM_CLOSING ? FSM_CLOSED : FSM_STOPPED;
+            fsm->cb->finished(fsm->ppp);
+            break;
+        case FSM_ACKRCVD:
+            fsm->state = FSM_REQSENT;
+            break;
+        case FSM_OPENED:
+            fsm->cb->down(fsm->ppp);
+            fsm->retries = MAX_CONFIGURE;
+            fsm_send_confreq(fsm);
+            fsm->state = FSM_REQSENT;
+            break;
+    }
+}
+
+static void fsm_input(ppp_fsm_t *fsm, const uint8_t *buf, int len) {
+    uint8_t code, id;
+    int pktLen;
+    if (len < 4) {
+        return;
+    }
+    code = buf[0];
+    id = buf[1];
+    pktLen = (buf[2] << 8) | buf[3];
+    /* Padding past the length is allowed, a short packet isn't. */
+    if (pktLen < 4 || pktLen > len) {
+        log_debug(fsm->ppp->tag, "%s: Bad packet length %d.", fsm->cb->name, pktLen);
+        return;
+    }
+    buf += 4;
+    len = pktLen - 4;
+    switch (code) {
+        case CONFREQ:
+            fsm_got_confreq(fsm, id, buf, len);
+            break;
+        case CONFACK:
+            fsm_got_confack(fsm, id);
+            break;
+        case CONFNAK:
+        case CONFREJ:
+            fsm_got_confnak(fsm, id, buf, len, code == CONFREJ);
+            break;
+        case TERMREQ:
+            fsm_got_termreq(fsm, id);
+            break;
+        case TERMACK:
+            fsm_got_termack(fsm);
+            break;
+        case CODEREJ:
+            /* Everything up to here is required, so the peer can't talk to us. */
+            if (len > 0 && buf[0] <= CODEREJ) {
+                log_warn(fsm->ppp->tag, "%s: The peer rejected code %d.", fsm->cb->name, buf[0]);
+                fsm->ppp->exitCode = PPP_EXIT_NEGOTIATION_FAILED;
+                fsm_lower_down(fsm);
+                fsm->state = FSM_STOPPED;
+                fsm->cb->finished(fsm->ppp);
+            }
+            break;
+        default:
+            if (fsm->cb->other == NULL || !fsm->cb->other(fsm->ppp, code, id, buf, len)) {
+                send_packet(fsm->ppp, fsm->cb->protocol, CODEREJ, ++fsm->id, buf - 4, pktLen);
+            }
+            break;
+    }
+}
+
+/* Append an option to a reply. */
+static void add_option(uint8_t *reply, int *replyLen, const uint8_t *opt, int len) {
+    memcpy(reply + *replyLen, opt, len);
+    *replyLen += len;
+}
+
+static void add_u32_option(uint8_t *reply, int *replyLen, uint8_t type, uint32_t val) {
+    uint8_t opt[6] = {type, 6};
+    put_u32(opt + 2, val);
+    add_option(reply, replyLen, opt, 6);
+}
+
+/* Walk a list of options. Returns false when it's done or the rest doesn't parse. */
+static bool next_option(const uint8_t **opts, int *len, const uint8_t **opt, int *optLen) {
+    if (*len < 2 || (*opts)[1] < 2 || (*opts)[1] > *len) {
+        return false;
+    }
+    *opt = *opts;
+    *optLen = (*opts)[1];
+    *opts += *optLen;
+    *len -= *optLen;
+    return true;
+}
+
+static void ipcp_lower_up(ppp_t *ppp);
+
+/* LCP */
+
+static void begin_auth(ppp_t *ppp);
+static void network_up(ppp_t *ppp);
+
+static int lcp_add_request(ppp_t *ppp, uint8_t *buf) {
+    uint8_t *p = buf;
+    if (ppp->mru != PPP_MRU && !(ppp->lcpRejected & (1 << LCP_MRU))) {
+        *p++ = LCP_MRU;
+        *p++ = 4;
+        *p++ = ppp->mru >> 8;
+        *p++ = ppp->mru;
+    }
+    if (!(ppp->lcpRejected & (1 << LCP_ACCM))) {
+        *p++ = LCP_ACCM;
+        *p++ = 6;
+        put_u32(p, ppp->accm);
+        p += 4;
+    }
+    if (ppp->auth == PPP_AUTH_PAP) {
+        *p++ = LCP_AUTH;
+        *p++ = 4;
+        *p++ = PPP_PAP >> 8;
+        *p++ = PPP_PAP & 0xff;
+    } else if (ppp->auth == PPP_AUTH_CHAP) {
+        *p++ = LCP_AUTH;
+        *p++ = 5;
+        *p++ = PPP_CHAP >> 8;
+        *p++ = PPP_CHAP & 0xff;
+        *p++ = CHAP_MD5;
+    }
+    if (!(ppp->lcpRejected & (1 << LCP_MAGIC))) {
+        *p++ = LCP_MAGIC;
+        *p++ = 6;
+        put_u32(p, ppp->magic);
+        p += 4;
+    }
+    if (!(ppp->lcpRejected & (1 << LCP_PFC))) {
+        *p++ = LCP_PFC;
+        *p++ = 2;
+    }
+    if (!(ppp->lcpRejected & (1 << LCP_ACFC))) {
+        *p++ = LCP_ACFC;
+        *p++ = 2;
+    }
+    if (ppp->bundleKey[0] && !(ppp->lcpRejected & (1 << LCP_MRRU))) {
+        *p++ = LCP_MRRU;
+        *p++ = 4;
+        *p++ = ppp->mrru >> 8;
+        *p++ = ppp->mrru;
+    }
+    if (ppp->bundleKey[0] && !(ppp->lcpRejected & (1 << LCP_EPDISC))) {
+        *p++ = LCP_EPDISC;
+        *p++ = 7;
+        *p++ = EPDISC_LOCAL;
+        put_u32(p, ppp_endpoint(ppp->bundleKey));
+        p += 4;
+    }
+    return p - buf;
+}
+
+static void lcp_got_nak(ppp_t *ppp, const uint8_t *opts, int len, bool reject) {
+    const uint8_t *opt;
+    int optLen;
+    while (next_option(&opts, &len, &opt, &optLen)) {
+        if (opt[0] == LCP_AUTH) {
+            /* Only take a step up from PAP, never down. */
+            if (!reject && optLen >= 5 && ((opt[2] << 8) | opt[3]) == PPP_CHAP && opt[4] == CHAP_MD5) {
+                ppp->auth = PPP_AUTH_CHAP;
+                continue;
+            }
+            log_warn(ppp->tag, "The peer won't authenticate.");
+            ppp->exitCode = PPP_EXIT_PEER_AUTH_FAILED;
+            fsm_close(&ppp->lcp);
+            return;
+        }
+        if (reject) {
+            if (opt[0] < 32) {
+                ppp->lcpRejected |= 1 << opt[0];
+            }
+        } else if (opt[0] == LCP_MRU && optLen == 4) {
+            int mru = (opt[2] << 8) | opt[3];
+            if (mru >= MIN_MRU && mru < ppp->mru) {
+                ppp->mru = mru;
+            }
+        } else if (opt[0] == LCP_ACCM && optLen == 6) {
+            ppp->accm |= get_u32(opt + 2);
+        } else if (opt[0] == LCP_MAGIC) {
+            get_random(&ppp->magic, sizeof(ppp->magic));
+        } else if (opt[0] == LCP_MRRU && optLen == 4) {
+            int mrru = (opt[2] << 8) | opt[3];
+            if (mrru >= MIN_MRU && mrru < ppp->mrru) {
+                ppp->mrru = mrru;
+            }
+        }
+    }
+}
+
+static int lcp_check_request(ppp_t *ppp, const uint8_t *opts, int len, uint8_t *reply, int *replyLen) {
+    uint8_t nak[FRAME_SIZE];
+    int nakLen = 0;
+    const uint8_t *opt;
+    int optLen;
+    int mru = PPP_MRU;
+    uint32_t accm = 0xffffffff;
+    bool pfc = false, acfc = false;
+    int mrru = 0;
+    bool shortSeq = false;
+    const uint8_t *endpoint = NULL;
+    int endpointLen = 0;
+    *replyLen = 0;
+    while (next_option(&opts, &len, &opt, &optLen)) {
+        switch (opt[0]) {
+            case LCP_MRU:
+                if (optLen != 4) {
+                    break;
+                }
+                mru = (opt[2] << 8) | opt[3];
+                if (mru < MIN_MRU) {
+                    uint8_t fix[4] = {LCP_MRU, 4, MIN_MRU >> 8, MIN_MRU & 0xff};
+                    add_option(nak, &nakLen, fix, 4);
+                }
+                continue;
+            case LCP_ACCM:
+                if (optLen != 6) {
+                    break;
+                }
+                accm = get_u32(opt + 2);
+                continue;
+            case LCP_MAGIC:
+                if (optLen != 6) {
+                    break;
+                }
+                /* Our own magic number coming back means the line is looped. */
+                if (get_u32(opt + 2) == ppp->magic && !(ppp->lcpRejected & (1 << LCP_MAGIC))) {
+                    uint32_t magic;
+                    get_random(&magic, sizeof(magic));
+                    add_u32_option(nak, &nakLen, LCP_MAGIC, magic);
+                }
+                continue;
+            case LCP_PFC:
+                if (optLen != 2) {
+                    break;
+                }
+                pfc = true;
+                continue;
+            case LCP_ACFC:
+                if (optLen != 2) {
+                    break;
+                }
+                acfc = true;
+                continue;
+            case LCP_MRRU:
+                /* Only if we're offering multilink. */
+                if (optLen != 4 || !ppp->bundleKey[0]) {
+                    break;
+                }
+                mrru = (opt[2] << 8) | opt[3];
+                if (mrru < MIN_MRU) {
+                    uint8_t fix[4] = {LCP_MRRU, 4, MIN_MRU >> 8, MIN_MRU & 0xff};
+                    add_option(nak, &nakLen, fix, 4);
+                }
+                continue;
+            case LCP_SSNHF:
+                if (optLen != 2 || !ppp->bundleKey[0]) {
+                    break;
+                }
+                shortSeq = true;
+                continue;
+            case LCP_EPDISC:
+                if (optLen < 3 || optLen - 2 > sizeof(ppp->peerEndpoint)) {
+                    break;
+                }
+                endpoint = opt + 2;
+                endpointLen = optLen - 2;
+                continue;
+        }
+        /* We don't authenticate ourselves to callers, and we don't know the rest. */
+        add_option(reply, replyLen, opt, optLen);
+    }
+    if (len != 0) {
+        /* The last option ran off the end. Reject the lot. */
+        add_option(reply, replyLen, opts, len);
+    }
+    if (*replyLen > 0) {
+        return CONFREJ;
+    }
+    if (nakLen > 0) {
+        memcpy(reply, nak, nakLen);
+        *replyLen = nakLen;
+        return CONFNAK;
+    }
+    ppp->peerMru = mru;
+    ppp->peerAccm = accm;
+    ppp->peerPfc = pfc;
+    ppp->peerAcfc = acfc;
+    ppp->peerMrru = mrru;
+    ppp->peerShortSeq = shortSeq;
+    ppp->peerEndpointLen = endpointLen;
+    if (endpointLen > 0) {
+        memcpy(ppp->peerEndpoint, endpoint, endpointLen);
+    }
+    return CONFACK;
+}
+
+static void lcp_up(ppp_t *ppp) {
+    int flags = 0;
+    int mru = ppp->mru;
+    uint32_t accm = ppp->lcpRejected & (1 << LCP_ACCM) ? 0xffffffff : ppp->accm;
+    log_info(ppp->tag, "LCP is up. MRU %d, peer MRU %d.", ppp->mru, ppp->peerMru);
+    /* Multilink needs an MRRU both ways (RFC 1990). */
+    ppp->multilink = ppp->bundleKey[0] && ppp->peerMrru > 0 && !(ppp->lcpRejected & (1 << LCP_MRRU));
+    if (ppp->multilink) {
+        log_info(ppp->tag, "Multilink. MRRU %d, peer MRRU %d.", ppp->mrru, ppp->peerMrru);
+    }
+    /* The kernel does the framing, so tell it what we agreed on. */
+    if (ppp->peerPfc) {
+        flags |= SC_COMP_PROT;
+    }
+    if (ppp->peerAcfc) {
+        flags |= SC_COMP_AC;
+    }
+    if (ppp->userFraming) {
+        ppp->tx.accm = ppp->peerAccm;
+        ppp->rx.accm = accm;
+    } else if (ppp->chanFd >= 0 && (ioctl(ppp->chanFd, PPPIOCSASYNCMAP, &ppp->peerAccm) < 0 ||
+            ioctl(ppp->chanFd, PPPIOCSRASYNCMAP, &accm) < 0 ||
+            ioctl(ppp->chanFd, PPPIOCSMRU, &mru) < 0 ||
+            ioctl(ppp->chanFd, PPPIOCSFLAGS, &flags) < 0)) {
+        log_debug(ppp->tag, "Couldn't set the link options: %s", strerror(errno));
+    }
+    ppp->echoPending = 0;
+    ppp->echoTimer = ppp->config->echoInterval > 0 ? clock_usec() + ppp->config->echoInterval*1000000ULL : 0;
+    begin_auth(ppp);
+}
+
+static void lcp_down(ppp_t *ppp) {
+    fsm_lower_down(&ppp->ipcp);
+    ppp->phase = PPP_PHASE_ESTABLISH;
+    ppp->authTimer = 0;
+    ppp->echoTimer = 0;
+}
+
+static void lcp_finished(ppp_t *ppp) {
+    ppp->phase = PPP_PHASE_TERMINATE;
+    ppp->done = true;
+}
+
+static bool lcp_other(ppp_t *ppp, uint8_t code, uint8_t id, const uint8_t *data, int len) {
+    uint8_t reply[FRAME_SIZE];
+    switch (code) {
+        case ECHOREQ:
+            if (ppp->lcp.state == FSM_OPENED && len >= 4 && len <= sizeof(reply)) {
+                memcpy(reply, data, len);
+                put_u32(reply, ppp->lcpRejected & (1 << LCP_MAGIC) ? 0 : ppp->magic);
+                send_packet(ppp, PPP_LCP, ECHOREP, id, reply, len);
+            }
+            return true;
+        case ECHOREP:
+            ppp->echoPending = 0;
+            return true;
+        case PROTREJ:
+            if (len >= 2 && ((data[0] << 8) | data[1]) == PPP_IPCP) {
+                log_warn(ppp->tag, "The peer doesn't do IP.");
+                ppp->exitCode = PPP_EXIT_NEGOTIATION_FAILED;
+                fsm_close(&ppp->lcp);
+            }
+            return true;
+        case DISCREQ:
+            return true;
+    }
+    return false;
+}
+
+static const fsm_callbacks_t lcpCallbacks = {
+    "LCP", PPP_LCP, lcp_add_request, lcp_got_nak, lcp_check_request, lcp_up, lcp_down, lcp_finished, lcp_other
+};
+
+/* PAP and CHAP. We're always the one asking. */
+
+static const char *find_secret(ppp_t *ppp, const char *user) {
+    for (int i = 0; i < ppp->config->numSecrets; i++) {
+        if (strcmp(ppp->config->secrets[i].user, user) == 0) {
+            return ppp->config->secrets[i].secret;
+        }
+    }
+    return NULL;
+}
+
+/* Doesn't give away how much matched by how long it took. */
+static bool same_bytes(const uint8_t *a, const uint8_t *b, size_t len) {
+    uint8_t diff = 0;
+    for (size_t i = 0; i < len; i++) {
+        diff |= a[i] ^ b[i];
+    }
+    return diff == 0;
+}
+
+static void auth_done(ppp_t *ppp, bool ok) {
+    ppp->authTimer = 0;
+    if (ok) {
+        log_info(ppp->tag, "%s logged in.", ppp->peerName);
+        network_up(ppp);
+    } else {
+        log_warn(ppp->tag, "Login failed for %s.", ppp->peerName[0] ? ppp->peerName : "the caller");
+        ppp->exitCode = PPP_EXIT_PEER_AUTH_FAILED;
+        fsm_close(&ppp->lcp);
+    }
+}
+
+static void send_challenge(ppp_t *ppp) {
+    uint8_t buf[1 + sizeof(ppp->challenge) + sizeof(CHAP_NAME) - 1];
+    buf[0] = sizeof(ppp->challenge);
+    memcpy(buf + 1, ppp->challenge, sizeof(ppp->challenge));
+    memcpy(buf + 1 + sizeof(ppp->challenge), CHAP_NAME, sizeof(CHAP_NAME) - 1);
+    send_packet(ppp, PPP_CHAP, 1, ppp->authId, buf, sizeof(buf));
+    ppp->authRetries--;
+    ppp->authTimer = clock_usec() + RESTART_USEC;
+}
+
+static void begin_auth(ppp_t *ppp) {
+    ppp->peerName[0] = 0;
+    if (ppp->auth == PPP_AUTH_NONE) {
+        network_up(ppp);
+        return;
+    }
+    ppp->phase = PPP_PHASE_AUTHENTICATE;
+    if (ppp->auth == PPP_AUTH_CHAP) {
+        get_random(ppp->challenge, sizeof(ppp->challenge));
+        ppp->authId++;
+        ppp->authRetries = MAX_CONFIGURE;
+        send_challenge(ppp);
+    } else {
+        /* The peer goes first with PAP. */
+        ppp->authTimer = clock_usec() + AUTH_WAIT_USEC;
+    }
+}
+
+static void auth_timeout(ppp_t *ppp) {
+    ppp->authTimer = 0;
+    if (ppp->auth == PPP_AUTH_CHAP && ppp->authRetries > 0) {
+        send_challenge(ppp);
+        return;
+    }
+    log_warn(ppp->tag, "The peer never authenticated.");
+    ppp->exitCode = PPP_EXIT_PEER_AUTH_FAILED;
+    fsm_close(&ppp->lcp);
+}
+
+static void pap_input(ppp_t *ppp, const uint8_t *buf, int len) {
+    static const char welcome[] = "\7Welcome";
+    static const char denied[] = "\6Denied";
+    int pktLen, userLen, passLen;
+    const char *secret;
+    char pass[256];
+    bool ok;
+    if (len < 6 || buf[0] != 1 || (pktLen = (buf[2] << 8) | buf[3]) > len || pktLen < 6) {
+        return;
+    }
+    userLen = buf[4];
+    if (5 + userLen >= pktLen || 6 + userLen + (passLen = buf[5 + userLen]) > pktLen) {
+        return;
+    }
+    if (ppp->phase == PPP_PHASE_AUTHENTICATE && ppp->auth == PPP_AUTH_PAP) {
+        snprintf(ppp->peerName, sizeof(ppp->peerName), "%.*s", userLen, (const char*)buf + 5);
+        memcpy(pass, buf + 6 + userLen, passLen);
+        pass[passLen] = 0;
+        secret = find_secret(ppp, ppp->peerName);
+        ok = secret != NULL && strlen(secret) == passLen && same_bytes((const uint8_t*)secret, (const uint8_t*)pass, passLen);
+        send_packet(ppp, PPP_PAP, ok ? 2 : 3, buf[1], (const uint8_t*)(ok ? welcome : denied), ok ? sizeof(welcome) - 1 : sizeof(denied) - 1);
+        auth_done(ppp, ok);
+    } else if (ppp->phase > PPP_PHASE_AUTHENTICATE && ppp->auth == PPP_AUTH_PAP) {
+        /* Our Ack got lost. */
+        send_packet(ppp, PPP_PAP, 2, buf[1], (const uint8_t*)welcome, sizeof(welcome) - 1);
+    }
+}
+
+static void chap_input(ppp_t *ppp, const uint8_t *buf, int len) {
+    int pktLen, valueLen;
+    const char *secret;
+    uint8_t digest[16];
+    md5_t md5;
+    bool ok;
+    if (len < 5 || buf[0] != 2 || (pktLen = (buf[2] << 8) | buf[3]) > len || pktLen < 5 || buf[1] != ppp->authId) {
+        return;
+    }
+    if (ppp->phase > PPP_PHASE_AUTHENTICATE) {
+        /* Our Success got lost. */
+        send_packet(ppp, PPP_CHAP, 3, ppp->authId, (const uint8_t*)"Welcome", 7);
+        return;
+    }
+    if (ppp->phase != PPP_PHASE_AUTHENTICATE || ppp->auth != PPP_AUTH_CHAP) {
+        return;
+    }
+    valueLen = buf[4];
+    if (5 + valueLen > pktLen) {
+        return;
+    }
+    snprintf(ppp->peerName, sizeof(ppp->peerName), "%.*s", pktLen - 5 - valueLen, (const char*)buf + 5 + valueLen);
+    ok = false;
+    if (valueLen == 16 && (secret = find_secret(ppp, ppp->peerName)) != NULL) {
+        md5_init(&md5);
+        md5_update(&md5, &ppp->authId, 1);
+        md5_update(&md5, secret, strlen(secret));
+        md5_update(&md5, ppp->challenge, sizeof(ppp->challenge));
+        md5_final(&md5, digest);
+        ok = same_bytes(digest, buf + 5, 16);
+    }
+    if (ok) {
+        send_packet(ppp, PPP_CHAP, 3, ppp->authId, (const uint8_t*)"Welcome", 7);
+    } else {
+        send_packet(ppp, PPP_CHAP, 4, ppp->authId, (const uint8_t*)"Denied", 6);
+    }
+    auth_done(ppp, ok);
+}
+
+/* IPCP */
+
+/* Bring the ppp interface up or down with the addresses we agreed on. */
+static bool set_netif(ppp_t *ppp, bool up) {
+    struct ifreq ifr;
+    struct sockaddr_in *addr = (struct sockaddr_in*)&ifr.ifr_addr;
+    int sock;
+    bool ok = true;
+    if (ppp->ifname[0] == 0) {
+        return true;
+    }
+    if ((sock = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0)) < 0) {
+        return false;
+    }
+    memset(&ifr, 0, sizeof(ifr));
+    strcpy(ifr.ifr_name, ppp->ifname);
+    if (up) {
+        int mtu = ppp->multilink ? ppp->peerMrru : ppp->peerMru;
+        ifr.ifr_mtu = mtu < PPP_MRU ? mtu : PPP_MRU;
+        ok &= ioctl(sock, SIOCSIFMTU, &ifr) == 0;
+        addr->sin_family = AF_INET;
+        addr->sin_addr = ppp->config->local;
+        ok &= ioctl(sock, SIOCSIFADDR, &ifr) == 0;
+        addr->sin_addr = ppp->remote;
+        ok &= ioctl(sock, SIOCSIFDSTADDR, &ifr) == 0;
+    }
+    if (ioctl(sock, SIOCGIFFLAGS, &ifr) == 0) {
+        ifr.ifr_flags = up ? ifr.ifr_flags | IFF_UP : ifr.ifr_flags & ~IFF_UP;
+        ok &= ioctl(sock, SIOCSIFFLAGS, &ifr) == 0;
+    } else {
+        ok = false;
+    }
+    close(sock);
+    return ok;
+}
+
+static void set_ip_mode(ppp_t *ppp, int mode) {
+    struct npioctl npi = {PPP_IP, mode};
+    if (ppp->unitFd >= 0 && ioctl(ppp->unitFd, PPPIOCSNPMODE, &npi) < 0) {
+        log_debug(ppp->tag, "Couldn't set the IP mode: %s", strerror(errno));
+    }
+}
+
+static void ipcp_lower_up(ppp_t *ppp) {
+    ppp->ipcpAskAddr = true;
+    fsm_open(&ppp->ipcp);
+}
+
+static int ipcp_add_request(ppp_t *ppp, uint8_t *buf) {
+    if (!ppp->ipcpAskAddr) {
+        return 0;
+    }
+    buf[0] = IPCP_ADDR;
+    buf[1] = 6;
+    memcpy(buf + 2, &ppp->config->local, 4);
+    return 6;
+}
+
+static void ipcp_got_nak(ppp_t *ppp, const uint8_t *opts, int len, bool reject) {
+    const uint8_t *opt;
+    int optLen;
+    while (next_option(&opts, &len, &opt, &optLen)) {
+        /* Our address is our address. If they won't take it, we stop sending it. */
+        if (opt[0] == IPCP_ADDR && reject) {
+            ppp->ipcpAskAddr = false;
+        }
+    }
+}
+
+static int ipcp_check_request(ppp_t *ppp, const uint8_t *opts, int len, uint8_t *reply, int *replyLen) {
+    uint8_t nak[FRAME_SIZE];
+    int nakLen = 0;
+    const uint8_t *opt;
+    int optLen;
+    *replyLen = 0;
+    while (next_option(&opts, &len, &opt, &optLen)) {
+        if (opt[0] == IPCP_ADDR && optLen == 6) {
+            if (memcmp(opt + 2, &ppp->remote, 4) != 0) {
+                add_u32_option(nak, &nakLen, IPCP_ADDR, ntohl(ppp->remote.s_addr));
+            }
+            continue;
+        }
+        if ((opt[0] == IPCP_DNS1 || opt[0] == IPCP_DNS2) && optLen == 6) {
+            int i = opt[0] == IPCP_DNS1 ? 0 : 1;
+            if (i < ppp->config->numDns) {
+                if (memcmp(opt + 2, &ppp->config->dns[i], 4) != 0) {
+                    add_u32_option(nak, &nakLen, opt[0], ntohl(ppp->config->dns[i].s_addr));
+                }
+                continue;
+            }
+        }
+        /* No VJ compression or anything else. */
+        add_option(reply, replyLen, opt, optLen);
+    }
+    if (len != 0) {
+        add_option(reply, replyLen, opts, len);
+    }
+    if (*replyLen > 0) {
+        return CONFREJ;
+    }
+    if (nakLen > 0) {
+        memcpy(reply, nak, nakLen);
+        *replyLen = nakLen;
+        return CONFNAK;
+    }
+    return CONFACK;
+}
+
+static void ipcp_up(ppp_t *ppp) {
+    char local[INET_ADDRSTRLEN], remote[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &ppp->config->local, local, sizeof(local));
+    inet_ntop(AF_INET, &ppp->remote, remote, sizeof(remote));
+    if (!set_netif(ppp, true)) {
+        log_error(ppp->tag, "Couldn't set up %s: %s", ppp->ifname, strerror(errno));
+        ppp->exitCode = PPP_EXIT_FATAL_ERROR;
+        fsm_close(&ppp->lcp);
+        return;
+    }
+    set_ip_mode(ppp, NPMODE_PASS);
+    ppp->phase = PPP_PHASE_RUNNING;
+    log_info(ppp->tag, "IP is up on %s: %s <-> %s", ppp->ifname, local, remote);
+    linkstats_watch(ppp->line, ppp->ifname);
+}
+
+static void ipcp_down(ppp_t *ppp) {
+    set_ip_mode(ppp, NPMODE_DROP);
+    set_netif(ppp, false);
+    if (ppp->phase == PPP_PHASE_RUNNING) {
+        ppp->phase = PPP_PHASE_NETWORK;
+    }
+    log_info(ppp->tag, "IP is down.");
+}
+
+static void ipcp_finished(ppp_t *ppp) {
+    /* Without IP there's no point to the link. */
+    if (ppp->lcp.state == FSM_OPENED) {
+        if (ppp->exitCode == PPP_EXIT_OK) {
+            ppp->exitCode = PPP_EXIT_NEGOTIATION_FAILED;
+        }
+        fsm_close(&ppp->lcp);
+    }
+}
+
+static const fsm_callbacks_t ipcpCallbacks = {
+    "IPCP", PPP_IPCP, ipcp_add_request, ipcp_got_nak, ipcp_check_request, ipcp_up, ipcp_down, ipcp_finished, NULL
+};
+
+/* Multilink */
+
+/* Bundles are told apart by who logged in and the endpoint they gave us as well as the key (RFC 1990 5.1.3). */
+static bool join_bundle(ppp_t *ppp) {
+    char key[160];
+    int len = snprintf(key, sizeof(key), "%s/%s/", ppp->bundleKey, ppp->peerName);
+    for (int i = 0; i < ppp->peerEndpointLen && len < sizeof(key) - 2; i++) {
+        len += snprintf(key + len, sizeof(key) - len, "%02x", ppp->peerEndpoint[i]);
+    }
+    ppp->bundle = mp_join(key, ppp->tag, ppp->userFraming ? ppp->tunFd : ppp->unitFd, ppp->unit, ppp->ifname, &ppp->bundleSlot);
+    if (ppp->bundle == NULL) {
+        log_warn(ppp->tag, "Bundle %s is full.", key);
+        return false;
+    }
+    if (ppp->bundleSlot == 0) {
+        /* It's our unit. Tell the kernel to do MP on it. */
+        int flags;
+        if (!ppp->userFraming && (ioctl(ppp->unitFd, PPPIOCGFLAGS, &flags) < 0 ||
+                ioctl(ppp->unitFd, PPPIOCSMRRU, &ppp->mrru) < 0 ||
+                (flags |= SC_MULTILINK | (ppp->peerShortSeq ? SC_MP_XSHORTSEQ : 0), ioctl(ppp->unitFd, PPPIOCSFLAGS, &flags) < 0))) {
+            log_warn(ppp->tag, "Couldn't turn on multilink for %s: %s", ppp->ifname, strerror(errno));
+        }
+        log_info(ppp->tag, "Started bundle %s on %s.", key, ppp->ifname);
+        return true;
+    }
+    /* Give up our own unit or TUN for the bundle's. */
+    if (ppp->userFraming) {
+        close(ppp->tunFd);
+        ppp->tunFd = mp_fd(ppp->bundle);
+    } else {
+        int unit = mp_unit(ppp->bundle);
+        ioctl(ppp->chanFd, PPPIOCDISCONN);
+        close(ppp->unitFd);
+        ppp->unitFd = -1;
+        ppp->unit = -1;
+        if (ioctl(ppp->chanFd, PPPIOCCONNECT, &unit) < 0) {
+            log_error(ppp->tag, "Couldn't join %s: %s", mp_ifname(ppp->bundle), strerror(errno));
+            return false;
+        }
+    }
+    snprintf(ppp->ifname, sizeof(ppp->ifname), "%s", mp_ifname(ppp->bundle));
+    log_info(ppp->tag, "Joined bundle %s on %s. %d lines.", key, ppp->ifname, mp_links(ppp->bundle));
+    return true;
+}
+
+/* Logged in. The first line of a bundle (or a line on its own) does IPCP, the rest just carry fragments. */
+static void network_up(ppp_t *ppp) {
+    ppp->phase = PPP_PHASE_NETWORK;
+    if (ppp->multilink && ppp->bundle == NULL && !join_bundle(ppp)) {
+        ppp->exitCode = PPP_EXIT_FATAL_ERROR;
+        fsm_close(&ppp->lcp);
+        return;
+    }
+    if (ppp->bundle != NULL && ppp->bundleSlot != 0) {
+        ppp->phase = PPP_PHASE_RUNNING;
+        return;
+    }
+    ipcp_lower_up(ppp);
+}
+
+static void ppp_input(ppp_t *ppp, const uint8_t *buf, int len);
+
+/* A whole packet out of the bundle. */
+static void mp_deliver(void *ctx, const uint8_t *packet, size_t len) {
+    ppp_t *ppp = ctx;
+    uint8_t buf[FRAME_SIZE + 2];
+    uint16_t protocol;
+    /* The protocol inside can be compressed even if it isn't on the link. */
+    if (len >= 1 && (packet[0] & 1)) {
+        protocol = packet[0];
+        packet++;
+        len--;
+    } else if (len >= 2) {
+        protocol = (packet[0] << 8) | packet[1];
+        packet += 2;
+        len -= 2;
+    } else {
+        return;
+    }
+    if (protocol == PPP_IP) {
+        if (ppp->phase == PPP_PHASE_RUNNING && write(ppp->tunFd, packet, len) < 0) {
+            log_debug(ppp->tag, "Couldn't pass a packet to %s: %s", ppp->ifname, strerror(errno));
+        }
+        return;
+    }
+    if (len > FRAME_SIZE) {
+        return;
+    }
+    buf[0] = protocol >> 8;
+    buf[1] = protocol;
+    memcpy(buf + 2, packet, len);
+    if (ppp->bundleSlot == 0) {
+        ppp_input(ppp, buf, len + 2);
+    } else {
+        mp_push_control(ppp->bundle, buf, len + 2);
+    }
+}
+
+/* Everything that came in on either fd. */
+static void ppp_input(ppp_t *ppp, const uint8_t *buf, int len) {
+    uint16_t protocol;
+    if (len < 2) {
+        return;
+    }
+    protocol = (buf[0] << 8) | buf[1];
+    buf += 2;
+    len -= 2;
+    if (protocol == PPP_LCP) {
+        fsm_input(&ppp->lcp, buf, len);
+        return;
+    }
+    /* Nothing else until LCP is up. */
+    if (ppp->lcp.state != FSM_OPENED) {
+        return;
+    }
+    switch (protocol) {
+        case PPP_PAP:
+            pap_input(ppp, buf, len);
+            break;
+        case PPP_CHAP:
+            chap_input(ppp, buf, len);
+            break;
+        case PPP_IPCP:
+            if (ppp->phase >= PPP_PHASE_NETWORK) {
+                fsm_input(&ppp->ipcp, buf, len);
+            }
+            break;
+        case PPP_IP:
+            /* Came in before IP was passed through to the interface. */
+            break;
+        default: {
+            uint8_t reject[FRAME_SIZE];
+            int rejectLen = len + 2;
+            if (rejectLen > ppp->peerMru - 4) {
+                rejectLen = ppp->peerMru - 4;
+            }
+            if (rejectLen > sizeof(reject)) {
+                rejectLen = sizeof(reject);
+            }
+            log_debug(ppp->tag, "Rejecting protocol %04x.", protocol);
+            memcpy(reject, buf - 2, rejectLen);
+            send_packet(ppp, PPP_LCP, PROTREJ, ++ppp->lcp.id, reject, rejectLen);
+            break;
+        }
+    }
+}
+
+static void send_echo(ppp_t *ppp) {
+    uint8_t magic[4];
+    if (ppp->echoPending >= ppp->config->echoFailures) {
+        log_warn(ppp->tag, "No answer to %d echo requests. The peer is gone.", ppp->echoPending);
+        ppp->exitCode = PPP_EXIT_PEER_DEAD;
+        fsm_close(&ppp->lcp);
+        return;
+    }
+    put_u32(magic, ppp->lcpRejected & (1 << LCP_MAGIC) ? 0 : ppp->magic);
+    send_packet(ppp, PPP_LCP, ECHOREQ, ++ppp->lcp.id, magic, 4);
+    ppp->echoPending++;
+    ppp->echoTimer = clock_usec() + ppp->config->echoInterval*1000000ULL;
+}
+
+static void ppp_hangup(ppp_t *ppp) {
+    log_info(ppp->tag, "The line hung up.");
+    fsm_lower_down(&ppp->ipcp);
+    fsm_lower_down(&ppp->lcp);
+    if (ppp->exitCode == PPP_EXIT_OK) {
+        ppp->exitCode = PPP_EXIT_HANGUP;
+    }
+    ppp->done = true;
+}
+
+/* Watch DCD the way pppd's modem option does, once we've seen it come up. */
+static void check_carrier(ppp_t *ppp) {
+    int bits;
+    ppp->carrierTimer = clock_usec() + (ppp->statusFd >= 0 ? LINEWATCH_CHECK_USEC : 1000000);
+    if (ppp->ttyFd < 0 || rfc2217_ioctl(ppp->ttyFd, TIOCMGET, &bits) < 0) {
+        return;
+    }
+    if (bits & TIOCM_CD) {
+        ppp->carrierSeen = true;
+    } else if (ppp->carrierSeen) {
+        ppp_hangup(ppp);
+    }
+}
+
+static void run_timers(ppp_t *ppp) {
+    uint64_t now = clock_usec();
+    if (ppp->lcp.timer != 0 && now >= ppp->lcp.timer) {
+        fsm_timeout(&ppp->lcp);
+    }
+    if (ppp->ipcp.timer != 0 && now >= ppp->ipcp.timer) {
+        fsm_timeout(&ppp->ipcp);
+    }
+    if (ppp->authTimer != 0 && now >= ppp->authTimer) {
+        auth_timeout(ppp);
+    }
+    if (ppp->echoTimer != 0 && now >= ppp->echoTimer && ppp->lcp.state == FSM_OPENED) {
+        send_echo(ppp);
+    }
+    if (now >= ppp->carrierTimer && !ppp->done) {
+        check_carrier(ppp);
+    }
+}
+
+static uint64_t next_timer(ppp_t *ppp) {
+    uint64_t timers[] = {ppp->lcp.timer, ppp->ipcp.timer, ppp->authTimer, ppp->echoTimer};
+    uint64_t next = ppp->carrierTimer;
+    for (int i = 0; i < sizeof(timers)/sizeof(timers[0]); i++) {
+        if (timers[i] != 0 && timers[i] < next) {
+            next = timers[i];
+        }
+    }
+    return next;
+}
+
+int ppp_load_config(const char *path, ppp_config_t *config) {
+    FILE *file;
+    char line[256];
+    int lineNum = 0;
+    memset(config, 0, sizeof(*config));
+    config->mru = PPP_MRU;
+    config->echoInterval = 30;
+    config->echoFailures = 4;
+    if ((file = fopen(path, "r")) == NULL) {
+        return -1;
+    }
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char key[16], val[64], val2[64];
+        int n;
+        bool ok = true;
+        lineNum++;
+        if (strchr(line, '#') != NULL) {
+            *strchr(line, '#') = 0;
+        }
+        if ((n = sscanf(line, "%15s %63s %63s", key, val, val2)) <= 0) {
+            continue;
+        }
+        if (strcmp(key, "local") == 0 && n == 2) {
+            ok = inet_pton(AF_INET, val, &config->local) == 1;
+        } else if (strcmp(key, "remote") == 0 && n == 2) {
+            ok = inet_pton(AF_INET, val, &config->remote) == 1;
+        } else if (strcmp(key, "dns") == 0 && n == 2 && config->numDns < 2) {
+            ok = inet_pton(AF_INET, val, &config->dns[config->numDns++]) == 1;
+        } else if (strcmp(key, "mru") == 0 && n == 2) {
+            ok = sscanf(val, "%d", &config->mru) == 1 && config->mru >= MIN_MRU && config->mru <= PPP_MRU;
+        } else if (strcmp(key, "auth") == 0 && n == 2) {
+            if (strcmp(val, "none") == 0) {
+                config->auth = PPP_AUTH_NONE;
+            } else if (strcmp(val, "pap") == 0) {
+                config->auth = PPP_AUTH_PAP;
+            } else if (strcmp(val, "chap") == 0) {
+                config->auth = PPP_AUTH_CHAP;
+            } else {
+                ok = false;
+            }
+        } else if (strcmp(key, "framing") == 0 && n == 2) {
+            if (strcmp(val, "auto") == 0) {
+                config->framing = PPP_FRAMING_AUTO;
+            } else if (strcmp(val, "kernel") == 0) {
+                config->framing = PPP_FRAMING_KERNEL;
+            } else if (strcmp(val, "user") == 0) {
+                config->framing = PPP_FRAMING_USER;
+            } else {
+                ok = false;
+            }
+        } else if (strcmp(key, "echo") == 0 && n == 3) {
+            ok = sscanf(val, "%d", &config->echoInterval) == 1 && sscanf(val2, "%d", &config->echoFailures) == 1;
+        } else if (strcmp(key, "user") == 0 && n == 3) {
+            ppp_secret_t *secrets = realloc(config->secrets, (config->numSecrets + 1)*sizeof(ppp_secret_t));
+            if (secrets == NULL) {
+                ok = false;
+            } else {
+                config->secrets = secrets;
+                strcpy(secrets[config->numSecrets].user, val);
+                strcpy(secrets[config->numSecrets].secret, val2);
+                config->numSecrets++;
+            }
+        } else {
+            ok = false;
+        }
+        if (!ok) {
+            log_error(NULL, "%s line %d doesn't make sense: %s", path, lineNum, line);
+            fclose(file);
+            ppp_free_config(config);
+            return -2;
+        }
+    }
+    fclose(file);
+    if (config->local.s_addr == 0 || config->remote.s_addr == 0) {
+        log_error(NULL, "%s needs a local and a remote address.", path);
+        ppp_free_config(config);
+        return -2;
+    }
+    return 0;
+}
+
+void ppp_free_config(ppp_config_t *config) {
+    free(config->secrets);
+    config->secrets = NULL;
+    config->numSecrets = 0;
+}
+
+void ppp_init(ppp_t *ppp, const ppp_config_t *config, const char *tag, int index) {
+    memset(ppp, 0, sizeof(*ppp));
+    ppp->config = config;
+    ppp->tag = tag;
+    ppp->line = index;
+    ppp->ttyFd = -1;
+    ppp->chanFd = -1;
+    ppp->unitFd = -1;
+    ppp->unit = -1;
+    ppp->tunFd = -1;
+    ppp->oldDisc = -1;
+    ppp->statusFd = -1;
+    ppp->remote.s_addr = htonl(ntohl(config->remote.s_addr) + index);
+    ppp->bundleSlot = -1;
+    ppp->lcp.ppp = ppp;
+    ppp->lcp.cb = &lcpCallbacks;
+    ppp->ipcp.ppp = ppp;
+    ppp->ipcp.cb = &ipcpCallbacks;
+}
+
+void ppp_multilink(ppp_t *ppp, const char *key) {
+    snprintf(ppp->bundleKey, sizeof(ppp->bundleKey), "%s", key);
+}
+
+/* FNV-1a. It only has to be the same every time for the same key. */
+uint32_t ppp_endpoint(const char *key) {
+    uint32_t hash = 2166136261u;
+    for (; *key; key++) {
+        hash = (hash ^ (uint8_t)*key)*16777619u;
+    }
+    return hash;
+}
+
+/* Let the kernel do the framing. */
+static int attach_kernel(ppp_t *ppp) {
+    int disc = N_PPP;
+    int chan;
+    if (ioctl(ppp->ttyFd, TIOCGETD, &ppp->oldDisc) < 0 || ioctl(ppp->ttyFd, TIOCSETD, &disc) < 0) {
+        ppp->oldDisc = -1;
+        return -1;
+    }
+    if (ioctl(ppp->ttyFd, PPPIOCGCHAN, &chan) < 0) {
+        return -2;
+    }
+    if ((ppp->chanFd = open("/dev/ppp", O_RDWR | O_CLOEXEC)) < 0 || ioctl(ppp->chanFd, PPPIOCATTCHAN, &chan) < 0) {
+        return -3;
+    }
+    if ((ppp->unitFd = open("/dev/ppp", O_RDWR | O_CLOEXEC)) < 0 || ioctl(ppp->unitFd, PPPIOCNEWUNIT, &ppp->unit) < 0) {
+        ppp->unit = -1;
+        return -4;
+    }
+    if (ioctl(ppp->chanFd, PPPIOCCONNECT, &ppp->unit) < 0) {
+        return -5;
+    }
+    fcntl(ppp->chanFd, F_SETFL, O_NONBLOCK);
+    fcntl(ppp->unitFd, F_SETFL, O_NONBLOCK);
+    snprintf(ppp->ifname, sizeof(ppp->ifname), "ppp%d", ppp->unit);
+    log_debug(ppp->tag, "Attached to %s on channel %d.", ppp->ifname, chan);
+    return 0;
+}
+
+/* Frame it ourselves and hand IP to a TUN device. */
+static int attach_user(ppp_t *ppp) {
+    struct ifreq ifr;
+    if ((ppp->tunFd = open("/dev/net/tun", O_RDWR | O_CLOEXEC | O_NONBLOCK)) < 0) {
+        return -6;
+    }
+    memset(&ifr, 0, sizeof(ifr));
+    ifr.ifr_flags = IFF_TUN | IFF_NO_PI;
+    strcpy(ifr.ifr_name, "dialin%d");
+    if (ioctl(ppp->tunFd, TUNSETIFF, &ifr) < 0) {
+        return -7;
+    }
+    ppp->rxBuf = malloc(FRAME_SIZE + 8);
+    ppp->txBuf = malloc(TX_SIZE);
+    if (ppp->rxBuf == NULL || ppp->txBuf == NULL) {
+        return -8;
+    }
+    /* Nothing is agreed on yet, so everything gets escaped. */
+    ppp->tx.accm = 0xffffffff;
+    hdlc_rx_init(&ppp->rx, ppp->rxBuf, FRAME_SIZE + 8);
+    ppp->rx.accm = 0xffffffff;
+    ppp->txLen = 0;
+    ppp->txOff = 0;
+    ppp->ttyFlags = fcntl(ppp->ttyFd, F_GETFL);
+    fcntl(ppp->ttyFd, F_SETFL, ppp->ttyFlags | O_NONBLOCK);
+    ppp->userFraming = true;
+    memcpy(ppp->ifname, ifr.ifr_name, sizeof(ppp->ifname));
+    ppp->ifname[sizeof(ppp->ifname) - 1] = 0;
+    log_debug(ppp->tag, "Framing PPP ourselves through %s.", ppp->ifname);
+    return 0;
+}
+
+int ppp_attach(ppp_t *ppp, int ttyFd) {
+    int res;
+    ppp->ttyFd = ttyFd;
+    if (ppp->config->framing != PPP_FRAMING_USER) {
+        if ((res = attach_kernel(ppp)) == 0 || ppp->config->framing == PPP_FRAMING_KERNEL) {
+            return res;
+        }
+        log_debug(ppp->tag, "The kernel can't do PPP here (%d: %s). Doing the framing ourselves.", res, strerror(errno));
+        ppp_detach(ppp);
+        ppp->ttyFd = ttyFd;
+    }
+    return attach_user(ppp);
+}
+
+/* A good frame off the line. Unwrap it the way the kernel would. */
+static void user_frame(void *ctx, uint8_t *frame, size_t len) {
+    ppp_t *ppp = ctx;
+    uint8_t buf[FRAME_SIZE + 2];
+    uint16_t protocol;
+    if (len >= 2 && frame[0] == 0xff && frame[1] == 0x03) {
+        frame += 2;
+        len -= 2;
+    }
+    if (len >= 1 && (frame[0] & 1)) {
+        protocol = frame[0];
+        frame++;
+        len--;
+    } else if (len >= 2) {
+        protocol = (frame[0] << 8) | frame[1];
+        frame += 2;
+        len -= 2;
+    } else {
+        return;
+    }
+    if (protocol == PPP_IP) {
+        if (ppp->phase == PPP_PHASE_RUNNING && write(ppp->tunFd, frame, len) < 0) {
+            log_debug(ppp->tag, "Couldn't pass a packet to %s: %s", ppp->ifname, strerror(errno));
+        }
+        return;
+    }
+    if (protocol == PPP_MP) {
+        if (ppp->bundle != NULL) {
+            mp_receive(ppp->bundle, ppp->bundleSlot, frame, len, mp_deliver, ppp);
+        }
+        return;
+    }
+    if (len > FRAME_SIZE) {
+        return;
+    }
+    buf[0] = protocol >> 8;
+    buf[1] = protocol;
+    memcpy(buf + 2, frame, len);
+    ppp_input(ppp, buf, len + 2);
+}
+
+static void user_io(ppp_t *ppp, struct pollfd *fds) {
+    if (fds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+        uint8_t buf[TTY_READ_SIZE];
+        ssize_t bytes = read(ppp->ttyFd, buf, sizeof(buf));
+        if (bytes > 0) {
+            hdlc_decode(&ppp->rx, buf, bytes, user_frame, ppp);
+        } else if (bytes == 0 || errno == EIO) {
+            ppp_hangup(ppp);
+            return;
+        }
+    }
+    if (fds[1].revents & POLLIN) {
+        /* Take as many packets as fit and send them in one write. */
+        uint8_t packet[FRAME_SIZE];
+        for (int i = 0; i < TUN_BATCH && tx_room(ppp, ppp->peerMru); i++) {
+            ssize_t bytes = read(ppp->tunFd, packet, sizeof(packet));
+            if (bytes <= 0) {
+                break;
+            }
+            /* The kernel sends IPv6 stuff too, but we only do IPCP. */
+            if ((packet[0] >> 4) == 4) {
+                queue_frame(ppp, PPP_IP, packet, bytes);
+            }
+        }
+    }
+    if (ppp->txLen > 0) {
+        flush_tx(ppp);
+    }
+}
+
+static void kernel_io(ppp_t *ppp, struct pollfd *fds) {
+    for (int i = 0; i < 2 && !ppp->done; i++) {
+        uint8_t buf[FRAME_SIZE + 2];
+        ssize_t bytes;
+        if (fds[i].fd < 0 || !(fds[i].revents & (POLLIN | POLLHUP | POLLERR))) {
+            continue;
+        }
+        bytes = read(fds[i].fd, buf, sizeof(buf));
+        if (bytes > 0) {
+            ppp_input(ppp, buf, bytes);
+        } else if (bytes == 0) {
+            /* The kernel drops the channel when the TTY hangs up. */
+            ppp_hangup(ppp);
+        } else if (errno != EAGAIN && errno != EINTR) {
+            log_debug(ppp->tag, "Read failed: %s", strerror(errno));
+        }
+    }
+}
+
+int ppp_run(ppp_t *ppp) {
+    ppp->mru = ppp->config->mru;
+    ppp->accm = 0;
+    ppp->peerMru = PPP_MRU;
+    ppp->peerAccm = 0xffffffff;
+    ppp->auth = ppp->config->auth;
+    ppp->mrru = PPP_MRU;
+    ppp->multilink = false;
+    ppp->exitCode = PPP_EXIT_OK;
+    ppp->done = false;
+    ppp->phase = PPP_PHASE_ESTABLISH;
+    get_random(&ppp->magic, sizeof(ppp->magic));
+    ppp->carrierTimer = clock_usec();
+    fsm_open(&ppp->lcp);
+    while (!ppp->done) {
+        struct pollfd fds[3] = {{ppp->chanFd, POLLIN, 0}, {ppp->unitFd, POLLIN, 0}, {ppp->statusFd, POLLIN, 0}};
+        uint64_t now = clock_usec();
+        uint64_t next = next_timer(ppp);
+        int closeRequest = __atomic_exchange_n(&ppp->closeRequest, 0, __ATOMIC_ACQ_REL);
+        if (closeRequest != 0) {
+            ppp->exitCode = closeRequest - 1;
+            fsm_close(&ppp->lcp);
+            if (ppp->done) {
+                break;
+            }
+        }
+        if (ppp->bundle != NULL && ppp->bundleSlot != 0 && ppp->lcp.state == FSM_OPENED && mp_master_gone(ppp->bundle)) {
+            log_info(ppp->tag, "The bundle's first line is gone, so this one goes too.");
+            fsm_close(&ppp->lcp);
+        }
+        if (ppp->userFraming) {
+            /* Only take IP from the TUN when the line can keep up. */
+            fds[0].fd = ppp->ttyFd;
+            fds[0].events = POLLIN | (ppp->txLen > 0 ? POLLOUT : 0);
+            fds[1].fd = ppp->tunFd;
+            fds[1].events = ppp->phase == PPP_PHASE_RUNNING && tx_room(ppp, ppp->peerMru) ? POLLIN : 0;
+        }
+        /* poll() skips the ones that are -1. */
+        if (clock_poll(fds, 3, next > now + CHECK_USEC ? CHECK_USEC : next > now ? next - now : 0) < 0 && errno != EINTR) {
+            log_error(ppp->tag, "poll failed: %s", strerror(errno));
+            ppp->exitCode = PPP_EXIT_FATAL_ERROR;
+            break;
+        }
+        if (fds[2].revents & POLLIN) {
+            eventfd_t count;
+            eventfd_read(ppp->statusFd, &count);
+            ppp->carrierTimer = 0;
+        }
+        if (ppp->userFraming) {
+            user_io(ppp, fds);
+        } else {
+            kernel_io(ppp, fds);
+        }
+        if (ppp->bundle != NULL && ppp->bundleSlot == 0) {
+            /* IPCP and such that came in on the other lines. */
+            uint8_t buf[FRAME_SIZE + 2];
+            size_t len;
+            while (!ppp->done && (len = mp_pop_control(ppp->bundle, buf, sizeof(buf))) > 0) {
+                ppp_input(ppp, buf, len);
+            }
+        }
+        if (!ppp->done) {
+            run_timers(ppp);
+        }
+    }
+    return ppp->exitCode;
+}
+
+void ppp_close(ppp_t *ppp, int exitCode) {
+    __atomic_store_n(&ppp->closeRequest, exitCode + 1, __ATOMIC_RELEASE);
+}
+
+void ppp_detach(ppp_t *ppp) {
+    if (ppp->bundle != NULL) {
+        /* The bundle has the unit or TUN, and closes it when the last line leaves. */
+        if (ppp->userFraming) {
+            ppp->tunFd = -1;
+        } else if (ppp->bundleSlot == 0) {
+            ppp->unitFd = -1;
+        }
+        mp_leave(ppp->bundle, ppp->bundleSlot);
+        ppp->bundle = NULL;
+        ppp->bundleSlot = -1;
+    }
+    if (ppp->unitFd >= 0) {
+        /* Closing the last fd on the unit takes the interface with it. */
+        close(ppp->unitFd);
+        ppp->unitFd = -1;
+    }
+    if (ppp->chanFd >= 0) {
+        ioctl(ppp->chanFd, PPPIOCDISCONN);
+        close(ppp->chanFd);
+        ppp->chanFd = -1;
+    }
+    if (ppp->oldDisc >= 0) {
+        ioctl(ppp->ttyFd, TIOCSETD, &ppp->oldDisc);
+        ppp->oldDisc = -1;
+    }
+    if (ppp->tunFd >= 0) {
+        close(ppp->tunFd);
+        ppp->tunFd = -1;
+    }
+    if (ppp->userFraming) {
+        fcntl(ppp->ttyFd, F_SETFL, ppp->ttyFlags);
+        ppp->userFraming = false;
+    }
+    free(ppp->rxBuf);
+    free(ppp->txBuf);
+    ppp->rxBuf = NULL;
+    ppp->txBuf = NULL;
+    ppp->unit = -1;
+    ppp->ifname[0] = 0;
+}
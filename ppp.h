@@ -0,0 +1,189 @@
+#ifndef PPP_H
+#define PPP_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include "hdlc.h"
+#include "mp.h"
+
+/*
+ * PPP without pppd. The modem's TTY gets the kernel's N_PPP line discipline,
+ * so the kernel does the HDLC framing and moves the IP packets, and all we do
+ * is LCP, PAP/CHAP and IPCP on the modem's own thread. Starting a call is a
+ * few ioctls instead of a fork and exec.
+ *
+ * Where there's no N_PPP or /dev/ppp (containers, mostly) we do the HDLC
+ * framing ourselves and pass the IP packets through a TUN device instead.
+ *
+ * A caller with more than one line can bond them with multilink (see mp.h)
+ * if whoever starts the session allows it with ppp_multilink().
+ */
+
+/* pppd's exit codes, so call records read the same either way. */
+#define PPP_EXIT_OK 0
+#define PPP_EXIT_FATAL_ERROR 1
+#define PPP_EXIT_NO_KERNEL_SUPPORT 4
+#define PPP_EXIT_USER_REQUEST 5
+#define PPP_EXIT_NEGOTIATION_FAILED 10
+#define PPP_EXIT_PEER_AUTH_FAILED 11
+#define PPP_EXIT_IDLE_TIMEOUT 12
+#define PPP_EXIT_PEER_DEAD 15
+#define PPP_EXIT_HANGUP 16
+#define PPP_EXIT_LOOPBACK 17
+
+typedef enum {
+    PPP_AUTH_NONE = 0,
+    PPP_AUTH_PAP,
+    PPP_AUTH_CHAP
+} ppp_auth_t;
+
+typedef enum {
+    PPP_FRAMING_AUTO = 0,
+    PPP_FRAMING_KERNEL,
+    PPP_FRAMING_USER
+} ppp_framing_t;
+
+typedef struct {
+    char user[64];
+    char secret[64];
+} ppp_secret_t;
+
+/*
+ * Loaded from a file of "key value" lines:
+ *   local 10.0.0.1       Our end of every link.
+ *   remote 10.0.0.100    The first line's caller. Line n gets remote + n.
+ *   dns 10.0.0.1         Up to two, handed out to callers that ask.
+ *   mru 1500
+ *   auth none|pap|chap
+ *   echo 30 4            LCP echo every 30s, give up after 4 missed. 0 turns it off.
+ *   user alice secret    Who can log in with PAP or CHAP.
+ *   framing auto         kernel (N_PPP), user (TUN) or auto, which tries the kernel first.
+ * # starts a comment.
+ */
+typedef struct {
+    struct in_addr local;
+    struct in_addr remote;
+    struct in_addr dns[2];
+    int numDns;
+    int mru;
+    ppp_auth_t auth;
+    ppp_framing_t framing;
+    int echoInterval;
+    int echoFailures;
+    ppp_secret_t *secrets;
+    int numSecrets;
+} ppp_config_t;
+
+typedef struct ppp_s ppp_t;
+
+typedef struct {
+    ppp_t *ppp;
+    const struct fsm_callbacks_s *cb;
+    int state;
+    /* ID of our last Configure-Request or Terminate-Request. */
+    uint8_t id;
+    int retries;
+    int naks;
+    /* When the restart timer goes off, 0 if it isn't running. */
+    uint64_t timer;
+} ppp_fsm_t;
+
+typedef enum {
+    PPP_PHASE_ESTABLISH = 0,
+    PPP_PHASE_AUTHENTICATE,
+    PPP_PHASE_NETWORK,
+    PPP_PHASE_RUNNING,
+    PPP_PHASE_TERMINATE
+} ppp_phase_t;
+
+struct ppp_s {
+    const ppp_config_t *config;
+    const char *tag;
+    /* Our line, for linkstats. */
+    int line;
+    int ttyFd;
+    int oldDisc;
+    /* /dev/ppp opened on the channel (LCP and auth) and on the unit (IPCP). */
+    int chanFd;
+    int unitFd;
+    int unit;
+    char ifname[IFNAMSIZ];
+    /* Framing it ourselves. */
+    bool userFraming;
+    int tunFd;
+    int ttyFlags;
+    hdlc_tx_t tx;
+    hdlc_rx_t rx;
+    uint8_t *rxBuf;
+    /* Frames waiting for the TTY to take them. */
+    uint8_t *txBuf;
+    size_t txLen;
+    size_t txOff;
+    ppp_phase_t phase;
+    ppp_fsm_t lcp;
+    ppp_fsm_t ipcp;
+    bool done;
+    int exitCode;
+    /* Set by ppp_close() to the exit code to close with, plus one. */
+    int closeRequest;
+    /* LCP options we asked for that the peer rejected. */
+    uint32_t lcpRejected;
+    int mru;
+    uint32_t accm;
+    uint32_t magic;
+    ppp_auth_t auth;
+    /* What the peer asked for. */
+    int peerMru;
+    uint32_t peerAccm;
+    bool peerPfc;
+    bool peerAcfc;
+    /* Authentication. */
+    uint8_t authId;
+    uint8_t challenge[16];
+    int authRetries;
+    uint64_t authTimer;
+    char peerName[64];
+    /* Echo requests sent that haven't been answered. */
+    int echoPending;
+    uint64_t echoTimer;
+    /* Carrier was up at some point, so losing it means a hangup. */
+    bool carrierSeen;
+    uint64_t carrierTimer;
+    /* The line watcher's eventFd, or -1. Readable means look at DCD now. */
+    int statusFd;
+    /* IPCP. */
+    bool ipcpAskAddr;
+    struct in_addr remote;
+    /* Multilink. Only asked for if bundleKey is set. */
+    char bundleKey[64];
+    bool multilink;
+    int mrru;
+    int peerMrru;
+    bool peerShortSeq;
+    uint8_t peerEndpoint[21];
+    int peerEndpointLen;
+    mp_bundle_t *bundle;
+    int bundleSlot;
+};
+
+/* 0 if it loaded, -1 if the file couldn't be opened, -2 if a line didn't make sense. */
+int ppp_load_config(const char *path, ppp_config_t *config);
+void ppp_free_config(ppp_config_t *config);
+
+/* Set up a session for the caller on line number index. */
+void ppp_init(ppp_t *ppp, const ppp_config_t *config, const char *tag, int index);
+/* Offer multilink. Calls with the same key, peer name and endpoint discriminator get bundled. */
+void ppp_multilink(ppp_t *ppp, const char *key);
+/* The endpoint discriminator we give the peer for a bundle key, so pppd can be told to use the same one. */
+uint32_t ppp_endpoint(const char *key);
+/* Put the TTY into PPP mode and make a ppp unit for it. 0 if it worked. */
+int ppp_attach(ppp_t *ppp, int ttyFd);
+/* Negotiate and keep the link up until it's done. Returns a pppd style exit code. */
+int ppp_run(ppp_t *ppp);
+/* Ask the link to close. Safe to call from another thread. */
+void ppp_close(ppp_t *ppp, int exitCode);
+/* Give the TTY back. */
+void ppp_detach(ppp_t *ppp);
+
+#endif
@@ -0,0 +1,328 @@
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "log.h"
+#include "prompt.h"
+
+#define MAX_PROMPTS 64
+#define MIN_RATE 4000
+#define MAX_RATE 48000
+/* WAV's format codes. */
+#define WAV_PCM 1
+#define WAV_ALAW 6
+#define WAV_ULAW 7
+/* AU's encodings. */
+#define AU_ULAW 1
+#define AU_LINEAR_8 2
+#define AU_LINEAR_16 3
+#define AU_ALAW 27
+
+typedef struct {
+    char name[32];
+    /* The file we last looked at, whether it loaded or not, so a bad one only gets complained about once. */
+    dev_t dev;
+    ino_t ino;
+    off_t size;
+    struct timespec mtime;
+    prompt_audio_t *current;
+} prompt_t;
+
+static prompt_t prompts[MAX_PROMPTS];
+static int numPrompts = 0;
+static pthread_mutex_t promptLock = PTHREAD_MUTEX_INITIALIZER;
+static char promptDir[512];
+
+static uint32_t le16(const uint8_t *p) {
+    return p[0] | p[1] << 8;
+}
+
+static uint32_t le32(const uint8_t *p) {
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint32_t be32(const uint8_t *p) {
+    return (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+static void release(prompt_audio_t *audio) {
+    audio_asset_free(&audio->asset);
+    if (audio->map != NULL) {
+        munmap(audio->map, audio->mapLen);
+    }
+    free(audio);
+}
+
+/* Call with the lock held. */
+static void put(prompt_audio_t *audio) {
+    if (--audio->refs == 0) {
+        release(audio);
+    }
+}
+
+/* bytes of samples at data, in format. */
+static bool set_samples(prompt_audio_t *audio, const char *path, const uint8_t *data, size_t bytes, audio_format_t format) {
+    size_t count = bytes/audio_sample_size(format.encoding);
+    if (format.rate < MIN_RATE || format.rate > MAX_RATE) {
+        log_error(NULL, "%s is at %d Hz. Prompts have to be at %d to %d Hz.", path, format.rate, MIN_RATE, MAX_RATE);
+        return false;
+    }
+    if (count == 0 || count > INT_MAX/2) {
+        log_error(NULL, "%s has %s audio in it.", path, count == 0 ? "no" : "too much");
+        return false;
+    }
+    audio_asset_init(&audio->asset, data, count, format);
+    return true;
+}
+
+static bool parse_wav(prompt_audio_t *audio, const char *path) {
+    const uint8_t *p = audio->map;
+    size_t len = audio->mapLen;
+    size_t pos = 12;
+    bool haveFormat = false;
+    audio_format_t format;
+    if (len < 12 || memcmp(p, "RIFF", 4) != 0 || memcmp(p + 8, "WAVE", 4) != 0) {
+        log_error(NULL, "%s isn't a WAV file.", path);
+        return false;
+    }
+    while (pos + 8 <= len) {
+        const uint8_t *chunk = p + pos;
+        uint32_t size = le32(chunk + 4);
+        if (memcmp(chunk, "fmt ", 4) == 0 && size >= 16 && pos + 8 + 16 <= len) {
+            uint32_t code = le16(chunk + 8);
+            uint32_t channels = le16(chunk + 10);
+            uint32_t rate = le32(chunk + 12);
+            uint32_t bits = le16(chunk + 22);
+            if (channels != 1 || !((code == WAV_PCM && (bits == 8 || bits == 16)) || ((code == WAV_ALAW || code == WAV_ULAW) && bits == 8))) {
+                log_error(NULL, "%s is %u-bit, %u channel%s (format %u). Prompts have to be mono 8 or 16-bit PCM, u-law or A-law.",
+                    path, bits, channels, channels == 1 ? "" : "s", code);
+                return false;
+            }
+            /* 8-bit WAVs are unsigned, and 16-bit ones signed. */
+            format.encoding = code == WAV_ALAW ? AUDIO_ALAW : code == WAV_ULAW ? AUDIO_ULAW : bits == 16 ? AUDIO_S16LE : AUDIO_U8;
+            format.rate = rate;
+            haveFormat = true;
+        } else if (memcmp(chunk, "data", 4) == 0) {
+            size_t left = len - pos - 8;
+            if (!haveFormat) {
+                log_error(NULL, "%s has its audio before its format.", path);
+                return false;
+            }
+            /* Recorders that got cut short leave the size wrong. Take what's there. */
+            return set_samples(audio, path, chunk + 8, size < left ? size : left, format);
+        }
+        /* Chunks are padded out to an even length. */
+        pos += 8 + (size_t)size + (size & 1);
+    }
+    log_error(NULL, "%s has no audio in it.", path);
+    return false;
+}
+
+static bool parse_au(prompt_audio_t *audio, const char *path) {
+    const uint8_t *p = audio->map;
+    size_t len = audio->mapLen;
+    uint32_t offset, size, encoding, rate, channels;
+    audio_format_t format;
+    if (len < 24 || memcmp(p, ".snd", 4) != 0) {
+        log_error(NULL, "%s isn't an AU file.", path);
+        return false;
+    }
+    offset = be32(p + 4);
+    size = be32(p + 8);
+    encoding = be32(p + 12);
+    rate = be32(p + 16);
+    channels = be32(p + 20);
+    if (offset < 24 || offset > len) {
+        log_error(NULL, "%s's header is broken.", path);
+        return false;
+    }
+    if (channels != 1 || (encoding != AU_ULAW && encoding != AU_LINEAR_8 && encoding != AU_LINEAR_16 && encoding != AU_ALAW)) {
+        log_error(NULL, "%s is encoding %u, %u channel%s. Prompts have to be mono u-law (1), 8 or 16-bit linear (2 or 3) or A-law (27).",
+            path, encoding, channels, channels == 1 ? "" : "s");
+        return false;
+    }
+    /* AU's linear samples are signed and big endian. */
+    format.encoding = encoding == AU_ULAW ? AUDIO_ULAW : encoding == AU_ALAW ? AUDIO_ALAW : encoding == AU_LINEAR_16 ? AUDIO_S16BE : AUDIO_S8;
+    format.rate = rate;
+    /* ~0 is "however much there is". */
+    if (size == 0xffffffff || size > len - offset) {
+        size = len - offset;
+    }
+    return set_samples(audio, path, p + offset, size, format);
+}
+
+/* Map and check a prompt file. st gets what it was, from the file we actually opened. NULL if it's no good. */
+static prompt_audio_t *load(const char *path, struct stat *st) {
+    prompt_audio_t *audio;
+    bool ok;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0 || fstat(fd, st) != 0) {
+        log_error(NULL, "Couldn't open %s: %s", path, strerror(errno));
+        if (fd >= 0) {
+            close(fd);
+        }
+        return NULL;
+    }
+    if (st->st_size == 0) {
+        log_error(NULL, "%s is empty.", path);
+        close(fd);
+        return NULL;
+    }
+    if ((audio = calloc(1, sizeof(prompt_audio_t))) == NULL) {
+        log_error(NULL, "Out of memory loading %s!", path);
+        close(fd);
+        return NULL;
+    }
+    audio->mapLen = st->st_size;
+    audio->map = mmap(NULL, audio->mapLen, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (audio->map == MAP_FAILED) {
+        log_error(NULL, "Couldn't map %s: %s", path, strerror(errno));
+        audio->map = NULL;
+        release(audio);
+        return NULL;
+    }
+    ok = strcmp(strrchr(path, '.'), ".au") == 0 ? parse_au(audio, path) : parse_wav(audio, path);
+    if (!ok) {
+        release(audio);
+        return NULL;
+    }
+    /* It gets played (or converted) start to finish. */
+    madvise(audio->map, audio->mapLen, MADV_SEQUENTIAL);
+    audio->refs = 1;
+    return audio;
+}
+
+/* The prompt's file: <name>.wav, or <name>.au if there's no WAV. */
+static bool find_file(const char *name, char *path, size_t size, struct stat *st) {
+    snprintf(path, size, "%s/%s.wav", promptDir, name);
+    if (stat(path, st) == 0) {
+        return true;
+    }
+    snprintf(path, size, "%s/%s.au", promptDir, name);
+    return stat(path, st) == 0;
+}
+
+/* Call with the lock held. Load the prompt if its file's changed since we last looked. False if a new file didn't load. */
+static bool refresh(prompt_t *prompt) {
+    char path[600];
+    struct stat st;
+    prompt_audio_t *audio;
+    if (!find_file(prompt->name, path, sizeof(path), &st)) {
+        if (prompt->current != NULL) {
+            log_info(NULL, "The %s prompt's gone.", prompt->name);
+            put(prompt->current);
+            prompt->current = NULL;
+        }
+        prompt->ino = 0;
+        return true;
+    }
+    if (st.st_dev == prompt->dev && st.st_ino == prompt->ino && st.st_size == prompt->size &&
+        st.st_mtim.tv_sec == prompt->mtime.tv_sec && st.st_mtim.tv_nsec == prompt->mtime.tv_nsec) {
+        return true;
+    }
+    audio = load(path, &st);
+    prompt->dev = st.st_dev;
+    prompt->ino = st.st_ino;
+    prompt->size = st.st_size;
+    prompt->mtime = st.st_mtim;
+    if (audio == NULL) {
+        if (prompt->current != NULL) {
+            log_warn(NULL, "Keeping the %s prompt we had.", prompt->name);
+        }
+        return false;
+    }
+    if (prompt->current != NULL) {
+        log_info(NULL, "The %s prompt changed. Loaded the new one.", prompt->name);
+        /* Lines still playing the old one hold it until they're done. */
+        put(prompt->current);
+    }
+    prompt->current = audio;
+    return true;
+}
+
+/* Call with the lock held. NULL if it's not one we know and there's no room for it. */
+static prompt_t *find(const char *name) {
+    prompt_t *prompt;
+    for (int i = 0; i < numPrompts; i++) {
+        if (strcmp(prompts[i].name, name) == 0) {
+            return &prompts[i];
+        }
+    }
+    if (numPrompts == MAX_PROMPTS || strlen(name) >= sizeof(prompt->name)) {
+        return NULL;
+    }
+    prompt = &prompts[numPrompts++];
+    memset(prompt, 0, sizeof(*prompt));
+    strcpy(prompt->name, name);
+    return prompt;
+}
+
+int prompt_init(const char *dir) {
+    DIR *d;
+    struct dirent *ent;
+    int res = 0;
+    snprintf(promptDir, sizeof(promptDir), "%s", dir);
+    if ((d = opendir(dir)) == NULL) {
+        return -1;
+    }
+    pthread_mutex_lock(&promptLock);
+    while ((ent = readdir(d)) != NULL) {
+        char name[256];
+        char *ext;
+        prompt_t *prompt;
+        snprintf(name, sizeof(name), "%s", ent->d_name);
+        if ((ext = strrchr(name, '.')) == NULL || (strcmp(ext, ".wav") != 0 && strcmp(ext, ".au") != 0)) {
+            continue;
+        }
+        *ext = 0;
+        if ((prompt = find(name)) == NULL) {
+            log_warn(NULL, "Skipping prompt %s. The name's too long, or there are more than %d.", ent->d_name, MAX_PROMPTS);
+        } else if (!refresh(prompt)) {
+            res = -2;
+        }
+    }
+    pthread_mutex_unlock(&promptLock);
+    closedir(d);
+    return res;
+}
+
+void prompt_shutdown(void) {
+    pthread_mutex_lock(&promptLock);
+    for (int i = 0; i < numPrompts; i++) {
+        if (prompts[i].current != NULL) {
+            put(prompts[i].current);
+        }
+    }
+    numPrompts = 0;
+    promptDir[0] = 0;
+    pthread_mutex_unlock(&promptLock);
+}
+
+prompt_audio_t *prompt_get(const char *name) {
+    prompt_t *prompt;
+    prompt_audio_t *audio = NULL;
+    pthread_mutex_lock(&promptLock);
+    if (promptDir[0] != 0 && (prompt = find(name)) != NULL) {
+        refresh(prompt);
+        if ((audio = prompt->current) != NULL) {
+            audio->refs++;
+        }
+    }
+    pthread_mutex_unlock(&promptLock);
+    return audio;
+}
+
+void prompt_put(prompt_audio_t *audio) {
+    pthread_mutex_lock(&promptLock);
+    put(audio);
+    pthread_mutex_unlock(&promptLock);
+}
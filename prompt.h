@@ -0,0 +1,42 @@
+#ifndef PROMPT_H
+#define PROMPT_H
+#include <stddef.h>
+#include <stdint.h>
+#include "audio.h"
+
+/*
+ * Recorded announcements played to callers: "this number is not in
+ * service", "all lines are busy", a welcome message. Each is <name>.wav or
+ * <name>.au in the prompt directory: mono, in 8 or 16-bit linear, u-law or
+ * A-law, at 4000 to 48000 Hz. They stay mapped read-only, and are converted
+ * (see audio.h) once for each format the modems play them in. A prompt
+ * that's already in a modem's format plays straight out of the mapping.
+ *
+ * Files get checked when they're loaded, not while they play. A prompt whose
+ * file has been replaced is loaded again the next time it's played, and the
+ * old one's let go once the last line playing it is done. Replace them by
+ * renaming a new file over the old one: a mapped file cut short underneath
+ * a line playing it takes dialin down with SIGBUS.
+ */
+
+/* Played to callers who dial a number nothing in the dial plan takes. */
+#define PROMPT_NOT_IN_SERVICE "notinservice"
+
+typedef struct {
+    void *map;
+    size_t mapLen;
+    /* The samples, in the mapping. */
+    audio_asset_t asset;
+    /* Lines playing it, plus one while it's the current one. */
+    int refs;
+} prompt_audio_t;
+
+/* 0 if every prompt in dir loaded, -1 if dir couldn't be opened, -2 if a file in it didn't make sense. */
+int prompt_init(const char *dir);
+void prompt_shutdown(void);
+/* The prompt's audio, loading it again first if its file's changed. NULL if there's no such prompt. */
+prompt_audio_t *prompt_get(const char *name);
+/* Done playing it. */
+void prompt_put(prompt_audio_t *audio);
+
+#endif
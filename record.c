@@ -0,0 +1,371 @@
+#include <time.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include "ring.h"
+#include "log.h"
+#include "record.h"
+
+#define RECORD_SLOTS 1024
+#define RECORD_BLOCK_BYTES 1024
+/* Each file's audio is saved up to this much before it's written. */
+#define RECORD_BATCH_BYTES 65536
+/* And written at least this often, so a recording of a call that's still going has something in it. */
+#define RECORD_FLUSH_NSEC 1000000000
+/* How long the writer naps when there's nothing to do. */
+#define RECORD_IDLE_NSEC 20000000
+#define WAV_HEADER_BYTES 44
+#define WAV_PCM 1
+#define WAV_ALAW 6
+#define WAV_ULAW 7
+
+/* Blocks are audio for RECORD_RX or RECORD_TX, or one of these. */
+#define RECORD_OPEN 2
+#define RECORD_CLOSE 3
+
+typedef struct {
+    recording_t *rec;
+    uint8_t kind;
+    uint16_t len;
+    /* Bytes before this block that didn't fit in the queue. */
+    uint32_t gap;
+    uint8_t data[RECORD_BLOCK_BYTES];
+} record_block_t;
+
+struct recording {
+    char tag[16];
+    audio_format_t format;
+    /* The line's side. Queued counts what didn't fit too, since it's recorded as silence. */
+    uint64_t queued[2];
+    uint32_t gap[2];
+    uint64_t dropped;
+    bool full[2];
+    /* The writer's side. */
+    int fd[2];
+    uint32_t written[2];
+    uint8_t *batch[2];
+    size_t batchLen[2];
+    uint64_t lastFlush;
+    recording_t *next;
+};
+
+static ring_t recordRing;
+static pthread_t recordThread;
+static atomic_bool recordRunning = false;
+static _Atomic uint64_t recordDropped = 0;
+static char recordDir[512];
+/* The writer's. Recordings that are open. */
+static recording_t *recordings = NULL;
+
+static uint64_t monotonic_nsec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+static uint8_t *put_u16(uint8_t *p, uint16_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    return p + 2;
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t v) {
+    for (int i = 0; i < 4; i++) {
+        p[i] = v >> (i*8);
+    }
+    return p + 4;
+}
+
+static bool write_all(int fd, const uint8_t *buf, size_t len) {
+    while (len > 0) {
+        ssize_t res = write(fd, buf, len);
+        if (res < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        buf += res;
+        len -= res;
+    }
+    return true;
+}
+
+/* WAVs can't do signed 8-bit or big endian, so those get turned around on the way to the file. */
+static int file_sample_size(audio_encoding_t encoding) {
+    return encoding == AUDIO_S16LE || encoding == AUDIO_S16BE ? 2 : 1;
+}
+
+static uint8_t silence(audio_encoding_t encoding) {
+    switch (encoding) {
+        case AUDIO_U8:
+        case AUDIO_S8:
+            return 0x80;
+        case AUDIO_ULAW:
+            return 0xff;
+        case AUDIO_ALAW:
+            return 0xd5;
+        default:
+            return 0;
+    }
+}
+
+static void wav_header(uint8_t *p, audio_format_t format, uint32_t dataBytes) {
+    int size = file_sample_size(format.encoding);
+    memcpy(p, "RIFF", 4);
+    put_u32(p + 4, 36 + dataBytes);
+    memcpy(p + 8, "WAVEfmt ", 8);
+    put_u32(p + 16, 16);
+    put_u16(p + 20, format.encoding == AUDIO_ULAW ? WAV_ULAW : format.encoding == AUDIO_ALAW ? WAV_ALAW : WAV_PCM);
+    put_u16(p + 22, 1);
+    put_u32(p + 24, format.rate);
+    put_u32(p + 28, format.rate*size);
+    put_u16(p + 32, size);
+    put_u16(p + 34, size*8);
+    memcpy(p + 36, "data", 4);
+    put_u32(p + 40, dataBytes);
+}
+
+/* Write out what's saved up, and fix up the header so the file's good even if we never get to finish it. */
+static void flush(recording_t *rec, int dir) {
+    uint8_t sizes[4];
+    if (rec->batchLen[dir] == 0) {
+        return;
+    }
+    if (!write_all(rec->fd[dir], rec->batch[dir], rec->batchLen[dir])) {
+        log_warn(rec->tag, "Couldn't write the recording: %s", strerror(errno));
+    } else {
+        rec->written[dir] += rec->batchLen[dir];
+        put_u32(sizes, 36 + rec->written[dir]);
+        pwrite(rec->fd[dir], sizes, 4, 4);
+        put_u32(sizes, rec->written[dir]);
+        pwrite(rec->fd[dir], sizes, 4, 40);
+    }
+    rec->batchLen[dir] = 0;
+}
+
+/* Add len bytes (data, or silence if it's NULL) to what's going to the file. */
+static void append(recording_t *rec, int dir, const uint8_t *data, size_t len) {
+    while (len > 0) {
+        uint8_t *out = rec->batch[dir] + rec->batchLen[dir];
+        size_t n = RECORD_BATCH_BYTES - rec->batchLen[dir];
+        n = len < n ? len : n;
+        if (data == NULL) {
+            memset(out, silence(rec->format.encoding), n);
+        } else if (rec->format.encoding == AUDIO_S8) {
+            for (size_t i = 0; i < n; i++) {
+                out[i] = data[i] ^ 0x80;
+            }
+        } else if (rec->format.encoding == AUDIO_S16BE) {
+            /* Whole samples always come in, so pairs never get split. */
+            for (size_t i = 0; i + 1 < n; i += 2) {
+                out[i] = data[i + 1];
+                out[i + 1] = data[i];
+            }
+        } else {
+            memcpy(out, data, n);
+        }
+        rec->batchLen[dir] += n;
+        if (rec->batchLen[dir] == RECORD_BATCH_BYTES) {
+            flush(rec, dir);
+        }
+        if (data != NULL) {
+            data += n;
+        }
+        len -= n;
+    }
+}
+
+static void finish(recording_t *rec) {
+    recording_t **p;
+    for (int dir = 0; dir < 2; dir++) {
+        flush(rec, dir);
+        close(rec->fd[dir]);
+        free(rec->batch[dir]);
+    }
+    for (p = &recordings; *p != NULL && *p != rec; p = &(*p)->next);
+    if (*p != NULL) {
+        *p = rec->next;
+    }
+    free(rec);
+}
+
+static bool record_drain(void) {
+    record_block_t *block;
+    bool any = false;
+    while ((block = ring_peek(&recordRing)) != NULL) {
+        recording_t *rec = block->rec;
+        if (block->kind == RECORD_OPEN) {
+            rec->next = recordings;
+            recordings = rec;
+            rec->lastFlush = monotonic_nsec();
+        } else if (block->kind == RECORD_CLOSE) {
+            finish(rec);
+        } else {
+            append(rec, block->kind, NULL, block->gap);
+            append(rec, block->kind, block->data, block->len);
+        }
+        ring_release(&recordRing);
+        any = true;
+    }
+    /* Calls that are going quietly still get written every so often. */
+    for (recording_t *rec = recordings; rec != NULL; rec = rec->next) {
+        uint64_t now = monotonic_nsec();
+        if (now - rec->lastFlush >= RECORD_FLUSH_NSEC) {
+            flush(rec, RECORD_RX);
+            flush(rec, RECORD_TX);
+            rec->lastFlush = now;
+        }
+    }
+    return any;
+}
+
+static void *record_thread(void *arg) {
+    struct timespec idle = {0, RECORD_IDLE_NSEC};
+    (void)arg;
+    while (atomic_load(&recordRunning)) {
+        if (!record_drain()) {
+            nanosleep(&idle, NULL);
+        }
+    }
+    /* Get out whatever's left, and finish off calls that never got to. */
+    record_drain();
+    while (recordings != NULL) {
+        finish(recordings);
+    }
+    return NULL;
+}
+
+int record_init(const char *dir) {
+    if (atomic_load(&recordRunning)) {
+        return -3;
+    }
+    if (access(dir, W_OK | X_OK) != 0) {
+        return -1;
+    }
+    snprintf(recordDir, sizeof(recordDir), "%s", dir);
+    if (ring_init(&recordRing, RECORD_SLOTS, sizeof(record_block_t)) != 0) {
+        return -2;
+    }
+    atomic_store(&recordRunning, true);
+    if (pthread_create(&recordThread, NULL, record_thread, NULL) != 0) {
+        atomic_store(&recordRunning, false);
+        ring_free(&recordRing);
+        return -3;
+    }
+    return 0;
+}
+
+void record_shutdown(void) {
+    if (atomic_exchange(&recordRunning, false)) {
+        pthread_join(recordThread, NULL);
+        ring_free(&recordRing);
+    }
+}
+
+/* Opening and closing have to get to the writer, or files get left open. It's never far behind, so wait for it. */
+static void send_control(recording_t *rec, uint8_t kind) {
+    struct timespec wait = {0, 1000000};
+    record_block_t *block;
+    while ((block = ring_claim(&recordRing)) == NULL) {
+        nanosleep(&wait, NULL);
+    }
+    block->rec = rec;
+    block->kind = kind;
+    block->len = 0;
+    block->gap = 0;
+    ring_publish(&recordRing, block);
+}
+
+recording_t *record_start(const char *tag, audio_format_t format) {
+    static const char *suffixes[2] = {"rx", "tx"};
+    recording_t *rec;
+    char stamp[32];
+    struct tm tm;
+    time_t now = time(NULL);
+    if (!atomic_load(&recordRunning)) {
+        return NULL;
+    }
+    if ((rec = calloc(1, sizeof(recording_t))) == NULL) {
+        log_warn(tag, "Out of memory starting a recording!");
+        return NULL;
+    }
+    snprintf(rec->tag, sizeof(rec->tag), "%s", tag);
+    rec->format = format;
+    rec->fd[RECORD_RX] = rec->fd[RECORD_TX] = -1;
+    localtime_r(&now, &tm);
+    strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", &tm);
+    for (int dir = 0; dir < 2; dir++) {
+        char path[600];
+        uint8_t header[WAV_HEADER_BYTES];
+        snprintf(path, sizeof(path), "%s/%s-%s-%s.wav", recordDir, tag, stamp, suffixes[dir]);
+        wav_header(header, format, 0);
+        if ((rec->batch[dir] = malloc(RECORD_BATCH_BYTES)) == NULL ||
+            (rec->fd[dir] = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0 ||
+            !write_all(rec->fd[dir], header, sizeof(header))) {
+            log_warn(tag, "Couldn't start recording to %s: %s", path, strerror(errno));
+            for (dir = 0; dir < 2; dir++) {
+                if (rec->fd[dir] >= 0) {
+                    close(rec->fd[dir]);
+                }
+                free(rec->batch[dir]);
+            }
+            free(rec);
+            return NULL;
+        }
+    }
+    log_info(tag, "Recording the call to %s/%s-%s-{rx,tx}.wav.", recordDir, tag, stamp);
+    send_control(rec, RECORD_OPEN);
+    return rec;
+}
+
+void record_samples(recording_t *rec, record_dir_t dir, const uint8_t *data, size_t len) {
+    size_t room;
+    if (rec->full[dir] || len == 0) {
+        return;
+    }
+    room = RECORD_MAX_BYTES - WAV_HEADER_BYTES - rec->queued[dir];
+    if (len >= room) {
+        len = room - room % audio_sample_size(rec->format.encoding);
+        rec->full[dir] = true;
+        log_info(rec->tag, "The %s recording's hit %d MB. That's all that gets recorded.", dir == RECORD_RX ? "rx" : "tx", RECORD_MAX_BYTES/(1024*1024));
+    }
+    rec->queued[dir] += len;
+    while (len > 0) {
+        size_t n = len < RECORD_BLOCK_BYTES ? len : RECORD_BLOCK_BYTES;
+        record_block_t *block = ring_claim(&recordRing);
+        if (block == NULL) {
+            /* The writer's behind. Leave a hole rather than hold the line up. */
+            rec->gap[dir] += n;
+            rec->dropped++;
+            atomic_fetch_add_explicit(&recordDropped, 1, memory_order_relaxed);
+        } else {
+            block->rec = rec;
+            block->kind = dir;
+            block->len = n;
+            block->gap = rec->gap[dir];
+            memcpy(block->data, data, n);
+            ring_publish(&recordRing, block);
+            rec->gap[dir] = 0;
+        }
+        data += n;
+        len -= n;
+    }
+}
+
+void record_stop(recording_t *rec) {
+    if (rec->dropped > 0) {
+        log_warn(rec->tag, "%llu blocks of the recording didn't fit in the queue. They're silence in it.", (unsigned long long)rec->dropped);
+    }
+    send_control(rec, RECORD_CLOSE);
+}
+
+uint64_t record_dropped(void) {
+    return atomic_load_explicit(&recordDropped, memory_order_relaxed);
+}
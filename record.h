@@ -0,0 +1,43 @@
+#ifndef RECORD_H
+#define RECORD_H
+#include <stddef.h>
+#include <stdint.h>
+#include "audio.h"
+
+/*
+ * Recordings of the voice audio on a line's calls, for working out what a
+ * caller heard (and what the line sounded like) after the fact. Each call
+ * gets two WAVs in the recording directory: <line>-<date>-<time>-rx.wav, what
+ * the modem heard, and -tx.wav, what we sent it. What's sent gets recorded
+ * as it goes to the modem, up to a second before it's played, so -tx.wav has
+ * the end of the dialtone the modem threw away when it stopped.
+ *
+ * Lines queue their audio and never wait: a background thread does the
+ * writing, in big batches. If it falls behind, what didn't fit is counted
+ * and recorded as silence, so the rest still lines up. Each file stops
+ * growing at RECORD_MAX_BYTES.
+ */
+
+#define RECORD_MAX_BYTES (16*1024*1024)
+
+typedef enum {
+    RECORD_RX = 0,
+    RECORD_TX
+} record_dir_t;
+
+typedef struct recording recording_t;
+
+/* 0 if it started, -1 if dir can't be written to, -2 if we're out of memory, -3 if the writer wouldn't start. */
+int record_init(const char *dir);
+void record_shutdown(void);
+
+/* Start recording a call on the line with this tag, in format. NULL if it couldn't (or recording's off). */
+recording_t *record_start(const char *tag, audio_format_t format);
+/* Never blocks. len is in bytes. */
+void record_samples(recording_t *rec, record_dir_t dir, const uint8_t *data, size_t len);
+/* Done with the call. The files get finished off in the background. */
+void record_stop(recording_t *rec);
+/* Blocks of audio that didn't fit in the queue, on every line. */
+uint64_t record_dropped(void);
+
+#endif
@@ -0,0 +1,432 @@
+#define _GNU_SOURCE
+#include <poll.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include "log.h"
+#include "clock.h"
+#include "relay.h"
+#include "rfc2217.h"
+#include "linewatch.h"
+
+#define CONNECT_USEC 10000000
+/* Longest we go without looking for a close request. */
+#define CHECK_USEC 250000
+
+/* Telnet (RFC 854). */
+#define IAC 255
+#define DONT 254
+#define DO 253
+#define WONT 252
+#define WILL 251
+#define SB 250
+#define SE 240
+#define OPT_BINARY 0
+#define OPT_ECHO 1
+#define OPT_SGA 3
+
+enum {
+    TN_DATA = 0,
+    TN_IAC,
+    TN_OPT,
+    TN_SB,
+    TN_SB_IAC
+};
+
+static bool option_on(const uint8_t *options, uint8_t opt) {
+    return (options[opt >> 3] >> (opt & 7)) & 1;
+}
+
+static void set_option(uint8_t *options, uint8_t opt, bool on) {
+    if (on) {
+        options[opt >> 3] |= 1 << (opt & 7);
+    } else {
+        options[opt >> 3] &= ~(1 << (opt & 7));
+    }
+}
+
+static void send_telnet(relay_t *relay, uint8_t cmd, uint8_t opt) {
+    uint8_t buf[3] = {IAC, cmd, opt};
+    /* Tiny, and the socket is nearly always writable. If it isn't, the far end asks again. */
+    if (write(relay->sock, buf, sizeof(buf)) != sizeof(buf)) {
+        log_debug(relay->tag, "Couldn't answer a telnet option.");
+    }
+}
+
+/* Only answer when something changes, so we never get into a loop with the far end (RFC 1143). */
+static void negotiate(relay_t *relay, uint8_t cmd, uint8_t opt) {
+    switch (cmd) {
+        case WILL:
+            if (opt == OPT_BINARY || opt == OPT_ECHO || opt == OPT_SGA) {
+                if (!option_on(relay->remoteOptions, opt)) {
+                    set_option(relay->remoteOptions, opt, true);
+                    send_telnet(relay, DO, opt);
+                }
+            } else {
+                send_telnet(relay, DONT, opt);
+            }
+            break;
+        case WONT:
+            if (option_on(relay->remoteOptions, opt)) {
+                set_option(relay->remoteOptions, opt, false);
+                send_telnet(relay, DONT, opt);
+            }
+            break;
+        case DO:
+            if (opt == OPT_BINARY || opt == OPT_SGA) {
+                if (!option_on(relay->localOptions, opt)) {
+                    set_option(relay->localOptions, opt, true);
+                    send_telnet(relay, WILL, opt);
+                }
+            } else {
+                send_telnet(relay, WONT, opt);
+            }
+            break;
+        case DONT:
+            if (option_on(relay->localOptions, opt)) {
+                set_option(relay->localOptions, opt, false);
+                send_telnet(relay, WONT, opt);
+            }
+            break;
+    }
+}
+
+/* Strip telnet commands out of what the server sent, in place. Returns what's left. */
+static size_t telnet_from_server(relay_t *relay, uint8_t *buf, size_t len) {
+    size_t out = 0;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t c = buf[i];
+        switch (relay->telnetState) {
+            case TN_DATA:
+                if (c == IAC) {
+                    relay->telnetState = TN_IAC;
+                } else if (!(c == 0 && relay->lastWasCr && !option_on(relay->remoteOptions, OPT_BINARY))) {
+                    /* CR NUL is just CR. */
+                    buf[out++] = c;
+                }
+                relay->lastWasCr = c == '\r';
+                break;
+            case TN_IAC:
+                if (c == IAC) {
+                    buf[out++] = IAC;
+                    relay->telnetState = TN_DATA;
+                } else if (c >= WILL && c <= DONT) {
+                    relay->telnetCmd = c;
+                    relay->telnetState = TN_OPT;
+                } else if (c == SB) {
+                    relay->telnetState = TN_SB;
+                } else {
+                    /* NOP, GA and friends. */
+                    relay->telnetState = TN_DATA;
+                }
+                break;
+            case TN_OPT:
+                negotiate(relay, relay->telnetCmd, c);
+                relay->telnetState = TN_DATA;
+                break;
+            case TN_SB:
+                if (c == IAC) {
+                    relay->telnetState = TN_SB_IAC;
+                }
+                break;
+            case TN_SB_IAC:
+                relay->telnetState = c == SE ? TN_DATA : TN_SB;
+                break;
+        }
+    }
+    return out;
+}
+
+/* Escape what the caller typed for the server. in and out can't overlap. Returns the length of out. */
+static size_t telnet_to_server(relay_t *relay, const uint8_t *in, size_t len, uint8_t *out) {
+    uint8_t *p = out;
+    bool binary = option_on(relay->localOptions, OPT_BINARY);
+    for (size_t i = 0; i < len; i++) {
+        *p++ = in[i];
+        if (in[i] == IAC) {
+            *p++ = IAC;
+        } else if (in[i] == '\r' && !binary && (i + 1 >= len || in[i + 1] != '\n')) {
+            /* A bare CR has to be CR NUL. */
+            *p++ = 0;
+        }
+    }
+    return p - out;
+}
+
+static bool dir_pending(const relay_dir_t *dir) {
+    return dir->inPipe > 0 || dir->off < dir->len;
+}
+
+static void stop_splicing(relay_dir_t *dir) {
+    if (dir->pipe[0] >= 0) {
+        close(dir->pipe[0]);
+        close(dir->pipe[1]);
+        dir->pipe[0] = -1;
+        dir->pipe[1] = -1;
+    }
+}
+
+static int dir_init(relay_dir_t *dir, int from, int to, bool splice) {
+    memset(dir, 0, sizeof(*dir));
+    dir->from = from;
+    dir->to = to;
+    dir->pipe[0] = -1;
+    dir->pipe[1] = -1;
+    if (splice && pipe2(dir->pipe, O_NONBLOCK | O_CLOEXEC) != 0) {
+        dir->pipe[0] = -1;
+        dir->pipe[1] = -1;
+    }
+    if ((dir->buf = malloc(RELAY_BUF_SIZE)) == NULL) {
+        return -1;
+    }
+    return 0;
+}
+
+/* Push out what we're holding. Returns false if to is broken. */
+static bool dir_drain(relay_t *relay, relay_dir_t *dir) {
+    ssize_t bytes;
+    if (dir->inPipe > 0) {
+        bytes = splice(dir->pipe[0], NULL, dir->to, NULL, dir->inPipe, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+        if (bytes > 0) {
+            dir->inPipe -= bytes;
+            dir->bytes += bytes;
+        } else if (bytes < 0 && errno == EINVAL) {
+            /* Can't splice into this one. Take it back out of the pipe and stop splicing. */
+            log_debug(relay->tag, "Can't splice to fd %d. Bouncing through a buffer.", dir->to);
+            bytes = read(dir->pipe[0], dir->buf, dir->inPipe);
+            dir->len = bytes > 0 ? bytes : 0;
+            dir->off = 0;
+            dir->inPipe = 0;
+            stop_splicing(dir);
+        } else if (bytes < 0 && errno != EAGAIN && errno != EINTR) {
+            return false;
+        }
+    }
+    while (dir->off < dir->len) {
+        bytes = write(dir->to, dir->buf + dir->off, dir->len - dir->off);
+        if (bytes <= 0) {
+            return bytes < 0 && (errno == EAGAIN || errno == EINTR);
+        }
+        dir->off += bytes;
+        dir->bytes += bytes;
+    }
+    dir->off = 0;
+    dir->len = 0;
+    return true;
+}
+
+/* Take in more. Sets eof when from is done. */
+static void dir_fill(relay_t *relay, relay_dir_t *dir) {
+    ssize_t bytes;
+    if (dir->pipe[0] >= 0) {
+        bytes = splice(dir->from, NULL, dir->pipe[1], NULL, RELAY_BUF_SIZE, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+        if (bytes > 0) {
+            dir->inPipe = bytes;
+            return;
+        }
+        if (bytes == 0) {
+            dir->eof = true;
+            return;
+        }
+        if (errno == EAGAIN || errno == EINTR) {
+            return;
+        }
+        if (errno != EINVAL) {
+            dir->eof = true;
+            return;
+        }
+        log_debug(relay->tag, "Can't splice from fd %d. Bouncing through a buffer.", dir->from);
+        stop_splicing(dir);
+    }
+    if (relay->telnet && dir == &relay->up) {
+        /* Escaping can double it, so read into the back half and escape into the front. */
+        uint8_t *in = dir->buf + RELAY_BUF_SIZE/2;
+        bytes = read(dir->from, in, RELAY_BUF_SIZE/2);
+        if (bytes > 0) {
+            dir->len = telnet_to_server(relay, in, bytes, dir->buf);
+        }
+    } else {
+        bytes = read(dir->from, dir->buf, RELAY_BUF_SIZE);
+        if (bytes > 0) {
+            dir->len = relay->telnet ? telnet_from_server(relay, dir->buf, bytes) : bytes;
+        }
+    }
+    dir->off = 0;
+    /* A pty gives EIO when the other end goes away. */
+    if (bytes == 0 || (bytes < 0 && errno != EAGAIN && errno != EINTR)) {
+        dir->eof = true;
+    }
+}
+
+/* Same as pppd's modem option: once we've seen DCD, losing it is a hangup. */
+static bool carrier_lost(relay_t *relay) {
+    int bits;
+    relay->carrierTimer = clock_usec() + (relay->statusFd >= 0 ? LINEWATCH_CHECK_USEC : 1000000);
+    if (rfc2217_ioctl(relay->ttyFd, TIOCMGET, &bits) < 0) {
+        return false;
+    }
+    if (bits & TIOCM_CD) {
+        relay->carrierSeen = true;
+        return false;
+    }
+    return relay->carrierSeen;
+}
+
+void relay_init(relay_t *relay, const char *tag) {
+    memset(relay, 0, sizeof(*relay));
+    relay->tag = tag;
+    relay->ttyFd = -1;
+    relay->sock = -1;
+    relay->statusFd = -1;
+    relay->up.pipe[0] = relay->up.pipe[1] = -1;
+    relay->down.pipe[0] = relay->down.pipe[1] = -1;
+}
+
+int relay_connect(relay_t *relay, const char *target, bool telnet, int ttyFd) {
+    struct addrinfo hints = {0};
+    struct addrinfo *addrs, *addr;
+    char host[128];
+    const char *port = strrchr(target, ':');
+    int one = 1;
+    int res;
+    if (port == NULL || port - target >= sizeof(host)) {
+        return -1;
+    }
+    memcpy(host, target, port - target);
+    host[port - target] = 0;
+    port++;
+    /* [::1]:23 */
+    if (host[0] == '[' && host[strlen(host) - 1] == ']') {
+        memmove(host, host + 1, strlen(host) - 2);
+        host[strlen(host) - 2] = 0;
+    }
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if ((res = getaddrinfo(host, port, &hints, &addrs)) != 0) {
+        log_warn(relay->tag, "Couldn't look up %s: %s", host, gai_strerror(res));
+        return -2;
+    }
+    for (addr = addrs; addr != NULL; addr = addr->ai_next) {
+        int err = 0;
+        socklen_t errLen = sizeof(err);
+        struct pollfd pfd;
+        if ((relay->sock = socket(addr->ai_family, addr->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, addr->ai_protocol)) < 0) {
+            continue;
+        }
+        if (connect(relay->sock, addr->ai_addr, addr->ai_addrlen) == 0) {
+            break;
+        }
+        pfd.fd = relay->sock;
+        pfd.events = POLLOUT;
+        if (errno == EINPROGRESS && clock_poll(&pfd, 1, CONNECT_USEC) == 1 &&
+                getsockopt(relay->sock, SOL_SOCKET, SO_ERROR, &err, &errLen) == 0 && err == 0) {
+            break;
+        }
+        close(relay->sock);
+        relay->sock = -1;
+    }
+    freeaddrinfo(addrs);
+    if (relay->sock < 0) {
+        log_warn(relay->tag, "Couldn't connect to %s.", target);
+        return -3;
+    }
+    /* People are typing at it. */
+    setsockopt(relay->sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    setsockopt(relay->sock, SOL_SOCKET, SO_KEEPALIVE, &one, sizeof(one));
+
+    relay->telnet = telnet;
+    relay->ttyFd = ttyFd;
+    relay->ttyFlags = fcntl(ttyFd, F_GETFL);
+    fcntl(ttyFd, F_SETFL, relay->ttyFlags | O_NONBLOCK);
+    /* Telnet means looking at every byte, so there's no point splicing. */
+    if (dir_init(&relay->up, ttyFd, relay->sock, !telnet) != 0 || dir_init(&relay->down, relay->sock, ttyFd, !telnet) != 0) {
+        return -4;
+    }
+    log_info(relay->tag, "Connected to %s%s.", target, telnet ? " (telnet)" : "");
+    return 0;
+}
+
+int relay_run(relay_t *relay) {
+    relay->carrierTimer = clock_usec();
+    while (true) {
+        struct pollfd fds[3];
+        uint64_t now = clock_usec();
+        uint64_t wait = relay->carrierTimer > now ? relay->carrierTimer - now : 0;
+        if (__atomic_exchange_n(&relay->closeRequest, 0, __ATOMIC_ACQ_REL)) {
+            return RELAY_EXIT_USER_REQUEST;
+        }
+        /* Don't take anything more from one side until the other has taken what we've got. */
+        fds[0].fd = relay->ttyFd;
+        fds[0].events = (!dir_pending(&relay->up) && !relay->up.eof ? POLLIN : 0) | (dir_pending(&relay->down) ? POLLOUT : 0);
+        fds[1].fd = relay->sock;
+        fds[1].events = (!dir_pending(&relay->down) && !relay->down.eof ? POLLIN : 0) | (dir_pending(&relay->up) ? POLLOUT : 0);
+        fds[2].fd = relay->statusFd;
+        fds[2].events = POLLIN;
+        if (clock_poll(fds, 3, wait < CHECK_USEC ? wait : CHECK_USEC) < 0 && errno != EINTR) {
+            log_error(relay->tag, "poll failed: %s", strerror(errno));
+            return RELAY_EXIT_ERROR;
+        }
+        if (fds[2].revents & POLLIN) {
+            eventfd_t count;
+            eventfd_read(relay->statusFd, &count);
+            relay->carrierTimer = 0;
+        }
+        if ((fds[0].revents & (POLLIN | POLLHUP | POLLERR)) && !dir_pending(&relay->up)) {
+            dir_fill(relay, &relay->up);
+        }
+        if ((fds[1].revents & (POLLIN | POLLHUP | POLLERR)) && !dir_pending(&relay->down)) {
+            dir_fill(relay, &relay->down);
+        }
+        /* Try writing right away, it usually goes through. */
+        if (dir_pending(&relay->up) && !dir_drain(relay, &relay->up)) {
+            log_info(relay->tag, "The server went away.");
+            return RELAY_EXIT_REMOTE_CLOSED;
+        }
+        if (dir_pending(&relay->down) && !dir_drain(relay, &relay->down)) {
+            log_info(relay->tag, "The line went away.");
+            return RELAY_EXIT_HANGUP;
+        }
+        if (relay->up.eof) {
+            log_info(relay->tag, "The caller hung up.");
+            return RELAY_EXIT_HANGUP;
+        }
+        if (relay->down.eof && !dir_pending(&relay->down)) {
+            log_info(relay->tag, "The server closed the connection.");
+            return RELAY_EXIT_REMOTE_CLOSED;
+        }
+        if (clock_usec() >= relay->carrierTimer && carrier_lost(relay)) {
+            log_info(relay->tag, "Lost carrier.");
+            return RELAY_EXIT_HANGUP;
+        }
+    }
+}
+
+void relay_close(relay_t *relay) {
+    __atomic_store_n(&relay->closeRequest, 1, __ATOMIC_RELEASE);
+}
+
+void relay_free(relay_t *relay) {
+    relay_dir_t *dirs[2] = {&relay->up, &relay->down};
+    for (int i = 0; i < 2; i++) {
+        stop_splicing(dirs[i]);
+        free(dirs[i]->buf);
+        dirs[i]->buf = NULL;
+    }
+    if (relay->sock >= 0) {
+        close(relay->sock);
+        relay->sock = -1;
+    }
+    if (relay->ttyFd >= 0) {
+        fcntl(relay->ttyFd, F_SETFL, relay->ttyFlags);
+        relay->ttyFd = -1;
+    }
+}
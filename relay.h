@@ -0,0 +1,70 @@
+#ifndef RELAY_H
+#define RELAY_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * Connects a caller to a TCP service (a BBS, say) and moves the bytes both
+ * ways on the modem's thread. Where the kernel can splice() between the two
+ * it does, through a pipe, so the data never comes up to us. Otherwise (or
+ * with telnet on, since then we have to look at it) it goes through a buffer.
+ * We only take more from the socket once the modem has taken what we have,
+ * so a fast server gets slowed down to the line's speed by TCP.
+ */
+
+/* How the relay ended, for the call record. */
+#define RELAY_EXIT_REMOTE_CLOSED 0
+#define RELAY_EXIT_CONNECT_FAILED 1
+#define RELAY_EXIT_HANGUP 2
+#define RELAY_EXIT_ERROR 3
+#define RELAY_EXIT_USER_REQUEST 5
+
+#define RELAY_BUF_SIZE 65536
+
+/* One direction of the relay. */
+typedef struct {
+    int from;
+    int to;
+    /* Splicing through this pipe, or -1 if we're bouncing through buf. */
+    int pipe[2];
+    size_t inPipe;
+    uint8_t *buf;
+    size_t len;
+    size_t off;
+    bool eof;
+    uint64_t bytes;
+} relay_dir_t;
+
+typedef struct {
+    const char *tag;
+    int ttyFd;
+    int sock;
+    int ttyFlags;
+    /* Caller to server and server to caller. */
+    relay_dir_t up;
+    relay_dir_t down;
+    bool telnet;
+    /* Telnet state: where we are in a command, and which options are on. */
+    int telnetState;
+    uint8_t telnetCmd;
+    uint8_t remoteOptions[32];
+    uint8_t localOptions[32];
+    bool lastWasCr;
+    bool carrierSeen;
+    uint64_t carrierTimer;
+    /* The line watcher's eventFd, or -1. Readable means look at DCD now. */
+    int statusFd;
+    int closeRequest;
+} relay_t;
+
+void relay_init(relay_t *relay, const char *tag);
+/* Connect to host:port. 0 if it worked. */
+int relay_connect(relay_t *relay, const char *target, bool telnet, int ttyFd);
+/* Move bytes until one end goes away. Returns a RELAY_EXIT code. */
+int relay_run(relay_t *relay);
+/* Ask it to stop. Safe to call from another thread. */
+void relay_close(relay_t *relay);
+void relay_free(relay_t *relay);
+
+#endif
@@ -0,0 +1,661 @@
+#define _GNU_SOURCE
+#include <poll.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <termios.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/eventfd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <linux/serial.h>
+#include "log.h"
+#include "clock.h"
+#include "rfc2217.h"
+
+/* Telnet (RFC 854). */
+#define IAC 255
+#define DONT 254
+#define DO 253
+#define WONT 252
+#define WILL 251
+#define SB 250
+#define SE 240
+#define OPT_BINARY 0
+#define OPT_SGA 3
+#define OPT_COM_PORT 44
+
+/* Com Port Control commands. The server answers with the same ones plus 100. */
+#define CPC_SET_BAUDRATE 1
+#define CPC_SET_DATASIZE 2
+#define CPC_SET_PARITY 3
+#define CPC_SET_STOPSIZE 4
+#define CPC_SET_CONTROL 5
+#define CPC_NOTIFY_MODEMSTATE 7
+#define CPC_FLOWCONTROL_SUSPEND 8
+#define CPC_FLOWCONTROL_RESUME 9
+#define CPC_SET_LINESTATE_MASK 10
+#define CPC_SET_MODEMSTATE_MASK 11
+#define CPC_SERVER 100
+
+#define PARITY_NONE 1
+#define STOPSIZE_1 1
+#define CONTROL_HARDWARE 3
+#define CONTROL_DTR_ON 8
+#define CONTROL_DTR_OFF 9
+#define CONTROL_RTS_ON 11
+#define CONTROL_RTS_OFF 12
+
+/* NOTIFY-MODEMSTATE bits. */
+#define MS_CD 0x80
+#define MS_RI 0x40
+#define MS_DSR 0x20
+#define MS_CTS 0x10
+/* Trailing edge of RI. */
+#define MS_TERI 0x04
+
+#define CONNECT_USEC 10000000
+#define RECONNECT_USEC 5000000
+#define BUF_SIZE 8192
+#define SB_MAX 16
+/* How long TIOCMIWAIT waits before giving the caller a chance to look around. */
+#define MIWAIT_USEC 250000
+
+enum {
+    TN_DATA = 0,
+    TN_IAC,
+    TN_OPT,
+    TN_SB,
+    TN_SB_IAC
+};
+
+typedef struct remote_s {
+    char target[128];
+    unsigned int rate;
+    /* The modem code's end of the pty, and ours. */
+    int fd;
+    int master;
+    int sock;
+    int wakeFd;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    bool running;
+    /* The server said DO COM-PORT-OPTION. */
+    bool comPort;
+    int modemState;
+    /* Counted like the serial drivers do, for TIOCGICOUNT. Signalled on every change, for TIOCMIWAIT. */
+    uint32_t dcdCount;
+    uint32_t dsrCount;
+    uint32_t ctsCount;
+    uint32_t rngCount;
+    pthread_cond_t changed;
+    bool dtr;
+    bool rts;
+    /* The server wants us to stop sending for a bit. */
+    bool suspended;
+    /* Telnet state, and which options are on each way. */
+    int telnetState;
+    uint8_t telnetCmd;
+    uint8_t sb[SB_MAX];
+    int sbLen;
+    bool localOptions[256];
+    bool remoteOptions[256];
+    /* Escaped, for the server. Filled by both threads, so it's under lock. */
+    uint8_t sockOut[BUF_SIZE];
+    size_t sockLen;
+    /* For the modem code. */
+    uint8_t ptyOut[BUF_SIZE];
+    size_t ptyLen;
+    size_t ptyOff;
+    uint64_t rxBytes;
+    uint64_t txBytes;
+    struct remote_s *next;
+} remote_t;
+
+static remote_t *remotes = NULL;
+static pthread_mutex_t remotesLock = PTHREAD_MUTEX_INITIALIZER;
+
+bool rfc2217_is_remote(const char *path) {
+    return strncmp(path, RFC2217_PREFIX, strlen(RFC2217_PREFIX)) == 0;
+}
+
+/* Call with the lock held. Drops it if there's no room: the server's way behind, and it's only ever control stuff. */
+static void queue_raw(remote_t *remote, const uint8_t *buf, size_t len) {
+    if (remote->sockLen + len > BUF_SIZE) {
+        return;
+    }
+    memcpy(remote->sockOut + remote->sockLen, buf, len);
+    remote->sockLen += len;
+}
+
+static void queue_option(remote_t *remote, uint8_t cmd, uint8_t opt) {
+    uint8_t buf[3] = {IAC, cmd, opt};
+    queue_raw(remote, buf, sizeof(buf));
+}
+
+/* IAC SB COM-PORT-OPTION cmd value IAC SE, with any IACs in value doubled. */
+static void queue_command(remote_t *remote, uint8_t cmd, uint32_t value, int valueLen) {
+    uint8_t buf[4 + 2*4 + 2];
+    size_t len = 0;
+    buf[len++] = IAC;
+    buf[len++] = SB;
+    buf[len++] = OPT_COM_PORT;
+    buf[len++] = cmd;
+    for (int i = valueLen - 1; i >= 0; i--) {
+        uint8_t byte = value >> (i*8);
+        buf[len++] = byte;
+        if (byte == IAC) {
+            buf[len++] = IAC;
+        }
+    }
+    buf[len++] = IAC;
+    buf[len++] = SE;
+    queue_raw(remote, buf, len);
+    eventfd_write(remote->wakeFd, 1);
+}
+
+/* Everything the port needs to be told, every time we connect. */
+static void queue_setup(remote_t *remote) {
+    queue_option(remote, WILL, OPT_COM_PORT);
+    queue_option(remote, WILL, OPT_BINARY);
+    queue_option(remote, DO, OPT_BINARY);
+    queue_option(remote, WILL, OPT_SGA);
+    queue_option(remote, DO, OPT_SGA);
+    remote->localOptions[OPT_COM_PORT] = true;
+    remote->localOptions[OPT_BINARY] = true;
+    remote->remoteOptions[OPT_BINARY] = true;
+    remote->localOptions[OPT_SGA] = true;
+    remote->remoteOptions[OPT_SGA] = true;
+    queue_command(remote, CPC_SET_BAUDRATE, remote->rate, 4);
+    queue_command(remote, CPC_SET_DATASIZE, 8, 1);
+    queue_command(remote, CPC_SET_PARITY, PARITY_NONE, 1);
+    queue_command(remote, CPC_SET_STOPSIZE, STOPSIZE_1, 1);
+    queue_command(remote, CPC_SET_CONTROL, CONTROL_HARDWARE, 1);
+    queue_command(remote, CPC_SET_CONTROL, remote->dtr ? CONTROL_DTR_ON : CONTROL_DTR_OFF, 1);
+    queue_command(remote, CPC_SET_LINESTATE_MASK, 0, 1);
+    queue_command(remote, CPC_SET_MODEMSTATE_MASK, MS_CD | MS_RI | MS_DSR | MS_CTS, 1);
+}
+
+/* Only answer when something changes, so we never get into a loop with the server (RFC 1143). */
+static void got_option(remote_t *remote, uint8_t cmd, uint8_t opt) {
+    bool ours = opt == OPT_BINARY || opt == OPT_SGA || opt == OPT_COM_PORT;
+    bool theirs = opt == OPT_BINARY || opt == OPT_SGA;
+    if (cmd == DO && !remote->localOptions[opt]) {
+        remote->localOptions[opt] = ours;
+        queue_option(remote, ours ? WILL : WONT, opt);
+    } else if (cmd == DONT && remote->localOptions[opt]) {
+        remote->localOptions[opt] = false;
+        queue_option(remote, WONT, opt);
+    } else if (cmd == WILL && !remote->remoteOptions[opt]) {
+        remote->remoteOptions[opt] = theirs;
+        queue_option(remote, theirs ? DO : DONT, opt);
+    } else if (cmd == WONT && remote->remoteOptions[opt]) {
+        remote->remoteOptions[opt] = false;
+        queue_option(remote, DONT, opt);
+    }
+    if (opt == OPT_COM_PORT && (cmd == DO || cmd == DONT)) {
+        if (remote->comPort != (cmd == DO)) {
+            log_debug(NULL, "%s %s com port control.", remote->target, cmd == DO ? "does" : "doesn't do");
+        }
+        remote->comPort = cmd == DO;
+    }
+}
+
+/* Call with the lock held. */
+static void got_modemstate(remote_t *remote, int state) {
+    int changes = remote->modemState ^ state;
+    if (changes & MS_CD) {
+        log_debug(NULL, "%s: DCD %s.", remote->target, state & MS_CD ? "up" : "down");
+        remote->dcdCount++;
+    }
+    if (changes & MS_DSR) {
+        remote->dsrCount++;
+    }
+    if (changes & MS_CTS) {
+        remote->ctsCount++;
+    }
+    /* Some servers only send TERI, some only show RI going on and off. */
+    if ((state & MS_TERI) || ((remote->modemState & MS_RI) && !(state & MS_RI))) {
+        remote->rngCount++;
+    }
+    remote->modemState = state;
+    pthread_cond_broadcast(&remote->changed);
+}
+
+static void got_subnegotiation(remote_t *remote) {
+    if (remote->sbLen < 2 || remote->sb[0] != OPT_COM_PORT) {
+        return;
+    }
+    switch (remote->sb[1]) {
+        case CPC_SERVER + CPC_NOTIFY_MODEMSTATE:
+            if (remote->sbLen < 3) {
+                break;
+            }
+            got_modemstate(remote, remote->sb[2]);
+            break;
+        case CPC_SERVER + CPC_FLOWCONTROL_SUSPEND:
+            remote->suspended = true;
+            break;
+        case CPC_SERVER + CPC_FLOWCONTROL_RESUME:
+            remote->suspended = false;
+            break;
+        default:
+            /* Everything else is the server telling us what it set. */
+            break;
+    }
+}
+
+/* Pull the data out of what the server sent, and deal with the rest. Call with the lock held. */
+static void got_bytes(remote_t *remote, const uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        uint8_t c = buf[i];
+        switch (remote->telnetState) {
+            case TN_DATA:
+                if (c == IAC) {
+                    remote->telnetState = TN_IAC;
+                } else {
+                    remote->ptyOut[remote->ptyLen++] = c;
+                }
+                break;
+            case TN_IAC:
+                if (c == IAC) {
+                    remote->ptyOut[remote->ptyLen++] = c;
+                    remote->telnetState = TN_DATA;
+                } else if (c == WILL || c == WONT || c == DO || c == DONT) {
+                    remote->telnetCmd = c;
+                    remote->telnetState = TN_OPT;
+                } else if (c == SB) {
+                    remote->sbLen = 0;
+                    remote->telnetState = TN_SB;
+                } else {
+                    remote->telnetState = TN_DATA;
+                }
+                break;
+            case TN_OPT:
+                got_option(remote, remote->telnetCmd, c);
+                remote->telnetState = TN_DATA;
+                break;
+            case TN_SB:
+                if (c == IAC) {
+                    remote->telnetState = TN_SB_IAC;
+                } else if (remote->sbLen < SB_MAX) {
+                    remote->sb[remote->sbLen++] = c;
+                }
+                break;
+            case TN_SB_IAC:
+                if (c == SE) {
+                    got_subnegotiation(remote);
+                    remote->telnetState = TN_DATA;
+                } else {
+                    if (remote->sbLen < SB_MAX) {
+                        remote->sb[remote->sbLen++] = c;
+                    }
+                    remote->telnetState = TN_SB;
+                }
+                break;
+        }
+    }
+}
+
+static int connect_remote(remote_t *remote) {
+    struct addrinfo hints = {0};
+    struct addrinfo *addrs, *addr;
+    char host[128];
+    const char *target = remote->target;
+    const char *port = strrchr(target, ':');
+    int one = 1;
+    int sock = -1;
+    int res;
+    if (port == NULL || port - target >= sizeof(host)) {
+        return -1;
+    }
+    memcpy(host, target, port - target);
+    host[port - target] = 0;
+    port++;
+    /* [::1]:7001 */
+    if (host[0] == '[' && host[strlen(host) - 1] == ']') {
+        memmove(host, host + 1, strlen(host) - 2);
+        host[strlen(host) - 2] = 0;
+    }
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if ((res = getaddrinfo(host, port, &hints, &addrs)) != 0) {
+        log_warn(NULL, "Couldn't look up %s: %s", host, gai_strerror(res));
+        return -1;
+    }
+    for (addr = addrs; addr != NULL; addr = addr->ai_next) {
+        int err = 0;
+        socklen_t errLen = sizeof(err);
+        struct pollfd pfd;
+        if ((sock = socket(addr->ai_family, addr->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, addr->ai_protocol)) < 0) {
+            continue;
+        }
+        if (connect(sock, addr->ai_addr, addr->ai_addrlen) == 0) {
+            break;
+        }
+        pfd.fd = sock;
+        pfd.events = POLLOUT;
+        if (errno == EINPROGRESS && clock_poll(&pfd, 1, CONNECT_USEC) == 1 &&
+                getsockopt(sock, SOL_SOCKET, SO_ERROR, &err, &errLen) == 0 && err == 0) {
+            break;
+        }
+        close(sock);
+        sock = -1;
+    }
+    freeaddrinfo(addrs);
+    if (sock < 0) {
+        return -1;
+    }
+    /* AT commands are small and someone's waiting on each one. */
+    setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    setsockopt(sock, SOL_SOCKET, SO_KEEPALIVE, &one, sizeof(one));
+    pthread_mutex_lock(&remote->lock);
+    remote->sock = sock;
+    remote->telnetState = TN_DATA;
+    remote->comPort = false;
+    remote->suspended = false;
+    got_modemstate(remote, 0);
+    remote->sockLen = 0;
+    memset(remote->localOptions, 0, sizeof(remote->localOptions));
+    memset(remote->remoteOptions, 0, sizeof(remote->remoteOptions));
+    queue_setup(remote);
+    pthread_mutex_unlock(&remote->lock);
+    return 0;
+}
+
+static void disconnect_remote(remote_t *remote) {
+    pthread_mutex_lock(&remote->lock);
+    close(remote->sock);
+    remote->sock = -1;
+    remote->comPort = false;
+    got_modemstate(remote, 0);
+    pthread_mutex_unlock(&remote->lock);
+}
+
+/* Move whatever can go each way. Returns false if the connection's gone. */
+static bool move_bytes(remote_t *remote, struct pollfd *fds) {
+    uint8_t buf[BUF_SIZE/2];
+    ssize_t bytes;
+    bool ok = true;
+    pthread_mutex_lock(&remote->lock);
+    /* Only take more from the server once the modem code has what we've got, so TCP slows the server down. */
+    if ((fds[0].revents & (POLLIN | POLLHUP | POLLERR)) && remote->ptyLen == 0) {
+        bytes = read(remote->sock, buf, sizeof(buf));
+        if (bytes > 0) {
+            remote->rxBytes += bytes;
+            remote->ptyOff = 0;
+            got_bytes(remote, buf, bytes);
+        } else if (bytes == 0 || (errno != EAGAIN && errno != EINTR)) {
+            ok = false;
+        }
+    }
+    if (remote->ptyLen > 0) {
+        bytes = write(remote->master, remote->ptyOut + remote->ptyOff, remote->ptyLen - remote->ptyOff);
+        if (bytes > 0 && (remote->ptyOff += bytes) == remote->ptyLen) {
+            remote->ptyLen = 0;
+            remote->ptyOff = 0;
+        }
+    }
+    /* Half the room, since every byte might need doubling. */
+    if ((fds[1].revents & POLLIN) && !remote->suspended && remote->sockLen <= BUF_SIZE/2) {
+        bytes = read(remote->master, buf, (BUF_SIZE - remote->sockLen)/2);
+        for (ssize_t i = 0; i < bytes; i++) {
+            remote->sockOut[remote->sockLen++] = buf[i];
+            if (buf[i] == IAC) {
+                remote->sockOut[remote->sockLen++] = IAC;
+            }
+        }
+        if (bytes > 0) {
+            remote->txBytes += bytes;
+        }
+    }
+    if (remote->sockLen > 0) {
+        bytes = send(remote->sock, remote->sockOut, remote->sockLen, MSG_NOSIGNAL);
+        if (bytes > 0) {
+            memmove(remote->sockOut, remote->sockOut + bytes, remote->sockLen - bytes);
+            remote->sockLen -= bytes;
+        } else if (bytes < 0 && errno != EAGAIN && errno != EINTR) {
+            ok = false;
+        }
+    }
+    pthread_mutex_unlock(&remote->lock);
+    return ok;
+}
+
+static void *remote_thread(void *arg) {
+    remote_t *remote = arg;
+    uint64_t retryAt = 0;
+    while (__atomic_load_n(&remote->running, __ATOMIC_ACQUIRE)) {
+        struct pollfd fds[3] = {{remote->sock, 0, 0}, {remote->master, 0, 0}, {remote->wakeFd, POLLIN, 0}};
+        uint64_t now = clock_usec();
+        if (remote->sock < 0) {
+            if (now >= retryAt) {
+                if (connect_remote(remote) == 0) {
+                    log_info(NULL, "Connected to %s.", remote->target);
+                    continue;
+                }
+                retryAt = now + RECONNECT_USEC;
+            }
+            /* Nobody's listening, so throw away what the modem code sends rather than let it block. */
+            fds[1].events = POLLIN;
+            if (clock_poll(fds + 1, 2, retryAt - now) > 0 && (fds[1].revents & POLLIN)) {
+                uint8_t buf[BUF_SIZE];
+                if (read(remote->master, buf, sizeof(buf)) < 0) {
+                    log_debug(NULL, "Couldn't read the pty for %s: %s", remote->target, strerror(errno));
+                }
+            }
+            if (fds[2].revents & POLLIN) {
+                eventfd_t count;
+                eventfd_read(remote->wakeFd, &count);
+            }
+            continue;
+        }
+        pthread_mutex_lock(&remote->lock);
+        fds[0].events = (remote->ptyLen == 0 ? POLLIN : 0) | (remote->sockLen > 0 ? POLLOUT : 0);
+        fds[1].events = (!remote->suspended && remote->sockLen <= BUF_SIZE/2 ? POLLIN : 0) | (remote->ptyLen > 0 ? POLLOUT : 0);
+        pthread_mutex_unlock(&remote->lock);
+        if (clock_poll(fds, 3, 1000000) < 0 && errno != EINTR) {
+            log_error(NULL, "poll failed: %s", strerror(errno));
+            break;
+        }
+        if (fds[2].revents & POLLIN) {
+            eventfd_t count;
+            eventfd_read(remote->wakeFd, &count);
+        }
+        if (!move_bytes(remote, fds)) {
+            log_warn(NULL, "Lost the connection to %s. Trying again in %d seconds.", remote->target, RECONNECT_USEC/1000000);
+            disconnect_remote(remote);
+            retryAt = clock_usec() + RECONNECT_USEC;
+        }
+    }
+    return NULL;
+}
+
+int rfc2217_open(const char *path, unsigned int rate, char *ttyPath, int ttyPathSize) {
+    remote_t *remote = calloc(1, sizeof(remote_t));
+    struct termios tty;
+    if (remote == NULL) {
+        return -1;
+    }
+    snprintf(remote->target, sizeof(remote->target), "%s", path + strlen(RFC2217_PREFIX));
+    remote->rate = rate;
+    remote->sock = -1;
+    remote->fd = -1;
+    remote->master = -1;
+    remote->wakeFd = -1;
+    remote->dtr = true;
+    remote->rts = true;
+    pthread_mutex_init(&remote->lock, NULL);
+    pthread_cond_init(&remote->changed, NULL);
+    if ((remote->master = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC)) < 0 ||
+            grantpt(remote->master) != 0 || unlockpt(remote->master) != 0 ||
+            ptsname_r(remote->master, ttyPath, ttyPathSize) != 0 ||
+            (remote->fd = open(ttyPath, O_RDWR | O_NOCTTY)) < 0 ||
+            (remote->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0) {
+        goto fail;
+    }
+    /* Raw from the start, so nothing we pass along gets echoed back. */
+    tcgetattr(remote->fd, &tty);
+    cfmakeraw(&tty);
+    tcsetattr(remote->fd, TCSANOW, &tty);
+    /* Don't start without the server, so a bad address shows up right away. */
+    if (connect_remote(remote) != 0) {
+        log_error(NULL, "Couldn't connect to %s: %s", remote->target, strerror(errno));
+        goto fail;
+    }
+    remote->running = true;
+    if (pthread_create(&remote->thread, NULL, remote_thread, remote) != 0) {
+        close(remote->sock);
+        goto fail;
+    }
+    pthread_mutex_lock(&remotesLock);
+    remote->next = remotes;
+    remotes = remote;
+    pthread_mutex_unlock(&remotesLock);
+    log_debug(NULL, "%s is on %s.", remote->target, ttyPath);
+    return remote->fd;
+
+fail:
+    if (remote->fd >= 0) {
+        close(remote->fd);
+    }
+    if (remote->master >= 0) {
+        close(remote->master);
+    }
+    if (remote->wakeFd >= 0) {
+        close(remote->wakeFd);
+    }
+    pthread_mutex_destroy(&remote->lock);
+    pthread_cond_destroy(&remote->changed);
+    free(remote);
+    return -1;
+}
+
+void rfc2217_close(int fd) {
+    remote_t *remote = NULL;
+    pthread_mutex_lock(&remotesLock);
+    for (remote_t **p = &remotes; *p != NULL; p = &(*p)->next) {
+        if ((*p)->fd == fd) {
+            remote = *p;
+            *p = remote->next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&remotesLock);
+    close(fd);
+    if (remote == NULL) {
+        return;
+    }
+    __atomic_store_n(&remote->running, false, __ATOMIC_RELEASE);
+    eventfd_write(remote->wakeFd, 1);
+    pthread_mutex_lock(&remote->lock);
+    pthread_cond_broadcast(&remote->changed);
+    pthread_mutex_unlock(&remote->lock);
+    pthread_join(remote->thread, NULL);
+    if (remote->sock >= 0) {
+        close(remote->sock);
+    }
+    close(remote->master);
+    close(remote->wakeFd);
+    pthread_mutex_destroy(&remote->lock);
+    pthread_cond_destroy(&remote->changed);
+    free(remote);
+}
+
+static int line_bits(const remote_t *remote) {
+    return (remote->dtr ? TIOCM_DTR : 0) | (remote->rts ? TIOCM_RTS : 0) |
+        (remote->modemState & MS_CD ? TIOCM_CD : 0) | (remote->modemState & MS_RI ? TIOCM_RI : 0) |
+        (remote->modemState & MS_DSR ? TIOCM_DSR : 0) | (remote->modemState & MS_CTS ? TIOCM_CTS : 0);
+}
+
+/*
+ * Wait for one of the lines in mask to change, with the lock held. A signal
+ * can't get us out of the wait, so it comes back with EINTR every MIWAIT_USEC
+ * and the caller can check whether it should stop.
+ */
+static int wait_lines(remote_t *remote, int mask) {
+    uint32_t dcd = remote->dcdCount;
+    uint32_t dsr = remote->dsrCount;
+    uint32_t cts = remote->ctsCount;
+    uint32_t rng = remote->rngCount;
+    struct timespec at;
+    clock_gettime(CLOCK_REALTIME, &at);
+    at.tv_nsec += MIWAIT_USEC*1000;
+    if (at.tv_nsec >= 1000000000) {
+        at.tv_sec++;
+        at.tv_nsec -= 1000000000;
+    }
+    while (!((mask & TIOCM_CD) && dcd != remote->dcdCount) && !((mask & TIOCM_DSR) && dsr != remote->dsrCount) &&
+            !((mask & TIOCM_CTS) && cts != remote->ctsCount) && !((mask & TIOCM_RNG) && rng != remote->rngCount)) {
+        /* Connected but no com port control, so nothing's ever going to change. */
+        if (remote->sock >= 0 && !remote->comPort) {
+            errno = ENOTTY;
+            return -1;
+        }
+        if (pthread_cond_timedwait(&remote->changed, &remote->lock, &at) == ETIMEDOUT) {
+            errno = EINTR;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int rfc2217_ioctl(int fd, unsigned long request, void *arg) {
+    remote_t *remote;
+    int *bits = arg;
+    int res;
+    pthread_mutex_lock(&remotesLock);
+    for (remote = remotes; remote != NULL && remote->fd != fd; remote = remote->next);
+    if (remote == NULL || (request != TIOCMGET && request != TIOCMBIS && request != TIOCMBIC && request != TIOCGICOUNT && request != TIOCMIWAIT)) {
+        pthread_mutex_unlock(&remotesLock);
+        return ioctl(fd, request, arg);
+    }
+    pthread_mutex_lock(&remote->lock);
+    pthread_mutex_unlock(&remotesLock);
+    if (request == TIOCGICOUNT) {
+        struct serial_icounter_struct *counts = arg;
+        memset(counts, 0, sizeof(*counts));
+        counts->rx = remote->rxBytes;
+        counts->tx = remote->txBytes;
+        counts->dcd = remote->dcdCount;
+        counts->dsr = remote->dsrCount;
+        counts->cts = remote->ctsCount;
+        counts->rng = remote->rngCount;
+        pthread_mutex_unlock(&remote->lock);
+        return 0;
+    }
+    if (request == TIOCMIWAIT) {
+        res = wait_lines(remote, (int)(uintptr_t)arg);
+        pthread_mutex_unlock(&remote->lock);
+        return res;
+    }
+    /* Without com port control it's a plain telnet port, with no modem lines, same as a pty. */
+    if (!remote->comPort) {
+        pthread_mutex_unlock(&remote->lock);
+        errno = ENOTTY;
+        return -1;
+    }
+    if (request == TIOCMGET) {
+        *bits = line_bits(remote);
+    } else {
+        bool on = request == TIOCMBIS;
+        if (*bits & TIOCM_DTR) {
+            remote->dtr = on;
+            queue_command(remote, CPC_SET_CONTROL, on ? CONTROL_DTR_ON : CONTROL_DTR_OFF, 1);
+        }
+        if (*bits & TIOCM_RTS) {
+            remote->rts = on;
+            queue_command(remote, CPC_SET_CONTROL, on ? CONTROL_RTS_ON : CONTROL_RTS_OFF, 1);
+        }
+    }
+    pthread_mutex_unlock(&remote->lock);
+    return 0;
+}
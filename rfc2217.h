@@ -0,0 +1,35 @@
+#ifndef RFC2217_H
+#define RFC2217_H
+#include <stdbool.h>
+
+/*
+ * Modems on a terminal server, through its RFC 2217 (telnet Com Port Control)
+ * ports. Give -m rfc2217://host:port instead of a TTY.
+ *
+ * Everything else in dialin wants a TTY, so each remote port gets a pty: the
+ * modem code has the slave end and a thread per port moves bytes between the
+ * master end and the server, escaping them for telnet. The thread sets the
+ * port up (speed, 8N1, RTS/CTS) whenever it connects, asks to hear about
+ * modem state changes and stops reading from the pty when the server says
+ * it can't keep up, so a slow line pushes back all the way to the modem code.
+ * If the connection drops it keeps trying to get it back.
+ *
+ * A pty has no modem lines, so DTR, DCD, waiting on them and the byte counts
+ * go through rfc2217_ioctl instead.
+ */
+
+#define RFC2217_PREFIX "rfc2217://"
+
+bool rfc2217_is_remote(const char *path);
+/* Connect to the port and set it up. Returns the pty for the modem code, or -1. */
+int rfc2217_open(const char *path, unsigned int rate, char *ttyPath, int ttyPathSize);
+void rfc2217_close(int fd);
+/*
+ * ioctl() that does TIOCMGET, TIOCMBIS, TIOCMBIC, TIOCMIWAIT and TIOCGICOUNT
+ * for remote ports (DTR and RTS get sent to the server, the rest comes from
+ * what it last told us). TIOCMIWAIT gives up with EINTR every quarter second, so
+ * call it in a loop. Anything else, and any other fd, goes to ioctl().
+ */
+int rfc2217_ioctl(int fd, unsigned long request, void *arg);
+
+#endif
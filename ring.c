@@ -0,0 +1,89 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ring.h"
+
+/* Every slot starts with this. seq tells us who owns the slot for a given lap around the ring. */
+typedef struct {
+    _Atomic size_t seq;
+    size_t pos;
+} slot_hdr_t;
+
+#define SLOT_HDR_SIZE ((sizeof(slot_hdr_t) + 15) & ~(size_t)15)
+
+static slot_hdr_t *get_slot(ring_t *ring, size_t pos) {
+    return (slot_hdr_t*)(ring->slots + (pos & ring->mask)*ring->slotSize);
+}
+
+int ring_init(ring_t *ring, size_t numSlots, size_t payloadSize) {
+    if (numSlots == 0 || (numSlots & (numSlots - 1)) != 0) {
+        return -1;
+    }
+    ring->mask = numSlots - 1;
+    ring->slotSize = (SLOT_HDR_SIZE + payloadSize + 15) & ~(size_t)15;
+    ring->slots = aligned_alloc(64, ((numSlots*ring->slotSize) + 63) & ~(size_t)63);
+    if (ring->slots == NULL) {
+        return -2;
+    }
+    memset(ring->slots, 0, numSlots*ring->slotSize);
+    for (size_t i = 0; i < numSlots; i++) {
+        atomic_init(&get_slot(ring, i)->seq, i);
+    }
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->dropped, 0);
+    return 0;
+}
+
+void ring_free(ring_t *ring) {
+    free(ring->slots);
+    ring->slots = NULL;
+}
+
+void *ring_claim(ring_t *ring) {
+    size_t pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    while (true) {
+        slot_hdr_t *slot = get_slot(ring, pos);
+        size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            /* The slot is free for this lap. Try to take it. */
+            if (atomic_compare_exchange_weak_explicit(&ring->head, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                slot->pos = pos;
+                return (unsigned char*)slot + SLOT_HDR_SIZE;
+            }
+        } else if (diff < 0) {
+            /* The consumer hasn't caught up. Don't wait for it. */
+            atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+            return NULL;
+        } else {
+            pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+        }
+    }
+}
+
+void ring_publish(ring_t *ring, void *payload) {
+    slot_hdr_t *slot = (slot_hdr_t*)((unsigned char*)payload - SLOT_HDR_SIZE);
+    (void)ring;
+    atomic_store_explicit(&slot->seq, slot->pos + 1, memory_order_release);
+}
+
+void *ring_peek(ring_t *ring) {
+    size_t pos = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    slot_hdr_t *slot = get_slot(ring, pos);
+    if (atomic_load_explicit(&slot->seq, memory_order_acquire) != pos + 1) {
+        return NULL;
+    }
+    return (unsigned char*)slot + SLOT_HDR_SIZE;
+}
+
+void ring_release(ring_t *ring) {
+    size_t pos = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    slot_hdr_t *slot = get_slot(ring, pos);
+    atomic_store_explicit(&slot->seq, pos + ring->mask + 1, memory_order_release);
+    atomic_store_explicit(&ring->tail, pos + 1, memory_order_relaxed);
+}
+
+uint64_t ring_dropped(ring_t *ring) {
+    return atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+}
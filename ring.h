@@ -0,0 +1,35 @@
+#ifndef RING_H
+#define RING_H
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+/*
+ * Bounded lock-free queue of fixed size slots.
+ * Any number of threads can produce, one thread consumes.
+ * Producers never wait: if the ring is full the record is dropped and counted.
+ */
+typedef struct {
+    size_t mask;
+    size_t slotSize;
+    unsigned char *slots;
+    _Atomic size_t head;
+    _Atomic size_t tail;
+    _Atomic uint64_t dropped;
+} ring_t;
+
+/* numSlots must be a power of 2. */
+int ring_init(ring_t *ring, size_t numSlots, size_t payloadSize);
+void ring_free(ring_t *ring);
+
+/* Producer side. Claim a slot, fill it in, then publish it. Returns NULL if the ring is full. */
+void *ring_claim(ring_t *ring);
+void ring_publish(ring_t *ring, void *payload);
+
+/* Consumer side. Peek at the oldest published slot, then release it once done. */
+void *ring_peek(ring_t *ring);
+void ring_release(ring_t *ring);
+
+uint64_t ring_dropped(ring_t *ring);
+
+#endif
@@ -0,0 +1,309 @@
+#include <poll.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/ioctl.h>
+#include <sys/eventfd.h>
+#include <linux/if_tun.h>
+#include <linux/if_slip.h>
+#include <linux/sockios.h>
+#include "log.h"
+#include "clock.h"
+#include "netlink.h"
+#include "slip.h"
+#include "rfc2217.h"
+#include "linewatch.h"
+
+/* RFC 1055. */
+#define END 0300
+#define ESC 0333
+#define ESC_END 0334
+#define ESC_ESC 0335
+
+#define MAX_MTU 1500
+#define TX_SIZE 32768
+#define TTY_READ_SIZE 4096
+#define TUN_BATCH 32
+/* How often we look at DCD and for a close request. There's nothing else to wake up for. */
+#define CHECK_USEC 250000
+
+static int mtu(slip_t *slip) {
+    return slip->config->mru < MAX_MTU ? slip->config->mru : MAX_MTU;
+}
+
+static void flush_tx(slip_t *slip) {
+    while (slip->txOff < slip->txLen) {
+        ssize_t bytes = write(slip->ttyFd, slip->txBuf + slip->txOff, slip->txLen - slip->txOff);
+        if (bytes <= 0) {
+            if (bytes < 0 && errno != EAGAIN && errno != EINTR) {
+                log_debug(slip->tag, "Write failed: %s", strerror(errno));
+                slip->txOff = slip->txLen;
+            }
+            break;
+        }
+        slip->txOff += bytes;
+    }
+    if (slip->txOff == slip->txLen) {
+        slip->txOff = 0;
+        slip->txLen = 0;
+    }
+}
+
+static bool tx_room(slip_t *slip) {
+    return slip->txLen + 2*mtu(slip) + 2 <= TX_SIZE;
+}
+
+/* END first as well as last flushes out any line noise in front of the packet. */
+static void queue_packet(slip_t *slip, const uint8_t *packet, size_t len) {
+    uint8_t *p = slip->txBuf + slip->txLen;
+    *p++ = END;
+    for (size_t i = 0; i < len; i++) {
+        if (packet[i] == END) {
+            *p++ = ESC;
+            *p++ = ESC_END;
+        } else if (packet[i] == ESC) {
+            *p++ = ESC;
+            *p++ = ESC_ESC;
+        } else {
+            *p++ = packet[i];
+        }
+    }
+    *p++ = END;
+    slip->txLen = p - slip->txBuf;
+}
+
+static void decode(slip_t *slip, const uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        uint8_t c = buf[i];
+        if (c == END) {
+            /* Back to back ENDs are just idle. The TUN only wants IPv4, same as we told it. */
+            if (slip->rxLen > 0 && !slip->rxDiscard && (slip->rxBuf[0] >> 4) == 4 &&
+                    write(slip->tunFd, slip->rxBuf, slip->rxLen) < 0) {
+                log_debug(slip->tag, "Couldn't pass a packet to %s: %s", slip->ifname, strerror(errno));
+            }
+            slip->rxLen = 0;
+            slip->rxEscaped = false;
+            slip->rxDiscard = false;
+            continue;
+        }
+        if (c == ESC) {
+            slip->rxEscaped = true;
+            continue;
+        }
+        if (slip->rxEscaped) {
+            /* Anything else after an ESC is left alone, as RFC 1055 says. */
+            c = c == ESC_END ? END : c == ESC_ESC ? ESC : c;
+            slip->rxEscaped = false;
+        }
+        if (slip->rxLen < mtu(slip)) {
+            slip->rxBuf[slip->rxLen++] = c;
+        } else {
+            slip->rxDiscard = true;
+        }
+    }
+}
+
+void slip_init(slip_t *slip, const ppp_config_t *config, const char *tag, int index, bool compressed) {
+    memset(slip, 0, sizeof(*slip));
+    slip->config = config;
+    slip->tag = tag;
+    slip->ttyFd = -1;
+    slip->oldDisc = -1;
+    slip->tunFd = -1;
+    slip->statusFd = -1;
+    slip->compressed = compressed;
+    slip->remote.s_addr = htonl(ntohl(config->remote.s_addr) + index);
+}
+
+/* Let the kernel do it. It makes an slN interface for the line. */
+static int attach_kernel(slip_t *slip) {
+    int disc = N_SLIP;
+    int encap = slip->compressed ? SL_MODE_CSLIP : SL_MODE_SLIP;
+    if (ioctl(slip->ttyFd, TIOCGETD, &slip->oldDisc) < 0 || ioctl(slip->ttyFd, TIOCSETD, &disc) < 0) {
+        slip->oldDisc = -1;
+        return -1;
+    }
+    if (ioctl(slip->ttyFd, SIOCSIFENCAP, &encap) < 0) {
+        return -2;
+    }
+    if (ioctl(slip->ttyFd, SIOCGIFNAME, slip->ifname) < 0) {
+        return -3;
+    }
+    slip->ifname[sizeof(slip->ifname) - 1] = 0;
+    log_debug(slip->tag, "Attached to %s.", slip->ifname);
+    return 0;
+}
+
+static int attach_user(slip_t *slip) {
+    struct ifreq ifr;
+    if (slip->compressed) {
+        /* We'd have to do Van Jacobson compression ourselves. */
+        return -5;
+    }
+    if ((slip->tunFd = open("/dev/net/tun", O_RDWR | O_CLOEXEC | O_NONBLOCK)) < 0) {
+        return -6;
+    }
+    memset(&ifr, 0, sizeof(ifr));
+    ifr.ifr_flags = IFF_TUN | IFF_NO_PI;
+    strcpy(ifr.ifr_name, "dialin%d");
+    if (ioctl(slip->tunFd, TUNSETIFF, &ifr) < 0) {
+        return -7;
+    }
+    slip->rxBuf = malloc(MAX_MTU);
+    slip->txBuf = malloc(TX_SIZE);
+    if (slip->rxBuf == NULL || slip->txBuf == NULL) {
+        return -8;
+    }
+    slip->rxLen = 0;
+    slip->txLen = 0;
+    slip->txOff = 0;
+    slip->ttyFlags = fcntl(slip->ttyFd, F_GETFL);
+    fcntl(slip->ttyFd, F_SETFL, slip->ttyFlags | O_NONBLOCK);
+    slip->userFraming = true;
+    memcpy(slip->ifname, ifr.ifr_name, sizeof(slip->ifname));
+    slip->ifname[sizeof(slip->ifname) - 1] = 0;
+    log_debug(slip->tag, "Framing SLIP ourselves through %s.", slip->ifname);
+    return 0;
+}
+
+int slip_attach(slip_t *slip, int ttyFd) {
+    int res = -1;
+    slip->ttyFd = ttyFd;
+    if (slip->config->framing != PPP_FRAMING_USER) {
+        res = attach_kernel(slip);
+        if (res != 0 && slip->config->framing != PPP_FRAMING_KERNEL) {
+            log_debug(slip->tag, "The kernel can't do SLIP here (%d: %s). Doing the framing ourselves.", res, strerror(errno));
+            slip_detach(slip);
+            slip->ttyFd = ttyFd;
+            res = attach_user(slip);
+        }
+    } else {
+        res = attach_user(slip);
+    }
+    if (res != 0) {
+        return res;
+    }
+    /* No IPCP, so the addresses are just whatever the caller was told to use. */
+    if (!netif_up(slip->ifname, slip->config->local, slip->remote, mtu(slip))) {
+        log_warn(slip->tag, "Couldn't set up %s: %s", slip->ifname, strerror(errno));
+        return -4;
+    }
+    log_info(slip->tag, "%s up on %s. Peer is %s.", slip->compressed ? "CSLIP" : "SLIP", slip->ifname, inet_ntoa(slip->remote));
+    return 0;
+}
+
+static void user_io(slip_t *slip, struct pollfd *fds, int *exitCode) {
+    if (fds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+        uint8_t buf[TTY_READ_SIZE];
+        ssize_t bytes = read(slip->ttyFd, buf, sizeof(buf));
+        if (bytes > 0) {
+            decode(slip, buf, bytes);
+        } else if (bytes == 0 || errno == EIO) {
+            *exitCode = SLIP_EXIT_HANGUP;
+            return;
+        }
+    }
+    if (fds[1].revents & POLLIN) {
+        uint8_t packet[MAX_MTU];
+        for (int i = 0; i < TUN_BATCH && tx_room(slip); i++) {
+            ssize_t bytes = read(slip->tunFd, packet, sizeof(packet));
+            if (bytes <= 0) {
+                break;
+            }
+            /* SLIP can only carry IPv4. */
+            if ((packet[0] >> 4) == 4) {
+                queue_packet(slip, packet, bytes);
+            }
+        }
+    }
+    if (slip->txLen > 0) {
+        flush_tx(slip);
+    }
+}
+
+/* Same as pppd's modem option: once we've seen DCD, losing it is a hangup. */
+static bool carrier_lost(slip_t *slip) {
+    int bits;
+    slip->carrierTimer = clock_usec() + (slip->statusFd >= 0 ? LINEWATCH_CHECK_USEC : 1000000);
+    if (rfc2217_ioctl(slip->ttyFd, TIOCMGET, &bits) < 0) {
+        return false;
+    }
+    if (bits & TIOCM_CD) {
+        slip->carrierSeen = true;
+        return false;
+    }
+    return slip->carrierSeen;
+}
+
+int slip_run(slip_t *slip) {
+    int exitCode = -1;
+    slip->carrierTimer = clock_usec();
+    while (exitCode < 0) {
+        struct pollfd fds[3] = {{slip->ttyFd, 0, 0}, {slip->tunFd, 0, 0}, {slip->statusFd, POLLIN, 0}};
+        uint64_t now = clock_usec();
+        uint64_t wait = slip->carrierTimer > now ? slip->carrierTimer - now : 0;
+        if (__atomic_exchange_n(&slip->closeRequest, 0, __ATOMIC_ACQ_REL)) {
+            exitCode = SLIP_EXIT_USER_REQUEST;
+            break;
+        }
+        if (slip->userFraming) {
+            /* Only take packets from the TUN when the line can keep up. */
+            fds[0].events = POLLIN | (slip->txLen > 0 ? POLLOUT : 0);
+            fds[1].events = tx_room(slip) ? POLLIN : 0;
+        }
+        /* With N_SLIP on it, the TTY only wakes us up when it's hung up. */
+        if (clock_poll(fds, 3, wait < CHECK_USEC ? wait : CHECK_USEC) < 0 && errno != EINTR) {
+            log_error(slip->tag, "poll failed: %s", strerror(errno));
+            exitCode = SLIP_EXIT_FATAL_ERROR;
+            break;
+        }
+        if (fds[2].revents & POLLIN) {
+            eventfd_t count;
+            eventfd_read(slip->statusFd, &count);
+            slip->carrierTimer = 0;
+        }
+        if (slip->userFraming) {
+            user_io(slip, fds, &exitCode);
+        } else if (fds[0].revents & (POLLHUP | POLLERR)) {
+            exitCode = SLIP_EXIT_HANGUP;
+        }
+        if (exitCode < 0 && clock_usec() >= slip->carrierTimer && carrier_lost(slip)) {
+            exitCode = SLIP_EXIT_HANGUP;
+        }
+    }
+    if (exitCode == SLIP_EXIT_HANGUP) {
+        log_info(slip->tag, "The line hung up.");
+    }
+    return exitCode;
+}
+
+void slip_close(slip_t *slip) {
+    __atomic_store_n(&slip->closeRequest, 1, __ATOMIC_RELEASE);
+}
+
+void slip_detach(slip_t *slip) {
+    if (slip->ifname[0] != 0) {
+        netif_down(slip->ifname);
+        slip->ifname[0] = 0;
+    }
+    if (slip->oldDisc >= 0) {
+        /* Taking N_SLIP off takes slN with it. */
+        ioctl(slip->ttyFd, TIOCSETD, &slip->oldDisc);
+        slip->oldDisc = -1;
+    }
+    if (slip->tunFd >= 0) {
+        close(slip->tunFd);
+        slip->tunFd = -1;
+    }
+    if (slip->userFraming) {
+        fcntl(slip->ttyFd, F_SETFL, slip->ttyFlags);
+        slip->userFraming = false;
+    }
+    free(slip->rxBuf);
+    free(slip->txBuf);
+    slip->rxBuf = NULL;
+    slip->txBuf = NULL;
+}
@@ -0,0 +1,64 @@
+#ifndef SLIP_H
+#define SLIP_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include "ppp.h"
+
+/*
+ * SLIP (RFC 1055) and CSLIP for callers that don't speak PPP. The TTY gets the
+ * kernel's N_SLIP line discipline and we set up the slN interface it makes
+ * over netlink, so there's no slattach and the packets never come up to us.
+ * There's nothing to negotiate, so all we do after that is watch for the
+ * call to end.
+ *
+ * Like PPP, where there's no N_SLIP we do the framing ourselves through a
+ * TUN device, but only plain SLIP: CSLIP needs the kernel.
+ *
+ * The addresses, MTU (mru) and framing come from the PPP config.
+ */
+
+/* Same numbers as pppd's, so call records read the same. */
+#define SLIP_EXIT_OK 0
+#define SLIP_EXIT_FATAL_ERROR 1
+#define SLIP_EXIT_USER_REQUEST 5
+#define SLIP_EXIT_HANGUP 16
+
+typedef struct {
+    const ppp_config_t *config;
+    const char *tag;
+    int ttyFd;
+    int oldDisc;
+    bool compressed;
+    struct in_addr remote;
+    char ifname[IFNAMSIZ];
+    /* Framing it ourselves through tunFd. */
+    bool userFraming;
+    int tunFd;
+    int ttyFlags;
+    uint8_t *rxBuf;
+    size_t rxLen;
+    bool rxEscaped;
+    bool rxDiscard;
+    uint8_t *txBuf;
+    size_t txLen;
+    size_t txOff;
+    bool carrierSeen;
+    uint64_t carrierTimer;
+    /* The line watcher's eventFd, or -1. Readable means look at DCD now. */
+    int statusFd;
+    int closeRequest;
+} slip_t;
+
+/* Line index picks the remote address, same as PPP. */
+void slip_init(slip_t *slip, const ppp_config_t *config, const char *tag, int index, bool compressed);
+/* Put the line into SLIP and bring the interface up. 0 if it worked. */
+int slip_attach(slip_t *slip, int ttyFd);
+/* Run until the call ends. Returns a SLIP_EXIT code. */
+int slip_run(slip_t *slip);
+/* Ask it to stop. Safe to call from another thread. */
+void slip_close(slip_t *slip);
+void slip_detach(slip_t *slip);
+
+#endif
@@ -0,0 +1,469 @@
+/* Microbenchmarks for the code every line runs all the time.
+ * Build: cc -O2 -pthread -I. -o bench tools/bench.c voice.c at.c hdlc.c linetest.c audio.c assets.c -lm */
+
+#include <math.h>
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include "voice.h"
+#include "at.h"
+#include "hdlc.h"
+#include "linetest.h"
+#include "audio.h"
+#include "assets.h"
+
+typedef struct {
+    const char *name;
+    /* Do iters operations. Returns the bytes processed, or 0 if bytes/s doesn't mean anything. */
+    uint64_t (*run)(uint64_t iters);
+} bench_t;
+
+/* Results go here so the compiler can't throw the work away. */
+static volatile uint64_t sink;
+
+/* The dialtone, unpacked like dialin does it. */
+static uint8_t *dialtone;
+static int dialtoneLen;
+static uint8_t dataBuf[4096];
+static uint8_t dleBuf[4096];
+static int16_t pcmBuf[4096];
+static uint8_t outBuf[65536];
+/* Full size IP packets, and the same framed up. */
+static uint8_t ipBuf[1500];
+static uint8_t frameBuf[HDLC_MAX_ENCODED(1504)];
+static size_t frameLen;
+static const uint8_t pppHeader[4] = {0xff, 0x03, 0x00, 0x21};
+
+static uint64_t nsec_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+/* What send_voice() does every 50ms tick, minus the write. */
+static uint64_t bench_dialtone_tick(uint64_t iters) {
+    /* Ticks are never exactly 50ms apart. */
+    static const int64_t ticks[8] = {50012, 50240, 49980, 51003, 50007, 50110, 52000, 50001};
+    int pos = 0;
+    uint64_t bytes = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        struct iovec iov[8];
+        int due = voice_samples_due(ticks[i & 7], 8001);
+        int numIov = voice_chunks(dialtone, dialtoneLen, &pos, due, iov, 8);
+        size_t used = 0;
+        for (int j = 0; j < numIov; j++) {
+            memcpy(outBuf + used, iov[j].iov_base, iov[j].iov_len);
+            used += iov[j].iov_len;
+        }
+        bytes += used;
+    }
+    sink = pos;
+    return bytes;
+}
+
+/* The 1s burst at the start of dialtone, from a buffer holding one 100ms period, so it wraps a lot. */
+static uint64_t bench_dialtone_wrap(uint64_t iters) {
+    int pos = 0;
+    uint64_t bytes = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        struct iovec iov[16];
+        int due = 8001;
+        while (due > 0) {
+            int numIov = voice_chunks(dialtone, 800, &pos, due, iov, 16);
+            for (int j = 0; j < numIov; j++) {
+                due -= iov[j].iov_len;
+                bytes += iov[j].iov_len;
+            }
+        }
+    }
+    sink = pos;
+    return bytes;
+}
+
+static const char *responses[] = {"0\r", "18\r", "\r\n84\r\n", "3\r", "NO DIALTONE\r\n", "1\r"};
+#define NUM_RESPONSES (sizeof(responses)/sizeof(responses[0]))
+
+static uint64_t bench_parse_result(uint64_t iters) {
+    size_t lens[NUM_RESPONSES];
+    int64_t sum = 0;
+    for (size_t i = 0; i < NUM_RESPONSES; i++) {
+        lens[i] = strlen(responses[i]);
+    }
+    for (uint64_t i = 0; i < iters; i++) {
+        sum += at_parse_result(responses[i % NUM_RESPONSES], lens[i % NUM_RESPONSES]);
+    }
+    sink = sum;
+    return 0;
+}
+
+/* How get_response() used to do it, for comparison. */
+static uint64_t bench_parse_result_sscanf(uint64_t iters) {
+    int64_t sum = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        unsigned int res;
+        if (sscanf(responses[i % NUM_RESPONSES], "%u", &res) == 1) {
+            sum += res;
+        } else {
+            sum--;
+        }
+    }
+    sink = sum;
+    return 0;
+}
+
+static uint64_t bench_dle_scan_quiet(uint64_t iters) {
+    char events[64];
+    bool pending = false;
+    uint64_t found = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        found += dle_scan(&pending, (char*)dataBuf, sizeof(dataBuf), events, sizeof(events));
+    }
+    sink = found;
+    return iters*sizeof(dataBuf);
+}
+
+static uint64_t bench_dle_scan_events(uint64_t iters) {
+    char events[128];
+    bool pending = false;
+    uint64_t found = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        found += dle_scan(&pending, (char*)dleBuf, sizeof(dleBuf), events, sizeof(events));
+    }
+    sink = found;
+    return iters*sizeof(dleBuf);
+}
+
+/* 20ms of dial tone at a time. */
+static uint64_t bench_tone_u8(uint64_t iters) {
+    static const double freqs[2] = {350, 440};
+    tone_t tone;
+    tone_init(&tone, freqs, 2, 0.25, 8000);
+    for (uint64_t i = 0; i < iters; i++) {
+        tone_render_u8(&tone, outBuf, 160);
+    }
+    sink = outBuf[7];
+    return iters*160;
+}
+
+static uint64_t bench_u8_to_s16(uint64_t iters) {
+    for (uint64_t i = 0; i < iters; i++) {
+        pcm_u8_to_s16(dataBuf, pcmBuf, sizeof(dataBuf));
+    }
+    sink = pcmBuf[11];
+    return iters*sizeof(dataBuf);
+}
+
+static uint64_t bench_s16_to_u8(uint64_t iters) {
+    for (uint64_t i = 0; i < iters; i++) {
+        pcm_s16_to_u8(pcmBuf, outBuf, 4096);
+    }
+    sink = outBuf[11];
+    return iters*4096*sizeof(int16_t);
+}
+
+/* The line test's filters, all eight frequencies at once. */
+static uint64_t bench_goertzel(uint64_t iters) {
+    goertzel_bank_t bank;
+    goertzel_init(&bank);
+    for (uint64_t i = 0; i < iters; i++) {
+        goertzel_feed(&bank, pcmBuf, 4096);
+    }
+    sink = (uint64_t)bank.s1[3];
+    return iters*4096*sizeof(int16_t);
+}
+
+/* The same, one frequency at a time, for comparison. */
+static uint64_t bench_goertzel_scalar(uint64_t iters) {
+    float coeff[LINETEST_FREQS];
+    float out = 0;
+    for (int f = 0; f < LINETEST_FREQS; f++) {
+        coeff[f] = 2*cosf(2*(float)M_PI*linetestFreqs[f]/LINETEST_RATE);
+    }
+    for (uint64_t i = 0; i < iters; i++) {
+        for (int f = 0; f < LINETEST_FREQS; f++) {
+            float s1 = 0, s2 = 0;
+            for (int j = 0; j < 4096; j++) {
+                float s0 = coeff[f]*s1 - s2 + pcmBuf[j]/32768.0f;
+                s2 = s1;
+                s1 = s0;
+            }
+            out += s1;
+        }
+    }
+    sink = (uint64_t)out;
+    return iters*4096*sizeof(int16_t);
+}
+
+static uint64_t bench_ulaw_encode(uint64_t iters) {
+    for (uint64_t i = 0; i < iters; i++) {
+        audio_encode(pcmBuf, AUDIO_ULAW, outBuf, 4096);
+    }
+    sink = outBuf[7];
+    return iters*4096*sizeof(int16_t);
+}
+
+/* G.711 worked out for every sample instead of looked up, for comparison. */
+static uint64_t bench_ulaw_encode_direct(uint64_t iters) {
+    for (uint64_t i = 0; i < iters; i++) {
+        for (int j = 0; j < 4096; j++) {
+            int pcm = pcmBuf[j] >> 2;
+            int mask = 0xFF;
+            int seg = 0;
+            if (pcm < 0) {
+                pcm = -pcm;
+                mask = 0x7F;
+            }
+            pcm = (pcm > 8159 ? 8159 : pcm) + 0x21;
+            while (seg < 8 && pcm > (0x40 << seg) - 1) {
+                seg++;
+            }
+            outBuf[j] = (seg >= 8 ? 0x7F : (seg << 4) | ((pcm >> (seg + 1)) & 0x0F)) ^ mask;
+        }
+    }
+    sink = outBuf[7];
+    return iters*4096*sizeof(int16_t);
+}
+
+/* Converting half a second of audio for a modem at another rate, filter and all. */
+static uint64_t bench_resample(uint64_t iters, int rate) {
+    for (uint64_t i = 0; i < iters; i++) {
+        int16_t *out;
+        int count = audio_resample(pcmBuf, 4096, 8000, rate, &out);
+        sink = out[count/2];
+        free(out);
+    }
+    return iters*4096*sizeof(int16_t);
+}
+
+static uint64_t bench_resample_7200(uint64_t iters) {
+    return bench_resample(iters, 7200);
+}
+
+static uint64_t bench_resample_11025(uint64_t iters) {
+    return bench_resample(iters, 11025);
+}
+
+static uint64_t bench_fcs16(uint64_t iters) {
+    uint16_t fcs = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        fcs ^= fcs16(FCS16_INIT, ipBuf, sizeof(ipBuf));
+    }
+    sink = fcs;
+    return iters*sizeof(ipBuf);
+}
+
+/* A byte at a time, the way RFC 1662 does it, for comparison. */
+static uint64_t bench_fcs16_bytewise(uint64_t iters) {
+    static uint16_t table[256];
+    uint16_t out = 0;
+    for (int i = 0; i < 256; i++) {
+        uint16_t fcs = i;
+        for (int bit = 0; bit < 8; bit++) {
+            fcs = (fcs >> 1) ^ (fcs & 1 ? 0x8408 : 0);
+        }
+        table[i] = fcs;
+    }
+    for (uint64_t i = 0; i < iters; i++) {
+        uint16_t fcs = FCS16_INIT;
+        for (size_t j = 0; j < sizeof(ipBuf); j++) {
+            fcs = (fcs >> 8) ^ table[(fcs ^ ipBuf[j]) & 0xff];
+        }
+        out ^= fcs;
+    }
+    sink = out;
+    return iters*sizeof(ipBuf);
+}
+
+static uint64_t bench_fcs32(uint64_t iters) {
+    uint32_t fcs = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        fcs ^= fcs32(FCS32_INIT, ipBuf, sizeof(ipBuf));
+    }
+    sink = fcs;
+    return iters*sizeof(ipBuf);
+}
+
+/* What PPP usually ends up with: only flags and escapes get escaped. */
+static uint64_t bench_hdlc_encode(uint64_t iters) {
+    hdlc_tx_t tx = {0, false};
+    size_t len = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        len += hdlc_encode(&tx, pppHeader, sizeof(pppHeader), ipBuf, sizeof(ipBuf), outBuf);
+    }
+    sink = len;
+    return iters*sizeof(ipBuf);
+}
+
+/* Before LCP is done, or with a peer that wants every control character escaped. */
+static uint64_t bench_hdlc_encode_accm(uint64_t iters) {
+    hdlc_tx_t tx = {0xffffffff, false};
+    size_t len = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        len += hdlc_encode(&tx, pppHeader, sizeof(pppHeader), ipBuf, sizeof(ipBuf), outBuf);
+    }
+    sink = len;
+    return iters*sizeof(ipBuf);
+}
+
+static void count_frame(void *ctx, uint8_t *frame, size_t len) {
+    *(uint64_t*)ctx += len;
+}
+
+static uint64_t bench_hdlc_decode(uint64_t iters) {
+    hdlc_rx_t rx;
+    uint64_t got = 0;
+    hdlc_rx_init(&rx, outBuf, 2048);
+    for (uint64_t i = 0; i < iters; i++) {
+        hdlc_decode(&rx, frameBuf, frameLen, count_frame, &got);
+    }
+    sink = got;
+    return iters*sizeof(ipBuf);
+}
+
+static const bench_t benches[] = {
+    {"dialtone_tick", bench_dialtone_tick},
+    {"dialtone_wrap", bench_dialtone_wrap},
+    {"parse_result", bench_parse_result},
+    {"parse_result_sscanf", bench_parse_result_sscanf},
+    {"dle_scan_quiet", bench_dle_scan_quiet},
+    {"dle_scan_events", bench_dle_scan_events},
+    {"tone_u8", bench_tone_u8},
+    {"pcm_u8_to_s16", bench_u8_to_s16},
+    {"pcm_s16_to_u8", bench_s16_to_u8},
+    {"goertzel", bench_goertzel},
+    {"goertzel_scalar", bench_goertzel_scalar},
+    {"ulaw_encode", bench_ulaw_encode},
+    {"ulaw_encode_direct", bench_ulaw_encode_direct},
+    {"resample_7200", bench_resample_7200},
+    {"resample_11025", bench_resample_11025},
+    {"fcs16", bench_fcs16},
+    {"fcs16_bytewise", bench_fcs16_bytewise},
+    {"fcs32", bench_fcs32},
+    {"hdlc_encode", bench_hdlc_encode},
+    {"hdlc_encode_accm", bench_hdlc_encode_accm},
+    {"hdlc_decode", bench_hdlc_decode},
+};
+#define NUM_BENCHES (sizeof(benches)/sizeof(benches[0]))
+
+static int compare_doubles(const void *a, const void *b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char **argv) {
+    double minSecs = 0.2;
+    int reps = 5;
+    const char *filter = NULL;
+    bool json = false;
+    bool first = true;
+    int opt;
+    while ((opt = getopt(argc, argv, "t:r:f:jh")) != -1) {
+        switch (opt) {
+            case 't':
+                minSecs = atof(optarg);
+                break;
+            case 'r':
+                reps = atoi(optarg);
+                break;
+            case 'f':
+                filter = optarg;
+                break;
+            case 'j':
+                json = true;
+                break;
+            default:
+                fprintf(stderr,
+                    "Usage: %s [-t <secs>] [-r <reps>] [-f <name>] [-j]\n\n"
+                    "-t <secs> : Minimum time for each run. [Default: 0.2]\n"
+                    "-r <reps> : Runs of each benchmark. The median is reported. [Default: 5]\n"
+                    "-f <name> : Only run benchmarks with this in their name.\n"
+                    "-j : Print the results as JSON.\n",
+                    argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (reps < 1) {
+        reps = 1;
+    }
+
+    {
+        audio_format_t format;
+        if ((dialtoneLen = audio_unpack(&assetDialtone, &dialtone, &format)) < 0) {
+            fputs("Couldn't unpack the dialtone.\n", stderr);
+            return 1;
+        }
+    }
+    /* Same data every time so runs can be compared. */
+    srand(1);
+    for (size_t i = 0; i < sizeof(dataBuf); i++) {
+        do {
+            dataBuf[i] = rand();
+        } while (dataBuf[i] == DLE);
+        dleBuf[i] = (i % 64 == 0) ? DLE : (i % 64 == 1) ? '0' + (i/64) % 10 : dataBuf[i];
+        pcmBuf[i] = (int16_t)(rand() - RAND_MAX/2);
+    }
+    for (size_t i = 0; i < sizeof(ipBuf); i++) {
+        ipBuf[i] = rand();
+    }
+    {
+        hdlc_tx_t tx = {0, false};
+        frameLen = hdlc_encode(&tx, pppHeader, sizeof(pppHeader), ipBuf, sizeof(ipBuf), frameBuf);
+    }
+
+    if (json) {
+        printf("{\"compiler\":\"%s\",\"benchmarks\":[", __VERSION__);
+    } else {
+        printf("%-22s %12s %14s %12s\n", "benchmark", "ns/op", "MB/s", "iterations");
+    }
+    for (size_t b = 0; b < NUM_BENCHES; b++) {
+        double nsPerOp[64];
+        double bytesPerOp = 0;
+        double bytesPerSec = 0;
+        uint64_t iters = 1;
+        uint64_t start;
+        uint64_t elapsed;
+        if (filter != NULL && strstr(benches[b].name, filter) == NULL) {
+            continue;
+        }
+        /* Figure out how many iterations take minSecs. */
+        while (true) {
+            start = nsec_now();
+            benches[b].run(iters);
+            elapsed = nsec_now() - start;
+            if (elapsed >= minSecs*1e9/4) {
+                iters = (uint64_t)(iters*(minSecs*1e9/elapsed)) + 1;
+                break;
+            }
+            iters *= 2;
+        }
+        for (int r = 0; r < reps && r < 64; r++) {
+            uint64_t bytes;
+            start = nsec_now();
+            bytes = benches[b].run(iters);
+            elapsed = nsec_now() - start;
+            nsPerOp[r] = (double)elapsed/iters;
+            bytesPerOp = (double)bytes/iters;
+        }
+        qsort(nsPerOp, reps < 64 ? reps : 64, sizeof(double), compare_doubles);
+        bytesPerSec = bytesPerOp*1e9/nsPerOp[reps/2];
+        if (json) {
+            printf("%s{\"name\":\"%s\",\"ns_per_op\":%.3f,\"bytes_per_sec\":%.0f,\"iterations\":%" PRIu64 "}",
+                first ? "" : ",", benches[b].name, nsPerOp[reps/2], bytesPerSec, iters);
+        } else if (bytesPerSec > 0) {
+            printf("%-22s %12.2f %14.1f %12" PRIu64 "\n", benches[b].name, nsPerOp[reps/2], bytesPerSec/1e6, iters);
+        } else {
+            printf("%-22s %12.2f %14s %12" PRIu64 "\n", benches[b].name, nsPerOp[reps/2], "-", iters);
+        }
+        first = false;
+        fflush(stdout);
+    }
+    if (json) {
+        puts("]}");
+    }
+    return 0;
+}
@@ -0,0 +1,152 @@
+/* Export DialIn call detail records as CSV or JSON.
+ * Build: cc -O2 -pthread -I. -o cdrdump tools/cdrdump.c cdr.c ring.c log.c */
+
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include "cdr.h"
+
+static void format_time(char *buf, size_t size, int64_t usec) {
+    time_t sec = usec/1000000;
+    struct tm tm;
+    gmtime_r(&sec, &tm);
+    size_t len = strftime(buf, size, "%Y-%m-%dT%H:%M:%S", &tm);
+    snprintf(buf + len, size - len, ".%03dZ", (int)((usec/1000)%1000));
+}
+
+static void print_json_str(const char *str) {
+    putchar('"');
+    for (; *str; str++) {
+        if (*str == '"' || *str == '\\') {
+            printf("\\%c", *str);
+        } else if ((unsigned char)*str < 0x20) {
+            printf("\\u%04x", *str);
+        } else {
+            putchar(*str);
+        }
+    }
+    putchar('"');
+}
+
+/* None of our strings can have commas or quotes in them except the modem name. */
+static void print_csv_str(const char *str) {
+    if (strpbrk(str, ",\"\n") == NULL) {
+        fputs(str, stdout);
+        return;
+    }
+    putchar('"');
+    for (; *str; str++) {
+        if (*str == '"') {
+            putchar('"');
+        }
+        putchar(*str);
+    }
+    putchar('"');
+}
+
+static void print_record(const cdr_t *cdr, bool json) {
+    char start[32];
+    char end[32];
+    format_time(start, sizeof(start), cdr->startUsec);
+    format_time(end, sizeof(end), cdr->endUsec);
+    if (json) {
+        fputs("{\"modem\":", stdout);
+        print_json_str(cdr->modem);
+        printf(",\"start\":\"%s\",\"end\":\"%s\",\"digits\":", start, end);
+        print_json_str(cdr->digits);
+        printf(",\"connect_code\":%" PRId32 ",\"connect_rate\":%" PRIu32 ",\"protocol\":", cdr->connectCode, cdr->connectRate);
+        print_json_str(cdr->protocol);
+        fputs(",\"backend\":", stdout);
+        print_json_str(cdr->backend);
+        printf(",\"exit_status\":%" PRId32 ",\"rx_bytes\":%" PRIu64 ",\"tx_bytes\":%" PRIu64
+            ",\"dialtone_ms\":%" PRIu32 ",\"dialing_ms\":%" PRIu32 ",\"answer_ms\":%" PRIu32
+            ",\"setup_ms\":%" PRIu32 ",\"session_ms\":%" PRIu32 ",\"if_rx_bytes\":%" PRIu64
+            ",\"if_tx_bytes\":%" PRIu64 ",\"peak_rx_rate\":%" PRIu32 ",\"peak_tx_rate\":%" PRIu32
+            ",\"idle_ms\":%" PRIu32 ",\"compression_pct\":%" PRIu32 ",\"caller_number\":",
+            cdr->exitStatus, cdr->rxBytes, cdr->txBytes, cdr->dialtoneMs, cdr->dialingMs,
+            cdr->answerMs, cdr->setupMs, cdr->sessionMs, cdr->ifRxBytes, cdr->ifTxBytes,
+            cdr->peakRxRate, cdr->peakTxRate, cdr->idleMs, cdr->compressionPct);
+        print_json_str(cdr->callerNumber);
+        fputs(",\"caller_name\":", stdout);
+        print_json_str(cdr->callerName);
+        printf(",\"rings\":%" PRIu32 "}\n", cdr->rings);
+    } else {
+        print_csv_str(cdr->modem);
+        printf(",%s,%s,%s,%" PRId32 ",%" PRIu32 ",", start, end, cdr->digits, cdr->connectCode, cdr->connectRate);
+        print_csv_str(cdr->protocol);
+        putchar(',');
+        print_csv_str(cdr->backend);
+        printf(",%" PRId32 ",%" PRIu64 ",%" PRIu64 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32
+            ",%" PRIu64 ",%" PRIu64 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",",
+            cdr->exitStatus, cdr->rxBytes, cdr->txBytes, cdr->dialtoneMs, cdr->dialingMs,
+            cdr->answerMs, cdr->setupMs, cdr->sessionMs, cdr->ifRxBytes, cdr->ifTxBytes,
+            cdr->peakRxRate, cdr->peakTxRate, cdr->idleMs, cdr->compressionPct);
+        print_csv_str(cdr->callerNumber);
+        putchar(',');
+        print_csv_str(cdr->callerName);
+        printf(",%" PRIu32 "\n", cdr->rings);
+    }
+}
+
+int main(int argc, char **argv) {
+    static uint8_t buf[65536];
+    bool json = false;
+    size_t used = 0;
+    size_t got;
+    int opt;
+    FILE *file;
+    while ((opt = getopt(argc, argv, "jh")) != -1) {
+        switch (opt) {
+            case 'j':
+                json = true;
+                break;
+            default:
+                fprintf(stderr,
+                    "Usage: %s [-j] <CDR file>\n\n"
+                    "Prints the records as CSV, or as one JSON object per line with -j.\n",
+                    argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (optind >= argc) {
+        fputs("You must specify a CDR file! Run with -h for help.\n", stderr);
+        return 1;
+    }
+    if ((file = fopen(argv[optind], "rb")) == NULL) {
+        perror(argv[optind]);
+        return 1;
+    }
+    if (fread(buf, 1, CDR_MAGIC_LEN, file) != CDR_MAGIC_LEN || memcmp(buf, CDR_MAGIC, CDR_MAGIC_LEN) != 0) {
+        fprintf(stderr, "%s isn't a DialIn CDR file.\n", argv[optind]);
+        return 1;
+    }
+    if (!json) {
+        puts("modem,start,end,digits,connect_code,connect_rate,protocol,backend,exit_status,"
+            "rx_bytes,tx_bytes,dialtone_ms,dialing_ms,answer_ms,setup_ms,session_ms,"
+            "if_rx_bytes,if_tx_bytes,peak_rx_rate,peak_tx_rate,idle_ms,compression_pct,caller_number,caller_name,rings");
+    }
+    while ((got = fread(buf + used, 1, sizeof(buf) - used, file)) > 0) {
+        size_t pos = 0;
+        int res;
+        cdr_t cdr;
+        used += got;
+        while ((res = cdr_decode(&cdr, buf + pos, used - pos)) > 0) {
+            print_record(&cdr, json);
+            pos += res;
+        }
+        if (res < 0) {
+            fprintf(stderr, "Bad record in %s. Stopping.\n", argv[optind]);
+            return 1;
+        }
+        memmove(buf, buf + pos, used - pos);
+        used -= pos;
+    }
+    if (used > 0) {
+        fprintf(stderr, "%zu bytes of a partial record at the end of %s.\n", used, argv[optind]);
+    }
+    fclose(file);
+    return 0;
+}
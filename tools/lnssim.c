@@ -0,0 +1,415 @@
+/* Stands in for an L2TP LNS, for testing dialin's l2tp backend without one.
+ * Brings up tunnels and sessions for anyone who asks and sends every frame it
+ * gets straight back down the session it came in on.
+ * Build: cc -O2 -o lnssim tools/lnssim.c */
+
+#include <poll.h>
+#include <time.h>
+#include <stdio.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#define HDR_T 0x8000
+#define HDR_L 0x4000
+#define HDR_S 0x0800
+#define HDR_O 0x0200
+#define HDR_VER 2
+
+#define MSG_SCCRQ 1
+#define MSG_SCCRP 2
+#define MSG_SCCCN 3
+#define MSG_STOPCCN 4
+#define MSG_HELLO 6
+#define MSG_ICRQ 10
+#define MSG_ICRP 11
+#define MSG_ICCN 12
+#define MSG_CDN 14
+
+#define AVP_MESSAGE_TYPE 0
+#define AVP_RESULT_CODE 1
+#define AVP_PROTOCOL_VERSION 2
+#define AVP_FRAMING_CAPS 3
+#define AVP_HOST_NAME 7
+#define AVP_TUNNEL_ID 9
+#define AVP_WINDOW 10
+#define AVP_SESSION_ID 14
+#define AVP_CALLED_NUMBER 21
+#define AVP_TX_SPEED 24
+
+#define MAX_TUNNELS 64
+#define MAX_SESSIONS 4096
+
+typedef struct {
+    bool used;
+    struct sockaddr_storage addr;
+    socklen_t addrLen;
+    uint16_t peerId;
+    uint16_t ns;
+    uint16_t nr;
+} tunnel_t;
+
+typedef struct {
+    bool used;
+    int tunnel;
+    uint16_t peerId;
+    uint64_t frames;
+    uint64_t bytes;
+} session_t;
+
+typedef struct {
+    int type;
+    int tunnelId;
+    int sessionId;
+    int result;
+    uint32_t speed;
+    char called[32];
+    char host[64];
+} avps_t;
+
+static tunnel_t tunnels[MAX_TUNNELS + 1];
+static session_t sessions[MAX_SESSIONS + 1];
+static int sock;
+static int lossPct = 0;
+static bool verbose = false;
+static volatile sig_atomic_t running = 1;
+
+static void stop(int sig) {
+    (void)sig;
+    running = 0;
+}
+
+static uint16_t get_u16(const uint8_t *p) {
+    return (p[0] << 8) | p[1];
+}
+
+static void put_u16(uint8_t *p, uint16_t val) {
+    p[0] = val >> 8;
+    p[1] = val;
+}
+
+static void put_u32(uint8_t *p, uint32_t val) {
+    p[0] = val >> 24;
+    p[1] = val >> 16;
+    p[2] = val >> 8;
+    p[3] = val;
+}
+
+static size_t add_avp(uint8_t *msg, size_t len, uint16_t type, const void *value, size_t valueLen) {
+    put_u16(msg + len, 0x8000 | (6 + valueLen));
+    put_u16(msg + len + 2, 0);
+    put_u16(msg + len + 4, type);
+    memcpy(msg + len + 6, value, valueLen);
+    return len + 6 + valueLen;
+}
+
+static size_t add_avp_u16(uint8_t *msg, size_t len, uint16_t type, uint16_t val) {
+    uint8_t buf[2];
+    put_u16(buf, val);
+    return add_avp(msg, len, type, buf, sizeof(buf));
+}
+
+static size_t add_avp_u32(uint8_t *msg, size_t len, uint16_t type, uint32_t val) {
+    uint8_t buf[4];
+    put_u32(buf, val);
+    return add_avp(msg, len, type, buf, sizeof(buf));
+}
+
+/* Start a control message. A type of 0 makes it a ZLB. */
+static size_t start_message(uint8_t *msg, tunnel_t *tunnel, uint16_t session, uint16_t type) {
+    put_u16(msg, HDR_T | HDR_L | HDR_S | HDR_VER);
+    put_u16(msg + 4, tunnel->peerId);
+    put_u16(msg + 6, session);
+    put_u16(msg + 8, tunnel->ns);
+    put_u16(msg + 10, tunnel->nr);
+    if (type == 0) {
+        return 12;
+    }
+    tunnel->ns++;
+    return add_avp_u16(msg, 12, AVP_MESSAGE_TYPE, type);
+}
+
+/* We never send anything twice, so loss only ever hits what comes in. */
+static void send_message(tunnel_t *tunnel, uint8_t *msg, size_t len) {
+    put_u16(msg + 2, len);
+    if (sendto(sock, msg, len, 0, (struct sockaddr*)&tunnel->addr, tunnel->addrLen) < 0) {
+        perror("sendto");
+    }
+}
+
+static void parse_avps(const uint8_t *p, const uint8_t *end, avps_t *avps) {
+    memset(avps, 0, sizeof(*avps));
+    avps->type = avps->tunnelId = avps->sessionId = avps->result = -1;
+    while (end - p >= 6) {
+        size_t len = get_u16(p) & 0x3ff;
+        uint16_t type = get_u16(p + 4);
+        const uint8_t *value = p + 6;
+        if (len < 6 || len > (size_t)(end - p)) {
+            return;
+        }
+        len -= 6;
+        if (get_u16(p + 2) == 0) {
+            if (type == AVP_MESSAGE_TYPE && len == 2) {
+                avps->type = get_u16(value);
+            } else if (type == AVP_TUNNEL_ID && len == 2) {
+                avps->tunnelId = get_u16(value);
+            } else if (type == AVP_SESSION_ID && len == 2) {
+                avps->sessionId = get_u16(value);
+            } else if (type == AVP_RESULT_CODE && len >= 2) {
+                avps->result = get_u16(value);
+            } else if (type == AVP_TX_SPEED && len == 4) {
+                avps->speed = ((uint32_t)value[0] << 24) | (value[1] << 16) | (value[2] << 8) | value[3];
+            } else if (type == AVP_CALLED_NUMBER && len < sizeof(avps->called)) {
+                memcpy(avps->called, value, len);
+            } else if (type == AVP_HOST_NAME && len < sizeof(avps->host)) {
+                memcpy(avps->host, value, len);
+            }
+        }
+        p = value + len;
+    }
+}
+
+static void end_session(int id, const char *why) {
+    printf("session %d down (%s): %" PRIu64 " frames, %" PRIu64 " bytes echoed\n", id, why, sessions[id].frames, sessions[id].bytes);
+    sessions[id].used = false;
+}
+
+static void end_tunnel(int id) {
+    for (int i = 1; i <= MAX_SESSIONS; i++) {
+        if (sessions[i].used && sessions[i].tunnel == id) {
+            end_session(i, "tunnel closed");
+        }
+    }
+    printf("tunnel %d down\n", id);
+    tunnels[id].used = false;
+}
+
+/* Same LAC asking again because our SCCRP got lost, or a new one. */
+static int find_tunnel(const struct sockaddr_storage *addr, socklen_t addrLen, int peerId) {
+    int free = 0;
+    for (int i = 1; i <= MAX_TUNNELS; i++) {
+        if (tunnels[i].used && tunnels[i].peerId == peerId && tunnels[i].addrLen == addrLen && memcmp(&tunnels[i].addr, addr, addrLen) == 0) {
+            return i;
+        }
+        if (!tunnels[i].used && free == 0) {
+            free = i;
+        }
+    }
+    if (free != 0) {
+        memset(&tunnels[free], 0, sizeof(tunnel_t));
+        tunnels[free].used = true;
+        memcpy(&tunnels[free].addr, addr, addrLen);
+        tunnels[free].addrLen = addrLen;
+        tunnels[free].peerId = peerId;
+    }
+    return free;
+}
+
+static void got_control(const uint8_t *buf, size_t len, const struct sockaddr_storage *addr, socklen_t addrLen) {
+    uint8_t msg[512];
+    size_t msgLen;
+    uint16_t length = get_u16(buf + 2);
+    int id = get_u16(buf + 4);
+    int sessionId = get_u16(buf + 6);
+    uint16_t ns = get_u16(buf + 8);
+    tunnel_t *tunnel;
+    avps_t avps;
+    if (len < 12 || length < 12 || length > len) {
+        return;
+    }
+    if (length == 12) {
+        return;
+    }
+    if (lossPct > 0 && rand() % 100 < lossPct) {
+        if (verbose) {
+            printf("dropping a control message (Ns %u)\n", ns);
+        }
+        return;
+    }
+    parse_avps(buf + 12, buf + length, &avps);
+    if (id == 0 && avps.type == MSG_SCCRQ) {
+        if ((id = find_tunnel(addr, addrLen, avps.tunnelId)) == 0) {
+            fputs("Out of tunnels.\n", stderr);
+            return;
+        }
+    }
+    if (id <= 0 || id > MAX_TUNNELS || !tunnels[id].used) {
+        return;
+    }
+    tunnel = &tunnels[id];
+    if (ns != tunnel->nr) {
+        /* Already got it. Ack it again. */
+        send_message(tunnel, msg, start_message(msg, tunnel, 0, 0));
+        return;
+    }
+    tunnel->nr++;
+    if (verbose) {
+        printf("tunnel %d: message %d (Ns %u)\n", id, avps.type, ns);
+    }
+    switch (avps.type) {
+        case MSG_SCCRQ:
+            msgLen = start_message(msg, tunnel, 0, MSG_SCCRP);
+            msgLen = add_avp_u16(msg, msgLen, AVP_PROTOCOL_VERSION, 0x0100);
+            msgLen = add_avp(msg, msgLen, AVP_HOST_NAME, "lnssim", 6);
+            msgLen = add_avp_u32(msg, msgLen, AVP_FRAMING_CAPS, 3);
+            msgLen = add_avp_u16(msg, msgLen, AVP_TUNNEL_ID, id);
+            msgLen = add_avp_u16(msg, msgLen, AVP_WINDOW, 8);
+            send_message(tunnel, msg, msgLen);
+            return;
+        case MSG_SCCCN:
+            printf("tunnel %d up (LAC tunnel %u)\n", id, tunnel->peerId);
+            break;
+        case MSG_STOPCCN:
+            send_message(tunnel, msg, start_message(msg, tunnel, 0, 0));
+            end_tunnel(id);
+            return;
+        case MSG_ICRQ:
+            for (int i = 1; i <= MAX_SESSIONS; i++) {
+                if (!sessions[i].used) {
+                    memset(&sessions[i], 0, sizeof(session_t));
+                    sessions[i].used = true;
+                    sessions[i].tunnel = id;
+                    sessions[i].peerId = avps.sessionId;
+                    msgLen = start_message(msg, tunnel, avps.sessionId, MSG_ICRP);
+                    msgLen = add_avp_u16(msg, msgLen, AVP_SESSION_ID, i);
+                    send_message(tunnel, msg, msgLen);
+                    printf("session %d: call to %s\n", i, avps.called[0] ? avps.called : "?");
+                    return;
+                }
+            }
+            msgLen = start_message(msg, tunnel, avps.sessionId, MSG_CDN);
+            msgLen = add_avp_u16(msg, msgLen, AVP_RESULT_CODE, 4);
+            msgLen = add_avp_u16(msg, msgLen, AVP_SESSION_ID, 0);
+            send_message(tunnel, msg, msgLen);
+            return;
+        case MSG_ICCN:
+            if (sessionId > 0 && sessionId <= MAX_SESSIONS && sessions[sessionId].used) {
+                printf("session %d up at %u bits/s\n", sessionId, avps.speed);
+            }
+            break;
+        case MSG_CDN:
+            if (sessionId > 0 && sessionId <= MAX_SESSIONS && sessions[sessionId].used) {
+                char why[32];
+                snprintf(why, sizeof(why), "result %d", avps.result);
+                end_session(sessionId, why);
+            }
+            break;
+        default:
+            break;
+    }
+    /* Everything else just gets acked. */
+    send_message(tunnel, msg, start_message(msg, tunnel, 0, 0));
+}
+
+static void got_data(uint8_t *buf, size_t len) {
+    uint16_t flags = get_u16(buf);
+    size_t off = flags & HDR_L ? 4 : 2;
+    int tunnelId, sessionId;
+    session_t *session;
+    tunnel_t *tunnel;
+    if (off + 4 > len) {
+        return;
+    }
+    tunnelId = get_u16(buf + off);
+    sessionId = get_u16(buf + off + 2);
+    off += 4;
+    if (flags & HDR_S) {
+        off += 4;
+    }
+    if (flags & HDR_O) {
+        off += 2 + get_u16(buf + off);
+    }
+    if (off > len || sessionId <= 0 || sessionId > MAX_SESSIONS || !sessions[sessionId].used || sessions[sessionId].tunnel != tunnelId) {
+        return;
+    }
+    session = &sessions[sessionId];
+    tunnel = &tunnels[tunnelId];
+    session->frames++;
+    session->bytes += len - off;
+    /* Put our header on the front of the frame and send it back. */
+    off -= 6;
+    put_u16(buf + off, HDR_VER);
+    put_u16(buf + off + 2, tunnel->peerId);
+    put_u16(buf + off + 4, session->peerId);
+    if (sendto(sock, buf + off, len - off, 0, (struct sockaddr*)&tunnel->addr, tunnel->addrLen) < 0) {
+        perror("sendto");
+    }
+}
+
+int main(int argc, char **argv) {
+    struct sockaddr_in6 bindAddr = {0};
+    int port = 1701;
+    int off = 0;
+    int opt;
+    srand(time(NULL));
+    while ((opt = getopt(argc, argv, "p:l:s:vh")) != -1) {
+        switch (opt) {
+            case 'p':
+                port = atoi(optarg);
+                break;
+            case 'l':
+                lossPct = atoi(optarg);
+                break;
+            case 's':
+                srand(atoi(optarg));
+                break;
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                fprintf(stderr,
+                    "Usage: %s [options...]\n\n"
+                    "Answers L2TP tunnels and sessions and echoes every session's frames back.\n\n"
+                    "-p <port> : UDP port to listen on. [Default: 1701]\n"
+                    "-l <percent> : Chance that a control message coming in gets dropped. [Default: 0]\n"
+                    "-s <seed> : Random seed for the drops.\n"
+                    "-v : Print every control message.\n",
+                    argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if ((sock = socket(AF_INET6, SOCK_DGRAM, 0)) < 0) {
+        perror("socket");
+        return 1;
+    }
+    setsockopt(sock, IPPROTO_IPV6, IPV6_V6ONLY, &off, sizeof(off));
+    bindAddr.sin6_family = AF_INET6;
+    bindAddr.sin6_addr = in6addr_any;
+    bindAddr.sin6_port = htons(port);
+    if (bind(sock, (struct sockaddr*)&bindAddr, sizeof(bindAddr)) != 0) {
+        perror("bind");
+        return 1;
+    }
+    printf("listening on port %d\n", port);
+    fflush(stdout);
+
+    signal(SIGINT, stop);
+    signal(SIGTERM, stop);
+    while (running) {
+        struct pollfd pfd = {sock, POLLIN, 0};
+        uint8_t buf[4096];
+        struct sockaddr_storage addr;
+        socklen_t addrLen = sizeof(addr);
+        ssize_t len;
+        if (poll(&pfd, 1, 100) != 1) {
+            continue;
+        }
+        if ((len = recvfrom(sock, buf, sizeof(buf), 0, (struct sockaddr*)&addr, &addrLen)) < 6 || (get_u16(buf) & 0x000f) != HDR_VER) {
+            continue;
+        }
+        if (get_u16(buf) & HDR_T) {
+            got_control(buf, len, &addr, addrLen);
+        } else {
+            got_data(buf, len);
+        }
+        fflush(stdout);
+    }
+    return 0;
+}
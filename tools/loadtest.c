@@ -0,0 +1,478 @@
+/* Load test for dialin. Runs dialin against simulated modems and places calls
+ * on them: dial, wait for CONNECT, push bytes through a stub backend and hang up.
+ * Build: cc -O2 -I. -o loadtest tools/loadtest.c tools/sim.c hdlc.c -lm */
+
+#include <math.h>
+#include <time.h>
+#include <stdio.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <sys/wait.h>
+#include "sim.h"
+#include "hdlc.h"
+
+#define EOT 0x04
+#define DIAL_TIMEOUT_USEC 120000000ULL
+#define TALK_TIMEOUT_USEC 30000000ULL
+/* Wait this long after CONNECT before talking, so we don't race dialin reading the result code. */
+#define TALK_DELAY_USEC 500000
+
+typedef enum {
+    CALLER_IDLE = 0,
+    CALLER_DIALING,
+    CALLER_TALKING
+} caller_state_t;
+
+typedef struct {
+    caller_state_t state;
+    /* The line is giving dialtone. */
+    bool ready;
+    uint64_t dialedAt;
+    uint64_t connectedAt;
+    size_t sent;
+    size_t echoed;
+} caller_t;
+
+typedef struct {
+    double *values;
+    size_t count;
+    size_t size;
+} samples_t;
+
+typedef struct {
+    const char *digits;
+    size_t payload;
+    /* Send the payload as PPP frames, for backends that look at what they get. */
+    bool framed;
+    uint64_t attempted;
+    uint64_t completed;
+    uint64_t failed;
+    uint64_t blocked;
+    uint64_t bytes;
+    samples_t connectMs;
+    /* Dialtone pacing, one sample per voice session. */
+    samples_t jitterMs;
+    double worstGapMs;
+    int64_t maxLead;
+    int64_t maxLag;
+    caller_t *callers;
+} test_t;
+
+static volatile sig_atomic_t running = 1;
+
+static void stop(int sig) {
+    (void)sig;
+    running = 0;
+}
+
+static void add_sample(samples_t *samples, double value) {
+    if (samples->count == samples->size) {
+        size_t size = samples->size ? samples->size*2 : 256;
+        double *values = realloc(samples->values, size*sizeof(double));
+        if (values == NULL) {
+            return;
+        }
+        samples->values = values;
+        samples->size = size;
+    }
+    samples->values[samples->count++] = value;
+}
+
+static int compare_doubles(const void *a, const void *b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static double percentile(samples_t *samples, double pct) {
+    size_t index;
+    if (samples->count == 0) {
+        return 0;
+    }
+    index = (size_t)(pct/100*(samples->count - 1) + 0.5);
+    return samples->values[index];
+}
+
+static double mean(samples_t *samples) {
+    double sum = 0;
+    for (size_t i = 0; i < samples->count; i++) {
+        sum += samples->values[i];
+    }
+    return samples->count ? sum/samples->count : 0;
+}
+
+static void end_call(sim_line_t *line, test_t *test, bool ok) {
+    caller_t *caller = &test->callers[line->index];
+    if (ok) {
+        test->completed++;
+        test->bytes += caller->echoed;
+    } else {
+        test->failed++;
+    }
+    caller->state = CALLER_IDLE;
+}
+
+static void on_mode(sim_line_t *line, sim_mode_t old, void *ctx) {
+    test_t *test = ctx;
+    caller_t *caller = &test->callers[line->index];
+    uint64_t now = sim_usec();
+    caller->ready = line->mode == SIM_VOICE_TX;
+    if (old == SIM_VOICE_TX && line->voice.writes > 1) {
+        sim_voice_stats_t *voice = &line->voice;
+        double gapMean = voice->gapSum/(voice->writes - 1);
+        add_sample(&test->jitterMs, sqrt(voice->gapSqSum/(voice->writes - 1) - gapMean*gapMean)/1000);
+        if (voice->gapMax/1000.0 > test->worstGapMs) {
+            test->worstGapMs = voice->gapMax/1000.0;
+        }
+        if (voice->maxLead > test->maxLead) {
+            test->maxLead = voice->maxLead;
+        }
+        if (voice->maxLag > test->maxLag) {
+            test->maxLag = voice->maxLag;
+        }
+    }
+    if (line->mode == SIM_DATA && caller->state == CALLER_DIALING) {
+        add_sample(&test->connectMs, (now - caller->dialedAt)/1000.0);
+        caller->state = CALLER_TALKING;
+        caller->connectedAt = now;
+        caller->sent = 0;
+        caller->echoed = 0;
+    } else if (line->mode == SIM_COMMAND && old != SIM_VOICE_TX && caller->state != CALLER_IDLE) {
+        /* The modem dropped the call on us. */
+        end_call(line, test, false);
+    }
+}
+
+static void on_data(sim_line_t *line, const uint8_t *buf, size_t len, void *ctx) {
+    test_t *test = ctx;
+    caller_t *caller = &test->callers[line->index];
+    (void)buf;
+    if (caller->state != CALLER_TALKING) {
+        return;
+    }
+    caller->echoed += len;
+    if (caller->echoed >= test->payload) {
+        /* Tell the stub to quit, then hang up. */
+        uint8_t eot = EOT;
+        sim_send(line, &eot, 1);
+        end_call(line, test, true);
+        sim_hangup(line);
+    }
+}
+
+/* Keep the stub fed. Letters only so we never look like +++ or an EOT. */
+static void send_payload(sim_line_t *line, test_t *test) {
+    static const hdlc_tx_t tx = {0xffffffff, false};
+    static const uint8_t hdr[4] = {0xff, 0x03, 0x00, 0x21};
+    caller_t *caller = &test->callers[line->index];
+    uint8_t chunk[1024];
+    uint8_t frame[HDLC_MAX_ENCODED(sizeof(hdr) + 256)];
+    while (test->framed && caller->sent < test->payload) {
+        /* Whatever comes back is the same frames, so the bytes to wait for are what we put on the line. */
+        size_t len;
+        for (size_t i = 0; i < 256; i++) {
+            chunk[i] = 'a' + (caller->sent + i)%26;
+        }
+        len = hdlc_encode(&tx, hdr, sizeof(hdr), chunk, 256, frame);
+        if (!sim_send(line, frame, len)) {
+            break;
+        }
+        caller->sent += len;
+    }
+    while (!test->framed && caller->sent < test->payload) {
+        size_t len = test->payload - caller->sent;
+        if (len > sizeof(chunk)) {
+            len = sizeof(chunk);
+        }
+        for (size_t i = 0; i < len; i++) {
+            chunk[i] = 'a' + (caller->sent + i)%26;
+        }
+        if (!sim_send(line, chunk, len)) {
+            break;
+        }
+        caller->sent += len;
+    }
+}
+
+/* utime + stime of a process, in seconds. */
+static double process_cpu(pid_t pid) {
+    char path[64];
+    char buf[1024];
+    unsigned long utime;
+    unsigned long stime;
+    char *p;
+    FILE *file;
+    size_t len;
+    snprintf(path, sizeof(path), "/proc/%d/stat", (int)pid);
+    if ((file = fopen(path, "r")) == NULL) {
+        return 0;
+    }
+    len = fread(buf, 1, sizeof(buf) - 1, file);
+    fclose(file);
+    buf[len] = 0;
+    /* Skip past the command name, which can have spaces in it. */
+    if ((p = strrchr(buf, ')')) == NULL ||
+        sscanf(p + 2, "%*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu", &utime, &stime) != 2) {
+        return 0;
+    }
+    return (double)(utime + stime)/sysconf(_SC_CLK_TCK);
+}
+
+static pid_t start_dialin(char *dialinPath, char *stubPath, char *logPath, sim_line_t *lines, int numLines, char **extra, int numExtra) {
+    char **args = calloc(2*numLines + numExtra + 8, sizeof(char*));
+    int n = 0;
+    pid_t pid;
+    if (args == NULL) {
+        return -1;
+    }
+    args[n++] = dialinPath;
+    args[n++] = "-p";
+    args[n++] = stubPath;
+    args[n++] = "-l";
+    args[n++] = logPath;
+    for (int i = 0; i < numLines; i++) {
+        args[n++] = "-m";
+        args[n++] = lines[i].slavePath;
+    }
+    for (int i = 0; i < numExtra; i++) {
+        args[n++] = extra[i];
+    }
+    args[n] = NULL;
+    pid = fork();
+    if (pid == 0) {
+        execv(dialinPath, args);
+        perror(dialinPath);
+        _exit(127);
+    }
+    free(args);
+    return pid;
+}
+
+static void report(test_t *test, int numLines, double secs, double rate, double cpu, bool json) {
+    qsort(test->connectMs.values, test->connectMs.count, sizeof(double), compare_doubles);
+    if (json) {
+        printf("{\"lines\":%d,\"seconds\":%.3f,\"offered_calls_per_sec\":%.3f,"
+            "\"attempted\":%" PRIu64 ",\"completed\":%" PRIu64 ",\"failed\":%" PRIu64 ",\"blocked\":%" PRIu64 ","
+            "\"calls_per_sec\":%.3f,\"bytes\":%" PRIu64 ","
+            "\"dtmf_to_connect_ms\":{\"min\":%.1f,\"p50\":%.1f,\"p90\":%.1f,\"p99\":%.1f,\"max\":%.1f},"
+            "\"dialtone\":{\"sessions\":%zu,\"jitter_ms\":%.2f,\"worst_gap_ms\":%.1f,\"max_lead_samples\":%" PRId64 ",\"max_lag_samples\":%" PRId64 "},"
+            "\"daemon_cpu_pct\":%.2f,\"daemon_cpu_pct_per_line\":%.4f}\n",
+            numLines, secs, rate, test->attempted, test->completed, test->failed, test->blocked,
+            test->completed/secs, test->bytes,
+            percentile(&test->connectMs, 0), percentile(&test->connectMs, 50), percentile(&test->connectMs, 90),
+            percentile(&test->connectMs, 99), percentile(&test->connectMs, 100),
+            test->jitterMs.count, mean(&test->jitterMs), test->worstGapMs, test->maxLead, test->maxLag,
+            100*cpu/secs, 100*cpu/secs/numLines);
+        return;
+    }
+    printf("%d lines, %.1fs, offered %.2f calls/s\n", numLines, secs, rate);
+    printf("calls: %" PRIu64 " attempted, %" PRIu64 " completed, %" PRIu64 " failed, %" PRIu64 " blocked (no free line)\n",
+        test->attempted, test->completed, test->failed, test->blocked);
+    printf("throughput: %.3f calls/s, %" PRIu64 " bytes echoed\n", test->completed/secs, test->bytes);
+    printf("DTMF to CONNECT: min %.1fms p50 %.1fms p90 %.1fms p99 %.1fms max %.1fms\n",
+        percentile(&test->connectMs, 0), percentile(&test->connectMs, 50), percentile(&test->connectMs, 90),
+        percentile(&test->connectMs, 99), percentile(&test->connectMs, 100));
+    printf("dialtone: %zu sessions, write jitter %.2fms, worst gap %.1fms, max lead %" PRId64 " lag %" PRId64 " samples\n",
+        test->jitterMs.count, mean(&test->jitterMs), test->worstGapMs, test->maxLead, test->maxLag);
+    printf("dialin CPU: %.2f%% total, %.4f%% per line\n", 100*cpu/secs, 100*cpu/secs/numLines);
+}
+
+int main(int argc, char **argv) {
+    sim_config_t config = {
+        .latencyMs = 20,
+        .trainMs = 3000,
+        .baud = 0,
+        .connectCode = 18,
+        .guardMs = 1000
+    };
+    test_t test = {.digits = "5551234", .payload = 4096};
+    sim_callbacks_t callbacks = {on_mode, on_data, &test};
+    char *dialinPath = "./dialin";
+    char *stubPath = "./stubppp";
+    char *logPath = "/dev/null";
+    int numLines = 10;
+    double rate = 1;
+    double duration = 60;
+    bool json = false;
+    sim_line_t *lines;
+    pid_t dialin;
+    uint64_t start;
+    uint64_t end;
+    uint64_t nextCall;
+    double cpuStart;
+    double cpu;
+    int opt;
+    srand(time(NULL));
+    while ((opt = getopt(argc, argv, "n:r:d:x:N:D:S:L:t:b:l:c:f:g:s:Fjh")) != -1) {
+        switch (opt) {
+            case 'n':
+                numLines = atoi(optarg);
+                break;
+            case 'r':
+                rate = atof(optarg);
+                break;
+            case 'd':
+                duration = atof(optarg);
+                break;
+            case 'x':
+                test.payload = strtoul(optarg, NULL, 10);
+                break;
+            case 'N':
+                test.digits = optarg;
+                break;
+            case 'D':
+                dialinPath = optarg;
+                break;
+            case 'S':
+                stubPath = optarg;
+                break;
+            case 'L':
+                logPath = optarg;
+                break;
+            case 't':
+                config.trainMs = atoi(optarg);
+                break;
+            case 'b':
+                config.baud = atoi(optarg);
+                break;
+            case 'l':
+                config.latencyMs = atoi(optarg);
+                break;
+            case 'c':
+                config.connectCode = atoi(optarg);
+                break;
+            case 'f':
+                config.failPct = atoi(optarg);
+                break;
+            case 'g':
+                config.garbagePct = atoi(optarg);
+                break;
+            case 's':
+                srand(atoi(optarg));
+                break;
+            case 'F':
+                test.framed = true;
+                break;
+            case 'j':
+                json = true;
+                break;
+            default:
+                fprintf(stderr,
+                    "Usage: %s [options...] [-- extra dialin args...]\n\n"
+                    "-n <lines> : Number of simulated lines. [Default: 10]\n"
+                    "-r <calls/s> : Average call arrival rate over all lines. [Default: 1]\n"
+                    "-d <secs> : How long to place calls for. [Default: 60]\n"
+                    "-x <bytes> : Bytes to push through the backend per call. [Default: 4096]\n"
+                    "-N <digits> : Number to dial. [Default: 5551234]\n"
+                    "-F : Send the payload as PPP frames, for a dial plan that tunnels the call (see lnssim).\n"
+                    "-D <path> : dialin executable. [Default: ./dialin]\n"
+                    "-S <path> : Stub backend to run in place of pppd. [Default: ./stubppp]\n"
+                    "-L <file> : Where dialin logs to. [Default: /dev/null]\n"
+                    "-t, -b, -l, -c, -f, -g : Training time, baud, latency, CONNECT code, failure and garbage %% for the modems (see modemsim).\n"
+                    "-s <seed> : Random seed.\n"
+                    "-j : Print the results as JSON.\n",
+                    argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (numLines < 1 || rate <= 0 || duration <= 0) {
+        fputs("Lines, rate and duration all need to be more than 0.\n", stderr);
+        return 1;
+    }
+
+    lines = calloc(numLines, sizeof(sim_line_t));
+    test.callers = calloc(numLines, sizeof(caller_t));
+    if (lines == NULL || test.callers == NULL) {
+        fputs("Out of memory.\n", stderr);
+        return 1;
+    }
+    for (int i = 0; i < numLines; i++) {
+        if (sim_open(&lines[i], i, &config, &callbacks) != 0) {
+            perror("Couldn't create a pty");
+            return 1;
+        }
+    }
+    signal(SIGINT, stop);
+    signal(SIGTERM, stop);
+    if ((dialin = start_dialin(dialinPath, stubPath, logPath, lines, numLines, argv + optind, argc - optind)) < 0) {
+        perror("fork");
+        return 1;
+    }
+
+    start = sim_usec();
+    end = start + (uint64_t)(duration*1000000);
+    nextCall = start;
+    cpuStart = process_cpu(dialin);
+    while (running) {
+        uint64_t now = sim_usec();
+        bool busy = false;
+        sim_poll(lines, numLines, 5);
+        now = sim_usec();
+
+        /* Place calls as they arrive. */
+        while (now < end && now >= nextCall) {
+            int free = 0;
+            int pick;
+            nextCall += (uint64_t)(-log(1 - rand()/(RAND_MAX + 1.0))/rate*1000000);
+            test.attempted++;
+            for (int i = 0; i < numLines; i++) {
+                free += test.callers[i].ready && test.callers[i].state == CALLER_IDLE;
+            }
+            if (free == 0) {
+                test.blocked++;
+                continue;
+            }
+            pick = rand() % free;
+            for (int i = 0; i < numLines; i++) {
+                caller_t *caller = &test.callers[i];
+                if (caller->ready && caller->state == CALLER_IDLE && pick-- == 0) {
+                    caller->state = CALLER_DIALING;
+                    caller->dialedAt = now;
+                    sim_dial(&lines[i], test.digits, 0, 100);
+                    break;
+                }
+            }
+        }
+
+        for (int i = 0; i < numLines; i++) {
+            caller_t *caller = &test.callers[i];
+            if (caller->state == CALLER_TALKING) {
+                if (now - caller->connectedAt >= TALK_DELAY_USEC) {
+                    send_payload(&lines[i], &test);
+                }
+                if (now - caller->connectedAt > TALK_TIMEOUT_USEC) {
+                    end_call(&lines[i], &test, false);
+                    sim_hangup(&lines[i]);
+                }
+            } else if (caller->state == CALLER_DIALING && now - caller->dialedAt > DIAL_TIMEOUT_USEC) {
+                end_call(&lines[i], &test, false);
+            }
+            busy |= caller->state != CALLER_IDLE;
+        }
+        /* Let calls in progress finish up. */
+        if (now >= end && !busy) {
+            break;
+        }
+        if (waitpid(dialin, NULL, WNOHANG) == dialin) {
+            fputs("dialin exited during the test!\n", stderr);
+            dialin = -1;
+            break;
+        }
+    }
+
+    end = sim_usec();
+    cpu = dialin > 0 ? process_cpu(dialin) - cpuStart : 0;
+    if (dialin > 0) {
+        kill(dialin, SIGTERM);
+        waitpid(dialin, NULL, 0);
+    }
+    report(&test, numLines, (end - start)/1000000.0, rate, cpu, json);
+    for (int i = 0; i < numLines; i++) {
+        sim_close(&lines[i]);
+    }
+    return dialin > 0 ? 0 : 1;
+}
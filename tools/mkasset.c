@@ -0,0 +1,379 @@
+/* Builds the audio that goes into dialin (assets.c and assets.h) from a list of tones and WAVs.
+ * Build: cc -O2 -o mkasset tools/mkasset.c -lm
+ * Run: ./mkasset assets/assets.txt assets */
+
+#include <math.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * The list has one asset a line:
+ *   dialtone  tone 350+440 -10.5        (whole Hz, dBFS peak of each, optional rate)
+ *   ringback  tone 440+480 -16 8000
+ *   chime     wav chime.wav [loop]      (mono 8 or 16-bit PCM, relative to the list)
+ * # starts a comment.
+ *
+ * Tones get stored as one period, which loops without a click by
+ * construction. WAVs get IMA ADPCM, 4 bits a sample. Either way dialin
+ * unpacks them when it starts (audio_unpack()). Anything that loops gets
+ * checked for a click where it goes round, and the build fails if there is
+ * one.
+ */
+
+#define MAX_FREQS 4
+#define MAX_ASSETS 64
+#define PAGE_SIZE 4096
+
+typedef struct {
+    char name[32];
+    char source[256];
+    /* What it's stored as. */
+    uint8_t *data;
+    uint32_t size;
+    uint32_t count;
+    uint32_t rate;
+    bool adpcm;
+    bool loop;
+} asset_t;
+
+static asset_t assets[MAX_ASSETS];
+static int numAssets = 0;
+
+static int gcd(int a, int b) {
+    while (b != 0) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/*
+ * A loop clicks if the jump from its last sample back to its first is
+ * bigger than any step it takes on the way round (plus a little for
+ * rounding).
+ */
+static bool seamless(const int16_t *samples, int count) {
+    int maxStep = 0;
+    int seam = abs(samples[0] - samples[count - 1]);
+    for (int i = 1; i < count; i++) {
+        int step = abs(samples[i] - samples[i - 1]);
+        maxStep = step > maxStep ? step : maxStep;
+    }
+    return seam <= maxStep + maxStep/8 + 256;
+}
+
+static bool make_tone(asset_t *asset, char *freqList, double db, int rate) {
+    int freqs[MAX_FREQS];
+    int numFreqs = 0;
+    int period = rate;
+    double amplitude = 32767*pow(10, db/20);
+    int16_t *pcm;
+    for (char *tok = strtok(freqList, "+"); tok != NULL; tok = strtok(NULL, "+")) {
+        char *end;
+        long freq = strtol(tok, &end, 10);
+        if (*end != 0 || freq <= 0 || freq >= rate/2 || numFreqs == MAX_FREQS) {
+            fprintf(stderr, "%s: %s isn't a frequency I can do. Whole Hz under %d, up to %d of them.\n", asset->name, tok, rate/2, MAX_FREQS);
+            return false;
+        }
+        freqs[numFreqs++] = freq;
+        period = gcd(period, freq);
+    }
+    if (numFreqs == 0 || amplitude*numFreqs > 32767) {
+        fprintf(stderr, "%s: Too loud. %d tones at %.1f dBFS each would clip.\n", asset->name, numFreqs, db);
+        return false;
+    }
+    /* Every tone goes round a whole number of times in rate/gcd samples. */
+    period = rate/period;
+    if ((pcm = malloc(period*sizeof(int16_t))) == NULL || (asset->data = malloc(period)) == NULL) {
+        return false;
+    }
+    for (int i = 0; i < period; i++) {
+        double sum = 0;
+        for (int f = 0; f < numFreqs; f++) {
+            sum += amplitude*sin(2*M_PI*freqs[f]*i/rate);
+        }
+        pcm[i] = (int16_t)lrint(sum);
+        /* 8-bit unsigned, what the modem takes. Rounded, not truncated. */
+        asset->data[i] = (uint8_t)((pcm[i] + 32768 + 128) >> 8 > 255 ? 255 : (pcm[i] + 32768 + 128) >> 8);
+    }
+    asset->size = period;
+    asset->count = period;
+    asset->rate = rate;
+    asset->loop = true;
+    if (!seamless(pcm, period)) {
+        fprintf(stderr, "%s: The period came out wrong. It clicks where it loops.\n", asset->name);
+        free(pcm);
+        return false;
+    }
+    free(pcm);
+    return true;
+}
+
+static uint32_t le32(const uint8_t *p) {
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint32_t le16(const uint8_t *p) {
+    return p[0] | p[1] << 8;
+}
+
+/* Read a mono PCM WAV into 16-bit samples. */
+static int16_t *read_wav(const char *path, uint32_t *count, uint32_t *rate) {
+    FILE *file = fopen(path, "rb");
+    uint8_t *buf;
+    long len;
+    size_t pos = 12;
+    int bits = 0;
+    int16_t *pcm = NULL;
+    if (file == NULL) {
+        perror(path);
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    len = ftell(file);
+    rewind(file);
+    if (len < 12 || (buf = malloc(len)) == NULL || fread(buf, 1, len, file) != (size_t)len) {
+        fprintf(stderr, "%s: Couldn't read it.\n", path);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+    if (memcmp(buf, "RIFF", 4) != 0 || memcmp(buf + 8, "WAVE", 4) != 0) {
+        fprintf(stderr, "%s: Not a WAV file.\n", path);
+        free(buf);
+        return NULL;
+    }
+    while (pos + 8 <= (size_t)len) {
+        uint32_t size = le32(buf + pos + 4);
+        if (memcmp(buf + pos, "fmt ", 4) == 0 && pos + 24 <= (size_t)len) {
+            if (le16(buf + pos + 8) != 1 || le16(buf + pos + 10) != 1) {
+                fprintf(stderr, "%s: Has to be mono PCM.\n", path);
+                break;
+            }
+            *rate = le32(buf + pos + 12);
+            bits = le16(buf + pos + 22);
+        } else if (memcmp(buf + pos, "data", 4) == 0 && (bits == 8 || bits == 16)) {
+            uint8_t *data = buf + pos + 8;
+            size = size < len - pos - 8 ? size : len - pos - 8;
+            *count = size/(bits/8);
+            if ((pcm = malloc(*count*sizeof(int16_t) + 1)) == NULL) {
+                break;
+            }
+            for (uint32_t i = 0; i < *count; i++) {
+                pcm[i] = bits == 8 ? (data[i] - 128) << 8 : (int16_t)le16(data + 2*i);
+            }
+            break;
+        }
+        pos += 8 + (size_t)size + (size & 1);
+    }
+    if (pcm == NULL && bits != 0 && bits != 8 && bits != 16) {
+        fprintf(stderr, "%s: Has to be 8 or 16-bit.\n", path);
+    } else if (pcm == NULL) {
+        fprintf(stderr, "%s: No audio in it.\n", path);
+    }
+    free(buf);
+    return pcm;
+}
+
+static const int imaIndex[16] = {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+static const int imaStep[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+/* IMA ADPCM, two samples a byte, low nibble first. decoded gets what dialin will unpack it to. */
+static void ima_encode(const int16_t *in, uint32_t count, uint8_t *out, int16_t *decoded) {
+    int predicted = 0;
+    int index = 0;
+    memset(out, 0, (count + 1)/2);
+    for (uint32_t i = 0; i < count; i++) {
+        int step = imaStep[index];
+        int diff = in[i] - predicted;
+        int code = 0;
+        int delta = step >> 3;
+        if (diff < 0) {
+            code = 8;
+            diff = -diff;
+        }
+        if (diff >= step) {
+            code |= 4;
+            diff -= step;
+            delta += step;
+        }
+        if (diff >= step >> 1) {
+            code |= 2;
+            diff -= step >> 1;
+            delta += step >> 1;
+        }
+        if (diff >= step >> 2) {
+            code |= 1;
+            delta += step >> 2;
+        }
+        predicted += code & 8 ? -delta : delta;
+        predicted = predicted > 32767 ? 32767 : predicted < -32768 ? -32768 : predicted;
+        index += imaIndex[code];
+        index = index < 0 ? 0 : index > 88 ? 88 : index;
+        out[i/2] |= i & 1 ? code << 4 : code;
+        decoded[i] = predicted;
+    }
+}
+
+static bool make_wav(asset_t *asset, const char *path, bool loop) {
+    int16_t *pcm = read_wav(path, &asset->count, &asset->rate);
+    int16_t *decoded;
+    if (pcm == NULL) {
+        return false;
+    }
+    asset->size = (asset->count + 1)/2;
+    asset->adpcm = true;
+    asset->loop = loop;
+    if ((asset->data = malloc(asset->size)) == NULL || (decoded = malloc(asset->count*sizeof(int16_t))) == NULL) {
+        free(pcm);
+        return false;
+    }
+    ima_encode(pcm, asset->count, asset->data, decoded);
+    free(pcm);
+    /* Check what dialin will actually play. */
+    if (loop && !seamless(decoded, asset->count)) {
+        fprintf(stderr, "%s: %s clicks where it loops. Trim it to a whole number of periods.\n", asset->name, path);
+        free(decoded);
+        return false;
+    }
+    free(decoded);
+    return true;
+}
+
+static bool load_list(const char *path) {
+    FILE *file = fopen(path, "r");
+    char line[512];
+    char dir[256] = ".";
+    const char *slash = strrchr(path, '/');
+    int lineNum = 0;
+    bool ok = true;
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+    if (slash != NULL) {
+        snprintf(dir, sizeof(dir), "%.*s", (int)(slash - path), path);
+    }
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char name[32], kind[8], arg[192], extra[16];
+        char *hash = strchr(line, '#');
+        asset_t *asset = &assets[numAssets];
+        int n;
+        lineNum++;
+        if (hash != NULL) {
+            *hash = 0;
+        }
+        line[strcspn(line, "\r\n")] = 0;
+        if ((n = sscanf(line, "%31s %7s %191s %15s", name, kind, arg, extra)) <= 0) {
+            continue;
+        }
+        if (numAssets == MAX_ASSETS) {
+            fprintf(stderr, "%s:%d: More than %d assets.\n", path, lineNum, MAX_ASSETS);
+            ok = false;
+            break;
+        }
+        memset(asset, 0, sizeof(*asset));
+        strcpy(asset->name, name);
+        snprintf(asset->source, sizeof(asset->source), "%s", line + strspn(line, " \t"));
+        if (n >= 3 && strcmp(kind, "tone") == 0) {
+            double db;
+            int rate = 8000;
+            char *rest = strstr(line, arg) + strlen(arg);
+            if (sscanf(rest, "%lf %d", &db, &rate) < 1 || !make_tone(asset, arg, db, rate)) {
+                fprintf(stderr, "%s:%d: Expected \"<name> tone <freq>[+<freq>...] <dBFS> [rate]\".\n", path, lineNum);
+                ok = false;
+                continue;
+            }
+        } else if (n >= 3 && strcmp(kind, "wav") == 0 && (n == 3 || strcmp(extra, "loop") == 0)) {
+            char wavPath[512];
+            snprintf(wavPath, sizeof(wavPath), "%s/%s", dir, arg);
+            if (!make_wav(asset, wavPath, n == 4)) {
+                ok = false;
+                continue;
+            }
+        } else {
+            fprintf(stderr, "%s:%d: Doesn't make sense.\n", path, lineNum);
+            ok = false;
+            continue;
+        }
+        numAssets++;
+    }
+    fclose(file);
+    return ok;
+}
+
+/* dialtone -> assetDialtone */
+static void var_name(char out[64], const char *prefix, const char *name, const char *suffix) {
+    snprintf(out, 64, "%s%.31s%s", prefix, name, suffix);
+    if (*prefix != 0) {
+        out[strlen(prefix)] = toupper((unsigned char)out[strlen(prefix)]);
+    }
+}
+
+static bool write_files(const char *list, const char *out) {
+    char path[512];
+    FILE *c, *h;
+    snprintf(path, sizeof(path), "%s.c", out);
+    if ((c = fopen(path, "w")) == NULL) {
+        perror(path);
+        return false;
+    }
+    snprintf(path, sizeof(path), "%s.h", out);
+    if ((h = fopen(path, "w")) == NULL) {
+        perror(path);
+        fclose(c);
+        return false;
+    }
+    fprintf(h, "/* Generated by tools/mkasset from %s. Don't edit it, edit that. */\n", list);
+    fprintf(h, "#ifndef ASSETS_H\n#define ASSETS_H\n#include \"audio.h\"\n\n");
+    fprintf(c, "/* Generated by tools/mkasset from %s. Don't edit it, edit that. */\n", list);
+    fprintf(c, "#include \"assets.h\"\n");
+    for (int i = 0; i < numAssets; i++) {
+        asset_t *asset = &assets[i];
+        char var[64], data[64];
+        var_name(var, "asset", asset->name, "");
+        var_name(data, "", asset->name, "Data");
+        fprintf(h, "/* %s */\nextern const packed_audio_t %s;\n", asset->source, var);
+        /* Page aligned, so each one's pages are its own and only get read in when it's unpacked. */
+        fprintf(c, "\n/* %s: %u samples at %u Hz%s. */\n", asset->source, asset->count, asset->rate,
+            asset->adpcm ? ", IMA ADPCM" : asset->loop ? ", one period" : "");
+        fprintf(c, "static const uint8_t %s[%u] __attribute__((aligned(%d))) = {", data, asset->size, PAGE_SIZE);
+        for (uint32_t j = 0; j < asset->size; j++) {
+            fprintf(c, "%s0x%02X%s", j % 12 == 0 ? "\n    " : "", asset->data[j], j + 1 < asset->size ? (j % 12 == 11 ? "," : ", ") : "");
+        }
+        fprintf(c, "\n};\n");
+        fprintf(c, "const packed_audio_t %s = {%s, %u, %u, %u, %s, %s};\n", var, data, asset->size, asset->count, asset->rate,
+            asset->adpcm ? "PACKED_IMA_ADPCM" : "PACKED_U8", asset->loop ? "true" : "false");
+    }
+    fprintf(h, "\n#endif\n");
+    fclose(c);
+    return fclose(h) == 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <asset list> <output>\n\nWrites <output>.c and <output>.h.\n", argv[0]);
+        return 1;
+    }
+    if (!load_list(argv[1]) || !write_files(argv[1], argv[2])) {
+        return 1;
+    }
+    for (int i = 0; i < numAssets; i++) {
+        printf("%-16s %7u samples at %5u Hz in %6u bytes%s\n", assets[i].name, assets[i].count, assets[i].rate, assets[i].size,
+            assets[i].loop ? ", loops cleanly" : "");
+    }
+    return 0;
+}
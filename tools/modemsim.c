@@ -0,0 +1,233 @@
+/* Simulated Hayes voice modems on ptys, for running dialin without real hardware.
+ * Build: cc -O2 -o modemsim tools/modemsim.c tools/sim.c -lm */
+
+#include <math.h>
+#include <time.h>
+#include <stdio.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include "sim.h"
+
+typedef struct {
+    char digits[32];
+    unsigned int dialWaitMs;
+    bool echo;
+    unsigned int holdSecs;
+    uint64_t *connectedAt;
+    /* Ring the lines instead of waiting for dialtone. */
+    char ringNumber[32];
+    char ringName[32];
+    int rings;
+    uint64_t *nextCallAt;
+} caller_t;
+
+static volatile sig_atomic_t running = 1;
+
+static void stop(int sig) {
+    (void)sig;
+    running = 0;
+}
+
+static void print_voice_stats(sim_line_t *line) {
+    sim_voice_stats_t *voice = &line->voice;
+    double secs;
+    double mean;
+    if (voice->writes < 2) {
+        return;
+    }
+    secs = (voice->lastUsec - voice->startUsec)/1000000.0;
+    mean = voice->gapSum/(voice->writes - 1);
+    printf("line %d: voice %" PRIu64 " bytes in %.2fs (%.0f samples/s), write gap %.1fms +/- %.1fms (max %.1fms), lead %" PRId64 " lag %" PRId64 " samples\n",
+        line->index, voice->bytes, secs, secs > 0 ? voice->bytes/secs : 0,
+        mean/1000, sqrt(voice->gapSqSum/(voice->writes - 1) - mean*mean)/1000, voice->gapMax/1000.0,
+        voice->maxLead, voice->maxLag);
+}
+
+static void on_mode(sim_line_t *line, sim_mode_t old, void *ctx) {
+    caller_t *caller = ctx;
+    printf("line %d: %s -> %s\n", line->index, sim_mode_name(old), sim_mode_name(line->mode));
+    if (old == SIM_VOICE_TX || old == SIM_VOICE_DUPLEX) {
+        print_voice_stats(line);
+    }
+    if ((line->mode == SIM_VOICE_TX || line->mode == SIM_VOICE_DUPLEX) && caller->digits[0]) {
+        sim_dial(line, caller->digits, caller->dialWaitMs, 150);
+    }
+    caller->connectedAt[line->index] = line->mode == SIM_DATA ? sim_usec() : 0;
+    fflush(stdout);
+}
+
+static void on_data(sim_line_t *line, const uint8_t *buf, size_t len, void *ctx) {
+    caller_t *caller = ctx;
+    if (caller->echo) {
+        sim_send(line, buf, len);
+    }
+}
+
+int main(int argc, char **argv) {
+    sim_config_t config = {
+        .latencyMs = 20,
+        .trainMs = 3000,
+        .baud = 0,
+        .connectCode = 18,
+        .failPct = 0,
+        .garbagePct = 0,
+        .guardMs = 1000
+    };
+    caller_t caller = {.dialWaitMs = 2000, .rings = 10};
+    sim_callbacks_t callbacks = {on_mode, on_data, &caller};
+    int numLines = 1;
+    char *listPath = NULL;
+    sim_line_t *lines;
+    int opt;
+    srand(time(NULL));
+    while ((opt = getopt(argc, argv, "n:l:t:b:c:f:g:G:V:d:w:eH:s:L:r:R:h")) != -1) {
+        switch (opt) {
+            case 'n':
+                numLines = atoi(optarg);
+                break;
+            case 'l':
+                config.latencyMs = atoi(optarg);
+                break;
+            case 't':
+                config.trainMs = atoi(optarg);
+                break;
+            case 'b':
+                config.baud = atoi(optarg);
+                break;
+            case 'c':
+                config.connectCode = atoi(optarg);
+                break;
+            case 'f':
+                config.failPct = atoi(optarg);
+                break;
+            case 'g':
+                config.garbagePct = atoi(optarg);
+                break;
+            case 'G':
+                config.guardMs = atoi(optarg);
+                break;
+            case 'V':
+                config.voiceFormats = optarg;
+                break;
+            case 'd':
+                strncpy(caller.digits, optarg, sizeof(caller.digits) - 1);
+                break;
+            case 'w':
+                caller.dialWaitMs = atoi(optarg);
+                break;
+            case 'e':
+                caller.echo = true;
+                break;
+            case 'H':
+                caller.holdSecs = atoi(optarg);
+                break;
+            case 's':
+                srand(atoi(optarg));
+                break;
+            case 'L':
+                listPath = optarg;
+                break;
+            case 'r':
+                /* number, or number:name */
+                sscanf(optarg, "%31[^:]:%31[^\n]", caller.ringNumber, caller.ringName);
+                break;
+            case 'R':
+                caller.rings = atoi(optarg);
+                break;
+            default:
+                fprintf(stderr,
+                    "Usage: %s [options...]\n\n"
+                    "Creates simulated voice modems on ptys and prints the TTY to give dialin for each one.\n\n"
+                    "-n <lines> : Number of modems. [Default: 1]\n"
+                    "-l <ms> : Delay before every response. [Default: 20]\n"
+                    "-t <ms> : Time from ATA to CONNECT. Half that after AT+MS. [Default: 3000]\n"
+                    "-b <baud> : Pace the lines at this rate in bits/s. [Default: no pacing]\n"
+                    "-c <code> : Numeric result code to CONNECT with. [Default: 18 (57600)]\n"
+                    "-f <percent> : Chance that a command fails. [Default: 0]\n"
+                    "-g <percent> : Chance that garbage gets sent in front of a response. [Default: 0]\n"
+                    "-G <ms> : +++ guard time. [Default: 1000]\n"
+                    "-V <list> : What AT+VSM=? lists, with ; between the lines. Example: 4,\"ULAW\",8,0,(7200)\n"
+                    "-d <digits> : Have a caller dial these digits once there's dialtone.\n"
+                    "-w <ms> : How long the caller listens to dialtone before dialing. [Default: 2000]\n"
+                    "-e : Echo data back during data calls.\n"
+                    "-H <secs> : Caller hangs up data calls after this long. [Default: never]\n"
+                    "-s <seed> : Random seed for failure and garbage injection.\n"
+                    "-L <file> : Also write the TTY paths to this file, one per line.\n"
+                    "-r <number>[:<name>] : Ring the lines with calls from this number (P for a withheld one) instead of dialing. Caller ID goes out if it's on.\n"
+                    "-R <rings> : How many times a call rings before the caller gives up. [Default: 10]\n",
+                    argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (numLines < 1) {
+        fputs("Need at least one line.\n", stderr);
+        return 1;
+    }
+
+    lines = calloc(numLines, sizeof(sim_line_t));
+    caller.connectedAt = calloc(numLines, sizeof(uint64_t));
+    caller.nextCallAt = calloc(numLines, sizeof(uint64_t));
+    if (lines == NULL || caller.connectedAt == NULL || caller.nextCallAt == NULL) {
+        fputs("Out of memory.\n", stderr);
+        return 1;
+    }
+    for (int i = 0; i < numLines; i++) {
+        if (sim_open(&lines[i], i, &config, &callbacks) != 0) {
+            perror("Couldn't create a pty");
+            return 1;
+        }
+        printf("line %d: %s\n", i, lines[i].slavePath);
+    }
+    if (listPath != NULL) {
+        FILE *list = fopen(listPath, "w");
+        if (list == NULL) {
+            perror(listPath);
+            return 1;
+        }
+        for (int i = 0; i < numLines; i++) {
+            fprintf(list, "%s\n", lines[i].slavePath);
+        }
+        fclose(list);
+    }
+    fflush(stdout);
+
+    signal(SIGINT, stop);
+    signal(SIGTERM, stop);
+    while (running) {
+        sim_poll(lines, numLines, 100);
+        if (caller.ringNumber[0]) {
+            uint64_t now = sim_usec();
+            for (int i = 0; i < numLines; i++) {
+                sim_line_t *line = &lines[i];
+                if (line->mode != SIM_COMMAND || line->offHook || line->ringsLeft > 0) {
+                    caller.nextCallAt[i] = 0;
+                } else if (caller.nextCallAt[i] == 0) {
+                    /* Give it a bit after the last call before the next one. */
+                    caller.nextCallAt[i] = now + caller.dialWaitMs*1000ULL;
+                } else if (now >= caller.nextCallAt[i]) {
+                    printf("line %d: ringing\n", i);
+                    fflush(stdout);
+                    sim_ring(line, caller.rings, strcmp(caller.ringNumber, "P") == 0 ? NULL : caller.ringNumber, caller.ringName);
+                }
+            }
+        }
+        if (caller.holdSecs > 0) {
+            uint64_t now = sim_usec();
+            for (int i = 0; i < numLines; i++) {
+                if (caller.connectedAt[i] != 0 && now - caller.connectedAt[i] >= caller.holdSecs*1000000ULL) {
+                    printf("line %d: caller hanging up\n", i);
+                    sim_hangup(&lines[i]);
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < numLines; i++) {
+        sim_close(&lines[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,240 @@
+/* Runs modem_loop() against a scripted modem in virtual time and checks the
+ * dialtone pacing, dial window, escape guard time and answer timeout.
+ * Build: cc -O2 -pthread -I. -o pacesim tools/pacesim.c modem.c clock.c voice.c at.c cdr.c log.c ring.c ppp.c md5.c hdlc.c dialplan.c relay.c slip.c netlink.c mp.c l2tp.c rfc2217.c linkstats.c watchdog.c linewatch.c callerid.c training.c linetest.c prompt.c audio.c assets.c record.c -lm */
+
+#include <stdio.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <sys/socket.h>
+#include "clock.h"
+#include "voice.h"
+#include "modem.h"
+
+typedef struct {
+    int fd;
+    bool voice;
+    bool dle;
+    bool dialed;
+    int calls;
+    char cmd[256];
+    size_t cmdLen;
+    /* Dialtone. */
+    uint64_t voiceStart;
+    uint64_t samples;
+    uint64_t samplesAtDigit;
+    int64_t maxLead;
+    int64_t maxLag;
+    /* When interesting things happened, in virtual us. */
+    uint64_t digitAt;
+    uint64_t etxAt;
+    uint64_t escapeAt;
+    int pluses;
+    uint64_t afterEscapeAt;
+    uint64_t ataAt;
+    uint64_t afterAtaAt;
+} fake_modem_t;
+
+static vclock_t vclock;
+static clock_impl_t simClock;
+static fake_modem_t fake;
+static uint64_t dialAfter = 3600ULL*1000000;
+static unsigned int jitterUsec = 0;
+
+static void reply(const char *str) {
+    write(fake.fd, str, strlen(str));
+}
+
+static void command(const char *cmd) {
+    uint64_t now = vclock.now;
+    if (fake.escapeAt != 0 && fake.afterEscapeAt == 0) {
+        fake.afterEscapeAt = now;
+    }
+    if (fake.ataAt != 0 && fake.afterAtaAt == 0) {
+        fake.afterAtaAt = now;
+    }
+    if (strstr(cmd, "AT+VTX") != NULL) {
+        fake.voice = true;
+        fake.voiceStart = now;
+        fake.samples = 0;
+        reply("1\r");
+    } else if (strstr(cmd, "ATA") != NULL) {
+        /* Never connect, so dialin has to time out. */
+        fake.ataAt = now;
+    } else if (strcmp(cmd, "ATH") == 0 && fake.calls > 0) {
+        /* One call is all we need. Make the next one fail so modem_loop() returns. */
+        reply("4\r");
+    } else {
+        reply("0\r");
+    }
+}
+
+/* Act like a modem: read whatever dialin wrote and answer it. */
+static void service(void) {
+    char buf[4096];
+    ssize_t bytes;
+    uint64_t now = vclock.now;
+    while ((bytes = read(fake.fd, buf, sizeof(buf))) > 0) {
+        for (ssize_t i = 0; i < bytes; i++) {
+            if (fake.voice && fake.samples == 0 && buf[i] == '\n') {
+                /* The end of the AT+VTX line. */
+                continue;
+            } else if (fake.voice) {
+                if (fake.dle) {
+                    fake.dle = false;
+                    if (buf[i] == ETX) {
+                        fake.voice = false;
+                        fake.etxAt = now;
+                        fake.calls++;
+                        /* No OK, like the modems that have to be escaped out of voice mode, so the guard time gets checked. */
+                    } else if (buf[i] == DLE) {
+                        fake.samples++;
+                    }
+                } else if (buf[i] == DLE) {
+                    fake.dle = true;
+                } else {
+                    fake.samples++;
+                }
+            } else if (buf[i] == '\r') {
+                fake.cmd[fake.cmdLen] = 0;
+                command(fake.cmd);
+                fake.cmdLen = 0;
+            } else if (buf[i] == '+' && fake.cmdLen == 0) {
+                if (fake.escapeAt == 0) {
+                    fake.escapeAt = now;
+                }
+                if (++fake.pluses == 3) {
+                    reply("0\r");
+                }
+            } else if (buf[i] != '\n' && fake.cmdLen < sizeof(fake.cmd) - 1) {
+                fake.cmd[fake.cmdLen++] = buf[i];
+            }
+        }
+    }
+    if (fake.voice && !fake.dialed && fake.samples > 0) {
+        /* How far dialin is ahead of or behind 8001 samples/s, not counting the second it sends up front. */
+        int64_t drift = (int64_t)fake.samples - 8001 - (int64_t)((now - fake.voiceStart)*8001/1000000);
+        if (drift > fake.maxLead) {
+            fake.maxLead = drift;
+        }
+        if (-drift > fake.maxLag) {
+            fake.maxLag = -drift;
+        }
+        if (!fake.dialed && now - fake.voiceStart >= dialAfter) {
+            char digits[] = {DLE, '5', DLE, '5', DLE, '5'};
+            fake.dialed = true;
+            fake.digitAt = now;
+            fake.samplesAtDigit = fake.samples;
+            write(fake.fd, digits, sizeof(digits));
+        }
+    }
+}
+
+static uint64_t sim_now(void *ctx) {
+    return vclock.impl.now(ctx);
+}
+
+static int64_t sim_wall(void *ctx) {
+    return vclock.impl.wall(ctx);
+}
+
+static void sim_sleep(void *ctx, uint64_t usec) {
+    service();
+    vclock.impl.sleep(ctx, usec);
+    service();
+}
+
+static int sim_poll(void *ctx, struct pollfd *fds, int numFds, uint64_t usec) {
+    int res;
+    service();
+    if ((res = vclock.impl.poll(ctx, fds, numFds, 0)) != 0) {
+        return res;
+    }
+    /* Things never wake up exactly on time. */
+    vclock_advance(&vclock, usec + (jitterUsec ? rand() % jitterUsec : 0));
+    service();
+    return vclock.impl.poll(ctx, fds, numFds, 0);
+}
+
+static bool check(const char *what, double got, double want, double tolerance, const char *unit) {
+    bool ok = got >= want - tolerance && got <= want + tolerance;
+    printf("%-28s %12.3f %s (want %.3f +/- %.3f) %s\n", what, got, unit, want, tolerance, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    modem_t modem = {0};
+    int sv[2];
+    int opt;
+    bool ok = true;
+    double hours = 1;
+    uint64_t wallStart;
+    double secs;
+    while ((opt = getopt(argc, argv, "H:j:h")) != -1) {
+        switch (opt) {
+            case 'H':
+                hours = atof(optarg);
+                break;
+            case 'j':
+                jitterUsec = atoi(optarg);
+                break;
+            default:
+                fprintf(stderr,
+                    "Usage: %s [-H <hours>] [-j <us>]\n\n"
+                    "-H <hours> : Simulated time to send dialtone for. [Default: 1]\n"
+                    "-j <us> : Wake up to this much late from every wait. [Default: 0]\n",
+                    argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    dialAfter = (uint64_t)(hours*3600*1000000);
+
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0) {
+        perror("socketpair");
+        return 1;
+    }
+    fcntl(sv[1], F_SETFL, O_NONBLOCK);
+    fake.fd = sv[1];
+    modem.fd = sv[0];
+    strcpy(modem.tag, "sim");
+    strcpy(modem.path, "/dev/null");
+    modem.rate = 115200;
+
+    vclock_init(&vclock, 1000000);
+    simClock = vclock.impl;
+    simClock.now = sim_now;
+    simClock.wall = sim_wall;
+    simClock.sleep = sim_sleep;
+    simClock.poll = sim_poll;
+
+    /* Real time, just for the report. */
+    wallStart = clock_usec();
+    clock_set(&simClock);
+    modem_loop(&modem);
+    clock_set(NULL);
+    secs = (clock_usec() - wallStart)/1000000.0;
+
+    if (fake.etxAt == 0) {
+        puts("The dialtone never stopped!");
+        return 1;
+    }
+    {
+        double voiceSecs = (fake.digitAt - fake.voiceStart)/1000000.0;
+        double rate = (fake.samplesAtDigit - 8001)/voiceSecs;
+        printf("%.0f simulated seconds in %.3f real seconds\n", vclock.now/1000000.0, secs);
+        /* We only look at the line every 50ms, so a tick behind (plus a sample of rounding, plus the jitter) is fine. */
+        double maxLag = 401 + jitterUsec*8/1000.0;
+        /* The rate's measured up to the digit, which can catch us that far behind. Over a short run that's a lot. */
+        ok &= check("dialtone rate", rate, 8001, 0.5 + maxLag/voiceSecs, "samples/s");
+        ok &= check("dialtone max lead", fake.maxLead, 0, 400, "samples");
+        ok &= check("dialtone max lag", fake.maxLag, 0, maxLag, "samples");
+    }
+    ok &= check("dial window", (fake.etxAt - fake.digitAt)/1000000.0, DIAL_WAIT_MS/1000.0, 0.1, "s");
+    ok &= check("escape guard time", (fake.afterEscapeAt - fake.escapeAt)/1000000.0, 1.1, 0.05, "s");
+    /* One try at 1s, then 60 more. */
+    ok &= check("answer timeout", (fake.afterAtaAt - fake.ataAt)/1000000.0, 61, 1.5, "s");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,784 @@
+#define _GNU_SOURCE
+#include <time.h>
+#include <poll.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <termios.h>
+#include "sim.h"
+
+#define DLE 0x10
+#define ETX 0x03
+
+/* Numeric result codes. */
+#define RES_OK 0
+#define RES_CONNECT 1
+#define RES_RING 2
+#define RES_NO_CARRIER 3
+#define RES_ERROR 4
+#define RING_GAP_USEC 6000000
+
+uint64_t sim_usec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000 + ts.tv_nsec/1000;
+}
+
+const char *sim_mode_name(sim_mode_t mode) {
+    switch (mode) {
+        case SIM_COMMAND: return "command";
+        case SIM_VOICE_TX: return "voice tx";
+        case SIM_VOICE_DUPLEX: return "voice duplex";
+        case SIM_ANSWERING: return "answering";
+        case SIM_DATA: return "data";
+        case SIM_ONLINE_COMMAND: return "online command";
+        default: return "?";
+    }
+}
+
+static bool chance(unsigned int pct) {
+    return pct > 0 && (unsigned int)(rand() % 100) < pct;
+}
+
+static void set_mode(sim_line_t *line, sim_mode_t mode) {
+    sim_mode_t old = line->mode;
+    if (old == mode) {
+        return;
+    }
+    line->mode = mode;
+    line->dle = false;
+    line->hangupPending = false;
+    line->plusCount = 0;
+    if (mode == SIM_VOICE_TX || mode == SIM_VOICE_DUPLEX) {
+        memset(&line->voice, 0, sizeof(line->voice));
+        line->loopLevel = 0;
+    }
+    if (line->callbacks.on_mode != NULL) {
+        line->callbacks.on_mode(line, old, line->callbacks.ctx);
+    }
+}
+
+/* Straight into the output FIFO. */
+static void queue_out(sim_line_t *line, const void *data, size_t len) {
+    const uint8_t *p = data;
+    for (size_t i = 0; i < len && line->outLen < SIM_OUT_MAX; i++) {
+        line->out[(line->outHead + line->outLen) % SIM_OUT_MAX] = p[i];
+        line->outLen++;
+    }
+}
+
+/* Held back for the response latency. */
+static void queue_response(sim_line_t *line, const char *data, size_t len) {
+    sim_pending_t *pending;
+    if (line->numPending >= SIM_PENDING_MAX) {
+        return;
+    }
+    pending = &line->pending[line->numPending++];
+    pending->due = sim_usec() + line->config->latencyMs*1000;
+    pending->len = 0;
+    if (chance(line->config->garbagePct)) {
+        int count = 1 + rand() % 8;
+        for (int i = 0; i < count; i++) {
+            pending->data[pending->len++] = rand() & 0xFF;
+        }
+    }
+    if (len > sizeof(pending->data) - pending->len) {
+        len = sizeof(pending->data) - pending->len;
+    }
+    memcpy(pending->data + pending->len, data, len);
+    pending->len += len;
+}
+
+static unsigned int connect_rate(int code) {
+    switch (code) {
+        case 5: return 1200;
+        case 10: return 2400;
+        case 11: return 4800;
+        case 12: return 9600;
+        case 15: return 14400;
+        case 16: return 19200;
+        case 17: return 38400;
+        case 18: return 57600;
+        case 19: return 115200;
+        case 64: return 28800;
+        case 84: return 33600;
+        default: return 0;
+    }
+}
+
+static void respond(sim_line_t *line, int code) {
+    char buf[48];
+    int len;
+    if (line->verbose) {
+        const char *text;
+        switch (code) {
+            case RES_OK: text = "OK"; break;
+            case RES_RING: text = "RING"; break;
+            case RES_NO_CARRIER: text = "NO CARRIER"; break;
+            case RES_ERROR: text = "ERROR"; break;
+            default: text = "CONNECT"; break;
+        }
+        if (code != RES_CONNECT && connect_rate(code) != 0) {
+            len = snprintf(buf, sizeof(buf), "\r\nCONNECT %u\r\n", connect_rate(code));
+        } else {
+            len = snprintf(buf, sizeof(buf), "\r\n%s\r\n", text);
+        }
+    } else {
+        len = snprintf(buf, sizeof(buf), "%d\r", code);
+    }
+    queue_response(line, buf, len);
+}
+
+static void respond_text(sim_line_t *line, const char *text) {
+    char buf[64];
+    int len = snprintf(buf, sizeof(buf), "\r\n%s\r\n", text);
+    queue_response(line, buf, len);
+}
+
+static void reset(sim_line_t *line) {
+    line->echo = true;
+    line->verbose = true;
+    line->offHook = false;
+    line->fclass = 0;
+    line->callerId = false;
+    line->carrierSet = false;
+    line->reportCarrier = false;
+    memset(line->regs, 0, sizeof(line->regs));
+    /* Escape guard time in 1/50ths of a second. */
+    line->regs[12] = line->config->guardMs/20;
+    line->dialPos = 0;
+    line->dial[0] = 0;
+    set_mode(line, SIM_COMMAND);
+}
+
+static int parse_num(const char **p, int def) {
+    if (!isdigit((unsigned char)**p)) {
+        return def;
+    }
+    return (int)strtol(*p, (char**)p, 10);
+}
+
+/* Extended (AT+...) commands. Returns the result code, or -1 if we shouldn't respond yet. */
+static int extended_cmd(sim_line_t *line, const char **p) {
+    char name[16];
+    size_t len = 0;
+    bool query = false;
+    bool set = false;
+    int value = 0;
+    while (isalnum((unsigned char)**p) && len < sizeof(name) - 1) {
+        name[len++] = toupper((unsigned char)*(*p)++);
+    }
+    name[len] = 0;
+    if (**p == '=') {
+        (*p)++;
+        if (**p == '?') {
+            (*p)++;
+            query = true;
+        } else {
+            set = true;
+            value = parse_num(p, 0);
+        }
+    } else if (**p == '?') {
+        (*p)++;
+        query = true;
+    }
+    /* Skip the rest of the arguments (e.g. AT+VSM=1,8000). */
+    while (**p && **p != ';') {
+        (*p)++;
+    }
+    if (**p == ';') {
+        (*p)++;
+    }
+
+    if (strcmp(name, "FCLASS") == 0) {
+        if (query) {
+            char buf[16];
+            snprintf(buf, sizeof(buf), "%d", line->fclass);
+            respond_text(line, buf);
+        } else if (set) {
+            if (value != 0 && value != 1 && value != 8) {
+                return RES_ERROR;
+            }
+            line->fclass = value;
+        }
+        return RES_OK;
+    }
+    if (strcmp(name, "VLS") == 0) {
+        if (line->fclass != 8) {
+            return RES_ERROR;
+        }
+        line->offHook = set && value != 0;
+        return RES_OK;
+    }
+    if (strcmp(name, "VTX") == 0) {
+        if (line->fclass != 8 || !line->offHook) {
+            return RES_ERROR;
+        }
+        set_mode(line, SIM_VOICE_TX);
+        return RES_CONNECT;
+    }
+    if (strcmp(name, "VTR") == 0) {
+        if (line->fclass != 8 || !line->offHook) {
+            return RES_ERROR;
+        }
+        set_mode(line, SIM_VOICE_DUPLEX);
+        return RES_CONNECT;
+    }
+    if (strcmp(name, "VCID") == 0) {
+        if (set) {
+            line->callerId = value != 0;
+        }
+        return RES_OK;
+    }
+    if (strcmp(name, "MS") == 0) {
+        if (set) {
+            line->carrierSet = true;
+        }
+        return RES_OK;
+    }
+    if (strcmp(name, "MR") == 0) {
+        if (set) {
+            line->reportCarrier = value != 0;
+        }
+        return RES_OK;
+    }
+    if (strcmp(name, "VSM") == 0 && query && line->config->voiceFormats != NULL) {
+        const char *p = line->config->voiceFormats;
+        while (*p) {
+            char buf[56];
+            size_t len = strcspn(p, ";");
+            snprintf(buf, sizeof(buf), "%.*s", (int)len, p);
+            respond_text(line, buf);
+            p += len + (p[len] == ';');
+        }
+        return RES_OK;
+    }
+    if (strcmp(name, "VSM") == 0 || strcmp(name, "VSD") == 0 ||
+        strcmp(name, "VIT") == 0 || strcmp(name, "VGT") == 0 || strcmp(name, "VGR") == 0) {
+        if (set && line->fclass != 8) {
+            return RES_ERROR;
+        }
+        return RES_OK;
+    }
+    return RES_ERROR;
+}
+
+static void execute(sim_line_t *line, const char *cmd) {
+    const char *p = cmd + 2;
+    int res = RES_OK;
+    while (*p && res == RES_OK) {
+        char c = toupper((unsigned char)*p++);
+        int n;
+        switch (c) {
+            case ' ':
+                break;
+            case 'Z':
+                parse_num(&p, 0);
+                reset(line);
+                break;
+            case 'E':
+                line->echo = parse_num(&p, 0) != 0;
+                break;
+            case 'V':
+                line->verbose = parse_num(&p, 0) != 0;
+                break;
+            case 'H':
+                n = parse_num(&p, 0);
+                line->offHook = n != 0;
+                if (n == 0) {
+                    set_mode(line, SIM_COMMAND);
+                }
+                break;
+            case 'M':
+            case 'L':
+            case 'Q':
+            case 'X':
+            case 'W':
+                parse_num(&p, 0);
+                break;
+            case '&':
+                if (*p) {
+                    p++;
+                }
+                parse_num(&p, 0);
+                break;
+            case 'S':
+                n = parse_num(&p, 0);
+                if (*p == '=') {
+                    p++;
+                    if (n < 32) {
+                        line->regs[n] = parse_num(&p, 0);
+                    }
+                } else if (*p == '?') {
+                    char buf[8];
+                    p++;
+                    snprintf(buf, sizeof(buf), "%03d", n < 32 ? line->regs[n] : 0);
+                    respond_text(line, buf);
+                }
+                break;
+            case 'I':
+                parse_num(&p, 0);
+                respond_text(line, "DialIn modemsim");
+                break;
+            case 'A':
+                if (chance(line->config->failPct)) {
+                    res = RES_NO_CARRIER;
+                    break;
+                }
+                line->offHook = true;
+                line->connectAt = sim_usec() + (line->carrierSet ? line->config->trainMs/2 : line->config->trainMs)*1000;
+                set_mode(line, SIM_ANSWERING);
+                return;
+            case 'O':
+                parse_num(&p, 0);
+                if (line->mode != SIM_ONLINE_COMMAND) {
+                    res = RES_NO_CARRIER;
+                    break;
+                }
+                set_mode(line, SIM_DATA);
+                respond(line, line->config->connectCode);
+                return;
+            case '+':
+                res = extended_cmd(line, &p);
+                if (res == RES_CONNECT) {
+                    respond(line, res);
+                    return;
+                }
+                break;
+            default:
+                res = RES_ERROR;
+                break;
+        }
+    }
+    if (res == RES_OK && chance(line->config->failPct)) {
+        res = RES_ERROR;
+    }
+    respond(line, res);
+}
+
+static void input(sim_line_t *line, const uint8_t *buf, size_t len, uint64_t now);
+
+static void command_input(sim_line_t *line, const uint8_t *buf, size_t len, uint64_t now) {
+    for (size_t i = 0; i < len; i++) {
+        char c = buf[i];
+        if (line->echo) {
+            queue_out(line, &c, 1);
+        }
+        if (c == '\r') {
+            char *at;
+            line->cmd[line->cmdLen] = 0;
+            /* Ignore any junk in front of the AT. */
+            if ((at = strcasestr(line->cmd, "AT")) != NULL) {
+                execute(line, at);
+            }
+            line->cmdLen = 0;
+            /* Whatever comes after the command belongs to the new mode, but the LF that ends the line. */
+            if (line->mode != SIM_COMMAND && line->mode != SIM_ONLINE_COMMAND) {
+                if (i + 1 < len && buf[i + 1] == '\n') {
+                    i++;
+                }
+                input(line, buf + i + 1, len - i - 1, now);
+                return;
+            }
+        } else if (c == '\b' || c == 0x7F) {
+            if (line->cmdLen > 0) {
+                line->cmdLen--;
+            }
+        } else if (c != '\n' && line->cmdLen < SIM_CMD_MAX - 1) {
+            line->cmd[line->cmdLen++] = c;
+        }
+    }
+}
+
+/* The far end of a full duplex call is a loopback, on a line that loses 6 dB and some of the top end. */
+static void loop_back(sim_line_t *line, uint8_t sample) {
+    uint8_t out[2] = {DLE, DLE};
+    line->loopLevel += 0.85f*((sample - 128)/2.0f - line->loopLevel);
+    out[1] = (uint8_t)((int)(line->loopLevel + 128.5f) + rand() % 3 - 1);
+    /* DLEs in the audio get doubled. */
+    queue_out(line, out[1] == DLE ? out : out + 1, out[1] == DLE ? 2 : 1);
+}
+
+static void voice_input(sim_line_t *line, const uint8_t *buf, size_t len, uint64_t now) {
+    sim_voice_stats_t *voice = &line->voice;
+    size_t samples = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (line->dle) {
+            line->dle = false;
+            if (buf[i] == DLE) {
+                samples++;
+                if (line->mode == SIM_VOICE_DUPLEX) {
+                    loop_back(line, DLE);
+                }
+            } else if (buf[i] == ETX) {
+                set_mode(line, SIM_COMMAND);
+                respond(line, RES_OK);
+                command_input(line, buf + i + 1, len - i - 1, now);
+                break;
+            }
+        } else if (buf[i] == DLE) {
+            line->dle = true;
+        } else {
+            samples++;
+            if (line->mode == SIM_VOICE_DUPLEX) {
+                loop_back(line, buf[i]);
+            }
+        }
+    }
+    if (samples == 0) {
+        return;
+    }
+    if (voice->writes == 0) {
+        voice->startUsec = now;
+    } else {
+        uint64_t gap = now - voice->lastUsec;
+        int64_t expected = (int64_t)((now - voice->startUsec)*8000/1000000);
+        int64_t drift;
+        voice->gapSum += gap;
+        voice->gapSqSum += (double)gap*gap;
+        if (gap > voice->gapMax) {
+            voice->gapMax = gap;
+        }
+        drift = (int64_t)voice->bytes - expected;
+        if (drift > voice->maxLead) {
+            voice->maxLead = drift;
+        }
+        if (-drift > voice->maxLag) {
+            voice->maxLag = -drift;
+        }
+    }
+    voice->bytes += samples;
+    voice->writes++;
+    voice->lastUsec = now;
+}
+
+static void flush_pluses(sim_line_t *line) {
+    static const uint8_t pluses[] = "+++";
+    if (line->plusCount > 0 && line->callbacks.on_data != NULL) {
+        line->callbacks.on_data(line, pluses, line->plusCount, line->callbacks.ctx);
+    }
+    line->plusCount = 0;
+}
+
+static void data_input(sim_line_t *line, const uint8_t *buf, size_t len, uint64_t now) {
+    size_t start = 0;
+    unsigned int guard = line->regs[12]*20000;
+    for (size_t i = 0; i < len; i++) {
+        /* +++ only counts with guard time before it. */
+        if (buf[i] == '+' && line->plusCount < 3 &&
+            (line->plusCount > 0 || (i == 0 && now - line->lastRx >= guard))) {
+            if (i > start && line->callbacks.on_data != NULL) {
+                line->callbacks.on_data(line, buf + start, i - start, line->callbacks.ctx);
+            }
+            line->plusCount++;
+            line->plusTime = now;
+            start = i + 1;
+        } else if (line->plusCount > 0) {
+            flush_pluses(line);
+        }
+    }
+    if (len > start && line->callbacks.on_data != NULL) {
+        line->callbacks.on_data(line, buf + start, len - start, line->callbacks.ctx);
+    }
+    line->lastRx = now;
+}
+
+static void input(sim_line_t *line, const uint8_t *buf, size_t len, uint64_t now) {
+    switch (line->mode) {
+        case SIM_COMMAND:
+        case SIM_ONLINE_COMMAND:
+            command_input(line, buf, len, now);
+            break;
+        case SIM_VOICE_TX:
+        case SIM_VOICE_DUPLEX:
+            voice_input(line, buf, len, now);
+            break;
+        case SIM_ANSWERING:
+            /* Any character (but the end of the ATA line) aborts answering. */
+            for (size_t i = 0; i < len; i++) {
+                if (buf[i] != '\r' && buf[i] != '\n') {
+                    set_mode(line, SIM_COMMAND);
+                    respond(line, RES_NO_CARRIER);
+                    break;
+                }
+            }
+            break;
+        case SIM_DATA:
+            data_input(line, buf, len, now);
+            break;
+    }
+}
+
+int sim_open(sim_line_t *line, int index, const sim_config_t *config, const sim_callbacks_t *callbacks) {
+    struct termios tty;
+    memset(line, 0, sizeof(*line));
+    line->index = index;
+    line->config = config;
+    if (callbacks != NULL) {
+        line->callbacks = *callbacks;
+    }
+    line->master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (line->master < 0) {
+        return -1;
+    }
+    if (grantpt(line->master) != 0 || unlockpt(line->master) != 0 ||
+        ptsname_r(line->master, line->slavePath, sizeof(line->slavePath)) != 0) {
+        close(line->master);
+        return -2;
+    }
+    /* Hold the slave open so the master doesn't see EIO whenever the DTE closes it. */
+    line->slave = open(line->slavePath, O_RDWR | O_NOCTTY);
+    if (line->slave < 0) {
+        close(line->master);
+        return -3;
+    }
+    /* A serial port doesn't mangle anything on its own. */
+    tcgetattr(line->slave, &tty);
+    cfmakeraw(&tty);
+    tcsetattr(line->slave, TCSANOW, &tty);
+    fcntl(line->master, F_SETFL, fcntl(line->master, F_GETFL) | O_NONBLOCK);
+    line->lastTick = sim_usec();
+    line->lastRx = line->lastTick;
+    reset(line);
+    return 0;
+}
+
+void sim_close(sim_line_t *line) {
+    close(line->master);
+    close(line->slave);
+}
+
+void sim_dial(sim_line_t *line, const char *digits, unsigned int delayMs, unsigned int gapMs) {
+    strncpy(line->dial, digits, sizeof(line->dial) - 1);
+    line->dial[sizeof(line->dial) - 1] = 0;
+    line->dialPos = 0;
+    line->dialGapMs = gapMs;
+    line->nextDigit = sim_usec() + delayMs*1000;
+}
+
+bool sim_send(sim_line_t *line, const void *buf, size_t len) {
+    /* Data can't get ahead of the CONNECT. */
+    if (line->mode != SIM_DATA || line->numPending > 0 || SIM_OUT_MAX - line->outLen < len) {
+        return false;
+    }
+    queue_out(line, buf, len);
+    return true;
+}
+
+void sim_hangup(sim_line_t *line) {
+    if (line->mode == SIM_DATA || line->mode == SIM_ONLINE_COMMAND || line->mode == SIM_ANSWERING) {
+        /* Let whatever the caller already sent get there first. */
+        if (line->mode == SIM_DATA && line->outLen > 0) {
+            line->hangupPending = true;
+            return;
+        }
+        line->hangupPending = false;
+        line->offHook = false;
+        set_mode(line, SIM_COMMAND);
+        respond(line, RES_NO_CARRIER);
+    }
+}
+
+void sim_ring(sim_line_t *line, int rings, const char *number, const char *name) {
+    line->ringsLeft = rings;
+    line->firstRing = true;
+    line->nextRing = sim_usec();
+    snprintf(line->cidNumber, sizeof(line->cidNumber), "%s", number != NULL ? number : "");
+    snprintf(line->cidName, sizeof(line->cidName), "%s", name != NULL ? name : "");
+}
+
+/* Caller ID the way most voice modems pass it on: a line per field, between the first and second ring. */
+static void send_caller_id(sim_line_t *line) {
+    char buf[64];
+    time_t now = time(NULL);
+    struct tm tm;
+    localtime_r(&now, &tm);
+    snprintf(buf, sizeof(buf), "DATE = %02d%02d", tm.tm_mon + 1, tm.tm_mday);
+    respond_text(line, buf);
+    snprintf(buf, sizeof(buf), "TIME = %02d%02d", tm.tm_hour, tm.tm_min);
+    respond_text(line, buf);
+    snprintf(buf, sizeof(buf), "NMBR = %s", line->cidNumber[0] ? line->cidNumber : "P");
+    respond_text(line, buf);
+    if (line->cidName[0]) {
+        snprintf(buf, sizeof(buf), "NAME = %s", line->cidName);
+        respond_text(line, buf);
+    }
+}
+
+static void add_budget(int64_t *budget, unsigned int baud, uint64_t elapsed) {
+    /* Don't let the bucket fill past 20ms of data. */
+    int64_t max = (int64_t)baud/10*20000;
+    *budget += (int64_t)baud/10*elapsed;
+    if (max < 64*1000000LL) {
+        max = 64*1000000LL;
+    }
+    if (*budget > max) {
+        *budget = max;
+    }
+}
+
+int sim_tick(sim_line_t *line, uint64_t now) {
+    uint8_t buf[4096];
+    uint64_t next = now + 10000;
+    unsigned int baud = line->config->baud;
+
+    if (baud != 0) {
+        add_budget(&line->txBudget, baud, now - line->lastTick);
+        add_budget(&line->rxBudget, baud, now - line->lastTick);
+    }
+    line->lastTick = now;
+
+    /* Responses that are due. */
+    for (int i = 0; i < line->numPending;) {
+        if (line->pending[i].due <= now) {
+            queue_out(line, line->pending[i].data, line->pending[i].len);
+            memmove(&line->pending[i], &line->pending[i + 1], (line->numPending - i - 1)*sizeof(sim_pending_t));
+            line->numPending--;
+        } else {
+            if (line->pending[i].due < next) {
+                next = line->pending[i].due;
+            }
+            i++;
+        }
+    }
+
+    /* Done training. */
+    if (line->mode == SIM_ANSWERING) {
+        if (now >= line->connectAt) {
+            set_mode(line, SIM_DATA);
+            line->lastRx = now;
+            if (line->reportCarrier) {
+                respond_text(line, "+MCR: V34");
+                respond_text(line, "+MRR: 28800");
+            }
+            respond(line, line->config->connectCode);
+        } else if (line->connectAt < next) {
+            next = line->connectAt;
+        }
+    }
+
+    /* Incoming call. Picking up stops the ringing. */
+    if (line->ringsLeft > 0 && (line->offHook || line->mode != SIM_COMMAND)) {
+        line->ringsLeft = 0;
+    }
+    if (line->ringsLeft > 0) {
+        if (now >= line->nextRing) {
+            respond(line, RES_RING);
+            if (line->firstRing && line->callerId) {
+                send_caller_id(line);
+            }
+            line->firstRing = false;
+            line->ringsLeft--;
+            line->nextRing = now + RING_GAP_USEC;
+        }
+        if (line->ringsLeft > 0 && line->nextRing < next) {
+            next = line->nextRing;
+        }
+    }
+
+    /* Caller dialing. */
+    if ((line->mode == SIM_VOICE_TX || line->mode == SIM_VOICE_DUPLEX) && line->dial[line->dialPos] != 0) {
+        if (now >= line->nextDigit) {
+            uint8_t event[2] = {DLE, line->dial[line->dialPos++]};
+            queue_out(line, event, sizeof(event));
+            line->nextDigit = now + line->dialGapMs*1000;
+        }
+        if (line->nextDigit < next) {
+            next = line->nextDigit;
+        }
+    }
+
+    /* Guard time after +++ */
+    if (line->mode == SIM_DATA && line->plusCount == 3) {
+        uint64_t at = line->plusTime + line->regs[12]*20000;
+        if (now >= at) {
+            line->plusCount = 0;
+            set_mode(line, SIM_ONLINE_COMMAND);
+            respond(line, RES_OK);
+        } else if (at < next) {
+            next = at;
+        }
+    }
+
+    /* From the DTE. */
+    while (baud == 0 || line->rxBudget >= 1000000) {
+        size_t max = sizeof(buf);
+        ssize_t bytes;
+        if (baud != 0 && (size_t)(line->rxBudget/1000000) < max) {
+            max = line->rxBudget/1000000;
+        }
+        bytes = read(line->master, buf, max);
+        if (bytes <= 0) {
+            break;
+        }
+        if (baud != 0) {
+            line->rxBudget -= bytes*1000000LL;
+        }
+        input(line, buf, bytes, now);
+    }
+
+    /* To the DTE. */
+    while (line->outLen > 0 && (baud == 0 || line->txBudget >= 1000000)) {
+        size_t len = SIM_OUT_MAX - line->outHead;
+        ssize_t bytes;
+        if (len > line->outLen) {
+            len = line->outLen;
+        }
+        if (baud != 0 && (size_t)(line->txBudget/1000000) < len) {
+            len = line->txBudget/1000000;
+        }
+        bytes = write(line->master, line->out + line->outHead, len);
+        if (bytes <= 0) {
+            break;
+        }
+        line->outHead = (line->outHead + bytes) % SIM_OUT_MAX;
+        line->outLen -= bytes;
+        if (baud != 0) {
+            line->txBudget -= bytes*1000000LL;
+        }
+    }
+    if (line->hangupPending && line->outLen == 0) {
+        sim_hangup(line);
+    }
+    if (line->outLen > 0 && baud != 0) {
+        next = now + 1000;
+    }
+    return next > now ? (int)((next - now + 999)/1000) : 0;
+}
+
+void sim_poll(sim_line_t *lines, int numLines, int timeoutMs) {
+    struct pollfd *fds = calloc(numLines, sizeof(struct pollfd));
+    uint64_t now = sim_usec();
+    int wait = timeoutMs;
+    if (fds == NULL) {
+        return;
+    }
+    for (int i = 0; i < numLines; i++) {
+        int next = sim_tick(&lines[i], now);
+        if (next < wait) {
+            wait = next;
+        }
+        fds[i].fd = lines[i].master;
+        fds[i].events = 0;
+        if (lines[i].config->baud == 0 || lines[i].rxBudget >= 1000000) {
+            fds[i].events |= POLLIN;
+        } else if (wait > 1) {
+            wait = 1;
+        }
+        if (lines[i].outLen > 0) {
+            fds[i].events |= POLLOUT;
+        }
+    }
+    poll(fds, numLines, wait);
+    now = sim_usec();
+    for (int i = 0; i < numLines; i++) {
+        if (fds[i].revents != 0) {
+            sim_tick(&lines[i], now);
+        }
+    }
+    free(fds);
+}
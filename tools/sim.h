@@ -0,0 +1,148 @@
+#ifndef SIM_H
+#define SIM_H
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Simulated Hayes voice modem on a pty. The DTE (dialin) opens slavePath. */
+
+typedef enum {
+    SIM_COMMAND = 0,
+    /* Sending audio to the caller (AT+VTX). */
+    SIM_VOICE_TX,
+    /* Sending and receiving audio at once (AT+VTR). The caller's a loopback. */
+    SIM_VOICE_DUPLEX,
+    /* ATA sent, training. */
+    SIM_ANSWERING,
+    SIM_DATA,
+    /* Escaped out of a data call with +++. */
+    SIM_ONLINE_COMMAND
+} sim_mode_t;
+
+typedef struct {
+    /* Delay before every response. */
+    unsigned int latencyMs;
+    /* Time from ATA until CONNECT. */
+    unsigned int trainMs;
+    /* Rate the line is paced at in both directions (bits/s). 0 for no pacing. */
+    unsigned int baud;
+    /* Numeric result code to send for CONNECT. */
+    int connectCode;
+    /* Chance (in %) a command fails, and that garbage gets thrown in front of a response. */
+    unsigned int failPct;
+    unsigned int garbagePct;
+    /* Guard time around +++ */
+    unsigned int guardMs;
+    /* What AT+VSM=? lists, with ; between the lines. NULL to list nothing. */
+    const char *voiceFormats;
+} sim_config_t;
+
+typedef struct sim_line sim_line_t;
+
+typedef struct {
+    /* The line changed mode. */
+    void (*on_mode)(sim_line_t *line, sim_mode_t old, void *ctx);
+    /* Data the DTE sent to the caller during a data call. */
+    void (*on_data)(sim_line_t *line, const uint8_t *buf, size_t len, void *ctx);
+    void *ctx;
+} sim_callbacks_t;
+
+/* Voice transmit pacing stats, relative to 8000 samples/s. */
+typedef struct {
+    uint64_t bytes;
+    uint64_t writes;
+    uint64_t startUsec;
+    uint64_t lastUsec;
+    /* Gaps between reads with data in them. */
+    double gapSum;
+    double gapSqSum;
+    uint64_t gapMax;
+    /* How far ahead of or behind 8000 samples/s the DTE got, in samples. */
+    int64_t maxLead;
+    int64_t maxLag;
+} sim_voice_stats_t;
+
+#define SIM_CMD_MAX 256
+#define SIM_OUT_MAX 65536
+#define SIM_PENDING_MAX 16
+
+typedef struct {
+    uint64_t due;
+    size_t len;
+    char data[64];
+} sim_pending_t;
+
+struct sim_line {
+    int index;
+    int master;
+    int slave;
+    char slavePath[64];
+    sim_mode_t mode;
+    const sim_config_t *config;
+    sim_callbacks_t callbacks;
+    /* Modem settings. */
+    bool echo;
+    bool verbose;
+    bool offHook;
+    int fclass;
+    /* AT+VCID=1 */
+    bool callerId;
+    /* AT+MS picked the carrier, so there's less to train through. */
+    bool carrierSet;
+    /* AT+MR=2: say what carrier we got before CONNECT. Always V34 at 28800. */
+    bool reportCarrier;
+    /* The loopback's line filter. */
+    float loopLevel;
+    int regs[32];
+    char cmd[SIM_CMD_MAX];
+    size_t cmdLen;
+    /* Voice mode. */
+    bool dle;
+    sim_voice_stats_t voice;
+    /* DTMF digits queued up to send to the DTE. */
+    char dial[32];
+    size_t dialPos;
+    unsigned int dialGapMs;
+    uint64_t nextDigit;
+    /* An incoming call: rings still to go, and who it's from. */
+    int ringsLeft;
+    bool firstRing;
+    uint64_t nextRing;
+    char cidNumber[32];
+    char cidName[32];
+    /* Escape detection. */
+    uint64_t lastRx;
+    int plusCount;
+    uint64_t plusTime;
+    uint64_t connectAt;
+    bool hangupPending;
+    /* Output to the DTE. Responses wait in pending until they're due. */
+    sim_pending_t pending[SIM_PENDING_MAX];
+    int numPending;
+    uint8_t out[SIM_OUT_MAX];
+    size_t outHead;
+    size_t outLen;
+    /* Token buckets for pacing, in bytes*1000000. */
+    int64_t txBudget;
+    int64_t rxBudget;
+    uint64_t lastTick;
+};
+
+uint64_t sim_usec(void);
+int sim_open(sim_line_t *line, int index, const sim_config_t *config, const sim_callbacks_t *callbacks);
+void sim_close(sim_line_t *line);
+/* Do whatever is due. Returns how long (in ms) until something else will be. */
+int sim_tick(sim_line_t *line, uint64_t now);
+/* Run every line for up to timeoutMs. */
+void sim_poll(sim_line_t *lines, int numLines, int timeoutMs);
+
+/* Things the caller can do. Digits are only heard while the line is sending voice. */
+void sim_dial(sim_line_t *line, const char *digits, unsigned int delayMs, unsigned int gapMs);
+bool sim_send(sim_line_t *line, const void *buf, size_t len);
+void sim_hangup(sim_line_t *line);
+/* Ring the line up to rings times, 6s apart, until it's answered. Caller ID goes out after the first ring if it's on. */
+void sim_ring(sim_line_t *line, int rings, const char *number, const char *name);
+
+const char *sim_mode_name(sim_mode_t mode);
+
+#endif
@@ -0,0 +1,53 @@
+/* Stands in for pppd during load tests. Echoes everything it gets back to the
+ * modem until it sees an EOT, then exits.
+ * Build: cc -O2 -o stubppp tools/stubppp.c */
+
+#include <poll.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define EOT 0x04
+/* Give up if the line goes quiet for this long. */
+#define IDLE_TIMEOUT_MS 60000
+
+static int write_all(int fd, const char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t res = write(fd, buf, len);
+        if (res <= 0) {
+            return -1;
+        }
+        buf += res;
+        len -= res;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    char buf[4096];
+    struct pollfd pfd;
+    /* dialin runs us like pppd: the modem TTY is argv[0]. */
+    (void)argc;
+    pfd.fd = open(argv[0], O_RDWR | O_NOCTTY);
+    if (pfd.fd < 0) {
+        perror(argv[0]);
+        return 1;
+    }
+    pfd.events = POLLIN;
+    while (poll(&pfd, 1, IDLE_TIMEOUT_MS) == 1) {
+        ssize_t bytes = read(pfd.fd, buf, sizeof(buf));
+        char *eot;
+        if (bytes <= 0) {
+            break;
+        }
+        if ((eot = memchr(buf, EOT, bytes)) != NULL) {
+            write_all(pfd.fd, buf, eot - buf);
+            return 0;
+        }
+        if (write_all(pfd.fd, buf, bytes) != 0) {
+            break;
+        }
+    }
+    return 2;
+}
@@ -0,0 +1,605 @@
+/* Stands in for a terminal server, for testing dialin's rfc2217:// ports without one.
+ * Serves each TTY it's given as an RFC 2217 port on its own TCP port (the
+ * first on -p, the next on -p + 1 and so on), one client at a time. Point it
+ * at modemsim's ptys to put the simulated modems "on the network".
+ * A TTY without modem lines (a pty) gets served as a plain telnet port: the
+ * server turns com port control down and dialin falls back to +++ and ATH.
+ * Build: cc -O2 -o termsrv tools/termsrv.c */
+
+#include <poll.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <termios.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#define IAC 255
+#define DONT 254
+#define DO 253
+#define WONT 252
+#define WILL 251
+#define SB 250
+#define SE 240
+#define OPT_BINARY 0
+#define OPT_SGA 3
+#define OPT_COM_PORT 44
+
+#define CPC_SET_BAUDRATE 1
+#define CPC_SET_DATASIZE 2
+#define CPC_SET_PARITY 3
+#define CPC_SET_STOPSIZE 4
+#define CPC_SET_CONTROL 5
+#define CPC_NOTIFY_MODEMSTATE 7
+#define CPC_FLOWCONTROL_SUSPEND 8
+#define CPC_FLOWCONTROL_RESUME 9
+#define CPC_SET_LINESTATE_MASK 10
+#define CPC_SET_MODEMSTATE_MASK 11
+#define CPC_PURGE_DATA 12
+#define CPC_SERVER 100
+
+#define MS_CD 0x80
+#define MS_RI 0x40
+#define MS_DSR 0x20
+#define MS_CTS 0x10
+#define MS_DELTA_CD 0x08
+#define MS_TERI 0x04
+#define MS_DELTA_DSR 0x02
+#define MS_DELTA_CTS 0x01
+
+#define MAX_PORTS 32
+#define BUF_SIZE 8192
+#define SB_MAX 16
+/* Ask the client to stop sending when this much is waiting for the TTY, and to start again below the second. */
+#define SUSPEND_AT 6144
+#define RESUME_AT 1024
+#define MODEMSTATE_POLL_MS 50
+
+typedef enum {
+    TN_DATA = 0,
+    TN_IAC,
+    TN_OPTION,
+    TN_SB,
+    TN_SB_IAC
+} tn_state_t;
+
+typedef struct {
+    const char *path;
+    int tty;
+    bool hasLines;
+    int listener;
+    int client;
+    bool comPort;
+    bool sentWill[256];
+    bool sentDo[256];
+    tn_state_t tnState;
+    uint8_t tnCmd;
+    uint8_t sb[SB_MAX];
+    size_t sbLen;
+    uint8_t modemMask;
+    uint8_t modemState;
+    /* We asked the client to stop, and the client asked us to stop. */
+    bool suspendSent;
+    bool suspended;
+    uint8_t ttyOut[BUF_SIZE];
+    size_t ttyOutLen;
+    uint8_t netOut[BUF_SIZE];
+    size_t netOutLen;
+} port_t;
+
+static port_t ports[MAX_PORTS];
+static int numPorts = 0;
+static bool verbose = false;
+static volatile sig_atomic_t running = 1;
+
+static void stop(int sig) {
+    (void)sig;
+    running = 0;
+}
+
+static void net_raw(port_t *port, const uint8_t *buf, size_t len) {
+    if (port->netOutLen + len > sizeof(port->netOut)) {
+        return;
+    }
+    memcpy(port->netOut + port->netOutLen, buf, len);
+    port->netOutLen += len;
+}
+
+static void net_option(port_t *port, uint8_t cmd, uint8_t opt) {
+    uint8_t msg[3] = {IAC, cmd, opt};
+    net_raw(port, msg, 3);
+}
+
+static void net_command(port_t *port, uint8_t cmd, const uint8_t *value, size_t valueLen) {
+    uint8_t msg[4 + 2*SB_MAX + 2];
+    size_t len = 0;
+    msg[len++] = IAC;
+    msg[len++] = SB;
+    msg[len++] = OPT_COM_PORT;
+    msg[len++] = cmd;
+    for (size_t i = 0; i < valueLen; i++) {
+        msg[len++] = value[i];
+        if (value[i] == IAC) {
+            msg[len++] = IAC;
+        }
+    }
+    msg[len++] = IAC;
+    msg[len++] = SE;
+    net_raw(port, msg, len);
+}
+
+static uint8_t read_modemstate(port_t *port) {
+    int bits;
+    uint8_t state = 0;
+    if (!port->hasLines || ioctl(port->tty, TIOCMGET, &bits) != 0) {
+        return MS_CD | MS_DSR | MS_CTS;
+    }
+    state |= (bits & TIOCM_CD) ? MS_CD : 0;
+    state |= (bits & TIOCM_RI) ? MS_RI : 0;
+    state |= (bits & TIOCM_DSR) ? MS_DSR : 0;
+    state |= (bits & TIOCM_CTS) ? MS_CTS : 0;
+    return state;
+}
+
+static void notify_modemstate(port_t *port, bool force) {
+    uint8_t state = read_modemstate(port);
+    uint8_t changed = state ^ port->modemState;
+    uint8_t value;
+    if (!force && !(changed & port->modemMask)) {
+        port->modemState = state;
+        return;
+    }
+    value = state;
+    value |= (changed & MS_CD) ? MS_DELTA_CD : 0;
+    value |= ((changed & MS_RI) && !(state & MS_RI)) ? MS_TERI : 0;
+    value |= (changed & MS_DSR) ? MS_DELTA_DSR : 0;
+    value |= (changed & MS_CTS) ? MS_DELTA_CTS : 0;
+    value &= port->modemMask;
+    port->modemState = state;
+    net_command(port, CPC_SERVER + CPC_NOTIFY_MODEMSTATE, &value, 1);
+    if (verbose) {
+        printf("%s: modem state %02x\n", port->path, value);
+    }
+}
+
+static speed_t to_speed(uint32_t rate) {
+    static const struct {
+        uint32_t rate;
+        speed_t speed;
+    } speeds[] = {
+        {300, B300}, {1200, B1200}, {2400, B2400}, {4800, B4800}, {9600, B9600},
+        {19200, B19200}, {38400, B38400}, {57600, B57600}, {115200, B115200}, {230400, B230400}
+    };
+    for (size_t i = 0; i < sizeof(speeds)/sizeof(speeds[0]); i++) {
+        if (speeds[i].rate == rate) {
+            return speeds[i].speed;
+        }
+    }
+    return B0;
+}
+
+static uint32_t from_speed(speed_t speed) {
+    static const uint32_t rates[] = {300, 1200, 2400, 4800, 9600, 19200, 38400, 57600, 115200, 230400};
+    for (size_t i = 0; i < sizeof(rates)/sizeof(rates[0]); i++) {
+        if (to_speed(rates[i]) == speed) {
+            return rates[i];
+        }
+    }
+    return 0;
+}
+
+/* Apply a SET-* command to the TTY and answer with what it's set to now. */
+static void got_command(port_t *port) {
+    struct termios tty;
+    uint8_t cmd = port->sb[1];
+    const uint8_t *value = port->sb + 2;
+    size_t valueLen = port->sbLen - 2;
+    uint8_t reply = valueLen > 0 ? value[0] : 0;
+    int bits;
+
+    tcgetattr(port->tty, &tty);
+    switch (cmd) {
+        case CPC_SET_BAUDRATE: {
+            uint32_t rate;
+            uint8_t out[4];
+            if (valueLen < 4) {
+                return;
+            }
+            rate = ((uint32_t)value[0] << 24) | ((uint32_t)value[1] << 16) | ((uint32_t)value[2] << 8) | value[3];
+            if (rate != 0 && to_speed(rate) != B0) {
+                cfsetspeed(&tty, to_speed(rate));
+                tcsetattr(port->tty, TCSANOW, &tty);
+            }
+            rate = from_speed(cfgetospeed(&tty));
+            out[0] = rate >> 24;
+            out[1] = rate >> 16;
+            out[2] = rate >> 8;
+            out[3] = rate;
+            net_command(port, CPC_SERVER + cmd, out, 4);
+            if (verbose) {
+                printf("%s: speed %u\n", port->path, rate);
+            }
+            return;
+        }
+        case CPC_SET_DATASIZE:
+            if (reply >= 5 && reply <= 8) {
+                tty.c_cflag &= ~CSIZE;
+                tty.c_cflag |= reply == 5 ? CS5 : reply == 6 ? CS6 : reply == 7 ? CS7 : CS8;
+                tcsetattr(port->tty, TCSANOW, &tty);
+            }
+            switch (tty.c_cflag & CSIZE) {
+                case CS5: reply = 5; break;
+                case CS6: reply = 6; break;
+                case CS7: reply = 7; break;
+                default: reply = 8; break;
+            }
+            break;
+        case CPC_SET_PARITY:
+            if (reply >= 1 && reply <= 3) {
+                tty.c_cflag &= ~(PARENB | PARODD);
+                tty.c_cflag |= reply == 2 ? (PARENB | PARODD) : reply == 3 ? PARENB : 0;
+                tcsetattr(port->tty, TCSANOW, &tty);
+            }
+            reply = !(tty.c_cflag & PARENB) ? 1 : (tty.c_cflag & PARODD) ? 2 : 3;
+            break;
+        case CPC_SET_STOPSIZE:
+            if (reply == 1 || reply == 2) {
+                tty.c_cflag = reply == 2 ? (tty.c_cflag | CSTOPB) : (tty.c_cflag & ~CSTOPB);
+                tcsetattr(port->tty, TCSANOW, &tty);
+            }
+            reply = (tty.c_cflag & CSTOPB) ? 2 : 1;
+            break;
+        case CPC_SET_CONTROL:
+            switch (reply) {
+                case 0:
+                    reply = (tty.c_cflag & CRTSCTS) ? 3 : 1;
+                    break;
+                case 1:
+                case 3:
+                    tty.c_cflag = reply == 3 ? (tty.c_cflag | CRTSCTS) : (tty.c_cflag & ~CRTSCTS);
+                    tcsetattr(port->tty, TCSANOW, &tty);
+                    break;
+                case 8:
+                case 9:
+                case 11:
+                case 12:
+                    bits = (reply == 8 || reply == 9) ? TIOCM_DTR : TIOCM_RTS;
+                    ioctl(port->tty, (reply == 8 || reply == 11) ? TIOCMBIS : TIOCMBIC, &bits);
+                    if (verbose) {
+                        printf("%s: %s %s\n", port->path, bits == TIOCM_DTR ? "DTR" : "RTS", (reply == 8 || reply == 11) ? "on" : "off");
+                    }
+                    break;
+                case 7:
+                case 10:
+                    bits = 0;
+                    ioctl(port->tty, TIOCMGET, &bits);
+                    reply = reply == 7 ? ((bits & TIOCM_DTR) ? 8 : 9) : ((bits & TIOCM_RTS) ? 11 : 12);
+                    break;
+            }
+            break;
+        case CPC_FLOWCONTROL_SUSPEND:
+        case CPC_FLOWCONTROL_RESUME:
+            port->suspended = cmd == CPC_FLOWCONTROL_SUSPEND;
+            return;
+        case CPC_SET_LINESTATE_MASK:
+            break;
+        case CPC_SET_MODEMSTATE_MASK:
+            port->modemMask = reply;
+            net_command(port, CPC_SERVER + cmd, &reply, 1);
+            notify_modemstate(port, true);
+            return;
+        case CPC_PURGE_DATA:
+            if (reply >= 1 && reply <= 3) {
+                tcflush(port->tty, reply == 1 ? TCIFLUSH : reply == 2 ? TCOFLUSH : TCIOFLUSH);
+            }
+            break;
+        default:
+            return;
+    }
+    net_command(port, CPC_SERVER + cmd, &reply, 1);
+}
+
+static void got_option(port_t *port, uint8_t cmd, uint8_t opt) {
+    bool supported = opt == OPT_BINARY || opt == OPT_SGA;
+    switch (cmd) {
+        case WILL:
+            if (opt == OPT_COM_PORT) {
+                /* Without modem lines there'd be no DTR to drop; let the client hang up with +++. */
+                port->comPort = port->hasLines;
+                net_option(port, port->comPort ? DO : DONT, opt);
+                printf("%s: com port control %s\n", port->path, port->comPort ? "on" : "refused");
+            } else if (!supported) {
+                net_option(port, DONT, opt);
+            } else if (!port->sentDo[opt]) {
+                port->sentDo[opt] = true;
+                net_option(port, DO, opt);
+            }
+            break;
+        case DO:
+            if (!supported) {
+                net_option(port, WONT, opt);
+            } else if (!port->sentWill[opt]) {
+                port->sentWill[opt] = true;
+                net_option(port, WILL, opt);
+            }
+            break;
+        case WONT:
+            port->sentDo[opt] = false;
+            if (opt == OPT_COM_PORT) {
+                port->comPort = false;
+            }
+            break;
+        case DONT:
+            port->sentWill[opt] = false;
+            break;
+    }
+}
+
+/* Telnet from the client. Data goes to ttyOut. */
+static void got_bytes(port_t *port, const uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        uint8_t c = buf[i];
+        switch (port->tnState) {
+            case TN_DATA:
+                if (c == IAC) {
+                    port->tnState = TN_IAC;
+                } else {
+                    port->ttyOut[port->ttyOutLen++] = c;
+                }
+                break;
+            case TN_IAC:
+                port->tnState = TN_DATA;
+                if (c == IAC) {
+                    port->ttyOut[port->ttyOutLen++] = c;
+                } else if (c == SB) {
+                    port->sbLen = 0;
+                    port->tnState = TN_SB;
+                } else if (c >= WILL && c <= DONT) {
+                    port->tnCmd = c;
+                    port->tnState = TN_OPTION;
+                }
+                break;
+            case TN_OPTION:
+                got_option(port, port->tnCmd, c);
+                port->tnState = TN_DATA;
+                break;
+            case TN_SB:
+                if (c == IAC) {
+                    port->tnState = TN_SB_IAC;
+                } else if (port->sbLen < SB_MAX) {
+                    port->sb[port->sbLen++] = c;
+                }
+                break;
+            case TN_SB_IAC:
+                if (c == IAC) {
+                    if (port->sbLen < SB_MAX) {
+                        port->sb[port->sbLen++] = c;
+                    }
+                    port->tnState = TN_SB;
+                } else {
+                    if (c == SE && port->sbLen >= 2 && port->sb[0] == OPT_COM_PORT && port->comPort) {
+                        got_command(port);
+                    }
+                    port->tnState = TN_DATA;
+                }
+                break;
+        }
+    }
+}
+
+static void drop_client(port_t *port) {
+    printf("%s: client gone\n", port->path);
+    close(port->client);
+    port->client = -1;
+    port->comPort = false;
+    memset(port->sentWill, 0, sizeof(port->sentWill));
+    memset(port->sentDo, 0, sizeof(port->sentDo));
+    port->tnState = TN_DATA;
+    port->modemMask = 0;
+    port->suspendSent = false;
+    port->suspended = false;
+    port->ttyOutLen = 0;
+    port->netOutLen = 0;
+}
+
+static void accept_client(port_t *port) {
+    int fd = accept(port->listener, NULL, NULL);
+    int one = 1;
+    if (fd < 0) {
+        return;
+    }
+    if (port->client >= 0) {
+        /* One at a time, like a real port. */
+        close(fd);
+        return;
+    }
+    fcntl(fd, F_SETFL, O_NONBLOCK);
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    port->client = fd;
+    port->modemState = read_modemstate(port);
+    tcflush(port->tty, TCIOFLUSH);
+    printf("%s: client connected\n", port->path);
+}
+
+/* Move whatever can move between the client and the TTY. */
+static void service(port_t *port, const struct pollfd *netFd, const struct pollfd *ttyFd) {
+    uint8_t buf[BUF_SIZE/2];
+    ssize_t len;
+
+    if (netFd->revents & (POLLIN | POLLHUP | POLLERR)) {
+        /* Escaped input never grows, so reading no more than there's room for is enough. */
+        len = read(port->client, buf, sizeof(port->ttyOut) - port->ttyOutLen < sizeof(buf) ? sizeof(port->ttyOut) - port->ttyOutLen : sizeof(buf));
+        if (len == 0 || (len < 0 && errno != EAGAIN && errno != EINTR)) {
+            drop_client(port);
+            return;
+        }
+        if (len > 0) {
+            got_bytes(port, buf, len);
+        }
+    }
+    if (ttyFd->revents & POLLIN) {
+        len = read(port->tty, buf, (sizeof(port->netOut) - port->netOutLen)/2);
+        for (ssize_t i = 0; i < len; i++) {
+            port->netOut[port->netOutLen++] = buf[i];
+            if (buf[i] == IAC) {
+                port->netOut[port->netOutLen++] = IAC;
+            }
+        }
+    }
+    if (port->ttyOutLen > 0) {
+        len = write(port->tty, port->ttyOut, port->ttyOutLen);
+        if (len > 0) {
+            memmove(port->ttyOut, port->ttyOut + len, port->ttyOutLen - len);
+            port->ttyOutLen -= len;
+        }
+    }
+    if (port->comPort) {
+        if (!port->suspendSent && port->ttyOutLen >= SUSPEND_AT) {
+            port->suspendSent = true;
+            net_command(port, CPC_SERVER + CPC_FLOWCONTROL_SUSPEND, NULL, 0);
+        } else if (port->suspendSent && port->ttyOutLen <= RESUME_AT) {
+            port->suspendSent = false;
+            net_command(port, CPC_SERVER + CPC_FLOWCONTROL_RESUME, NULL, 0);
+        }
+    }
+    if (port->netOutLen > 0) {
+        len = write(port->client, port->netOut, port->netOutLen);
+        if (len > 0) {
+            memmove(port->netOut, port->netOut + len, port->netOutLen - len);
+            port->netOutLen -= len;
+        } else if (len < 0 && errno != EAGAIN && errno != EINTR) {
+            drop_client(port);
+        }
+    }
+}
+
+static int open_port(port_t *port, const char *path, int tcpPort) {
+    struct sockaddr_in6 bindAddr = {0};
+    struct termios tty;
+    int one = 1;
+    int off = 0;
+    int bits;
+
+    port->path = path;
+    port->client = -1;
+    if ((port->tty = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK)) < 0) {
+        perror(path);
+        return -1;
+    }
+    tcgetattr(port->tty, &tty);
+    cfmakeraw(&tty);
+    tty.c_cflag |= CLOCAL | CREAD;
+    tcsetattr(port->tty, TCSANOW, &tty);
+    port->hasLines = ioctl(port->tty, TIOCMGET, &bits) == 0;
+
+    if ((port->listener = socket(AF_INET6, SOCK_STREAM, 0)) < 0) {
+        perror("socket");
+        return -1;
+    }
+    setsockopt(port->listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    setsockopt(port->listener, IPPROTO_IPV6, IPV6_V6ONLY, &off, sizeof(off));
+    bindAddr.sin6_family = AF_INET6;
+    bindAddr.sin6_addr = in6addr_any;
+    bindAddr.sin6_port = htons(tcpPort);
+    if (bind(port->listener, (struct sockaddr*)&bindAddr, sizeof(bindAddr)) != 0 || listen(port->listener, 1) != 0) {
+        perror("bind");
+        return -1;
+    }
+    printf("%s on port %d%s\n", path, tcpPort, port->hasLines ? "" : " (no modem lines)");
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    int basePort = 7001;
+    uint64_t lastPoll = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "p:vh")) != -1) {
+        switch (opt) {
+            case 'p':
+                basePort = atoi(optarg);
+                break;
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                fprintf(stderr,
+                    "Usage: %s [options...] <TTY>...\n\n"
+                    "Serves each TTY as an RFC 2217 port, on consecutive TCP ports.\n\n"
+                    "-p <port> : TCP port for the first TTY. [Default: 7001]\n"
+                    "-v : Print every setting the client makes.\n",
+                    argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (optind >= argc) {
+        fprintf(stderr, "No TTYs given.\n");
+        return 1;
+    }
+    for (int i = optind; i < argc && numPorts < MAX_PORTS; i++) {
+        if (open_port(&ports[numPorts], argv[i], basePort + numPorts) != 0) {
+            return 1;
+        }
+        numPorts++;
+    }
+    fflush(stdout);
+
+    signal(SIGINT, stop);
+    signal(SIGTERM, stop);
+    signal(SIGPIPE, SIG_IGN);
+    while (running) {
+        struct pollfd fds[MAX_PORTS*3];
+        struct timespec ts;
+        uint64_t now;
+        for (int i = 0; i < numPorts; i++) {
+            port_t *port = &ports[i];
+            bool connected = port->client >= 0;
+            fds[i*3] = (struct pollfd){port->listener, POLLIN, 0};
+            fds[i*3 + 1] = (struct pollfd){connected ? port->client : -1, 0, 0};
+            fds[i*3 + 2] = (struct pollfd){connected ? port->tty : -1, 0, 0};
+            if (!connected) {
+                continue;
+            }
+            if (port->ttyOutLen < sizeof(port->ttyOut)) {
+                fds[i*3 + 1].events |= POLLIN;
+            }
+            if (port->netOutLen > 0) {
+                fds[i*3 + 1].events |= POLLOUT;
+            }
+            if (!port->suspended && port->netOutLen < sizeof(port->netOut)/2) {
+                fds[i*3 + 2].events |= POLLIN;
+            }
+            if (port->ttyOutLen > 0) {
+                fds[i*3 + 2].events |= POLLOUT;
+            }
+        }
+        poll(fds, numPorts*3, MODEMSTATE_POLL_MS);
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        now = ts.tv_sec*1000ULL + ts.tv_nsec/1000000;
+        for (int i = 0; i < numPorts; i++) {
+            port_t *port = &ports[i];
+            if (fds[i*3].revents & POLLIN) {
+                accept_client(port);
+            }
+            if (port->client >= 0) {
+                service(port, &fds[i*3 + 1], &fds[i*3 + 2]);
+            }
+            if (port->client >= 0 && port->comPort && now - lastPoll >= MODEMSTATE_POLL_MS) {
+                notify_modemstate(port, false);
+            }
+        }
+        if (now - lastPoll >= MODEMSTATE_POLL_MS) {
+            lastPoll = now;
+        }
+        fflush(stdout);
+    }
+    return 0;
+}
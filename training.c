@@ -0,0 +1,224 @@
+#include <time.h>
+#include <stdio.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "log.h"
+#include "training.h"
+
+#define MAX_CALLERS 4096
+#define TRAINING_TICK_NSEC 250000000
+
+typedef struct {
+    char key[32];
+    /* What their last full negotiation came to, and how many in a row have. */
+    char carrier[8];
+    unsigned int rate;
+    unsigned int trust;
+    /* Limited calls since the last full negotiation. */
+    unsigned int calls;
+} caller_t;
+
+static caller_t *callers = NULL;
+static int numCallers = 0;
+static pthread_mutex_t trainingLock = PTHREAD_MUTEX_INITIALIZER;
+/* Set when the table changes, cleared when the writer takes a copy of it. */
+static bool trainingDirty = false;
+/* The writer's copy, so it can write without holding up the lines. */
+static caller_t *saved = NULL;
+static pthread_t trainingThread;
+static atomic_bool trainingRunning = false;
+static char trainingPath[512];
+static char trainingTmp[520];
+
+static caller_t *find(const char *key) {
+    for (int i = 0; i < numCallers; i++) {
+        if (strcmp(callers[i].key, key) == 0) {
+            return &callers[i];
+        }
+    }
+    return NULL;
+}
+
+/* Call with the lock held. When it's full, the caller we know least about makes room. */
+static caller_t *add(const char *key) {
+    caller_t *caller = &callers[numCallers];
+    if (numCallers == MAX_CALLERS) {
+        caller = &callers[0];
+        for (int i = 1; i < numCallers; i++) {
+            if (callers[i].trust < caller->trust) {
+                caller = &callers[i];
+            }
+        }
+    } else {
+        numCallers++;
+    }
+    memset(caller, 0, sizeof(*caller));
+    snprintf(caller->key, sizeof(caller->key), "%s", key);
+    return caller;
+}
+
+/* Writes the table out if it's changed. Only the writer (or shutdown, once it's stopped) calls this. */
+static void save(void) {
+    FILE *file;
+    int count;
+    pthread_mutex_lock(&trainingLock);
+    if (!trainingDirty) {
+        pthread_mutex_unlock(&trainingLock);
+        return;
+    }
+    memcpy(saved, callers, numCallers*sizeof(caller_t));
+    count = numCallers;
+    trainingDirty = false;
+    pthread_mutex_unlock(&trainingLock);
+
+    if ((file = fopen(trainingTmp, "w")) == NULL) {
+        log_warn(NULL, "Couldn't write %s: %s", trainingTmp, strerror(errno));
+        return;
+    }
+    for (int i = 0; i < count; i++) {
+        fprintf(file, "%s %s %u %u %u\n", saved[i].key, saved[i].carrier, saved[i].rate, saved[i].trust, saved[i].calls);
+    }
+    if (fclose(file) != 0 || rename(trainingTmp, trainingPath) != 0) {
+        log_warn(NULL, "Couldn't write %s: %s", trainingPath, strerror(errno));
+    }
+}
+
+static void *training_thread(void *arg) {
+    struct timespec wait = {0, TRAINING_TICK_NSEC};
+    int ticks = 0;
+    (void)arg;
+    while (atomic_load(&trainingRunning)) {
+        if (ticks-- <= 0) {
+            save();
+            ticks = TRAINING_SAVE_SEC*(1000000000/TRAINING_TICK_NSEC);
+        }
+        nanosleep(&wait, NULL);
+    }
+    return NULL;
+}
+
+int training_init(const char *path) {
+    FILE *file;
+    char line[128];
+    int lineNum = 0;
+    if ((callers = calloc(MAX_CALLERS, sizeof(caller_t))) == NULL || (saved = calloc(MAX_CALLERS, sizeof(caller_t))) == NULL) {
+        training_shutdown();
+        return -1;
+    }
+    snprintf(trainingPath, sizeof(trainingPath), "%s", path);
+    snprintf(trainingTmp, sizeof(trainingTmp), "%s.tmp", path);
+    if ((file = fopen(path, "r")) == NULL) {
+        /* Nobody's called yet. */
+        if (errno != ENOENT) {
+            training_shutdown();
+            return -1;
+        }
+    }
+    while (file != NULL && fgets(line, sizeof(line), file) != NULL && numCallers < MAX_CALLERS) {
+        caller_t *caller = &callers[numCallers];
+        int n = sscanf(line, "%31s %7s %u %u %u", caller->key, caller->carrier, &caller->rate, &caller->trust, &caller->calls);
+        lineNum++;
+        if (n <= 0) {
+            continue;
+        }
+        if (n != 5) {
+            log_error(NULL, "%s line %d doesn't make sense: %s", path, lineNum, line);
+            fclose(file);
+            training_shutdown();
+            return -2;
+        }
+        numCallers++;
+    }
+    if (file != NULL) {
+        fclose(file);
+        log_debug(NULL, "Know how %d callers train.", numCallers);
+    }
+    atomic_store(&trainingRunning, true);
+    if (pthread_create(&trainingThread, NULL, training_thread, NULL) != 0) {
+        atomic_store(&trainingRunning, false);
+        training_shutdown();
+        return -3;
+    }
+    return 0;
+}
+
+void training_shutdown(void) {
+    if (atomic_exchange(&trainingRunning, false)) {
+        pthread_join(trainingThread, NULL);
+        /* Whatever changed since it last looked. */
+        save();
+    }
+    free(callers);
+    free(saved);
+    callers = NULL;
+    saved = NULL;
+    numCallers = 0;
+    trainingDirty = false;
+}
+
+bool training_enabled(void) {
+    return callers != NULL;
+}
+
+bool training_plan(const char *key, char *cmd, size_t size) {
+    caller_t *caller;
+    bool limited = false;
+    if (callers == NULL || key[0] == 0) {
+        return false;
+    }
+    pthread_mutex_lock(&trainingLock);
+    caller = find(key);
+    /* Nothing to gain for callers who get the fastest carrier anyway. */
+    if (caller != NULL && caller->trust >= TRAINING_TRUST && strcmp(caller->carrier, "V90") != 0) {
+        if (caller->calls >= TRAINING_RELEARN) {
+            log_debug(NULL, "%s gets a full negotiation this time, to see if it does better than %s.", key, caller->carrier);
+        } else {
+            snprintf(cmd, size, "AT+MS=%s,1\r\n", caller->carrier);
+            limited = true;
+        }
+    }
+    pthread_mutex_unlock(&trainingLock);
+    return limited;
+}
+
+void training_result(const char *key, bool limited, bool connected, const char *carrier, unsigned int rate) {
+    caller_t *caller;
+    if (callers == NULL || key[0] == 0) {
+        return;
+    }
+    pthread_mutex_lock(&trainingLock);
+    if ((caller = find(key)) == NULL) {
+        if (!connected || carrier == NULL) {
+            pthread_mutex_unlock(&trainingLock);
+            return;
+        }
+        caller = add(key);
+    }
+    if (!connected) {
+        /* If we picked the carrier, don't trust it again until a full negotiation says so. */
+        if (limited) {
+            caller->trust = 0;
+        }
+    } else if (limited) {
+        caller->calls++;
+    } else if (carrier == NULL) {
+        /* The modem didn't say what it got. Nothing to learn. */
+        pthread_mutex_unlock(&trainingLock);
+        return;
+    } else {
+        /* A full negotiation. Start counting again if it's come out different. */
+        if (strcmp(caller->carrier, carrier) == 0) {
+            caller->trust++;
+        } else {
+            snprintf(caller->carrier, sizeof(caller->carrier), "%s", carrier);
+            caller->trust = 1;
+        }
+        caller->rate = rate;
+        caller->calls = 0;
+    }
+    trainingDirty = true;
+    pthread_mutex_unlock(&trainingLock);
+}
@@ -0,0 +1,37 @@
+#ifndef TRAINING_H
+#define TRAINING_H
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * Remembers what each caller's modem trains up to, so repeat callers don't
+ * sit through the whole V.8/V.90/V.34 fallback every time. Callers are
+ * keyed by their caller ID number, or the number they dialed where there's
+ * no caller ID.
+ *
+ * Once a caller's full negotiations have landed on the same carrier
+ * TRAINING_TRUST times in a row, and it's not the fastest one anyway, their
+ * calls get AT+MS=<carrier>,1 before ATA: straight to that carrier, with
+ * fallback below it still allowed. Every TRAINING_RELEARN calls (or after
+ * a limited call doesn't connect) they get a full negotiation again, in
+ * case their line or modem got better.
+ *
+ * Kept in a text file, one "key carrier rate trust calls" per line. A
+ * background thread rewrites it every TRAINING_SAVE_SEC if anything's
+ * changed, and once more on shutdown, so lines never wait on the disk.
+ */
+
+#define TRAINING_TRUST 2
+#define TRAINING_RELEARN 10
+#define TRAINING_SAVE_SEC 5
+
+/* 0 if it loaded (or isn't there yet), -1 if it couldn't be read, -2 if a line didn't make sense, -3 if the writer wouldn't start. */
+int training_init(const char *path);
+void training_shutdown(void);
+bool training_enabled(void);
+/* The AT command to send before ATA for this caller. False for a full negotiation. */
+bool training_plan(const char *key, char *cmd, size_t size);
+/* How the call trained. carrier is NULL if the modem didn't report one. */
+void training_result(const char *key, bool limited, bool connected, const char *carrier, unsigned int rate);
+
+#endif
@@ -0,0 +1,178 @@
+#include <math.h>
+#include <string.h>
+#include "voice.h"
+
+#define SINE_BITS 10
+#define SINE_SIZE (1 << SINE_BITS)
+
+static int16_t sineTable[SINE_SIZE];
+
+int voice_samples_due(int64_t usec, int rate) {
+    return (usec*rate)/1000000;
+}
+
+int voice_chunks(const unsigned char *buf, int size, int *pos, int count, struct iovec *iov, int maxIov) {
+    int numIov = 0;
+    while (count > 0 && numIov < maxIov) {
+        int len = size - *pos;
+        if (len > count) {
+            len = count;
+        }
+        iov[numIov].iov_base = (void*)(buf + *pos);
+        iov[numIov].iov_len = len;
+        numIov++;
+        *pos += len;
+        if (*pos >= size) {
+            *pos = 0;
+        }
+        count -= len;
+    }
+    return numIov;
+}
+
+ssize_t voice_write(int fd, const struct iovec *iov, int numIov) {
+    static const unsigned char dle = DLE;
+    struct iovec out[64];
+    int numOut = 0;
+    ssize_t total = 0;
+    ssize_t outLen = 0;
+    bool clear = true;
+    for (int i = 0; i < numIov; i++) {
+        total += iov[i].iov_len;
+        clear = clear && memchr(iov[i].iov_base, DLE, iov[i].iov_len) == NULL;
+    }
+    /* Like the dialtone, which has no DLEs in it. */
+    if (clear) {
+        return writev(fd, iov, numIov) == total ? total : -1;
+    }
+    for (int i = 0; i < numIov; i++) {
+        const unsigned char *p = iov[i].iov_base;
+        size_t len = iov[i].iov_len;
+        while (len > 0) {
+            const unsigned char *at = memchr(p, DLE, len);
+            size_t chunk = at != NULL ? at - p + 1 : len;
+            out[numOut].iov_base = (void*)p;
+            out[numOut++].iov_len = chunk;
+            outLen += chunk;
+            if (at != NULL) {
+                out[numOut].iov_base = (void*)&dle;
+                out[numOut++].iov_len = 1;
+                outLen++;
+            }
+            if (numOut >= 62) {
+                if (writev(fd, out, numOut) != outLen) {
+                    return -1;
+                }
+                numOut = 0;
+                outLen = 0;
+            }
+            p += chunk;
+            len -= chunk;
+        }
+    }
+    if (numOut > 0 && writev(fd, out, numOut) != outLen) {
+        return -1;
+    }
+    return total;
+}
+
+int dle_scan(bool *pending, const char *buf, int len, char *events, int maxEvents) {
+    int numEvents = 0;
+    const char *p = buf;
+    const char *end = buf + len;
+    if (*pending && p < end) {
+        *pending = false;
+        /* DLE DLE is just a DLE in the data. */
+        if (*p != DLE && numEvents < maxEvents) {
+            events[numEvents++] = *p;
+        }
+        p++;
+    }
+    /* Most of what comes in has no DLEs in it at all, so let memchr find them. */
+    while (p < end && (p = memchr(p, DLE, end - p)) != NULL) {
+        if (++p == end) {
+            *pending = true;
+            break;
+        }
+        if (*p != DLE && numEvents < maxEvents) {
+            events[numEvents++] = *p;
+        }
+        p++;
+    }
+    return numEvents;
+}
+
+int dle_decode(bool *pending, const char *buf, int len, uint8_t *out, char *events, int maxEvents, int *numEvents) {
+    int samples = 0;
+    *numEvents = 0;
+    for (int i = 0; i < len; i++) {
+        if (*pending) {
+            *pending = false;
+            if (buf[i] == DLE) {
+                out[samples++] = DLE;
+            } else if (*numEvents < maxEvents) {
+                events[(*numEvents)++] = buf[i];
+            }
+        } else if (buf[i] == DLE) {
+            *pending = true;
+        } else {
+            out[samples++] = buf[i];
+        }
+    }
+    return samples;
+}
+
+void tone_init(tone_t *tone, const double *freqs, int numFreqs, double level, int rate) {
+    if (sineTable[SINE_SIZE/4] == 0) {
+        for (int i = 0; i < SINE_SIZE; i++) {
+            sineTable[i] = (int16_t)lrint(32767*sin(2*M_PI*i/SINE_SIZE));
+        }
+    }
+    if (numFreqs > TONE_MAX_FREQS) {
+        numFreqs = TONE_MAX_FREQS;
+    }
+    memset(tone, 0, sizeof(*tone));
+    tone->numFreqs = numFreqs;
+    for (int i = 0; i < numFreqs; i++) {
+        tone->step[i] = (uint32_t)llrint(freqs[i]/rate*4294967296.0);
+    }
+    /* Keep the sum of all of them from clipping. */
+    if (level*numFreqs > 1) {
+        level = 1.0/numFreqs;
+    }
+    tone->amplitude = (int)lrint(level*32767);
+}
+
+void tone_render_s16(tone_t *tone, int16_t *out, int count) {
+    for (int i = 0; i < count; i++) {
+        int32_t sum = 0;
+        for (int f = 0; f < tone->numFreqs; f++) {
+            sum += sineTable[tone->phase[f] >> (32 - SINE_BITS)];
+            tone->phase[f] += tone->step[f];
+        }
+        out[i] = (sum*tone->amplitude) >> 15;
+    }
+}
+
+void tone_render_u8(tone_t *tone, uint8_t *out, int count) {
+    int16_t buf[256];
+    while (count > 0) {
+        int len = count < 256 ? count : 256;
+        tone_render_s16(tone, buf, len);
+        pcm_s16_to_u8(buf, out, len);
+        out += len;
+        count -= len;
+    }
+}
+
+void pcm_u8_to_s16(const uint8_t *in, int16_t *out, int count) {
+    for (int i = 0; i < count; i++) {
+        out[i] = (int16_t)((in[i] - 128) << 8);
+    }
+}
+
+void pcm_s16_to_u8(const int16_t *in, uint8_t *out, int count) {
+    for (int i = 0; i < count; i++) {
+        out[i] = (uint8_t)((in[i] >> 8) + 128);
+    }
+}
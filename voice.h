@@ -0,0 +1,69 @@
+#ifndef VOICE_H
+#define VOICE_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/uio.h>
+
+#define DLE 0x10
+#define ETX 0x03
+/* After a DLE: throw away the audio the modem has buffered. */
+#define CAN 0x18
+/* DLE events for the calling tones: a fax machine's CNG, and a modem's V.25 1300 Hz tone. */
+#define EVENT_FAX_CNG 'c'
+#define EVENT_DATA_CALLING 'e'
+/* And the ones that mean the caller's gone: busy tone, silence (after voice, for q), and the line current dropping. */
+#define EVENT_BUSY 'b'
+#define EVENT_SILENCE 's'
+#define EVENT_QUIET 'q'
+#define EVENT_LOOP_BREAK 'l'
+#define EVENT_LINE_BREAK 'h'
+
+/* How many samples are due after usec microseconds at rate samples/s. */
+int voice_samples_due(int64_t usec, int rate);
+
+/*
+ * Split count samples of a looping buffer, starting at *pos, into iovecs
+ * (wrapping around the end as many times as needed). Advances *pos.
+ * Returns the number of iovecs used. If it runs out of iovecs, count is cut short.
+ */
+int voice_chunks(const unsigned char *buf, int size, int *pos, int count, struct iovec *iov, int maxIov);
+
+/*
+ * Write the samples in iov to the modem, with every DLE in them sent twice so
+ * it's taken as a sample. Returns how many samples went, or -1.
+ */
+ssize_t voice_write(int fd, const struct iovec *iov, int numIov);
+
+/*
+ * Find DLE shielded events in data from the modem. pending carries a DLE that
+ * was the last byte of the previous read. Returns how many events there were.
+ */
+int dle_scan(bool *pending, const char *buf, int len, char *events, int maxEvents);
+
+/*
+ * dle_scan for voice data coming in: also copies the samples to out (which
+ * needs room for len) with the shielding taken off. Returns how many samples
+ * there were.
+ */
+int dle_decode(bool *pending, const char *buf, int len, uint8_t *out, char *events, int maxEvents, int *numEvents);
+
+/* Tone generator: the sum of up to TONE_MAX_FREQS sine waves. */
+#define TONE_MAX_FREQS 4
+
+typedef struct {
+    uint32_t phase[TONE_MAX_FREQS];
+    uint32_t step[TONE_MAX_FREQS];
+    int numFreqs;
+    /* Peak of each component, out of 32767. */
+    int amplitude;
+} tone_t;
+
+void tone_init(tone_t *tone, const double *freqs, int numFreqs, double level, int rate);
+void tone_render_s16(tone_t *tone, int16_t *out, int count);
+void tone_render_u8(tone_t *tone, uint8_t *out, int count);
+
+/* Sample format conversion. */
+void pcm_u8_to_s16(const uint8_t *in, int16_t *out, int count);
+void pcm_s16_to_u8(const int16_t *in, uint8_t *out, int count);
+
+#endif
@@ -0,0 +1,214 @@
+#include <time.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/ioctl.h>
+#include "log.h"
+#include "clock.h"
+#include "modem.h"
+#include "rfc2217.h"
+#include "linkstats.h"
+#include "linewatch.h"
+#include "watchdog.h"
+
+#define WATCHDOG_TICK_NSEC 250000000
+#define CHECK_TICKS 4
+/* How long DCD has to stay down before we believe it. */
+#define CARRIER_GRACE_USEC 2000000
+/* How long pppd gets to go after SIGTERM. */
+#define KILL_USEC 10000000
+
+typedef struct {
+    /* The call we're watching, by its start time. */
+    int64_t callStart;
+    bool haveLine;
+    uint64_t rx;
+    uint64_t tx;
+    uint64_t activity;
+    uint64_t lastRxUsec;
+    uint64_t lastActiveUsec;
+    bool carrierSeen;
+    uint64_t carrierLostUsec;
+    /* When we asked it to close, and whether pppd's had SIGKILL. */
+    uint64_t closedUsec;
+    bool killed;
+} watch_t;
+
+static watch_t watches[MAX_MODEMS];
+static pthread_t watchdogThread;
+static atomic_bool watchdogRunning = false;
+static unsigned int idleLimit = 0;
+static unsigned int stallLimit = 0;
+
+/* Bytes on the line, from the serial driver if it counts, or else from the backend. */
+static bool line_bytes(modem_t *modem, uint64_t *rx, uint64_t *tx) {
+    struct serial_icounter_struct counts;
+    if (rfc2217_ioctl(modem->fd, TIOCGICOUNT, &counts) == 0) {
+        *rx = counts.rx;
+        *tx = counts.tx;
+        return true;
+    }
+    if (modem->backend == BACKEND_TCP) {
+        *rx = __atomic_load_n(&modem->relay.up.bytes, __ATOMIC_RELAXED);
+        *tx = __atomic_load_n(&modem->relay.down.bytes, __ATOMIC_RELAXED);
+        return true;
+    }
+    if (modem->backend == BACKEND_L2TP) {
+        *rx = __atomic_load_n(&modem->l2tp.rxBytes, __ATOMIC_RELAXED);
+        *tx = __atomic_load_n(&modem->l2tp.txBytes, __ATOMIC_RELAXED);
+        return true;
+    }
+    return false;
+}
+
+/* True once DCD has been up this call and then down for CARRIER_GRACE_USEC. */
+static bool carrier_gone(modem_t *modem, watch_t *watch, uint64_t now) {
+    int bits;
+    if (rfc2217_ioctl(modem->fd, TIOCMGET, &bits) != 0) {
+        return false;
+    }
+    if (bits & TIOCM_CD) {
+        watch->carrierSeen = true;
+        watch->carrierLostUsec = 0;
+        return false;
+    }
+    if (!watch->carrierSeen) {
+        return false;
+    }
+    if (watch->carrierLostUsec == 0) {
+        watch->carrierLostUsec = now;
+    }
+    return now - watch->carrierLostUsec >= CARRIER_GRACE_USEC;
+}
+
+static void close_session(modem_t *modem, watch_t *watch, int pppCode, uint64_t now) {
+    switch (modem->backend) {
+        case BACKEND_PPP:
+            ppp_close(&modem->ppp, pppCode);
+            break;
+        case BACKEND_TCP:
+            relay_close(&modem->relay);
+            break;
+        case BACKEND_L2TP:
+            l2tp_close(&modem->l2tp);
+            break;
+        case BACKEND_SLIP:
+        case BACKEND_CSLIP:
+            slip_close(&modem->slip);
+            break;
+        default:
+            if (modem->pppd > 0) {
+                kill(modem->pppd, SIGTERM);
+            }
+            break;
+    }
+    __atomic_store_n(&modem->watchdogEnded, true, __ATOMIC_RELEASE);
+    watch->closedUsec = now;
+}
+
+static void check_line(modem_t *modem, watch_t *watch, uint64_t now) {
+    linkstats_t stats;
+    uint64_t rx = 0;
+    uint64_t tx = 0;
+    uint64_t activity;
+    bool haveLine;
+    bool haveActivity;
+    if (modem->state != CONNECTED) {
+        watch->callStart = 0;
+        return;
+    }
+    if (watch->callStart != modem->call.startUsec) {
+        memset(watch, 0, sizeof(*watch));
+        watch->callStart = modem->call.startUsec;
+        watch->lastRxUsec = now;
+        watch->lastActiveUsec = now;
+        return;
+    }
+    if (watch->closedUsec != 0) {
+        if (modem->backend == BACKEND_PPPD && modem->pppd > 0 && !watch->killed && now - watch->closedUsec >= KILL_USEC) {
+            log_warn(modem->tag, "pppd didn't stop. Killing it.");
+            kill(modem->pppd, SIGKILL);
+            watch->killed = true;
+        }
+        return;
+    }
+
+    haveLine = line_bytes(modem, &rx, &tx);
+    if (haveLine && (!watch->haveLine || rx != watch->rx)) {
+        watch->lastRxUsec = now;
+    }
+    /* Interface packets don't count LCP, so keepalives don't keep an idle call going. */
+    if (linkstats_get(modem->index, &stats)) {
+        activity = stats.rxPackets + stats.txPackets;
+        haveActivity = true;
+    } else {
+        activity = rx + tx;
+        haveActivity = haveLine;
+    }
+    if (haveActivity && activity != watch->activity) {
+        watch->lastActiveUsec = now;
+    }
+    watch->haveLine = haveLine;
+    watch->rx = rx;
+    watch->tx = tx;
+    watch->activity = activity;
+
+    /* With a line watcher, pppd's already been told the moment DCD went. */
+    if (modem->backend == BACKEND_PPPD && !linewatch_active(&modem->lineWatch) && carrier_gone(modem, watch, now)) {
+        log_warn(modem->tag, "Lost carrier. Ending the call.");
+        close_session(modem, watch, PPP_EXIT_HANGUP, now);
+    } else if (stallLimit > 0 && haveLine && (modem->backend == BACKEND_PPPD || modem->backend == BACKEND_PPP || modem->backend == BACKEND_L2TP) &&
+            now - watch->lastRxUsec >= stallLimit*1000000ULL) {
+        log_warn(modem->tag, "Nothing from the caller in %u seconds. Ending the call.", stallLimit);
+        close_session(modem, watch, PPP_EXIT_PEER_DEAD, now);
+    } else if (idleLimit > 0 && haveActivity && now - watch->lastActiveUsec >= idleLimit*1000000ULL) {
+        log_info(modem->tag, "Idle for %u seconds. Ending the call.", idleLimit);
+        close_session(modem, watch, PPP_EXIT_IDLE_TIMEOUT, now);
+    }
+}
+
+static void *watchdog_thread(void *arg) {
+    struct timespec wait = {0, WATCHDOG_TICK_NSEC};
+    int ticks = 0;
+    (void)arg;
+    while (atomic_load(&watchdogRunning)) {
+        if (ticks-- <= 0) {
+            int lines = __atomic_load_n(&numModems, __ATOMIC_ACQUIRE);
+            uint64_t now = clock_usec();
+            for (int i = 0; i < lines; i++) {
+                check_line(modems[i], &watches[i], now);
+            }
+            ticks = CHECK_TICKS;
+        }
+        nanosleep(&wait, NULL);
+    }
+    return NULL;
+}
+
+int watchdog_init(unsigned int idleSec, unsigned int stallSec) {
+    if (atomic_load(&watchdogRunning)) {
+        return -1;
+    }
+    idleLimit = idleSec;
+    stallLimit = stallSec;
+    atomic_store(&watchdogRunning, true);
+    if (pthread_create(&watchdogThread, NULL, watchdog_thread, NULL) != 0) {
+        atomic_store(&watchdogRunning, false);
+        return -2;
+    }
+    return 0;
+}
+
+void watchdog_shutdown(void) {
+    if (atomic_exchange(&watchdogRunning, false)) {
+        pthread_join(watchdogThread, NULL);
+    }
+}
+
+unsigned int watchdog_echo_interval(void) {
+    if (stallLimit == 0) {
+        return 0;
+    }
+    return stallLimit/3 > 0 ? stallLimit/3 : 1;
+}
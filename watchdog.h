@@ -0,0 +1,27 @@
+#ifndef WATCHDOG_H
+#define WATCHDOG_H
+
+/*
+ * Ends calls that are dead or doing nothing, so the line gets back to
+ * dialtone instead of sitting on a call nobody's using. Once a second a
+ * background thread looks at every connected line and closes the session if:
+ *
+ *   - pppd's line has lost carrier and nothing's watching DCD for it (our
+ *     own backends watch DCD themselves),
+ *   - nothing's come in from the caller for stallSec, on backends that run
+ *     PPP and so always hear LCP echo replies from a live caller (pppd gets
+ *     told to send them), or
+ *   - nothing's gone through the session either way for idleSec: packets
+ *     through its interface where it has one, bytes on the line otherwise.
+ *
+ * 0 turns a limit off. pppd gets SIGTERM, then SIGKILL if it doesn't go.
+ */
+
+#define WATCHDOG_DEFAULT_STALL_SEC 90
+
+int watchdog_init(unsigned int idleSec, unsigned int stallSec);
+void watchdog_shutdown(void);
+/* How often pppd should send LCP echoes so the stall check has something to hear. 0 if it's off. */
+unsigned int watchdog_echo_interval(void);
+
+#endif